@@ -1,6 +1,6 @@
 #version 150
 
-uniform vec4 uPalette[256];
+uniform sampler2D uPalette;
 uniform usampler2D uTexture;
 
 in vec2 fTextureCoordinate;
@@ -9,5 +9,5 @@ out vec4 oColour;
 
 void main()
 {
-    oColour = uPalette[texture(uTexture, fTextureCoordinate).r];
+    oColour = texelFetch(uPalette, ivec2(int(texture(uTexture, fTextureCoordinate).r), 0), 0);
 }
@@ -272,6 +272,15 @@ declare global {
          */
         getIcon(iconName: IconName): number;
 
+        /**
+         * Starts running the given code on a background thread. The worker runs in its own
+         * script context with no access to the game, only `postMessage`, `onMessage` and
+         * `console.log` are available to it. Values passed between the plugin and the worker
+         * are copied as JSON. The worker is terminated when the plugin stops.
+         * @param code The source code of the worker.
+         */
+        createWorker(code: string): Worker;
+
         /**
          * Gets a random integer within the specified range using the game's pseudo-
          * random number generator. This is part of the game state and shared across
@@ -368,6 +377,7 @@ declare global {
         queryAction(action: "ridesetsetting", args: RideSetSettingArgs, callback?: (result: GameActionResult) => void): void;
         queryAction(action: "ridesetstatus", args: RideSetStatusArgs, callback?: (result: GameActionResult) => void): void;
         queryAction(action: "ridesetvehicle", args: RideSetVehicleArgs, callback?: (result: GameActionResult) => void): void;
+        queryAction(action: "ridesimulatetest", args: RideSimulateTestArgs, callback?: (result: GameActionResult) => void): void;
         queryAction(action: "scenariosetsetting", args: ScenarioSetSettingArgs, callback?: (result: GameActionResult) => void): void;
         queryAction(action: "signsetname", args: SignSetNameArgs, callback?: (result: GameActionResult) => void): void;
         queryAction(action: "signsetstyle", args: SignSetStyleArgs, callback?: (result: GameActionResult) => void): void;
@@ -383,6 +393,7 @@ declare global {
         queryAction(action: "staffsetpatrolarea", args: StaffSetPatrolAreaArgs, callback?: (result: GameActionResult) => void): void;
         queryAction(action: "surfacesetstyle", args: SurfaceSetStyleArgs, callback?: (result: GameActionResult) => void): void;
         queryAction(action: "tilemodify", args: TileModifyArgs, callback?: (result: GameActionResult) => void): void;
+        queryAction(action: "tilemodify", args: TileModifyBatchArgs, callback?: (result: GameActionResult) => void): void;
         queryAction(action: "trackdesign", args: TrackDesignArgs, callback?: (result: GameActionResult) => void): void;
         queryAction(action: "trackplace", args: TrackPlaceArgs, callback?: (result: GameActionResult) => void): void;
         queryAction(action: "trackremove", args: TrackRemoveArgs, callback?: (result: GameActionResult) => void): void;
@@ -460,6 +471,7 @@ declare global {
         executeAction(action: "ridesetsetting", args: RideSetSettingArgs, callback?: (result: GameActionResult) => void): void;
         executeAction(action: "ridesetstatus", args: RideSetStatusArgs, callback?: (result: GameActionResult) => void): void;
         executeAction(action: "ridesetvehicle", args: RideSetVehicleArgs, callback?: (result: GameActionResult) => void): void;
+        executeAction(action: "ridesimulatetest", args: RideSimulateTestArgs, callback?: (result: GameActionResult) => void): void;
         executeAction(action: "scenariosetsetting", args: ScenarioSetSettingArgs, callback?: (result: GameActionResult) => void): void;
         executeAction(action: "signsetname", args: SignSetNameArgs, callback?: (result: GameActionResult) => void): void;
         executeAction(action: "signsetstyle", args: SignSetStyleArgs, callback?: (result: GameActionResult) => void): void;
@@ -475,6 +487,7 @@ declare global {
         executeAction(action: "staffsetpatrolarea", args: StaffSetPatrolAreaArgs, callback?: (result: GameActionResult) => void): void;
         executeAction(action: "surfacesetstyle", args: SurfaceSetStyleArgs, callback?: (result: GameActionResult) => void): void;
         executeAction(action: "tilemodify", args: TileModifyArgs, callback?: (result: GameActionResult) => void): void;
+        executeAction(action: "tilemodify", args: TileModifyBatchArgs, callback?: (result: GameActionResult) => void): void;
         executeAction(action: "trackdesign", args: TrackDesignArgs, callback?: (result: GameActionResult) => void): void;
         executeAction(action: "trackplace", args: TrackPlaceArgs, callback?: (result: GameActionResult) => void): void;
         executeAction(action: "trackremove", args: TrackRemoveArgs, callback?: (result: GameActionResult) => void): void;
@@ -511,6 +524,17 @@ declare global {
          */
         subscribe(hook: "map.changed", callback: () => void): IDisposable;
 
+        /**
+         * Subscribes to the given hook with the events of each game tick passed as one array once the tick has
+         * finished, instead of a call for every event. Only hooks whose callbacks can not change the outcome of
+         * the event can be batched.
+         */
+        subscribe(hook: "action.execute", callback: (e: GameActionEventArgs[]) => void, options: SubscribeOptions): IDisposable;
+        subscribe(hook: "guest.generation", callback: (e: GuestGenerationArgs[]) => void, options: SubscribeOptions): IDisposable;
+        subscribe(hook: "vehicle.crash", callback: (e: VehicleCrashArgs[]) => void, options: SubscribeOptions): IDisposable;
+        subscribe(hook: "network.join", callback: (e: NetworkEventArgs[]) => void, options: SubscribeOptions): IDisposable;
+        subscribe(hook: "network.leave", callback: (e: NetworkEventArgs[]) => void, options: SubscribeOptions): IDisposable;
+
         /**
          * Registers a function to be called every so often in realtime, specified by the given delay.
          * @param callback The function to call every time the delay has elapsed.
@@ -694,6 +718,7 @@ declare global {
         "ridesetsetting" |
         "ridesetstatus" |
         "ridesetvehicle" |
+        "ridesimulatetest" |
         "scenariosetsetting" |
         "signsetname" |
         "signsetstyle" |
@@ -1124,6 +1149,10 @@ declare global {
         colour: number; // only used if type is ride entry
     }
 
+    interface RideSimulateTestArgs extends GameActionArgs {
+        ride: number;
+    }
+
     interface ScenarioSetSettingArgs extends GameActionArgs {
         setting: number; // see ScenarioSetSetting in openrct2/actions/ScenarioSetSettingAction.h
         value: number;
@@ -1230,6 +1259,21 @@ declare global {
         value2: number; // see openrct2/actions/TileModifyAction.cpp
     }
 
+    /**
+     * Applies up to 4096 tile modifications as a single action. Each modification is checked against
+     * the map as it is before the batch, so they should not depend on each other. Pasting elements
+     * is not supported in a batch.
+     */
+    interface TileModifyBatchArgs extends GameActionArgs {
+        modifications: {
+            x: number;
+            y: number;
+            setting: number;
+            value1: number;
+            value2: number;
+        }[];
+    }
+
     // currently unsupported
     interface TrackDesignArgs extends GameActionArgs {
         x: number;
@@ -1366,6 +1410,13 @@ declare global {
         nausea: number;
     }
 
+    interface SubscribeOptions {
+        batched: boolean;
+    }
+
+    /**
+     * The same object is passed for every location that is checked, it is only valid during the callback.
+     */
     interface ActionLocationArgs {
         readonly x: number;
         readonly y: number;
@@ -1431,6 +1482,14 @@ declare global {
 
         getRide(id: number): Ride;
         getTile(x: number, y: number): Tile;
+        /**
+         * Calls the callback for every tile in the range, or the whole map if no range is given, row by row.
+         * The same tile object is passed for every tile, so it must not be kept after the callback returns.
+         * Iteration stops when the callback returns false.
+         * @param range The area to iterate in game coordinates (32 per tile).
+         * @param callback The function to call for each tile.
+         */
+        forEachTile(range: MapRange | undefined, callback: (tile: Tile) => boolean | void): void;
         getEntity(id: number): Entity;
         getAllEntities(type: EntityType): Entity[];
         /**
@@ -1446,6 +1505,18 @@ declare global {
         getAllEntitiesOnTile(type: "staff", tilePos: CoordsXY): Staff[];
         getAllEntitiesOnTile(type: "car", tilePos: CoordsXY): Car[];
         getAllEntitiesOnTile(type: "litter", tilePos: CoordsXY): Litter[];
+        /**
+         * Reads the given fields of every entity of a type into one typed array per field, without creating an
+         * object for each entity. Element i of every array belongs to the same entity, the "id" field is always
+         * included.
+         * Available fields are "id", "x", "y" and "z" for all types, "energy", "energyTarget" and "mass" for
+         * guests and staff, "happiness", "happinessTarget", "nausea", "nauseaTarget", "hunger", "thirst", "toilet"
+         * and "cash" for guests, "staffType" for staff and "ride" and "velocity" for cars.
+         * @param type The type of entity to query.
+         * @param fields The names of the fields to read.
+         */
+        queryEntities<T extends string>(
+            type: "balloon" | "car" | "litter" | "duck" | "guest" | "staff", fields: T[]): EntityQueryResult<T>;
         createEntity(type: EntityType, initializer: object): Entity;
 
         /**
@@ -1638,6 +1709,12 @@ declare global {
         insertElement(index: number): TileElement;
         /** Removes the tile element at the given index from this tile. */
         removeElement(index: number): void;
+        /**
+         * Calls the callback for every element on this tile, from the bottom up.
+         * The same element object is passed for every element, so it must not be kept after the callback
+         * returns. Iteration stops when the callback returns false.
+         */
+        forEachElement(callback: (element: TileElement, index: number) => boolean | void): void;
     }
 
     type ObjectSourceGame =
@@ -3330,6 +3407,11 @@ declare global {
          * A hash of the player's public key used to authenticate with the server.
          */
         readonly publicKeyHash: string;
+
+        /**
+         * Network statistics for the player's connection. Only available on the server.
+         */
+        readonly stats: NetworkStats;
     }
 
     /**
@@ -3366,6 +3448,52 @@ declare global {
          * The number of bytes sent for each category.
          */
         readonly bytesSent: number[];
+
+        /**
+         * Milliseconds between a ping and its reply. Only recorded on the server.
+         */
+        readonly roundTripTime: NetworkHistogram;
+
+        /**
+         * The number of packets waiting to be sent, sampled each time the send queue is flushed.
+         */
+        readonly queueDepth: NetworkHistogram;
+
+        /**
+         * The number of bytes waiting to be sent, sampled each time the send queue is flushed.
+         */
+        readonly bytesPerFlush: NetworkHistogram;
+
+        /**
+         * Microseconds spent handling each received game action.
+         */
+        readonly actionLatency: NetworkHistogram;
+    }
+
+    /**
+     * A distribution of samples in power of two buckets.
+     */
+    interface NetworkHistogram {
+        /**
+         * The number of samples in each bucket. Bucket 0 counts samples of 0, bucket n counts
+         * samples from 2^(n-1) up to 2^n - 1. The last bucket also counts all larger samples.
+         */
+        readonly buckets: number[];
+
+        /**
+         * The total number of samples.
+         */
+        readonly count: number;
+
+        /**
+         * The sum of all samples.
+         */
+        readonly sum: number;
+
+        /**
+         * The largest sample.
+         */
+        readonly max: number;
     }
 
     type PermissionType =
@@ -4554,6 +4682,28 @@ declare global {
         off(event: "data", callback: (data: string) => void): Socket;
     }
 
+    /**
+     * A script running on a background thread, see `context.createWorker`.
+     * Messages from the worker are delivered at the start of the next tick.
+     */
+    interface Worker {
+        /**
+         * Sends a copy of the given value to the worker's `onMessage` handler.
+         */
+        postMessage(message: any): void;
+
+        /**
+         * Stops the worker, interrupting any code it is running.
+         */
+        terminate(): void;
+
+        on(event: "message", callback: (message: any) => void): Worker;
+        on(event: "error", callback: (message: string) => void): Worker;
+
+        off(event: "message", callback: (message: any) => void): Worker;
+        off(event: "error", callback: (message: string) => void): Worker;
+    }
+
     interface TitleSequence {
         /**
          * The name of the title sequence.
@@ -4868,12 +5018,133 @@ declare global {
 
     interface Profiler {
         getData(): ProfiledFunction[];
+        /**
+         * Gets the counters recorded for the most recent ticks, oldest first.
+         * These are always recorded, even while the profiler is stopped.
+         * @param count The maximum number of ticks to return, defaults to all recorded ticks.
+         */
+        getTickStats(count?: number): TickStats[];
+        /**
+         * Measures the memory currently held by each subsystem of the game.
+         */
+        getMemoryUsage(): SubsystemMemoryUsage[];
+        /**
+         * Gets frame pacing statistics over the most recently presented frames, times are in milliseconds.
+         */
+        getFrameStats(): FrameStats;
+        /**
+         * Gets the time each plugin has spent in its callbacks. Time spent in the callbacks of
+         * another plugin, e.g. from a hook triggered by an action, is only counted for that plugin.
+         */
+        getPluginStats(): PluginStats[];
         start(): void;
         stop(): void;
         reset(): void;
         readonly enabled: boolean;
     }
 
+    interface TickStats {
+        readonly tick: number;
+        /**
+         * Time taken to update the game state for the tick, in milliseconds.
+         */
+        readonly tickTime: number;
+        /**
+         * Duration of the most recent frame when the tick ran, in milliseconds.
+         */
+        readonly frameTime: number;
+        readonly tileElements: number;
+        /**
+         * Number of packets waiting to be sent across all connections.
+         */
+        readonly networkQueueDepth: number;
+        readonly gameActions: number;
+        readonly entities: {
+            readonly vehicle: number;
+            readonly guest: number;
+            readonly staff: number;
+            readonly litter: number;
+            readonly misc: number;
+        };
+    }
+
+    type EntityQueryResult<T extends string> = {
+        readonly count: number;
+        readonly id: Int32Array;
+    } & {
+        readonly [field in T]: Int32Array;
+    };
+
+    interface FrameStats {
+        readonly frames: number;
+        readonly meanFrameTime: number;
+        readonly frameTimeStdDev: number;
+        readonly p99FrameTime: number;
+        readonly maxFrameTime: number;
+        /**
+         * Frames that took longer than one and a half refresh intervals, or game ticks when the frame rate is not
+         * uncapped.
+         */
+        readonly missedFrames: number;
+        /**
+         * Number of missed frames by the part of the game loop that took the longest in them.
+         */
+        readonly missedReasons: {
+            readonly events: number;
+            readonly game_ticks: number;
+            readonly ui_update: number;
+            readonly paint: number;
+            readonly present: number;
+            readonly sleep: number;
+        };
+        /**
+         * Number of frames that handled a key press, mouse click or touch.
+         */
+        readonly inputSamples: number;
+        /**
+         * Time from the oldest input event handled in a frame until that frame was presented.
+         */
+        readonly meanInputLatency: number;
+        readonly p95InputLatency: number;
+        readonly maxInputLatency: number;
+    }
+
+    interface PluginStats {
+        readonly name: string;
+        readonly calls: number;
+        /**
+         * Calls skipped while the plugin was throttled for going over the tick budget.
+         */
+        readonly skippedCalls: number;
+        /**
+         * Total time spent in the plugin's callbacks, in milliseconds.
+         */
+        readonly totalTime: number;
+        readonly lastTickTime: number;
+        readonly peakTickTime: number;
+        readonly ticks: number;
+        /**
+         * Number of ticks in which the plugin went over the tick budget set in the config.
+         */
+        readonly overBudgetTicks: number;
+    }
+
+    type MemorySubsystem =
+        "tile_elements" | "entities" | "spatial_index" | "object_images" | "g1" | "ttf" |
+        "drawing_engine" | "network" | "snapshots";
+
+    interface SubsystemMemoryUsage {
+        readonly name: MemorySubsystem;
+        /**
+         * Estimated from the capacity of the containers owned by the subsystem.
+         */
+        readonly bytes: number;
+        /**
+         * Highest value of bytes seen since the game started or "memory_stats reset" was run in the console.
+         */
+        readonly peakBytes: number;
+    }
+
     interface ProfiledFunction {
         readonly name: string;
         readonly callCount: number;
@@ -41,6 +41,7 @@
 #include <openrct2/interface/InteractiveConsole.h>
 #include <openrct2/localisation/StringIds.h>
 #include <openrct2/platform/Platform.h>
+#include <openrct2/profiling/FramePacing.h>
 #include <openrct2/scripting/ScriptEngine.h>
 #include <openrct2/title/TitleSequencePlayer.h>
 #include <openrct2/ui/UiContext.h>
@@ -331,6 +332,13 @@ public:
         SDL_Event e;
         while (SDL_PollEvent(&e))
         {
+            if (e.type == SDL_MOUSEBUTTONDOWN || e.type == SDL_MOUSEWHEEL || e.type == SDL_KEYDOWN
+                || e.type == SDL_FINGERDOWN)
+            {
+                const auto now = SDL_GetTicks();
+                FramePacing::RecordInput(now > e.common.timestamp ? now - e.common.timestamp : 0);
+            }
+
             switch (e.type)
             {
                 case SDL_QUIT:
@@ -357,6 +365,7 @@ public:
                                 gConfigGeneral.DefaultDisplay = displayIndex;
                                 ConfigSaveDefault();
                             }
+                            UpdateRefreshRate();
                             break;
                         }
                     }
@@ -761,6 +770,7 @@ private:
         OnResize(width, height);
 
         UpdateFullscreenResolutions();
+        UpdateRefreshRate();
 
         // Fix #4022: Force Mac to windowed to avoid cursor offset on launch issue
 #ifdef __MACOSX__
@@ -771,6 +781,20 @@ private:
         TriggerResize();
     }
 
+    void UpdateRefreshRate()
+    {
+        SDL_DisplayMode mode{};
+        int32_t displayIndex = SDL_GetWindowDisplayIndex(_window);
+        if (displayIndex >= 0 && SDL_GetCurrentDisplayMode(displayIndex, &mode) == 0)
+        {
+            FramePacing::SetRefreshRate(mode.refresh_rate);
+        }
+        else
+        {
+            FramePacing::SetRefreshRate(0);
+        }
+    }
+
     void OnResize(int32_t width, int32_t height)
     {
         // Scale the native window size to the game's canvas size
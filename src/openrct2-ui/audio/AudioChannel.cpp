@@ -12,6 +12,7 @@
 #include "SDLAudioSource.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <openrct2/audio/AudioSource.h>
 #include <openrct2/common.h>
@@ -28,20 +29,22 @@ namespace OpenRCT2::Audio
         SpeexResamplerState* _resampler = nullptr;
 
         MixerGroup _group = MixerGroup::Sound;
-        double _rate = 0;
         uint64_t _offset = 0;
         int32_t _loop = 0;
 
-        int32_t _volume = 1;
-        float _volume_l = 0.f;
-        float _volume_r = 0.f;
+        // Written by the game thread while the mixer is reading them, without any lock
+        std::atomic<double> _rate = 0;
+        std::atomic<int32_t> _volume = 1;
+        std::atomic<float> _volume_l = 0.f;
+        std::atomic<float> _volume_r = 0.f;
+        std::atomic<float> _pan = 0;
+        std::atomic<bool> _stopping = false;
+        std::atomic<bool> _done = true;
+
         float _oldvolume_l = 0.f;
         float _oldvolume_r = 0.f;
         int32_t _oldvolume = 0;
-        float _pan = 0;
 
-        bool _stopping = false;
-        bool _done = true;
         bool _deleteondone = false;
 
     public:
@@ -165,10 +168,11 @@ namespace OpenRCT2::Audio
 
         void SetPan(float pan) override
         {
-            _pan = std::clamp(pan, 0.0f, 1.0f);
-            double decibels = (std::abs(_pan - 0.5) * 2.0) * 100.0;
+            pan = std::clamp(pan, 0.0f, 1.0f);
+            _pan = pan;
+            double decibels = (std::abs(pan - 0.5) * 2.0) * 100.0;
             double attenuation = pow(10, decibels / 20.0);
-            if (_pan <= 0.5)
+            if (pan <= 0.5f)
             {
                 _volume_l = 1.0;
                 _volume_r = static_cast<float>(1.0 / attenuation);
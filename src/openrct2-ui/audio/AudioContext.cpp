@@ -25,7 +25,7 @@ namespace OpenRCT2::Audio
     class AudioContext final : public IAudioContext
     {
     private:
-        static constexpr size_t STREAM_MIN_SIZE = 2 * 1024 * 1024; // 2 MiB
+        static constexpr size_t STREAM_MIN_SIZE = 1024 * 1024; // 1 MiB
 
         std::unique_ptr<AudioMixer> _audioMixer;
 
@@ -107,13 +107,17 @@ namespace OpenRCT2::Audio
             {
                 auto source = CreateAudioSource(rw);
 
-                // Load whole stream into memory if small enough
+                // Load whole stream into memory if small enough, otherwise decode it while it plays
                 auto dataLength = source->GetLength();
                 if (dataLength < STREAM_MIN_SIZE)
                 {
                     auto& targetFormat = _audioMixer->GetFormat();
                     source = source->ToMemory(targetFormat);
                 }
+                else
+                {
+                    source = CreateStreamingAudioSource(std::move(source));
+                }
 
                 return AddSource(std::move(source));
             }
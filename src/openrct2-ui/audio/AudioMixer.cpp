@@ -15,6 +15,14 @@
 #include <openrct2/config/Config.h>
 #include <speex/speex_resampler.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define OPENRCT2_MIXER_SSE2
+#    include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#    define OPENRCT2_MIXER_NEON
+#    include <arm_neon.h>
+#endif
+
 using namespace OpenRCT2::Audio;
 
 AudioMixer::~AudioMixer()
@@ -51,6 +59,7 @@ void AudioMixer::Close()
 {
     // Free channels
     Lock();
+    AcceptPendingChannels();
     _channels.clear();
     Unlock();
 
@@ -75,20 +84,50 @@ void AudioMixer::Unlock()
     SDL_UnlockAudioDevice(_deviceId);
 }
 
-std::shared_ptr<IAudioChannel> AudioMixer::Play(IAudioSource* source, int32_t loop, bool deleteondone)
+std::shared_ptr<IAudioChannel> AudioMixer::Play(
+    IAudioSource* source, int32_t loop, bool deleteondone, MixerGroup group, int32_t volume, float pan, double rate)
 {
-    Lock();
     auto channel = std::shared_ptr<ISDLAudioChannel>(AudioChannel::Create());
     if (channel != nullptr)
     {
         channel->Play(source, loop);
         channel->SetDeleteOnDone(deleteondone);
-        _channels.push_back(channel);
+        channel->SetGroup(group);
+        channel->SetVolume(volume);
+        channel->SetPan(pan);
+        channel->SetRate(rate);
+        channel->UpdateOldVolume();
+
+        auto* pending = new PendingChannel{ channel, _pendingChannels.load(std::memory_order_relaxed) };
+        while (!_pendingChannels.compare_exchange_weak(
+            pending->Next, pending, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
     }
-    Unlock();
     return channel;
 }
 
+void AudioMixer::AcceptPendingChannels()
+{
+    // The list is newest first, reverse it so channels start in the order they were played
+    auto* pending = _pendingChannels.exchange(nullptr, std::memory_order_acquire);
+    PendingChannel* ordered = nullptr;
+    while (pending != nullptr)
+    {
+        auto* next = pending->Next;
+        pending->Next = ordered;
+        ordered = pending;
+        pending = next;
+    }
+    while (ordered != nullptr)
+    {
+        auto* next = ordered->Next;
+        _channels.push_back(std::move(ordered->Channel));
+        delete ordered;
+        ordered = next;
+    }
+}
+
 void AudioMixer::SetVolume(float volume)
 {
     _volume = volume;
@@ -126,6 +165,7 @@ const AudioFormat& AudioMixer::GetFormat() const
 
 void AudioMixer::GetNextAudioChunk(uint8_t* dst, size_t length)
 {
+    AcceptPendingChannels();
     UpdateAdjustedSound();
 
     // Zero the output buffer
@@ -198,29 +238,27 @@ void AudioMixer::MixChannel(ISDLAudioChannel* channel, uint8_t* data, size_t len
         mustConvert = true;
     }
 
-    // Read raw PCM from channel
+    // Read raw PCM from channel, straight into the conversion buffer if it needs converting
     int32_t readSamples = numSamples * rate;
     auto readLength = static_cast<size_t>(readSamples / cvt.len_ratio) * byteRate;
-    _channelBuffer.resize(readLength);
-    size_t bytesRead = channel->Read(_channelBuffer.data(), readLength);
-
-    // Convert data to required format if necessary
+    size_t bytesRead = 0;
     void* buffer = nullptr;
     size_t bufferLen = 0;
     if (mustConvert)
     {
-        if (Convert(&cvt, _channelBuffer.data(), bytesRead))
-        {
-            buffer = cvt.buf;
-            bufferLen = cvt.len_cvt;
-        }
-        else
+        _convertBuffer.resize(readLength * std::max(cvt.len_mult, 1));
+        bytesRead = channel->Read(_convertBuffer.data(), readLength);
+        if (!Convert(&cvt, bytesRead))
         {
             return;
         }
+        buffer = cvt.buf;
+        bufferLen = cvt.len_cvt;
     }
     else
     {
+        _channelBuffer.resize(readLength);
+        bytesRead = channel->Read(_channelBuffer.data(), readLength);
         buffer = _channelBuffer.data();
         bufferLen = bytesRead;
     }
@@ -246,7 +284,17 @@ void AudioMixer::MixChannel(ISDLAudioChannel* channel, uint8_t* data, size_t len
 
     // Finally mix on to destination buffer
     size_t dstLength = std::min(length, bufferLen);
-    SDL_MixAudioFormat(data, static_cast<const uint8_t*>(buffer), _format.format, static_cast<uint32_t>(dstLength), mixVolume);
+    if (_format.format == AUDIO_S16SYS)
+    {
+        MixS16(
+            reinterpret_cast<int16_t*>(data), static_cast<const int16_t*>(buffer), static_cast<int32_t>(dstLength / 2),
+            mixVolume);
+    }
+    else
+    {
+        SDL_MixAudioFormat(
+            data, static_cast<const uint8_t*>(buffer), _format.format, static_cast<uint32_t>(dstLength), mixVolume);
+    }
 
     channel->UpdateOldVolume();
 }
@@ -346,18 +394,57 @@ int32_t AudioMixer::ApplyVolume(const IAudioChannel* channel, void* buffer, size
 
 void AudioMixer::EffectPanS16(const IAudioChannel* channel, int16_t* data, int32_t length)
 {
+    // Gains ramp from the old towards the new volume; frame i is scaled by old + i * d
     const float dt = 1.0f / static_cast<float>(length * 2.0f);
-    float volumeL = channel->GetOldVolumeL();
-    float volumeR = channel->GetOldVolumeR();
-    const float d_left = dt * (channel->GetVolumeL() - channel->GetOldVolumeL());
-    const float d_right = dt * (channel->GetVolumeR() - channel->GetOldVolumeR());
-
-    for (int32_t i = 0; i < length * 2; i += 2)
+    const float oldVolumeL = channel->GetOldVolumeL();
+    const float oldVolumeR = channel->GetOldVolumeR();
+    const float d_left = dt * (channel->GetVolumeL() - oldVolumeL);
+    const float d_right = dt * (channel->GetVolumeR() - oldVolumeR);
+
+    int32_t frame = 0;
+#if defined(OPENRCT2_MIXER_SSE2)
+    const __m128 base = _mm_setr_ps(oldVolumeL, oldVolumeR, oldVolumeL + d_left, oldVolumeR + d_right);
+    const __m128 step = _mm_setr_ps(d_left, d_right, d_left, d_right);
+    const __m128 step2 = _mm_add_ps(step, step);
+    for (; frame + 4 <= length; frame += 4)
+    {
+        const __m128 gain0 = _mm_add_ps(base, _mm_mul_ps(step, _mm_set1_ps(static_cast<float>(frame))));
+        const __m128 gain1 = _mm_add_ps(gain0, step2);
+
+        auto* ptr = reinterpret_cast<__m128i*>(data + frame * 2);
+        const __m128i samples = _mm_loadu_si128(ptr);
+        const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+        const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+        const __m128i scaledLo = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(lo), gain0));
+        const __m128i scaledHi = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(hi), gain1));
+        _mm_storeu_si128(ptr, _mm_packs_epi32(scaledLo, scaledHi));
+    }
+#elif defined(OPENRCT2_MIXER_NEON)
+    const float baseValues[4] = { oldVolumeL, oldVolumeR, oldVolumeL + d_left, oldVolumeR + d_right };
+    const float stepValues[4] = { d_left, d_right, d_left, d_right };
+    const float32x4_t base = vld1q_f32(baseValues);
+    const float32x4_t step = vld1q_f32(stepValues);
+    const float32x4_t step2 = vaddq_f32(step, step);
+    for (; frame + 4 <= length; frame += 4)
     {
-        data[i + 0] = static_cast<int16_t>(volumeL * static_cast<float>(data[i + 0]));
-        data[i + 1] = static_cast<int16_t>(volumeR * static_cast<float>(data[i + 1]));
-        volumeL += d_left;
-        volumeR += d_right;
+        const float32x4_t gain0 = vmlaq_n_f32(base, step, static_cast<float>(frame));
+        const float32x4_t gain1 = vaddq_f32(gain0, step2);
+
+        int16_t* ptr = data + frame * 2;
+        const int16x8_t samples = vld1q_s16(ptr);
+        const float32x4_t lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(samples)));
+        const float32x4_t hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(samples)));
+        const int32x4_t scaledLo = vcvtq_s32_f32(vmulq_f32(lo, gain0));
+        const int32x4_t scaledHi = vcvtq_s32_f32(vmulq_f32(hi, gain1));
+        vst1q_s16(ptr, vcombine_s16(vqmovn_s32(scaledLo), vqmovn_s32(scaledHi)));
+    }
+#endif
+    for (; frame < length; frame++)
+    {
+        const float volumeL = oldVolumeL + static_cast<float>(frame) * d_left;
+        const float volumeR = oldVolumeR + static_cast<float>(frame) * d_right;
+        data[frame * 2 + 0] = static_cast<int16_t>(volumeL * static_cast<float>(data[frame * 2 + 0]));
+        data[frame * 2 + 1] = static_cast<int16_t>(volumeR * static_cast<float>(data[frame * 2 + 1]));
     }
 }
 
@@ -380,12 +467,50 @@ void AudioMixer::EffectFadeS16(int16_t* data, int32_t length, int32_t startvolum
 {
     static_assert(SDL_MIX_MAXVOLUME == kMixerVolumeMax, "Max volume differs between OpenRCT2 and SDL2");
 
-    float startvolume_f = static_cast<float>(startvolume) / SDL_MIX_MAXVOLUME;
-    float endvolume_f = static_cast<float>(endvolume) / SDL_MIX_MAXVOLUME;
-    for (int32_t i = 0; i < length; i++)
+    // Sample i is scaled by start + i * d, a linear fade from the start to the end volume
+    const float startvolume_f = static_cast<float>(startvolume) / SDL_MIX_MAXVOLUME;
+    const float endvolume_f = static_cast<float>(endvolume) / SDL_MIX_MAXVOLUME;
+    const float d = (endvolume_f - startvolume_f) / static_cast<float>(length);
+
+    int32_t i = 0;
+#if defined(OPENRCT2_MIXER_SSE2)
+    const __m128 base = _mm_add_ps(_mm_set1_ps(startvolume_f), _mm_mul_ps(_mm_set1_ps(d), _mm_setr_ps(0, 1, 2, 3)));
+    const __m128 step4 = _mm_set1_ps(d * 4);
+    for (; i + 8 <= length; i += 8)
     {
-        float t = static_cast<float>(i) / length;
-        data[i] = static_cast<int16_t>(data[i] * ((1.0f - t) * startvolume_f + t * endvolume_f));
+        const __m128 gain0 = _mm_add_ps(base, _mm_mul_ps(_mm_set1_ps(d), _mm_set1_ps(static_cast<float>(i))));
+        const __m128 gain1 = _mm_add_ps(gain0, step4);
+
+        auto* ptr = reinterpret_cast<__m128i*>(data + i);
+        const __m128i samples = _mm_loadu_si128(ptr);
+        const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+        const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+        const __m128i scaledLo = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(lo), gain0));
+        const __m128i scaledHi = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(hi), gain1));
+        _mm_storeu_si128(ptr, _mm_packs_epi32(scaledLo, scaledHi));
+    }
+#elif defined(OPENRCT2_MIXER_NEON)
+    const float offsets[4] = { 0, 1, 2, 3 };
+    const float32x4_t base = vmlaq_n_f32(vdupq_n_f32(startvolume_f), vld1q_f32(offsets), d);
+    const float32x4_t step4 = vdupq_n_f32(d * 4);
+    for (; i + 8 <= length; i += 8)
+    {
+        const float32x4_t gain0 = vaddq_f32(base, vdupq_n_f32(d * static_cast<float>(i)));
+        const float32x4_t gain1 = vaddq_f32(gain0, step4);
+
+        int16_t* ptr = data + i;
+        const int16x8_t samples = vld1q_s16(ptr);
+        const float32x4_t lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(samples)));
+        const float32x4_t hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(samples)));
+        const int32x4_t scaledLo = vcvtq_s32_f32(vmulq_f32(lo, gain0));
+        const int32x4_t scaledHi = vcvtq_s32_f32(vmulq_f32(hi, gain1));
+        vst1q_s16(ptr, vcombine_s16(vqmovn_s32(scaledLo), vqmovn_s32(scaledHi)));
+    }
+#endif
+    for (; i < length; i++)
+    {
+        const float volume = startvolume_f + static_cast<float>(i) * d;
+        data[i] = static_cast<int16_t>(data[i] * volume);
     }
 }
 
@@ -402,17 +527,55 @@ void AudioMixer::EffectFadeU8(uint8_t* data, int32_t length, int32_t startvolume
     }
 }
 
-bool AudioMixer::Convert(SDL_AudioCVT* cvt, const void* src, size_t len)
+/**
+ * Adds src scaled by volume onto dst, saturating at the limits of a signed 16-bit sample.
+ * Does the same as SDL_MixAudioFormat for AUDIO_S16SYS, several samples at a time.
+ */
+void AudioMixer::MixS16(int16_t* dst, const int16_t* src, int32_t length, int32_t volume)
+{
+    int32_t i = 0;
+#if defined(OPENRCT2_MIXER_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i vol = _mm_set1_epi32(volume);
+    for (; i + 8 <= length; i += 8)
+    {
+        const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        auto* out = reinterpret_cast<__m128i*>(dst + i);
+
+        // Each 32-bit lane of vol is (volume, 0) as 16-bit pairs, so madd gives sample * volume per lane
+        const __m128i lo = _mm_srai_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(samples, zero), vol), 7);
+        const __m128i hi = _mm_srai_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(samples, zero), vol), 7);
+        _mm_storeu_si128(out, _mm_adds_epi16(_mm_loadu_si128(out), _mm_packs_epi32(lo, hi)));
+    }
+#elif defined(OPENRCT2_MIXER_NEON)
+    const auto vol = static_cast<int16_t>(volume);
+    for (; i + 8 <= length; i += 8)
+    {
+        const int16x8_t samples = vld1q_s16(src + i);
+        const int32x4_t lo = vshrq_n_s32(vmull_n_s16(vget_low_s16(samples), vol), 7);
+        const int32x4_t hi = vshrq_n_s32(vmull_n_s16(vget_high_s16(samples), vol), 7);
+        const int16x8_t scaled = vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi));
+        vst1q_s16(dst + i, vqaddq_s16(vld1q_s16(dst + i), scaled));
+    }
+#endif
+    for (; i < length; i++)
+    {
+        const int32_t mixed = dst[i] + ((src[i] * volume) >> 7);
+        dst[i] = static_cast<int16_t>(std::clamp<int32_t>(mixed, INT16_MIN, INT16_MAX));
+    }
+}
+
+/**
+ * Converts the first len bytes of _convertBuffer in place, which must already be large
+ * enough for len * cvt->len_mult bytes.
+ */
+bool AudioMixer::Convert(SDL_AudioCVT* cvt, size_t len)
 {
     // tofix: there seems to be an issue with converting audio using SDL_ConvertAudio in the callback vs preconverted,
     // can cause pops and static depending on sample rate and channels
     bool result = false;
     if (len != 0 && cvt->len_mult != 0)
     {
-        size_t reqConvertBufferCapacity = len * cvt->len_mult;
-        _convertBuffer.resize(reqConvertBufferCapacity);
-        std::copy_n(static_cast<const uint8_t*>(src), len, _convertBuffer.data());
-
         cvt->len = static_cast<int32_t>(len);
         cvt->buf = static_cast<uint8_t*>(_convertBuffer.data());
         if (SDL_ConvertAudio(cvt) >= 0)
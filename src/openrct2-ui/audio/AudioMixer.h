@@ -14,6 +14,7 @@
 #include "SDLAudioSource.h"
 
 #include <SDL.h>
+#include <atomic>
 #include <cstdint>
 #include <list>
 #include <memory>
@@ -35,6 +36,18 @@ namespace OpenRCT2::Audio
         SDL_AudioDeviceID _deviceId = 0;
         AudioFormat _format = {};
         std::list<std::shared_ptr<ISDLAudioChannel>> _channels;
+
+        /**
+         * Channels started by Play that the mixer has not picked up yet. Other threads push onto this lock-free
+         * list and the audio callback takes the whole list at the start of each chunk, so starting a sound never
+         * waits for a chunk to finish mixing.
+         */
+        struct PendingChannel
+        {
+            std::shared_ptr<ISDLAudioChannel> Channel;
+            PendingChannel* Next{};
+        };
+        std::atomic<PendingChannel*> _pendingChannels{};
         float _volume = 1.0f;
         float _adjustSoundVolume = 0.0f;
         float _adjustMusicVolume = 0.0f;
@@ -53,13 +66,16 @@ namespace OpenRCT2::Audio
         void Close() override;
         void Lock() override;
         void Unlock() override;
-        std::shared_ptr<IAudioChannel> Play(IAudioSource* source, int32_t loop, bool deleteondone) override;
+        std::shared_ptr<IAudioChannel> Play(
+            IAudioSource* source, int32_t loop, bool deleteondone, MixerGroup group, int32_t volume, float pan,
+            double rate) override;
         void SetVolume(float volume) override;
         SDLAudioSource* AddSource(std::unique_ptr<SDLAudioSource> source);
 
         const AudioFormat& GetFormat() const;
 
     private:
+        void AcceptPendingChannels();
         void GetNextAudioChunk(uint8_t* dst, size_t length);
         void UpdateAdjustedSound();
         void MixChannel(ISDLAudioChannel* channel, uint8_t* data, size_t length);
@@ -78,6 +94,7 @@ namespace OpenRCT2::Audio
         static void EffectPanU8(const IAudioChannel* channel, uint8_t* data, int32_t length);
         static void EffectFadeS16(int16_t* data, int32_t length, int32_t startvolume, int32_t endvolume);
         static void EffectFadeU8(uint8_t* data, int32_t length, int32_t startvolume, int32_t endvolume);
-        bool Convert(SDL_AudioCVT* cvt, const void* src, size_t len);
+        static void MixS16(int16_t* dst, const int16_t* src, int32_t length, int32_t volume);
+        bool Convert(SDL_AudioCVT* cvt, size_t len);
     };
 } // namespace OpenRCT2::Audio
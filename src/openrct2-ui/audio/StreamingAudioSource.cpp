@@ -0,0 +1,206 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "AudioFormat.h"
+#include "SDLAudioSource.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <openrct2/common.h>
+#include <thread>
+#include <vector>
+
+namespace OpenRCT2::Audio
+{
+    /**
+     * An audio source that decodes another source ahead of playback on a background thread. Only a small ring
+     * buffer of PCM data is kept in memory, so long music tracks do not have to be decoded up front.
+     */
+    class StreamingAudioSource final : public SDLAudioSource
+    {
+    private:
+        static constexpr size_t kRingSize = 256 * 1024;
+        static constexpr size_t kDecodeChunkSize = 16 * 1024;
+
+        std::unique_ptr<SDLAudioSource> _decoder;
+        AudioFormat _format = {};
+        uint64_t _length{};
+
+        // Only one thread may use the decoder at a time, it keeps its own read position
+        std::mutex _decoderMutex;
+
+        // Guards everything below. The ring holds the decoded bytes [_ringStart, _ringStart + _ringFill)
+        std::mutex _mutex;
+        std::condition_variable _decodeNeeded;
+        std::vector<uint8_t> _ring;
+        size_t _ringHead{};
+        size_t _ringFill{};
+        uint64_t _ringStart{};
+        uint32_t _generation{};
+        bool _endOfStream{};
+        bool _stopping{};
+
+        std::thread _thread;
+
+    public:
+        explicit StreamingAudioSource(std::unique_ptr<SDLAudioSource> decoder)
+            : _decoder(std::move(decoder))
+            , _format(_decoder->GetFormat())
+            , _length(_decoder->GetLength())
+            , _ring(kRingSize)
+        {
+            _thread = std::thread([this]() { DecodeLoop(); });
+        }
+
+        ~StreamingAudioSource() override
+        {
+            Release();
+        }
+
+        [[nodiscard]] AudioFormat GetFormat() const override
+        {
+            return _format;
+        }
+
+        [[nodiscard]] uint64_t GetLength() const override
+        {
+            return _length;
+        }
+
+        size_t Read(void* dst, uint64_t offset, size_t len) override
+        {
+            if (offset >= _length)
+                return 0;
+
+            auto* dst8 = static_cast<uint8_t*>(dst);
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (offset >= _ringStart && offset < _ringStart + _ringFill)
+                {
+                    // Drop whatever was skipped over, then copy out of the ring
+                    Consume(static_cast<size_t>(offset - _ringStart));
+                    auto bytesRead = std::min(len, _ringFill);
+                    auto firstPart = std::min(bytesRead, kRingSize - _ringHead);
+                    std::copy_n(_ring.data() + _ringHead, firstPart, dst8);
+                    std::copy_n(_ring.data(), bytesRead - firstPart, dst8 + firstPart);
+                    Consume(bytesRead);
+                    _decodeNeeded.notify_one();
+                    return bytesRead;
+                }
+
+                // A seek, a loop back to the start or the decoder fell behind; restart the ring at the new position
+                Restart(offset);
+            }
+
+            // Decode what is needed right now on this thread, the background thread carries on after it
+            size_t bytesRead;
+            {
+                std::lock_guard<std::mutex> decoderLock(_decoderMutex);
+                bytesRead = _decoder->Read(dst8, offset, len);
+            }
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_ringStart == offset && _ringFill == 0)
+                {
+                    Restart(offset + bytesRead);
+                }
+                _decodeNeeded.notify_one();
+            }
+            return bytesRead;
+        }
+
+    protected:
+        void Unload() override
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stopping = true;
+            }
+            _decodeNeeded.notify_one();
+            if (_thread.joinable())
+            {
+                _thread.join();
+            }
+            if (_decoder != nullptr)
+            {
+                _decoder->Release();
+            }
+            _ring.clear();
+            _ring.shrink_to_fit();
+        }
+
+    private:
+        void Consume(size_t len)
+        {
+            _ringHead = (_ringHead + len) % kRingSize;
+            _ringFill -= len;
+            _ringStart += len;
+        }
+
+        void Restart(uint64_t offset)
+        {
+            _ringHead = 0;
+            _ringFill = 0;
+            _ringStart = offset;
+            _endOfStream = false;
+            _generation++;
+        }
+
+        void DecodeLoop()
+        {
+            std::vector<uint8_t> chunk(kDecodeChunkSize);
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (true)
+            {
+                _decodeNeeded.wait(lock, [this]() {
+                    return _stopping || (!_endOfStream && _ringFill < kRingSize && _ringStart + _ringFill < _length);
+                });
+                if (_stopping)
+                    break;
+
+                auto generation = _generation;
+                auto decodeOffset = _ringStart + _ringFill;
+                auto decodeLen = static_cast<size_t>(
+                    std::min<uint64_t>({ kDecodeChunkSize, kRingSize - _ringFill, _length - decodeOffset }));
+                lock.unlock();
+
+                size_t bytesDecoded;
+                {
+                    std::lock_guard<std::mutex> decoderLock(_decoderMutex);
+                    bytesDecoded = _decoder->Read(chunk.data(), decodeOffset, decodeLen);
+                }
+
+                lock.lock();
+                if (generation != _generation)
+                {
+                    // Playback moved somewhere else while decoding, the chunk is no longer wanted
+                    continue;
+                }
+                if (bytesDecoded == 0)
+                {
+                    _endOfStream = true;
+                    continue;
+                }
+
+                // Consuming moves _ringStart and _ringFill together, so the write position is unchanged
+                auto tail = (_ringHead + _ringFill) % kRingSize;
+                auto firstPart = std::min(bytesDecoded, kRingSize - tail);
+                std::copy_n(chunk.data(), firstPart, _ring.data() + tail);
+                std::copy_n(chunk.data() + firstPart, bytesDecoded - firstPart, _ring.data());
+                _ringFill += bytesDecoded;
+            }
+        }
+    };
+
+    std::unique_ptr<SDLAudioSource> CreateStreamingAudioSource(std::unique_ptr<SDLAudioSource> decoder)
+    {
+        return std::make_unique<StreamingAudioSource>(std::move(decoder));
+    }
+} // namespace OpenRCT2::Audio
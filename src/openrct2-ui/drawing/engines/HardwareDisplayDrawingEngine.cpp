@@ -10,11 +10,14 @@
 #include "DrawingEngineFactory.hpp"
 
 #include <SDL.h>
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <memory>
 #include <openrct2/Game.h>
 #include <openrct2/common.h>
 #include <openrct2/config/Config.h>
+#include <openrct2/drawing/Drawing.h>
 #include <openrct2/drawing/IDrawingEngine.h>
 #include <openrct2/drawing/LightFX.h>
 #include <openrct2/drawing/X8DrawingEngine.h>
@@ -49,6 +52,11 @@ private:
 
     std::vector<uint32_t> _dirtyVisualsTime;
 
+    // The frame as it was last uploaded to the screen texture, only the parts of the frame that differ from it are
+    // converted and uploaded again
+    std::vector<uint8_t> _uploadedBits;
+    bool _uploadAll = true;
+
     bool smoothNN = false;
 
 public:
@@ -158,6 +166,7 @@ public:
         _screenTextureFormat = SDL_AllocFormat(format);
 
         ConfigureBits(width, height, width);
+        _uploadAll = true;
     }
 
     void SetPalette(const GamePalette& palette) override
@@ -178,6 +187,7 @@ public:
                     _lightPaletteHWMapped[i] = SDL_MapRGBA(_screenTextureFormat, src.Red, src.Green, src.Blue, src.Alpha);
                 }
             }
+            _uploadAll = true;
         }
     }
 
@@ -219,6 +229,12 @@ private:
                 LightFXRenderToTexture(pixels, pitch, _bits, _width, _height, _paletteHWMapped, _lightPaletteHWMapped);
                 SDL_UnlockTexture(_screenTexture);
             }
+            // The light map changes the texture without the frame changing
+            _uploadAll = true;
+        }
+        else if (SDL_BYTESPERPIXEL(_screenTextureFormat->format) == 4)
+        {
+            UploadChangedBits();
         }
         else
         {
@@ -257,6 +273,90 @@ private:
         }
     }
 
+    void UploadChangedBits()
+    {
+        if (_uploadAll || _uploadedBits.size() != _bitsSize)
+        {
+            _uploadedBits.assign(_bits, _bits + _bitsSize);
+            UploadRect(0, 0, _width, _height);
+            _uploadAll = false;
+            return;
+        }
+
+        // The frame is compared in bands the height of a dirty block, a band covers the blocks from its first to its
+        // last changed one. Consecutive changed bands are uploaded together to keep the number of texture locks low.
+        const uint32_t blockWidth = _dirtyGrid.BlockWidth;
+        const uint32_t blockHeight = _dirtyGrid.BlockHeight;
+        uint32_t regionTop = 0;
+        uint32_t regionLeft = _width;
+        uint32_t regionRight = 0;
+        for (uint32_t top = 0; top < _height; top += blockHeight)
+        {
+            const uint32_t bottom = std::min(_height, top + blockHeight);
+            uint32_t left = _width;
+            uint32_t right = 0;
+            for (uint32_t x = 0; x < _width; x += blockWidth)
+            {
+                const uint32_t width = std::min(blockWidth, _width - x);
+                for (uint32_t y = top; y < bottom; y++)
+                {
+                    const size_t offset = static_cast<size_t>(y) * _pitch + x;
+                    if (std::memcmp(_bits + offset, _uploadedBits.data() + offset, width) != 0)
+                    {
+                        left = std::min(left, x);
+                        right = x + width;
+                        break;
+                    }
+                }
+            }
+
+            if (left < right)
+            {
+                for (uint32_t y = top; y < bottom; y++)
+                {
+                    const size_t offset = static_cast<size_t>(y) * _pitch + left;
+                    std::copy_n(_bits + offset, right - left, _uploadedBits.data() + offset);
+                }
+                if (regionLeft >= regionRight)
+                {
+                    regionTop = top;
+                }
+                regionLeft = std::min(regionLeft, left);
+                regionRight = std::max(regionRight, right);
+            }
+            else if (regionLeft < regionRight)
+            {
+                UploadRect(regionLeft, regionTop, regionRight - regionLeft, top - regionTop);
+                regionLeft = _width;
+                regionRight = 0;
+            }
+        }
+        if (regionLeft < regionRight)
+        {
+            UploadRect(regionLeft, regionTop, regionRight - regionLeft, _height - regionTop);
+        }
+    }
+
+    void UploadRect(uint32_t left, uint32_t top, uint32_t width, uint32_t height)
+    {
+        SDL_Rect rect = { static_cast<int32_t>(left), static_cast<int32_t>(top), static_cast<int32_t>(width),
+                          static_cast<int32_t>(height) };
+        void* pixels;
+        int32_t pitch;
+        if (SDL_LockTexture(_screenTexture, &rect, &pixels, &pitch) == 0)
+        {
+            const uint8_t* src = _bits + static_cast<size_t>(top) * _pitch + left;
+            uint8_t* dst = static_cast<uint8_t*>(pixels);
+            for (uint32_t y = 0; y < height; y++)
+            {
+                PaletteExpandFn(src, reinterpret_cast<uint32_t*>(dst), _paletteHWMapped, static_cast<int32_t>(width));
+                src += _pitch;
+                dst += pitch;
+            }
+            SDL_UnlockTexture(_screenTexture);
+        }
+    }
+
     void CopyBitsToTexture(SDL_Texture* texture, uint8_t* src, int32_t width, int32_t height, const uint32_t* palette)
     {
         void* pixels;
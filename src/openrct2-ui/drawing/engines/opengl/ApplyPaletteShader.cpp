@@ -50,14 +50,22 @@ ApplyPaletteShader::ApplyPaletteShader()
     glEnableVertexAttribArray(vPosition);
     glEnableVertexAttribArray(vTextureCoordinate);
 
+    glGenTextures(1, &_paletteTexture);
+    OpenGLAPI::SetTexture(1, GL_TEXTURE_2D, _paletteTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 256, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
     Use();
     glUniform1i(uTexture, 0);
+    glUniform1i(uPalette, 1);
 }
 
 ApplyPaletteShader::~ApplyPaletteShader()
 {
     glDeleteBuffers(1, &_vbo);
     glDeleteVertexArrays(1, &_vao);
+    glDeleteTextures(1, &_paletteTexture);
 }
 
 void ApplyPaletteShader::GetLocations()
@@ -74,13 +82,15 @@ void ApplyPaletteShader::SetTexture(GLuint texture)
     OpenGLAPI::SetTexture(0, GL_TEXTURE_2D, texture);
 }
 
-void ApplyPaletteShader::SetPalette(const vec4* glPalette)
+void ApplyPaletteShader::SetPalette(const uint8_t* colours, int32_t startIndex, int32_t numColours)
 {
-    glUniform4fv(uPalette, 256, reinterpret_cast<const GLfloat*>(glPalette));
+    OpenGLAPI::SetTexture(1, GL_TEXTURE_2D, _paletteTexture);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, startIndex, 0, numColours, 1, GL_RGBA, GL_UNSIGNED_BYTE, colours + startIndex * 4);
 }
 
 void ApplyPaletteShader::Draw()
 {
+    OpenGLAPI::SetTexture(1, GL_TEXTURE_2D, _paletteTexture);
     glBindVertexArray(_vao);
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
 }
@@ -25,13 +25,15 @@ namespace OpenRCT2::Ui
 
         GLuint _vbo;
         GLuint _vao;
+        GLuint _paletteTexture;
 
     public:
         ApplyPaletteShader();
         ~ApplyPaletteShader() override;
 
         static void SetTexture(GLuint texture);
-        void SetPalette(const vec4* glPalette);
+        // Uploads the given RGBA colours to the palette entries starting at startIndex
+        void SetPalette(const uint8_t* colours, int32_t startIndex, int32_t numColours);
 
         void Draw();
 
@@ -33,19 +33,48 @@ constexpr size_t InitialInstancesBufferSize = 32768;
 
 DrawRectShader::DrawRectShader()
     : OpenGLShaderProgram("drawrect")
-    , _maxInstancesBufferSize(InitialInstancesBufferSize)
 {
     GetLocations();
 
     glGenBuffers(1, &_vbo);
-    glGenBuffers(1, &_vboInstances);
-    glGenVertexArrays(1, &_vao);
-
     glBindBuffer(GL_ARRAY_BUFFER, _vbo);
     glBufferData(GL_ARRAY_BUFFER, sizeof(VertexData), VertexData, GL_STATIC_DRAW);
 
-    glBindVertexArray(_vao);
+    for (auto& buffer : _instanceBuffers)
+    {
+        glGenBuffers(1, &buffer.Vbo);
+        glGenVertexArrays(1, &buffer.Vao);
+
+        glBindBuffer(GL_ARRAY_BUFFER, buffer.Vbo);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(DrawRectCommand) * InitialInstancesBufferSize, NULL, GL_STREAM_DRAW);
+        buffer.Capacity = InitialInstancesBufferSize;
+
+        SetupVertexArray(buffer);
+    }
+
+    Use();
+    glUniform1i(uTexture, 0);
+    glUniform1i(uPaletteTex, 1);
+
+    glUniform1i(uPeelingTex, 2);
+    glUniform1i(uPeeling, 0);
+}
+
+DrawRectShader::~DrawRectShader()
+{
+    glDeleteBuffers(1, &_vbo);
+    for (auto& buffer : _instanceBuffers)
+    {
+        glDeleteBuffers(1, &buffer.Vbo);
+        glDeleteVertexArrays(1, &buffer.Vao);
+    }
+}
+
+void DrawRectShader::SetupVertexArray(const InstanceBuffer& buffer)
+{
+    glBindVertexArray(buffer.Vao);
 
+    glBindBuffer(GL_ARRAY_BUFFER, _vbo);
     glVertexAttribPointer(
         vVertMat + 0, 2, GL_FLOAT, GL_FALSE, sizeof(VDStruct), reinterpret_cast<void*>(offsetof(VDStruct, mat[0])));
     glVertexAttribPointer(
@@ -56,9 +85,7 @@ DrawRectShader::DrawRectShader()
         vVertMat + 3, 2, GL_FLOAT, GL_FALSE, sizeof(VDStruct), reinterpret_cast<void*>(offsetof(VDStruct, mat[3])));
     glVertexAttribPointer(vVertVec, 2, GL_FLOAT, GL_FALSE, sizeof(VDStruct), reinterpret_cast<void*>(offsetof(VDStruct, vec)));
 
-    glBindBuffer(GL_ARRAY_BUFFER, _vboInstances);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(DrawRectCommand) * InitialInstancesBufferSize, NULL, GL_STREAM_DRAW);
-
+    glBindBuffer(GL_ARRAY_BUFFER, buffer.Vbo);
     glVertexAttribIPointer(vClip, 4, GL_INT, sizeof(DrawRectCommand), reinterpret_cast<void*>(offsetof(DrawRectCommand, clip)));
     glVertexAttribIPointer(
         vTexColourAtlas, 1, GL_INT, sizeof(DrawRectCommand),
@@ -109,20 +136,6 @@ DrawRectShader::DrawRectShader()
     glVertexAttribDivisor(vColour, 1);
     glVertexAttribDivisor(vBounds, 1);
     glVertexAttribDivisor(vDepth, 1);
-
-    Use();
-    glUniform1i(uTexture, 0);
-    glUniform1i(uPaletteTex, 1);
-
-    glUniform1i(uPeelingTex, 2);
-    glUniform1i(uPeeling, 0);
-}
-
-DrawRectShader::~DrawRectShader()
-{
-    glDeleteBuffers(1, &_vbo);
-    glDeleteBuffers(1, &_vboInstances);
-    glDeleteVertexArrays(1, &_vao);
 }
 
 void DrawRectShader::GetLocations()
@@ -167,14 +180,16 @@ void DrawRectShader::DisablePeeling()
 
 void DrawRectShader::SetInstances(const RectCommandBatch& instances)
 {
-    glBindVertexArray(_vao);
+    _currentInstanceBuffer = (_currentInstanceBuffer + 1) % kInstanceBufferCount;
+    auto& buffer = _instanceBuffers[_currentInstanceBuffer];
 
-    glBindBuffer(GL_ARRAY_BUFFER, _vboInstances);
+    glBindVertexArray(buffer.Vao);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer.Vbo);
 
-    if (instances.size() > _maxInstancesBufferSize)
+    if (instances.size() > buffer.Capacity)
     {
         glBufferData(GL_ARRAY_BUFFER, sizeof(DrawRectCommand) * instances.size(), instances.data(), GL_STREAM_DRAW);
-        _maxInstancesBufferSize = instances.size();
+        buffer.Capacity = instances.size();
     }
     else
     {
@@ -186,7 +201,7 @@ void DrawRectShader::SetInstances(const RectCommandBatch& instances)
 
 void DrawRectShader::DrawInstances()
 {
-    glBindVertexArray(_vao);
+    glBindVertexArray(_instanceBuffers[_currentInstanceBuffer].Vao);
     glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, _instanceCount);
 }
 
@@ -14,6 +14,7 @@
 #include "OpenGLShaderProgram.h"
 
 #include <SDL_pixels.h>
+#include <array>
 namespace OpenRCT2::Ui
 {
     class DrawRectShader final : public OpenGLShaderProgram
@@ -40,12 +41,22 @@ namespace OpenRCT2::Ui
         GLuint vBounds;
         GLuint vDepth;
 
+        // The instances are uploaded to a different buffer each time, so the upload does not have to wait for the
+        // draws of the previous frames that still use the other buffers.
+        static constexpr size_t kInstanceBufferCount = 4;
+
+        struct InstanceBuffer
+        {
+            GLuint Vbo;
+            GLuint Vao;
+            size_t Capacity;
+        };
+
         GLuint _vbo;
-        GLuint _vboInstances;
-        GLuint _vao;
+        std::array<InstanceBuffer, kInstanceBufferCount> _instanceBuffers{};
+        size_t _currentInstanceBuffer = 0;
 
         GLsizei _instanceCount = 0;
-        size_t _maxInstancesBufferSize;
 
     public:
         DrawRectShader();
@@ -60,5 +71,6 @@ namespace OpenRCT2::Ui
 
     private:
         void GetLocations();
+        void SetupVertexArray(const InstanceBuffer& buffer);
     };
 } // namespace OpenRCT2::Ui
@@ -33,6 +33,7 @@
 #    define glReadPixels __static__glReadPixels
 #    define glTexImage2D __static__glTexImage2D
 #    define glTexParameteri __static__glTexParameteri
+#    define glTexSubImage2D __static__glTexSubImage2D
 #    define glViewport __static__glViewport
 #    define glTexSubImage3D __static__glTexSubImage3D
 #    define glTexImage3D __static__glTexImage3D
@@ -69,6 +70,7 @@
 #    undef glReadPixels
 #    undef glTexImage2D
 #    undef glTexParameteri
+#    undef glTexSubImage2D
 #    undef glViewport
 #    undef glTexSubImage3D
 #    undef glTexImage3D
@@ -97,6 +99,9 @@ using PFNGLTEXIMAGE2DPROC = void(APIENTRYP)(
     GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type,
     const GLvoid* pixels);
 using PFNGLTEXPARAMETERIPROC = void(APIENTRYP)(GLenum target, GLenum pname, GLint param);
+using PFNGLTEXSUBIMAGE2DPROC = void(APIENTRYP)(
+    GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type,
+    const GLvoid* pixels);
 using PFNGLVIEWPORTPROC = void(APIENTRYP)(GLint x, GLint y, GLsizei width, GLsizei height);
 using PFNGLTEXSUBIMAGE3DPROC = void(APIENTRYP)(
     GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth,
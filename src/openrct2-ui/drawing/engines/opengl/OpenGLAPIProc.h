@@ -31,6 +31,7 @@ OPENGL_PROC(PFNGLPIXELSTOREIPROC, glPixelStorei)
 OPENGL_PROC(PFNGLREADPIXELSPROC, glReadPixels)
 OPENGL_PROC(PFNGLTEXIMAGE2DPROC, glTexImage2D)
 OPENGL_PROC(PFNGLTEXPARAMETERIPROC, glTexParameteri)
+OPENGL_PROC(PFNGLTEXSUBIMAGE2DPROC, glTexSubImage2D)
 OPENGL_PROC(PFNGLVIEWPORTPROC, glViewport)
 OPENGL_PROC(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D)
 OPENGL_PROC(PFNGLTEXIMAGE3DPROC, glTexImage3D)
@@ -112,6 +112,10 @@ public:
     void DrawGlyph(DrawPixelInfo& dpi, const ImageId image, int32_t x, int32_t y, const PaletteMap& palette) override;
     void DrawTTFBitmap(
         DrawPixelInfo& dpi, TextDrawInfo* info, TTFSurface* surface, int32_t x, int32_t y, uint8_t hintingThreshold) override;
+    // Covers the rectangle with copies of a square texture, lined up so that a copy starts at the origin
+    void DrawTiledTexture(
+        DrawPixelInfo& dpi, const BasicTextureInfo& texture, int32_t tileSize, const ScreenRect& rect,
+        const ScreenCoordsXY& origin);
 
     void FlushCommandBuffers();
 
@@ -123,7 +127,20 @@ public:
 
 class OpenGLWeatherDrawer final : public IWeatherDrawer
 {
+    // Weather patterns repeat every 32 pixels, they are baked into larger tiles so a screen takes few rectangles
+    static constexpr int32_t kTileSize = 256;
+    // Image ids for the baked tiles, just below the ones used for TTF text
+    static constexpr ImageIndex kTileImageBase = uint32_t(0x7FFFF) - 1024 - 8;
+
+    struct PatternTile
+    {
+        const uint8_t* Pattern;
+        ImageIndex Image;
+        std::vector<uint8_t> Pixels;
+    };
+
     OpenGLDrawingContext* _drawingContext;
+    std::vector<PatternTile> _tiles;
 
 public:
     explicit OpenGLWeatherDrawer(OpenGLDrawingContext* drawingContext)
@@ -135,40 +152,56 @@ public:
         DrawPixelInfo& dpi, int32_t x, int32_t y, int32_t width, int32_t height, int32_t xStart, int32_t yStart,
         const uint8_t* weatherpattern) override
     {
-        const uint8_t* pattern = weatherpattern;
-        auto patternXSpace = *pattern++;
-        auto patternYSpace = *pattern++;
-
-        uint8_t patternStartXOffset = xStart % patternXSpace;
-        uint8_t patternStartYOffset = yStart % patternYSpace;
+        auto patternXSpace = weatherpattern[0];
+        auto patternYSpace = weatherpattern[1];
+        if (kTileSize % patternXSpace != 0 || kTileSize % patternYSpace != 0)
+        {
+            return;
+        }
 
-        uint32_t pixelOffset = (dpi.pitch + dpi.width) * y + x;
-        uint8_t patternYPos = patternStartYOffset % patternYSpace;
+        // A pattern row that starts xStart pixels to the left of the area and yStart pixels above it
+        auto patternX = static_cast<int32_t>(static_cast<uint8_t>(xStart % patternXSpace) % patternXSpace);
+        auto patternY = static_cast<int32_t>(static_cast<uint8_t>(yStart % patternYSpace) % patternYSpace);
+        const auto& tile = GetPatternTile(weatherpattern);
+        auto texture = _drawingContext->GetTextureCache()->GetOrLoadBitmapTexture(
+            tile.Image, tile.Pixels.data(), kTileSize, kTileSize);
+        _drawingContext->DrawTiledTexture(
+            dpi, texture, kTileSize, { { x, y }, { x + width, y + height } }, { x - patternX, y - patternY });
+    }
 
-        for (; height != 0; height--)
+private:
+    const PatternTile& GetPatternTile(const uint8_t* weatherpattern)
+    {
+        for (const auto& tile : _tiles)
         {
-            auto patternX = pattern[patternYPos * 2];
-            if (patternX != 0xFF)
+            if (tile.Pattern == weatherpattern)
             {
-                uint32_t finalPixelOffset = width + pixelOffset;
+                return tile;
+            }
+        }
 
-                uint32_t xPixelOffset = pixelOffset;
-                xPixelOffset += (static_cast<uint8_t>(patternX - patternStartXOffset)) % patternXSpace;
+        PatternTile tile;
+        tile.Pattern = weatherpattern;
+        tile.Image = kTileImageBase + static_cast<ImageIndex>(_tiles.size());
+        tile.Pixels.resize(kTileSize * kTileSize);
 
-                auto patternPixel = pattern[patternYPos * 2 + 1];
-                for (; xPixelOffset < finalPixelOffset; xPixelOffset += patternXSpace)
-                {
-                    int32_t pixelX = xPixelOffset % dpi.width;
-                    int32_t pixelY = (xPixelOffset / dpi.width) % dpi.height;
-
-                    _drawingContext->DrawLine(dpi, patternPixel, { { pixelX, pixelY }, { pixelX + 1, pixelY + 1 } });
-                }
+        const uint8_t* pattern = weatherpattern + 2;
+        auto patternXSpace = weatherpattern[0];
+        auto patternYSpace = weatherpattern[1];
+        for (int32_t y = 0; y < kTileSize; y++)
+        {
+            auto patternX = pattern[(y % patternYSpace) * 2];
+            if (patternX == 0xFF)
+            {
+                continue;
+            }
+            auto patternPixel = pattern[(y % patternYSpace) * 2 + 1];
+            for (int32_t x = patternX % patternXSpace; x < kTileSize; x += patternXSpace)
+            {
+                tile.Pixels[y * kTileSize + x] = patternPixel;
             }
-
-            pixelOffset += dpi.pitch + dpi.width;
-            patternYPos++;
-            patternYPos %= patternYSpace;
         }
+        return _tiles.emplace_back(std::move(tile));
     }
 };
 
@@ -196,8 +229,7 @@ private:
     OpenGLWeatherDrawer _weatherDrawer;
 
 public:
-    SDL_Color Palette[256];
-    vec4 GLPalette[256];
+    SDL_Color Palette[256]{};
 
     explicit OpenGLDrawingEngine(const std::shared_ptr<IUiContext>& uiContext)
         : _uiContext(uiContext)
@@ -238,6 +270,7 @@ public:
         _drawingContext->Initialise();
 
         _applyPaletteShader = std::make_unique<ApplyPaletteShader>();
+        _applyPaletteShader->SetPalette(reinterpret_cast<const uint8_t*>(Palette), 0, 256);
     }
 
     void Resize(uint32_t width, uint32_t height) override
@@ -249,6 +282,9 @@ public:
 
     void SetPalette(const GamePalette& palette) override
     {
+        // The palette is applied when the frame is presented, so animating it only has to upload the changed entries
+        int32_t first = 256;
+        int32_t last = -1;
         for (int32_t i = 0; i < 256; i++)
         {
             SDL_Color colour;
@@ -257,17 +293,19 @@ public:
             colour.b = palette[i].Blue;
             colour.a = i == 0 ? 0 : 255;
 
-            Palette[i] = colour;
-            GLPalette[i] = {
-                colour.r / 255.0f,
-                colour.g / 255.0f,
-                colour.b / 255.0f,
-                colour.a / 255.0f,
-            };
+            auto& current = Palette[i];
+            if (current.r != colour.r || current.g != colour.g || current.b != colour.b || current.a != colour.a)
+            {
+                current = colour;
+                first = std::min(first, i);
+                last = i;
+            }
         }
 
-        _applyPaletteShader->Use();
-        _applyPaletteShader->SetPalette(GLPalette);
+        if (last >= first)
+        {
+            _applyPaletteShader->SetPalette(reinterpret_cast<const uint8_t*>(Palette), first, last - first + 1);
+        }
         _drawingContext->ResetPalette();
     }
 
@@ -286,6 +324,7 @@ public:
 
         _drawingContext->StartNewDraw();
         _drawingContext->CalculcateClipping(_bitsDPI);
+        _drawingContext->GetTextureCache()->Update();
     }
 
     void EndDraw() override
@@ -370,6 +409,11 @@ public:
         _drawingContext->GetTextureCache()->InvalidateImage(image);
     }
 
+    size_t GetMemoryUsage() override
+    {
+        return _bitsSize + _drawingContext->GetTextureCache()->GetMemoryUsage();
+    }
+
     DrawPixelInfo* GetDPI()
     {
         return &_bitsDPI;
@@ -999,6 +1043,43 @@ void OpenGLDrawingContext::DrawTTFBitmap(
 #    endif // NO_TTF
 }
 
+void OpenGLDrawingContext::DrawTiledTexture(
+    DrawPixelInfo& dpi, const BasicTextureInfo& texture, int32_t tileSize, const ScreenRect& rect,
+    const ScreenCoordsXY& origin)
+{
+    CalculcateClipping(dpi);
+
+    const ivec4 clip = {
+        std::max(_clipLeft, rect.GetLeft() + _offsetX),
+        std::max(_clipTop, rect.GetTop() + _offsetY),
+        std::min(_clipRight, rect.GetRight() + _offsetX),
+        std::min(_clipBottom, rect.GetBottom() + _offsetY),
+    };
+    if (clip.x >= clip.z || clip.y >= clip.w)
+    {
+        return;
+    }
+
+    for (int32_t top = origin.y; top < rect.GetBottom(); top += tileSize)
+    {
+        for (int32_t left = origin.x; left < rect.GetRight(); left += tileSize)
+        {
+            DrawRectCommand& command = _commandBuffers.rects.allocate();
+
+            command.clip = clip;
+            command.texColourAtlas = texture.index;
+            command.texColourBounds = texture.normalizedBounds;
+            command.texMaskAtlas = 0;
+            command.texMaskBounds = { 0.0f, 0.0f, 0.0f, 0.0f };
+            command.palettes = { 0, 0, 0 };
+            command.colour = 0;
+            command.bounds = { left + _offsetX, top + _offsetY, left + tileSize + _offsetX, top + tileSize + _offsetY };
+            command.flags = 0;
+            command.depth = _drawCount++;
+        }
+    }
+}
+
 void OpenGLDrawingContext::FlushCommandBuffers()
 {
     glEnable(GL_DEPTH_TEST);
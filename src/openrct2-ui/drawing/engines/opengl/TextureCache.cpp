@@ -12,6 +12,13 @@
 #    include "TextureCache.h"
 
 #    include <algorithm>
+#    include <cstring>
+#    include <openrct2/Context.h>
+#    include <openrct2/PlatformEnvironment.h>
+#    include <openrct2/config/Config.h>
+#    include <openrct2/core/Crypt.h>
+#    include <openrct2/core/File.h>
+#    include <openrct2/core/Path.hpp>
 #    include <openrct2/drawing/Drawing.h>
 #    include <openrct2/interface/Colour.h>
 #    include <openrct2/util/Util.h>
@@ -19,10 +26,16 @@
 #    include <stdexcept>
 #    include <vector>
 
+using namespace OpenRCT2;
 using namespace OpenRCT2::Ui;
 
 constexpr uint32_t UNUSED_INDEX = 0xFFFFFFFF;
 
+// Upper limit of prewarmed images uploaded per frame, to keep the uploads from becoming a hitch of their own.
+constexpr size_t kPrewarmUploadsPerFrame = 256;
+
+constexpr uint32_t kWarmListMagic = 0x4C575331; // 1SWL
+
 TextureCache::TextureCache()
 {
     std::fill(_indexMap.begin(), _indexMap.end(), UNUSED_INDEX);
@@ -30,11 +43,30 @@ TextureCache::TextureCache()
 
 TextureCache::~TextureCache()
 {
+    const auto glyphStats = GetGlyphCacheStats();
+    LOG_VERBOSE(
+        "glyph cache: %llu table hits, %llu map hits, %llu misses", static_cast<unsigned long long>(glyphStats.TableHits),
+        static_cast<unsigned long long>(glyphStats.MapHits), static_cast<unsigned long long>(glyphStats.Misses));
+
+    CancelPrewarm();
+    SaveWarmList();
     FreeTextures();
 }
 
 void TextureCache::InvalidateImage(ImageIndex image)
 {
+    if (image >= SPR_IMAGE_LIST_BEGIN)
+    {
+        // The loaded objects are changing, record which of their images were used before they are gone.
+        if (!_objectImagesChanged)
+        {
+            CancelPrewarm();
+            SaveWarmList();
+            _warmListKey = 0;
+            _objectImagesChanged = true;
+        }
+    }
+
     unique_lock lock(_mutex);
 
     uint32_t index = _indexMap[image];
@@ -99,25 +131,56 @@ BasicTextureInfo TextureCache::GetOrLoadImageTexture(const ImageId imageId)
     return info;
 }
 
+TextureCache::GlyphTableSlot* TextureCache::GetGlyphTableSlot(
+    std::array<GlyphTableSlot, kGlyphTableSize>& table, ImageIndex image)
+{
+    if (image >= SPR_CHAR_START && image < SPR_CHAR_END)
+    {
+        return &table[image - SPR_CHAR_START];
+    }
+    if (image >= SPR_G2_CHAR_BEGIN && image < SPR_G2_CHAR_END)
+    {
+        return &table[(SPR_CHAR_END - SPR_CHAR_START) + (image - SPR_G2_CHAR_BEGIN)];
+    }
+    return nullptr;
+}
+
 BasicTextureInfo TextureCache::GetOrLoadGlyphTexture(const ImageId imageId, const PaletteMap& paletteMap)
 {
     GlyphId glyphId{};
     glyphId.Image = imageId.GetIndex();
 
-    // Try to read cached texture first.
+    uint8_t glyphMap[8];
+    for (uint8_t i = 0; i < 8; i++)
     {
-        shared_lock lock(_mutex);
+        glyphMap[i] = paletteMap[i];
+    }
+    std::copy_n(glyphMap, sizeof(glyphId.Palette), reinterpret_cast<uint8_t*>(&glyphId.Palette));
 
-        uint8_t glyphMap[8];
-        for (uint8_t i = 0; i < 8; i++)
+    // Try the glyph table first, it does not need the lock.
+    auto* slot = GetGlyphTableSlot(_glyphTable, glyphId.Image);
+    if (slot != nullptr)
+    {
+        const auto count = slot->Count.load(std::memory_order_acquire);
+        for (uint8_t i = 0; i < count; i++)
         {
-            glyphMap[i] = paletteMap[i];
+            if (slot->Palettes[i] == glyphId.Palette)
+            {
+                _glyphTableHits.fetch_add(1, std::memory_order_relaxed);
+                return slot->Textures[i];
+            }
         }
-        std::copy_n(glyphMap, sizeof(glyphId.Palette), reinterpret_cast<uint8_t*>(&glyphId.Palette));
+    }
+
+    // Then the map, only glyphs that are not in the table or whose slot is full are stored in there.
+    if (slot == nullptr || slot->Count.load(std::memory_order_acquire) == GlyphTableSlot::kCapacity)
+    {
+        shared_lock lock(_mutex);
 
         auto kvp = _glyphTextureMap.find(glyphId);
         if (kvp != _glyphTextureMap.end())
         {
+            _glyphMapHits.fetch_add(1, std::memory_order_relaxed);
             const auto& info = kvp->second;
             return {
                 info.index,
@@ -129,10 +192,66 @@ BasicTextureInfo TextureCache::GetOrLoadGlyphTexture(const ImageId imageId, cons
     // Load new texture.
     unique_lock lock(_mutex);
 
+    const auto count = slot != nullptr ? slot->Count.load(std::memory_order_relaxed) : GlyphTableSlot::kCapacity;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        // Loaded by another thread while waiting for the lock
+        if (slot->Palettes[i] == glyphId.Palette)
+        {
+            return slot->Textures[i];
+        }
+    }
+
+    _glyphMisses.fetch_add(1, std::memory_order_relaxed);
     auto cacheInfo = LoadGlyphTexture(imageId, paletteMap);
-    auto it = _glyphTextureMap.insert(std::make_pair(glyphId, cacheInfo));
 
-    return (*it.first).second;
+    if (count < GlyphTableSlot::kCapacity)
+    {
+        slot->Palettes[count] = glyphId.Palette;
+        slot->Textures[count] = { cacheInfo.index, cacheInfo.normalizedBounds };
+        slot->Count.store(count + 1, std::memory_order_release);
+    }
+    else
+    {
+        _glyphTextureMap.insert(std::make_pair(glyphId, cacheInfo));
+    }
+
+    return cacheInfo;
+}
+
+GlyphCacheStats TextureCache::GetGlyphCacheStats() const
+{
+    return {
+        _glyphTableHits.load(std::memory_order_relaxed),
+        _glyphMapHits.load(std::memory_order_relaxed),
+        _glyphMisses.load(std::memory_order_relaxed),
+    };
+}
+
+size_t TextureCache::GetMemoryUsage()
+{
+    size_t total = sizeof(TextureCache);
+    {
+        shared_lock lock(_mutex);
+        for (const auto& atlas : _atlases)
+        {
+            total += atlas.GetMemoryUsage();
+        }
+        total += _textureCache.capacity() * sizeof(AtlasTextureInfo);
+        // Nodes of the glyph map, each holds the key, the value and the next pointer
+        total += _glyphTextureMap.size() * (sizeof(GlyphId) + sizeof(AtlasTextureInfo) + sizeof(void*));
+        total += _glyphTextureMap.bucket_count() * sizeof(void*);
+        total += static_cast<size_t>(_atlasesTextureDimensions) * _atlasesTextureDimensions * _atlasesTextureCapacity;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_prewarmMutex);
+        total += _prewarmedImages.capacity() * sizeof(PrewarmedImage);
+        for (const auto& prewarmed : _prewarmedImages)
+        {
+            total += prewarmed.Pixels.capacity();
+        }
+    }
+    return total;
 }
 
 BasicTextureInfo TextureCache::GetOrLoadBitmapTexture(ImageIndex image, const void* pixels, size_t width, size_t height)
@@ -167,6 +286,246 @@ BasicTextureInfo TextureCache::GetOrLoadBitmapTexture(ImageIndex image, const vo
     return info;
 }
 
+void TextureCache::Update()
+{
+    if (_objectImagesChanged)
+    {
+        _objectImagesChanged = false;
+        if (gConfigGeneral.SpriteAtlasCache)
+        {
+            _warmListKey = GetObjectImagesKey();
+            StartPrewarm(LoadWarmList(_warmListKey));
+        }
+    }
+
+    UploadPrewarmedImages();
+}
+
+void TextureCache::StartPrewarm(std::vector<ImageIndex> images)
+{
+    CancelPrewarm();
+
+    {
+        shared_lock lock(_mutex);
+        images.erase(
+            std::remove_if(
+                images.begin(), images.end(),
+                [this](ImageIndex image) {
+                    if (image < SPR_IMAGE_LIST_BEGIN || image >= SPR_IMAGE_LIST_END || _indexMap[image] != UNUSED_INDEX)
+                        return true;
+                    const auto* g1Element = GfxGetG1Element(image);
+                    return g1Element == nullptr || g1Element->offset == nullptr || g1Element->width <= 0
+                        || g1Element->height <= 0;
+                }),
+            images.end());
+    }
+
+    if (images.empty())
+        return;
+
+    LOG_VERBOSE("prewarming %zu sprites", images.size());
+
+    // Decoding the sprites is done in the background, only the uploads have to happen on the render thread.
+    // Object images are not modified while the thread runs, InvalidateImage stops it first.
+    _prewarmCancelled = false;
+    _prewarmThread = std::thread([this, images = std::move(images)]() {
+        for (auto image : images)
+        {
+            if (_prewarmCancelled)
+                return;
+
+            auto dpi = GetImageAsDPI(ImageId(image));
+            PrewarmedImage prewarmed{ image, dpi.width, dpi.height, {} };
+            prewarmed.Pixels.assign(dpi.bits, dpi.bits + (dpi.width * dpi.height));
+            DeleteDPI(dpi);
+
+            std::lock_guard<std::mutex> lock(_prewarmMutex);
+            _prewarmedImages.push_back(std::move(prewarmed));
+        }
+    });
+}
+
+void TextureCache::CancelPrewarm()
+{
+    if (!_prewarmThread.joinable())
+        return;
+
+    _prewarmCancelled = true;
+    _prewarmThread.join();
+
+    std::lock_guard<std::mutex> lock(_prewarmMutex);
+    _prewarmedImages.clear();
+}
+
+void TextureCache::UploadPrewarmedImages()
+{
+    std::vector<PrewarmedImage> images;
+    {
+        std::lock_guard<std::mutex> lock(_prewarmMutex);
+        if (_prewarmedImages.empty())
+            return;
+
+        auto end = _prewarmedImages.begin() + std::min(_prewarmedImages.size(), kPrewarmUploadsPerFrame);
+        images.assign(std::make_move_iterator(_prewarmedImages.begin()), std::make_move_iterator(end));
+        _prewarmedImages.erase(_prewarmedImages.begin(), end);
+    }
+
+    unique_lock lock(_mutex);
+
+    // Allocate all slots before binding the unpack buffer, growing the atlases texture uploads from client memory.
+    std::vector<std::pair<const PrewarmedImage*, AtlasTextureInfo>> uploads;
+    size_t uploadSize = 0;
+    for (const auto& image : images)
+    {
+        // It may have been drawn in the meantime
+        if (_indexMap[image.Image] != UNUSED_INDEX)
+            continue;
+
+        auto info = AllocateImage(image.Width, image.Height);
+        info.image = image.Image;
+        uploads.emplace_back(&image, info);
+        uploadSize += image.Pixels.size();
+    }
+
+    if (uploads.empty())
+        return;
+
+    std::vector<uint8_t> staging;
+    staging.reserve(uploadSize);
+    for (const auto& upload : uploads)
+    {
+        staging.insert(staging.end(), upload.first->Pixels.begin(), upload.first->Pixels.end());
+    }
+
+    if (_prewarmBuffer == 0)
+    {
+        glGenBuffers(1, &_prewarmBuffer);
+    }
+
+    // Respecifying the whole buffer every time lets the driver hand out fresh storage instead of waiting for the
+    // uploads of the previous frame to finish.
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _prewarmBuffer);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, staging.size(), staging.data(), GL_STREAM_DRAW);
+
+    glBindTexture(GL_TEXTURE_2D_ARRAY, _atlasesTexture);
+    size_t offset = 0;
+    for (const auto& [image, info] : uploads)
+    {
+        glTexSubImage3D(
+            GL_TEXTURE_2D_ARRAY, 0, info.bounds.x, info.bounds.y, info.index, image->Width, image->Height, 1,
+            GL_RED_INTEGER, GL_UNSIGNED_BYTE, reinterpret_cast<const GLvoid*>(offset));
+        offset += image->Pixels.size();
+
+        _indexMap[info.image] = static_cast<uint32_t>(_textureCache.size());
+        _textureCache.push_back(info);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+std::vector<ImageIndex> TextureCache::GetCachedObjectImages()
+{
+    shared_lock lock(_mutex);
+
+    std::vector<ImageIndex> images;
+    for (ImageIndex image = SPR_IMAGE_LIST_BEGIN; image < SPR_IMAGE_LIST_END; image++)
+    {
+        if (_indexMap[image] != UNUSED_INDEX)
+        {
+            images.push_back(image);
+        }
+    }
+    return images;
+}
+
+void TextureCache::SaveWarmList()
+{
+    if (_warmListKey == 0)
+        return;
+
+    const auto images = GetCachedObjectImages();
+    if (images.empty())
+        return;
+
+    std::vector<uint32_t> data;
+    data.reserve(images.size() + 2);
+    data.push_back(kWarmListMagic);
+    data.push_back(static_cast<uint32_t>(images.size()));
+    data.insert(data.end(), images.begin(), images.end());
+
+    try
+    {
+        const auto path = GetWarmListPath(_warmListKey);
+        Path::CreateDirectory(Path::GetDirectory(path));
+        File::WriteAllBytes(path, data.data(), data.size() * sizeof(uint32_t));
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARNING("Unable to save sprite warm list: %s", e.what());
+    }
+}
+
+std::vector<ImageIndex> TextureCache::LoadWarmList(uint64_t key)
+{
+    std::vector<ImageIndex> images;
+    try
+    {
+        const auto path = GetWarmListPath(key);
+        if (!File::Exists(path))
+            return images;
+
+        const auto data = File::ReadAllBytes(path);
+        uint32_t header[2]{};
+        if (data.size() < sizeof(header))
+            return images;
+
+        std::memcpy(header, data.data(), sizeof(header));
+        if (header[0] != kWarmListMagic || data.size() != sizeof(header) + (header[1] * sizeof(uint32_t)))
+            return images;
+
+        images.resize(header[1]);
+        std::memcpy(images.data(), data.data() + sizeof(header), images.size() * sizeof(uint32_t));
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARNING("Unable to load sprite warm list: %s", e.what());
+        images.clear();
+    }
+    return images;
+}
+
+uint64_t TextureCache::GetObjectImagesKey()
+{
+    // The key only decides which images are prewarmed, the pixels always come from the current G1 elements.
+    // So the layout of the object images is enough to tell object sets apart, their data does not need hashing.
+    auto fnv = Crypt::CreateFNV1a();
+    for (ImageIndex image = SPR_IMAGE_LIST_BEGIN; image < SPR_IMAGE_LIST_END; image++)
+    {
+        const auto* g1Element = GfxGetG1Element(image);
+        if (g1Element == nullptr || g1Element->offset == nullptr)
+            continue;
+
+        const int32_t values[] = {
+            static_cast<int32_t>(image), g1Element->width, g1Element->height, g1Element->x_offset,
+            g1Element->y_offset,         g1Element->flags, g1Element->zoomed_offset,
+        };
+        fnv->Update(values, sizeof(values));
+    }
+
+    const auto hash = fnv->Finish();
+    uint64_t key{};
+    std::memcpy(&key, hash.data(), sizeof(key));
+    return std::max<uint64_t>(key, 1);
+}
+
+u8string TextureCache::GetWarmListPath(uint64_t key)
+{
+    auto env = GetContext()->GetPlatformEnvironment();
+    auto cachePath = env->GetDirectoryPath(DIRBASE::CACHE);
+    char fileName[32];
+    snprintf(fileName, sizeof(fileName), "sprites_%016llx.idx", static_cast<unsigned long long>(key));
+    return Path::Combine(cachePath, "spritecache", fileName);
+}
+
 void TextureCache::CreateTextures()
 {
     if (!_initialized)
@@ -393,6 +752,11 @@ void TextureCache::FreeTextures()
 {
     // Free array texture
     glDeleteTextures(1, &_atlasesTexture);
+    if (_prewarmBuffer != 0)
+    {
+        glDeleteBuffers(1, &_prewarmBuffer);
+        _prewarmBuffer = 0;
+    }
     _textureCache.clear();
     std::fill(_indexMap.begin(), _indexMap.end(), UNUSED_INDEX);
 }
@@ -15,13 +15,16 @@
 #include <SDL_pixels.h>
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <mutex>
 #include <openrct2/common.h>
+#include <openrct2/core/String.hpp>
 #include <openrct2/drawing/Drawing.h>
 #include <openrct2/sprites.h>
 #ifndef __MACOSX__
 #    include <shared_mutex>
 #endif
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -56,6 +59,16 @@ namespace OpenRCT2::Ui
         };
     };
 
+    struct GlyphCacheStats
+    {
+        // Lookups answered by the glyph table without taking a lock
+        uint64_t TableHits;
+        // Lookups answered by the glyph map, for glyphs out of the table range or with too many palettes
+        uint64_t MapHits;
+        // Lookups that had to load the glyph
+        uint64_t Misses;
+    };
+
     // This is the maximum width and height of each atlas, basically the
     // granularity at which new atlases are allocated (2048 -> 4 MB of VRAM)
     constexpr int32_t TEXTURE_CACHE_MAX_ATLAS_SIZE = 2048;
@@ -155,6 +168,11 @@ namespace OpenRCT2::Ui
             return static_cast<int32_t>(_freeSlots.size());
         }
 
+        [[nodiscard]] size_t GetMemoryUsage() const
+        {
+            return sizeof(Atlas) + _freeSlots.capacity() * sizeof(GLuint);
+        }
+
         static int32_t CalculateImageSizeOrder(int32_t actualWidth, int32_t actualHeight)
         {
             int32_t actualSize = std::max(actualWidth, actualHeight);
@@ -195,6 +213,28 @@ namespace OpenRCT2::Ui
     class TextureCache final
     {
     private:
+        // Glyphs of the sprite fonts are looked up directly by image, each with a few of the palettes it was drawn with.
+        // Entries are only ever appended, Count is published last so the slots can be read without a lock.
+        struct GlyphTableSlot
+        {
+            static constexpr uint8_t kCapacity = 8;
+
+            std::atomic<uint8_t> Count{};
+            std::array<uint64_t, kCapacity> Palettes{};
+            std::array<BasicTextureInfo, kCapacity> Textures{};
+        };
+
+        static constexpr size_t kGlyphTableSize = (SPR_CHAR_END - SPR_CHAR_START) + (SPR_G2_CHAR_END - SPR_G2_CHAR_BEGIN);
+
+        // An image rasterised by the prewarm thread that is waiting to be uploaded
+        struct PrewarmedImage
+        {
+            ImageIndex Image;
+            int32_t Width;
+            int32_t Height;
+            std::vector<uint8_t> Pixels;
+        };
+
         bool _initialized = false;
 
         GLuint _atlasesTexture = 0;
@@ -203,13 +243,26 @@ namespace OpenRCT2::Ui
         GLuint _atlasesTextureIndices = 0;
         GLint _atlasesTextureIndicesLimit = 0;
         std::vector<Atlas> _atlases;
+        std::array<GlyphTableSlot, kGlyphTableSize> _glyphTable;
         std::unordered_map<GlyphId, AtlasTextureInfo, GlyphId::Hash, GlyphId::Equal> _glyphTextureMap;
+        std::atomic<uint64_t> _glyphTableHits{};
+        std::atomic<uint64_t> _glyphMapHits{};
+        std::atomic<uint64_t> _glyphMisses{};
         std::vector<AtlasTextureInfo> _textureCache;
         std::array<uint32_t, SPR_IMAGE_LIST_END> _indexMap;
 
         GLuint _paletteTexture = 0;
         GLuint _blendPaletteTexture = 0;
 
+        std::thread _prewarmThread;
+        std::atomic<bool> _prewarmCancelled{};
+        std::mutex _prewarmMutex;
+        std::vector<PrewarmedImage> _prewarmedImages;
+        GLuint _prewarmBuffer = 0;
+        // Identifies the object images the warm list is recorded for, 0 if none.
+        uint64_t _warmListKey = 0;
+        bool _objectImagesChanged = false;
+
 #ifndef __MACOSX__
         std::shared_mutex _mutex;
         using shared_lock = std::shared_lock<std::shared_mutex>;
@@ -224,9 +277,15 @@ namespace OpenRCT2::Ui
         TextureCache();
         ~TextureCache();
         void InvalidateImage(ImageIndex image);
+        // Starts prewarming when the object images have changed and uploads the images prewarmed so far,
+        // must be called once per frame on the render thread.
+        void Update();
         BasicTextureInfo GetOrLoadImageTexture(const ImageId imageId);
         BasicTextureInfo GetOrLoadGlyphTexture(const ImageId imageId, const PaletteMap& paletteMap);
         BasicTextureInfo GetOrLoadBitmapTexture(ImageIndex image, const void* pixels, size_t width, size_t height);
+        GlyphCacheStats GetGlyphCacheStats() const;
+        // Bytes held by the cache bookkeeping plus the size of the atlas texture array on the GPU.
+        size_t GetMemoryUsage();
 
         GLuint GetAtlasesTexture();
         GLuint GetPaletteTexture();
@@ -234,6 +293,7 @@ namespace OpenRCT2::Ui
         static GLint PaletteToY(FilterPaletteID palette);
 
     private:
+        static GlyphTableSlot* GetGlyphTableSlot(std::array<GlyphTableSlot, kGlyphTableSize>& table, ImageIndex image);
         void CreateTextures();
         void GeneratePaletteTexture();
         void EnlargeAtlasesTexture(GLuint newEntries);
@@ -245,6 +305,15 @@ namespace OpenRCT2::Ui
         static DrawPixelInfo GetGlyphAsDPI(const ImageId imageId, const PaletteMap& paletteMap);
         void FreeTextures();
 
+        void StartPrewarm(std::vector<ImageIndex> images);
+        void CancelPrewarm();
+        void UploadPrewarmedImages();
+        std::vector<ImageIndex> GetCachedObjectImages();
+        void SaveWarmList();
+        static std::vector<ImageIndex> LoadWarmList(uint64_t key);
+        static uint64_t GetObjectImagesKey();
+        static u8string GetWarmListPath(uint64_t key);
+
         static DrawPixelInfo CreateDPI(int32_t width, int32_t height);
         static void DeleteDPI(DrawPixelInfo dpi);
     };
@@ -3,6 +3,7 @@
 #include "../interface/Viewport.h"
 #include "../interface/Window.h"
 
+#include <limits>
 #include <numeric>
 #include <openrct2/Context.h>
 #include <openrct2/GameState.h>
@@ -11,10 +12,12 @@
 #include <openrct2/audio/AudioMixer.h>
 #include <openrct2/audio/audio.h>
 #include <openrct2/core/FixedVector.h>
+#include <openrct2/entity/EntityList.h>
 #include <openrct2/entity/EntityRegistry.h>
 #include <openrct2/profiling/Profiling.h>
 #include <openrct2/ride/TrainManager.h>
 #include <openrct2/ride/Vehicle.h>
+#include <openrct2/world/Map.h>
 
 namespace OpenRCT2::Audio
 {
@@ -225,39 +228,115 @@ namespace OpenRCT2::Audio
         return param;
     }
 
+    /**
+     * A vehicle that passed the audibility checks and is in the running for one of the vehicle sound slots. Only the
+     * candidates left at the end have their pan, frequency and volume worked out.
+     */
+    struct VehicleSoundCandidate
+    {
+        const Vehicle* vehicle;
+        uint16_t priority;
+    };
+
     /**
      *
      *  rct2: 0x006BB9FF
      */
-    static void UpdateSoundParams(
-        const Vehicle& vehicle, FixedVector<VehicleSoundParams, MaxVehicleSounds>& vehicleSoundParamsList)
+    static void UpdateSoundCandidates(
+        const Vehicle& vehicle, FixedVector<VehicleSoundCandidate, MaxVehicleSounds>& candidates)
     {
         if (!SoundCanPlay(vehicle))
             return;
 
         uint16_t soundPriority = GetSoundPriority(vehicle);
-        // Find a sound param of lower priority to use
-        auto soundParamIter = std::find_if(
-            vehicleSoundParamsList.begin(), vehicleSoundParamsList.end(),
-            [soundPriority](const auto& param) { return soundPriority > param.priority; });
+        // Find a candidate of lower priority to use
+        auto candidateIter = std::find_if(candidates.begin(), candidates.end(), [soundPriority](const auto& candidate) {
+            return soundPriority > candidate.priority;
+        });
 
-        if (soundParamIter == std::end(vehicleSoundParamsList))
+        if (candidateIter == std::end(candidates))
         {
-            if (vehicleSoundParamsList.size() < MaxVehicleSounds)
+            if (candidates.size() < MaxVehicleSounds)
             {
-                vehicleSoundParamsList.push_back(CreateSoundParam(vehicle, soundPriority));
+                candidates.push_back({ &vehicle, soundPriority });
             }
         }
         else
         {
-            if (vehicleSoundParamsList.size() < MaxVehicleSounds)
+            if (candidates.size() < MaxVehicleSounds)
             {
-                // Shift all sound params down one if using a free space
-                vehicleSoundParamsList.insert(soundParamIter, CreateSoundParam(vehicle, soundPriority));
+                // Shift all candidates down one if using a free space
+                candidates.insert(candidateIter, { &vehicle, soundPriority });
             }
             else
             {
-                *soundParamIter = CreateSoundParam(vehicle, soundPriority);
+                *candidateIter = { &vehicle, soundPriority };
+            }
+        }
+    }
+
+    /**
+     * Picks the vehicles to play sounds for. When the listening viewport covers fewer tiles than there are vehicles,
+     * only the trains on the tiles that can appear in it are looked at.
+     */
+    static void FindSoundCandidates(FixedVector<VehicleSoundCandidate, MaxVehicleSounds>& candidates)
+    {
+        if (g_music_tracking_viewport == nullptr)
+            return;
+
+        const auto& viewport = *g_music_tracking_viewport;
+
+        // The main window also hears a quarter of the view beyond each edge, see SoundCanPlay
+        const auto quarterWidth = viewport.view_width / 4;
+        const auto quarterHeight = viewport.view_height / 4;
+
+        // Vehicle sprites extend well under this distance from the point the vehicle is at
+        constexpr int32_t kSpriteMargin = 128;
+        const auto left = viewport.viewPos.x - quarterWidth - kSpriteMargin;
+        const auto top = viewport.viewPos.y - quarterHeight - kSpriteMargin;
+        const auto right = viewport.viewPos.x + viewport.view_width + quarterWidth + kSpriteMargin;
+        const auto bottom = viewport.viewPos.y + viewport.view_height + quarterHeight + kSpriteMargin;
+        const ScreenCoordsXY corners[] = { { left, top }, { right, top }, { left, bottom }, { right, bottom } };
+
+        CoordsXY min{ std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::max() };
+        CoordsXY max{ std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::min() };
+        for (const auto& corner : corners)
+        {
+            for (int32_t z : { 0, kMaximumLandHeight * COORDS_Z_STEP })
+            {
+                auto mapPos = ViewportPosToMapPos(corner, z, viewport.rotation);
+                min = CoordsXY{ std::min(min.x, mapPos.x), std::min(min.y, mapPos.y) };
+                max = CoordsXY{ std::max(max.x, mapPos.x), std::max(max.y, mapPos.y) };
+            }
+        }
+
+        const auto& mapSize = GetGameState().MapSize;
+        const auto minTile = TileCoordsXY{ std::max(min.x / COORDS_XY_STEP, 0), std::max(min.y / COORDS_XY_STEP, 0) };
+        const auto maxTile = TileCoordsXY{ std::min(max.x / COORDS_XY_STEP, mapSize.x - 1),
+                                           std::min(max.y / COORDS_XY_STEP, mapSize.y - 1) };
+
+        const int64_t numTiles = static_cast<int64_t>(std::max(maxTile.x - minTile.x + 1, 0))
+            * std::max(maxTile.y - minTile.y + 1, 0);
+        if (numTiles > GetEntityListCount(EntityType::Vehicle))
+        {
+            for (auto vehicle : TrainManager::View())
+            {
+                UpdateSoundCandidates(*vehicle, candidates);
+            }
+            return;
+        }
+
+        for (int32_t y = minTile.y; y <= maxTile.y; y++)
+        {
+            for (int32_t x = minTile.x; x <= maxTile.x; x++)
+            {
+                for (auto vehicle : EntityTileList<Vehicle>(TileCoordsXY{ x, y }.ToCoordsXY()))
+                {
+                    if (vehicle->IsHead())
+                    {
+                        UpdateSoundCandidates(*vehicle, candidates);
+                    }
+                }
             }
         }
     }
@@ -528,13 +607,15 @@ namespace OpenRCT2::Audio
         if (!IsAvailable())
             return;
 
-        FixedVector<VehicleSoundParams, MaxVehicleSounds> vehicleSoundParamsList;
-
         VehicleSoundsUpdateWindowSetup();
 
-        for (auto vehicle : TrainManager::View())
+        FixedVector<VehicleSoundCandidate, MaxVehicleSounds> candidates;
+        FindSoundCandidates(candidates);
+
+        FixedVector<VehicleSoundParams, MaxVehicleSounds> vehicleSoundParamsList;
+        for (const auto& candidate : candidates)
         {
-            UpdateSoundParams(*vehicle, vehicleSoundParamsList);
+            vehicleSoundParamsList.push_back(CreateSoundParam(*candidate.vehicle, candidate.priority));
         }
 
         // Stop all playing sounds that no longer have priority to play after vehicle_update_sound_params
@@ -12,6 +12,7 @@
 #include "../interface/Window.h"
 
 #include <algorithm>
+#include <future>
 #include <memory>
 #include <openrct2/Context.h>
 #include <openrct2/Game.h>
@@ -21,6 +22,7 @@
 #include <openrct2/common.h>
 #include <openrct2/core/Console.hpp>
 #include <openrct2/core/Guard.hpp>
+#include <openrct2/core/MemoryStream.h>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
 #include <openrct2/entity/EntityRegistry.h>
@@ -39,16 +41,34 @@
 #include <openrct2/windows/Intent.h>
 #include <openrct2/world/Map.h>
 #include <openrct2/world/Scenery.h>
+#include <optional>
 #include <stdexcept>
 
 namespace OpenRCT2::Title
 {
+    /**
+     * The park of the next load command, prepared while the current park is still playing. The park data is read on a
+     * worker, parsed once it is there and its objects are then decoded in the background by the object manager, so the
+     * load command itself only has to register the objects and import the park.
+     */
+    struct TitleSequencePreload
+    {
+        int32_t Position{};
+        std::future<std::unique_ptr<TitleSequenceParkHandle>> ParkData;
+        std::unique_ptr<TitleSequenceParkHandle> ParkHandle;
+        u8string ScenarioPath;
+        std::unique_ptr<IParkImporter> Importer;
+        std::optional<ParkLoadResult> Result;
+        bool Failed{};
+    };
+
     class TitleSequencePlayer final : public ITitleSequencePlayer
     {
     private:
         std::unique_ptr<TitleSequence> _sequence;
         int32_t _position = 0;
         int32_t _waitCounter = 0;
+        std::unique_ptr<TitleSequencePreload> _preload;
 
         int32_t _previousWindowWidth = 0;
         int32_t _previousWindowHeight = 0;
@@ -71,6 +91,8 @@ namespace OpenRCT2::Title
 
         void Eject() override
         {
+            // The worker reads from the sequence
+            DiscardPreload();
             _sequence = nullptr;
         }
 
@@ -131,11 +153,20 @@ namespace OpenRCT2::Title
                     {
                         bool loadSuccess = false;
                         const auto saveIndex = std::get<LoadParkCommand>(currentCommand).SaveIndex;
-                        auto parkHandle = TitleSequenceGetParkHandle(*_sequence, saveIndex);
-                        if (parkHandle != nullptr)
+                        auto preload = TakePreload();
+                        if (preload != nullptr)
                         {
                             GameNotifyMapChange();
-                            loadSuccess = LoadParkFromStream(parkHandle->Stream.get(), parkHandle->HintPath);
+                            loadSuccess = LoadPreloadedPark(*preload);
+                        }
+                        if (!loadSuccess)
+                        {
+                            auto parkHandle = TitleSequenceGetParkHandle(*_sequence, saveIndex);
+                            if (parkHandle != nullptr)
+                            {
+                                GameNotifyMapChange();
+                                loadSuccess = LoadParkFromStream(parkHandle->Stream.get(), parkHandle->HintPath);
+                            }
                         }
                         if (!loadSuccess)
                         {
@@ -154,8 +185,14 @@ namespace OpenRCT2::Title
                     {
                         auto& scenarioName = std::get<LoadScenarioCommand>(currentCommand).Scenario;
                         bool loadSuccess = false;
+                        auto preload = TakePreload();
+                        if (preload != nullptr)
+                        {
+                            GameNotifyMapChange();
+                            loadSuccess = LoadPreloadedPark(*preload);
+                        }
                         auto scenario = GetScenarioRepository()->GetByInternalName(scenarioName);
-                        if (scenario != nullptr)
+                        if (!loadSuccess && scenario != nullptr)
                         {
                             GameNotifyMapChange();
                             loadSuccess = LoadParkFromFile(scenario->Path);
@@ -198,6 +235,8 @@ namespace OpenRCT2::Title
                 }
             }
 
+            UpdatePreload();
+
             // Store current window size and screen position in case the window resizes and the main focus changes
             StoreCurrentViewLocation();
 
@@ -206,6 +245,7 @@ namespace OpenRCT2::Title
 
         void Reset() override
         {
+            DiscardPreload();
             _position = 0;
             _waitCounter = 0;
         }
@@ -281,6 +321,178 @@ namespace OpenRCT2::Title
             return _position != entryPosition;
         }
 
+        /**
+         * Starts preparing the park of the next load command, or moves the preparation on once the park data was read.
+         */
+        void UpdatePreload()
+        {
+            // Previewing in game loads through the context, which also has to deal with the windows of the player
+            if (gPreviewingTitleSequenceInGame)
+                return;
+
+            if (_preload == nullptr)
+            {
+                StartPreload();
+            }
+            else if (
+                _preload->ParkData.valid()
+                && _preload->ParkData.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            {
+                ParsePreload(*_preload);
+            }
+        }
+
+        void StartPreload()
+        {
+            const auto numCommands = static_cast<int32_t>(_sequence->Commands.size());
+            for (int32_t i = 1; i <= numCommands; i++)
+            {
+                const auto position = (_position + i) % numCommands;
+                const auto& command = _sequence->Commands[position];
+                if (!TitleSequenceIsLoadCommand(command))
+                    continue;
+
+                auto preload = std::make_unique<TitleSequencePreload>();
+                preload->Position = position;
+                if (const auto* loadPark = std::get_if<LoadParkCommand>(&command))
+                {
+                    // Reading the park out of the sequence may involve unzipping it, done on a worker
+                    preload->ParkData = std::async(
+                        std::launch::async, [sequence = _sequence.get(), saveIndex = loadPark->SaveIndex]() {
+                            return ReadParkData(*sequence, saveIndex);
+                        });
+                    _preload = std::move(preload);
+                }
+                else if (const auto* loadScenario = std::get_if<LoadScenarioCommand>(&command))
+                {
+                    auto scenario = GetScenarioRepository()->GetByInternalName(loadScenario->Scenario);
+                    if (scenario == nullptr)
+                        return;
+
+                    preload->ScenarioPath = scenario->Path;
+                    _preload = std::move(preload);
+                    ParsePreload(*_preload);
+                }
+                return;
+            }
+        }
+
+        static std::unique_ptr<TitleSequenceParkHandle> ReadParkData(const TitleSequence& sequence, size_t saveIndex)
+        {
+            try
+            {
+                auto handle = TitleSequenceGetParkHandle(sequence, saveIndex);
+                if (handle != nullptr && handle->Stream->GetData() == nullptr)
+                {
+                    // Parks of sequences in a folder are files, read them now rather than during the parse
+                    std::vector<uint8_t> data(handle->Stream->GetLength());
+                    handle->Stream->Read(data.data(), data.size());
+                    handle->Stream = std::make_unique<MemoryStream>(std::move(data));
+                }
+                return handle;
+            }
+            catch (const std::exception&)
+            {
+                return nullptr;
+            }
+        }
+
+        /**
+         * Parses the park and hands its objects to the object manager to decode in the background. The parse stays on
+         * the main thread as objects packed into a park are added to the object repository.
+         */
+        void ParsePreload(TitleSequencePreload& preload)
+        {
+            if (preload.Result.has_value() || preload.Failed)
+                return;
+
+            try
+            {
+                if (preload.ParkData.valid())
+                {
+                    preload.ParkHandle = preload.ParkData.get();
+                    if (preload.ParkHandle == nullptr)
+                    {
+                        preload.Failed = true;
+                        return;
+                    }
+
+                    const auto& hintPath = preload.ParkHandle->HintPath;
+                    bool isScenario = ParkImporter::ExtensionIsScenario(hintPath);
+                    preload.Importer = ParkImporter::Create(hintPath);
+                    preload.Result.emplace(preload.Importer->LoadFromStream(preload.ParkHandle->Stream.get(), isScenario));
+                }
+                else
+                {
+                    preload.Importer = ParkImporter::Create(preload.ScenarioPath);
+                    preload.Result.emplace(preload.Importer->Load(preload.ScenarioPath));
+                }
+                GetContext()->GetObjectManager().PreloadObjects(preload.Result->RequiredObjects);
+            }
+            catch (const std::exception&)
+            {
+                // The load command will try again the regular way and report the error
+                preload.Failed = true;
+            }
+        }
+
+        /**
+         * Returns the preloaded park if it belongs to the current load command, any other preload is dropped.
+         */
+        std::unique_ptr<TitleSequencePreload> TakePreload()
+        {
+            auto preload = std::move(_preload);
+            if (preload == nullptr || preload->Position != _position)
+            {
+                if (preload != nullptr && preload->ParkData.valid())
+                {
+                    preload->ParkData.wait();
+                }
+                return nullptr;
+            }
+
+            ParsePreload(*preload);
+            if (preload->Failed)
+                return nullptr;
+
+            return preload;
+        }
+
+        void DiscardPreload()
+        {
+            if (_preload != nullptr && _preload->ParkData.valid())
+            {
+                _preload->ParkData.wait();
+            }
+            if (_preload != nullptr && _preload->Result.has_value())
+            {
+                // The objects may have been read for a park that will not be loaded any more
+                GetContext()->GetObjectManager().CancelPreload();
+            }
+            _preload = nullptr;
+        }
+
+        bool LoadPreloadedPark(TitleSequencePreload& preload)
+        {
+            LOG_VERBOSE("TitleSequencePlayer::LoadPreloadedPark(%d)", preload.Position);
+            try
+            {
+                auto& objectManager = GetContext()->GetObjectManager();
+                objectManager.LoadObjects(preload.Result->RequiredObjects);
+
+                auto& gameState = GetGameState();
+                preload.Importer->Import(gameState);
+                MapAnimationAutoCreate();
+                PrepareParkForPlayback();
+                return true;
+            }
+            catch (const std::exception&)
+            {
+                Console::Error::WriteLine("Unable to load preloaded park, loading it again.");
+            }
+            return false;
+        }
+
         bool LoadParkFromFile(const u8string& path)
         {
             LOG_VERBOSE("TitleSequencePlayer::LoadParkFromFile(%s)", path.c_str());
@@ -17,6 +17,7 @@
 #include <openrct2/localisation/LocalisationService.h>
 #include <openrct2/paint/Paint.h>
 #include <openrct2/paint/tile_element/Paint.TileElement.h>
+#include <openrct2/profiling/PaintStatistics.h>
 #include <openrct2/ride/TrackPaint.h>
 
 namespace OpenRCT2::Ui::Windows
@@ -30,10 +31,17 @@ enum WindowDebugPaintWidgetIdx
     WIDX_TOGGLE_SHOW_SEGMENT_HEIGHTS,
     WIDX_TOGGLE_SHOW_BOUND_BOXES,
     WIDX_TOGGLE_SHOW_DIRTY_VISUALS,
+    WIDX_TOGGLE_SHOW_STATISTICS,
+    WIDX_TOGGLE_SHOW_OVERDRAW_HEATMAP,
 };
 
 constexpr int32_t WINDOW_WIDTH = 200;
-constexpr int32_t WINDOW_HEIGHT = 8 + 15 + 15 + 15 + 15 + 11 + 8;
+constexpr int32_t WINDOW_HEIGHT = 8 + 15 + 15 + 15 + 15 + 15 + 15 + 11 + 8;
+
+constexpr int32_t STATISTICS_LINE_HEIGHT = 11;
+constexpr int32_t STATISTICS_LINES = 5;
+constexpr int32_t STATISTICS_HEIGHT = 4 + STATISTICS_LINE_HEIGHT * STATISTICS_LINES;
+constexpr int32_t STATISTICS_MIN_WIDTH = 240;
 
 static Widget window_debug_paint_widgets[] = {
     MakeWidget({0,          0}, {WINDOW_WIDTH, WINDOW_HEIGHT}, WindowWidgetType::Frame,    WindowColour::Primary                                        ),
@@ -42,6 +50,8 @@ static Widget window_debug_paint_widgets[] = {
     MakeWidget({8, 8 + 15 * 2}, {         185,            12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_DEBUG_PAINT_SHOW_SEGMENT_HEIGHTS),
     MakeWidget({8, 8 + 15 * 3}, {         185,            12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_DEBUG_PAINT_SHOW_BOUND_BOXES    ),
     MakeWidget({8, 8 + 15 * 4}, {         185,            12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_DEBUG_PAINT_SHOW_DIRTY_VISUALS  ),
+    MakeWidget({8, 8 + 15 * 5}, {         185,            12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_DEBUG_PAINT_SHOW_STATISTICS     ),
+    MakeWidget({8, 8 + 15 * 6}, {         185,            12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_DEBUG_PAINT_SHOW_OVERDRAW_HEATMAP),
     kWidgetsEnd,
 };
     // clang-format on
@@ -50,6 +60,7 @@ static Widget window_debug_paint_widgets[] = {
     {
     private:
         int32_t ResizeLanguage = LANGUAGE_UNDEFINED;
+        int16_t CheckboxesWidth = WINDOW_WIDTH;
 
     public:
         void OnOpen() override
@@ -65,6 +76,16 @@ static Widget window_debug_paint_widgets[] = {
             ResizeLanguage = LANGUAGE_UNDEFINED;
         }
 
+        void OnUpdate() override
+        {
+            // The statistics are summarised once a second, no need to redraw them more often
+            frame_no++;
+            if (gPaintStatistics && frame_no % 40 == 0)
+            {
+                Invalidate();
+            }
+        }
+
         void OnMouseUp(WidgetIndex widgetIndex) override
         {
             switch (widgetIndex)
@@ -93,6 +114,17 @@ static Widget window_debug_paint_widgets[] = {
                     gShowDirtyVisuals = !gShowDirtyVisuals;
                     GfxInvalidateScreen();
                     break;
+
+                case WIDX_TOGGLE_SHOW_STATISTICS:
+                    gPaintStatistics = !gPaintStatistics;
+                    PaintStatistics::Reset();
+                    GfxInvalidateScreen();
+                    break;
+
+                case WIDX_TOGGLE_SHOW_OVERDRAW_HEATMAP:
+                    gPaintOverdrawHeatmap = !gPaintOverdrawHeatmap;
+                    GfxInvalidateScreen();
+                    break;
             }
         }
 
@@ -107,7 +139,7 @@ static Widget window_debug_paint_widgets[] = {
 
                 // Find the width of the longest string
                 int16_t newWidth = 0;
-                for (size_t widgetIndex = WIDX_TOGGLE_SHOW_WIDE_PATHS; widgetIndex <= WIDX_TOGGLE_SHOW_DIRTY_VISUALS;
+                for (size_t widgetIndex = WIDX_TOGGLE_SHOW_WIDE_PATHS; widgetIndex <= WIDX_TOGGLE_SHOW_OVERDRAW_HEATMAP;
                      widgetIndex++)
                 {
                     const auto& stringIdx = widgets[widgetIndex].text;
@@ -118,17 +150,30 @@ static Widget window_debug_paint_widgets[] = {
                 }
 
                 // Add padding for both sides (8) and the offset for the text after the checkbox (15)
-                newWidth += 8 * 2 + 15;
+                CheckboxesWidth = newWidth + 8 * 2 + 15;
+            }
+
+            // The statistics are listed below the checkboxes while they are gathered
+            const int16_t newWidth = gPaintStatistics ? std::max<int16_t>(CheckboxesWidth, STATISTICS_MIN_WIDTH)
+                                                      : CheckboxesWidth;
+            const int16_t newHeight = WINDOW_HEIGHT + (gPaintStatistics ? STATISTICS_HEIGHT : 0);
+            if (width != newWidth || height != newHeight)
+            {
+                Invalidate();
 
                 width = newWidth;
                 max_width = newWidth;
                 min_width = newWidth;
+                height = newHeight;
+                max_height = newHeight;
+                min_height = newHeight;
                 widgets[WIDX_BACKGROUND].right = newWidth - 1;
-                widgets[WIDX_TOGGLE_SHOW_WIDE_PATHS].right = newWidth - 8;
-                widgets[WIDX_TOGGLE_SHOW_BLOCKED_TILES].right = newWidth - 8;
-                widgets[WIDX_TOGGLE_SHOW_SEGMENT_HEIGHTS].right = newWidth - 8;
-                widgets[WIDX_TOGGLE_SHOW_BOUND_BOXES].right = newWidth - 8;
-                widgets[WIDX_TOGGLE_SHOW_DIRTY_VISUALS].right = newWidth - 8;
+                widgets[WIDX_BACKGROUND].bottom = newHeight - 1;
+                for (WidgetIndex widgetIndex = WIDX_TOGGLE_SHOW_WIDE_PATHS; widgetIndex <= WIDX_TOGGLE_SHOW_OVERDRAW_HEATMAP;
+                     widgetIndex++)
+                {
+                    widgets[widgetIndex].right = newWidth - 8;
+                }
 
                 Invalidate();
             }
@@ -138,11 +183,54 @@ static Widget window_debug_paint_widgets[] = {
             WidgetSetCheckboxValue(*this, WIDX_TOGGLE_SHOW_SEGMENT_HEIGHTS, gShowSupportSegmentHeights);
             WidgetSetCheckboxValue(*this, WIDX_TOGGLE_SHOW_BOUND_BOXES, gPaintBoundingBoxes);
             WidgetSetCheckboxValue(*this, WIDX_TOGGLE_SHOW_DIRTY_VISUALS, gShowDirtyVisuals);
+            WidgetSetCheckboxValue(*this, WIDX_TOGGLE_SHOW_STATISTICS, gPaintStatistics);
+            WidgetSetCheckboxValue(*this, WIDX_TOGGLE_SHOW_OVERDRAW_HEATMAP, gPaintOverdrawHeatmap);
         }
 
         void OnDraw(DrawPixelInfo& dpi) override
         {
             DrawWidgets(dpi);
+
+            if (gPaintStatistics)
+            {
+                DrawStatistics(dpi);
+            }
+        }
+
+    private:
+        void DrawStatistics(DrawPixelInfo& dpi)
+        {
+            const auto summary = PaintStatistics::GetSummary();
+            const auto& perFrame = summary.PerFrame;
+            const auto toHundredths = [](float ms) { return static_cast<int32_t>(ms * 100.0f); };
+
+            auto screenCoords = windowPos + ScreenCoordsXY{ 8, WINDOW_HEIGHT - 4 };
+            auto drawLine = [&](StringId stringId, const Formatter& ft) {
+                DrawTextBasic(dpi, screenCoords, stringId, ft, { colours[1] });
+                screenCoords.y += STATISTICS_LINE_HEIGHT;
+            };
+
+            auto ft = Formatter();
+            ft.Add<int32_t>(perFrame.PaintStructs);
+            drawLine(STR_DEBUG_PAINT_STATS_PAINT_STRUCTS, ft);
+
+            ft = Formatter();
+            ft.Add<int32_t>(perFrame.SpritesDrawn);
+            drawLine(STR_DEBUG_PAINT_STATS_SPRITES_DRAWN, ft);
+
+            ft = Formatter();
+            ft.Add<int32_t>(static_cast<int32_t>(std::min<uint64_t>(perFrame.PixelsCovered, INT32_MAX)));
+            drawLine(STR_DEBUG_PAINT_STATS_PIXELS_COVERED, ft);
+
+            ft = Formatter();
+            ft.Add<int32_t>(perFrame.MaxOverdraw);
+            drawLine(STR_DEBUG_PAINT_STATS_MAX_OVERDRAW, ft);
+
+            ft = Formatter();
+            ft.Add<int32_t>(toHundredths(perFrame.GenerateMs));
+            ft.Add<int32_t>(toHundredths(perFrame.ArrangeMs));
+            ft.Add<int32_t>(toHundredths(perFrame.DrawMs));
+            drawLine(STR_DEBUG_PAINT_STATS_TIMES, ft);
         }
     };
 
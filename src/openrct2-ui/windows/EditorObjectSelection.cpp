@@ -255,6 +255,12 @@ static std::vector<Widget> _window_editor_object_selection_widgets = {
 
     private:
         std::vector<ObjectListItem> _listItems;
+        // Name, ride type, file name and authors of each repository item with the case folded, separated by new lines.
+        // Built once so a key press in the search box does not have to fold every field of every object again.
+        std::vector<std::string> _searchText;
+        // Which repository items contain _searchedFilter
+        std::vector<bool> _filterStringMatches;
+        std::string _searchedFilter;
         int32_t _listSortType = RIDE_SORT_TYPE;
         bool _listSortDescending = false;
         std::unique_ptr<Object> _loadedObject;
@@ -1170,6 +1176,7 @@ static std::vector<Widget> _window_editor_object_selection_widgets = {
 
             VisibleListDispose();
             selected_list_item = -1;
+            UpdateFilterStringMatches();
 
             const ObjectRepositoryItem* items = ObjectRepositoryGetItems();
             for (int32_t i = 0; i < numObjects; i++)
@@ -1177,7 +1184,7 @@ static std::vector<Widget> _window_editor_object_selection_widgets = {
                 uint8_t selectionFlags = _objectSelectionFlags[i];
                 const ObjectRepositoryItem* item = &items[i];
                 if (item->Type == GetSelectedObjectType() && !(selectionFlags & ObjectSelectionFlags::Flag6)
-                    && FilterSource(item) && FilterString(*item) && FilterChunks(item) && FilterSelected(selectionFlags)
+                    && FilterSource(item) && _filterStringMatches[i] && FilterChunks(item) && FilterSelected(selectionFlags)
                     && FilterCompatibilityObject(*item, selectionFlags))
                 {
                     auto filter = std::make_unique<RideFilters>();
@@ -1389,48 +1396,69 @@ static std::vector<Widget> _window_editor_object_selection_widgets = {
             return !(item.Flags & ObjectItemFlags::IsCompatibilityObject) || (objectFlag & ObjectSelectionFlags::Selected);
         }
 
-        static bool IsFilterInName(const ObjectRepositoryItem& item, std::string_view filter)
+        static std::string FoldAsciiCase(std::string_view src)
         {
-            return String::Contains(item.Name, filter, true);
-        }
-
-        static bool IsFilterInRideType(const ObjectRepositoryItem& item, std::string_view filter)
-        {
-            if (item.Type == ObjectType::Ride)
+            // Matches String::Contains, which only ignores the case of ASCII characters
+            std::string result(src);
+            for (auto& c : result)
             {
-                auto rideTypeName = LanguageGetString(GetRideTypeStringId(&item));
-                if (String::Contains(rideTypeName, filter, true))
-                    return true;
+                const auto uc = static_cast<unsigned char>(c);
+                if (uc < 0x80)
+                    c = static_cast<char>(tolower(uc));
             }
-            return false;
+            return result;
         }
 
-        static bool IsFilterInFilename(const ObjectRepositoryItem& item, std::string_view filter)
+        void BuildSearchText()
         {
-            return String::Contains(item.Path, filter, true);
-        }
-
-        static bool IsFilterInAuthor(const ObjectRepositoryItem& item, std::string_view filter)
-        {
-            for (auto& author : item.Authors)
+            const size_t numObjects = ObjectRepositoryGetItemsCount();
+            const ObjectRepositoryItem* items = ObjectRepositoryGetItems();
+            _searchText.resize(numObjects);
+            for (size_t i = 0; i < numObjects; i++)
             {
-                if (String::Contains(author, filter, true))
+                const auto& item = items[i];
+                std::string text = item.Name;
+                if (item.Type == ObjectType::Ride)
                 {
-                    return true;
+                    text += '\n';
+                    text += LanguageGetString(GetRideTypeStringId(&item));
+                }
+                text += '\n';
+                text += item.Path;
+                for (const auto& author : item.Authors)
+                {
+                    text += '\n';
+                    text += author;
                 }
+                _searchText[i] = FoldAsciiCase(text);
             }
-            return false;
         }
 
-        bool FilterString(const ObjectRepositoryItem& item)
+        void UpdateFilterStringMatches()
         {
-            // Nothing to search for
-            std::string_view filter = _filter_string;
-            if (filter.empty())
-                return true;
+            const size_t numObjects = ObjectRepositoryGetItemsCount();
+            if (_searchText.size() != numObjects)
+            {
+                BuildSearchText();
+                _searchedFilter.clear();
+                _filterStringMatches.assign(numObjects, true);
+            }
 
-            return IsFilterInName(item, filter) || IsFilterInRideType(item, filter) || IsFilterInFilename(item, filter)
-                || IsFilterInAuthor(item, filter);
+            auto filter = FoldAsciiCase(_filter_string);
+            if (filter == _searchedFilter)
+                return;
+
+            // Typing more can only remove matches, so only the objects that still matched need to be searched again.
+            // The fields are separated by new lines, which the search box can not contain, so a match never spans two.
+            const bool narrowing = filter.find(_searchedFilter) != std::string::npos;
+            for (size_t i = 0; i < numObjects; i++)
+            {
+                if (narrowing && !_filterStringMatches[i])
+                    continue;
+
+                _filterStringMatches[i] = filter.empty() || _searchText[i].find(filter) != std::string::npos;
+            }
+            _searchedFilter = std::move(filter);
         }
 
         bool SourcesMatch(ObjectSourceGame source)
@@ -1492,13 +1520,14 @@ static std::vector<Widget> _window_editor_object_selection_widgets = {
             {
                 const auto& selectionFlags = _objectSelectionFlags;
                 std::fill(std::begin(_filter_object_counts), std::end(_filter_object_counts), 0);
+                UpdateFilterStringMatches();
 
                 size_t numObjects = ObjectRepositoryGetItemsCount();
                 const ObjectRepositoryItem* items = ObjectRepositoryGetItems();
                 for (size_t i = 0; i < numObjects; i++)
                 {
                     const ObjectRepositoryItem* item = &items[i];
-                    if (FilterSource(item) && FilterString(*item) && FilterChunks(item) && FilterSelected(selectionFlags[i])
+                    if (FilterSource(item) && _filterStringMatches[i] && FilterChunks(item) && FilterSelected(selectionFlags[i])
                         && FilterCompatibilityObject(*item, selectionFlags[i]))
                     {
                         _filter_object_counts[EnumValue(item->Type)]++;
@@ -171,6 +171,8 @@ static_assert(_guestWindowPageWidgets.size() == WINDOW_GUEST_PAGE_COUNT);
         uint16_t _guestAnimationFrame = 0;
         int16_t _pickedPeepX = LOCATION_NULL; // entity->x gets set to 0x8000 on pickup, this is the old value
         std::vector<RideId> _riddenRides;
+        bool _riddenRidesValid = false;
+        bool _statsBlinkPhase = false;
 
     public:
         void OnOpen() override
@@ -496,6 +498,7 @@ static_assert(_guestWindowPageWidgets.size() == WINDOW_GUEST_PAGE_COUNT);
             page = newPage;
             frame_no = 0;
             _riddenRides.clear();
+            _riddenRidesValid = false;
             selected_list_item = -1;
 
             RemoveViewport();
@@ -1022,14 +1025,24 @@ static_assert(_guestWindowPageWidgets.size() == WINDOW_GUEST_PAGE_COUNT);
         void OnUpdateStats()
         {
             frame_no++;
+            WidgetInvalidate(*this, WIDX_TAB_2);
+
             auto peep = GetGuest();
             if (peep == nullptr)
             {
                 return;
             }
-            peep->WindowInvalidateFlags &= ~PEEP_INVALIDATE_PEEP_STATS;
 
-            Invalidate();
+            // Redraw when the guest reports changed needs, when the time in park goes up and when the low bars blink
+            const bool blinkPhase = (gCurrentRealTimeTicks & 8) != 0;
+            int32_t numTicks = GetGameState().CurrentTicks - peep->GetParkEntryTime();
+            if ((peep->WindowInvalidateFlags & PEEP_INVALIDATE_PEEP_STATS) || !(numTicks & 0x7FF)
+                || blinkPhase != _statsBlinkPhase)
+            {
+                peep->WindowInvalidateFlags &= ~PEEP_INVALIDATE_PEEP_STATS;
+                Invalidate();
+            }
+            _statsBlinkPhase = blinkPhase;
         }
 
         void StatsBarsDraw(int32_t value, const ScreenCoordsXY& origCoords, DrawPixelInfo& dpi, int32_t colour, bool blinkFlag)
@@ -1238,7 +1251,21 @@ static_assert(_guestWindowPageWidgets.size() == WINDOW_GUEST_PAGE_COUNT);
             // Every 2048 ticks do a full window_invalidate
             int32_t numTicks = GetGameState().CurrentTicks - guest->GetParkEntryTime();
             if (!(numTicks & 0x7FF))
+            {
+                _riddenRidesValid = false;
                 Invalidate();
+            }
+
+            // Only walk the rides again once the guest has been on a new one, the periodic refresh above picks up
+            // rides that were demolished in the meantime
+            if (guest->WindowInvalidateFlags & PEEP_INVALIDATE_PEEP_RIDES)
+            {
+                guest->WindowInvalidateFlags &= ~PEEP_INVALIDATE_PEEP_RIDES;
+                _riddenRidesValid = false;
+            }
+            if (_riddenRidesValid)
+                return;
+            _riddenRidesValid = true;
 
             const auto oldSize = _riddenRides.size();
             _riddenRides.clear();
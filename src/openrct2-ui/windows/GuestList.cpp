@@ -18,6 +18,7 @@
 #include <openrct2/drawing/Drawing.h>
 #include <openrct2/entity/EntityRegistry.h>
 #include <openrct2/entity/Guest.h>
+#include <openrct2/entity/PeepStringCache.h>
 #include <openrct2/localisation/Formatter.h>
 #include <openrct2/localisation/Formatting.h>
 #include <openrct2/localisation/Localisation.h>
@@ -27,6 +28,7 @@
 #include <openrct2/util/Math.hpp>
 #include <openrct2/util/Util.h>
 #include <openrct2/world/Park.h>
+#include <unordered_map>
 #include <vector>
 
 namespace OpenRCT2::Ui::Windows
@@ -121,12 +123,23 @@ static Widget window_guest_list_widgets[] = {
             uint8_t Faces[58]{};
         };
 
-        struct GuestItem
+        // Guest names are only formatted when they are needed for sorting or filtering and are kept between refreshes
+        struct GuestName
         {
-            using CompareFunc = bool (*)(const GuestItem&, const GuestItem&);
+            EntityId Id;
+            uint32_t PeepId{};
+            bool RealNames{};
+            std::string CustomName;
+            std::string Name;
+            bool NameFormatted{};
+            bool InList{};
+            uint32_t LastRefresh{};
+        };
 
+        struct GuestItem
+        {
             EntityId Id;
-            char Name[256];
+            GuestName* Name{};
         };
 
         static constexpr uint8_t SUMMARISED_GUEST_ROW_HEIGHT = SCROLLABLE_ROW_HEIGHT + 11;
@@ -150,6 +163,9 @@ static Widget window_guest_list_widgets[] = {
         std::vector<GuestGroup> _groups;
 
         std::vector<GuestItem> _guestList;
+        std::unordered_map<EntityId::UnderlyingType, GuestName> _guestNames;
+        uint32_t _guestListRefresh{};
+        bool _guestListRealNames{};
         std::optional<size_t> _highlightedIndex;
 
         uint32_t _tabAnimationIndex{};
@@ -556,20 +572,15 @@ static Widget window_guest_list_widgets[] = {
             {
                 case TabId::Individual:
                 {
-                    auto i = screenCoords.y / SCROLLABLE_ROW_HEIGHT;
-                    i += static_cast<int32_t>(_selectedPage * GUESTS_PER_PAGE);
-                    for (const auto& guestItem : _guestList)
+                    auto i = static_cast<size_t>(screenCoords.y / SCROLLABLE_ROW_HEIGHT);
+                    i += _selectedPage * GUESTS_PER_PAGE;
+                    if (i < _guestList.size())
                     {
-                        if (i == 0)
+                        auto guest = GetEntity<Guest>(_guestList[i].Id);
+                        if (guest != nullptr)
                         {
-                            auto guest = GetEntity<Guest>(guestItem.Id);
-                            if (guest != nullptr)
-                            {
-                                GuestOpen(guest);
-                            }
-                            break;
+                            GuestOpen(guest);
                         }
-                        i--;
                     }
                     break;
                 }
@@ -617,35 +628,125 @@ static Widget window_guest_list_widgets[] = {
             }
             else
             {
+                RefreshGuestList();
+            }
+        }
+
+        void OnLanguageChange() override
+        {
+            // Generated guest names are localised
+            _guestList.clear();
+            _guestNames.clear();
+            RefreshList();
+        }
+
+    private:
+        /**
+         * Updates the list of guests shown on the individual tab. The list is kept sorted between refreshes, so only
+         * guests that have just become visible or have been renamed need to be sorted and merged back in.
+         */
+        void RefreshGuestList()
+        {
+            auto realNames = (GetGameState().Park.Flags & PARK_FLAGS_SHOW_REAL_GUEST_NAMES) != 0;
+            if (realNames != _guestListRealNames)
+            {
+                // The sort order changes completely
+                _guestListRealNames = realNames;
                 _guestList.clear();
+                for (auto& [id, guestName] : _guestNames)
+                {
+                    guestName.InList = false;
+                }
+            }
 
-                for (auto peep : EntityList<Guest>())
+            _guestListRefresh++;
+            std::vector<GuestItem> newItems;
+            for (auto peep : EntityList<Guest>())
+            {
+                EntitySetFlashing(peep, false);
+                if (peep->OutsideOfPark)
+                    continue;
+                if (_selectedFilter)
                 {
-                    EntitySetFlashing(peep, false);
-                    if (peep->OutsideOfPark)
-                        continue;
-                    if (_selectedFilter)
-                    {
-                        if (!IsPeepInFilter(*peep))
-                            continue;
-                        EntitySetFlashing(peep, true);
-                    }
-                    if (!GuestShouldBeVisible(*peep))
+                    if (!IsPeepInFilter(*peep))
                         continue;
+                    EntitySetFlashing(peep, true);
+                }
+
+                auto& guestName = GetGuestName(*peep);
+                if (!GuestShouldBeVisible(*peep, guestName))
+                    continue;
 
-                    auto& item = _guestList.emplace_back();
-                    item.Id = peep->Id;
+                guestName.LastRefresh = _guestListRefresh;
+                if (!guestName.InList)
+                {
+                    newItems.push_back({ peep->Id, &guestName });
+                }
+            }
 
-                    Formatter ft;
-                    peep->FormatNameTo(ft);
-                    OpenRCT2::FormatStringLegacy(item.Name, sizeof(item.Name), STR_STRINGID, ft.Data());
+            // Drop guests that are no longer visible, what remains is still in order
+            auto removed = std::remove_if(_guestList.begin(), _guestList.end(), [this](const GuestItem& item) {
+                if (item.Name->LastRefresh == _guestListRefresh && item.Name->InList)
+                    return false;
+                item.Name->InList = false;
+                return true;
+            });
+            _guestList.erase(removed, _guestList.end());
+
+            if (!newItems.empty())
+            {
+                auto compare = [this](const GuestItem& a, const GuestItem& b) { return CompareGuestItem(a, b); };
+                std::sort(newItems.begin(), newItems.end(), compare);
+                for (auto& item : newItems)
+                {
+                    item.Name->InList = true;
                 }
 
-                std::sort(_guestList.begin(), _guestList.end(), GetGuestCompareFunc());
+                auto oldSize = _guestList.size();
+                _guestList.insert(_guestList.end(), newItems.begin(), newItems.end());
+                std::inplace_merge(
+                    _guestList.begin(), _guestList.begin() + static_cast<ptrdiff_t>(oldSize), _guestList.end(), compare);
+            }
+
+            // Forget guests that have left the park or are filtered out
+            for (auto it = _guestNames.begin(); it != _guestNames.end();)
+            {
+                if (it->second.LastRefresh != _guestListRefresh)
+                    it = _guestNames.erase(it);
+                else
+                    ++it;
             }
         }
 
-    private:
+        GuestName& GetGuestName(const Guest& peep)
+        {
+            auto& guestName = _guestNames[peep.Id.ToUnderlying()];
+            const char* customName = peep.Name != nullptr ? peep.Name : "";
+            if (guestName.PeepId != peep.PeepId || guestName.RealNames != _guestListRealNames
+                || guestName.CustomName != customName || guestName.LastRefresh == 0)
+            {
+                // New guest, a reused entity or a rename; the name has to be formatted again and re-sorted
+                guestName.Id = peep.Id;
+                guestName.PeepId = peep.PeepId;
+                guestName.RealNames = _guestListRealNames;
+                guestName.CustomName = customName;
+                guestName.NameFormatted = false;
+                guestName.InList = false;
+            }
+            return guestName;
+        }
+
+        static const std::string& GetFormattedName(GuestName& guestName)
+        {
+            if (!guestName.NameFormatted)
+            {
+                auto peep = GetEntity<Guest>(guestName.Id);
+                guestName.Name = peep != nullptr ? PeepGetCachedName(*peep) : std::string_view();
+                guestName.NameFormatted = true;
+            }
+            return guestName.Name;
+        }
+
         void DrawTabImages(DrawPixelInfo& dpi)
         {
             // Tab 1 image
@@ -687,7 +788,7 @@ static Widget window_guest_list_widgets[] = {
                         continue;
                     }
                     auto ft = Formatter();
-                    peep->FormatNameTo(ft);
+                    ft.Add<StringId>(STR_STRING).Add<const char*>(PeepGetCachedName(*peep).data());
                     DrawTextEllipsised(dpi, { 0, y }, 113, format, ft);
 
                     switch (_selectedView)
@@ -716,8 +817,9 @@ static Widget window_guest_list_widgets[] = {
                                 if (thought.freshness > 5)
                                     break;
 
+                                // The first thought that has not worn off is the one the cache keeps
                                 ft = Formatter();
-                                PeepThoughtSetFormatArgs(&thought, ft);
+                                ft.Add<StringId>(STR_STRING).Add<const char*>(GuestGetCachedThought(*peep).data());
                                 DrawTextEllipsised(dpi, { 118, y }, 329, format, ft, { FontStyle::Small });
                                 break;
                             }
@@ -781,19 +883,14 @@ static Widget window_guest_list_widgets[] = {
             }
         }
 
-        bool GuestShouldBeVisible(const Guest& peep)
+        bool GuestShouldBeVisible(const Guest& peep, GuestName& guestName)
         {
             if (_trackingOnly && !(peep.PeepFlags & PEEP_FLAGS_TRACKING))
                 return false;
 
             if (!_filterName.empty())
             {
-                char name[256]{};
-
-                Formatter ft;
-                peep.FormatNameTo(ft);
-                OpenRCT2::FormatStringLegacy(name, sizeof(name), STR_STRINGID, ft.Data());
-                if (!String::Contains(name, _filterName.c_str(), true))
+                if (!String::Contains(GetFormattedName(guestName), _filterName.c_str(), true))
                 {
                     return false;
                 }
@@ -933,35 +1030,14 @@ static Widget window_guest_list_widgets[] = {
             }
         }
 
-        template<bool TRealNames> static bool CompareGuestItem(const GuestItem& a, const GuestItem& b)
+        bool CompareGuestItem(const GuestItem& a, const GuestItem& b) const
         {
-            const auto* peepA = GetEntity<Peep>(a.Id);
-            const auto* peepB = GetEntity<Peep>(b.Id);
-            if (peepA != nullptr && peepB != nullptr)
+            // Simple ID comparison for when both peeps use a number or a generated name
+            if (!_guestListRealNames && a.Name->CustomName.empty() && b.Name->CustomName.empty())
             {
-                // Compare types
-                if (peepA->Type != peepB->Type)
-                {
-                    return static_cast<int32_t>(peepA->Type) < static_cast<int32_t>(peepB->Type);
-                }
-
-                // Compare name
-                if constexpr (!TRealNames)
-                {
-                    if (peepA->Name == nullptr && peepB->Name == nullptr)
-                    {
-                        // Simple ID comparison for when both peeps use a number or a generated name
-                        return peepA->PeepId < peepB->PeepId;
-                    }
-                }
+                return a.Name->PeepId < b.Name->PeepId;
             }
-            return StrLogicalCmp(a.Name, b.Name) < 0;
-        }
-
-        static GuestItem::CompareFunc GetGuestCompareFunc()
-        {
-            return GetGameState().Park.Flags & PARK_FLAGS_SHOW_REAL_GUEST_NAMES ? CompareGuestItem<true>
-                                                                                : CompareGuestItem<false>;
+            return StrLogicalCmp(GetFormattedName(*a.Name).c_str(), GetFormattedName(*b.Name).c_str()) < 0;
         }
     };
 
@@ -26,6 +26,8 @@
 #include <openrct2/audio/audio.h>
 #include <openrct2/entity/EntityList.h>
 #include <openrct2/entity/EntityRegistry.h>
+#include <openrct2/entity/Guest.h>
+#include <openrct2/entity/GuestHotFields.h>
 #include <openrct2/entity/Staff.h>
 #include <openrct2/localisation/Formatter.h>
 #include <openrct2/localisation/Language.h>
@@ -38,6 +40,7 @@
 #include <openrct2/world/Footpath.h>
 #include <openrct2/world/Scenery.h>
 #include <openrct2/world/Surface.h>
+#include <limits>
 #include <vector>
 
 namespace OpenRCT2::Ui::Windows
@@ -189,6 +192,11 @@ static constexpr ScreenCoordsXY MiniMapOffsets[] = {
         uint8_t _rotation;
         uint8_t _activeTool;
         uint32_t _currentLine;
+        // The whole map image is being redrawn a few lines at a time, otherwise only changed tiles are redrawn
+        bool _redrawingMap{};
+        int16_t _mapImageTab{};
+        std::vector<TileCoordsXY> _changedTiles;
+        std::vector<EntityId> _visibleEntities;
         uint16_t _landRightsToolSize;
         int32_t _firstColumnWidth;
         std::vector<uint8_t> _mapImageData;
@@ -228,6 +236,7 @@ static constexpr ScreenCoordsXY MiniMapOffsets[] = {
             _rotation = GetCurrentRotation();
 
             InitMap();
+            MapSetChangedTilesTracking(true);
             gWindowSceneryRotation = 0;
             CentreMapOnViewPoint();
             FootpathSelectDefault();
@@ -243,6 +252,7 @@ static constexpr ScreenCoordsXY MiniMapOffsets[] = {
         {
             _mapImageData.clear();
             _mapImageData.shrink_to_fit();
+            MapSetChangedTilesTracking(false);
             if ((InputTestFlag(INPUT_FLAG_TOOL_ACTIVE)) && gCurrentToolWidget.window_classification == classification
                 && gCurrentToolWidget.window_number == number)
             {
@@ -394,8 +404,21 @@ static constexpr ScreenCoordsXY MiniMapOffsets[] = {
                 CentreMapOnViewPoint();
             }
 
-            for (int32_t i = 0; i < 16; i++)
+            if (!MapTakeChangedTiles(_changedTiles) || selected_tab != _mapImageTab)
+            {
+                // Redraw over the current image rather than clearing it, so the map does not flash
+                _mapImageTab = selected_tab;
+                _currentLine = 0;
+                _redrawingMap = true;
+            }
+            for (const auto& tilePos : _changedTiles)
+            {
+                SetMapPixel(tilePos);
+            }
+            for (int32_t i = 0; i < 16 && _redrawingMap; i++)
+            {
                 SetMapPixels();
+            }
 
             Invalidate();
 
@@ -995,7 +1018,9 @@ static constexpr ScreenCoordsXY MiniMapOffsets[] = {
         void InitMap()
         {
             std::fill(_mapImageData.begin(), _mapImageData.end(), PALETTE_INDEX_10);
+            _mapImageTab = selected_tab;
             _currentLine = 0;
+            _redrawingMap = true;
         }
 
         void CentreMapOnViewPoint()
@@ -1070,9 +1095,6 @@ static constexpr ScreenCoordsXY MiniMapOffsets[] = {
         {
             int32_t x = 0, y = 0, dx = 0, dy = 0;
 
-            int32_t pos = (_currentLine * (MAP_WINDOW_MAP_SIZE - 1)) + kMaximumMapSizeTechnical - 1;
-            auto destinationPosition = ScreenCoordsXY{ pos % MAP_WINDOW_MAP_SIZE, pos / MAP_WINDOW_MAP_SIZE };
-            auto destination = _mapImageData.data() + (destinationPosition.y * MAP_WINDOW_MAP_SIZE) + destinationPosition.x;
             switch (GetCurrentRotation())
             {
                 case 0:
@@ -1103,31 +1125,62 @@ static constexpr ScreenCoordsXY MiniMapOffsets[] = {
 
             for (int32_t i = 0; i < kMaximumMapSizeTechnical; i++)
             {
-                if (!MapIsEdge({ x, y }))
-                {
-                    uint16_t colour = 0;
-                    switch (selected_tab)
-                    {
-                        case PAGE_PEEPS:
-                            colour = GetPixelColourPeep({ x, y });
-                            break;
-                        case PAGE_RIDES:
-                            colour = GetPixelColourRide({ x, y });
-                            break;
-                    }
-                    destination[0] = (colour >> 8) & 0xFF;
-                    destination[1] = colour;
-                }
+                SetMapPixel(_currentLine, i, { x, y });
                 x += dx;
                 y += dy;
-
-                destinationPosition.x++;
-                destinationPosition.y++;
-                destination = _mapImageData.data() + (destinationPosition.y * MAP_WINDOW_MAP_SIZE) + destinationPosition.x;
             }
             _currentLine++;
             if (_currentLine >= kMaximumMapSizeTechnical)
+            {
                 _currentLine = 0;
+                _redrawingMap = false;
+            }
+        }
+
+        /**
+         * Redraws a single tile, the line and index are the ones SetMapPixels draws the tile at for the current rotation.
+         */
+        void SetMapPixel(const TileCoordsXY& tilePos)
+        {
+            constexpr int32_t last = kMaximumMapSizeTechnical - 1;
+            switch (GetCurrentRotation())
+            {
+                case 0:
+                    SetMapPixel(tilePos.x, tilePos.y, tilePos.ToCoordsXY());
+                    break;
+                case 1:
+                    SetMapPixel(tilePos.y, last - tilePos.x, tilePos.ToCoordsXY());
+                    break;
+                case 2:
+                    SetMapPixel(last - tilePos.x, last - tilePos.y, tilePos.ToCoordsXY());
+                    break;
+                case 3:
+                    SetMapPixel(last - tilePos.y, tilePos.x, tilePos.ToCoordsXY());
+                    break;
+            }
+        }
+
+        void SetMapPixel(int32_t line, int32_t index, const CoordsXY& mapPos)
+        {
+            if (MapIsEdge(mapPos))
+                return;
+
+            uint16_t colour = 0;
+            switch (selected_tab)
+            {
+                case PAGE_PEEPS:
+                    colour = GetPixelColourPeep(mapPos);
+                    break;
+                case PAGE_RIDES:
+                    colour = GetPixelColourRide(mapPos);
+                    break;
+            }
+
+            int32_t pos = (line * (MAP_WINDOW_MAP_SIZE - 1)) + kMaximumMapSizeTechnical - 1;
+            auto destinationPosition = ScreenCoordsXY{ pos % MAP_WINDOW_MAP_SIZE + index, pos / MAP_WINDOW_MAP_SIZE + index };
+            auto destination = _mapImageData.data() + (destinationPosition.y * MAP_WINDOW_MAP_SIZE) + destinationPosition.x;
+            destination[0] = (colour >> 8) & 0xFF;
+            destination[1] = colour;
         }
 
         uint16_t GetPixelColourPeep(const CoordsXY& c)
@@ -1235,28 +1288,55 @@ static constexpr ScreenCoordsXY MiniMapOffsets[] = {
 
         void PaintPeepOverlay(DrawPixelInfo& dpi)
         {
+            // When only part of a big map is in view, look up the peeps there rather than going through all of them
+            auto visibleRange = GetVisibleMapRange(dpi);
+            auto numVisibleTiles = static_cast<size_t>(visibleRange.GetRight() - visibleRange.GetLeft() + COORDS_XY_STEP)
+                * static_cast<size_t>(visibleRange.GetBottom() - visibleRange.GetTop() + COORDS_XY_STEP)
+                / (COORDS_XY_STEP * COORDS_XY_STEP);
+            auto numPeeps = static_cast<size_t>(GetEntityListCount(EntityType::Guest))
+                + GetEntityListCount(EntityType::Staff);
+            if (numVisibleTiles < numPeeps)
+            {
+                auto guestFlashColour = GetGuestFlashColour();
+                auto staffFlashColour = GetStaffFlashColour();
+                _visibleEntities.clear();
+                GetEntityIdsInRange(visibleRange, _visibleEntities);
+                for (auto entityId : _visibleEntities)
+                {
+                    auto* entity = GetEntity(entityId);
+                    if (entity == nullptr)
+                        continue;
+                    if (entity->Is<Guest>())
+                        DrawMapPeepPixel(entity->GetLocation(), EntityGetFlashing(entity), guestFlashColour, dpi);
+                    else if (entity->Is<Staff>())
+                        DrawMapPeepPixel(entity->GetLocation(), EntityGetFlashing(entity), staffFlashColour, dpi);
+                }
+                return;
+            }
+
             auto flashColour = GetGuestFlashColour();
-            for (auto guest : EntityList<Guest>())
+            const auto& guestLocations = GetGuestHotFields().Location;
+            for (auto guestId : GetEntityList(EntityType::Guest))
             {
-                DrawMapPeepPixel(guest, flashColour, dpi);
+                DrawMapPeepPixel(guestLocations[guestId.ToUnderlying()], EntityGetFlashing(guestId), flashColour, dpi);
             }
             flashColour = GetStaffFlashColour();
             for (auto staff : EntityList<Staff>())
             {
-                DrawMapPeepPixel(staff, flashColour, dpi);
+                DrawMapPeepPixel(staff->GetLocation(), EntityGetFlashing(staff), flashColour, dpi);
             }
         }
 
-        void DrawMapPeepPixel(Peep* peep, const uint8_t flashColour, DrawPixelInfo& dpi)
+        void DrawMapPeepPixel(const CoordsXY& loc, bool flashing, const uint8_t flashColour, DrawPixelInfo& dpi)
         {
-            if (peep->x == LOCATION_NULL)
+            if (loc.x == LOCATION_NULL)
                 return;
 
-            MapCoordsXY c = TransformToMapCoords({ peep->x, peep->y });
+            MapCoordsXY c = TransformToMapCoords(loc);
             auto leftTop = ScreenCoordsXY{ c.x, c.y };
             auto rightBottom = leftTop;
             uint8_t colour = DefaultPeepMapColour;
-            if (EntityGetFlashing(peep))
+            if (flashing)
             {
                 colour = flashColour;
                 // If flashing then map peep pixel size is increased (by moving left top downwards)
@@ -1434,6 +1514,64 @@ static constexpr ScreenCoordsXY MiniMapOffsets[] = {
             return { 0, 0 }; // unreachable
         }
 
+        /**
+         * Gets the range of the map shown by the given part of the map image, the inverse of TransformToMapCoords with a
+         * small margin for the larger flashing peep pixels.
+         */
+        MapRange GetVisibleMapRange(const DrawPixelInfo& dpi)
+        {
+            constexpr int32_t last = kMaximumMapSizeTechnical - 1;
+            constexpr int32_t margin = 2;
+
+            int32_t minX = std::numeric_limits<int32_t>::max(), minY = minX;
+            int32_t maxX = std::numeric_limits<int32_t>::min(), maxY = maxX;
+            for (auto corner : { ScreenCoordsXY{ dpi.x, dpi.y }, ScreenCoordsXY{ dpi.x + dpi.width, dpi.y },
+                                 ScreenCoordsXY{ dpi.x, dpi.y + dpi.height },
+                                 ScreenCoordsXY{ dpi.x + dpi.width, dpi.y + dpi.height } })
+            {
+                auto sum = corner.y + 8;
+                auto difference = corner.x - kMaximumMapSizeTechnical + 8;
+                auto x = (sum - difference) / 2;
+                auto y = (sum + difference) / 2;
+                minX = std::min(minX, x);
+                minY = std::min(minY, y);
+                maxX = std::max(maxX, x);
+                maxY = std::max(maxY, y);
+            }
+            minX -= margin;
+            minY -= margin;
+            maxX += margin;
+            maxY += margin;
+
+            // Undo the rotation applied by TransformToMapCoords
+            TileCoordsXY a, b;
+            switch (GetCurrentRotation())
+            {
+                default:
+                case 0:
+                    a = { minX, minY };
+                    b = { maxX, maxY };
+                    break;
+                case 1:
+                    a = { last - minY, minX };
+                    b = { last - maxY, maxX };
+                    break;
+                case 2:
+                    a = { last - minX, last - minY };
+                    b = { last - maxX, last - maxY };
+                    break;
+                case 3:
+                    a = { minY, last - minX };
+                    b = { maxY, last - maxX };
+                    break;
+            }
+            auto left = std::clamp(std::min(a.x, b.x), 0, last);
+            auto right = std::clamp(std::max(a.x, b.x), 0, last);
+            auto top = std::clamp(std::min(a.y, b.y), 0, last);
+            auto bottom = std::clamp(std::max(a.y, b.y), 0, last);
+            return MapRange(left * COORDS_XY_STEP, top * COORDS_XY_STEP, right * COORDS_XY_STEP, bottom * COORDS_XY_STEP);
+        }
+
         MapCoordsXY TransformToMapCoords(CoordsXY c)
         {
             int32_t x = c.x, y = c.y;
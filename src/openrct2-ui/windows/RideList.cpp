@@ -163,6 +163,7 @@ static Widget _rideListWidgets[] = {
     private:
         bool _quickDemolishMode = false;
         int32_t _windowRideListInformationType = INFORMATION_TYPE_STATUS;
+        uint32_t _lastDrawnTick = 0;
 
         struct RideListEntry
         {
@@ -376,8 +377,14 @@ static Widget _rideListWidgets[] = {
         {
             frame_no = (frame_no + 1) % 64;
             WidgetInvalidate(*this, WIDX_TAB_1 + page);
-            if (_windowRideListInformationType != INFORMATION_TYPE_STATUS)
+
+            // The statistics only change when the game ticks, frames rendered in between (or while paused) can skip it
+            const auto currentTicks = GetGameState().CurrentTicks;
+            if (_windowRideListInformationType != INFORMATION_TYPE_STATUS && currentTicks != _lastDrawnTick)
+            {
+                _lastDrawnTick = currentTicks;
                 Invalidate();
+            }
         }
 
         /**
@@ -25,7 +25,6 @@
 #    include <openrct2/platform/Platform.h>
 #    include <openrct2/sprites.h>
 #    include <openrct2/util/Util.h>
-#    include <tuple>
 
 namespace OpenRCT2::Ui::Windows
 {
@@ -82,7 +81,9 @@ static Widget _serverListWidgets[] = {
     private:
         u8string _playerName;
         ServerList _serverList;
-        std::future<std::tuple<std::vector<ServerListEntry>, StringId>> _fetchFuture;
+        // LAN and internet servers are fetched independently, each is listed as soon as it arrives
+        std::future<std::vector<ServerListEntry>> _fetchLocalFuture;
+        std::future<std::vector<ServerListEntry>> _fetchOnlineFuture;
         uint32_t _numPlayersOnline = 0;
         StringId _statusText = STR_SERVER_LIST_CONNECTING;
 
@@ -119,7 +120,8 @@ static Widget _serverListWidgets[] = {
         void OnClose() override
         {
             _serverList = {};
-            _fetchFuture = {};
+            _fetchLocalFuture = {};
+            _fetchOnlineFuture = {};
             ConfigSaveDefault();
         }
 
@@ -435,7 +437,7 @@ static Widget _serverListWidgets[] = {
     private:
         void ServerListFetchServersBegin()
         {
-            if (_fetchFuture.valid())
+            if (_fetchLocalFuture.valid() || _fetchOnlineFuture.valid())
             {
                 // A fetch is already in progress
                 return;
@@ -445,75 +447,63 @@ static Widget _serverListWidgets[] = {
             _serverList.ReadAndAddFavourites();
             _statusText = STR_SERVER_LIST_CONNECTING;
 
-            _fetchFuture = std::async(std::launch::async, [this] {
-                // Spin off background fetches
-                auto lanF = _serverList.FetchLocalServerListAsync();
-                auto wanF = _serverList.FetchOnlineServerListAsync();
+            _fetchLocalFuture = _serverList.FetchLocalServerListAsync();
+            _fetchOnlineFuture = _serverList.FetchOnlineServerListAsync();
+            if (!_fetchOnlineFuture.valid())
+            {
+                // Fetching online servers is not available in this build
+                _statusText = STR_SERVER_LIST_NO_CONNECTION;
+            }
+        }
+
+        static bool IsFetchReady(const std::future<std::vector<ServerListEntry>>& future)
+        {
+            return future.valid() && future.wait_for(std::chrono::seconds::zero()) == std::future_status::ready;
+        }
 
-                // Merge or deal with errors
-                std::vector<ServerListEntry> allEntries;
+        void ServerListFetchServersCheck()
+        {
+            bool listChanged = false;
+            if (IsFetchReady(_fetchLocalFuture))
+            {
                 try
                 {
-                    auto entries = lanF.get();
-                    allEntries.reserve(entries.size());
-                    allEntries.insert(allEntries.end(), entries.begin(), entries.end());
+                    _serverList.AddOrUpdateRange(_fetchLocalFuture.get());
+                    listChanged = true;
                 }
                 // TODO: Stop catching all exceptions
                 catch (...)
                 {
                 }
+                _fetchLocalFuture = {};
+                Invalidate();
+            }
 
-                auto status = STR_NONE;
+            if (IsFetchReady(_fetchOnlineFuture))
+            {
                 try
                 {
-                    auto entries = wanF.get();
-                    allEntries.reserve(allEntries.capacity() + entries.size());
-                    allEntries.insert(allEntries.end(), entries.begin(), entries.end());
+                    _serverList.AddOrUpdateRange(_fetchOnlineFuture.get());
+                    listChanged = true;
+                    _statusText = STR_X_PLAYERS_ONLINE;
                 }
                 catch (const MasterServerException& e)
                 {
-                    status = e.StatusText;
+                    _statusText = e.StatusText;
                 }
-                // TODO: Stop catching all exceptions
-                catch (...)
+                catch (const std::exception& e)
                 {
-                    status = STR_SERVER_LIST_NO_CONNECTION;
+                    _statusText = STR_SERVER_LIST_NO_CONNECTION;
+                    LOG_WARNING("Unable to connect to master server: %s", e.what());
                 }
-                return std::make_tuple(allEntries, status);
-            });
-        }
+                _fetchOnlineFuture = {};
+                Invalidate();
+            }
 
-        void ServerListFetchServersCheck()
-        {
-            if (_fetchFuture.valid())
+            if (listChanged)
             {
-                auto status = _fetchFuture.wait_for(std::chrono::seconds::zero());
-                if (status == std::future_status::ready)
-                {
-                    try
-                    {
-                        auto [entries, statusText] = _fetchFuture.get();
-                        _serverList.AddOrUpdateRange(entries);
-                        _serverList.WriteFavourites(); // Update favourites in case favourited server info changes
-                        _numPlayersOnline = _serverList.GetTotalPlayerCount();
-                        _statusText = STR_X_PLAYERS_ONLINE;
-                        if (statusText != STR_NONE)
-                        {
-                            _statusText = statusText;
-                        }
-                    }
-                    catch (const MasterServerException& e)
-                    {
-                        _statusText = e.StatusText;
-                    }
-                    catch (const std::exception& e)
-                    {
-                        _statusText = STR_SERVER_LIST_NO_CONNECTION;
-                        LOG_WARNING("Unable to connect to master server: %s", e.what());
-                    }
-                    _fetchFuture = {};
-                    Invalidate();
-                }
+                _serverList.WriteFavourites(); // Update favourites in case favourited server info changes
+                _numPlayersOnline = _serverList.GetTotalPlayerCount();
             }
         }
 
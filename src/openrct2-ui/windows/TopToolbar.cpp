@@ -41,6 +41,7 @@
 #include <openrct2/actions/LoadOrQuitAction.h>
 #include <openrct2/actions/PauseToggleAction.h>
 #include <openrct2/actions/SmallSceneryPlaceAction.h>
+#include <openrct2/actions/SmallSceneryPlaceBatchAction.h>
 #include <openrct2/actions/SmallScenerySetColourAction.h>
 #include <openrct2/actions/SurfaceSetStyleAction.h>
 #include <openrct2/actions/WallPlaceAction.h>
@@ -2214,7 +2215,7 @@ static Widget _topToolbarWidgets[] = {
                         }
                     }
 
-                    bool forceError = true;
+                    std::vector<SmallSceneryPlaceBatchEntry> batch;
                     for (int32_t q = 0; q < quantity; q++)
                     {
                         int32_t zCoordinate = gSceneryPlaceZ;
@@ -2276,32 +2277,44 @@ static Widget _topToolbarWidgets[] = {
                             }
                         }
 
-                        // Actually place
-                        if (success == GameActions::Status::Ok || ((q + 1 == quantity) && forceError))
+                        // Pieces that can not be placed are still sent if nothing else can, so the error is shown
+                        if (success == GameActions::Status::Ok || ((q + 1 == quantity) && batch.empty()))
                         {
-                            auto smallSceneryPlaceAction = SmallSceneryPlaceAction(
-                                { cur_grid_x, cur_grid_y, gSceneryPlaceZ, gSceneryPlaceRotation }, quadrant, selectedScenery,
-                                gWindowSceneryPrimaryColour, gWindowScenerySecondaryColour, gWindowSceneryTertiaryColour);
+                            batch.push_back({ { cur_grid_x, cur_grid_y, gSceneryPlaceZ, gSceneryPlaceRotation }, quadrant });
+                        }
+                        gSceneryPlaceZ = zCoordinate;
+                        if (success == GameActions::Status::InsufficientFunds)
+                        {
+                            break;
+                        }
+                    }
 
-                            smallSceneryPlaceAction.SetCallback([=](const GameAction* ga, const GameActions::Result* result) {
-                                if (result->Error == GameActions::Status::Ok)
-                                {
-                                    OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::PlaceItem, result->Position);
-                                }
-                            });
-                            auto res = GameActions::Execute(&smallSceneryPlaceAction);
-                            if (res.Error == GameActions::Status::Ok)
-                            {
-                                forceError = false;
-                            }
+                    if (batch.empty())
+                        break;
 
-                            if (res.Error == GameActions::Status::InsufficientFunds)
-                            {
-                                break;
-                            }
+                    auto onPlaced = [](const GameAction* ga, const GameActions::Result* result) {
+                        if (result->Error == GameActions::Status::Ok)
+                        {
+                            OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::PlaceItem, result->Position);
                         }
-                        gSceneryPlaceZ = zCoordinate;
+                    };
+                    if (!isCluster)
+                    {
+                        const auto& entry = batch.front();
+                        auto smallSceneryPlaceAction = SmallSceneryPlaceAction(
+                            entry.Loc, entry.Quadrant, selectedScenery, gWindowSceneryPrimaryColour,
+                            gWindowScenerySecondaryColour, gWindowSceneryTertiaryColour);
+                        smallSceneryPlaceAction.SetCallback(onPlaced);
+                        GameActions::Execute(&smallSceneryPlaceAction);
+                        break;
                     }
+
+                    // Scatter the whole cluster with a single action rather than one per piece
+                    auto batchAction = SmallSceneryPlaceBatchAction(
+                        std::move(batch), selectedScenery, gWindowSceneryPrimaryColour, gWindowScenerySecondaryColour,
+                        gWindowSceneryTertiaryColour);
+                    batchAction.SetCallback(onPlaced);
+                    GameActions::Execute(&batchAction);
                     break;
                 }
                 case SCENERY_TYPE_PATH_ITEM:
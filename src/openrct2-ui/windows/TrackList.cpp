@@ -16,6 +16,8 @@
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/audio/audio.h>
 #include <openrct2/config/Config.h>
+#include <openrct2/core/FNV1aLanes.hpp>
+#include <openrct2/core/File.h>
 #include <openrct2/core/String.hpp>
 #include <openrct2/drawing/IDrawingEngine.h>
 #include <openrct2/localisation/Formatter.h>
@@ -68,6 +70,15 @@ static Widget _trackListWidgets[] = {
     // clang-format on
 
     constexpr uint16_t TRACK_DESIGN_INDEX_UNLOADED = UINT16_MAX;
+    constexpr size_t kTrackPreviewCacheSize = 16;
+
+    struct TrackPreviewCacheEntry
+    {
+        uint64_t FileHash;
+        std::vector<uint8_t> Pixels;
+        money64 Cost;
+        uint8_t TrackFlags;
+    };
 
     RideSelection _window_track_list_item;
 
@@ -80,6 +91,9 @@ static Widget _trackListWidgets[] = {
         uint16_t _loadedTrackDesignIndex;
         std::unique_ptr<TrackDesign> _loadedTrackDesign;
         std::vector<uint8_t> _trackDesignPreviewPixels;
+        // Most recently shown previews first. Drawing a preview stashes the map and places the whole design, so moving
+        // back and forth over the list reuses the previews already drawn.
+        std::vector<TrackPreviewCacheEntry> _previewCache;
         bool _selectedItemIsBeingUpdated;
         bool _reloadTrackDesigns;
 
@@ -200,12 +214,41 @@ static Widget _trackListWidgets[] = {
         bool LoadDesignPreview(const u8string& path)
         {
             _loadedTrackDesign = TrackDesignImport(path.c_str());
-            if (_loadedTrackDesign != nullptr)
+            if (_loadedTrackDesign == nullptr)
+            {
+                return false;
+            }
+
+            // Keyed by the file contents so a design that was changed on disk is drawn again
+            Crypt::FNV1aLanes hasher;
+            const auto fileData = File::ReadAllBytes(path);
+            hasher.Update(fileData.data(), fileData.size());
+            const auto fileHash = hasher.Finish();
+
+            auto it = std::find_if(_previewCache.begin(), _previewCache.end(), [fileHash](const auto& entry) {
+                return entry.FileHash == fileHash;
+            });
+            if (it != _previewCache.end())
             {
-                TrackDesignDrawPreview(_loadedTrackDesign.get(), _trackDesignPreviewPixels.data());
+                std::rotate(_previewCache.begin(), it, it + 1);
+                const auto& entry = _previewCache.front();
+                _trackDesignPreviewPixels = entry.Pixels;
+                _loadedTrackDesign->cost = entry.Cost;
+                _loadedTrackDesign->track_flags = entry.TrackFlags;
                 return true;
             }
-            return false;
+
+            TrackDesignDrawPreview(_loadedTrackDesign.get(), _trackDesignPreviewPixels.data());
+
+            if (_previewCache.size() >= kTrackPreviewCacheSize)
+            {
+                _previewCache.pop_back();
+            }
+            _previewCache.insert(
+                _previewCache.begin(),
+                TrackPreviewCacheEntry{ fileHash, _trackDesignPreviewPixels, _loadedTrackDesign->cost,
+                                        _loadedTrackDesign->track_flags });
+            return true;
         }
 
     public:
@@ -255,6 +298,7 @@ static Widget _trackListWidgets[] = {
             _loadedTrackDesign = nullptr;
             _trackDesignPreviewPixels.clear();
             _trackDesignPreviewPixels.shrink_to_fit();
+            _previewCache.clear();
 
             // Dispose track list
             _trackDesigns.clear();
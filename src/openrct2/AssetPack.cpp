@@ -134,6 +134,11 @@ public:
         return true;
     }
 
+    std::string_view GetImageCacheKey() override
+    {
+        return {};
+    }
+
     std::vector<uint8_t> GetData(std::string_view path) override
     {
         return _zipArchive->GetFileData(path);
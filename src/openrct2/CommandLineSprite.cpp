@@ -553,6 +553,9 @@ int32_t CommandLineForSprite(const char** argv, int32_t argc)
 
         json_t sprite_description;
 
+        // Validate the whole description first, then import all images at once and add them in description order
+        std::vector<ImageImporter::BatchSource> sources;
+
         // Note: jsonSprite is deliberately left non-const: json_t behaviour changes when const
         for (auto& [jsonKey, jsonSprite] : jsonSprites.items())
         {
@@ -574,10 +577,18 @@ int32_t CommandLineForSprite(const char** argv, int32_t argc)
             meta.importMode = gSpriteMode;
 
             auto imagePath = Path::GetAbsolute(Path::Combine(directoryPath, strPath));
+            sources.push_back({ imagePath, meta });
+        }
 
-            auto importResult = SpriteImageImport(imagePath, meta);
+        ImageImporter importer;
+        auto importResults = importer.ImportFiles(sources);
+        for (size_t i = 0; i < importResults.size(); i++)
+        {
+            auto& importResult = importResults[i].Result;
+            const auto& imagePath = sources[i].Path;
             if (importResult == std::nullopt)
             {
+                fprintf(stderr, "%s\n", importResults[i].Error.c_str());
                 fprintf(stderr, "Could not import image file: %s\nCanceling\n", imagePath.c_str());
                 return -1;
             }
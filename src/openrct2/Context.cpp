@@ -61,6 +61,8 @@
 #include "platform/Crash.h"
 #include "platform/Platform.h"
 #include "profiling/Profiling.h"
+#include "profiling/FramePacing.h"
+#include "profiling/Telemetry.h"
 #include "rct2/RCT2.h"
 #include "ride/TrackData.h"
 #include "ride/TrackDesignRepository.h"
@@ -107,6 +109,9 @@ namespace OpenRCT2
         std::unique_ptr<IObjectManager> _objectManager;
         std::unique_ptr<ITrackDesignRepository> _trackDesignRepository;
         std::unique_ptr<IScenarioRepository> _scenarioRepository;
+        // Track design and scenario scans which run in the background during start up.
+        std::shared_future<void> _trackDesignScanTask;
+        std::shared_future<void> _scenarioScanTask;
         std::unique_ptr<IReplayManager> _replayManager;
         std::unique_ptr<IGameStateSnapshots> _gameStateSnapshots;
         std::unique_ptr<AssetPackManager> _assetPackManager;
@@ -177,6 +182,10 @@ namespace OpenRCT2
             // NOTE: We must shutdown all systems here before Instance is set back to null.
             //       If objects use GetContext() in their destructor things won't go well.
 
+            WaitForScanTask(_trackDesignScanTask);
+            WaitForScanTask(_scenarioScanTask);
+            ScenarioWaitForBackgroundSave();
+
 #ifdef ENABLE_SCRIPTING
             _scriptEngine.StopUnloadRegisterAllPlugins();
 #endif
@@ -242,11 +251,13 @@ namespace OpenRCT2
 
         ITrackDesignRepository* GetTrackDesignRepository() override
         {
+            WaitForScanTask(_trackDesignScanTask);
             return _trackDesignRepository.get();
         }
 
         IScenarioRepository* GetScenarioRepository() override
         {
+            WaitForScanTask(_scenarioScanTask);
             return _scenarioRepository.get();
         }
 
@@ -428,10 +439,20 @@ namespace OpenRCT2
 
             EnsureUserContentDirectoriesExist();
 
+            // Track designs and scenarios are not required until the player opens a window that lists them, scan
+            // them in the background while the objects load and the title screen starts. Anything requesting
+            // either repository will wait for its scan to complete.
+            const auto language = _localisationService->GetCurrentLanguage();
+            _trackDesignScanTask = std::async(std::launch::async, [this, language]() {
+                ScanRepository("track designs", *_trackDesignRepository, language);
+            });
+            _scenarioScanTask = std::async(
+                std::launch::async, [this, language]() { ScanRepository("scenarios", *_scenarioRepository, language); });
+
             // TODO Ideally we want to delay this until we show the title so that we can
             //      still open the game window and draw a progress screen for the creation
             //      of the object cache.
-            _objectRepository->LoadOrConstruct(_localisationService->GetCurrentLanguage());
+            _objectRepository->LoadOrConstruct(language);
 
             if (!gOpenRCT2Headless)
             {
@@ -440,12 +461,6 @@ namespace OpenRCT2
                 _assetPackManager->Reload();
             }
 
-            // TODO Like objects, this can take a while if there are a lot of track designs
-            //      its also really something really we might want to do in the background
-            //      as its not required until the player wants to place a new ride.
-            _trackDesignRepository->Scan(_localisationService->GetCurrentLanguage());
-
-            _scenarioRepository->Scan(_localisationService->GetCurrentLanguage());
             TitleSequenceManager::Scan();
 
             if (!gOpenRCT2Headless)
@@ -566,6 +581,9 @@ namespace OpenRCT2
                 }
             } crash_additional_file_registration(path);
 
+            // The park may be an autosave that is still being written
+            ScenarioWaitForBackgroundSave();
+
             try
             {
                 if (String::IEquals(Path::GetExtension(path), ".sea"))
@@ -797,6 +815,29 @@ namespace OpenRCT2
         }
 
     private:
+        template<typename TRepository>
+        static void ScanRepository(const char* name, TRepository& repository, int32_t language)
+        {
+            try
+            {
+                repository.Scan(language);
+            }
+            catch (const std::exception& e)
+            {
+                Console::Error::WriteLine("Unable to scan %s: %s", name, e.what());
+            }
+        }
+
+        // The repositories can be requested from several threads at once, each waits on its own copy of the task.
+        static void WaitForScanTask(const std::shared_future<void>& task)
+        {
+            auto waitTask = task;
+            if (waitTask.valid())
+            {
+                waitTask.wait();
+            }
+        }
+
         bool HasObjectsThatUseFallbackImages()
         {
             for (auto objectType : ObjectTypes)
@@ -1052,6 +1093,7 @@ namespace OpenRCT2
             PROFILED_FUNCTION();
 
             const auto deltaTime = _timer.GetElapsedTimeAndRestart().count();
+            Telemetry::RecordFrame(deltaTime * 1000.0f);
 
             // Make sure we catch the state change and reset it.
             bool useVariableFrame = ShouldRunVariableFrame();
@@ -1098,11 +1140,13 @@ namespace OpenRCT2
             PROFILED_FUNCTION();
 
             _uiContext->ProcessMessages();
+            FramePacing::EndPhase(FramePacing::Phase::Events);
 
             if (_ticksAccumulator < kGameUpdateTimeMS)
             {
                 const auto sleepTimeSec = (kGameUpdateTimeMS - _ticksAccumulator);
                 Platform::Sleep(static_cast<uint32_t>(sleepTimeSec * 1000.f));
+                FramePacing::EndPhase(FramePacing::Phase::Sleep);
                 return;
             }
 
@@ -1112,9 +1156,11 @@ namespace OpenRCT2
 
                 _ticksAccumulator -= kGameUpdateTimeMS;
             }
+            FramePacing::EndPhase(FramePacing::Phase::GameTicks);
 
             ContextHandleInput();
             WindowUpdateAll();
+            FramePacing::EndPhase(FramePacing::Phase::UiUpdate);
 
             if (ShouldDraw())
             {
@@ -1130,6 +1176,7 @@ namespace OpenRCT2
             auto& tweener = EntityTweener::Get();
 
             _uiContext->ProcessMessages();
+            FramePacing::EndPhase(FramePacing::Phase::Events);
 
             while (_ticksAccumulator >= kGameUpdateTimeMS)
             {
@@ -1144,10 +1191,17 @@ namespace OpenRCT2
                 // Get the next position of each sprite
                 if (shouldDraw)
                     tweener.PostTick();
+
+                // When catching up after a slow tick, draw what we have instead of running every owed tick first.
+                // The remaining time stays in the accumulator and is worked off over the next frames.
+                if (shouldDraw && _timer.GetElapsedTime().count() >= kGameUpdateFrameBudget)
+                    break;
             }
+            FramePacing::EndPhase(FramePacing::Phase::GameTicks);
 
             ContextHandleInput();
             WindowUpdateAll();
+            FramePacing::EndPhase(FramePacing::Phase::UiUpdate);
 
             if (shouldDraw)
             {
@@ -1162,9 +1216,12 @@ namespace OpenRCT2
         {
             PROFILED_FUNCTION();
 
+            ViewportsFlushInvalidations();
             _drawingEngine->BeginDraw();
             _painter->Paint(*_drawingEngine);
+            FramePacing::EndPhase(FramePacing::Phase::Paint);
             _drawingEngine->EndDraw();
+            FramePacing::RecordPresent(_variableFrame);
         }
 
         void Tick()
@@ -1203,11 +1260,16 @@ namespace OpenRCT2
 #endif
 
             ChatUpdate();
+#ifndef DISABLE_HTTP
+            Http::Update();
+#endif
 #ifdef ENABLE_SCRIPTING
             _scriptEngine.Tick();
 #endif
             _stdInOutConsole.ProcessEvalQueue();
             _uiContext->Tick();
+
+            ViewportsFlushInvalidations();
         }
 
         /**
@@ -1509,6 +1571,11 @@ WindowBase* ContextOpenIntent(Intent* intent)
 
 void ContextBroadcastIntent(Intent* intent)
 {
+    // Intents from the simulation only refresh windows. Still delivered while presentation is suspended, windows may
+    // rebuild their data on them.
+    if (gOpenRCT2Headless)
+        return;
+
     auto windowManager = GetContext()->GetUiContext()->GetWindowManager();
     windowManager->BroadcastIntent(*intent);
 }
@@ -181,6 +181,8 @@ namespace
     constexpr float kGameUpdateTimeMS = 1.0f / kGameUpdateFPS;
     // The maximum threshold to advance.
     constexpr float kGameUpdateMaxThreshold = kGameUpdateTimeMS * kGameMaxUpdates;
+    // How long a variable frame may spend on ticks before it draws and leaves the rest for the next frame.
+    constexpr float kGameUpdateFrameBudget = kGameUpdateTimeMS;
 }; // namespace
 
 constexpr float kGameMinTimeScale = 0.1f;
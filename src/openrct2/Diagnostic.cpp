@@ -13,8 +13,11 @@
 #include "core/String.hpp"
 #include "util/Util.h"
 
+#include <atomic>
 #include <cstdarg>
 #include <cstdio>
+#include <mutex>
+#include <thread>
 
 #ifdef __ANDROID__
 #    include <android/log.h>
@@ -25,6 +28,32 @@ bool _log_levels[EnumValue(DiagnosticLevel::Count)] = {
     true, true, true, false, true,
 };
 
+static std::atomic<bool> _categoriesEnabled[EnumValue(DiagnosticCategory::Count)] = {
+    true,  // Network
+    false, // Pathfinding
+};
+
+static constexpr const char* _categoryNames[] = {
+    "network",
+    "pathfinding",
+};
+static_assert(std::size(_categoryNames) == EnumValue(DiagnosticCategory::Count));
+
+bool DiagnosticIsCategoryEnabled(DiagnosticCategory category)
+{
+    return _categoriesEnabled[EnumValue(category)].load(std::memory_order_relaxed);
+}
+
+void DiagnosticSetCategoryEnabled(DiagnosticCategory category, bool enabled)
+{
+    _categoriesEnabled[EnumValue(category)].store(enabled, std::memory_order_relaxed);
+}
+
+const char* DiagnosticGetCategoryName(DiagnosticCategory category)
+{
+    return _categoryNames[EnumValue(category)];
+}
+
 static FILE* diagnostic_get_stream(DiagnosticLevel level)
 {
     switch (level)
@@ -55,6 +84,27 @@ void DiagnosticLog(DiagnosticLevel diagnosticLevel, const char* format, ...)
     va_end(args);
 }
 
+void DiagnosticLogCategory(DiagnosticCategory category, DiagnosticLevel diagnosticLevel, const char* format, ...)
+{
+    va_list args;
+
+    if (!_log_levels[EnumValue(diagnosticLevel)] || !DiagnosticIsCategoryEnabled(category))
+        return;
+
+    va_start(args, format);
+    __android_log_vprint(
+        _android_log_priority[EnumValue(diagnosticLevel)], DiagnosticGetCategoryName(category), format, args);
+    va_end(args);
+}
+
+void DiagnosticSetAsync([[maybe_unused]] bool async)
+{
+}
+
+void DiagnosticFlush()
+{
+}
+
 void DiagnosticLogWithLocation(
     DiagnosticLevel diagnosticLevel, const char* file, const char* function, int32_t line, const char* format, ...)
 {
@@ -77,13 +127,170 @@ static constexpr const char* _level_strings[] = {
     "FATAL", "ERROR", "WARNING", "VERBOSE", "INFO",
 };
 
-static void DiagnosticPrint(DiagnosticLevel level, const std::string& prefix, const std::string& msg)
+static void DiagnosticWrite(DiagnosticLevel level, const std::string& line)
 {
     auto stream = diagnostic_get_stream(level);
     if (stream == stdout)
-        Console::WriteLine("%s%s", prefix.c_str(), msg.c_str());
+        Console::WriteLine("%s", line.c_str());
     else
-        Console::Error::WriteLine("%s%s", prefix.c_str(), msg.c_str());
+        Console::Error::WriteLine("%s", line.c_str());
+}
+
+/**
+ * Hands formatted messages to a background thread for writing. Any thread can push without taking a lock, using an
+ * intrusive multi-producer single-consumer list (Vyukov); popping is guarded by a mutex so that DiagnosticFlush can
+ * drain the queue as well as the writer thread.
+ */
+class DiagnosticWriter
+{
+private:
+    struct Message
+    {
+        std::atomic<Message*> Next{};
+        DiagnosticLevel Level{};
+        std::string Line;
+    };
+
+    Message _stub;
+    std::atomic<Message*> _head{ &_stub };
+    Message* _tail = &_stub;
+    std::mutex _popMutex;
+
+    // Bumped after every push, the writer thread sleeps on it.
+    std::atomic<uint32_t> _pushCount{};
+    std::atomic<bool> _stopping{};
+    std::thread _thread;
+    std::once_flag _startFlag;
+
+    void Link(Message* message)
+    {
+        message->Next.store(nullptr, std::memory_order_relaxed);
+        auto* prev = _head.exchange(message, std::memory_order_acq_rel);
+        prev->Next.store(message, std::memory_order_release);
+    }
+
+    // Must hold _popMutex. Returns nullptr when empty, or when a push is half way through.
+    Message* Pop()
+    {
+        auto* tail = _tail;
+        auto* next = tail->Next.load(std::memory_order_acquire);
+        if (tail == &_stub)
+        {
+            if (next == nullptr)
+                return nullptr;
+            _tail = next;
+            tail = next;
+            next = next->Next.load(std::memory_order_acquire);
+        }
+        if (next != nullptr)
+        {
+            _tail = next;
+            return tail;
+        }
+        if (tail != _head.load(std::memory_order_acquire))
+            return nullptr;
+
+        // Re-add the stub so the last message can be taken off the list.
+        Link(&_stub);
+        next = tail->Next.load(std::memory_order_acquire);
+        if (next != nullptr)
+        {
+            _tail = next;
+            return tail;
+        }
+        return nullptr;
+    }
+
+    void Run()
+    {
+        while (true)
+        {
+            auto seenCount = _pushCount.load(std::memory_order_acquire);
+            Drain();
+            if (_stopping.load(std::memory_order_acquire))
+                break;
+            _pushCount.wait(seenCount, std::memory_order_acquire);
+        }
+        Drain();
+    }
+
+public:
+    ~DiagnosticWriter()
+    {
+        Stop();
+    }
+
+    void Push(DiagnosticLevel level, std::string&& line)
+    {
+        std::call_once(_startFlag, [this]() { _thread = std::thread([this]() { Run(); }); });
+
+        auto* message = new Message();
+        message->Level = level;
+        message->Line = std::move(line);
+        Link(message);
+
+        _pushCount.fetch_add(1, std::memory_order_release);
+        _pushCount.notify_one();
+    }
+
+    void Drain()
+    {
+        std::lock_guard<std::mutex> lock(_popMutex);
+        while (auto* message = Pop())
+        {
+            DiagnosticWrite(message->Level, message->Line);
+            delete message;
+        }
+    }
+
+    void Stop()
+    {
+        if (_thread.joinable())
+        {
+            _stopping.store(true, std::memory_order_release);
+            _pushCount.fetch_add(1, std::memory_order_release);
+            _pushCount.notify_one();
+            _thread.join();
+        }
+        Drain();
+    }
+};
+
+// Created on first use so that logging during static initialisation is safe.
+static DiagnosticWriter& GetDiagnosticWriter()
+{
+    static DiagnosticWriter writer;
+    return writer;
+}
+
+static std::atomic<bool> _diagnosticAsync{ true };
+
+void DiagnosticSetAsync(bool async)
+{
+    _diagnosticAsync.store(async, std::memory_order_relaxed);
+    if (!async)
+    {
+        GetDiagnosticWriter().Drain();
+    }
+}
+
+void DiagnosticFlush()
+{
+    GetDiagnosticWriter().Drain();
+}
+
+static void DiagnosticPrint(DiagnosticLevel level, const std::string& prefix, const std::string& msg)
+{
+    if (level != DiagnosticLevel::Fatal && _diagnosticAsync.load(std::memory_order_relaxed))
+    {
+        GetDiagnosticWriter().Push(level, prefix + msg);
+    }
+    else
+    {
+        // Keep the order with anything logged before, a fatal error is likely the last thing written.
+        GetDiagnosticWriter().Drain();
+        DiagnosticWrite(level, prefix + msg);
+    }
 }
 
 void DiagnosticLog(DiagnosticLevel diagnosticLevel, const char* format, ...)
@@ -103,6 +310,24 @@ void DiagnosticLog(DiagnosticLevel diagnosticLevel, const char* format, ...)
     }
 }
 
+void DiagnosticLogCategory(DiagnosticCategory category, DiagnosticLevel diagnosticLevel, const char* format, ...)
+{
+    va_list args;
+    if (_log_levels[EnumValue(diagnosticLevel)] && DiagnosticIsCategoryEnabled(category))
+    {
+        // Level and category
+        auto prefix = String::StdFormat(
+            "%s [%s]: ", _level_strings[EnumValue(diagnosticLevel)], DiagnosticGetCategoryName(category));
+
+        // Message
+        va_start(args, format);
+        auto msg = String::Format_VA(format, args);
+        va_end(args);
+
+        DiagnosticPrint(diagnosticLevel, prefix, msg);
+    }
+}
+
 void DiagnosticLogWithLocation(
     DiagnosticLevel diagnosticLevel, const char* file, const char* function, int32_t line, const char* format, ...)
 {
@@ -21,6 +21,17 @@ enum class DiagnosticLevel
     Count
 };
 
+/**
+ * Groups of diagnostics that can be switched on and off at runtime, independent of the levels. Messages logged with a
+ * category are only printed when both their level and their category are enabled.
+ */
+enum class DiagnosticCategory : uint8_t
+{
+    Network,
+    Pathfinding,
+    Count
+};
+
 /**
  * Compile-time debug levels.
  *
@@ -71,9 +82,22 @@ enum class DiagnosticLevel
 extern bool _log_levels[static_cast<uint8_t>(DiagnosticLevel::Count)];
 
 void DiagnosticLog(DiagnosticLevel diagnosticLevel, const char* format, ...);
+void DiagnosticLogCategory(DiagnosticCategory category, DiagnosticLevel diagnosticLevel, const char* format, ...);
 void DiagnosticLogWithLocation(
     DiagnosticLevel diagnosticLevel, const char* file, const char* function, int32_t line, const char* format, ...);
 
+bool DiagnosticIsCategoryEnabled(DiagnosticCategory category);
+void DiagnosticSetCategoryEnabled(DiagnosticCategory category, bool enabled);
+const char* DiagnosticGetCategoryName(DiagnosticCategory category);
+
+/**
+ * When enabled, which is the default, messages are handed to a background thread that writes them out so the logging
+ * thread doesn't wait on the console. Fatal messages are always written straight away, after anything still queued.
+ */
+void DiagnosticSetAsync(bool async);
+// Blocks until every queued message has been written.
+void DiagnosticFlush();
+
 #ifdef _MSC_VER
 #    define DIAGNOSTIC_LOG_MACRO(level, format, ...)                                                                           \
         DiagnosticLogWithLocation(level, __FILE__, __FUNCTION__, __LINE__, format, ##__VA_ARGS__)
@@ -87,3 +111,7 @@ void DiagnosticLogWithLocation(
 #define LOG_WARNING(format, ...) DIAGNOSTIC_LOG_MACRO(DiagnosticLevel::Warning, format, ##__VA_ARGS__)
 #define LOG_VERBOSE(format, ...) DiagnosticLog(DiagnosticLevel::Verbose, format, ##__VA_ARGS__)
 #define LOG_INFO(format, ...) DIAGNOSTIC_LOG_MACRO(DiagnosticLevel::Information, format, ##__VA_ARGS__)
+#define LOG_VERBOSE_CATEGORY(category, format, ...)                                                                            \
+    DiagnosticLogCategory(category, DiagnosticLevel::Verbose, format, ##__VA_ARGS__)
+#define LOG_INFO_CATEGORY(category, format, ...)                                                                               \
+    DiagnosticLogCategory(category, DiagnosticLevel::Information, format, ##__VA_ARGS__)
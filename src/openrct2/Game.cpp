@@ -46,6 +46,7 @@
 #include "object/ObjectList.h"
 #include "object/WaterEntry.h"
 #include "platform/Platform.h"
+#include "profiling/Profiling.h"
 #include "ride/Ride.h"
 #include "ride/RideRatings.h"
 #include "ride/Station.h"
@@ -347,59 +348,32 @@ void RCT2StringToUTF8Self(char* buffer, size_t length)
     }
 }
 
-static void FixGuestsHeadingToParkCount()
+/**
+ * Recalculates the guest counts and fixes guests with an invalid ride station, all in a single pass over the guests.
+ */
+static void FixGuests()
 {
-    auto& gameState = GetGameState();
-
     uint32_t guestsHeadingToPark = 0;
+    uint32_t guestCount = 0;
+
+    // Peeps to remove have to be cached here, as removing them from within the loop breaks iteration
+    std::vector<Peep*> peepsToRemove;
 
     for (auto* peep : EntityList<Guest>())
     {
-        if (peep->OutsideOfPark && peep->State != PeepState::LeavingPark)
+        if (peep->OutsideOfPark)
         {
-            guestsHeadingToPark++;
+            if (peep->State != PeepState::LeavingPark)
+            {
+                guestsHeadingToPark++;
+            }
         }
-    }
-
-    if (gameState.NumGuestsHeadingForPark != guestsHeadingToPark)
-    {
-        LOG_WARNING(
-            "Corrected bad amount of guests heading to park: %u -> %u", gameState.NumGuestsHeadingForPark, guestsHeadingToPark);
-    }
-
-    gameState.NumGuestsHeadingForPark = guestsHeadingToPark;
-}
-
-static void FixGuestCount()
-{
-    // Recalculates peep count after loading a save to fix corrupted files
-    uint32_t guestCount = 0;
-
-    for (auto guest : EntityList<Guest>())
-    {
-        if (!guest->OutsideOfPark)
+        else
         {
             guestCount++;
         }
-    }
 
-    auto& gameState = GetGameState();
-    if (gameState.NumGuestsInPark != guestCount)
-    {
-        LOG_WARNING("Corrected bad amount of guests in park: %u -> %u", gameState.NumGuestsInPark, guestCount);
-    }
-
-    gameState.NumGuestsInPark = guestCount;
-}
-
-static void FixPeepsWithInvalidRideReference()
-{
-    // Peeps to remove have to be cached here, as removing them from within the loop breaks iteration
-    std::vector<Peep*> peepsToRemove;
-
-    // Fix possibly invalid field values
-    for (auto peep : EntityList<Guest>())
-    {
+        // Fix possibly invalid field values
         if (peep->CurrentRideStation.ToUnderlying() >= OpenRCT2::Limits::MaxStationsPerRide)
         {
             const auto srcStation = peep->CurrentRideStation;
@@ -412,7 +386,7 @@ static void FixPeepsWithInvalidRideReference()
             if (ride == nullptr)
             {
                 LOG_WARNING("Couldn't find ride %u, resetting ride on peep %u", rideIdx, peep->Id);
-                peep->CurrentRide = RideId::GetNull();
+                peep->SetCurrentRide(RideId::GetNull());
                 continue;
             }
             auto curName = peep->GetName();
@@ -433,6 +407,22 @@ static void FixPeepsWithInvalidRideReference()
         }
     }
 
+    // The counts are taken before removing any guests, removing them keeps the counts up to date
+    auto& gameState = GetGameState();
+    if (gameState.NumGuestsHeadingForPark != guestsHeadingToPark)
+    {
+        LOG_WARNING(
+            "Corrected bad amount of guests heading to park: %u -> %u", gameState.NumGuestsHeadingForPark, guestsHeadingToPark);
+    }
+    gameState.NumGuestsHeadingForPark = guestsHeadingToPark;
+
+    // Recalculates peep count after loading a save to fix corrupted files
+    if (gameState.NumGuestsInPark != guestCount)
+    {
+        LOG_WARNING("Corrected bad amount of guests in park: %u -> %u", gameState.NumGuestsInPark, guestCount);
+    }
+    gameState.NumGuestsInPark = guestCount;
+
     if (!peepsToRemove.empty())
     {
         // Some broken saves have broken spatial indexes
@@ -449,6 +439,7 @@ static void FixInvalidSurfaces()
 {
     // Fixes broken saves where a surface element could be null
     // and broken saves with incorrect invisible map border tiles
+    const auto mapSize = GetGameState().MapSize;
 
     for (int32_t y = 0; y < kMaximumMapSizeTechnical; y++)
     {
@@ -469,8 +460,7 @@ static void FixInvalidSurfaces()
 
             // Fix the invisible border tiles.
             // At this point, we can be sure that surfaceElement is not NULL.
-            auto& gameState = GetGameState();
-            if (x == 0 || x == gameState.MapSize.x - 1 || y == 0 || y == gameState.MapSize.y - 1)
+            if (x == 0 || x == mapSize.x - 1 || y == 0 || y == mapSize.y - 1)
             {
                 surfaceElement->SetBaseZ(kMinimumLandZ);
                 surfaceElement->SetClearanceZ(kMinimumLandZ);
@@ -485,11 +475,7 @@ static void FixInvalidSurfaces()
 // For example recalculate guest count by looking at all the guests instead of trusting the value in the file.
 void GameFixSaveVars()
 {
-    FixGuestsHeadingToParkCount();
-
-    FixGuestCount();
-
-    FixPeepsWithInvalidRideReference();
+    FixGuests();
 
     FixInvalidSurfaces();
 
@@ -507,6 +493,7 @@ void GameFixSaveVars()
     UpdateConsolidatedPatrolAreas();
 
     MapCountRemainingLandRights();
+    MapShareOutOfMapSurfaces();
 }
 
 void GameLoadInit()
@@ -737,6 +724,8 @@ static void LimitAutosaveCount(const size_t numberOfFilesToKeep, bool processLan
 
 void GameAutosave()
 {
+    PROFILED_FUNCTION();
+
     auto subDirectory = DIRID::SAVE;
     const char* fileExtension = ".park";
     uint32_t saveFlags = 0x80000000;
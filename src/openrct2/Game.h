@@ -105,6 +105,8 @@ enum class GameCommand : int32_t
     FreezeRideRating,
     SetGameSpeed,
     SetRestrictedScenery,
+    SimulateRideTest,
+    PlaceSceneryBatch,
     Count,
 };
 
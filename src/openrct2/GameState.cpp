@@ -21,17 +21,22 @@
 #include "ReplayManager.h"
 #include "actions/GameAction.h"
 #include "config/Config.h"
+#include "core/Timer.hpp"
 #include "entity/EntityRegistry.h"
 #include "entity/EntityTweener.h"
 #include "entity/PatrolArea.h"
 #include "entity/Staff.h"
 #include "interface/Screenshot.h"
+#include "interface/Viewport.h"
 #include "localisation/Date.h"
+#include "localisation/Formatting.h"
 #include "localisation/Localisation.h"
 #include "management/NewsItem.h"
 #include "network/network.h"
 #include "platform/Platform.h"
+#include "profiling/MemoryUsage.h"
 #include "profiling/Profiling.h"
+#include "profiling/Telemetry.h"
 #include "ride/Vehicle.h"
 #include "scenario/Scenario.h"
 #include "scripting/ScriptEngine.h"
@@ -52,6 +57,19 @@ using namespace OpenRCT2::Scripting;
 
 static GameState_t _gameState{};
 
+// Updates per frame from which only the last one is presented, reached at turbo speed.
+static constexpr uint32_t kFastForwardMinUpdates = 4;
+
+// Updates per frame a client runs to catch up with the server when adaptive catch-up is off or not needed.
+static constexpr uint32_t kClientMaxUpdates = 10;
+// Time a frame may spend catching up with the server, what is left of the tick period is kept for drawing.
+static constexpr float kCatchUpFrameBudget = kGameUpdateTimeMS * 0.75f;
+// How far behind the server a client has to be before the network status window shows the catch-up.
+static constexpr uint32_t kCatchUpStatusThreshold = 5 * kGameUpdateFPS;
+
+static bool _catchUpStatusShown;
+static bool _catchUpStatusDismissed;
+
 namespace OpenRCT2
 {
     GameState_t& GetGameState()
@@ -103,6 +121,38 @@ namespace OpenRCT2
         EntityTweener::Get().Reset();
     }
 
+    /**
+     * Shows how far a client is behind the server in the network status window while it catches up after falling far
+     * behind, and closes the window again once it has caught up.
+     */
+    static void gameStateUpdateCatchUpStatus(uint32_t ticksBehind)
+    {
+        if (ticksBehind > kCatchUpStatusThreshold && ticksBehind < INT32_MAX && gConfigNetwork.AdaptiveCatchUp)
+        {
+            if (_catchUpStatusDismissed)
+                return;
+
+            char statusText[256];
+            const int32_t args[] = { static_cast<int32_t>(ticksBehind) };
+            FormatStringLegacy(statusText, sizeof(statusText), STR_MULTIPLAYER_CATCHING_UP, args);
+
+            auto intent = Intent(WindowClass::NetworkStatus);
+            intent.PutExtra(INTENT_EXTRA_MESSAGE, std::string{ statusText });
+            intent.PutExtra(INTENT_EXTRA_CALLBACK, []() -> void { _catchUpStatusDismissed = true; });
+            ContextOpenIntent(&intent);
+            _catchUpStatusShown = true;
+        }
+        else
+        {
+            if (_catchUpStatusShown)
+            {
+                _catchUpStatusShown = false;
+                ContextForceCloseWindowByClass(WindowClass::NetworkStatus);
+            }
+            _catchUpStatusDismissed = false;
+        }
+    }
+
     /**
      * Function will be called every kGameUpdateTimeMS.
      * It has its own loop which might run multiple updates per call such as
@@ -131,10 +181,22 @@ namespace OpenRCT2
 
         NetworkUpdate();
 
+        bool isCatchingUp = false;
         if (NetworkGetMode() == NETWORK_MODE_CLIENT && NetworkGetStatus() == NETWORK_STATUS_CONNECTED
             && NetworkGetAuthstatus() == NetworkAuth::Ok)
         {
-            numUpdates = std::clamp<uint32_t>(NetworkGetServerTick() - GetGameState().CurrentTicks, 0, 10);
+            const uint32_t ticksBehind = NetworkGetServerTick() - GetGameState().CurrentTicks;
+            if (gConfigNetwork.AdaptiveCatchUp && ticksBehind > kClientMaxUpdates && ticksBehind < INT32_MAX)
+            {
+                // Run as many updates as the frame budget allows, the loop below stops once it is used up
+                isCatchingUp = true;
+                numUpdates = ticksBehind;
+            }
+            else
+            {
+                numUpdates = std::clamp<uint32_t>(ticksBehind, 0, kClientMaxUpdates);
+            }
+            gameStateUpdateCatchUpStatus(ticksBehind);
         }
         else
         {
@@ -189,14 +251,41 @@ namespace OpenRCT2
 
                 // Post-tick game actions.
                 GameActions::ProcessQueue();
+
+#ifdef ENABLE_SCRIPTING
+                // Actions allowed while paused and players joining or leaving still queue batched hook events
+                GetContext()->GetScriptEngine().GetHookEngine().DispatchBatches();
+#endif
             }
         }
 
+        // At turbo speeds only the last update of the frame is presented, the screen is redrawn in full after it.
+        const bool fastForward = numUpdates >= kFastForwardMinUpdates;
+        bool presentationSuspended = false;
+        if (fastForward)
+        {
+            OpenRCT2SuspendPresentation();
+            presentationSuspended = true;
+        }
+
         // Update the game one or more times
+        Timer catchUpTimer;
         for (uint32_t i = 0; i < numUpdates; i++)
         {
+            if (presentationSuspended && i == numUpdates - 1)
+            {
+                OpenRCT2ResumePresentation();
+                presentationSuspended = false;
+            }
+
             gameStateUpdateLogic();
-            if (gGameSpeed == 1)
+            if (isCatchingUp)
+            {
+                // Input does not hold back the catch-up, the client would otherwise never reach the server
+                if (catchUpTimer.GetElapsedTime().count() >= kCatchUpFrameBudget)
+                    break;
+            }
+            else if (gGameSpeed == 1)
             {
                 if (InputGetState() == InputState::Reset || InputGetState() == InputState::Normal)
                 {
@@ -217,9 +306,17 @@ namespace OpenRCT2
                 break;
         }
 
+        if (fastForward)
+        {
+            // The loop stops early when the game gets paused
+            if (presentationSuspended)
+                OpenRCT2ResumePresentation();
+            ViewportsInvalidateAll();
+        }
+
         NetworkFlush();
 
-        if (!gOpenRCT2Headless)
+        if (OpenRCT2HasPresentation())
         {
             InputSetFlag(INPUT_FLAG_VIEWPORT_SCROLLING, false);
 
@@ -251,7 +348,10 @@ namespace OpenRCT2
             ScenarioAutosaveCheck();
         }
 
-        WindowDispatchUpdateAll();
+        if (OpenRCT2HasPresentation())
+        {
+            WindowDispatchUpdateAll();
+        }
 
         if (didRunSingleFrame && GameIsNotPaused() && !(gScreenFlags & SCREEN_FLAGS_TITLE_DEMO))
         {
@@ -272,9 +372,32 @@ namespace OpenRCT2
         snapshots->LinkSnapshot(snapshot, GetGameState().CurrentTicks, ScenarioRandState().s0);
     }
 
+    /**
+     * Runs up to numTicks updates back to back without presenting any of them, then redraws everything once. Stops
+     * early when the game gets paused, e.g. by a finished scenario. Returns the number of updates run.
+     */
+    uint32_t gameStateFastForward(uint32_t numTicks)
+    {
+        PROFILED_FUNCTION();
+
+        uint32_t numUpdates = 0;
+        OpenRCT2SuspendPresentation();
+        while (numUpdates < numTicks && GameIsNotPaused())
+        {
+            gameStateUpdateLogic();
+            numUpdates++;
+        }
+        OpenRCT2ResumePresentation();
+
+        ViewportsInvalidateAll();
+        GfxInvalidateScreen();
+        return numUpdates;
+    }
+
     void gameStateUpdateLogic()
     {
         PROFILED_FUNCTION();
+        Telemetry::ScopedTick telemetryTick;
 
         gInUpdateCode = true;
 
@@ -333,11 +456,15 @@ namespace OpenRCT2
         ScenarioUpdate(gameState);
         ClimateUpdate();
         MapUpdateTiles();
-        // Temporarily remove provisional paths to prevent peep from interacting with them
-        MapRemoveProvisionalElements();
+        // Temporarily remove provisional paths to prevent peep from interacting with them, unless the pathfinding
+        // already ignores them.
+        bool removeProvisionalElements = !MapKeepsProvisionalElements();
+        if (removeProvisionalElements)
+            MapRemoveProvisionalElements();
         MapUpdatePathWideFlags();
         PeepUpdateAll();
-        MapRestoreProvisionalElements();
+        if (removeProvisionalElements)
+            MapRestoreProvisionalElements();
         VehicleUpdateAll();
         UpdateAllMiscEntities();
         Ride::UpdateAll();
@@ -352,11 +479,15 @@ namespace OpenRCT2
         RideMeasurementsUpdate();
         News::UpdateCurrentItem();
 
+        // Also needed without presentation, some animations update the game state.
         MapAnimationInvalidateAll();
-        VehicleSoundsUpdate();
-        PeepUpdateCrowdNoise();
-        ClimateUpdateSound();
-        EditorOpenWindowsForCurrentStep();
+        if (OpenRCT2HasPresentation())
+        {
+            VehicleSoundsUpdate();
+            PeepUpdateCrowdNoise();
+            ClimateUpdateSound();
+            EditorOpenWindowsForCurrentStep();
+        }
 
         // Update windows
         // WindowDispatchUpdateAll();
@@ -368,15 +499,18 @@ namespace OpenRCT2
         }
 
         GameActions::ProcessQueue();
+        MapCompactTileElements();
 
         NetworkProcessPending();
         NetworkFlush();
 
         gameState.CurrentTicks++;
+        MemoryUsage::Update(gameState.CurrentTicks);
 
 #ifdef ENABLE_SCRIPTING
         auto& hookEngine = GetContext()->GetScriptEngine().GetHookEngine();
         hookEngine.Call(HOOK_TYPE::INTERVAL_TICK, true);
+        hookEngine.DispatchBatches();
 
         if (day != gameState.Date.GetDay())
         {
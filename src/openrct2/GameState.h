@@ -13,6 +13,7 @@
 #include "Date.h"
 #include "Editor.h"
 #include "Limits.h"
+#include "entity/EntityRegistryState.h"
 #include "interface/ZoomLevel.h"
 #include "management/Award.h"
 #include "management/Finance.h"
@@ -90,6 +91,7 @@ namespace OpenRCT2
 
         std::vector<Banner> Banners;
         Entity_t Entities[MAX_ENTITIES]{};
+        EntityRegistryState EntityRegistry;
         // Ride storage for all the rides in the park, rides with RideId::Null are considered free.
         std::array<Ride, OpenRCT2::Limits::MaxRidesInPark> Rides{};
         ::RideRatingUpdateStates RideRatingUpdateStates;
@@ -151,5 +153,6 @@ namespace OpenRCT2
     void gameStateInitAll(GameState_t& gameState, const TileCoordsXY& mapSize);
     void gameStateTick();
     void gameStateUpdateLogic();
+    uint32_t gameStateFastForward(uint32_t numTicks);
 
 } // namespace OpenRCT2
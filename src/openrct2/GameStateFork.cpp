@@ -0,0 +1,118 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "GameStateFork.h"
+
+#include "Context.h"
+#include "Game.h"
+#include "GameState.h"
+#include "ParkImporter.h"
+#include "ReplayManager.h"
+#include "actions/GameAction.h"
+#include "drawing/Drawing.h"
+#include "entity/EntityTweener.h"
+#include "interface/Viewport.h"
+#include "network/network.h"
+#include "object/ObjectManager.h"
+#include "object/ObjectRepository.h"
+#include "park/ParkFile.h"
+#include "profiling/Profiling.h"
+
+namespace OpenRCT2
+{
+    bool GameStateCanFork()
+    {
+        if (NetworkGetMode() != NETWORK_MODE_NONE)
+            return false;
+
+        auto* replayManager = GetContext()->GetReplayManager();
+        return !replayManager->IsReplaying() && !replayManager->IsRecording() && !replayManager->IsNormalising();
+    }
+
+    GameStateFork::GameStateFork()
+    {
+        PROFILED_FUNCTION();
+
+        if (!GameStateCanFork())
+            return;
+
+        try
+        {
+            // The park file is the one representation that holds everything the simulation depends on, replays
+            // rely on it for their keyframes as well.
+            auto exporter = std::make_unique<ParkFileExporter>();
+            exporter->Export(GetGameState(), _parkData);
+            _entitiesChecksum = GetAllEntitiesChecksum();
+            _active = true;
+        }
+        catch (const std::exception& ex)
+        {
+            LOG_ERROR("Unable to fork the game state: %s", ex.what());
+        }
+    }
+
+    GameStateFork::~GameStateFork()
+    {
+        Restore();
+    }
+
+    bool GameStateFork::IsActive() const
+    {
+        return _active;
+    }
+
+    uint32_t GameStateFork::Simulate(uint32_t numTicks)
+    {
+        if (!_active)
+            return 0;
+
+        return gameStateFastForward(numTicks);
+    }
+
+    bool GameStateFork::Restore()
+    {
+        PROFILED_FUNCTION();
+
+        if (!_active)
+            return false;
+        _active = false;
+
+        try
+        {
+            _parkData.SetPosition(0);
+
+            auto context = GetContext();
+            auto importer = ParkImporter::CreateParkFile(context->GetObjectRepository());
+            auto loadResult = importer->LoadFromStream(&_parkData, false);
+            context->GetObjectManager().LoadObjects(loadResult.RequiredObjects);
+            importer->Import(GetGameState());
+        }
+        catch (const std::exception& ex)
+        {
+            LOG_ERROR("Unable to restore the forked game state: %s", ex.what());
+            return false;
+        }
+
+        // Unlike loading a park the windows and the view stay as they are, only what was derived from the simulated
+        // state has to be rebuilt.
+        GameActions::ClearQueue();
+        EntityTweener::Get().Reset();
+        ResetEntitySpatialIndices();
+        ResetAllSpriteQuadrantPlacements();
+        ViewportsInvalidateAll();
+        GfxInvalidateScreen();
+
+        if (GetAllEntitiesChecksum().raw != _entitiesChecksum.raw)
+        {
+            LOG_ERROR("Entities differ after restoring the forked game state");
+            return false;
+        }
+        return true;
+    }
+} // namespace OpenRCT2
@@ -0,0 +1,56 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "common.h"
+#include "core/MemoryStream.h"
+#include "entity/EntityRegistry.h"
+
+namespace OpenRCT2
+{
+    /*
+     * Forks the current game state to evaluate a hypothetical change, e.g. the park rating after adding a path or the
+     * guest flow at a different price. While the fork is alive the live game state may be changed and simulated freely,
+     * once it is restored (or destroyed) the park is put back exactly as it was when the fork was created.
+     * Forking is only possible in single player and while no replay is running, as the simulated ticks would otherwise
+     * reach other players or the recording.
+     */
+    class GameStateFork
+    {
+    private:
+        MemoryStream _parkData;
+        EntitiesChecksum _entitiesChecksum{};
+        bool _active{};
+
+    public:
+        GameStateFork();
+        ~GameStateFork();
+
+        GameStateFork(const GameStateFork&) = delete;
+        GameStateFork& operator=(const GameStateFork&) = delete;
+
+        /*
+         * Returns true if the fork holds a copy of the park, false if forking was not possible.
+         */
+        bool IsActive() const;
+
+        /*
+         * Runs the simulation for the given number of ticks without presenting them, returns the number of ticks run.
+         */
+        uint32_t Simulate(uint32_t numTicks);
+
+        /*
+         * Puts the park back the way it was when the fork was created, returns false if that failed.
+         */
+        bool Restore();
+    };
+
+    bool GameStateCanFork();
+} // namespace OpenRCT2
@@ -44,15 +44,36 @@ struct GameStateSnapshot_t
     {
         tick = mv.tick;
         storedSprites = std::move(mv.storedSprites);
+        entityRecords = std::move(mv.entityRecords);
         return *this;
     }
 
+    // Location of a single serialised entity within storedSprites.
+    struct EntityRecord
+    {
+        uint32_t index;
+        uint32_t offset;
+        uint32_t length;
+    };
+
     uint32_t tick = InvalidTick;
     uint32_t srand0 = 0;
 
+    void Reset()
+    {
+        tick = InvalidTick;
+        srand0 = 0;
+        storedSprites.Clear();
+        parkParameters.Clear();
+        entityRecords.clear();
+    }
+
     OpenRCT2::MemoryStream storedSprites;
     OpenRCT2::MemoryStream parkParameters;
 
+    // Sorted by entity index, filled in whenever the entities are serialised.
+    std::vector<EntityRecord> entityRecords;
+
     template<typename T> bool EntitySizeCheck(DataSerialiser& ds)
     {
         uint32_t size = sizeof(T);
@@ -73,8 +94,12 @@ struct GameStateSnapshot_t
     {
         const bool loading = !saving;
 
-        storedSprites.SetPosition(0);
+        if (saving)
+            storedSprites.Clear();
+        else
+            storedSprites.SetPosition(0);
         DataSerialiser ds(saving, storedSprites);
+        entityRecords.clear();
 
         std::vector<uint32_t> indexTable;
         indexTable.reserve(numSprites);
@@ -118,44 +143,75 @@ struct GameStateSnapshot_t
                 LOG_ERROR("Entity index corrupted!");
                 return;
             }
-            auto& sprite = *entity;
 
-            ds << sprite.base.Type;
+            const auto recordOffset = static_cast<uint32_t>(storedSprites.GetPosition());
+            SerialiseEntity(*entity, ds);
+            const auto recordLength = static_cast<uint32_t>(storedSprites.GetPosition()) - recordOffset;
+            entityRecords.push_back(EntityRecord{ indexTable[i], recordOffset, recordLength });
+        }
+    }
 
-            switch (sprite.base.Type)
-            {
-                case EntityType::Vehicle:
-                    reinterpret_cast<Vehicle&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Guest:
-                    reinterpret_cast<Guest&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Staff:
-                    reinterpret_cast<Staff&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Litter:
-                    reinterpret_cast<Litter&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::MoneyEffect:
-                    reinterpret_cast<MoneyEffect&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Balloon:
-                    reinterpret_cast<Balloon&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Duck:
-                    reinterpret_cast<Duck&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::JumpingFountain:
-                    reinterpret_cast<JumpingFountain&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::SteamParticle:
-                    reinterpret_cast<SteamParticle&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Null:
-                    break;
-                default:
-                    break;
-            }
+    // Fills in the entity records of a snapshot that was received instead of captured.
+    void IndexEntities()
+    {
+        EntitySnapshot scratch;
+        SerialiseSprites([&scratch](const EntityId) { return &scratch; }, MAX_ENTITIES, false);
+    }
+
+    bool IsEntityEqual(const EntityRecord& record, const GameStateSnapshot_t& other, const EntityRecord& otherRecord) const
+    {
+        if (record.length != otherRecord.length)
+            return false;
+
+        const auto* data = static_cast<const uint8_t*>(storedSprites.GetData()) + record.offset;
+        const auto* otherData = static_cast<const uint8_t*>(other.storedSprites.GetData()) + otherRecord.offset;
+        return std::memcmp(data, otherData, record.length) == 0;
+    }
+
+    void ReadEntity(const EntityRecord& record, EntitySnapshot& entity)
+    {
+        storedSprites.SetPosition(record.offset);
+        DataSerialiser ds(false, storedSprites);
+        SerialiseEntity(entity, ds);
+    }
+
+    static void SerialiseEntity(EntitySnapshot& sprite, DataSerialiser& ds)
+    {
+        ds << sprite.base.Type;
+
+        switch (sprite.base.Type)
+        {
+            case EntityType::Vehicle:
+                reinterpret_cast<Vehicle&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Guest:
+                reinterpret_cast<Guest&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Staff:
+                reinterpret_cast<Staff&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Litter:
+                reinterpret_cast<Litter&>(sprite).Serialise(ds);
+                break;
+            case EntityType::MoneyEffect:
+                reinterpret_cast<MoneyEffect&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Balloon:
+                reinterpret_cast<Balloon&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Duck:
+                reinterpret_cast<Duck&>(sprite).Serialise(ds);
+                break;
+            case EntityType::JumpingFountain:
+                reinterpret_cast<JumpingFountain&>(sprite).Serialise(ds);
+                break;
+            case EntityType::SteamParticle:
+                reinterpret_cast<SteamParticle&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Null:
+                break;
+            default:
+                break;
         }
     }
 };
@@ -169,7 +225,17 @@ struct GameStateSnapshots final : public IGameStateSnapshots
 
     virtual GameStateSnapshot_t& CreateSnapshot() override final
     {
-        auto snapshot = std::make_unique<GameStateSnapshot_t>();
+        // Reuse the oldest snapshot once all are in use, its buffers already have about the right size.
+        std::unique_ptr<GameStateSnapshot_t> snapshot;
+        if (_snapshots.size() == _snapshots.capacity())
+        {
+            snapshot = std::move(_snapshots.front());
+            snapshot->Reset();
+        }
+        else
+        {
+            snapshot = std::make_unique<GameStateSnapshot_t>();
+        }
         _snapshots.push_back(std::move(snapshot));
 
         return *_snapshots.back();
@@ -189,6 +255,19 @@ struct GameStateSnapshots final : public IGameStateSnapshots
         // LOG_INFO("Snapshot size: %u bytes", static_cast<uint32_t>(snapshot.storedSprites.GetLength()));
     }
 
+    virtual size_t GetMemoryUsage() const override final
+    {
+        size_t bytes = 0;
+        for (size_t i = 0; i < _snapshots.size(); i++)
+        {
+            const auto& snapshot = *_snapshots[i];
+            bytes += sizeof(GameStateSnapshot_t) + snapshot.storedSprites.GetCapacity()
+                + snapshot.parkParameters.GetCapacity()
+                + snapshot.entityRecords.capacity() * sizeof(GameStateSnapshot_t::EntityRecord);
+        }
+        return bytes;
+    }
+
     virtual const GameStateSnapshot_t* GetLinkedSnapshot(uint32_t tick) const override final
     {
         for (size_t i = 0; i < _snapshots.size(); i++)
@@ -205,23 +284,11 @@ struct GameStateSnapshots final : public IGameStateSnapshots
         ds << snapshot.srand0;
         ds << snapshot.storedSprites;
         ds << snapshot.parkParameters;
-    }
 
-    std::vector<EntitySnapshot> BuildSpriteList(GameStateSnapshot_t& snapshot) const
-    {
-        std::vector<EntitySnapshot> spriteList;
-        spriteList.resize(MAX_ENTITIES);
-
-        for (auto& sprite : spriteList)
+        if (ds.IsLoading() && snapshot.storedSprites.GetLength() > 0)
         {
-            // By default they don't exist.
-            sprite.base.Type = EntityType::Null;
+            snapshot.IndexEntities();
         }
-
-        snapshot.SerialiseSprites(
-            [&spriteList](const EntityId index) { return &spriteList[index.ToUnderlying()]; }, MAX_ENTITIES, false);
-
-        return spriteList;
     }
 
 #define COMPARE_FIELD(struc, field)                                                                                            \
@@ -629,47 +696,64 @@ struct GameStateSnapshots final : public IGameStateSnapshots
         res.srand0Left = base.srand0;
         res.srand0Right = cmp.srand0;
 
-        std::vector<EntitySnapshot> spritesBase = BuildSpriteList(const_cast<GameStateSnapshot_t&>(base));
-        std::vector<EntitySnapshot> spritesCmp = BuildSpriteList(const_cast<GameStateSnapshot_t&>(cmp));
+        auto& snapshotBase = const_cast<GameStateSnapshot_t&>(base);
+        auto& snapshotCmp = const_cast<GameStateSnapshot_t&>(cmp);
+        const auto& recordsBase = base.entityRecords;
+        const auto& recordsCmp = cmp.entityRecords;
 
-        for (uint32_t i = 0; i < static_cast<uint32_t>(spritesBase.size()); i++)
+        // Both record lists are sorted by entity index, walk them together and only decode the entities present in
+        // just one of them or whose serialised data differs.
+        size_t indexBase = 0;
+        size_t indexCmp = 0;
+        while (indexBase < recordsBase.size() || indexCmp < recordsCmp.size())
         {
-            GameStateSpriteChange changeData;
-            changeData.spriteIndex = i;
+            const auto* recordBase = indexBase < recordsBase.size() ? &recordsBase[indexBase] : nullptr;
+            const auto* recordCmp = indexCmp < recordsCmp.size() ? &recordsCmp[indexCmp] : nullptr;
+            if (recordBase != nullptr && recordCmp != nullptr && recordBase->index != recordCmp->index)
+            {
+                if (recordBase->index < recordCmp->index)
+                    recordCmp = nullptr;
+                else
+                    recordBase = nullptr;
+            }
 
-            const EntitySnapshot& spriteBase = spritesBase[i];
-            const EntitySnapshot& spriteCmp = spritesCmp[i];
+            GameStateSpriteChange changeData;
+            EntitySnapshot spriteBase;
+            EntitySnapshot spriteCmp;
+            if (recordBase != nullptr && recordCmp != nullptr)
+            {
+                indexBase++;
+                indexCmp++;
+                if (snapshotBase.IsEntityEqual(*recordBase, snapshotCmp, *recordCmp))
+                    continue;
 
-            changeData.entityType = spriteBase.base.Type;
+                snapshotBase.ReadEntity(*recordBase, spriteBase);
+                snapshotCmp.ReadEntity(*recordCmp, spriteCmp);
+                changeData.spriteIndex = recordBase->index;
+                changeData.entityType = spriteBase.base.Type;
+                CompareSpriteData(spriteBase, spriteCmp, changeData);
+                if (changeData.diffs.empty())
+                    continue;
 
-            if (spriteBase.base.Type == EntityType::Null && spriteCmp.base.Type != EntityType::Null)
-            {
-                // Sprite was added.
-                changeData.changeType = GameStateSpriteChange::ADDED;
-                changeData.entityType = spriteCmp.base.Type;
+                changeData.changeType = GameStateSpriteChange::MODIFIED;
             }
-            else if (spriteBase.base.Type != EntityType::Null && spriteCmp.base.Type == EntityType::Null)
+            else if (recordBase != nullptr)
             {
                 // Sprite was removed.
+                indexBase++;
+                snapshotBase.ReadEntity(*recordBase, spriteBase);
+                changeData.spriteIndex = recordBase->index;
                 changeData.changeType = GameStateSpriteChange::REMOVED;
                 changeData.entityType = spriteBase.base.Type;
             }
-            else if (spriteBase.base.Type == EntityType::Null && spriteCmp.base.Type == EntityType::Null)
-            {
-                // Do nothing.
-                changeData.changeType = GameStateSpriteChange::EQUAL;
-            }
             else
             {
-                CompareSpriteData(spriteBase, spriteCmp, changeData);
-                if (changeData.diffs.size() == 0)
-                {
-                    changeData.changeType = GameStateSpriteChange::EQUAL;
-                }
-                else
-                {
-                    changeData.changeType = GameStateSpriteChange::MODIFIED;
-                }
+                // Sprite was added.
+                indexCmp++;
+                snapshotCmp.ReadEntity(*recordCmp, spriteCmp);
+                changeData.spriteIndex = recordCmp->index;
+                changeData.changeType = GameStateSpriteChange::ADDED;
+                changeData.entityType = spriteCmp.base.Type;
             }
 
             res.spriteChanges.push_back(std::move(changeData));
@@ -108,6 +108,11 @@ struct IGameStateSnapshots
      * Generates a string of readable text from GameStateCompareData
      */
     virtual std::string GetCompareDataText(const GameStateCompareData& cmpData) const = 0;
+
+    /*
+     * Returns the number of bytes held by the stored snapshots.
+     */
+    virtual size_t GetMemoryUsage() const = 0;
 };
 
 [[nodiscard]] std::unique_ptr<IGameStateSnapshots> CreateGameStateSnapshots();
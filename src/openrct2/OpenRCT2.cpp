@@ -28,3 +28,20 @@ uint32_t gCurrentDrawCount = 0;
 uint8_t gScreenFlags;
 uint32_t gScreenAge;
 PromptMode gSavePromptMode;
+
+static int32_t _presentationSuspendCount = 0;
+
+bool OpenRCT2HasPresentation()
+{
+    return !gOpenRCT2Headless && _presentationSuspendCount == 0;
+}
+
+void OpenRCT2SuspendPresentation()
+{
+    _presentationSuspendCount++;
+}
+
+void OpenRCT2ResumePresentation()
+{
+    _presentationSuspendCount--;
+}
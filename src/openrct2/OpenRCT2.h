@@ -62,6 +62,15 @@ extern uint8_t gScreenFlags;
 extern uint32_t gScreenAge;
 extern PromptMode gSavePromptMode;
 
+/**
+ * Whether ticks have to keep what the player sees and hears up to date: sounds, windows and the parts of the screen that
+ * need redrawing. Headless instances only simulate, so the simulation code skips all of it when this is false.
+ */
+bool OpenRCT2HasPresentation();
+// Turns presentation off while fast-forwarding, until the matching resume. The caller redraws everything afterwards.
+void OpenRCT2SuspendPresentation();
+void OpenRCT2ResumePresentation();
+
 void OpenRCT2WriteFullVersionInfo(utf8* buffer, size_t bufferSize);
 void OpenRCT2Finish();
 
@@ -25,6 +25,7 @@
 #include "actions/TrackPlaceAction.h"
 #include "config/Config.h"
 #include "core/DataSerialiser.h"
+#include "core/File.h"
 #include "core/Path.hpp"
 #include "entity/EntityRegistry.h"
 #include "entity/EntityTweener.h"
@@ -79,6 +80,14 @@ namespace OpenRCT2
         OpenRCT2::MemoryStream data;
     };
 
+    // A park state part way through a replay, kept compressed until playback seeks to it.
+    struct ReplayKeyframe
+    {
+        uint32_t tick{};
+        uint32_t length{};
+        OpenRCT2::MemoryStream compressedData;
+    };
+
     struct ReplayRecordData
     {
         uint32_t magic;
@@ -96,15 +105,34 @@ namespace OpenRCT2
         std::vector<std::pair<uint32_t, EntitiesChecksum>> checksums;
         uint32_t checksumIndex;
         OpenRCT2::MemoryStream gameStateSnapshots;
+        uint32_t numCommandsWritten{};  // Commands already written to disk while recording.
+        uint32_t numChecksumsWritten{}; // Checksums already written to disk while recording.
+        std::multiset<ReplayCommand>::const_iterator nextCommand; // Next command to replay during playback.
+        std::vector<ReplayKeyframe> keyframes;                    // Sorted by tick, only loaded for playback.
+    };
+
+    // Replays are written as a sequence of individually compressed blocks while recording, so only the commands and
+    // checksums since the last block are kept in memory. Each block is the type, the uncompressed size, the compressed
+    // size and the compressed data.
+    enum class ReplayBlockType : uint8_t
+    {
+        Header,   // Park, parameters, cheats and the snapshot at the start.
+        Data,     // Commands and checksums.
+        Keyframe, // Tick, park, parameters and cheats part way through, used to seek during playback.
+        End,      // Last tick and the snapshot at the end.
     };
 
     class ReplayManager final : public IReplayManager
     {
-        static constexpr uint16_t ReplayVersion = 10;
-        static constexpr uint32_t ReplayMagic = 0x5243524F; // ORCR.
+        static constexpr uint16_t ReplayVersion = 11;
+        static constexpr uint16_t ReplayVersionWholeFile = 10; // Last version compressed as a whole when stopped.
+        static constexpr uint32_t ReplayMagic = 0x5243524F;    // ORCR.
         static constexpr int ReplayCompressionLevel = 9;
         static constexpr int NormalRecordingChecksumTicks = 1;
         static constexpr int SilentRecordingChecksumTicks = 40; // Same as network server
+        static constexpr uint32_t DataBlockTicks = 40 * 60;     // About a minute.
+        static constexpr size_t DataBlockMaxCommands = 1024;
+        static constexpr uint32_t KeyframeTicks = 40 * 60 * 60; // About an hour.
 
         enum class ReplayMode
         {
@@ -117,6 +145,7 @@ namespace OpenRCT2
     public:
         virtual ~ReplayManager()
         {
+            CloseRecordingFile();
         }
 
         virtual bool IsReplaying() const override
@@ -147,6 +176,10 @@ namespace OpenRCT2
             auto ga = GameActions::Clone(action);
 
             _currentRecording->commands.emplace(tick, std::move(ga), _commandId++);
+            if (_currentRecording->commands.size() >= DataBlockMaxCommands)
+            {
+                WriteDataBlock();
+            }
         }
 
         void AddChecksum(uint32_t tick, EntitiesChecksum&& checksum)
@@ -170,6 +203,20 @@ namespace OpenRCT2
                 _nextChecksumTick = currentTicks + ChecksumTicksDelta();
             }
 
+            if ((_mode == ReplayMode::RECORDING || _mode == ReplayMode::NORMALISATION) && _currentRecording != nullptr)
+            {
+                if (currentTicks >= _nextDataBlockTick)
+                {
+                    WriteDataBlock();
+                    _nextDataBlockTick = currentTicks + DataBlockTicks;
+                }
+                if (currentTicks >= _nextKeyframeTick)
+                {
+                    WriteKeyframeBlock();
+                    _nextKeyframeTick = currentTicks + KeyframeTicks;
+                }
+            }
+
             if (_mode == ReplayMode::RECORDING)
             {
                 if (currentTicks >= _currentRecording->tickEnd)
@@ -199,7 +246,7 @@ namespace OpenRCT2
                 ReplayCommands();
 
                 // If we run out of commands we can just stop
-                if (_currentReplay->commands.empty())
+                if (_currentReplay->nextCommand == _currentReplay->commands.end())
                 {
                     StopPlayback();
                     StopRecording();
@@ -267,12 +314,21 @@ namespace OpenRCT2
 
             TakeGameStateSnapshot(replayData->gameStateSnapshots);
 
+            if (!OpenRecordingFile(*replayData))
+                return false;
+
+            // Everything needed at the start is on disk now, don't keep the park around for the whole recording.
+            replayData->parkData = MemoryStream();
+            replayData->gameStateSnapshots = MemoryStream();
+
             if (_mode != ReplayMode::NORMALISATION)
                 _mode = ReplayMode::RECORDING;
 
             _currentRecording = std::move(replayData);
             _recordType = rt;
             _nextChecksumTick = currentTicks + 1;
+            _nextDataBlockTick = currentTicks + DataBlockTicks;
+            _nextKeyframeTick = currentTicks + KeyframeTicks;
 
             return true;
         }
@@ -284,6 +340,8 @@ namespace OpenRCT2
 
             if (discard)
             {
+                CloseRecordingFile();
+                File::Delete(_currentRecording->filePath);
                 _currentRecording.reset();
                 _mode = ReplayMode::NONE;
                 return true;
@@ -298,50 +356,16 @@ namespace OpenRCT2
                 AddChecksum(currentTicks, std::move(checksum));
             }
 
-            TakeGameStateSnapshot(_currentRecording->gameStateSnapshots);
-
-            // Serialise Body.
-            DataSerialiser recSerialiser(true);
-            Serialise(recSerialiser, *_currentRecording);
-
-            const auto& stream = recSerialiser.GetStream();
-            unsigned long streamLength = static_cast<unsigned long>(stream.GetLength());
-            unsigned long compressLength = compressBound(streamLength);
+            WriteDataBlock();
 
-            MemoryStream data(compressLength);
-
-            ReplayRecordFile file{ _currentRecording->magic, _currentRecording->version, streamLength, data };
-
-            auto compressBuf = std::make_unique<unsigned char[]>(compressLength);
-            compress2(
-                compressBuf.get(), &compressLength, static_cast<const unsigned char*>(stream.GetData()), stream.GetLength(),
-                ReplayCompressionLevel);
-            file.data.Write(compressBuf.get(), compressLength);
-
-            DataSerialiser fileSerialiser(true);
-            fileSerialiser << file.magic;
-            fileSerialiser << file.version;
-            fileSerialiser << file.uncompressedSize;
-            fileSerialiser << file.data;
-
-            bool result = false;
-
-            const std::string& outFile = _currentRecording->filePath;
+            TakeGameStateSnapshot(_currentRecording->gameStateSnapshots);
 
-            FILE* fp = fopen(outFile.c_str(), "wb");
-            if (fp != nullptr)
-            {
-                const auto& fileStream = fileSerialiser.GetStream();
-                fwrite(fileStream.GetData(), 1, fileStream.GetLength(), fp);
-                fclose(fp);
+            DataSerialiser endSerialiser(true);
+            SerialiseEndBlock(endSerialiser, *_currentRecording);
+            WriteRecordingBlock(ReplayBlockType::End, endSerialiser.GetStream());
 
-                result = true;
-            }
-            else
-            {
-                LOG_ERROR("Unable to write to file '%s'", outFile.c_str());
-                result = false;
-            }
+            bool result = !_recordingWriteFailed;
+            CloseRecordingFile();
 
             // When normalizing the output we don't touch the mode.
             if (_mode != ReplayMode::NORMALISATION)
@@ -377,8 +401,8 @@ namespace OpenRCT2
                 info.Ticks = GetGameState().CurrentTicks - data->tickStart;
             else if (_mode == ReplayMode::PLAYING)
                 info.Ticks = data->tickEnd - data->tickStart;
-            info.NumCommands = static_cast<uint32_t>(data->commands.size());
-            info.NumChecksums = static_cast<uint32_t>(data->checksums.size());
+            info.NumCommands = static_cast<uint32_t>(data->commands.size()) + data->numCommandsWritten;
+            info.NumChecksums = static_cast<uint32_t>(data->checksums.size()) + data->numChecksumsWritten;
 
             return true;
         }
@@ -449,6 +473,7 @@ namespace OpenRCT2
 
             _currentReplay = std::move(replayData);
             _currentReplay->checksumIndex = 0;
+            _currentReplay->nextCommand = _currentReplay->commands.begin();
             _faultyChecksumIndex = -1;
 
             // Make sure game is not paused.
@@ -460,6 +485,56 @@ namespace OpenRCT2
             return true;
         }
 
+        virtual bool SeekPlayback(uint32_t replayTick) override
+        {
+            if (_mode != ReplayMode::PLAYING)
+                return false;
+
+            auto& replay = *_currentReplay;
+            const uint32_t tick = replay.tickStart + std::min(replayTick, replay.tickEnd - replay.tickStart);
+
+            // Use the closest keyframe at or before the tick, unless playback is already closer to it.
+            const ReplayKeyframe* keyframe = nullptr;
+            for (const auto& candidate : replay.keyframes)
+            {
+                if (candidate.tick > tick)
+                    break;
+                keyframe = &candidate;
+            }
+
+            const auto currentTicks = GetGameState().CurrentTicks;
+            if (tick < currentTicks || (keyframe != nullptr && keyframe->tick > currentTicks))
+            {
+                if (keyframe != nullptr)
+                {
+                    if (!LoadReplayKeyframe(*keyframe))
+                        return false;
+                }
+                else
+                {
+                    if (!LoadReplayDataMap(replay))
+                        return false;
+                    GetGameState().CurrentTicks = replay.tickStart;
+                }
+
+                const auto loadedTicks = GetGameState().CurrentTicks;
+                replay.nextCommand = replay.commands.lower_bound(ReplayCommand(loadedTicks, nullptr, 0));
+                replay.checksumIndex = static_cast<uint32_t>(
+                    std::lower_bound(
+                        replay.checksums.begin(), replay.checksums.end(), loadedTicks,
+                        [](const auto& checksum, uint32_t value) { return checksum.first < value; })
+                    - replay.checksums.begin());
+                _faultyChecksumIndex = -1;
+            }
+
+            // Simulate the rest of the way, this replays the commands and checks the checksums as usual.
+            while (_mode == ReplayMode::PLAYING && GetGameState().CurrentTicks < tick)
+            {
+                gameStateUpdateLogic();
+            }
+            return true;
+        }
+
         virtual bool IsPlaybackStateMismatching() const override
         {
             return _faultyChecksumIndex != -1;
@@ -524,16 +599,51 @@ namespace OpenRCT2
         }
 
         bool LoadReplayDataMap(ReplayRecordData& data)
+        {
+            return LoadReplayPark(data.parkData, data.parkParams);
+        }
+
+        bool LoadReplayKeyframe(const ReplayKeyframe& keyframe)
+        {
+            auto buff = std::make_unique<unsigned char[]>(keyframe.length);
+            unsigned long outSize = keyframe.length;
+            auto status = uncompress(
+                buff.get(), &outSize, static_cast<const unsigned char*>(keyframe.compressedData.GetData()),
+                keyframe.compressedData.GetLength());
+            if (status != Z_OK || outSize != keyframe.length)
+            {
+                LOG_ERROR("Unable to decompress replay keyframe.");
+                return false;
+            }
+
+            uint32_t tick = 0;
+            MemoryStream parkData;
+            MemoryStream parkParams;
+            MemoryStream blockStream(buff.get(), outSize);
+            DataSerialiser keyframeSerialiser(false, blockStream);
+            keyframeSerialiser << tick;
+            keyframeSerialiser << parkData;
+            keyframeSerialiser << parkParams;
+
+            if (!LoadReplayPark(parkData, parkParams))
+                return false;
+
+            GetGameState().CurrentTicks = tick;
+            return true;
+        }
+
+        bool LoadReplayPark(MemoryStream& parkData, MemoryStream& parkParams)
         {
             try
             {
-                data.parkData.SetPosition(0);
+                parkData.SetPosition(0);
+                parkParams.SetPosition(0);
 
                 auto context = GetContext();
                 auto& objManager = context->GetObjectManager();
                 auto importer = ParkImporter::CreateParkFile(context->GetObjectRepository());
 
-                auto loadResult = importer->LoadFromStream(&data.parkData, false);
+                auto loadResult = importer->LoadFromStream(&parkData, false);
                 objManager.LoadObjects(loadResult.RequiredObjects);
 
                 // TODO: Have a separate GameState and exchange once loaded.
@@ -543,7 +653,7 @@ namespace OpenRCT2
                 EntityTweener::Get().Reset();
 
                 // Load all map global variables.
-                DataSerialiser parkParamsDs(false, data.parkParams);
+                DataSerialiser parkParamsDs(false, parkParams);
                 SerialiseParkParameters(parkParamsDs);
 
                 GameLoadInit();
@@ -637,14 +747,22 @@ namespace OpenRCT2
             if (!loaded)
                 return false;
 
-            if (!TryDecompress(stream))
-                return false;
-
-            stream.SetPosition(0);
-            DataSerialiser serialiser(false, stream);
-            if (!Serialise(serialiser, data))
+            if (IsBlockReplay(stream))
             {
-                return false;
+                if (!ReadReplayBlocks(stream, data))
+                    return false;
+            }
+            else
+            {
+                if (!TryDecompress(stream))
+                    return false;
+
+                stream.SetPosition(0);
+                DataSerialiser serialiser(false, stream);
+                if (!Serialise(serialiser, data))
+                {
+                    return false;
+                }
             }
 
             // Reset position of all streams.
@@ -718,7 +836,34 @@ namespace OpenRCT2
 
         bool Compatible(ReplayRecordData& data)
         {
-            return data.version == ReplayVersion;
+            return data.version == ReplayVersion || data.version == ReplayVersionWholeFile;
+        }
+
+        bool IsBlockReplay(MemoryStream& stream)
+        {
+            if (stream.GetLength() < sizeof(uint32_t) + sizeof(uint16_t))
+                return false;
+
+            uint32_t magic = 0;
+            uint16_t version = 0;
+            stream.SetPosition(0);
+            DataSerialiser fileSerialiser(false, stream);
+            fileSerialiser << magic;
+            fileSerialiser << version;
+            return magic == ReplayMagic && version == ReplayVersion;
+        }
+
+        void CheckNetworkId([[maybe_unused]] const ReplayRecordData& data)
+        {
+#ifndef DISABLE_NETWORK
+            // NOTE: This does not mean the replay will not function, only a warning.
+            if (data.networkId != NetworkGetVersion())
+            {
+                LOG_WARNING(
+                    "Replay network version mismatch: '%s', expected: '%s'", data.networkId.c_str(),
+                    NetworkGetVersion().c_str());
+            }
+#endif
         }
 
         bool Serialise(DataSerialiser& serialiser, ReplayRecordData& data)
@@ -737,15 +882,7 @@ namespace OpenRCT2
             }
 
             serialiser << data.networkId;
-#ifndef DISABLE_NETWORK
-            // NOTE: This does not mean the replay will not function, only a warning.
-            if (data.networkId != NetworkGetVersion())
-            {
-                LOG_WARNING(
-                    "Replay network version mismatch: '%s', expected: '%s'", data.networkId.c_str(),
-                    NetworkGetVersion().c_str());
-            }
-#endif
+            CheckNetworkId(data);
 
             serialiser << data.name;
             serialiser << data.timeRecorded;
@@ -755,6 +892,29 @@ namespace OpenRCT2
             serialiser << data.tickStart;
             serialiser << data.tickEnd;
 
+            if (!SerialiseDataBlock(serialiser, data))
+                return false;
+
+            serialiser << data.gameStateSnapshots;
+            return true;
+        }
+
+        bool SerialiseHeaderBlock(DataSerialiser& serialiser, ReplayRecordData& data)
+        {
+            serialiser << data.networkId;
+            serialiser << data.name;
+            serialiser << data.timeRecorded;
+            serialiser << data.parkData;
+            serialiser << data.parkParams;
+            serialiser << data.cheatData;
+            serialiser << data.tickStart;
+            serialiser << data.gameStateSnapshots;
+            return true;
+        }
+
+        // Appends to the commands and checksums when loading, blocks are read one after another.
+        bool SerialiseDataBlock(DataSerialiser& serialiser, ReplayRecordData& data)
+        {
             uint32_t countCommands = static_cast<uint32_t>(data.commands.size());
             serialiser << countCommands;
 
@@ -779,21 +939,234 @@ namespace OpenRCT2
             uint32_t countChecksums = static_cast<uint32_t>(data.checksums.size());
             serialiser << countChecksums;
 
+            const size_t firstChecksum = serialiser.IsLoading() ? data.checksums.size() : 0;
             if (serialiser.IsLoading())
             {
-                data.checksums.resize(countChecksums);
+                data.checksums.resize(firstChecksum + countChecksums);
             }
 
             for (uint32_t i = 0; i < countChecksums; i++)
             {
-                serialiser << data.checksums[i].first;
-                serialiser << data.checksums[i].second.raw;
+                serialiser << data.checksums[firstChecksum + i].first;
+                serialiser << data.checksums[firstChecksum + i].second.raw;
             }
+            return true;
+        }
 
+        bool SerialiseEndBlock(DataSerialiser& serialiser, ReplayRecordData& data)
+        {
+            serialiser << data.tickEnd;
             serialiser << data.gameStateSnapshots;
             return true;
         }
 
+        bool OpenRecordingFile(ReplayRecordData& data)
+        {
+            CloseRecordingFile();
+
+            _recordingFile = fopen(data.filePath.c_str(), "wb");
+            if (_recordingFile == nullptr)
+            {
+                LOG_ERROR("Unable to write to file '%s'", data.filePath.c_str());
+                return false;
+            }
+            _recordingFilePath = data.filePath;
+            _recordingWriteFailed = false;
+
+            DataSerialiser fileSerialiser(true);
+            fileSerialiser << data.magic;
+            fileSerialiser << data.version;
+            WriteRecordingData(fileSerialiser.GetStream().GetData(), fileSerialiser.GetStream().GetLength());
+
+            DataSerialiser headerSerialiser(true);
+            SerialiseHeaderBlock(headerSerialiser, data);
+            WriteRecordingBlock(ReplayBlockType::Header, headerSerialiser.GetStream());
+
+            if (_recordingWriteFailed)
+            {
+                CloseRecordingFile();
+                return false;
+            }
+            return true;
+        }
+
+        void CloseRecordingFile()
+        {
+            if (_recordingFile != nullptr)
+            {
+                fclose(_recordingFile);
+                _recordingFile = nullptr;
+            }
+        }
+
+        void WriteRecordingData(const void* data, size_t length)
+        {
+            if (_recordingFile == nullptr || _recordingWriteFailed)
+                return;
+
+            if (fwrite(data, 1, length, _recordingFile) != length)
+            {
+                LOG_ERROR("Unable to write to file '%s'", _recordingFilePath.c_str());
+                _recordingWriteFailed = true;
+            }
+        }
+
+        void WriteRecordingBlock(ReplayBlockType type, const IStream& block)
+        {
+            unsigned long blockLength = static_cast<unsigned long>(block.GetLength());
+            unsigned long compressLength = compressBound(blockLength);
+
+            auto compressBuf = std::make_unique<unsigned char[]>(compressLength);
+            compress2(
+                compressBuf.get(), &compressLength, static_cast<const unsigned char*>(block.GetData()), blockLength,
+                ReplayCompressionLevel);
+
+            DataSerialiser blockSerialiser(true);
+            blockSerialiser << EnumValue(type);
+            blockSerialiser << static_cast<uint32_t>(blockLength);
+            blockSerialiser << static_cast<uint32_t>(compressLength);
+            WriteRecordingData(blockSerialiser.GetStream().GetData(), blockSerialiser.GetStream().GetLength());
+            WriteRecordingData(compressBuf.get(), compressLength);
+
+            // Keep what has been recorded so far readable if the game stops without finishing the recording.
+            if (_recordingFile != nullptr)
+                fflush(_recordingFile);
+        }
+
+        void WriteDataBlock()
+        {
+            auto& data = *_currentRecording;
+            if (data.commands.empty() && data.checksums.empty())
+                return;
+
+            DataSerialiser dataSerialiser(true);
+            SerialiseDataBlock(dataSerialiser, data);
+            WriteRecordingBlock(ReplayBlockType::Data, dataSerialiser.GetStream());
+
+            data.numCommandsWritten += static_cast<uint32_t>(data.commands.size());
+            data.numChecksumsWritten += static_cast<uint32_t>(data.checksums.size());
+            data.commands.clear();
+            data.checksums.clear();
+        }
+
+        void WriteKeyframeBlock()
+        {
+            auto& gameState = GetGameState();
+
+            MemoryStream parkData;
+            auto exporter = std::make_unique<ParkFileExporter>();
+            exporter->ExportObjectsList = GetContext()->GetObjectManager().GetPackableObjects();
+            exporter->Export(gameState, parkData);
+
+            MemoryStream parkParams;
+            DataSerialiser parkParamsDs(true, parkParams);
+            SerialiseParkParameters(parkParamsDs);
+
+            MemoryStream cheatData;
+            DataSerialiser cheatDataDs(true, cheatData);
+            SerialiseCheats(cheatDataDs);
+
+            DataSerialiser keyframeSerialiser(true);
+            keyframeSerialiser << gameState.CurrentTicks;
+            keyframeSerialiser << parkData;
+            keyframeSerialiser << parkParams;
+            keyframeSerialiser << cheatData;
+            WriteRecordingBlock(ReplayBlockType::Keyframe, keyframeSerialiser.GetStream());
+        }
+
+        bool ReadReplayBlocks(MemoryStream& stream, ReplayRecordData& data)
+        {
+            static constexpr size_t BlockHeaderSize = sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint32_t);
+
+            stream.SetPosition(0);
+            DataSerialiser fileSerialiser(false, stream);
+            fileSerialiser << data.magic;
+            fileSerialiser << data.version;
+
+            bool hasHeader = false;
+            bool hasEnd = false;
+            while (stream.GetLength() - stream.GetPosition() >= BlockHeaderSize)
+            {
+                uint8_t blockType = 0;
+                uint32_t blockLength = 0;
+                uint32_t compressedLength = 0;
+                fileSerialiser << blockType;
+                fileSerialiser << blockLength;
+                fileSerialiser << compressedLength;
+
+                const auto blockStart = stream.GetPosition();
+                if (stream.GetLength() - blockStart < compressedLength)
+                {
+                    LOG_WARNING("Replay ends with an incomplete block.");
+                    break;
+                }
+
+                auto buff = std::make_unique<unsigned char[]>(blockLength);
+                unsigned long outSize = blockLength;
+                auto status = uncompress(
+                    buff.get(), &outSize, static_cast<const unsigned char*>(stream.GetData()) + blockStart, compressedLength);
+                if (status != Z_OK || outSize != blockLength)
+                {
+                    LOG_ERROR("Unable to decompress replay block.");
+                    return false;
+                }
+                stream.SetPosition(blockStart + compressedLength);
+
+                MemoryStream blockStream(buff.get(), outSize);
+                DataSerialiser blockSerialiser(false, blockStream);
+                switch (static_cast<ReplayBlockType>(blockType))
+                {
+                    case ReplayBlockType::Header:
+                        SerialiseHeaderBlock(blockSerialiser, data);
+                        CheckNetworkId(data);
+                        hasHeader = true;
+                        break;
+                    case ReplayBlockType::Data:
+                        if (!SerialiseDataBlock(blockSerialiser, data))
+                            return false;
+                        break;
+                    case ReplayBlockType::Keyframe:
+                    {
+                        // Keep it compressed, the park is only loaded when playback seeks to it.
+                        auto& keyframe = data.keyframes.emplace_back();
+                        blockSerialiser << keyframe.tick;
+                        keyframe.length = blockLength;
+                        keyframe.compressedData = MemoryStream(
+                            static_cast<const uint8_t*>(stream.GetData()) + blockStart, compressedLength);
+                        break;
+                    }
+                    case ReplayBlockType::End:
+                    {
+                        // The snapshot at the end follows the one from the header.
+                        MemoryStream endSnapshot;
+                        blockSerialiser << data.tickEnd;
+                        blockSerialiser << endSnapshot;
+                        data.gameStateSnapshots.Write(endSnapshot.GetData(), endSnapshot.GetLength());
+                        hasEnd = true;
+                        break;
+                    }
+                    default:
+                        LOG_WARNING("Skipping unknown replay block %u.", blockType);
+                        break;
+                }
+            }
+
+            if (!hasHeader)
+                return false;
+
+            if (!hasEnd)
+            {
+                // The recording was never stopped, play what made it to disk.
+                data.tickEnd = data.tickStart;
+                if (!data.commands.empty())
+                    data.tickEnd = std::max(data.tickEnd, data.commands.rbegin()->tick);
+                if (!data.checksums.empty())
+                    data.tickEnd = std::max(data.tickEnd, data.checksums.back().first);
+                LOG_WARNING("Replay recording was not finished, playing until tick %u.", data.tickEnd);
+            }
+            return true;
+        }
+
 #ifndef DISABLE_NETWORK
         void CheckState()
         {
@@ -834,13 +1207,14 @@ namespace OpenRCT2
 
         void ReplayCommands()
         {
-            auto& replayQueue = _currentReplay->commands;
+            auto& replay = *_currentReplay;
 
             const auto currentTicks = GetGameState().CurrentTicks;
 
-            while (replayQueue.begin() != replayQueue.end())
+            // Commands are kept after they have been replayed so playback can seek back to them.
+            while (replay.nextCommand != replay.commands.end())
             {
-                const ReplayCommand& command = (*replayQueue.begin());
+                const ReplayCommand& command = *replay.nextCommand;
 
                 if (_mode == ReplayMode::PLAYING)
                 {
@@ -876,7 +1250,7 @@ namespace OpenRCT2
                         WindowScrollToLocation(*mainWindow, result.Position);
                 }
 
-                replayQueue.erase(replayQueue.begin());
+                ++replay.nextCommand;
             }
         }
 
@@ -888,7 +1262,12 @@ namespace OpenRCT2
         uint32_t _commandId = 0;
         uint32_t _nextChecksumTick = 0;
         uint32_t _nextReplayTick = 0;
+        uint32_t _nextDataBlockTick = 0;
+        uint32_t _nextKeyframeTick = 0;
         RecordType _recordType = RecordType::NORMAL;
+        FILE* _recordingFile = nullptr;
+        std::string _recordingFilePath;
+        bool _recordingWriteFailed = false;
     };
 
     std::unique_ptr<IReplayManager> CreateReplayManager()
@@ -59,6 +59,9 @@ namespace OpenRCT2
         virtual bool GetCurrentReplayInfo(ReplayRecordInfo& info) const = 0;
 
         virtual bool StartPlayback(const std::string& file) = 0;
+        // Moves playback to the given number of ticks after the start of the replay. Starts from the closest keyframe
+        // before it unless playback is already closer.
+        virtual bool SeekPlayback(uint32_t replayTick) = 0;
         virtual bool IsPlaybackStateMismatching() const = 0;
         virtual bool StopPlayback() = 0;
 
@@ -621,7 +621,7 @@ void CheatSetAction::SetGuestParameter(int32_t parameter, int32_t value) const
         switch (parameter)
         {
             case GUEST_PARAMETER_HAPPINESS:
-                peep->Happiness = value;
+                peep->SetHappiness(value);
                 peep->HappinessTarget = value;
                 // Clear the 'red-faced with anger' status if we're making the guest happy
                 if (value > 0)
@@ -631,7 +631,7 @@ void CheatSetAction::SetGuestParameter(int32_t parameter, int32_t value) const
                 }
                 break;
             case GUEST_PARAMETER_ENERGY:
-                peep->Energy = value;
+                peep->SetEnergy(value);
                 peep->EnergyTarget = value;
                 break;
             case GUEST_PARAMETER_HUNGER:
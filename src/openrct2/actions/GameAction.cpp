@@ -18,19 +18,24 @@
 #include "../entity/MoneyEffect.h"
 #include "../localisation/Formatter.h"
 #include "../localisation/Localisation.h"
+#include "../network/ActionPrediction.h"
 #include "../network/network.h"
+#include "../peep/GuestPathfinding.h"
 #include "../platform/Platform.h"
 #include "../profiling/Profiling.h"
+#include "../profiling/Telemetry.h"
 #include "../scenario/Scenario.h"
 #include "../scripting/Duktape.hpp"
 #include "../scripting/HookEngine.h"
 #include "../scripting/ScriptEngine.h"
 #include "../ui/UiContext.h"
 #include "../ui/WindowManager.h"
+#include "../world/Map.h"
 #include "../world/Park.h"
 #include "../world/Scenery.h"
 
 #include <algorithm>
+#include <deque>
 #include <iterator>
 
 using namespace OpenRCT2;
@@ -63,7 +68,9 @@ namespace GameActions
         }
     };
 
-    static std::multiset<QueuedGameAction> _actionQueue;
+    // Kept sorted by tick and then by the order they were queued in. Nearly all actions are queued for the current or a
+    // later tick and go straight on the back, so the queue is only searched for the rare one that arrives late.
+    static std::deque<QueuedGameAction> _actionQueue;
     static uint32_t _nextUniqueId = 0;
     static bool _suspended = false;
 
@@ -91,7 +98,16 @@ namespace GameActions
             // as that normally happens when receiving them over network.
             ga->SetPlayer(NetworkGetCurrentPlayerId());
         }
-        _actionQueue.emplace(tick, std::move(ga), _nextUniqueId++);
+        QueuedGameAction queued(tick, std::move(ga), _nextUniqueId++);
+        if (_actionQueue.empty() || !(queued < _actionQueue.back()))
+        {
+            _actionQueue.push_back(std::move(queued));
+        }
+        else
+        {
+            auto it = std::upper_bound(_actionQueue.begin(), _actionQueue.end(), queued);
+            _actionQueue.insert(it, std::move(queued));
+        }
     }
 
     void ProcessQueue()
@@ -104,14 +120,14 @@ namespace GameActions
 
         const uint32_t currentTick = GetGameState().CurrentTicks;
 
-        while (_actionQueue.begin() != _actionQueue.end())
+        while (!_actionQueue.empty())
         {
             // run all the game commands at the current tick
-            const QueuedGameAction& queued = *_actionQueue.begin();
+            const QueuedGameAction& front = _actionQueue.front();
 
             if (NetworkGetMode() == NETWORK_MODE_CLIENT)
             {
-                if (queued.tick < currentTick)
+                if (front.tick < currentTick)
                 {
                     // This should never happen.
                     Guard::Assert(
@@ -119,14 +135,18 @@ namespace GameActions
                         "Discarding game action %s (%u) from tick behind current tick, ID: %08X, Action Tick: %08X, Current "
                         "Tick: "
                         "%08X\n",
-                        queued.action->GetName(), queued.action->GetType(), queued.uniqueId, queued.tick, currentTick);
+                        front.action->GetName(), front.action->GetType(), front.uniqueId, front.tick, currentTick);
                 }
-                else if (queued.tick > currentTick)
+                else if (front.tick > currentTick)
                 {
                     return;
                 }
             }
 
+            // Taken off the queue first, executing the action may queue further actions
+            QueuedGameAction queued = std::move(_actionQueue.front());
+            _actionQueue.pop_front();
+
             // Remove ghost scenery so it doesn't interfere with incoming network command
             switch (queued.action->GetType())
             {
@@ -145,20 +165,22 @@ namespace GameActions
 
             Guard::Assert(action != nullptr);
 
+            // Predicted ghosts are taken off the map so they can not interfere with the real action
+            NetworkPredictionBeginAuthoritative(*action);
             GameActions::Result result = Execute(action);
+            NetworkPredictionEndAuthoritative();
             if (result.Error == GameActions::Status::Ok && NetworkGetMode() == NETWORK_MODE_SERVER)
             {
                 // Relay this action to all other clients.
                 NetworkSendGameAction(action);
             }
-
-            _actionQueue.erase(_actionQueue.begin());
         }
     }
 
     void ClearQueue()
     {
         _actionQueue.clear();
+        NetworkClearPredictions();
     }
 
     GameAction::Ptr Clone(const GameAction* action)
@@ -166,12 +188,14 @@ namespace GameActions
         std::unique_ptr<GameAction> ga = GameActions::Create(action->GetType());
         ga->SetCallback(action->GetCallback());
 
-        // Serialise action data into stream.
-        DataSerialiser dsOut(true);
+        // Serialise action data into stream, the buffer is kept for the next clone.
+        static MemoryStream cloneStream;
+        cloneStream.Clear();
+        DataSerialiser dsOut(true, cloneStream);
         action->Serialise(dsOut);
 
         // Serialise into new action.
-        IStream& stream = dsOut.GetStream();
+        IStream& stream = cloneStream;
         stream.SetPosition(0);
 
         DataSerialiser dsIn(false, stream);
@@ -334,6 +358,7 @@ namespace GameActions
                     {
                         LOG_VERBOSE("[%s] GameAction::Execute %s (Out)", GetRealm(), action->GetName());
                         NetworkSendGameAction(action);
+                        NetworkPredictAction(*action);
 
                         return result;
                     }
@@ -358,6 +383,19 @@ namespace GameActions
 
             // Execute the action, changing the game state
             result = action->Execute();
+            Telemetry::RecordGameAction();
+            if (result.Error == GameActions::Status::Ok)
+            {
+                // Any action may have edited the footpaths the cached flow fields were built from.
+                PathFinding::FlowFieldInvalidateAll();
+                PathFinding::QueueLanesInvalidateAll();
+                PathFinding::PathRegionsInvalidate();
+                if (!result.Position.IsNull())
+                {
+                    MapInvalidatePathWideFlags(result.Position);
+                    MapInvalidateTileUpdates(result.Position);
+                }
+            }
 #ifdef ENABLE_SCRIPTING
             if (result.Error == GameActions::Status::Ok)
             {
@@ -484,10 +522,9 @@ bool GameAction::LocationValid(const CoordsXY& coords) const
     auto& hookEngine = GetContext()->GetScriptEngine().GetHookEngine();
     if (hookEngine.HasSubscriptions(OpenRCT2::Scripting::HOOK_TYPE::ACTION_LOCATION))
     {
-        auto ctx = GetContext()->GetScriptEngine().GetContext();
-
-        // Create event args object
-        auto obj = OpenRCT2::Scripting::DukObject(ctx);
+        // The hook fires for every location an action checks, so the event args object is reused
+        auto obj = OpenRCT2::Scripting::DukObject(
+            hookEngine.GetReusableArgs(OpenRCT2::Scripting::HOOK_TYPE::ACTION_LOCATION));
         obj.Set("x", coords.x);
         obj.Set("y", coords.y);
         obj.Set("player", _playerId);
@@ -66,11 +66,13 @@
 #include "RideSetSettingAction.h"
 #include "RideSetStatusAction.h"
 #include "RideSetVehicleAction.h"
+#include "RideSimulateTestAction.h"
 #include "ScenarioSetSettingAction.h"
 #include "ScenerySetRestrictedAction.h"
 #include "SignSetNameAction.h"
 #include "SignSetStyleAction.h"
 #include "SmallSceneryPlaceAction.h"
+#include "SmallSceneryPlaceBatchAction.h"
 #include "SmallSceneryRemoveAction.h"
 #include "SmallScenerySetColourAction.h"
 #include "StaffFireAction.h"
@@ -182,6 +184,7 @@ namespace GameActions
         REGISTER_ACTION(WallRemoveAction);
         REGISTER_ACTION(WallSetColourAction);
         REGISTER_ACTION(SmallSceneryPlaceAction);
+        REGISTER_ACTION(SmallSceneryPlaceBatchAction);
         REGISTER_ACTION(SmallSceneryRemoveAction);
         REGISTER_ACTION(SmallScenerySetColourAction);
         REGISTER_ACTION(LargeSceneryPlaceAction);
@@ -210,6 +213,7 @@ namespace GameActions
         REGISTER_ACTION(MapChangeSizeAction);
         REGISTER_ACTION(GameSetSpeedAction);
         REGISTER_ACTION(ScenerySetRestrictedAction);
+        REGISTER_ACTION(RideSimulateTestAction);
 #ifdef ENABLE_SCRIPTING
         REGISTER_ACTION(CustomAction);
 #endif
@@ -95,17 +95,19 @@ GameActions::Result LandBuyRightsAction::QueryExecute(bool isExecuting) const
         {
             if (!LocationValid({ x, y }))
                 continue;
+            auto* surfaceElement = MapGetSurfaceElementAt(CoordsXY{ x, y });
+            auto oldOwnership = surfaceElement != nullptr ? surfaceElement->GetOwnership() : 0;
             auto result = MapBuyLandRightsForTile({ x, y }, isExecuting);
             if (result.Error == GameActions::Status::Ok)
             {
                 res.Cost += result.Cost;
             }
+            if (isExecuting && surfaceElement != nullptr)
+            {
+                MapUpdateRemainingLandRights(oldOwnership, surfaceElement->GetOwnership());
+            }
         }
     }
-    if (isExecuting)
-    {
-        MapCountRemainingLandRights();
-    }
     return res;
 }
 
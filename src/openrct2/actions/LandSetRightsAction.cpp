@@ -95,17 +95,22 @@ GameActions::Result LandSetRightsAction::QueryExecute(bool isExecuting) const
         {
             if (!LocationValid({ x, y }))
                 continue;
+            auto* surfaceElement = MapGetSurfaceElementAt(CoordsXY{ x, y });
+            auto oldOwnership = surfaceElement != nullptr ? surfaceElement->GetOwnership() : 0;
             auto result = MapBuyLandRightsForTile({ x, y }, isExecuting);
             if (result.Error == GameActions::Status::Ok)
             {
                 res.Cost += result.Cost;
             }
+            if (isExecuting && surfaceElement != nullptr)
+            {
+                MapUpdateRemainingLandRights(oldOwnership, surfaceElement->GetOwnership());
+            }
         }
     }
 
     if (isExecuting)
     {
-        MapCountRemainingLandRights();
         OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::PlaceItem, centre);
     }
     return res;
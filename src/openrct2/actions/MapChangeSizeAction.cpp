@@ -51,16 +51,13 @@ GameActions::Result MapChangeSizeAction::Query() const
 GameActions::Result MapChangeSizeAction::Execute() const
 {
     auto& gameState = OpenRCT2::GetGameState();
-    // Expand map
-    while (_targetSize.x > gameState.MapSize.x)
-    {
-        gameState.MapSize.x++;
-        MapExtendBoundarySurfaceX();
-    }
-    while (_targetSize.y > gameState.MapSize.y)
+
+    // Expand map, the new tiles are written to directly so they need surfaces of their own. Shrinking leaves the
+    // shared surfaces alone and does not need this.
+    if (_targetSize.x > gameState.MapSize.x || _targetSize.y > gameState.MapSize.y)
     {
-        gameState.MapSize.y++;
-        MapExtendBoundarySurfaceY();
+        MapUnshareOutOfMapSurfaces();
+        MapExtendBoundarySurfaces(_targetSize);
     }
 
     // Shrink map
@@ -69,6 +66,7 @@ GameActions::Result MapChangeSizeAction::Execute() const
         gameState.MapSize = _targetSize;
         MapRemoveOutOfRangeElements();
     }
+    MapShareOutOfMapSurfaces();
 
     auto* ctx = OpenRCT2::GetContext();
     auto uiContext = ctx->GetUiContext();
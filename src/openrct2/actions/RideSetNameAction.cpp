@@ -13,6 +13,7 @@
 #include "../Context.h"
 #include "../core/MemoryStream.h"
 #include "../drawing/Drawing.h"
+#include "../entity/PeepStringCache.h"
 #include "../interface/Window.h"
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
@@ -84,6 +85,8 @@ GameActions::Result RideSetNameAction::Execute() const
     }
 
     ScrollingTextInvalidate();
+    // Guest thoughts about the ride mention it by name
+    PeepStringCacheInvalidateAll();
     GfxInvalidateScreen();
 
     // Refresh windows that display ride name
@@ -0,0 +1,104 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "RideSimulateTestAction.h"
+
+#include "../GameState.h"
+#include "../ride/Ride.h"
+#include "../ride/RideData.h"
+#include "../ride/RideRatings.h"
+#include "../ride/Station.h"
+#include "../ride/Vehicle.h"
+
+using namespace OpenRCT2;
+
+// Ten in-game minutes, far longer than any test circuit takes
+static constexpr uint32_t kMaxSimulatedTestTicks = 10 * 60 * 40;
+
+RideSimulateTestAction::RideSimulateTestAction(RideId rideIndex)
+    : _rideIndex(rideIndex)
+{
+}
+
+void RideSimulateTestAction::AcceptParameters(GameActionParameterVisitor& visitor)
+{
+    visitor.Visit("ride", _rideIndex);
+}
+
+void RideSimulateTestAction::Serialise(DataSerialiser& stream)
+{
+    GameAction::Serialise(stream);
+    stream << DS_TAG(_rideIndex);
+}
+
+GameActions::Result RideSimulateTestAction::Query() const
+{
+    auto ride = GetRide(_rideIndex);
+    if (ride == nullptr)
+    {
+        LOG_ERROR("Ride not found for rideIndex %u", _rideIndex.ToUnderlying());
+        return GameActions::Result(GameActions::Status::InvalidParameters, STR_ERR_INVALID_PARAMETER, STR_ERR_RIDE_NOT_FOUND);
+    }
+
+    if (ride->status != RideStatus::Testing || ride->NumTrains == 0)
+    {
+        LOG_ERROR("Ride %u is not being tested", _rideIndex.ToUnderlying());
+        return GameActions::Result(GameActions::Status::Disallowed, STR_CANT_TEST, STR_NONE);
+    }
+
+    return GameActions::Result();
+}
+
+GameActions::Result RideSimulateTestAction::Execute() const
+{
+    auto ride = GetRide(_rideIndex);
+    if (ride == nullptr)
+    {
+        LOG_ERROR("Ride not found for rideIndex %u", _rideIndex.ToUnderlying());
+        return GameActions::Result(GameActions::Status::InvalidParameters, STR_ERR_INVALID_PARAMETER, STR_ERR_RIDE_NOT_FOUND);
+    }
+
+    // Only the stations and trains of this ride are stepped, the ticks they see are simulated and the park's own
+    // tick counter is restored afterwards so the rest of the park is unaware of the run.
+    auto& gameState = GetGameState();
+    const auto currentTicks = gameState.CurrentTicks;
+    const auto& rtd = ride->GetRideTypeDescriptor();
+    for (uint32_t tick = 0; tick < kMaxSimulatedTestTicks; tick++)
+    {
+        if (ride->status != RideStatus::Testing || (ride->lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
+            break;
+        if (ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED)
+            break;
+
+        gameState.CurrentTicks = currentTicks + tick;
+
+        if (!rtd.HasFlag(RIDE_TYPE_FLAG_IS_MAZE))
+            for (StationIndex::UnderlyingType i = 0; i < OpenRCT2::Limits::MaxStationsPerRide; i++)
+                RideUpdateStation(*ride, StationIndex::FromUnderlying(i));
+
+        for (int32_t i = 0; i < ride->NumTrains; i++)
+        {
+            auto* vehicle = GetEntity<Vehicle>(ride->vehicles[i]);
+            if (vehicle != nullptr && vehicle->IsHead())
+            {
+                vehicle->Update();
+            }
+        }
+    }
+    gameState.CurrentTicks = currentTicks;
+
+    if (ride->lifecycle_flags & RIDE_LIFECYCLE_TESTED)
+    {
+        RideRatingsUpdateRide(*ride);
+    }
+
+    WindowInvalidateByNumber(WindowClass::Ride, _rideIndex.ToUnderlying());
+
+    return GameActions::Result();
+}
@@ -0,0 +1,28 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "GameAction.h"
+
+class RideSimulateTestAction final : public GameActionBase<GameCommand::SimulateRideTest>
+{
+private:
+    RideId _rideIndex{ RideId::GetNull() };
+
+public:
+    RideSimulateTestAction() = default;
+    RideSimulateTestAction(RideId rideIndex);
+
+    void AcceptParameters(GameActionParameterVisitor& visitor) override;
+
+    void Serialise(DataSerialiser& stream) override;
+    GameActions::Result Query() const override;
+    GameActions::Result Execute() const override;
+};
@@ -65,6 +65,11 @@ uint16_t SmallSceneryPlaceAction::GetActionFlags() const
     return GameAction::GetActionFlags();
 }
 
+ObjectEntryIndex SmallSceneryPlaceAction::GetSceneryType() const
+{
+    return _sceneryType;
+}
+
 void SmallSceneryPlaceAction::Serialise(DataSerialiser& stream)
 {
     GameAction::Serialise(stream);
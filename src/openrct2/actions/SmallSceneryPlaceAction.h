@@ -39,6 +39,7 @@ public:
 
     uint32_t GetCooldownTime() const override;
     uint16_t GetActionFlags() const override;
+    ObjectEntryIndex GetSceneryType() const;
 
     void Serialise(DataSerialiser& stream) override;
     GameActions::Result Query() const override;
@@ -0,0 +1,139 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "SmallSceneryPlaceBatchAction.h"
+
+#include "../localisation/Formatter.h"
+#include "../localisation/StringIds.h"
+#include "../management/Finance.h"
+#include "../object/ObjectEntryManager.h"
+#include "../object/SmallSceneryEntry.h"
+#include "SmallSceneryPlaceAction.h"
+
+using namespace OpenRCT2;
+
+SmallSceneryPlaceBatchAction::SmallSceneryPlaceBatchAction(
+    std::vector<SmallSceneryPlaceBatchEntry> batch, ObjectEntryIndex sceneryType, uint8_t primaryColour,
+    uint8_t secondaryColour, uint8_t tertiaryColour)
+    : _sceneryType(sceneryType)
+    , _primaryColour(primaryColour)
+    , _secondaryColour(secondaryColour)
+    , _tertiaryColour(tertiaryColour)
+    , _batch(std::move(batch))
+{
+}
+
+void SmallSceneryPlaceBatchAction::AcceptParameters(GameActionParameterVisitor& visitor)
+{
+    visitor.Visit("object", _sceneryType);
+    visitor.Visit("primaryColour", _primaryColour);
+    visitor.Visit("secondaryColour", _secondaryColour);
+    visitor.Visit("tertiaryColour", _tertiaryColour);
+}
+
+uint32_t SmallSceneryPlaceBatchAction::GetCooldownTime() const
+{
+    return 20;
+}
+
+uint16_t SmallSceneryPlaceBatchAction::GetActionFlags() const
+{
+    return GameAction::GetActionFlags();
+}
+
+void SmallSceneryPlaceBatchAction::Serialise(DataSerialiser& stream)
+{
+    GameAction::Serialise(stream);
+
+    stream << DS_TAG(_sceneryType) << DS_TAG(_primaryColour) << DS_TAG(_secondaryColour) << DS_TAG(_tertiaryColour);
+
+    auto batchSize = static_cast<uint16_t>(std::min(_batch.size(), kMaxBatchSize));
+    stream << DS_TAG(batchSize);
+    if (stream.IsLoading())
+    {
+        _batch.resize(batchSize);
+    }
+    for (uint16_t i = 0; i < batchSize; i++)
+    {
+        auto& entry = _batch[i];
+        stream << DS_TAG(entry.Loc) << DS_TAG(entry.Quadrant);
+    }
+}
+
+GameActions::Result SmallSceneryPlaceBatchAction::Query() const
+{
+    return QueryExecute(false);
+}
+
+GameActions::Result SmallSceneryPlaceBatchAction::Execute() const
+{
+    return QueryExecute(true);
+}
+
+GameActions::Result SmallSceneryPlaceBatchAction::QueryExecute(bool isExecuting) const
+{
+    if (_batch.empty() || _batch.size() > kMaxBatchSize)
+    {
+        return GameActions::Result(GameActions::Status::InvalidParameters, STR_CANT_POSITION_THIS_HERE, STR_NONE);
+    }
+
+    // Checked once for the whole batch rather than by every piece
+    auto* sceneryEntry = ObjectManager::GetObjectEntry<SmallSceneryEntry>(_sceneryType);
+    if (sceneryEntry == nullptr)
+    {
+        return GameActions::Result(GameActions::Status::InvalidParameters, STR_CANT_POSITION_THIS_HERE, STR_NONE);
+    }
+
+    auto res = GameActions::Result();
+    res.Expenditure = ExpenditureType::Landscaping;
+
+    GameActions::Result lastError;
+    size_t numPlaced = 0;
+    for (const auto& entry : _batch)
+    {
+        auto placeAction = SmallSceneryPlaceAction(
+            entry.Loc, entry.Quadrant, _sceneryType, _primaryColour, _secondaryColour, _tertiaryColour);
+        placeAction.SetFlags(GetFlags());
+
+        // When executing, each piece is queried against the map with the pieces before it already placed
+        auto placeResult = GameActions::QueryNested(&placeAction);
+        if (placeResult.Error == GameActions::Status::Ok && !FinanceCheckAffordability(res.Cost + placeResult.Cost, GetFlags()))
+        {
+            placeResult.Error = GameActions::Status::InsufficientFunds;
+            placeResult.ErrorTitle = STR_CANT_POSITION_THIS_HERE;
+            placeResult.ErrorMessage = STR_NOT_ENOUGH_CASH_REQUIRES;
+            Formatter(placeResult.ErrorMessageArgs.data()).Add<uint32_t>(res.Cost + placeResult.Cost);
+        }
+        if (placeResult.Error == GameActions::Status::Ok && isExecuting)
+        {
+            placeResult = GameActions::ExecuteNested(&placeAction);
+        }
+
+        if (placeResult.Error != GameActions::Status::Ok)
+        {
+            lastError = std::move(placeResult);
+            if (lastError.Error == GameActions::Status::InsufficientFunds)
+                break;
+            continue;
+        }
+
+        if (numPlaced == 0)
+        {
+            res.Position = placeResult.Position;
+        }
+        res.Cost += placeResult.Cost;
+        numPlaced++;
+    }
+
+    if (numPlaced == 0)
+    {
+        return lastError;
+    }
+    return res;
+}
@@ -0,0 +1,57 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../world/TileElement.h"
+#include "GameAction.h"
+
+#include <vector>
+
+// One piece of scenery of a batch, the values have the same meaning as for a single SmallSceneryPlaceAction.
+struct SmallSceneryPlaceBatchEntry
+{
+    CoordsXYZD Loc;
+    uint8_t Quadrant{};
+};
+
+/**
+ * Places many pieces of the same small scenery with the same colours, e.g. for the scatter tool. Each piece is placed
+ * by a nested SmallSceneryPlaceAction; pieces that can not be placed are skipped and the rest are placed for as long as
+ * they can be afforded. The action fails only if none of the pieces can be placed.
+ */
+class SmallSceneryPlaceBatchAction final : public GameActionBase<GameCommand::PlaceSceneryBatch>
+{
+private:
+    ObjectEntryIndex _sceneryType{};
+    uint8_t _primaryColour{};
+    uint8_t _secondaryColour{};
+    uint8_t _tertiaryColour{};
+    std::vector<SmallSceneryPlaceBatchEntry> _batch;
+
+public:
+    static constexpr size_t kMaxBatchSize = 4096;
+
+    SmallSceneryPlaceBatchAction() = default;
+    SmallSceneryPlaceBatchAction(
+        std::vector<SmallSceneryPlaceBatchEntry> batch, ObjectEntryIndex sceneryType, uint8_t primaryColour,
+        uint8_t secondaryColour, uint8_t tertiaryColour);
+
+    void AcceptParameters(GameActionParameterVisitor& visitor) override;
+
+    uint32_t GetCooldownTime() const override;
+    uint16_t GetActionFlags() const override;
+
+    void Serialise(DataSerialiser& stream) override;
+    GameActions::Result Query() const override;
+    GameActions::Result Execute() const override;
+
+private:
+    GameActions::Result QueryExecute(bool isExecuting) const;
+};
@@ -196,6 +196,7 @@ GameActions::Result SurfaceSetStyleAction::Execute() const
                         surfaceCost += surfaceObject->Price;
 
                         surfaceElement->SetSurfaceObjectIndex(_surfaceStyle);
+                        MapInvalidateTileUpdates(coords);
 
                         MapInvalidateTileFull(coords);
                         FootpathRemoveLitter({ coords, TileElementHeight(coords) });
@@ -13,6 +13,9 @@
 #include "../windows/Intent.h"
 #include "../world/TileInspector.h"
 
+#include <algorithm>
+#include <tuple>
+
 using namespace OpenRCT2;
 
 TileModifyAction::TileModifyAction(
@@ -26,6 +29,16 @@ TileModifyAction::TileModifyAction(
 {
 }
 
+TileModifyAction::TileModifyAction(std::vector<TileModifyEntry> batch)
+    : _setting(TileModifyType::Batch)
+    , _batch(std::move(batch))
+{
+    if (!_batch.empty())
+    {
+        _loc = _batch.front().Loc;
+    }
+}
+
 void TileModifyAction::AcceptParameters(GameActionParameterVisitor& visitor)
 {
     visitor.Visit(_loc);
@@ -45,6 +58,19 @@ void TileModifyAction::Serialise(DataSerialiser& stream)
 
     stream << DS_TAG(_loc) << DS_TAG(_setting) << DS_TAG(_value1) << DS_TAG(_value2) << DS_TAG(_pasteElement)
            << DS_TAG(_pasteBanner);
+
+    auto batchSize = static_cast<uint16_t>(std::min(_batch.size(), kMaxBatchSize));
+    stream << DS_TAG(batchSize);
+    if (stream.IsLoading())
+    {
+        _batch.resize(batchSize);
+    }
+    for (uint16_t i = 0; i < batchSize; i++)
+    {
+        auto& modification = _batch[i];
+        stream << DS_TAG(modification.Loc) << DS_TAG(modification.Setting) << DS_TAG(modification.Value1)
+               << DS_TAG(modification.Value2);
+    }
 }
 
 GameActions::Result TileModifyAction::Query() const
@@ -59,191 +85,252 @@ GameActions::Result TileModifyAction::Execute() const
 
 GameActions::Result TileModifyAction::QueryExecute(bool isExecuting) const
 {
-    if (!LocationValid(_loc))
+    auto res = GameActions::Result();
+    if (_setting == TileModifyType::Batch)
+    {
+        if (_batch.empty() || _batch.size() > kMaxBatchSize)
+        {
+            return GameActions::Result(
+                GameActions::Status::InvalidParameters, STR_ERR_INVALID_PARAMETER, STR_ERR_VALUE_OUT_OF_RANGE);
+        }
+
+        // Each modification is checked against the map as it is before the batch. Two modifications of the same tile
+        // could pass that check and still fail halfway through the execute, so a batch may only touch a tile once.
+        std::vector<CoordsXY> tiles;
+        tiles.reserve(_batch.size());
+        for (const auto& modification : _batch)
+        {
+            if (modification.Setting == TileModifyType::Batch || modification.Setting == TileModifyType::AnyPaste)
+            {
+                return GameActions::Result(
+                    GameActions::Status::InvalidParameters, STR_ERR_INVALID_PARAMETER, STR_ERR_VALUE_OUT_OF_RANGE);
+            }
+            tiles.push_back(modification.Loc.ToTileStart());
+        }
+        std::sort(tiles.begin(), tiles.end(), [](const CoordsXY& a, const CoordsXY& b) {
+            return std::tie(a.x, a.y) < std::tie(b.x, b.y);
+        });
+        if (std::adjacent_find(tiles.begin(), tiles.end()) != tiles.end())
+        {
+            return GameActions::Result(
+                GameActions::Status::InvalidParameters, STR_ERR_INVALID_PARAMETER, STR_ERR_VALUE_OUT_OF_RANGE);
+        }
+
+        for (const auto& modification : _batch)
+        {
+
+            res = QueryExecuteModification(
+                modification.Loc, modification.Setting, modification.Value1, modification.Value2, isExecuting);
+            if (res.Error != GameActions::Status::Ok)
+            {
+                return res;
+            }
+        }
+    }
+    else
+    {
+        res = QueryExecuteModification(_loc, _setting, _value1, _value2, isExecuting);
+        if (res.Error != GameActions::Status::Ok)
+        {
+            return res;
+        }
+    }
+
+    if (isExecuting)
+    {
+        auto intent = Intent(INTENT_ACTION_TILE_MODIFY);
+        ContextBroadcastIntent(&intent);
+    }
+
+    return res;
+}
+
+GameActions::Result TileModifyAction::QueryExecuteModification(
+    const CoordsXY& loc, TileModifyType setting, uint32_t value1, uint32_t value2, bool isExecuting) const
+{
+    if (!LocationValid(loc))
     {
         return GameActions::Result(GameActions::Status::InvalidParameters, STR_CANT_CHANGE_THIS, STR_OFF_EDGE_OF_MAP);
     }
     auto res = GameActions::Result();
-    switch (_setting)
+    switch (setting)
     {
         case TileModifyType::AnyRemove:
         {
-            const auto elementIndex = _value1;
-            res = TileInspector::RemoveElementAt(_loc, elementIndex, isExecuting);
+            const auto elementIndex = value1;
+            res = TileInspector::RemoveElementAt(loc, elementIndex, isExecuting);
             break;
         }
         case TileModifyType::AnySwap:
         {
-            const auto firstIndex = _value1;
-            const auto secondIndex = _value2;
-            res = TileInspector::SwapElementsAt(_loc, firstIndex, secondIndex, isExecuting);
+            const auto firstIndex = value1;
+            const auto secondIndex = value2;
+            res = TileInspector::SwapElementsAt(loc, firstIndex, secondIndex, isExecuting);
             break;
         }
         case TileModifyType::AnyToggleInvisilibity:
         {
-            const auto elementIndex = _value1;
-            res = TileInspector::ToggleInvisibilityOfElementAt(_loc, elementIndex, isExecuting);
+            const auto elementIndex = value1;
+            res = TileInspector::ToggleInvisibilityOfElementAt(loc, elementIndex, isExecuting);
             break;
         }
         case TileModifyType::AnyRotate:
         {
-            const auto elementIndex = _value1;
-            res = TileInspector::RotateElementAt(_loc, elementIndex, isExecuting);
+            const auto elementIndex = value1;
+            res = TileInspector::RotateElementAt(loc, elementIndex, isExecuting);
             break;
         }
         case TileModifyType::AnyPaste:
         {
-            res = TileInspector::PasteElementAt(_loc, _pasteElement, _pasteBanner, isExecuting);
+            res = TileInspector::PasteElementAt(loc, _pasteElement, _pasteBanner, isExecuting);
             break;
         }
         case TileModifyType::AnySort:
         {
-            res = TileInspector::SortElementsAt(_loc, isExecuting);
+            res = TileInspector::SortElementsAt(loc, isExecuting);
             break;
         }
         case TileModifyType::AnyBaseHeightOffset:
         {
-            const auto elementIndex = _value1;
-            const auto heightOffset = _value2;
-            res = TileInspector::AnyBaseHeightOffset(_loc, elementIndex, heightOffset, isExecuting);
+            const auto elementIndex = value1;
+            const auto heightOffset = value2;
+            res = TileInspector::AnyBaseHeightOffset(loc, elementIndex, heightOffset, isExecuting);
             break;
         }
         case TileModifyType::SurfaceShowParkFences:
         {
-            const bool showFences = _value1;
-            res = TileInspector::SurfaceShowParkFences(_loc, showFences, isExecuting);
+            const bool showFences = value1;
+            res = TileInspector::SurfaceShowParkFences(loc, showFences, isExecuting);
             break;
         }
         case TileModifyType::SurfaceToggleCorner:
         {
-            const auto cornerIndex = _value1;
-            res = TileInspector::SurfaceToggleCorner(_loc, cornerIndex, isExecuting);
+            const auto cornerIndex = value1;
+            res = TileInspector::SurfaceToggleCorner(loc, cornerIndex, isExecuting);
             break;
         }
         case TileModifyType::SurfaceToggleDiagonal:
         {
-            res = TileInspector::SurfaceToggleDiagonal(_loc, isExecuting);
+            res = TileInspector::SurfaceToggleDiagonal(loc, isExecuting);
             break;
         }
         case TileModifyType::PathSetSlope:
         {
-            const auto elementIndex = _value1;
-            const bool sloped = _value2;
-            res = TileInspector::PathSetSloped(_loc, elementIndex, sloped, isExecuting);
+            const auto elementIndex = value1;
+            const bool sloped = value2;
+            res = TileInspector::PathSetSloped(loc, elementIndex, sloped, isExecuting);
             break;
         }
         case TileModifyType::PathSetJunctionRailings:
         {
-            const auto elementIndex = _value1;
-            const bool hasJunctionRailing = _value2;
-            res = TileInspector::PathSetJunctionRailings(_loc, elementIndex, hasJunctionRailing, isExecuting);
+            const auto elementIndex = value1;
+            const bool hasJunctionRailing = value2;
+            res = TileInspector::PathSetJunctionRailings(loc, elementIndex, hasJunctionRailing, isExecuting);
             break;
         }
         case TileModifyType::PathSetBroken:
         {
-            const auto elementIndex = _value1;
-            const bool broken = _value2;
-            res = TileInspector::PathSetBroken(_loc, elementIndex, broken, isExecuting);
+            const auto elementIndex = value1;
+            const bool broken = value2;
+            res = TileInspector::PathSetBroken(loc, elementIndex, broken, isExecuting);
             break;
         }
         case TileModifyType::PathToggleEdge:
         {
-            const auto elementIndex = _value1;
-            const auto edgeIndex = _value2;
-            res = TileInspector::PathToggleEdge(_loc, elementIndex, edgeIndex, isExecuting);
+            const auto elementIndex = value1;
+            const auto edgeIndex = value2;
+            res = TileInspector::PathToggleEdge(loc, elementIndex, edgeIndex, isExecuting);
             break;
         }
         case TileModifyType::EntranceMakeUsable:
         {
-            const auto elementIndex = _value1;
-            res = TileInspector::EntranceMakeUsable(_loc, elementIndex, isExecuting);
+            const auto elementIndex = value1;
+            res = TileInspector::EntranceMakeUsable(loc, elementIndex, isExecuting);
             break;
         }
         case TileModifyType::WallSetSlope:
         {
-            const auto elementIndex = _value1;
-            const auto slopeValue = _value2;
-            res = TileInspector::WallSetSlope(_loc, elementIndex, slopeValue, isExecuting);
+            const auto elementIndex = value1;
+            const auto slopeValue = value2;
+            res = TileInspector::WallSetSlope(loc, elementIndex, slopeValue, isExecuting);
             break;
         }
         case TileModifyType::WallSetAnimationFrame:
         {
-            const auto elementIndex = _value1;
-            const auto animationFrameOffset = _value2;
-            res = TileInspector::WallAnimationFrameOffset(_loc, elementIndex, animationFrameOffset, isExecuting);
+            const auto elementIndex = value1;
+            const auto animationFrameOffset = value2;
+            res = TileInspector::WallAnimationFrameOffset(loc, elementIndex, animationFrameOffset, isExecuting);
             break;
         }
         case TileModifyType::TrackBaseHeightOffset:
         {
-            const auto elementIndex = _value1;
-            const auto heightOffset = _value2;
-            res = TileInspector::TrackBaseHeightOffset(_loc, elementIndex, heightOffset, isExecuting);
+            const auto elementIndex = value1;
+            const auto heightOffset = value2;
+            res = TileInspector::TrackBaseHeightOffset(loc, elementIndex, heightOffset, isExecuting);
             break;
         }
         case TileModifyType::TrackSetChainBlock:
         {
-            const auto elementIndex = _value1;
-            const bool setChain = _value2;
-            res = TileInspector::TrackSetChain(_loc, elementIndex, true, setChain, isExecuting);
+            const auto elementIndex = value1;
+            const bool setChain = value2;
+            res = TileInspector::TrackSetChain(loc, elementIndex, true, setChain, isExecuting);
             break;
         }
         case TileModifyType::TrackSetChain:
         {
-            const auto elementIndex = _value1;
-            const bool setChain = _value2;
-            res = TileInspector::TrackSetChain(_loc, elementIndex, false, setChain, isExecuting);
+            const auto elementIndex = value1;
+            const bool setChain = value2;
+            res = TileInspector::TrackSetChain(loc, elementIndex, false, setChain, isExecuting);
             break;
         }
         case TileModifyType::TrackSetBrake:
         {
-            const auto elementIndex = _value1;
-            const bool isClosed = _value2;
-            res = TileInspector::TrackSetBrakeClosed(_loc, elementIndex, isClosed, isExecuting);
+            const auto elementIndex = value1;
+            const bool isClosed = value2;
+            res = TileInspector::TrackSetBrakeClosed(loc, elementIndex, isClosed, isExecuting);
             break;
         }
         case TileModifyType::TrackSetIndestructible:
         {
-            const auto elementIndex = _value1;
-            const bool isIndestructible = _value2;
-            res = TileInspector::TrackSetIndestructible(_loc, elementIndex, isIndestructible, isExecuting);
+            const auto elementIndex = value1;
+            const bool isIndestructible = value2;
+            res = TileInspector::TrackSetIndestructible(loc, elementIndex, isIndestructible, isExecuting);
             break;
         }
         case TileModifyType::ScenerySetQuarterLocation:
         {
-            const auto elementIndex = _value1;
-            const auto quarterIndex = _value2;
-            res = TileInspector::ScenerySetQuarterLocation(_loc, elementIndex, quarterIndex, isExecuting);
+            const auto elementIndex = value1;
+            const auto quarterIndex = value2;
+            res = TileInspector::ScenerySetQuarterLocation(loc, elementIndex, quarterIndex, isExecuting);
             break;
         }
         case TileModifyType::ScenerySetQuarterCollision:
         {
-            const auto elementIndex = _value1;
-            const auto quarterIndex = _value2;
-            res = TileInspector::ScenerySetQuarterCollision(_loc, elementIndex, quarterIndex, isExecuting);
+            const auto elementIndex = value1;
+            const auto quarterIndex = value2;
+            res = TileInspector::ScenerySetQuarterCollision(loc, elementIndex, quarterIndex, isExecuting);
             break;
         }
         case TileModifyType::BannerToggleBlockingEdge:
         {
-            const auto elementIndex = _value1;
-            const auto edgeIndex = _value2;
-            res = TileInspector::BannerToggleBlockingEdge(_loc, elementIndex, edgeIndex, isExecuting);
+            const auto elementIndex = value1;
+            const auto edgeIndex = value2;
+            res = TileInspector::BannerToggleBlockingEdge(loc, elementIndex, edgeIndex, isExecuting);
             break;
         }
         default:
-            LOG_ERROR("Invalid tile modification type %u", _setting);
+            LOG_ERROR("Invalid tile modification type %u", setting);
             return GameActions::Result(
                 GameActions::Status::InvalidParameters, STR_ERR_INVALID_PARAMETER, STR_ERR_VALUE_OUT_OF_RANGE);
     }
 
-    res.Position.x = _loc.x;
-    res.Position.y = _loc.y;
-    res.Position.z = TileElementHeight(_loc);
+    res.Position.x = loc.x;
+    res.Position.y = loc.y;
+    res.Position.z = TileElementHeight(loc);
 
     if (isExecuting)
     {
-        MapInvalidateTileFull(_loc);
-        auto intent = Intent(INTENT_ACTION_TILE_MODIFY);
-        ContextBroadcastIntent(&intent);
+        MapInvalidateTileFull(loc);
     }
 
     return res;
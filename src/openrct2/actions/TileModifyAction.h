@@ -38,9 +38,20 @@ enum class TileModifyType : uint8_t
     ScenerySetQuarterLocation,
     ScenerySetQuarterCollision,
     BannerToggleBlockingEdge,
+    // Applies the modifications of the batch, see TileModifyEntry.
+    Batch,
     Count,
 };
 
+// One modification of a batch, the values have the same meaning as for a single TileModifyAction.
+struct TileModifyEntry
+{
+    CoordsXY Loc;
+    TileModifyType Setting{};
+    uint32_t Value1{};
+    uint32_t Value2{};
+};
+
 class TileModifyAction final : public GameActionBase<GameCommand::ModifyTile>
 {
 private:
@@ -50,12 +61,16 @@ private:
     uint32_t _value2{};
     TileElement _pasteElement{};
     Banner _pasteBanner{};
+    std::vector<TileModifyEntry> _batch;
 
 public:
+    static constexpr size_t kMaxBatchSize = 4096;
+
     TileModifyAction() = default;
     TileModifyAction(
         CoordsXY loc, TileModifyType setting, uint32_t value1 = 0, uint32_t value2 = 0, TileElement pasteElement = {},
         Banner _pasteBanner = {});
+    explicit TileModifyAction(std::vector<TileModifyEntry> batch);
 
     void AcceptParameters(GameActionParameterVisitor& visitor) override;
 
@@ -67,4 +82,6 @@ public:
 
 private:
     GameActions::Result QueryExecute(bool isExecuting) const;
+    GameActions::Result QueryExecuteModification(
+        const CoordsXY& loc, TileModifyType setting, uint32_t value1, uint32_t value2, bool isExecuting) const;
 };
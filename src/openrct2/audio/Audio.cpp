@@ -482,18 +482,7 @@ namespace OpenRCT2::Audio
             return nullptr;
         }
 
-        mixer->Lock();
-        auto channel = mixer->Play(source, loop ? kMixerLoopInfinite : kMixerLoopNone, forget);
-        if (channel != nullptr)
-        {
-            channel->SetGroup(group);
-            channel->SetVolume(volume);
-            channel->SetPan(pan);
-            channel->SetRate(rate);
-            channel->UpdateOldVolume();
-        }
-        mixer->Unlock();
-        return channel;
+        return mixer->Play(source, loop ? kMixerLoopInfinite : kMixerLoopNone, forget, group, volume, pan, rate);
     }
 
     int32_t DStoMixerVolume(int32_t volume)
@@ -40,7 +40,14 @@ namespace OpenRCT2::Audio
         virtual void Close() = 0;
         virtual void Lock() = 0;
         virtual void Unlock() = 0;
-        virtual std::shared_ptr<IAudioChannel> Play(IAudioSource* source, int32_t loop, bool deleteondone) = 0;
+        /**
+         * Creates a channel with the given settings and queues it for the mixer. The channel is fully set up before
+         * the mixer can see it, so callers do not need to hold the mixer lock.
+         */
+        virtual std::shared_ptr<IAudioChannel> Play(
+            IAudioSource* source, int32_t loop, bool deleteondone, MixerGroup group = MixerGroup::Sound,
+            int32_t volume = kMixerVolumeMax, float pan = 0.5f, double rate = 1)
+            = 0;
         virtual void SetVolume(float volume) = 0;
     };
 } // namespace OpenRCT2::Audio
@@ -0,0 +1,45 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../interface/Screenshot.h"
+#include "CommandLine.hpp"
+
+static GfxBenchOptions _options;
+
+// clang-format off
+static constexpr CommandLineOptionDefinition BenchGfxOptionsDef[]
+{
+    { CMDLINE_TYPE_INTEGER, &_options.iterations, NAC, "iterations", "number of times to render every camera of the path" },
+    { CMDLINE_TYPE_INTEGER, &_options.width,      NAC, "width",      "width of the rendered frames"                      },
+    { CMDLINE_TYPE_INTEGER, &_options.height,     NAC, "height",     "height of the rendered frames"                     },
+    { CMDLINE_TYPE_SWITCH,  &_options.json,       NAC, "json",       "print the results as JSON"                         },
+    OptionTableEnd
+};
+
+static exitcode_t HandleBenchGfx(CommandLineArgEnumerator *argEnumerator);
+
+const CommandLineCommand CommandLine::BenchGfxCommands[]
+{
+    // Main commands
+    DefineCommand("", "<file> [<camera_path>]", BenchGfxOptionsDef, HandleBenchGfx),
+    CommandTableEnd
+};
+// clang-format on
+
+static exitcode_t HandleBenchGfx(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CommandLineForGfxbench(argv, argc, _options);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
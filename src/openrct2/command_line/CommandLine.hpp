@@ -117,13 +117,22 @@ namespace CommandLine
     extern const CommandLineCommand ScreenshotCommands[];
     extern const CommandLineCommand SpriteCommands[];
     extern const CommandLineCommand SimulateCommands[];
+    extern const CommandLineCommand BenchSimulateCommands[];
+    extern const CommandLineCommand BenchGfxCommands[];
+    extern const CommandLineCommand BenchReplayCommands[];
     extern const CommandLineCommand ParkInfoCommands[];
+    extern const CommandLineCommand StressParkCommands[];
 
     extern const CommandLineExample RootExamples[];
 
     void PrintHelp(bool allCommands = false);
     exitcode_t HandleCommandDefault();
 
+    // Options for converting a directory of parks, see HandleCommandConvert.
+    extern int32_t gConvertJobs;
+    extern int32_t gConvertJobIndex;
+
     exitcode_t HandleCommandConvert(CommandLineArgEnumerator* enumerator);
+    exitcode_t HandleCommandGenerate(CommandLineArgEnumerator* enumerator);
     exitcode_t HandleCommandUri(CommandLineArgEnumerator* enumerator);
 } // namespace CommandLine
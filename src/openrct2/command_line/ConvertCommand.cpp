@@ -14,17 +14,25 @@
 #include "../ParkImporter.h"
 #include "../common.h"
 #include "../core/Console.hpp"
+#include "../core/FileScanner.h"
 #include "../core/Path.hpp"
+#include "../core/String.hpp"
 #include "../interface/Window.h"
 #include "../object/ObjectManager.h"
 #include "../park/ParkFile.h"
+#include "../platform/Platform.h"
 #include "../scenario/Scenario.h"
 #include "CommandLine.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <thread>
+#include <vector>
 
 using namespace OpenRCT2;
 
+static exitcode_t ConvertDirectory(const u8string& sourceDirectory, const u8string& destinationDirectory);
+static bool ConvertPark(IContext& context, const u8string& sourcePath, const u8string& destinationPath);
 static void WriteConvertFromAndToMessage(FileExtension sourceFileType, FileExtension destinationFileType);
 static u8string GetFileTypeFriendlyName(FileExtension fileType);
 
@@ -56,6 +64,11 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
     }
 
     const auto destinationPath = Path::GetAbsolute(rawDestinationPath);
+    if (Path::DirectoryExists(sourcePath))
+    {
+        return ConvertDirectory(sourcePath, destinationPath);
+    }
+
     auto destinationFileType = GetFileExtensionType(destinationPath.c_str());
 
     // Validate target type
@@ -92,8 +105,147 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
     auto context = OpenRCT2::CreateContext();
     context->Initialise();
 
-    auto& objManager = context->GetObjectManager();
+    if (!ConvertPark(*context, sourcePath, destinationPath))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    Console::WriteLine("Conversion successful!");
+    return EXITCODE_OK;
+}
+
+static std::vector<u8string> GetConvertibleParks(const u8string& directory)
+{
+    std::vector<u8string> paths;
+    auto scanner = Path::ScanDirectory(Path::Combine(directory, u8"*"), false);
+    while (scanner->Next())
+    {
+        switch (GetFileExtensionType(scanner->GetPath()))
+        {
+            case FileExtension::SC4:
+            case FileExtension::SV4:
+            case FileExtension::SC6:
+            case FileExtension::SV6:
+                paths.push_back(scanner->GetPath());
+                break;
+            default:
+                break;
+        }
+    }
+
+    // Sorted so every worker process sees the same order
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
+
+#ifndef _WIN32
+/**
+ * Launches the worker processes for converting a directory, each converts every jobs-th park of the directory with
+ * their own context. The game state is global, so separate processes are the only way to convert in parallel.
+ */
+static exitcode_t ConvertDirectoryInWorkers(
+    const u8string& sourceDirectory, const u8string& destinationDirectory, int32_t jobs)
+{
+    // Passed as separate arguments rather than a shell command, paths may contain quotes or anything else
+    std::vector<std::string> arguments = { Platform::GetCurrentExecutablePath(), "convert", sourceDirectory,
+                                           destinationDirectory, String::StdFormat("--jobs=%d", jobs) };
+    for (const auto& [option, path] : { std::pair{ "user-data-path", gCustomUserDataPath },
+                                        std::pair{ "openrct2-data-path", gCustomOpenRCT2DataPath },
+                                        std::pair{ "rct1-data-path", gCustomRCT1DataPath },
+                                        std::pair{ "rct2-data-path", gCustomRCT2DataPath } })
+    {
+        if (!path.empty())
+        {
+            arguments.push_back(String::StdFormat("--%s=%s", option, path.c_str()));
+        }
+    }
+
+    std::vector<int32_t> exitCodes(jobs);
+    std::vector<std::string> outputs(jobs);
+    std::vector<std::thread> workers;
+    for (int32_t i = 0; i < jobs; i++)
+    {
+        auto workerArguments = arguments;
+        workerArguments.push_back(String::StdFormat("--job-index=%d", i));
+        workers.emplace_back([&exitCodes, &outputs, workerArguments = std::move(workerArguments), i]() {
+            exitCodes[i] = Platform::Execute(workerArguments, &outputs[i]);
+        });
+    }
+
+    exitcode_t result = EXITCODE_OK;
+    for (int32_t i = 0; i < jobs; i++)
+    {
+        workers[i].join();
+        Console::WriteLine("%s", outputs[i].c_str());
+        if (exitCodes[i] != 0)
+        {
+            result = EXITCODE_FAIL;
+        }
+    }
+    return result;
+}
+#endif
+
+static exitcode_t ConvertDirectory(const u8string& sourceDirectory, const u8string& destinationDirectory)
+{
+    const auto jobs = std::max(1, CommandLine::gConvertJobs);
+    const auto jobIndex = CommandLine::gConvertJobIndex;
+#ifndef _WIN32
+    if (jobs > 1 && jobIndex < 0)
+    {
+        if (!Path::CreateDirectory(destinationDirectory))
+        {
+            Console::Error::WriteLine("Unable to create destination directory '%s'.", destinationDirectory.c_str());
+            return EXITCODE_FAIL;
+        }
+        return ConvertDirectoryInWorkers(sourceDirectory, destinationDirectory, jobs);
+    }
+#endif
+
+    if (!Path::DirectoryExists(destinationDirectory) && !Path::CreateDirectory(destinationDirectory))
+    {
+        Console::Error::WriteLine("Unable to create destination directory '%s'.", destinationDirectory.c_str());
+        return EXITCODE_FAIL;
+    }
+
+    // Initialise once for the whole directory rather than once per park
+    gOpenRCT2Headless = true;
+    auto context = OpenRCT2::CreateContext();
+    context->Initialise();
+
+    const auto paths = GetConvertibleParks(sourceDirectory);
+    size_t numConverted = 0;
+    size_t numFailed = 0;
+    for (size_t i = 0; i < paths.size(); i++)
+    {
+        if (jobIndex >= 0 && static_cast<int32_t>(i % jobs) != jobIndex)
+        {
+            continue;
+        }
+
+        const auto& sourcePath = paths[i];
+        auto destinationPath = Path::Combine(
+            destinationDirectory, Path::GetFileNameWithoutExtension(sourcePath) + u8".park");
+        Console::WriteLine("Converting '%s'...", sourcePath.c_str());
+        if (ConvertPark(*context, sourcePath, destinationPath))
+        {
+            numConverted++;
+        }
+        else
+        {
+            numFailed++;
+        }
+    }
+
+    Console::WriteLine("Converted %zu parks, %zu failed.", numConverted, numFailed);
+    return numFailed == 0 ? EXITCODE_OK : EXITCODE_FAIL;
+}
+
+static bool ConvertPark(IContext& context, const u8string& sourcePath, const u8string& destinationPath)
+{
+    auto& objManager = context.GetObjectManager();
     auto& gameState = GetGameState();
+    auto sourceFileType = GetFileExtensionType(sourcePath.c_str());
 
     try
     {
@@ -108,7 +260,7 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
     catch (const std::exception& ex)
     {
         Console::Error::WriteLine(ex.what());
-        return EXITCODE_FAIL;
+        return false;
     }
 
     if (sourceFileType == FileExtension::SC4 || sourceFileType == FileExtension::SC6)
@@ -130,11 +282,9 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
     catch (const std::exception& ex)
     {
         Console::Error::WriteLine(ex.what());
-        return EXITCODE_FAIL;
+        return false;
     }
-
-    Console::WriteLine("Conversion successful!");
-    return EXITCODE_OK;
+    return true;
 }
 
 static void WriteConvertFromAndToMessage(FileExtension sourceFileType, FileExtension destinationFileType)
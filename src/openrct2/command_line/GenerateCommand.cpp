@@ -0,0 +1,116 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../FileClassifier.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../core/Console.hpp"
+#include "../core/Path.hpp"
+#include "../interface/Window.h"
+#include "../park/ParkFile.h"
+#include "../world/Map.h"
+#include "../world/MapGen.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <memory>
+
+using namespace OpenRCT2;
+
+exitcode_t CommandLine::HandleCommandGenerate(CommandLineArgEnumerator* enumerator)
+{
+    exitcode_t result = CommandLine::HandleCommandDefault();
+    if (result != EXITCODE_CONTINUE)
+    {
+        return result;
+    }
+
+    // The source park provides the terrain and scenery objects the map is generated with
+    const utf8* rawSourcePath;
+    if (!enumerator->TryPopString(&rawSourcePath))
+    {
+        Console::Error::WriteLine("Expected a source path.");
+        return EXITCODE_FAIL;
+    }
+    const auto sourcePath = Path::GetAbsolute(rawSourcePath);
+
+    const utf8* rawDestinationPath;
+    if (!enumerator->TryPopString(&rawDestinationPath))
+    {
+        Console::Error::WriteLine("Expected a destination path.");
+        return EXITCODE_FAIL;
+    }
+    const auto destinationPath = Path::GetAbsolute(rawDestinationPath);
+    if (GetFileExtensionType(destinationPath.c_str()) != FileExtension::PARK)
+    {
+        Console::Error::WriteLine("Only generating a .PARK is supported.");
+        return EXITCODE_FAIL;
+    }
+
+    int32_t mapSize;
+    if (!enumerator->TryPopInteger(&mapSize))
+    {
+        Console::Error::WriteLine("Expected a map size.");
+        return EXITCODE_FAIL;
+    }
+    mapSize = std::clamp<int32_t>(mapSize, kMinimumMapSizeTechnical, kMaximumMapSizeTechnical);
+
+    // Same defaults as the simplex noise page of the map generator window
+    MapGenSettings settings{};
+    settings.mapSize = { mapSize, mapSize };
+    settings.height = 12;
+    settings.water_level = 6 + kMinimumWaterHeight;
+    settings.floor = -1;
+    settings.wall = -1;
+    settings.trees = 1;
+    settings.simplex_low = 6;
+    settings.simplex_high = 10;
+    settings.simplex_base_freq = 0.6f;
+    settings.simplex_octaves = 4;
+
+    // Optional simplex parameters: <low> <high> <octaves>
+    enumerator->TryPopInteger(&settings.simplex_low);
+    enumerator->TryPopInteger(&settings.simplex_high);
+    enumerator->TryPopInteger(&settings.simplex_octaves);
+
+    gOpenRCT2Headless = true;
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+    if (!context->LoadParkFromFile(sourcePath))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    Console::WriteLine("Generating a %d x %d map...", mapSize, mapSize);
+    MapGenGenerate(&settings);
+
+    try
+    {
+        auto exporter = std::make_unique<ParkFileExporter>();
+
+        // HACK remove the main window so it saves the park with the
+        //      correct initial view
+        WindowCloseByClass(WindowClass::MainWindow);
+
+        exporter->Export(GetGameState(), destinationPath);
+    }
+    catch (const std::exception& ex)
+    {
+        Console::Error::WriteLine(ex.what());
+        return EXITCODE_FAIL;
+    }
+
+    Console::WriteLine("Saved %s", destinationPath.c_str());
+    return EXITCODE_OK;
+}
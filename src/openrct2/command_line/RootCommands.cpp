@@ -24,6 +24,7 @@
 #include "../park/ParkFile.h"
 #include "../platform/Crash.h"
 #include "../platform/Platform.h"
+#include "../profiling/Telemetry.h"
 #include "../scripting/ScriptEngine.h"
 #include "CommandLine.hpp"
 
@@ -60,6 +61,8 @@ static u8string _openrct2DataPath = {};
 static u8string _rct1DataPath = {};
 static u8string _rct2DataPath = {};
 static bool _silentBreakpad = false;
+int32_t CommandLine::gConvertJobs = 1;
+int32_t CommandLine::gConvertJobIndex = -1;
 
 // clang-format off
 static constexpr CommandLineOptionDefinition StandardOptions[]
@@ -80,6 +83,9 @@ static constexpr CommandLineOptionDefinition StandardOptions[]
     { CMDLINE_TYPE_STRING,  &_openrct2DataPath, NAC, "openrct2-data-path", "path to the OpenRCT2 data directory (containing languages)" },
     { CMDLINE_TYPE_STRING,  &_rct1DataPath,     NAC, "rct1-data-path",     "path to the RollerCoaster Tycoon 1 data directory (containing data/csg1.dat)" },
     { CMDLINE_TYPE_STRING,  &_rct2DataPath,     NAC, "rct2-data-path",     "path to the RollerCoaster Tycoon 2 data directory (containing data/g1.dat)" },
+    { CMDLINE_TYPE_INTEGER, &CommandLine::gConvertJobs, 'j', "jobs",         "number of worker processes used to convert a directory" },
+    { CMDLINE_TYPE_INTEGER, &CommandLine::gConvertJobIndex, NAC, "job-index", "only convert the share of a directory for this worker" },
+    { CMDLINE_TYPE_INTEGER, &gTelemetryStatsInterval, NAC, "stats-interval", "print tick statistics every given number of ticks" },
 #ifdef USE_BREAKPAD
     { CMDLINE_TYPE_SWITCH,  &_silentBreakpad,  NAC, "silent-breakpad",   "make breakpad crash reporting silent"                       },
 #endif // USE_BREAKPAD
@@ -130,6 +136,7 @@ const CommandLineCommand CommandLine::RootCommands[]
 #endif
     DefineCommand("set-rct2", "<path>",                 StandardOptions, HandleCommandSetRCT2),
     DefineCommand("convert",  "<source> <destination>", StandardOptions, CommandLine::HandleCommandConvert),
+    DefineCommand("generate", "<source> <destination> <size>", StandardOptions, CommandLine::HandleCommandGenerate),
     DefineCommand("scan-objects", "<path>",             StandardOptions, HandleCommandScanObjects),
     DefineCommand("handle-uri", "openrct2://.../",      StandardOptions, CommandLine::HandleCommandUri),
 
@@ -141,7 +148,11 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("screenshot",      CommandLine::ScreenshotCommands       ),
     DefineSubCommand("sprite",          CommandLine::SpriteCommands           ),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
+    DefineSubCommand("benchsimulate",   CommandLine::BenchSimulateCommands    ),
+    DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
+    DefineSubCommand("benchreplay",     CommandLine::BenchReplayCommands      ),
     DefineSubCommand("parkinfo",        CommandLine::ParkInfoCommands         ),
+    DefineSubCommand("stresspark",      CommandLine::StressParkCommands       ),
     CommandTableEnd
 };
 
@@ -11,23 +11,63 @@
 #include "../Game.h"
 #include "../GameState.h"
 #include "../OpenRCT2.h"
+#include "../ReplayManager.h"
 #include "../core/Console.hpp"
+#include "../core/FileScanner.h"
+#include "../core/Json.hpp"
+#include "../core/Path.hpp"
 #include "../entity/EntityRegistry.h"
 #include "../network/network.h"
 #include "../platform/Platform.h"
+#include "../profiling/Profiling.h"
 #include "CommandLine.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <memory>
+#include <vector>
 
 using namespace OpenRCT2;
 
 static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleBenchSimulate(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleBenchReplay(CommandLineArgEnumerator* argEnumerator);
+
+static int32_t _benchWarmupTicks = 0;
+static bool _benchJson = false;
+static int32_t _benchIterations = 1;
+
+// clang-format off
+static constexpr CommandLineOptionDefinition BenchSimulateOptions[]
+{
+    { CMDLINE_TYPE_INTEGER, &_benchWarmupTicks, NAC, "warmup", "number of ticks to run before measuring" },
+    { CMDLINE_TYPE_SWITCH,  &_benchJson,        NAC, "json",   "print the results as JSON"               },
+    OptionTableEnd
+};
+
+static constexpr CommandLineOptionDefinition BenchReplayOptions[]
+{
+    { CMDLINE_TYPE_INTEGER, &_benchIterations, NAC, "iterations", "number of times to play back every replay" },
+    { CMDLINE_TYPE_SWITCH,  &_benchJson,       NAC, "json",       "print the results as JSON"                 },
+    OptionTableEnd
+};
+// clang-format on
 
 const CommandLineCommand CommandLine::SimulateCommands[]{ // Main commands
                                                           DefineCommand("", "<ticks>", nullptr, HandleSimulate), CommandTableEnd
 };
 
+const CommandLineCommand CommandLine::BenchSimulateCommands[]{
+    // Main commands
+    DefineCommand("", "<park> <ticks>", BenchSimulateOptions, HandleBenchSimulate), CommandTableEnd
+};
+
+const CommandLineCommand CommandLine::BenchReplayCommands[]{
+    // Main commands
+    DefineCommand("", "<replay_or_directory>", BenchReplayOptions, HandleBenchReplay), CommandTableEnd
+};
+
 static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
 {
     const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
@@ -71,3 +111,288 @@ static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
 
     return EXITCODE_OK;
 }
+
+struct BenchSubsystemResult
+{
+    std::string Name;
+    uint64_t Calls{};
+    double TotalUs{};
+    double MaxUs{};
+};
+
+// Nearest rank percentile of already sorted samples
+static double GetPercentile(const std::vector<double>& sortedSamples, double percentile)
+{
+    if (sortedSamples.empty())
+        return 0.0;
+
+    auto rank = static_cast<size_t>(percentile / 100.0 * static_cast<double>(sortedSamples.size()));
+    return sortedSamples[std::min(rank, sortedSamples.size() - 1)];
+}
+
+static exitcode_t HandleBenchSimulate(CommandLineArgEnumerator* argEnumerator)
+{
+    const utf8* inputPath;
+    if (!argEnumerator->TryPopString(&inputPath))
+    {
+        Console::Error::WriteLine("Expected a park path.");
+        return EXITCODE_FAIL;
+    }
+
+    int32_t ticks;
+    if (!argEnumerator->TryPopInteger(&ticks) || ticks <= 0)
+    {
+        Console::Error::WriteLine("Expected a positive number of ticks.");
+        return EXITCODE_FAIL;
+    }
+    const auto warmupTicks = std::max(_benchWarmupTicks, 0);
+
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+    if (!context->LoadParkFromFile(inputPath))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    if (!_benchJson)
+    {
+        Console::WriteLine("Running %d warmup ticks and %d measured ticks...", warmupTicks, ticks);
+    }
+    for (int32_t i = 0; i < warmupTicks; i++)
+    {
+        gameStateUpdateLogic();
+    }
+
+    // Only the measured ticks contribute to the per-subsystem timings
+    const bool profilerWasEnabled = Profiling::IsEnabled();
+    Profiling::ResetData();
+    Profiling::Enable();
+
+    using Clock = std::chrono::high_resolution_clock;
+    std::vector<double> tickTimesUs;
+    tickTimesUs.reserve(ticks);
+    for (int32_t i = 0; i < ticks; i++)
+    {
+        const auto start = Clock::now();
+        gameStateUpdateLogic();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+        tickTimesUs.push_back(elapsed.count() / 1000.0);
+    }
+
+    if (!profilerWasEnabled)
+    {
+        Profiling::Disable();
+    }
+
+    std::vector<BenchSubsystemResult> subsystems;
+    for (const auto* func : Profiling::GetData())
+    {
+        if (func->GetCallCount() == 0)
+            continue;
+
+        subsystems.push_back({ func->GetName(), func->GetCallCount(), func->GetTotalTime(), func->GetMaxTime() });
+    }
+    std::sort(subsystems.begin(), subsystems.end(), [](const auto& a, const auto& b) { return a.TotalUs > b.TotalUs; });
+
+    double totalUs = 0.0;
+    for (auto tickTime : tickTimesUs)
+    {
+        totalUs += tickTime;
+    }
+    std::sort(tickTimesUs.begin(), tickTimesUs.end());
+
+    const auto ticksPerSecond = totalUs > 0.0 ? ticks / (totalUs / 1000000.0) : 0.0;
+    const auto p50 = GetPercentile(tickTimesUs, 50);
+    const auto p95 = GetPercentile(tickTimesUs, 95);
+    const auto p99 = GetPercentile(tickTimesUs, 99);
+    const auto checksum = GetAllEntitiesChecksum().ToString();
+
+    if (_benchJson)
+    {
+        json_t result = {
+            { "park", inputPath },
+            { "warmupTicks", warmupTicks },
+            { "ticks", ticks },
+            { "totalMs", totalUs / 1000.0 },
+            { "ticksPerSecond", ticksPerSecond },
+            { "tickUs", { { "p50", p50 }, { "p95", p95 }, { "p99", p99 }, { "max", tickTimesUs.back() } } },
+            { "checksum", checksum },
+        };
+
+        auto subsystemsJson = json_t::array();
+        for (const auto& subsystem : subsystems)
+        {
+            subsystemsJson.push_back({
+                { "name", subsystem.Name },
+                { "calls", subsystem.Calls },
+                { "totalMs", subsystem.TotalUs / 1000.0 },
+                { "meanUs", subsystem.TotalUs / subsystem.Calls },
+                { "maxUs", subsystem.MaxUs },
+                { "share", totalUs > 0.0 ? subsystem.TotalUs / totalUs : 0.0 },
+            });
+        }
+        result["subsystems"] = std::move(subsystemsJson);
+
+        Console::WriteLine("%s", result.dump(4).c_str());
+    }
+    else
+    {
+        Console::WriteLine("Ticks per second: %.1f", ticksPerSecond);
+        Console::WriteLine("Tick time (us): p50 %.1f, p95 %.1f, p99 %.1f, max %.1f", p50, p95, p99, tickTimesUs.back());
+        Console::WriteLine("%-64s %10s %12s %10s %7s", "Function", "Calls", "Total (ms)", "Mean (us)", "Share");
+        for (const auto& subsystem : subsystems)
+        {
+            Console::WriteLine(
+                "%-64s %10llu %12.2f %10.2f %6.1f%%", subsystem.Name.c_str(),
+                static_cast<unsigned long long>(subsystem.Calls), subsystem.TotalUs / 1000.0,
+                subsystem.TotalUs / subsystem.Calls, totalUs > 0.0 ? subsystem.TotalUs / totalUs * 100.0 : 0.0);
+        }
+        Console::WriteLine("Completed: %s", checksum.c_str());
+    }
+
+    return EXITCODE_OK;
+}
+
+struct BenchReplayResult
+{
+    std::string Path;
+    bool Started{};
+    bool Matched{};
+    uint32_t Ticks{};
+    std::vector<double> TimesMs;
+};
+
+static std::vector<std::string> GetBenchReplayFiles(const std::string& path)
+{
+    std::vector<std::string> files;
+    if (!Path::DirectoryExists(path))
+    {
+        files.push_back(path);
+        return files;
+    }
+
+    auto scanner = Path::ScanDirectory(Path::Combine(path, u8"*.parkrep"), true);
+    while (scanner->Next())
+    {
+        files.push_back(scanner->GetPath());
+    }
+    // Keep the order stable so results can be compared between runs
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+static exitcode_t HandleBenchReplay(CommandLineArgEnumerator* argEnumerator)
+{
+    const utf8* rawPath;
+    if (!argEnumerator->TryPopString(&rawPath))
+    {
+        Console::Error::WriteLine("Expected a replay file or a directory of replays.");
+        return EXITCODE_FAIL;
+    }
+
+    const auto files = GetBenchReplayFiles(Path::GetAbsolute(rawPath));
+    if (files.empty())
+    {
+        Console::Error::WriteLine("No replays found.");
+        return EXITCODE_FAIL;
+    }
+    const auto iterations = std::max(_benchIterations, 1);
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    using Clock = std::chrono::high_resolution_clock;
+    auto* replayManager = context->GetReplayManager();
+    std::vector<BenchReplayResult> results;
+    for (const auto& file : files)
+    {
+        auto& result = results.emplace_back();
+        result.Path = file;
+        result.Matched = true;
+        for (int32_t i = 0; i < iterations && result.Matched; i++)
+        {
+            if (!replayManager->StartPlayback(file))
+            {
+                result.Matched = false;
+                break;
+            }
+            result.Started = true;
+
+            // Loading the park is not part of the measured time, only running it
+            uint32_t ticks = 0;
+            const auto start = Clock::now();
+            while (replayManager->IsReplaying())
+            {
+                gameStateUpdateLogic();
+                ticks++;
+                if (replayManager->IsPlaybackStateMismatching())
+                    break;
+            }
+            const auto elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+            if (replayManager->IsPlaybackStateMismatching())
+            {
+                result.Matched = false;
+                replayManager->StopPlayback();
+            }
+            result.Ticks = ticks;
+            result.TimesMs.push_back(elapsed);
+        }
+    }
+
+    bool allMatched = true;
+    auto resultsJson = json_t::array();
+    for (auto& result : results)
+    {
+        allMatched = allMatched && result.Matched;
+
+        std::sort(result.TimesMs.begin(), result.TimesMs.end());
+        const auto bestMs = result.TimesMs.empty() ? 0.0 : result.TimesMs.front();
+        const auto medianMs = GetPercentile(result.TimesMs, 50);
+        const auto ticksPerSecond = medianMs > 0.0 ? result.Ticks / (medianMs / 1000.0) : 0.0;
+        const auto* status = !result.Started ? "failed to load" : (result.Matched ? "ok" : "checksum mismatch");
+
+        if (_benchJson)
+        {
+            resultsJson.push_back({
+                { "replay", result.Path },
+                { "status", status },
+                { "ticks", result.Ticks },
+                { "bestMs", bestMs },
+                { "medianMs", medianMs },
+                { "ticksPerSecond", ticksPerSecond },
+            });
+        }
+        else
+        {
+            Console::WriteLine(
+                "%s: %s, %u ticks, best %.2f ms, median %.2f ms (%.1f ticks per second)",
+                Path::GetFileName(result.Path).c_str(), status, result.Ticks, bestMs, medianMs, ticksPerSecond);
+        }
+    }
+
+    if (_benchJson)
+    {
+        json_t output = {
+            { "iterations", iterations },
+            { "passed", allMatched },
+            { "replays", std::move(resultsJson) },
+        };
+        Console::WriteLine("%s", output.dump(4).c_str());
+    }
+
+    return allMatched ? EXITCODE_OK : EXITCODE_FAIL;
+}
@@ -0,0 +1,412 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../FileClassifier.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../actions/FootpathPlaceAction.h"
+#include "../actions/ParkEntrancePlaceAction.h"
+#include "../actions/PeepSpawnPlaceAction.h"
+#include "../actions/RideCreateAction.h"
+#include "../actions/RideSetStatusAction.h"
+#include "../actions/SmallSceneryPlaceAction.h"
+#include "../actions/TrackPlaceAction.h"
+#include "../core/Console.hpp"
+#include "../core/Path.hpp"
+#include "../entity/Guest.h"
+#include "../interface/Colour.h"
+#include "../interface/Window.h"
+#include "../object/ObjectEntryManager.h"
+#include "../object/ObjectLimits.h"
+#include "../object/SmallSceneryEntry.h"
+#include "../park/ParkFile.h"
+#include "../ride/Ride.h"
+#include "../ride/RideData.h"
+#include "../scenario/Scenario.h"
+#include "../world/Footpath.h"
+#include "../world/Map.h"
+#include "../world/Park.h"
+#include "../world/Surface.h"
+#include "../world/TileElementsView.h"
+#include "CommandLine.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static exitcode_t HandleStressPark(CommandLineArgEnumerator* argEnumerator);
+
+static int32_t _stressMapSize = 256;
+static int32_t _stressGuests = 1000;
+static int32_t _stressRides = 20;
+static int32_t _stressPathTiles = 2000;
+static int32_t _stressSceneryDensity = 25;
+static int32_t _stressSeed = 0;
+
+// clang-format off
+static constexpr CommandLineOptionDefinition StressParkOptions[]
+{
+    { CMDLINE_TYPE_INTEGER, &_stressMapSize,        NAC, "size",    "width and height of the map in tiles"          },
+    { CMDLINE_TYPE_INTEGER, &_stressGuests,         NAC, "guests",  "number of guests to place inside the park"     },
+    { CMDLINE_TYPE_INTEGER, &_stressRides,          NAC, "rides",   "number of stalls and facilities to build"      },
+    { CMDLINE_TYPE_INTEGER, &_stressPathTiles,      NAC, "paths",   "number of footpath tiles to lay"               },
+    { CMDLINE_TYPE_INTEGER, &_stressSceneryDensity, NAC, "scenery", "percentage of free park tiles to fill with scenery" },
+    { CMDLINE_TYPE_INTEGER, &_stressSeed,           NAC, "seed",    "seed for the scenery and guest placement"      },
+    OptionTableEnd
+};
+// clang-format on
+
+const CommandLineCommand CommandLine::StressParkCommands[]{
+    // Main commands
+    DefineCommand("", "<source> <destination>", StressParkOptions, HandleStressPark), CommandTableEnd
+};
+
+// Footpath streets branch off the main path every few tiles, leaving room for a stall on either side
+static constexpr int32_t kStreetSpacing = 4;
+
+struct StressParkLayout
+{
+    std::vector<TileCoordsXY> PathTiles;
+    std::vector<std::pair<TileCoordsXY, Direction>> StallSites;
+    TileCoordsXY Min;
+    TileCoordsXY Max;
+};
+
+/**
+ * Lays out a comb of footpaths: a main path running east from the park entrance with streets branching north and south
+ * of it. The streets are as long as needed for the covered area to stay roughly square.
+ */
+static StressParkLayout CreateStressParkLayout(int32_t mapSize, int32_t pathTiles)
+{
+    StressParkLayout layout;
+
+    const auto mainY = mapSize / 2;
+    const auto minX = 3;
+    const auto maxX = mapSize - 3;
+    const auto maxStreetLength = std::max(0, std::min(mainY - 3, mapSize - 4 - mainY));
+    const auto streetLength = std::clamp(static_cast<int32_t>(std::sqrt(pathTiles)), 1, std::max(1, maxStreetLength));
+
+    layout.Min = { minX, mainY };
+    layout.Max = { minX, mainY };
+    for (int32_t x = minX; x <= maxX && static_cast<int32_t>(layout.PathTiles.size()) < pathTiles; x++)
+    {
+        layout.PathTiles.push_back({ x, mainY });
+        layout.Max.x = x;
+        if (x % kStreetSpacing != 0 || maxStreetLength == 0)
+            continue;
+
+        for (int32_t offset = 1; offset <= streetLength && static_cast<int32_t>(layout.PathTiles.size()) < pathTiles;
+             offset++)
+        {
+            for (auto y : { mainY - offset, mainY + offset })
+            {
+                if (static_cast<int32_t>(layout.PathTiles.size()) >= pathTiles)
+                    break;
+
+                layout.PathTiles.push_back({ x, y });
+                layout.Min.y = std::min(layout.Min.y, y);
+                layout.Max.y = std::max(layout.Max.y, y);
+
+                // Stalls face the street from the tiles either side of it
+                if (x - 1 > minX)
+                    layout.StallSites.push_back({ { x - 1, y }, 2 });
+                if (x + 1 <= maxX)
+                    layout.StallSites.push_back({ { x + 1, y }, 0 });
+            }
+        }
+    }
+    return layout;
+}
+
+static bool ExecuteStressParkAction(GameAction& action)
+{
+    auto result = GameActions::Execute(&action);
+    return result.Error == GameActions::Status::Ok;
+}
+
+static CoordsXYZ GetStressParkTileLocation(const TileCoordsXY& tile)
+{
+    const auto coords = tile.ToCoordsXY();
+    return { coords, TileElementHeight(coords) };
+}
+
+static bool PlaceStressParkPath(const TileCoordsXY& tile)
+{
+    const auto isLegacy = gFootpathSelection.LegacyPath != OBJECT_ENTRY_INDEX_NULL;
+    auto action = FootpathPlaceAction(
+        GetStressParkTileLocation(tile), 0, isLegacy ? gFootpathSelection.LegacyPath : gFootpathSelection.NormalSurface,
+        gFootpathSelection.Railings, INVALID_DIRECTION, isLegacy ? PathConstructFlag::IsLegacyPathObject : 0);
+    return ExecuteStressParkAction(action);
+}
+
+/**
+ * Builds the park entrance on the west side of the map, with a peep spawn on the unowned approach path in front of it.
+ */
+static bool PlaceStressParkEntrance(int32_t mapSize)
+{
+    const TileCoordsXY approachTile = { 1, mapSize / 2 };
+    const TileCoordsXY entranceTile = { 2, mapSize / 2 };
+    if (!PlaceStressParkPath(approachTile))
+        return false;
+
+    auto entranceAction = ParkEntrancePlaceAction(
+        { GetStressParkTileLocation(entranceTile), 0 },
+        gFootpathSelection.LegacyPath != OBJECT_ENTRY_INDEX_NULL ? gFootpathSelection.LegacyPath
+                                                                  : gFootpathSelection.NormalSurface);
+    if (!ExecuteStressParkAction(entranceAction))
+        return false;
+
+    auto spawnAction = PeepSpawnPlaceAction({ GetStressParkTileLocation(approachTile), 0 });
+    return ExecuteStressParkAction(spawnAction);
+}
+
+static std::vector<ObjectEntryIndex> GetStressParkStallEntries()
+{
+    std::vector<ObjectEntryIndex> entries;
+    for (ObjectEntryIndex i = 0; i < MAX_RIDE_OBJECTS; i++)
+    {
+        const auto* rideEntry = GetRideEntryByIndex(i);
+        if (rideEntry == nullptr)
+            continue;
+
+        const auto rideType = rideEntry->GetFirstNonNullRideType();
+        if (rideType < RIDE_TYPE_COUNT && GetRideTypeDescriptor(rideType).HasFlag(RIDE_TYPE_FLAG_IS_SHOP_OR_FACILITY))
+        {
+            entries.push_back(i);
+        }
+    }
+    return entries;
+}
+
+static bool PlaceStressParkStall(ObjectEntryIndex entryIndex, const TileCoordsXY& tile, Direction direction)
+{
+    const auto rideType = GetRideEntryByIndex(entryIndex)->GetFirstNonNullRideType();
+    auto createAction = RideCreateAction(rideType, entryIndex, 0, 0, GetGameState().LastEntranceStyle);
+    auto createResult = GameActions::Execute(&createAction);
+    if (createResult.Error != GameActions::Status::Ok)
+        return false;
+
+    const auto rideId = createResult.GetData<RideId>();
+    const auto& rtd = GetRideTypeDescriptor(rideType);
+    auto trackAction = TrackPlaceAction(
+        rideId, rtd.StartTrackPiece, rideType, { GetStressParkTileLocation(tile), direction }, 0, 0, 0, 0, false);
+    if (!ExecuteStressParkAction(trackAction))
+        return false;
+
+    auto statusAction = RideSetStatusAction(rideId, RideStatus::Open);
+    ExecuteStressParkAction(statusAction);
+    return true;
+}
+
+static std::vector<ObjectEntryIndex> GetStressParkSceneryEntries()
+{
+    std::vector<ObjectEntryIndex> entries;
+    for (ObjectEntryIndex i = 0; i < MAX_SMALL_SCENERY_OBJECTS; i++)
+    {
+        const auto* sceneryEntry = ObjectManager::GetObjectEntry<SmallSceneryEntry>(i);
+        if (sceneryEntry != nullptr && sceneryEntry->HasFlag(SMALL_SCENERY_FLAG_FULL_TILE))
+        {
+            entries.push_back(i);
+        }
+    }
+    return entries;
+}
+
+static bool StressParkTileIsFree(const TileCoordsXY& tile)
+{
+    for (auto* tileElement : TileElementsView(tile.ToCoordsXY()))
+    {
+        if (tileElement->GetType() != TileElementType::Surface)
+            return false;
+    }
+    return true;
+}
+
+static exitcode_t HandleStressPark(CommandLineArgEnumerator* argEnumerator)
+{
+    exitcode_t result = CommandLine::HandleCommandDefault();
+    if (result != EXITCODE_CONTINUE)
+    {
+        return result;
+    }
+
+    // The source park provides the objects the park is built with
+    const utf8* rawSourcePath;
+    if (!argEnumerator->TryPopString(&rawSourcePath))
+    {
+        Console::Error::WriteLine("Expected a source path.");
+        return EXITCODE_FAIL;
+    }
+    const auto sourcePath = Path::GetAbsolute(rawSourcePath);
+
+    const utf8* rawDestinationPath;
+    if (!argEnumerator->TryPopString(&rawDestinationPath))
+    {
+        Console::Error::WriteLine("Expected a destination path.");
+        return EXITCODE_FAIL;
+    }
+    const auto destinationPath = Path::GetAbsolute(rawDestinationPath);
+    if (GetFileExtensionType(destinationPath.c_str()) != FileExtension::PARK)
+    {
+        Console::Error::WriteLine("Only generating a .PARK is supported.");
+        return EXITCODE_FAIL;
+    }
+
+    const auto mapSize = std::clamp<int32_t>(_stressMapSize, kMinimumMapSizeTechnical, kMaximumMapSizeTechnical);
+    const auto guestCount = std::max(_stressGuests, 0);
+    const auto rideCount = std::clamp<int32_t>(_stressRides, 0, OpenRCT2::Limits::MaxRidesInPark);
+    const auto pathTiles = std::max(_stressPathTiles, 1);
+    const auto sceneryDensity = std::clamp(_stressSceneryDensity, 0, 100);
+
+    gOpenRCT2Headless = true;
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+    if (!context->LoadParkFromFile(sourcePath))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    auto& gameState = GetGameState();
+    gameStateInitAll(gameState, { mapSize, mapSize });
+    if (!FootpathSelectDefault())
+    {
+        Console::Error::WriteLine("The source park has no footpath objects.");
+        return EXITCODE_FAIL;
+    }
+
+    // Both the layout and the guests are seeded so the same arguments always produce the same park
+    std::mt19937 rng(static_cast<uint32_t>(_stressSeed));
+    ScenarioRandSeed(static_cast<uint32_t>(_stressSeed), ~static_cast<uint32_t>(_stressSeed));
+
+    gameState.Park.Flags |= PARK_FLAGS_PARK_OPEN | PARK_FLAGS_NO_MONEY;
+    gameState.Cheats.SandboxMode = true;
+    gameState.Cheats.BuildInPauseMode = true;
+
+    Console::WriteLine("Building a %d x %d stress park...", mapSize, mapSize);
+    for (int32_t y = 2; y < mapSize - 2; y++)
+    {
+        for (int32_t x = 2; x < mapSize - 2; x++)
+        {
+            auto* surfaceElement = MapGetSurfaceElementAt(TileCoordsXY{ x, y });
+            if (surfaceElement != nullptr)
+                surfaceElement->SetOwnership(OWNERSHIP_OWNED);
+        }
+    }
+
+    if (!PlaceStressParkEntrance(mapSize))
+    {
+        Console::Error::WriteLine("Unable to place the park entrance.");
+        return EXITCODE_FAIL;
+    }
+
+    const auto layout = CreateStressParkLayout(mapSize, pathTiles);
+    std::vector<TileCoordsXY> placedPaths;
+    placedPaths.reserve(layout.PathTiles.size());
+    for (const auto& tile : layout.PathTiles)
+    {
+        if (PlaceStressParkPath(tile))
+            placedPaths.push_back(tile);
+    }
+
+    int32_t placedRides = 0;
+    const auto stallEntries = GetStressParkStallEntries();
+    if (rideCount > 0 && stallEntries.empty())
+    {
+        Console::Error::WriteLine("The source park has no stall or facility objects, no rides will be built.");
+    }
+    else
+    {
+        // Spread the stalls evenly over the available sites
+        const auto numSites = static_cast<int32_t>(layout.StallSites.size());
+        const auto step = rideCount > 0 ? std::max(1, numSites / rideCount) : 1;
+        for (int32_t site = 0; site < numSites && placedRides < rideCount; site += step)
+        {
+            const auto& [tile, direction] = layout.StallSites[site];
+            if (PlaceStressParkStall(stallEntries[placedRides % stallEntries.size()], tile, direction))
+                placedRides++;
+        }
+    }
+
+    int32_t placedScenery = 0;
+    const auto sceneryEntries = GetStressParkSceneryEntries();
+    if (sceneryDensity > 0 && !sceneryEntries.empty())
+    {
+        for (int32_t y = layout.Min.y - 1; y <= layout.Max.y + 1; y++)
+        {
+            for (int32_t x = layout.Min.x; x <= layout.Max.x + 1; x++)
+            {
+                if (static_cast<int32_t>(rng() % 100) >= sceneryDensity)
+                    continue;
+
+                const auto sceneryType = sceneryEntries[rng() % sceneryEntries.size()];
+                if (!StressParkTileIsFree({ x, y }))
+                    continue;
+
+                auto sceneryAction = SmallSceneryPlaceAction(
+                    { TileCoordsXY{ x, y }.ToCoordsXY(), 0, 0 }, 0, sceneryType, COLOUR_BRIGHT_GREEN, COLOUR_BRIGHT_GREEN,
+                    COLOUR_BRIGHT_GREEN);
+                if (ExecuteStressParkAction(sceneryAction))
+                    placedScenery++;
+            }
+        }
+    }
+
+    // Guests are dropped straight onto the paths as if they had just walked through the entrance
+    int32_t placedGuests = 0;
+    for (int32_t i = 0; i < guestCount && !placedPaths.empty(); i++)
+    {
+        const auto& tile = placedPaths[rng() % placedPaths.size()];
+        const auto loc = GetStressParkTileLocation(tile);
+        auto* guest = Guest::Generate({ tile.ToCoordsXY().ToTileCentre(), loc.z });
+        if (guest == nullptr)
+            break;
+
+        guest->OutsideOfPark = false;
+        guest->ParkEntryTime = gameState.CurrentTicks;
+        IncrementGuestsInPark();
+        DecrementGuestsHeadingForPark();
+        placedGuests++;
+    }
+
+    gameState.Cheats.SandboxMode = false;
+    gameState.Cheats.BuildInPauseMode = false;
+    MapCountRemainingLandRights();
+
+    Console::WriteLine(
+        "Placed %zu path tiles, %d rides, %d scenery items and %d guests.", placedPaths.size(), placedRides, placedScenery,
+        placedGuests);
+
+    try
+    {
+        auto exporter = std::make_unique<ParkFileExporter>();
+
+        // HACK remove the main window so it saves the park with the
+        //      correct initial view
+        WindowCloseByClass(WindowClass::MainWindow);
+
+        exporter->Export(gameState, destinationPath);
+    }
+    catch (const std::exception& ex)
+    {
+        Console::Error::WriteLine(ex.what());
+        return EXITCODE_FAIL;
+    }
+
+    Console::WriteLine("Saved %s", destinationPath.c_str());
+    return EXITCODE_OK;
+}
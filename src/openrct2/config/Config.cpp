@@ -111,6 +111,12 @@ namespace Config
         ConfigEnumEntry<VirtualFloorStyles>("GLASSY", VirtualFloorStyles::Glassy),
     });
 
+    static const auto Enum_PluginBudgetPolicy = ConfigEnum<PluginBudgetPolicy>({
+        ConfigEnumEntry<PluginBudgetPolicy>("WARN", PluginBudgetPolicy::Warn),
+        ConfigEnumEntry<PluginBudgetPolicy>("THROTTLE", PluginBudgetPolicy::Throttle),
+        ConfigEnumEntry<PluginBudgetPolicy>("DISABLE", PluginBudgetPolicy::Disable),
+    });
+
     /**
      * Config enum wrapping LanguagesDescriptors.
      */
@@ -207,6 +213,22 @@ namespace Config
 #else
             model->MultiThreading = reader->GetBoolean("multithreading", true);
 #endif // _DEBUG
+            model->PathfindingFlowFields = reader->GetBoolean("pathfinding_flow_fields", false);
+            model->InstantRideRatings = reader->GetBoolean("instant_ride_ratings", false);
+            model->TilePaintCache = reader->GetBoolean("tile_paint_cache", false);
+            model->SpriteAtlasCache = reader->GetBoolean("sprite_atlas_cache", false);
+            model->BackgroundAutosave = reader->GetBoolean("background_autosave", false);
+            model->ChunkedParkCompression = reader->GetBoolean("chunked_park_compression", false);
+            model->SharedImageCache = reader->GetBoolean("shared_image_cache", false);
+            model->PathfindingRegions = reader->GetBoolean("pathfinding_regions", false);
+            model->QueuePathLanes = reader->GetBoolean("queue_path_lanes", false);
+            model->StableGuestTickBuckets = reader->GetBoolean("stable_guest_tick_buckets", false);
+            model->GroupVehicleUpdatesByRide = reader->GetBoolean("group_vehicle_updates_by_ride", false);
+            model->CompactOutOfMapSurfaces = reader->GetBoolean("compact_out_of_map_surfaces", false);
+            model->LazyMapAnimations = reader->GetBoolean("lazy_map_animations", false);
+            model->GhostAwarePathfinding = reader->GetBoolean("ghost_aware_pathfinding", false);
+            model->ActiveTileUpdates = reader->GetBoolean("active_tile_updates", false);
+            model->EventDrivenWidePaths = reader->GetBoolean("event_driven_wide_paths", false);
             model->TrapCursor = reader->GetBoolean("trap_cursor", false);
             model->AutoOpenShops = reader->GetBoolean("auto_open_shops", false);
             model->ScenarioSelectMode = reader->GetInt32("scenario_select_mode", SCENARIO_SELECT_MODE_ORIGIN);
@@ -292,6 +314,22 @@ namespace Config
         writer->WriteFloat("window_scale", model->WindowScale);
         writer->WriteBoolean("show_fps", model->ShowFPS);
         writer->WriteBoolean("multithreading", model->MultiThreading);
+        writer->WriteBoolean("pathfinding_flow_fields", model->PathfindingFlowFields);
+        writer->WriteBoolean("instant_ride_ratings", model->InstantRideRatings);
+        writer->WriteBoolean("tile_paint_cache", model->TilePaintCache);
+        writer->WriteBoolean("sprite_atlas_cache", model->SpriteAtlasCache);
+        writer->WriteBoolean("background_autosave", model->BackgroundAutosave);
+        writer->WriteBoolean("chunked_park_compression", model->ChunkedParkCompression);
+        writer->WriteBoolean("shared_image_cache", model->SharedImageCache);
+        writer->WriteBoolean("pathfinding_regions", model->PathfindingRegions);
+        writer->WriteBoolean("queue_path_lanes", model->QueuePathLanes);
+        writer->WriteBoolean("stable_guest_tick_buckets", model->StableGuestTickBuckets);
+        writer->WriteBoolean("group_vehicle_updates_by_ride", model->GroupVehicleUpdatesByRide);
+        writer->WriteBoolean("compact_out_of_map_surfaces", model->CompactOutOfMapSurfaces);
+        writer->WriteBoolean("lazy_map_animations", model->LazyMapAnimations);
+        writer->WriteBoolean("ghost_aware_pathfinding", model->GhostAwarePathfinding);
+        writer->WriteBoolean("active_tile_updates", model->ActiveTileUpdates);
+        writer->WriteBoolean("event_driven_wide_paths", model->EventDrivenWidePaths);
         writer->WriteBoolean("trap_cursor", model->TrapCursor);
         writer->WriteBoolean("auto_open_shops", model->AutoOpenShops);
         writer->WriteInt32("scenario_select_mode", model->ScenarioSelectMode);
@@ -429,6 +467,7 @@ namespace Config
             model->Advertise = reader->GetBoolean("advertise", true);
             model->AdvertiseAddress = reader->GetString("advertise_address", "");
             model->Maxplayers = reader->GetInt32("maxplayers", 16);
+            model->MaxSpectators = reader->GetInt32("max_spectators", 0);
             model->ServerName = reader->GetString("server_name", "Server");
             model->ServerDescription = reader->GetString("server_description", "");
             model->ServerGreeting = reader->GetString("server_greeting", "");
@@ -441,6 +480,9 @@ namespace Config
             model->LogServerActions = reader->GetBoolean("log_server_actions", false);
             model->PauseServerIfNoClients = reader->GetBoolean("pause_server_if_no_clients", false);
             model->DesyncDebugging = reader->GetBoolean("desync_debugging", false);
+            model->IoThread = reader->GetBoolean("io_thread", false);
+            model->PredictLocalActions = reader->GetBoolean("predict_local_actions", false);
+            model->AdaptiveCatchUp = reader->GetBoolean("adaptive_catch_up", true);
         }
     }
 
@@ -456,6 +498,7 @@ namespace Config
         writer->WriteBoolean("advertise", model->Advertise);
         writer->WriteString("advertise_address", model->AdvertiseAddress);
         writer->WriteInt32("maxplayers", model->Maxplayers);
+        writer->WriteInt32("max_spectators", model->MaxSpectators);
         writer->WriteString("server_name", model->ServerName);
         writer->WriteString("server_description", model->ServerDescription);
         writer->WriteString("server_greeting", model->ServerGreeting);
@@ -468,6 +511,9 @@ namespace Config
         writer->WriteBoolean("log_server_actions", model->LogServerActions);
         writer->WriteBoolean("pause_server_if_no_clients", model->PauseServerIfNoClients);
         writer->WriteBoolean("desync_debugging", model->DesyncDebugging);
+        writer->WriteBoolean("io_thread", model->IoThread);
+        writer->WriteBoolean("predict_local_actions", model->PredictLocalActions);
+        writer->WriteBoolean("adaptive_catch_up", model->AdaptiveCatchUp);
     }
 
     static void ReadNotifications(IIniReader* reader)
@@ -569,6 +615,9 @@ namespace Config
             auto model = &gConfigPlugin;
             model->EnableHotReloading = reader->GetBoolean("enable_hot_reloading", false);
             model->AllowedHosts = reader->GetString("allowed_hosts", "");
+            model->TickBudget = reader->GetFloat("tick_budget", 0.0f);
+            model->BudgetPolicy = reader->GetEnum<PluginBudgetPolicy>(
+                "budget_policy", PluginBudgetPolicy::Warn, Enum_PluginBudgetPolicy);
         }
     }
 
@@ -578,6 +627,8 @@ namespace Config
         writer->WriteSection("plugin");
         writer->WriteBoolean("enable_hot_reloading", model->EnableHotReloading);
         writer->WriteString("allowed_hosts", model->AllowedHosts);
+        writer->WriteFloat("tick_budget", model->TickBudget);
+        writer->WriteEnum<PluginBudgetPolicy>("budget_policy", model->BudgetPolicy, Enum_PluginBudgetPolicy);
     }
 
     static bool SetDefaults()
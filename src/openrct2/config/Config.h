@@ -43,6 +43,22 @@ struct GeneralConfiguration
     bool UseVSync;
     bool ShowFPS;
     bool MultiThreading;
+    bool PathfindingFlowFields;
+    bool InstantRideRatings;
+    bool TilePaintCache;
+    bool SpriteAtlasCache;
+    bool BackgroundAutosave;
+    bool ChunkedParkCompression;
+    bool SharedImageCache;
+    bool PathfindingRegions;
+    bool QueuePathLanes;
+    bool StableGuestTickBuckets;
+    bool GroupVehicleUpdatesByRide;
+    bool CompactOutOfMapSurfaces;
+    bool LazyMapAnimations;
+    bool GhostAwarePathfinding;
+    bool ActiveTileUpdates;
+    bool EventDrivenWidePaths;
     bool MinimizeFullscreenFocusLoss;
     bool DisableScreensaver;
 
@@ -161,6 +177,7 @@ struct NetworkConfiguration
     bool Advertise;
     u8string AdvertiseAddress;
     int32_t Maxplayers;
+    int32_t MaxSpectators;
     u8string ServerName;
     u8string ServerDescription;
     u8string ServerGreeting;
@@ -173,6 +190,9 @@ struct NetworkConfiguration
     bool LogServerActions;
     bool PauseServerIfNoClients;
     bool DesyncDebugging;
+    bool IoThread;
+    bool PredictLocalActions;
+    bool AdaptiveCatchUp;
 };
 
 struct NotificationConfiguration
@@ -215,10 +235,19 @@ struct FontConfiguration
     int32_t HintingThreshold;
 };
 
+enum class PluginBudgetPolicy : int32_t
+{
+    Warn,
+    Throttle,
+    Disable,
+};
+
 struct PluginConfiguration
 {
     bool EnableHotReloading;
     u8string AllowedHosts;
+    float TickBudget;
+    PluginBudgetPolicy BudgetPolicy;
 };
 
 enum class Sort : int32_t
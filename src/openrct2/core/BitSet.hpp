@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -88,20 +89,6 @@ namespace OpenRCT2
             static_assert(ComputeBlockSize<31>() == sizeof(uint32_t));
             static_assert(ComputeBlockSize<33>() == sizeof(uintptr_t));
 
-            // TODO: Replace with std::popcount when C++20 is enabled.
-            template<typename T> static constexpr size_t popcount(const T val)
-            {
-                size_t res = 0;
-                auto x = static_cast<std::make_unsigned_t<T>>(val);
-                while (x > 0u)
-                {
-                    if (x & 1u)
-                        res++;
-                    x >>= 1u;
-                }
-                return res;
-            }
-
             template<size_t TByteSize> struct StorageBlockType;
 
             template<> struct StorageBlockType<1>
@@ -292,7 +279,7 @@ namespace OpenRCT2
             size_t numBits = 0;
             for (auto& data : _data)
             {
-                numBits += Detail::BitSet::popcount(data);
+                numBits += std::popcount(data);
             }
             return numBits;
         }
@@ -410,7 +397,7 @@ namespace OpenRCT2
 
         constexpr BitSet& operator^=(const BitSet& other) noexcept
         {
-            *this = *this ^ other;
+            ApplyOpInPlace<std::bit_xor<BlockType>>(other);
             return *this;
         }
 
@@ -423,7 +410,7 @@ namespace OpenRCT2
 
         constexpr BitSet& operator|=(const BitSet& other) noexcept
         {
-            *this = *this | other;
+            ApplyOpInPlace<std::bit_or<BlockType>>(other);
             return *this;
         }
 
@@ -436,7 +423,7 @@ namespace OpenRCT2
 
         constexpr BitSet& operator&=(const BitSet& other) noexcept
         {
-            *this = *this & other;
+            ApplyOpInPlace<std::bit_and<BlockType>>(other);
             return *this;
         }
 
@@ -478,7 +465,165 @@ namespace OpenRCT2
                 _data.begin(), _data.end(), other._data.begin(), other._data.end(), std::greater_equal<StorageBlockType>{});
         }
 
+        // Clears all bits that are set in other, same as *this &= ~other without the temporary.
+        constexpr BitSet& andnot(const BitSet& other) noexcept
+        {
+            for (size_t i = 0; i < BlockCount; i++)
+            {
+                _data[i] &= ~other._data[i];
+            }
+            return *this;
+        }
+
+        constexpr bool any() const noexcept
+        {
+            BlockType res = BlockValueZero;
+            for (size_t i = 0; i < BlockCount; i++)
+            {
+                res |= _data[i];
+            }
+            return res != BlockValueZero;
+        }
+
+        constexpr bool none() const noexcept
+        {
+            return !any();
+        }
+
+        // Returns true if at least one bit is set in both sets.
+        constexpr bool intersects(const BitSet& other) const noexcept
+        {
+            BlockType res = BlockValueZero;
+            for (size_t i = 0; i < BlockCount; i++)
+            {
+                res |= _data[i] & other._data[i];
+            }
+            return res != BlockValueZero;
+        }
+
+        // Returns the index of the first set bit, or size() if no bit is set.
+        constexpr size_t find_first() const noexcept
+        {
+            return FindSetBit(0, _data[0]);
+        }
+
+        // Returns the index of the first set bit after index, or size() if there is none.
+        constexpr size_t find_next(size_t index) const noexcept
+        {
+            index++;
+            if (index >= TBitSize)
+                return TBitSize;
+
+            const auto blockIndex = ComputeBlockIndex(index);
+            const auto blockOffset = ComputeBlockOffset(index);
+            return FindSetBit(blockIndex, static_cast<BlockType>(_data[blockIndex] & (BlockValueMask << blockOffset)));
+        }
+
+        // Iterates the indices of the set bits only, skipping empty blocks as a whole.
+        class set_bit_iterator
+        {
+            const BitSet* _bitset{};
+            size_t _pos{};
+
+        public:
+            constexpr set_bit_iterator() = default;
+
+            constexpr set_bit_iterator(const BitSet* bset, size_t pos)
+                : _bitset(bset)
+                , _pos(pos)
+            {
+            }
+
+            constexpr size_t operator*() const
+            {
+                return _pos;
+            }
+
+            constexpr bool operator==(set_bit_iterator other) const
+            {
+                return _bitset == other._bitset && _pos == other._pos;
+            }
+
+            constexpr bool operator!=(set_bit_iterator other) const
+            {
+                return !(*this == other);
+            }
+
+            constexpr set_bit_iterator& operator++()
+            {
+                _pos = _bitset->find_next(_pos);
+                return *this;
+            }
+
+            constexpr set_bit_iterator operator++(int)
+            {
+                set_bit_iterator res = *this;
+                ++(*this);
+                return res;
+            }
+
+        public:
+            using difference_type = std::ptrdiff_t;
+            using value_type = size_t;
+            using pointer = const size_t*;
+            using reference = size_t;
+            using iterator_category = std::forward_iterator_tag;
+        };
+
+        class set_bit_range
+        {
+            const BitSet* _bitset;
+
+        public:
+            constexpr explicit set_bit_range(const BitSet* bset)
+                : _bitset(bset)
+            {
+            }
+
+            constexpr set_bit_iterator begin() const noexcept
+            {
+                return set_bit_iterator(_bitset, _bitset->find_first());
+            }
+
+            constexpr set_bit_iterator end() const noexcept
+            {
+                return set_bit_iterator(_bitset, TBitSize);
+            }
+        };
+
+        // Range over the indices of the set bits in ascending order, for use in range based for loops.
+        constexpr set_bit_range set_bits() const noexcept
+        {
+            return set_bit_range(this);
+        }
+
     private:
+        // Written as plain loops over the blocks so the compiler can vectorise them for the larger sets.
+        template<typename TOperator> constexpr void ApplyOpInPlace(const BitSet& src) noexcept
+        {
+            TOperator op{};
+            for (size_t i = 0; i < BlockCount; i++)
+            {
+                _data[i] = op(_data[i], src._data[i]);
+            }
+            if constexpr (RequiresTrim)
+            {
+                Trim();
+            }
+        }
+
+        // Returns the index of the lowest bit in block, continuing with the blocks after blockIndex if it is empty.
+        constexpr size_t FindSetBit(size_t blockIndex, BlockType block) const noexcept
+        {
+            while (block == BlockValueZero)
+            {
+                if (++blockIndex >= BlockCount)
+                    return TBitSize;
+                block = _data[blockIndex];
+            }
+            return blockIndex * BlockBitSize + static_cast<size_t>(std::countr_zero(block));
+        }
+
         template<typename TOperator, size_t... TIndex>
         void ApplyOp(BitSet& dst, const BitSet& src, std::index_sequence<TIndex...>) const
         {
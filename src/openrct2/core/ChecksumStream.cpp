@@ -16,15 +16,31 @@
 namespace OpenRCT2
 {
 #ifndef DISABLE_NETWORK
-    ChecksumStream::ChecksumStream(std::array<std::byte, 20>& buf)
+    ChecksumStream::ChecksumStream(std::array<std::byte, 20>& buf, ChecksumAlgorithm algorithm)
         : _checksum(buf)
+        , _algorithm(algorithm)
     {
         uint64_t* hash = reinterpret_cast<uint64_t*>(_checksum.data());
         *hash = Seed;
     }
 
+    void ChecksumStream::Finish()
+    {
+        if (_algorithm == ChecksumAlgorithm::FNV1aLanes)
+        {
+            const auto hash = _lanes.Finish();
+            std::memcpy(_checksum.data(), &hash, sizeof(hash));
+        }
+    }
+
     void ChecksumStream::Write(const void* buffer, uint64_t length)
     {
+        if (_algorithm == ChecksumAlgorithm::FNV1aLanes)
+        {
+            _lanes.Update(buffer, static_cast<size_t>(length));
+            return;
+        }
+
         uint64_t* hash = reinterpret_cast<uint64_t*>(_checksum.data());
         for (size_t i = 0; i < length; i += sizeof(uint64_t))
         {
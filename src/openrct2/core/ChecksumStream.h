@@ -10,12 +10,21 @@
 #pragma once
 
 #include "../common.h"
+#include "FNV1aLanes.hpp"
 #include "IStream.hpp"
 
 #include <array>
 
 namespace OpenRCT2
 {
+    enum class ChecksumAlgorithm : uint8_t
+    {
+        // One FNV-1a chain over 64 bit words, kept for anything that has to match older checksums.
+        FNV1a,
+        // Crypt::FNV1aLanes, faster but different results.
+        FNV1aLanes,
+    };
+
     /**
      * A stream for checksumming a stream of data
      */
@@ -23,12 +32,17 @@ namespace OpenRCT2
     {
         // FIXME: Move the checksum implementation out.
         std::array<std::byte, 20>& _checksum;
+        ChecksumAlgorithm _algorithm;
+        Crypt::FNV1aLanes _lanes;
 
         static constexpr uint64_t Seed = 0xcbf29ce484222325ULL;
         static constexpr uint64_t Prime = 0x00000100000001B3ULL;
 
     public:
-        ChecksumStream(std::array<std::byte, 20>& buf);
+        ChecksumStream(std::array<std::byte, 20>& buf, ChecksumAlgorithm algorithm = ChecksumAlgorithm::FNV1a);
+
+        // Stores the checksum in the buffer. FNV1a keeps the buffer up to date on every write, FNV1aLanes only here.
+        void Finish();
 
         virtual ~ChecksumStream() = default;
 
@@ -57,6 +57,12 @@ public:
         return _activeStream;
     }
 
+    // Empties the serialiser's own stream so it can be used for the next object without allocating again.
+    void Reset()
+    {
+        _stream.Clear();
+    }
+
     template<typename T> DataSerialiser& operator<<(const T& data)
     {
         if (!_isLogging)
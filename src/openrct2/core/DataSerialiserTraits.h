@@ -25,9 +25,11 @@
 #include "Endianness.h"
 #include "MemoryStream.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <iomanip>
 #include <iostream>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 
@@ -89,6 +91,70 @@ template<typename T> struct DataSerializerTraitsIntegral
     }
 };
 
+/**
+ * Element types whose encoding is just their in-memory bytes, byte swapped per element if SwapBytes is set. Ranges of
+ * these are written and read with a single stream call instead of one call per element.
+ */
+template<typename T> struct DataSerializerBulkT
+{
+    // bool is left out because std::vector<bool> is not contiguous.
+    static constexpr bool Enabled = (std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_enum_v<T>;
+    static constexpr bool SwapBytes = sizeof(T) > 1;
+};
+
+template<typename T, T TNullValue, typename TTag> struct DataSerializerBulkT<TIdentifier<T, TNullValue, TTag>>
+{
+    static_assert(sizeof(TIdentifier<T, TNullValue, TTag>) == sizeof(T));
+    static constexpr bool Enabled = std::is_trivially_copyable_v<TIdentifier<T, TNullValue, TTag>>;
+    static constexpr bool SwapBytes = sizeof(T) > 1;
+};
+
+// Matches DataSerializerTraitsT<TileElement>, which writes every field as a byte in memory order.
+template<> struct DataSerializerBulkT<TileElement>
+{
+    static constexpr bool Enabled = true;
+    static constexpr bool SwapBytes = false;
+};
+
+template<typename T> void DataSerializerEncodeBulk(OpenRCT2::IStream* stream, const T* data, size_t count)
+{
+    if constexpr (!DataSerializerBulkT<T>::SwapBytes)
+    {
+        stream->Write(data, count * sizeof(T));
+    }
+    else
+    {
+        // Same result as ByteSwapBE on every element, done in a stack buffer so the stream is still hit rarely.
+        constexpr size_t kChunkCount = 1024 / sizeof(T);
+        uint8_t buffer[kChunkCount * sizeof(T)];
+        while (count > 0)
+        {
+            const auto chunkCount = std::min(count, kChunkCount);
+            std::memcpy(buffer, data, chunkCount * sizeof(T));
+            for (size_t i = 0; i < chunkCount; i++)
+            {
+                std::reverse(buffer + (i * sizeof(T)), buffer + ((i + 1) * sizeof(T)));
+            }
+            stream->Write(buffer, chunkCount * sizeof(T));
+            data += chunkCount;
+            count -= chunkCount;
+        }
+    }
+}
+
+template<typename T> void DataSerializerDecodeBulk(OpenRCT2::IStream* stream, T* data, size_t count)
+{
+    stream->Read(data, count * sizeof(T));
+    if constexpr (DataSerializerBulkT<T>::SwapBytes)
+    {
+        auto* bytes = reinterpret_cast<uint8_t*>(data);
+        for (size_t i = 0; i < count; i++)
+        {
+            std::reverse(bytes + (i * sizeof(T)), bytes + ((i + 1) * sizeof(T)));
+        }
+    }
+}
+
 template<> struct DataSerializerTraitsT<bool>
 {
     static void encode(OpenRCT2::IStream* stream, const bool& val)
@@ -257,10 +323,16 @@ template<> struct DataSerializerTraitsT<OpenRCT2::MemoryStream>
         uint32_t length = 0;
         s.decode(stream, length);
 
-        auto buf = std::make_unique<uint8_t[]>(length);
-        stream->Read(buf.get(), length);
-
-        val.Write(buf.get(), length);
+        // Copy through a small buffer rather than allocating one for the whole length.
+        val.Reserve(static_cast<size_t>(val.GetPosition()) + length);
+        uint8_t buf[4096];
+        while (length > 0)
+        {
+            const auto chunkLength = std::min<uint32_t>(length, sizeof(buf));
+            stream->Read(buf, chunkLength);
+            val.Write(buf, chunkLength);
+            length -= chunkLength;
+        }
     }
     static void log(OpenRCT2::IStream* stream, const OpenRCT2::MemoryStream& tag)
     {
@@ -275,10 +347,17 @@ template<typename _Ty, size_t _Size> struct DataSerializerTraitsPODArray
         uint16_t swapped = ByteSwapBE(len);
         stream->Write(&swapped);
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
+        if constexpr (DataSerializerBulkT<_Ty>::Enabled)
         {
-            s.encode(stream, sub);
+            DataSerializerEncodeBulk(stream, std::data(val), std::size(val));
+        }
+        else
+        {
+            DataSerializerTraits<_Ty> s;
+            for (auto&& sub : val)
+            {
+                s.encode(stream, sub);
+            }
         }
     }
     static void decode(OpenRCT2::IStream* stream, _Ty (&val)[_Size])
@@ -290,10 +369,17 @@ template<typename _Ty, size_t _Size> struct DataSerializerTraitsPODArray
         if (len != _Size)
             throw std::runtime_error("Invalid size, can't decode");
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
+        if constexpr (DataSerializerBulkT<_Ty>::Enabled)
         {
-            s.decode(stream, sub);
+            DataSerializerDecodeBulk(stream, std::data(val), _Size);
+        }
+        else
+        {
+            DataSerializerTraits<_Ty> s;
+            for (auto&& sub : val)
+            {
+                s.decode(stream, sub);
+            }
         }
     }
     static void log(OpenRCT2::IStream* stream, const _Ty (&val)[_Size])
@@ -343,10 +429,17 @@ template<typename _Ty, size_t _Size> struct DataSerializerTraitsT<std::array<_Ty
         uint16_t swapped = ByteSwapBE(len);
         stream->Write(&swapped);
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
+        if constexpr (DataSerializerBulkT<_Ty>::Enabled)
         {
-            s.encode(stream, sub);
+            DataSerializerEncodeBulk(stream, std::data(val), std::size(val));
+        }
+        else
+        {
+            DataSerializerTraits<_Ty> s;
+            for (auto&& sub : val)
+            {
+                s.encode(stream, sub);
+            }
         }
     }
     static void decode(OpenRCT2::IStream* stream, std::array<_Ty, _Size>& val)
@@ -358,10 +451,17 @@ template<typename _Ty, size_t _Size> struct DataSerializerTraitsT<std::array<_Ty
         if (len != _Size)
             throw std::runtime_error("Invalid size, can't decode");
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
+        if constexpr (DataSerializerBulkT<_Ty>::Enabled)
+        {
+            DataSerializerDecodeBulk(stream, std::data(val), _Size);
+        }
+        else
         {
-            s.decode(stream, sub);
+            DataSerializerTraits<_Ty> s;
+            for (auto&& sub : val)
+            {
+                s.decode(stream, sub);
+            }
         }
     }
     static void log(OpenRCT2::IStream* stream, const std::array<_Ty, _Size>& val)
@@ -385,10 +485,17 @@ template<typename _Ty> struct DataSerializerTraitsT<std::vector<_Ty>>
         uint16_t swapped = ByteSwapBE(len);
         stream->Write(&swapped);
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
+        if constexpr (DataSerializerBulkT<_Ty>::Enabled)
+        {
+            DataSerializerEncodeBulk(stream, std::data(val), std::size(val));
+        }
+        else
         {
-            s.encode(stream, sub);
+            DataSerializerTraits<_Ty> s;
+            for (auto&& sub : val)
+            {
+                s.encode(stream, sub);
+            }
         }
     }
     static void decode(OpenRCT2::IStream* stream, std::vector<_Ty>& val)
@@ -397,12 +504,21 @@ template<typename _Ty> struct DataSerializerTraitsT<std::vector<_Ty>>
         stream->Read(&len);
         len = ByteSwapBE(len);
 
-        DataSerializerTraits<_Ty> s;
-        for (auto i = 0; i < len; ++i)
+        if constexpr (DataSerializerBulkT<_Ty>::Enabled)
         {
-            _Ty sub{};
-            s.decode(stream, sub);
-            val.push_back(std::move(sub));
+            const auto offset = val.size();
+            val.resize(offset + len);
+            DataSerializerDecodeBulk(stream, val.data() + offset, len);
+        }
+        else
+        {
+            DataSerializerTraits<_Ty> s;
+            for (auto i = 0; i < len; ++i)
+            {
+                _Ty sub{};
+                s.decode(stream, sub);
+                val.push_back(std::move(sub));
+            }
         }
     }
     static void log(OpenRCT2::IStream* stream, const std::vector<_Ty>& val)
@@ -418,6 +534,70 @@ template<typename _Ty> struct DataSerializerTraitsT<std::vector<_Ty>>
     }
 };
 
+/**
+ * Serialises a range the caller already has storage for, e.g. ds << std::span(buffer). Unlike the containers above the
+ * length is a uint32_t and loading requires the span to have the same length as the data.
+ */
+template<typename _Ty> struct DataSerializerTraitsT<std::span<_Ty>>
+{
+    static void encode(OpenRCT2::IStream* stream, const std::span<_Ty>& val)
+    {
+        uint32_t len = static_cast<uint32_t>(val.size());
+        uint32_t swapped = ByteSwapBE(len);
+        stream->Write(&swapped);
+
+        if constexpr (DataSerializerBulkT<std::remove_const_t<_Ty>>::Enabled)
+        {
+            DataSerializerEncodeBulk(stream, val.data(), val.size());
+        }
+        else
+        {
+            DataSerializerTraits<std::remove_const_t<_Ty>> s;
+            for (auto&& sub : val)
+            {
+                s.encode(stream, sub);
+            }
+        }
+    }
+    static void decode(OpenRCT2::IStream* stream, std::span<_Ty>& val)
+    {
+        uint32_t len;
+        stream->Read(&len);
+        len = ByteSwapBE(len);
+
+        if (len != val.size())
+            throw std::runtime_error("Invalid size, can't decode");
+
+        if constexpr (std::is_const_v<_Ty>)
+        {
+            throw std::runtime_error("Can't decode into a span of const elements");
+        }
+        else if constexpr (DataSerializerBulkT<_Ty>::Enabled)
+        {
+            DataSerializerDecodeBulk(stream, val.data(), val.size());
+        }
+        else
+        {
+            DataSerializerTraits<_Ty> s;
+            for (auto&& sub : val)
+            {
+                s.decode(stream, sub);
+            }
+        }
+    }
+    static void log(OpenRCT2::IStream* stream, const std::span<_Ty>& val)
+    {
+        stream->Write("{", 1);
+        DataSerializerTraits<std::remove_const_t<_Ty>> s;
+        for (auto&& sub : val)
+        {
+            s.log(stream, sub);
+            stream->Write("; ", 2);
+        }
+        stream->Write("}", 1);
+    }
+};
+
 template<> struct DataSerializerTraitsT<MapRange>
 {
     static void encode(OpenRCT2::IStream* stream, const MapRange& v)
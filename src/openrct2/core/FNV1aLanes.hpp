@@ -0,0 +1,109 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "Endianness.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Crypt
+{
+    /**
+     * FNV-1a over 64 bit words, spread over four lanes that each take every fourth word and are combined at the end.
+     * The lanes don't depend on each other, so on large buffers this runs several times faster than a single FNV-1a
+     * chain where every multiply waits for the previous one.
+     */
+    class FNV1aLanes
+    {
+    private:
+        static constexpr uint64_t Offset = 0xCBF29CE484222325ULL;
+        static constexpr uint64_t Prime = 0x00000100000001B3ULL;
+        static constexpr size_t NumLanes = 4;
+        static constexpr size_t StripeSize = NumLanes * sizeof(uint64_t);
+
+        uint64_t _lanes[NumLanes] = { Offset, Offset ^ 1, Offset ^ 2, Offset ^ 3 };
+        uint8_t _stripe[StripeSize]{};
+        size_t _stripeLen{};
+        uint64_t _length{};
+
+        void ProcessStripe(const uint8_t* src)
+        {
+            for (size_t i = 0; i < NumLanes; i++)
+            {
+                uint64_t temp;
+                std::memcpy(&temp, src + (i * sizeof(uint64_t)), sizeof(temp));
+
+                // Always use value as little endian, most common systems are little.
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+                temp = ByteSwapBE(temp);
+#endif
+
+                _lanes[i] ^= temp;
+                _lanes[i] *= Prime;
+            }
+        }
+
+    public:
+        void Update(const void* data, size_t dataLen)
+        {
+            auto src = static_cast<const uint8_t*>(data);
+            _length += dataLen;
+
+            if (_stripeLen > 0)
+            {
+                const auto fillLen = std::min(StripeSize - _stripeLen, dataLen);
+                std::memcpy(_stripe + _stripeLen, src, fillLen);
+                _stripeLen += fillLen;
+                src += fillLen;
+                dataLen -= fillLen;
+                if (_stripeLen < StripeSize)
+                    return;
+
+                ProcessStripe(_stripe);
+                _stripeLen = 0;
+            }
+
+            for (; dataLen >= StripeSize; dataLen -= StripeSize, src += StripeSize)
+            {
+                ProcessStripe(src);
+            }
+
+            if (dataLen > 0)
+            {
+                std::memcpy(_stripe, src, dataLen);
+                _stripeLen = dataLen;
+            }
+        }
+
+        uint64_t Finish()
+        {
+            // Pad the last stripe with zeroes, the length mixed in below tells them apart from data.
+            if (_stripeLen > 0)
+            {
+                std::memset(_stripe + _stripeLen, 0, StripeSize - _stripeLen);
+                ProcessStripe(_stripe);
+                _stripeLen = 0;
+            }
+
+            uint64_t hash = Offset;
+            for (auto lane : _lanes)
+            {
+                hash ^= lane;
+                hash *= Prime;
+            }
+            hash ^= _length;
+            hash *= Prime;
+            return hash;
+        }
+    };
+} // namespace Crypt
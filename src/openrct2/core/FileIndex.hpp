@@ -20,9 +20,9 @@
 #include "Path.hpp"
 
 #include <chrono>
-#include <list>
+#include <optional>
 #include <string>
-#include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem> class FileIndex
@@ -36,18 +36,43 @@ private:
         uint32_t PathChecksum = 0;
     };
 
+    struct ScannedFile
+    {
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
+    };
+
     struct ScanResult
     {
         DirectoryStats const Stats;
-        std::vector<std::string> const Files;
+        std::vector<ScannedFile> const Files;
 
-        ScanResult(DirectoryStats stats, std::vector<std::string>&& files) noexcept
+        ScanResult(DirectoryStats stats, std::vector<ScannedFile>&& files) noexcept
             : Stats(stats)
             , Files(std::move(files))
         {
         }
     };
 
+    /**
+     * An entry read back from the index file. Files that did not produce an item are still recorded
+     * so they are not parsed again until they change.
+     */
+    struct IndexedFile
+    {
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
+        std::optional<TItem> Item;
+    };
+
+    struct IndexContents
+    {
+        bool UpToDate = false;
+        std::vector<std::string> Paths;
+        std::unordered_map<std::string, IndexedFile> Files;
+    };
+
     struct FileIndexHeader
     {
         uint32_t HeaderSize = sizeof(FileIndexHeader);
@@ -56,11 +81,11 @@ private:
         uint8_t VersionB = 0;
         uint16_t LanguageId = 0;
         DirectoryStats Stats;
-        uint32_t NumItems = 0;
+        uint32_t NumFiles = 0;
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t FILE_INDEX_VERSION = 4;
+    static constexpr uint8_t FILE_INDEX_VERSION = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -96,31 +121,37 @@ public:
     virtual ~FileIndex() = default;
 
     /**
-     * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * Queries and directories and loads the index. If the index is up to date, the items are loaded from
+     * the index and returned, otherwise only the files that were added or changed since the index was
+     * written are loaded again.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
         auto scanResult = Scan();
-        auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (std::get<0>(readIndexResult))
+        auto index = ReadIndexFile(language, scanResult.Stats);
+        if (index.UpToDate)
         {
-            // Index was loaded
-            items = std::get<1>(readIndexResult);
-        }
-        else
-        {
-            // Index was not loaded
-            items = Build(language, scanResult);
+            // Directory is the same, return the saved items in their original order
+            std::vector<TItem> items;
+            items.reserve(index.Paths.size());
+            for (const auto& path : index.Paths)
+            {
+                auto& indexedFile = index.Files[path];
+                if (indexedFile.Item.has_value())
+                {
+                    items.push_back(std::move(indexedFile.Item.value()));
+                }
+            }
+            return items;
         }
-        return items;
+        return Build(language, scanResult, index.Files);
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
     {
         auto scanResult = Scan();
-        auto items = Build(language, scanResult);
+        std::unordered_map<std::string, IndexedFile> noCachedFiles;
+        auto items = Build(language, scanResult, noCachedFiles);
         return items;
     }
 
@@ -139,7 +170,7 @@ private:
     ScanResult Scan() const
     {
         DirectoryStats stats{};
-        std::vector<std::string> files;
+        std::vector<ScannedFile> files;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = Path::GetAbsolute(directory);
@@ -159,20 +190,21 @@ private:
                 stats.FileDateModifiedChecksum = Numerics::ror32(stats.FileDateModifiedChecksum, 5);
                 stats.PathChecksum += GetPathChecksum(path);
 
-                files.push_back(std::move(path));
+                files.push_back({ std::move(path), fileInfo.Size, fileInfo.LastModified });
             }
         }
         return ScanResult(stats, std::move(files));
     }
 
     void BuildRange(
-        int32_t language, const ScanResult& scanResult, size_t rangeStart, size_t rangeEnd, std::vector<TItem>& items,
-        std::atomic<size_t>& processed, std::mutex& printLock) const
+        int32_t language, const ScanResult& scanResult, const std::vector<size_t>& pending, size_t rangeStart,
+        size_t rangeEnd, std::vector<std::optional<TItem>>& results, std::atomic<size_t>& processed,
+        std::mutex& printLock) const
     {
-        items.reserve(rangeEnd - rangeStart);
         for (size_t i = rangeStart; i < rangeEnd; i++)
         {
-            const auto& filePath = scanResult.Files.at(i);
+            const auto fileIndex = pending[i];
+            const auto& filePath = scanResult.Files[fileIndex].Path;
 
             if (_log_levels[EnumValue(DiagnosticLevel::Verbose)])
             {
@@ -180,65 +212,92 @@ private:
                 LOG_VERBOSE("FileIndex:Indexing '%s'", filePath.c_str());
             }
 
-            if (auto item = Create(language, filePath); item.has_value())
-            {
-                items.push_back(std::move(item.value()));
-            }
+            results[fileIndex] = Create(language, filePath);
 
             ++processed;
         }
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    /**
+     * Creates the items for all scanned files, reusing the entries of previously indexed files which have
+     * not changed size or modification date. Items are returned in scan order.
+     */
+    std::vector<TItem> Build(
+        int32_t language, const ScanResult& scanResult, std::unordered_map<std::string, IndexedFile>& cachedFiles) const
     {
-        std::vector<TItem> allItems;
-        Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
+        const size_t totalCount = scanResult.Files.size();
+        std::vector<std::optional<TItem>> results(totalCount);
+        std::vector<size_t> pending;
+        for (size_t i = 0; i < totalCount; i++)
+        {
+            const auto& file = scanResult.Files[i];
+            auto it = cachedFiles.find(file.Path);
+            if (it != cachedFiles.end() && it->second.Size == file.Size && it->second.LastModified == file.LastModified)
+            {
+                results[i] = std::move(it->second.Item);
+            }
+            else
+            {
+                pending.push_back(i);
+            }
+        }
+
+        if (pending.size() == totalCount)
+        {
+            Console::WriteLine("Building %s (%zu items)", _name.c_str(), totalCount);
+        }
+        else
+        {
+            Console::WriteLine("Updating %s (%zu of %zu items changed)", _name.c_str(), pending.size(), totalCount);
+        }
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
-        if (totalCount > 0)
+        const size_t pendingCount = pending.size();
+        if (pendingCount > 0)
         {
             JobPool jobPool;
             std::mutex printLock; // For verbose prints.
 
-            std::list<std::vector<TItem>> containers;
-
             size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
 
             std::atomic<size_t> processed{ 0 };
 
             auto reportProgress = [&]() {
                 const size_t completed = processed;
-                Console::WriteFormat("File %5zu of %zu, done %3d%%\r", completed, totalCount, completed * 100 / totalCount);
+                Console::WriteFormat("File %5zu of %zu, done %3d%%\r", completed, pendingCount, completed * 100 / pendingCount);
             };
 
-            for (size_t rangeStart = 0; rangeStart < totalCount; rangeStart += stepSize)
+            for (size_t rangeStart = 0; rangeStart < pendingCount; rangeStart += stepSize)
             {
-                if (rangeStart + stepSize > totalCount)
+                if (rangeStart + stepSize > pendingCount)
                 {
-                    stepSize = totalCount - rangeStart;
+                    stepSize = pendingCount - rangeStart;
                 }
 
-                auto& items = containers.emplace_back();
-
                 jobPool.AddTask([&, rangeStart, stepSize]() {
-                    BuildRange(language, scanResult, rangeStart, rangeStart + stepSize, items, processed, printLock);
+                    BuildRange(
+                        language, scanResult, pending, rangeStart, rangeStart + stepSize, results, processed, printLock);
                 });
 
                 reportProgress();
             }
 
             jobPool.Join(reportProgress);
+        }
 
-            for (const auto& itr : containers)
+        WriteIndexFile(language, scanResult, results);
+
+        std::vector<TItem> allItems;
+        allItems.reserve(totalCount);
+        for (auto& result : results)
+        {
+            if (result.has_value())
             {
-                allItems.insert(allItems.end(), itr.begin(), itr.end());
+                allItems.push_back(std::move(result.value()));
             }
         }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
-
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration<float>(endTime - startTime);
         Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
@@ -246,10 +305,9 @@ private:
         return allItems;
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    IndexContents ReadIndexFile(int32_t language, const DirectoryStats& stats) const
     {
-        bool loadedItems = false;
-        std::vector<TItem> items;
+        IndexContents index;
         if (File::Exists(_indexPath))
         {
             try
@@ -257,24 +315,41 @@ private:
                 LOG_VERBOSE("FileIndex:Loading index: '%s'", _indexPath.c_str());
                 auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
 
-                // Read header, check if we need to re-scan
+                // Read header, the per-file entries can only be reused if they were built the same way
                 auto header = fs.ReadValue<FileIndexHeader>();
                 if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
+                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language)
                 {
-                    items.reserve(header.NumItems);
+                    index.Paths.reserve(header.NumFiles);
+                    index.Files.reserve(header.NumFiles);
                     DataSerialiser ds(false, fs);
-                    // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
+                    for (uint32_t i = 0; i < header.NumFiles; i++)
+                    {
+                        std::string path;
+                        IndexedFile indexedFile;
+                        bool hasItem = false;
+                        ds << path;
+                        ds << indexedFile.Size;
+                        ds << indexedFile.LastModified;
+                        ds << hasItem;
+                        if (hasItem)
+                        {
+                            TItem item;
+                            Serialise(ds, item);
+                            indexedFile.Item = std::move(item);
+                        }
+                        index.Paths.push_back(path);
+                        index.Files.emplace(std::move(path), std::move(indexedFile));
+                    }
+
+                    index.UpToDate = header.Stats.TotalFiles == stats.TotalFiles
+                        && header.Stats.TotalFileSize == stats.TotalFileSize
+                        && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
+                        && header.Stats.PathChecksum == stats.PathChecksum;
+                    if (!index.UpToDate)
                     {
-                        TItem item;
-                        Serialise(ds, item);
-                        items.emplace_back(std::move(item));
+                        Console::WriteLine("%s out of date", _name.c_str());
                     }
-                    loadedItems = true;
                 }
                 else
                 {
@@ -285,12 +360,14 @@ private:
             {
                 Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
                 Console::Error::WriteLine("%s", e.what());
+                index = {};
             }
         }
-        return std::make_tuple(loadedItems, std::move(items));
+        return index;
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, const std::vector<TItem>& items) const
+    void WriteIndexFile(
+        int32_t language, const ScanResult& scanResult, const std::vector<std::optional<TItem>>& results) const
     {
         try
         {
@@ -304,15 +381,24 @@ private:
             header.VersionA = FILE_INDEX_VERSION;
             header.VersionB = _version;
             header.LanguageId = language;
-            header.Stats = stats;
-            header.NumItems = static_cast<uint32_t>(items.size());
+            header.Stats = scanResult.Stats;
+            header.NumFiles = static_cast<uint32_t>(scanResult.Files.size());
             fs.WriteValue(header);
 
             DataSerialiser ds(true, fs);
-            // Write items
-            for (const auto& item : items)
+            // Write an entry for every scanned file, followed by its item if one was created
+            for (size_t i = 0; i < scanResult.Files.size(); i++)
             {
-                Serialise(ds, item);
+                const auto& file = scanResult.Files[i];
+                bool hasItem = results[i].has_value();
+                ds << file.Path;
+                ds << file.Size;
+                ds << file.LastModified;
+                ds << hasItem;
+                if (hasItem)
+                {
+                    Serialise(ds, results[i].value());
+                }
             }
         }
         catch (const std::exception& e)
@@ -14,8 +14,10 @@
 #    include "../Version.h"
 #    include "../core/Console.hpp"
 
+#    include <array>
 #    include <cstring>
 #    include <memory>
+#    include <mutex>
 #    include <stdexcept>
 #    include <thread>
 
@@ -56,6 +58,62 @@ namespace Http
         return realsize;
     }
 
+    /**
+     * Connections, DNS lookups and TLS sessions shared by all requests, so repeated requests to the same host such as the
+     * master server heartbeats reuse an open connection rather than connecting anew each time.
+     */
+    class ConnectionShare
+    {
+    private:
+        CURLSH* _share{};
+        std::array<std::mutex, CURL_LOCK_DATA_LAST> _locks;
+
+        static void Lock(CURL*, curl_lock_data data, curl_lock_access, void* userptr)
+        {
+            static_cast<ConnectionShare*>(userptr)->_locks[data].lock();
+        }
+
+        static void Unlock(CURL*, curl_lock_data data, void* userptr)
+        {
+            static_cast<ConnectionShare*>(userptr)->_locks[data].unlock();
+        }
+
+    public:
+        ConnectionShare()
+        {
+            // Has to happen before any other thread uses cURL, the handle is created on first use
+            curl_global_init(CURL_GLOBAL_DEFAULT);
+            _share = curl_share_init();
+            if (_share != nullptr)
+            {
+                curl_share_setopt(_share, CURLSHOPT_LOCKFUNC, Lock);
+                curl_share_setopt(_share, CURLSHOPT_UNLOCKFUNC, Unlock);
+                curl_share_setopt(_share, CURLSHOPT_USERDATA, this);
+                curl_share_setopt(_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+                curl_share_setopt(_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#    if LIBCURL_VERSION_NUM >= 0x073900
+                curl_share_setopt(_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#    endif
+            }
+        }
+
+        ConnectionShare(const ConnectionShare&) = delete;
+        ConnectionShare& operator=(const ConnectionShare&) = delete;
+
+        // Not cleaned up, requests on detached threads may still be using it when the program exits
+
+        CURLSH* Get() const
+        {
+            return _share;
+        }
+    };
+
+    static CURLSH* GetConnectionShare()
+    {
+        static auto* share = new ConnectionShare();
+        return share->Get();
+    }
+
     struct WriteThis
     {
         const char* readptr;
@@ -84,6 +142,7 @@ namespace Http
 
     Response Do(const Request& req)
     {
+        auto* share = GetConnectionShare();
         CURL* curl = curl_easy_init();
         std::shared_ptr<void> _(nullptr, [curl](...) { curl_easy_cleanup(curl); });
 
@@ -121,6 +180,13 @@ namespace Http
         curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, true);
         curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, true);
         curl_easy_setopt(curl, CURLOPT_USERAGENT, OPENRCT2_USER_AGENT);
+        curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+#    if LIBCURL_VERSION_NUM >= 0x072F00
+        // Falls back to HTTP/1.1 when the server or the cURL build does not support HTTP/2
+        curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+#    endif
+        if (share != nullptr)
+            curl_easy_setopt(curl, CURLOPT_SHARE, share);
 
         curl_slist* chunk = nullptr;
         std::shared_ptr<void> __(nullptr, [chunk](...) { curl_slist_free_all(chunk); });
@@ -0,0 +1,54 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_HTTP
+
+#    include "Http.h"
+
+#    include <mutex>
+#    include <vector>
+
+namespace Http
+{
+    struct CompletedRequest
+    {
+        Response Res;
+        std::function<void(Response& res)> Fn;
+    };
+
+    static std::mutex _completedMutex;
+    static std::vector<CompletedRequest> _completed;
+
+    void DoAsyncOnMainThread(const Request& req, std::function<void(Response& res)> fn)
+    {
+        DoAsync(req, [fn = std::move(fn)](Response& res) {
+            std::lock_guard<std::mutex> lock(_completedMutex);
+            _completed.push_back({ std::move(res), fn });
+        });
+    }
+
+    void Update()
+    {
+        std::vector<CompletedRequest> completed;
+        {
+            std::lock_guard<std::mutex> lock(_completedMutex);
+            if (_completed.empty())
+                return;
+            completed.swap(_completed);
+        }
+
+        // Run outside of the lock, a callback may well start the next request
+        for (auto& request : completed)
+        {
+            request.Fn(request.Res);
+        }
+    }
+} // namespace Http
+
+#endif // DISABLE_HTTP
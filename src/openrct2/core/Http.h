@@ -71,6 +71,17 @@ namespace Http
         });
         thread.detach();
     }
+
+    /**
+     * Performs the request on a background thread like DoAsync, but queues the callback to run on the main thread
+     * during the next Update, so it is free to change game and network state.
+     */
+    void DoAsyncOnMainThread(const Request& req, std::function<void(Response& res)> fn);
+
+    /**
+     * Runs the callbacks of the requests made with DoAsyncOnMainThread that completed since the last call.
+     */
+    void Update();
 } // namespace Http
 
 #endif // DISABLE_HTTP
@@ -163,14 +163,87 @@ namespace Imaging
         }
     }
 
-    static void WritePng(std::ostream& ostream, const Image& image)
+    class PngStreamWriter final : public IImageStreamWriter
     {
-        png_structp png_ptr = nullptr;
-        png_colorp png_palette = nullptr;
-        try
+    private:
+        std::ofstream _fileStream;
+        png_structp _png{};
+        png_infop _info{};
+        png_colorp _palette{};
+        uint32_t _rowsLeft{};
+
+    public:
+        PngStreamWriter(std::string_view path, uint32_t width, uint32_t height, uint32_t depth, const GamePalette* palette)
+            : _fileStream(fs::u8path(path), std::ios::binary)
         {
-            png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, PngError, PngWarning);
-            if (png_ptr == nullptr)
+            if (!_fileStream.is_open())
+            {
+                throw std::runtime_error("Unable to open file for writing.");
+            }
+            Begin(_fileStream, width, height, depth, palette);
+        }
+
+        PngStreamWriter(std::ostream& ostream, uint32_t width, uint32_t height, uint32_t depth, const GamePalette* palette)
+        {
+            Begin(ostream, width, height, depth, palette);
+        }
+
+        ~PngStreamWriter() override
+        {
+            Destroy();
+        }
+
+        void WriteRows(const uint8_t* pixels, uint32_t numRows, uint32_t stride) override
+        {
+            if (_png == nullptr || numRows > _rowsLeft)
+            {
+                throw std::runtime_error("Too many rows written to png.");
+            }
+
+            // Set error handler
+            if (setjmp(png_jmpbuf(_png)))
+            {
+                throw std::runtime_error("PNG ERROR");
+            }
+
+            for (uint32_t y = 0; y < numRows; y++)
+            {
+                png_write_row(_png, const_cast<png_byte*>(pixels));
+                pixels += stride;
+            }
+            _rowsLeft -= numRows;
+        }
+
+        void Finish() override
+        {
+            if (_png == nullptr || _rowsLeft != 0)
+            {
+                throw std::runtime_error("Not all rows written to png.");
+            }
+
+            // Set error handler
+            if (setjmp(png_jmpbuf(_png)))
+            {
+                throw std::runtime_error("PNG ERROR");
+            }
+
+            png_write_end(_png, nullptr);
+            Destroy();
+            if (_fileStream.is_open())
+            {
+                _fileStream.close();
+                if (_fileStream.fail())
+                {
+                    throw std::runtime_error("Unable to write png file.");
+                }
+            }
+        }
+
+    private:
+        void Begin(std::ostream& ostream, uint32_t width, uint32_t height, uint32_t depth, const GamePalette* palette)
+        {
+            _png = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, PngError, PngWarning);
+            if (_png == nullptr)
             {
                 throw std::runtime_error("png_create_write_struct failed.");
             }
@@ -180,76 +253,81 @@ namespace Imaging
             text_ptr[0].text = const_cast<char*>(gVersionInfoFull);
             text_ptr[0].compression = PNG_TEXT_COMPRESSION_zTXt;
 
-            auto info_ptr = png_create_info_struct(png_ptr);
-            if (info_ptr == nullptr)
+            _info = png_create_info_struct(_png);
+            if (_info == nullptr)
             {
+                Destroy();
                 throw std::runtime_error("png_create_info_struct failed.");
             }
 
-            if (image.Depth == 8)
+            if (depth == 8)
             {
-                if (image.Palette == nullptr)
+                if (palette == nullptr)
                 {
+                    Destroy();
                     throw std::runtime_error("Expected a palette for 8-bit image.");
                 }
 
                 // Set the palette
-                png_palette = static_cast<png_colorp>(png_malloc(png_ptr, PNG_MAX_PALETTE_LENGTH * sizeof(png_color)));
-                if (png_palette == nullptr)
+                _palette = static_cast<png_colorp>(png_malloc(_png, PNG_MAX_PALETTE_LENGTH * sizeof(png_color)));
+                if (_palette == nullptr)
                 {
+                    Destroy();
                     throw std::runtime_error("png_malloc failed.");
                 }
                 for (size_t i = 0; i < PNG_MAX_PALETTE_LENGTH; i++)
                 {
-                    const auto& entry = (*image.Palette)[i];
-                    png_palette[i].blue = entry.Blue;
-                    png_palette[i].green = entry.Green;
-                    png_palette[i].red = entry.Red;
+                    const auto& entry = (*palette)[i];
+                    _palette[i].blue = entry.Blue;
+                    _palette[i].green = entry.Green;
+                    _palette[i].red = entry.Red;
                 }
-                png_set_PLTE(png_ptr, info_ptr, png_palette, PNG_MAX_PALETTE_LENGTH);
+                png_set_PLTE(_png, _info, _palette, PNG_MAX_PALETTE_LENGTH);
             }
 
-            png_set_write_fn(png_ptr, &ostream, PngWriteData, PngFlush);
+            png_set_write_fn(_png, &ostream, PngWriteData, PngFlush);
 
             // Set error handler
-            if (setjmp(png_jmpbuf(png_ptr)))
+            if (setjmp(png_jmpbuf(_png)))
             {
+                Destroy();
                 throw std::runtime_error("PNG ERROR");
             }
 
             // Write header
             auto colourType = PNG_COLOR_TYPE_RGB_ALPHA;
-            if (image.Depth == 8)
+            if (depth == 8)
             {
                 png_byte transparentIndex = 0;
-                png_set_tRNS(png_ptr, info_ptr, &transparentIndex, 1, nullptr);
+                png_set_tRNS(_png, _info, &transparentIndex, 1, nullptr);
                 colourType = PNG_COLOR_TYPE_PALETTE;
             }
-            png_set_text(png_ptr, info_ptr, text_ptr, 1);
+            png_set_text(_png, _info, text_ptr, 1);
             png_set_IHDR(
-                png_ptr, info_ptr, image.Width, image.Height, 8, colourType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
+                _png, _info, width, height, 8, colourType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
                 PNG_FILTER_TYPE_DEFAULT);
-            png_write_info(png_ptr, info_ptr);
+            png_write_info(_png, _info);
+            _rowsLeft = height;
+        }
 
-            // Write pixels
-            auto pixels = image.Pixels.data();
-            for (uint32_t y = 0; y < image.Height; y++)
+        void Destroy()
+        {
+            if (_png != nullptr)
             {
-                png_write_row(png_ptr, const_cast<png_byte*>(pixels));
-                pixels += image.Stride;
+                png_free(_png, _palette);
+                png_destroy_write_struct(&_png, _info != nullptr ? &_info : nullptr);
             }
-
-            png_write_end(png_ptr, nullptr);
-            png_destroy_info_struct(png_ptr, &info_ptr);
-            png_free(png_ptr, png_palette);
-            png_destroy_write_struct(&png_ptr, nullptr);
-        }
-        catch (const std::exception&)
-        {
-            png_free(png_ptr, png_palette);
-            png_destroy_write_struct(&png_ptr, nullptr);
-            throw;
+            _png = nullptr;
+            _info = nullptr;
+            _palette = nullptr;
         }
+    };
+
+    static void WritePng(std::ostream& ostream, const Image& image)
+    {
+        PngStreamWriter writer(ostream, image.Width, image.Height, image.Depth, image.Palette.get());
+        writer.WriteRows(image.Pixels.data(), image.Height, image.Stride);
+        writer.Finish();
     }
 
     IMAGE_FORMAT GetImageFormatFromPath(std::string_view path)
@@ -341,4 +419,10 @@ namespace Imaging
                 throw std::runtime_error(EXCEPTION_IMAGE_FORMAT_UNKNOWN);
         }
     }
+
+    std::unique_ptr<IImageStreamWriter> CreatePngStreamWriter(
+        std::string_view path, uint32_t width, uint32_t height, const GamePalette& palette)
+    {
+        return std::make_unique<PngStreamWriter>(path, width, height, 8, &palette);
+    }
 } // namespace Imaging
@@ -52,4 +52,18 @@ namespace Imaging
     void WriteToFile(std::string_view path, const Image& image, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
 
     void SetReader(IMAGE_FORMAT format, ImageReaderFunc impl);
+
+    /**
+     * Writes an image a band of rows at a time, for images too large to be held in memory as a whole.
+     */
+    struct IImageStreamWriter
+    {
+        virtual ~IImageStreamWriter() = default;
+
+        virtual void WriteRows(const uint8_t* pixels, uint32_t numRows, uint32_t stride) = 0;
+        virtual void Finish() = 0;
+    };
+
+    std::unique_ptr<IImageStreamWriter> CreatePngStreamWriter(
+        std::string_view path, uint32_t width, uint32_t height, const GamePalette& palette);
 } // namespace Imaging
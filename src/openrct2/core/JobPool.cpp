@@ -9,7 +9,6 @@
 
 #include "JobPool.h"
 
-#include <algorithm>
 #include <cassert>
 
 JobPool::TaskData::TaskData(std::function<void()> workFn, std::function<void()> completionFn)
@@ -23,7 +22,11 @@ JobPool::JobPool(size_t maxThreads)
     maxThreads = std::min<size_t>(maxThreads, std::thread::hardware_concurrency());
     for (size_t n = 0; n < maxThreads; n++)
     {
-        _threads.emplace_back(&JobPool::ProcessQueue, this);
+        _queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (size_t n = 0; n < maxThreads; n++)
+    {
+        _threads.emplace_back(&JobPool::ProcessQueue, this, n);
     }
 }
 
@@ -44,9 +47,16 @@ JobPool::~JobPool()
 
 void JobPool::AddTask(std::function<void()> workFn, std::function<void()> completionFn)
 {
-    unique_lock lock(_mutex);
-    _pending.emplace_back(workFn, completionFn);
-    _condPending.notify_one();
+    auto* taskData = new TaskData(workFn, completionFn);
+    _activeTasks++;
+
+    if (_threads.empty())
+    {
+        // Nothing to hand the task to, run it right away.
+        RunTask(*this, taskData);
+        return;
+    }
+    Push({ RunTask, taskData });
 }
 
 void JobPool::Join(std::function<void()> reportFn)
@@ -54,20 +64,20 @@ void JobPool::Join(std::function<void()> reportFn)
     unique_lock lock(_mutex);
     while (true)
     {
-        // Wait for the queue to become empty or having completed tasks.
-        _condComplete.wait(lock, [this]() { return (_pending.empty() && _processing == 0) || !_completed.empty(); });
+        // Wait for all tasks to finish or having completed tasks.
+        _condComplete.wait(lock, [this]() { return _activeTasks == 0 || !_completed.empty(); });
 
         // Dispatch all completion callbacks if there are any.
         while (!_completed.empty())
         {
-            auto taskData = _completed.front();
+            auto taskData = std::move(_completed.front());
             _completed.pop_front();
 
-            if (taskData.CompletionFn)
+            if (taskData->CompletionFn)
             {
                 lock.unlock();
 
-                taskData.CompletionFn();
+                taskData->CompletionFn();
 
                 lock.lock();
             }
@@ -83,7 +93,7 @@ void JobPool::Join(std::function<void()> reportFn)
         }
 
         // If everything is empty and no more work has to be done we can stop waiting.
-        if (_completed.empty() && _pending.empty() && _processing == 0)
+        if (_completed.empty() && _activeTasks == 0)
         {
             break;
         }
@@ -92,35 +102,146 @@ void JobPool::Join(std::function<void()> reportFn)
 
 size_t JobPool::CountPending()
 {
-    unique_lock lock(_mutex);
-    return _pending.size();
+    return static_cast<size_t>(std::max<ptrdiff_t>(_queuedJobs, 0));
 }
 
-void JobPool::ProcessQueue()
+size_t JobPool::CountThreads() const
 {
-    unique_lock lock(_mutex);
-    do
+    return _threads.size();
+}
+
+void JobPool::Push(Job job)
+{
+    auto& queue = *_queues[_nextQueue++ % _queues.size()];
     {
-        // Wait for work or cancellation.
-        _condPending.wait(lock, [this]() { return _shouldStop || !_pending.empty(); });
+        std::lock_guard<std::mutex> lock(queue.Mutex);
+        queue.Jobs.push_back(job);
+    }
+    {
+        // Counted under the pool lock so a worker that is about to sleep can not miss it.
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queuedJobs++;
+    }
+    _condPending.notify_one();
+}
+
+bool JobPool::TryPop(size_t queueIndex, Job& job)
+{
+    auto& queue = *_queues[queueIndex];
+    std::lock_guard<std::mutex> lock(queue.Mutex);
+    if (queue.Jobs.empty())
+        return false;
+
+    job = queue.Jobs.front();
+    queue.Jobs.pop_front();
+    _queuedJobs--;
+    return true;
+}
+
+bool JobPool::TrySteal(size_t queueIndex, Job& job)
+{
+    // Take from the back of the other queues, their owners work from the front.
+    const auto numQueues = _queues.size();
+    for (size_t i = 1; i <= numQueues; i++)
+    {
+        const auto index = (queueIndex + i) % numQueues;
+        if (index == queueIndex)
+            continue;
+
+        auto& queue = *_queues[index];
 
-        if (!_pending.empty())
+        std::lock_guard<std::mutex> lock(queue.Mutex);
+        if (queue.Jobs.empty())
+            continue;
+
+        job = queue.Jobs.back();
+        queue.Jobs.pop_back();
+        _queuedJobs--;
+        return true;
+    }
+    return false;
+}
+
+void JobPool::ProcessQueue(size_t queueIndex)
+{
+    while (true)
+    {
+        Job job;
+        if (TryPop(queueIndex, job) || TrySteal(queueIndex, job))
         {
-            _processing++;
+            job.Fn(*this, job.Context);
+            continue;
+        }
 
-            auto taskData = _pending.front();
-            _pending.pop_front();
+        // Wait for work or cancellation.
+        unique_lock lock(_mutex);
+        _condPending.wait(lock, [this]() { return _shouldStop || _queuedJobs > 0; });
+        if (_shouldStop && _queuedJobs <= 0)
+        {
+            break;
+        }
+    }
+}
 
-            lock.unlock();
+void JobPool::RunTask(JobPool& pool, void* context)
+{
+    std::unique_ptr<TaskData> taskData(static_cast<TaskData*>(context));
+    taskData->WorkFn();
 
-            taskData.WorkFn();
+    {
+        std::lock_guard<std::mutex> lock(pool._mutex);
+        pool._completed.push_back(std::move(taskData));
+        pool._activeTasks--;
+    }
+    pool._condComplete.notify_one();
+}
 
-            lock.lock();
+void JobPool::ProcessRange(RangeData& range)
+{
+    while (true)
+    {
+        const auto begin = range.Next.fetch_add(range.Grain, std::memory_order_relaxed);
+        if (begin >= range.End)
+            break;
 
-            _completed.push_back(std::move(taskData));
+        range.Invoke(range.Fn, begin, std::min(begin + range.Grain, range.End));
+    }
+}
+
+void JobPool::RunRangeHelper(JobPool&, void* context)
+{
+    auto& range = *static_cast<RangeData*>(context);
+    ProcessRange(range);
+    // The range may go out of scope as soon as the last helper is done with it.
+    range.ActiveHelpers.fetch_sub(1, std::memory_order_release);
+}
+
+void JobPool::RunRange(RangeData& range)
+{
+    if (range.Next >= range.End)
+        return;
+
+    const auto numSlices = (range.End - range.Next + range.Grain - 1) / range.Grain;
+    const auto numHelpers = std::min(_threads.size(), numSlices - 1);
+    range.ActiveHelpers = numHelpers;
+    for (size_t i = 0; i < numHelpers; i++)
+    {
+        Push({ RunRangeHelper, &range });
+    }
 
-            _processing--;
-            _condComplete.notify_one();
+    ProcessRange(range);
+
+    // Helpers that have not started yet may be stuck behind other jobs, run whatever is queued while waiting.
+    while (range.ActiveHelpers.load(std::memory_order_acquire) != 0)
+    {
+        Job job;
+        if (TrySteal(_queues.size(), job))
+        {
+            job.Fn(*this, job.Context);
+        }
+        else
+        {
+            std::this_thread::yield();
         }
-    } while (!_shouldStop);
+    }
 }
@@ -9,17 +9,32 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
 #include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
+/**
+ * Thread pool where every worker has its own queue. Jobs are spread over the queues and a worker that runs out of work
+ * steals from the others, so workers only ever contend on a queue when one of them is stealing.
+ */
 class JobPool
 {
 private:
+    // Queue entry, a plain function and context pointer so queueing a job does not allocate.
+    struct Job
+    {
+        void (*Fn)(JobPool& pool, void* context);
+        void* Context;
+    };
+
     struct TaskData
     {
         const std::function<void()> WorkFn;
@@ -28,11 +43,32 @@ private:
         TaskData(std::function<void()> workFn, std::function<void()> completionFn);
     };
 
+    struct WorkerQueue
+    {
+        std::mutex Mutex;
+        std::deque<Job> Jobs;
+    };
+
+    // State shared by everyone working on a ParallelFor call, lives on the stack of the calling thread.
+    struct RangeData
+    {
+        std::atomic<size_t> Next;
+        size_t End;
+        size_t Grain;
+        void (*Invoke)(void* fn, size_t begin, size_t end);
+        void* Fn;
+        std::atomic<size_t> ActiveHelpers;
+    };
+
     std::atomic_bool _shouldStop = { false };
-    std::atomic<size_t> _processing = { 0 };
+    // Jobs sitting in worker queues, may briefly drop below zero while a job is taken before it was counted.
+    std::atomic<ptrdiff_t> _queuedJobs = { 0 };
+    // Tasks added with AddTask that have not finished yet.
+    std::atomic<size_t> _activeTasks = { 0 };
+    std::atomic<size_t> _nextQueue = { 0 };
+    std::vector<std::unique_ptr<WorkerQueue>> _queues;
     std::vector<std::thread> _threads;
-    std::deque<TaskData> _pending;
-    std::deque<TaskData> _completed;
+    std::deque<std::unique_ptr<TaskData>> _completed;
     std::condition_variable _condPending;
     std::condition_variable _condComplete;
     std::mutex _mutex;
@@ -46,7 +82,36 @@ public:
     void AddTask(std::function<void()> workFn, std::function<void()> completionFn = nullptr);
     void Join(std::function<void()> reportFn = nullptr);
     size_t CountPending();
+    size_t CountThreads() const;
+
+    /**
+     * Calls fn(rangeBegin, rangeEnd) for consecutive slices of [begin, end) with at most grain items each, spread over
+     * the workers and the calling thread. Returns once every slice has been processed, tasks added with AddTask are not
+     * waited for. fn is called concurrently and is not copied.
+     */
+    template<typename TFn> void ParallelFor(size_t begin, size_t end, size_t grain, TFn&& fn)
+    {
+        using FnType = std::remove_reference_t<TFn>;
+
+        RangeData range;
+        range.Next = begin;
+        range.End = end;
+        range.Grain = std::max<size_t>(grain, 1);
+        range.Invoke = [](void* rangeFn, size_t rangeBegin, size_t rangeEnd) {
+            (*static_cast<FnType*>(rangeFn))(rangeBegin, rangeEnd);
+        };
+        range.Fn = const_cast<void*>(static_cast<const void*>(std::addressof(fn)));
+        RunRange(range);
+    }
 
 private:
-    void ProcessQueue();
+    void Push(Job job);
+    bool TryPop(size_t queueIndex, Job& job);
+    bool TrySteal(size_t queueIndex, Job& job);
+    void ProcessQueue(size_t queueIndex);
+    void RunRange(RangeData& range);
+
+    static void RunTask(JobPool& pool, void* context);
+    static void RunRangeHelper(JobPool& pool, void* context);
+    static void ProcessRange(RangeData& range);
 };
@@ -0,0 +1,114 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "MemoryMappedFile.h"
+
+#include "IStream.hpp"
+#include "String.hpp"
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace OpenRCT2
+{
+#ifdef _WIN32
+    MemoryMappedFile::MemoryMappedFile(const std::string& path)
+    {
+        auto pathW = String::ToWideChar(path);
+        auto file = CreateFileW(
+            pathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw IOException(String::StdFormat("Unable to open '%s'", path.c_str()));
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+        {
+            CloseHandle(file);
+            throw IOException(String::StdFormat("Unable to map '%s'", path.c_str()));
+        }
+
+        auto mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        auto data = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0) : nullptr;
+        if (data == nullptr)
+        {
+            if (mapping != nullptr)
+            {
+                CloseHandle(mapping);
+            }
+            CloseHandle(file);
+            throw IOException(String::StdFormat("Unable to map '%s'", path.c_str()));
+        }
+
+        _fileHandle = file;
+        _mappingHandle = mapping;
+        _data = static_cast<uint8_t*>(data);
+        _length = static_cast<uint64_t>(fileSize.QuadPart);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        UnmapViewOfFile(_data);
+        CloseHandle(_mappingHandle);
+        CloseHandle(_fileHandle);
+    }
+#else
+    MemoryMappedFile::MemoryMappedFile(const std::string& path)
+    {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            throw IOException(String::StdFormat("Unable to open '%s'", path.c_str()));
+        }
+
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode) || fileStat.st_size == 0)
+        {
+            close(fd);
+            throw IOException(String::StdFormat("Unable to map '%s'", path.c_str()));
+        }
+
+        // The mapping stays valid after the descriptor is closed.
+        auto length = static_cast<size_t>(fileStat.st_size);
+        auto data = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED)
+        {
+            throw IOException(String::StdFormat("Unable to map '%s'", path.c_str()));
+        }
+
+        _data = static_cast<uint8_t*>(data);
+        _length = length;
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        munmap(_data, static_cast<size_t>(_length));
+    }
+#endif
+
+    std::unique_ptr<MemoryMappedFile> MemoryMappedFile::TryOpen(const std::string& path)
+    {
+        try
+        {
+            return std::make_unique<MemoryMappedFile>(path);
+        }
+        catch (const IOException&)
+        {
+            return nullptr;
+        }
+    }
+} // namespace OpenRCT2
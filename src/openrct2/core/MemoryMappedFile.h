@@ -0,0 +1,53 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <memory>
+#include <string>
+
+namespace OpenRCT2
+{
+    /**
+     * A read-only file mapped into memory, pages are only loaded by the OS once they are accessed.
+     * The mapping is copy-on-write, writing to the data never modifies the file.
+     */
+    class MemoryMappedFile final
+    {
+    private:
+        uint8_t* _data = nullptr;
+        uint64_t _length = 0;
+#ifdef _WIN32
+        void* _fileHandle = nullptr;
+        void* _mappingHandle = nullptr;
+#endif
+
+    public:
+        explicit MemoryMappedFile(const std::string& path);
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        ~MemoryMappedFile();
+
+        // Returns nullptr instead of throwing when the file can not be mapped, e.g. because it is empty or not a
+        // regular file, so the caller can read it the regular way.
+        static std::unique_ptr<MemoryMappedFile> TryOpen(const std::string& path);
+
+        uint8_t* GetData() const
+        {
+            return _data;
+        }
+
+        uint64_t GetLength() const
+        {
+            return _length;
+        }
+    };
+} // namespace OpenRCT2
@@ -122,6 +122,11 @@ namespace OpenRCT2
         return _data;
     }
 
+    size_t MemoryStream::GetCapacity() const
+    {
+        return (_access & MEMORY_ACCESS::OWNER) ? _dataCapacity : 0;
+    }
+
     bool MemoryStream::CanRead() const
     {
         return (_access & MEMORY_ACCESS::READ) != 0;
@@ -268,6 +273,17 @@ namespace OpenRCT2
         SetPosition(0);
     }
 
+    void MemoryStream::Reserve(size_t capacity)
+    {
+        if (!(_access & MEMORY_ACCESS::OWNER) || _dataCapacity >= capacity)
+            return;
+
+        uint64_t position = GetPosition();
+        _dataCapacity = capacity;
+        _data = Memory::Reallocate(_data, _dataCapacity);
+        _position = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(_data) + static_cast<uintptr_t>(position));
+    }
+
     void MemoryStream::EnsureCapacity(size_t capacity)
     {
         if (_dataCapacity < capacity)
@@ -50,6 +50,8 @@ namespace OpenRCT2
         const void* GetData() const override;
         void* GetDataCopy() const;
         void* TakeData();
+        // Bytes allocated for the buffer, zero when the stream does not own it.
+        size_t GetCapacity() const;
 
         ///////////////////////////////////////////////////////////////////////////
         // ISteam methods
@@ -111,7 +113,10 @@ namespace OpenRCT2
 
         uint64_t TryRead(void* buffer, uint64_t length) override;
 
+        // Empties the stream but keeps its buffer, so a stream that is reused does not allocate again.
         void Clear();
+        // Grows the buffer to at least the given size in one step, when the final size is known up front.
+        void Reserve(size_t capacity);
 
     private:
         void EnsureCapacity(size_t capacity);
@@ -10,14 +10,17 @@
 #pragma once
 
 #include "../world/Location.hpp"
-#include "Crypt.h"
+#include "FNV1aLanes.hpp"
 #include "FileStream.h"
 #include "Identifier.hpp"
+#include "JobPool.h"
 #include "MemoryStream.h"
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <stack>
@@ -37,6 +40,17 @@ namespace OpenRCT2
 
         static constexpr uint32_t COMPRESSION_NONE = 0;
         static constexpr uint32_t COMPRESSION_GZIP = 1;
+        // Each chunk is compressed separately, followed by a table of the compressed chunk sizes.
+        static constexpr uint32_t COMPRESSION_GZIP_CHUNKED = 2;
+
+        // Algorithm of the checksum in the header, older files always used FNV1a.
+        static constexpr uint8_t CHECKSUM_FNV1A = 0;
+        static constexpr uint8_t CHECKSUM_FNV1A_LANES = 1;
+
+        // Stored in the header, 0 means the zlib default level was used.
+        static constexpr uint8_t COMPRESSION_LEVEL_DEFAULT = 0;
+        static constexpr uint8_t COMPRESSION_LEVEL_FASTEST = 1;
+        static constexpr uint8_t COMPRESSION_LEVEL_SMALLEST = 9;
 
     private:
 #pragma pack(push, 1)
@@ -49,8 +63,10 @@ namespace OpenRCT2
             uint64_t UncompressedSize{};
             uint32_t Compression{};
             uint64_t CompressedSize{};
-            std::array<uint8_t, 8> FNV1a{};
-            uint8_t padding[20];
+            std::array<uint8_t, 8> Checksum{};
+            uint8_t CompressionLevel{};
+            uint8_t ChecksumAlgorithm{};
+            uint8_t padding[18];
         };
         static_assert(sizeof(Header) == 64, "Header should be 64 bytes");
 
@@ -69,8 +85,16 @@ namespace OpenRCT2
         MemoryStream _buffer;
         ChunkEntry _currentChunk;
 
+        // For COMPRESSION_GZIP_CHUNKED, the chunks that have not been decompressed into _uncompressedData yet.
+        std::vector<std::vector<uint8_t>> _compressedChunks;
+        std::vector<uint8_t> _uncompressedData;
+
     public:
-        OrcaStream(IStream& stream, const Mode mode)
+        /**
+         * @param chunkIds When reading, only these chunks are read if the chunks are compressed separately. All chunks
+         * are read if empty.
+         */
+        OrcaStream(IStream& stream, const Mode mode, const std::vector<uint32_t>& chunkIds = {})
         {
             _stream = &stream;
             _mode = mode;
@@ -85,6 +109,12 @@ namespace OpenRCT2
                     _chunks.push_back(entry);
                 }
 
+                if (_header.Compression == COMPRESSION_GZIP_CHUNKED)
+                {
+                    ReadCompressedChunks(chunkIds);
+                    return;
+                }
+
                 // Read compressed data into buffer (read in blocks)
                 _buffer = MemoryStream{};
                 uint8_t temp[2048];
@@ -130,40 +160,66 @@ namespace OpenRCT2
                 _header.NumChunks = static_cast<uint32_t>(_chunks.size());
                 _header.UncompressedSize = uncompressedSize;
                 _header.CompressedSize = uncompressedSize;
-                _header.FNV1a = Crypt::FNV1a(uncompressedData, uncompressedSize);
+                Crypt::FNV1aLanes checksum;
+                checksum.Update(uncompressedData, static_cast<size_t>(uncompressedSize));
+                const auto hash = checksum.Finish();
+                std::memcpy(_header.Checksum.data(), &hash, sizeof(hash));
+                _header.ChecksumAlgorithm = CHECKSUM_FNV1A_LANES;
 
-                // Compress data
-                std::optional<std::vector<uint8_t>> compressedBytes;
-                if (_header.Compression == COMPRESSION_GZIP)
+                Write(*_stream, _header, _chunks, uncompressedData);
+            }
+        }
+
+        /**
+         * Writes a stream that was written with COMPRESSION_NONE to output with the given compression applied. This
+         * allows the compression to be done separately from the serialisation, e.g. on a worker thread. The minimum
+         * version of the header is raised to minVersion, for compressions older readers do not understand.
+         */
+        static void Compress(
+            const void* data, uint64_t length, uint32_t compression, IStream& output, uint32_t minVersion = 0)
+        {
+            MemoryStream input(data, static_cast<size_t>(length));
+            auto header = input.ReadValue<Header>();
+            if (header.Compression != COMPRESSION_NONE)
+            {
+                throw std::runtime_error("Stream is already compressed.");
+            }
+
+            std::vector<ChunkEntry> chunks;
+            for (uint32_t i = 0; i < header.NumChunks; i++)
+            {
+                chunks.push_back(input.ReadValue<ChunkEntry>());
+            }
+
+            header.Compression = compression;
+            header.MinVersion = std::max(header.MinVersion, minVersion);
+            Write(output, header, chunks, static_cast<const uint8_t*>(data) + input.GetPosition());
+        }
+
+        /**
+         * Decompresses all chunks that have not been read yet, spread over multiple threads. Only does something
+         * for COMPRESSION_GZIP_CHUNKED, otherwise the whole stream is decompressed up front.
+         */
+        void DecompressAllChunks()
+        {
+            std::atomic<bool> failed = false;
+            JobPool pool;
+            pool.ParallelFor(0, _chunks.size(), 1, [this, &failed](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++)
                 {
-                    compressedBytes = Gzip(uncompressedData, uncompressedSize);
-                    if (compressedBytes)
+                    try
                     {
-                        _header.CompressedSize = compressedBytes->size();
+                        DecompressChunk(i);
                     }
-                    else
+                    catch (const std::exception&)
                     {
-                        // Compression failed
-                        _header.Compression = COMPRESSION_NONE;
+                        failed = true;
                     }
                 }
-
-                // Write header and chunk table
-                _stream->WriteValue(_header);
-                for (const auto& chunk : _chunks)
-                {
-                    _stream->WriteValue(chunk);
-                }
-
-                // Write chunk data
-                if (compressedBytes)
-                {
-                    _stream->Write(compressedBytes->data(), compressedBytes->size());
-                }
-                else
-                {
-                    _stream->Write(uncompressedData, uncompressedSize);
-                }
+            });
+            if (failed)
+            {
+                throw std::runtime_error("Unable to decompress chunk.");
             }
         }
 
@@ -212,6 +268,7 @@ namespace OpenRCT2
             const auto result = std::find_if(_chunks.begin(), _chunks.end(), [id](const ChunkEntry& e) { return e.Id == id; });
             if (result != _chunks.end())
             {
+                DecompressChunk(static_cast<size_t>(result - _chunks.begin()));
                 const auto offset = result->Offset;
                 _buffer.SetPosition(offset);
                 return true;
@@ -219,6 +276,148 @@ namespace OpenRCT2
             return false;
         }
 
+        void ReadCompressedChunks(const std::vector<uint32_t>& chunkIds)
+        {
+            std::vector<uint64_t> compressedSizes;
+            for (uint32_t i = 0; i < _header.NumChunks; i++)
+            {
+                compressedSizes.push_back(_stream->ReadValue<uint64_t>());
+            }
+
+            // Chunks that are not requested are skipped without reading them. The remaining chunks are packed together
+            // so the buffer only needs to be as large as the chunks that are read.
+            std::vector<ChunkEntry> chunks;
+            uint64_t uncompressedSize = 0;
+            for (size_t i = 0; i < _chunks.size(); i++)
+            {
+                const auto& chunk = _chunks[i];
+                if (chunk.Offset + chunk.Length > _header.UncompressedSize)
+                {
+                    throw std::runtime_error("Chunk is outside of the stream.");
+                }
+                if (!chunkIds.empty() && std::find(chunkIds.begin(), chunkIds.end(), chunk.Id) == chunkIds.end())
+                {
+                    _stream->Seek(static_cast<int64_t>(compressedSizes[i]), STREAM_SEEK_CURRENT);
+                    continue;
+                }
+
+                auto& compressed = _compressedChunks.emplace_back(compressedSizes[i]);
+                _stream->Read(compressed.data(), compressed.size());
+                chunks.push_back({ chunk.Id, uncompressedSize, chunk.Length });
+                uncompressedSize += chunk.Length;
+            }
+            _chunks = std::move(chunks);
+
+            _uncompressedData.resize(uncompressedSize);
+            _buffer = MemoryStream(_uncompressedData.data(), _uncompressedData.size(), MEMORY_ACCESS::READ);
+        }
+
+        // Can be called concurrently for different chunks.
+        void DecompressChunk(size_t index)
+        {
+            if (index >= _compressedChunks.size() || _compressedChunks[index].empty())
+            {
+                return;
+            }
+
+            const auto& chunk = _chunks[index];
+            auto& compressed = _compressedChunks[index];
+            auto data = Ungzip(compressed.data(), compressed.size());
+            if (data.size() != chunk.Length)
+            {
+                throw std::runtime_error("Chunk has an unexpected size.");
+            }
+            std::copy(data.begin(), data.end(), _uncompressedData.begin() + chunk.Offset);
+            compressed = {};
+        }
+
+        static void Write(IStream& output, Header header, const std::vector<ChunkEntry>& chunks, const void* data)
+        {
+            const int32_t level = header.CompressionLevel == COMPRESSION_LEVEL_DEFAULT ? -1 : header.CompressionLevel;
+            header.CompressedSize = header.UncompressedSize;
+
+            // Compress data
+            std::optional<std::vector<uint8_t>> compressedBytes;
+            std::vector<std::vector<uint8_t>> compressedChunks;
+            if (header.Compression == COMPRESSION_GZIP)
+            {
+                compressedBytes = Gzip(data, header.UncompressedSize, level);
+                if (compressedBytes)
+                {
+                    header.CompressedSize = compressedBytes->size();
+                }
+                else
+                {
+                    // Compression failed
+                    header.Compression = COMPRESSION_NONE;
+                }
+            }
+            else if (header.Compression == COMPRESSION_GZIP_CHUNKED)
+            {
+                // Every chunk is compressed on its own so readers can decompress them in parallel, or just the ones
+                // they need.
+                compressedChunks.resize(chunks.size());
+                std::atomic<bool> failed = false;
+                JobPool pool;
+                pool.ParallelFor(0, chunks.size(), 1, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        if (chunks[i].Length == 0)
+                        {
+                            continue;
+                        }
+                        try
+                        {
+                            const auto* chunkData = static_cast<const uint8_t*>(data) + chunks[i].Offset;
+                            compressedChunks[i] = Gzip(chunkData, static_cast<size_t>(chunks[i].Length), level);
+                        }
+                        catch (const std::exception&)
+                        {
+                            failed = true;
+                        }
+                    }
+                });
+                if (failed)
+                {
+                    throw std::runtime_error("Unable to compress chunk.");
+                }
+
+                header.CompressedSize = chunks.size() * sizeof(uint64_t);
+                for (const auto& compressedChunk : compressedChunks)
+                {
+                    header.CompressedSize += compressedChunk.size();
+                }
+            }
+
+            // Write header and chunk table
+            output.WriteValue(header);
+            for (const auto& chunk : chunks)
+            {
+                output.WriteValue(chunk);
+            }
+
+            // Write chunk data
+            if (header.Compression == COMPRESSION_GZIP_CHUNKED)
+            {
+                for (const auto& compressedChunk : compressedChunks)
+                {
+                    output.WriteValue<uint64_t>(compressedChunk.size());
+                }
+                for (const auto& compressedChunk : compressedChunks)
+                {
+                    output.Write(compressedChunk.data(), compressedChunk.size());
+                }
+            }
+            else if (compressedBytes)
+            {
+                output.Write(compressedBytes->data(), compressedBytes->size());
+            }
+            else
+            {
+                output.Write(data, header.UncompressedSize);
+            }
+        }
+
     public:
         class ChunkStream
         {
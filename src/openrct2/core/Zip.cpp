@@ -12,6 +12,7 @@
 #include "IStream.hpp"
 
 #include <algorithm>
+#include <unordered_map>
 #ifndef __ANDROID__
 #    include <zip.h>
 #endif
@@ -73,6 +74,8 @@ private:
     zip_t* _zip;
     ZIP_ACCESS _access;
     std::vector<std::vector<uint8_t>> _writeBuffers;
+    // Normalised path of each file to its index, only kept when reading as writing can change the files
+    std::unordered_map<std::string, size_t> _pathIndices;
 
 public:
     ZipArchive(std::string_view path, ZIP_ACCESS access)
@@ -91,6 +94,16 @@ public:
         }
 
         _access = access;
+        if (_access == ZIP_ACCESS::READ)
+        {
+            auto numFiles = GetNumFiles();
+            _pathIndices.reserve(numFiles);
+            for (size_t i = 0; i < numFiles; i++)
+            {
+                // The first file with a path wins, the same as searching the files in order
+                _pathIndices.emplace(NormalisePath(GetFileName(i)), i);
+            }
+        }
     }
 
     ~ZipArchive() override
@@ -125,6 +138,21 @@ public:
         return 0;
     }
 
+    std::optional<size_t> GetIndexFromPath(std::string_view path) const override
+    {
+        if (_access != ZIP_ACCESS::READ)
+        {
+            return IZipArchive::GetIndexFromPath(path);
+        }
+
+        auto it = _pathIndices.find(NormalisePath(path));
+        if (path.empty() || it == _pathIndices.end())
+        {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
     std::vector<uint8_t> GetFileData(std::string_view path) const override
     {
         std::vector<uint8_t> result;
@@ -10,6 +10,7 @@
 #include "../common.h"
 #include "../core/Guard.hpp"
 #include "Drawing.h"
+#include "LightFX.h"
 
 #ifdef __AVX2__
 
@@ -42,6 +43,98 @@ void MaskAvx2(
     }
 }
 
+template<bool TRemapDst>
+static void RleRemapAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    const __m256i zero = {};
+    int32_t i = 0;
+    for (; i + 32 <= numPixels; i += 32)
+    {
+        // There is no byte gather, the lookups are done one by one but the transparency checks are not
+        alignas(32) uint8_t remapped[32];
+        for (int32_t j = 0; j < 32; j++)
+        {
+            remapped[j] = map[TRemapDst ? dst[i + j] : src[i + j]];
+        }
+
+        const __m256i source = _mm256_lddqu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i dest = _mm256_lddqu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        const __m256i pixels = _mm256_load_si256(reinterpret_cast<const __m256i*>(remapped));
+        const __m256i transparent = _mm256_or_si256(_mm256_cmpeq_epi8(source, zero), _mm256_cmpeq_epi8(pixels, zero));
+        const __m256i blended = _mm256_blendv_epi8(pixels, dest, transparent);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), blended);
+    }
+
+    if constexpr (TRemapDst)
+    {
+        RleRemapDstScalar(src + i, dst + i, map, numPixels - i);
+    }
+    else
+    {
+        RleRemapSrcScalar(src + i, dst + i, map, numPixels - i);
+    }
+}
+
+void RleRemapSrcAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    RleRemapAvx2<false>(src, dst, map, numPixels);
+}
+
+void RleRemapDstAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    RleRemapAvx2<true>(src, dst, map, numPixels);
+}
+
+void LightBlendAvx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity)
+{
+    const __m256i zero256 = {};
+    const __m256i scale = _mm256_set1_epi16(static_cast<int16_t>(1 + intensity));
+    for (int32_t y = 0; y < height; y++)
+    {
+        int32_t x = 0;
+        for (; x + 32 <= width; x += 32)
+        {
+            __m256i light = _mm256_lddqu_si256(reinterpret_cast<const __m256i*>(src + x));
+            if (intensity != 0xFF)
+            {
+                // Unpacking and packing both work per 128-bit lane, so the byte order is preserved
+                const __m256i lo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(light, zero256), scale), 8);
+                const __m256i hi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(light, zero256), scale), 8);
+                light = _mm256_packus_epi16(lo, hi);
+            }
+            const __m256i dest = _mm256_lddqu_si256(reinterpret_cast<const __m256i*>(dst + x));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x), _mm256_adds_epu8(dest, light));
+        }
+        LightBlendScalar(width - x, 1, src + x, dst + x, 0, 0, intensity);
+
+        src += width + srcWrap;
+        dst += width + dstWrap;
+    }
+}
+
+void PaletteExpandAvx2(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* RESTRICT palette, int32_t numPixels)
+{
+    const auto* table = reinterpret_cast<const int*>(palette);
+    int32_t i = 0;
+    for (; i + 32 <= numPixels; i += 32)
+    {
+        const __m256i indices = _mm256_lddqu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m128i lo = _mm256_castsi256_si128(indices);
+        const __m128i hi = _mm256_extracti128_si256(indices, 1);
+        const __m256i c0 = _mm256_i32gather_epi32(table, _mm256_cvtepu8_epi32(lo), 4);
+        const __m256i c1 = _mm256_i32gather_epi32(table, _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)), 4);
+        const __m256i c2 = _mm256_i32gather_epi32(table, _mm256_cvtepu8_epi32(hi), 4);
+        const __m256i c3 = _mm256_i32gather_epi32(table, _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)), 4);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), c0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 8), c1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 16), c2);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 24), c3);
+    }
+    PaletteExpandScalar(src + i, dst + i, palette, numPixels - i);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -55,4 +148,26 @@ void MaskAvx2(
     Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void RleRemapSrcAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void RleRemapDstAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void LightBlendAvx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity)
+{
+    Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void PaletteExpandAvx2(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* RESTRICT palette, int32_t numPixels)
+{
+    Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
 #endif // __AVX2__
@@ -12,6 +12,29 @@
 #include <algorithm>
 #include <cstring>
 
+template<bool TRemapDst>
+static void RleRemapScalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    for (int32_t i = 0; i < numPixels; i++)
+    {
+        const auto pixel = map[TRemapDst ? dst[i] : src[i]];
+        if (src[i] != 0 && pixel != 0)
+        {
+            dst[i] = pixel;
+        }
+    }
+}
+
+void RleRemapSrcScalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    RleRemapScalar<false>(src, dst, map, numPixels);
+}
+
+void RleRemapDstScalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    RleRemapScalar<true>(src, dst, map, numPixels);
+}
+
 template<DrawBlendOp TBlendOp, size_t TZoom>
 static void FASTCALL DrawRLESpriteMagnify(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
 {
@@ -94,6 +117,16 @@ static void FASTCALL DrawRLESpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArg
     auto height = args.Height;
     auto zoom = 1 << TZoom;
     auto dstLineWidth = (static_cast<size_t>(dpi.width) >> TZoom) + dpi.pitch;
+    auto& paletteMap = args.PalMap;
+
+    // Spans that only remap either the source or the destination can use the vectorised remap functions
+    constexpr bool kRemapSrc = (TBlendOp & BLEND_SRC) != 0 && (TBlendOp & BLEND_DST) == 0;
+    constexpr bool kRemapDst = (TBlendOp & BLEND_SRC) == 0 && (TBlendOp & BLEND_DST) != 0;
+    const uint8_t* remapTable = nullptr;
+    if constexpr (TZoom == 0 && (kRemapSrc || kRemapDst))
+    {
+        remapTable = paletteMap.GetLookupTable();
+    }
 
     // Move up to the first line of the image if source_y_start is negative. Why does this even occur?
     if (srcY < 0)
@@ -163,9 +196,22 @@ static void FASTCALL DrawRLESpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArg
                     std::memcpy(dst, src, numPixels);
                 }
             }
+            else if (remapTable != nullptr)
+            {
+                if (numPixels > 0)
+                {
+                    if constexpr (kRemapSrc)
+                    {
+                        RleRemapSrcFn(src, dst, remapTable, numPixels);
+                    }
+                    else
+                    {
+                        RleRemapDstFn(src, dst, remapTable, numPixels);
+                    }
+                }
+            }
             else
             {
-                auto& paletteMap = args.PalMap;
                 while (numPixels > 0)
                 {
                     BlitPixel<TBlendOp>(src, dst, paletteMap);
@@ -14,6 +14,7 @@
 #include "../PlatformEnvironment.h"
 #include "../config/Config.h"
 #include "../core/FileStream.h"
+#include "../core/MemoryMappedFile.h"
 #include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../platform/Platform.h"
@@ -156,6 +157,39 @@ static void ReadAndConvertGxDat(IStream* stream, size_t count, bool is_rctc, G1E
     }
 }
 
+/**
+ * Returns the element data that follows the element headers in the stream. The file is mapped into memory if possible
+ * so the sprite data is only paged in by the OS once it is drawn, rather than reading all of it up front.
+ */
+static uint8_t* GxLoadData(Gx& gx, const std::string& path, IStream& stream)
+{
+    try
+    {
+        auto file = std::make_shared<MemoryMappedFile>(path);
+        auto position = stream.GetPosition();
+        if (position + gx.header.total_size <= file->GetLength())
+        {
+            gx.mapping = std::move(file);
+            return gx.mapping->GetData() + position;
+        }
+    }
+    catch (const IOException& e)
+    {
+        LOG_VERBOSE("Falling back to reading the data: %s", e.what());
+    }
+
+    gx.data = stream.ReadArray<uint8_t>(gx.header.total_size);
+    return gx.data.get();
+}
+
+static void GxUnload(Gx& gx)
+{
+    gx.data.reset();
+    gx.mapping.reset();
+    gx.elements.clear();
+    gx.elements.shrink_to_fit();
+}
+
 void MaskScalar(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap)
@@ -190,6 +224,27 @@ static G1Element _g1Temp = {};
 static std::vector<G1Element> _imageListElements;
 bool gTinyFontAntiAliased = false;
 
+// Mapped element data is counted as well, although those pages can be shared with other processes.
+static size_t GxGetMemoryUsage(const Gx& gx)
+{
+    size_t bytes = gx.elements.capacity() * sizeof(G1Element);
+    if (gx.data != nullptr || gx.mapping != nullptr)
+    {
+        bytes += gx.header.total_size;
+    }
+    return bytes;
+}
+
+size_t GfxGetG1MemoryUsage()
+{
+    return GxGetMemoryUsage(_g1) + GxGetMemoryUsage(_g2) + GxGetMemoryUsage(_csg) + sizeof(_scrollingText);
+}
+
+size_t GfxGetImageListMemoryUsage()
+{
+    return _imageListElements.capacity() * sizeof(G1Element);
+}
+
 /**
  *
  *  rct2: 0x00678998
@@ -217,19 +272,18 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
         gTinyFontAntiAliased = is_rctc;
 
         // Read element data
-        _g1.data = fs.ReadArray<uint8_t>(_g1.header.total_size);
+        auto* data = GxLoadData(_g1, path, fs);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _g1.header.num_entries; i++)
         {
-            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(_g1.data.get());
+            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(data);
         }
         return true;
     }
     catch (const std::exception&)
     {
-        _g1.elements.clear();
-        _g1.elements.shrink_to_fit();
+        GxUnload(_g1);
 
         LOG_FATAL("Unable to load g1 graphics");
         if (!gOpenRCT2Headless)
@@ -243,23 +297,17 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
 
 void GfxUnloadG1()
 {
-    _g1.data.reset();
-    _g1.elements.clear();
-    _g1.elements.shrink_to_fit();
+    GxUnload(_g1);
 }
 
 void GfxUnloadG2()
 {
-    _g2.data.reset();
-    _g2.elements.clear();
-    _g2.elements.shrink_to_fit();
+    GxUnload(_g2);
 }
 
 void GfxUnloadCsg()
 {
-    _csg.data.reset();
-    _csg.elements.clear();
-    _csg.elements.shrink_to_fit();
+    GxUnload(_csg);
 }
 
 bool GfxLoadG2()
@@ -280,7 +328,7 @@ bool GfxLoadG2()
         ReadAndConvertGxDat(&fs, _g2.header.num_entries, false, _g2.elements.data());
 
         // Read element data
-        _g2.data = fs.ReadArray<uint8_t>(_g2.header.total_size);
+        auto* data = GxLoadData(_g2, path, fs);
 
         if (_g2.header.num_entries != G2_SPRITE_COUNT)
         {
@@ -301,14 +349,13 @@ bool GfxLoadG2()
         // Fix entry data offsets
         for (uint32_t i = 0; i < _g2.header.num_entries; i++)
         {
-            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(_g2.data.get());
+            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(data);
         }
         return true;
     }
     catch (const std::exception&)
     {
-        _g2.elements.clear();
-        _g2.elements.shrink_to_fit();
+        GxUnload(_g2);
 
         LOG_FATAL("Unable to load g2 graphics");
         if (!gOpenRCT2Headless)
@@ -353,12 +400,12 @@ bool GfxLoadCsg()
         ReadAndConvertGxDat(&fileHeader, _csg.header.num_entries, false, _csg.elements.data());
 
         // Read element data
-        _csg.data = fileData.ReadArray<uint8_t>(_csg.header.total_size);
+        auto* data = GxLoadData(_csg, pathDataPath, fileData);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _csg.header.num_entries; i++)
         {
-            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(_csg.data.get());
+            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(data);
             // RCT1 used zoomed offsets that counted from the beginning of the file, rather than from the current sprite.
             if (_csg.elements[i].flags & G1_FLAG_HAS_ZOOM_SPRITE)
             {
@@ -370,8 +417,7 @@ bool GfxLoadCsg()
     }
     catch (const std::exception&)
     {
-        _csg.elements.clear();
-        _csg.elements.shrink_to_fit();
+        GxUnload(_csg);
 
         LOG_ERROR("Unable to load csg graphics");
         return false;
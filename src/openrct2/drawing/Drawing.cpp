@@ -15,9 +15,11 @@
 #include "../common.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../interface/Viewport.h"
 #include "../object/Object.h"
 #include "../object/ObjectEntryManager.h"
 #include "../object/WaterEntry.h"
+#include "../paint/Paint.TileCache.h"
 #include "../platform/Platform.h"
 #include "../sprites.h"
 #include "../util/Util.h"
@@ -81,6 +83,11 @@ uint8_t PaletteMap::Blend(uint8_t src, uint8_t dst) const
     return (*this)[idx];
 }
 
+const uint8_t* PaletteMap::GetLookupTable() const
+{
+    return _dataLength >= 256 ? _data : nullptr;
+}
+
 void PaletteMap::Copy(size_t dstIndex, const PaletteMap& src, size_t srcIndex, size_t length)
 {
     auto maxLength = std::min(_mapLength - srcIndex, _mapLength - dstIndex);
@@ -737,6 +744,92 @@ void MaskFn(
     MaskFunc(width, height, maskSrc, colourSrc, dst, maskWrap, colourWrap, dstWrap);
 }
 
+static auto GetRleRemapSrcFunction()
+{
+    if (AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 RLE remap function");
+        return RleRemapSrcAvx2;
+    }
+    else if (SSE41Available())
+    {
+        LOG_VERBOSE("registering SSE4.1 RLE remap function");
+        return RleRemapSrcSse4_1;
+    }
+    else if (NEONAvailable())
+    {
+        LOG_VERBOSE("registering NEON RLE remap function");
+        return RleRemapSrcNeon;
+    }
+    else
+    {
+        LOG_VERBOSE("registering scalar RLE remap function");
+        return RleRemapSrcScalar;
+    }
+}
+
+static auto GetRleRemapDstFunction()
+{
+    if (AVX2Available())
+    {
+        return RleRemapDstAvx2;
+    }
+    else if (SSE41Available())
+    {
+        return RleRemapDstSse4_1;
+    }
+    else if (NEONAvailable())
+    {
+        return RleRemapDstNeon;
+    }
+    else
+    {
+        return RleRemapDstScalar;
+    }
+}
+
+static const auto RleRemapSrcFunc = GetRleRemapSrcFunction();
+static const auto RleRemapDstFunc = GetRleRemapDstFunction();
+
+void RleRemapSrcFn(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    RleRemapSrcFunc(src, dst, map, numPixels);
+}
+
+void RleRemapDstFn(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    RleRemapDstFunc(src, dst, map, numPixels);
+}
+
+void PaletteExpandScalar(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* RESTRICT palette, int32_t numPixels)
+{
+    for (int32_t i = 0; i < numPixels; i++)
+    {
+        dst[i] = palette[src[i]];
+    }
+}
+
+static auto GetPaletteExpandFunction()
+{
+    if (AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 palette expand function");
+        return PaletteExpandAvx2;
+    }
+    else
+    {
+        LOG_VERBOSE("registering scalar palette expand function");
+        return PaletteExpandScalar;
+    }
+}
+
+static const auto PaletteExpandFunc = GetPaletteExpandFunction();
+
+void PaletteExpandFn(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* RESTRICT palette, int32_t numPixels)
+{
+    PaletteExpandFunc(src, dst, palette, numPixels);
+}
+
 void GfxFilterPixel(DrawPixelInfo& dpi, const ScreenCoordsXY& coords, FilterPaletteID palette)
 {
     GfxFilterRect(dpi, { coords, coords }, palette);
@@ -817,6 +910,8 @@ void LoadPalette()
  */
 void GfxInvalidateScreen()
 {
+    PaintTileCacheInvalidate();
+    ViewportFarZoomCacheInvalidate();
     GfxSetDirtyBlocks({ { 0, 0 }, { ContextGetWidth(), ContextGetHeight() } });
 }
 
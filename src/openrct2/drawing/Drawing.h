@@ -29,6 +29,7 @@ namespace OpenRCT2
 {
     struct IPlatformEnvironment;
     struct IStream;
+    class MemoryMappedFile;
 } // namespace OpenRCT2
 
 namespace OpenRCT2::Drawing
@@ -102,6 +103,8 @@ struct Gx
     RCTG1Header header;
     std::vector<G1Element> elements;
     std::unique_ptr<uint8_t[]> data;
+    // Set instead of data when the element data is used straight from the mapped file.
+    std::shared_ptr<OpenRCT2::MemoryMappedFile> mapping;
 };
 
 struct DrawPixelInfo
@@ -404,6 +407,11 @@ public:
     uint8_t operator[](size_t index) const;
     uint8_t Blend(uint8_t src, uint8_t dst) const;
     void Copy(size_t dstIndex, const PaletteMap& src, size_t srcIndex, size_t length);
+
+    /**
+     * Returns the map as a plain table that can be indexed by any palette index, or nullptr if it is too short for that.
+     */
+    const uint8_t* GetLookupTable() const;
 };
 
 struct DrawSpriteArgs
@@ -565,6 +573,9 @@ const G1Element* GfxGetG1Element(ImageIndex image_id);
 void GfxSetG1Element(ImageIndex imageId, const G1Element* g1);
 std::optional<Gx> GfxLoadGx(const std::vector<uint8_t>& buffer);
 bool IsCsgLoaded();
+// Bytes held by the G1, G2 and CSG element tables and data, and by the element table of the object images.
+size_t GfxGetG1MemoryUsage();
+size_t GfxGetImageListMemoryUsage();
 void FASTCALL GfxSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& args);
 void FASTCALL GfxBmpSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& args);
 void FASTCALL GfxRleSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& args);
@@ -628,6 +639,26 @@ void MaskFn(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+// Remaps a span of RLE sprite pixels, pixels that are transparent in the source or remap to 0 are left untouched.
+// The Src variants remap the source pixels, the Dst variants remap what is already drawn underneath the source pixels.
+void RleRemapSrcScalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels);
+void RleRemapSrcSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels);
+void RleRemapSrcAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels);
+void RleRemapSrcNeon(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels);
+void RleRemapDstScalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels);
+void RleRemapDstSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels);
+void RleRemapDstAvx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels);
+void RleRemapDstNeon(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels);
+
+void RleRemapSrcFn(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels);
+void RleRemapDstFn(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels);
+
+// Expands a span of palette indices into the 32-bit colours the palette maps them to.
+void PaletteExpandScalar(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* RESTRICT palette, int32_t numPixels);
+void PaletteExpandAvx2(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* RESTRICT palette, int32_t numPixels);
+
+void PaletteExpandFn(const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* RESTRICT palette, int32_t numPixels);
+
 std::optional<uint32_t> GetPaletteG1Index(colour_t paletteId);
 std::optional<PaletteMap> GetPaletteMapForColour(colour_t paletteId);
 void UpdatePalette(const uint8_t* colours, int32_t start_index, int32_t num_colours);
@@ -37,6 +37,11 @@ enum DRAWING_ENGINE_FLAGS
      * The drawing engine is capable of processing the drawing in parallel.
      */
     DEF_PARALLEL_DRAWING = 1 << 1,
+
+    /**
+     * The drawing engine draws into the 8-bit pixels of the DrawPixelInfo, which may be written to directly.
+     */
+    DEF_PIXEL_BUFFER = 1 << 2,
 };
 
 struct DrawPixelInfo;
@@ -77,6 +82,11 @@ namespace OpenRCT2::Drawing
         virtual DRAWING_ENGINE_FLAGS GetFlags() abstract;
 
         virtual void InvalidateImage(uint32_t image) abstract;
+
+        /**
+         * Returns the number of bytes held by the engine for its frame buffers and caches.
+         */
+        virtual size_t GetMemoryUsage() abstract;
     };
 
     struct IDrawingEngineFactory
@@ -203,8 +203,9 @@ uint32_t GfxObjectAllocateImages(const G1Element* images, uint32_t count)
     uint32_t imageId = baseImageId;
     for (uint32_t i = 0; i < count; i++)
     {
-        GfxSetG1Element(imageId, &images[i]);
+        // Invalidate first, the drawing engine may still be reading the old element.
         DrawingEngineInvalidateImage(imageId);
+        GfxSetG1Element(imageId, &images[i]);
         imageId++;
     }
 
@@ -221,8 +222,8 @@ void GfxObjectFreeImages(uint32_t baseImageId, uint32_t count)
         {
             uint32_t imageId = baseImageId + i;
             G1Element g1 = {};
-            GfxSetG1Element(imageId, &g1);
             DrawingEngineInvalidateImage(imageId);
+            GfxSetG1Element(imageId, &g1);
         }
 
         FreeImageList(baseImageId, count);
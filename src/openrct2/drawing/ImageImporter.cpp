@@ -10,9 +10,14 @@
 #include "ImageImporter.h"
 
 #include "../core/Imaging.h"
+#include "../core/JobPool.h"
 #include "../core/Json.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <stdexcept>
 #include <string>
 
@@ -20,6 +25,182 @@ namespace OpenRCT2::Drawing
 {
     constexpr int32_t PALETTE_TRANSPARENT = -1;
 
+    /**
+     * Answers the palette searches of the importer without going through the whole palette for every pixel. Both
+     * searches give exactly the same index as the full search, including which index wins when colours are equal.
+     */
+    class ImageImporter::PaletteLookup
+    {
+    private:
+        // Exact matches are bucketed by the top 5 bits of each channel
+        static constexpr int32_t kExactBits = 5;
+        static constexpr int32_t kExactBuckets = 1 << (kExactBits * 3);
+        // Closest matches are searched among the candidates of the cell the colour falls in, 8 cells per channel
+        static constexpr int32_t kCellBits = 3;
+        static constexpr int32_t kCellCount = 1 << (kCellBits * 3);
+        static constexpr int32_t kCellSize = 256 >> kCellBits;
+
+        const GamePalette& _palette;
+        // Indices of bucket or cell n are [offsets[n], offsets[n + 1])
+        std::vector<uint16_t> _exactOffsets;
+        std::vector<uint8_t> _exactIndices;
+        std::vector<uint16_t> _cellOffsets;
+        std::vector<uint8_t> _cellIndices;
+
+        static bool InRange(const int16_t* colour)
+        {
+            return colour[0] >= 0 && colour[0] <= 255 && colour[1] >= 0 && colour[1] <= 255 && colour[2] >= 0
+                && colour[2] <= 255;
+        }
+
+        static int32_t GetBucket(int32_t r, int32_t g, int32_t b, int32_t bits)
+        {
+            auto shift = 8 - bits;
+            return ((r >> shift) << (bits * 2)) | ((g >> shift) << bits) | (b >> shift);
+        }
+
+        static int32_t GetError(const PaletteBGRA& entry, const int16_t* colour)
+        {
+            auto dr = static_cast<int16_t>(entry.Red) - colour[0];
+            auto dg = static_cast<int16_t>(entry.Green) - colour[1];
+            auto db = static_cast<int16_t>(entry.Blue) - colour[2];
+            return dr * dr + dg * dg + db * db;
+        }
+
+        void BuildExactBuckets()
+        {
+            std::vector<std::vector<uint8_t>> buckets(kExactBuckets);
+            for (uint32_t i = 0; i < PALETTE_SIZE; i++)
+            {
+                const auto& entry = _palette[i];
+                buckets[GetBucket(entry.Red, entry.Green, entry.Blue, kExactBits)].push_back(static_cast<uint8_t>(i));
+            }
+            Flatten(buckets, _exactOffsets, _exactIndices);
+        }
+
+        void BuildCells()
+        {
+            std::vector<std::vector<uint8_t>> cells(kCellCount);
+            for (int32_t cell = 0; cell < kCellCount; cell++)
+            {
+                int32_t low[3];
+                int32_t high[3];
+                for (int32_t channel = 0; channel < 3; channel++)
+                {
+                    low[channel] = ((cell >> (kCellBits * (2 - channel))) & ((1 << kCellBits) - 1)) * kCellSize;
+                    high[channel] = low[channel] + kCellSize - 1;
+                }
+
+                // An entry can only be closest to a colour in the cell if its nearest point of the cell is no further
+                // away than the furthest point of the cell is from the entry that is best in the worst case.
+                std::array<int32_t, PALETTE_SIZE> minErrors{};
+                int32_t bound = std::numeric_limits<int32_t>::max();
+                for (uint32_t i = 0; i < PALETTE_SIZE; i++)
+                {
+                    if (!IsChangablePixel(i))
+                        continue;
+
+                    const auto& entry = _palette[i];
+                    const int32_t values[3] = { entry.Red, entry.Green, entry.Blue };
+                    int32_t minError = 0;
+                    int32_t maxError = 0;
+                    for (int32_t channel = 0; channel < 3; channel++)
+                    {
+                        auto value = values[channel];
+                        auto nearest = std::clamp(value, low[channel], high[channel]) - value;
+                        auto furthest = std::max(std::abs(value - low[channel]), std::abs(value - high[channel]));
+                        minError += nearest * nearest;
+                        maxError += furthest * furthest;
+                    }
+                    minErrors[i] = minError;
+                    bound = std::min(bound, maxError);
+                }
+                for (uint32_t i = 0; i < PALETTE_SIZE; i++)
+                {
+                    if (IsChangablePixel(i) && minErrors[i] <= bound)
+                    {
+                        cells[cell].push_back(static_cast<uint8_t>(i));
+                    }
+                }
+            }
+            Flatten(cells, _cellOffsets, _cellIndices);
+        }
+
+        static void Flatten(
+            const std::vector<std::vector<uint8_t>>& lists, std::vector<uint16_t>& offsets, std::vector<uint8_t>& indices)
+        {
+            offsets.reserve(lists.size() + 1);
+            for (const auto& list : lists)
+            {
+                offsets.push_back(static_cast<uint16_t>(indices.size()));
+                indices.insert(indices.end(), list.begin(), list.end());
+            }
+            offsets.push_back(static_cast<uint16_t>(indices.size()));
+        }
+
+    public:
+        explicit PaletteLookup(const GamePalette& palette)
+            : _palette(palette)
+        {
+            BuildExactBuckets();
+            BuildCells();
+        }
+
+        int32_t GetIndex(const int16_t* colour) const
+        {
+            if (IsTransparentPixel(colour) || !InRange(colour))
+                return PALETTE_TRANSPARENT;
+
+            auto bucket = GetBucket(colour[0], colour[1], colour[2], kExactBits);
+            for (auto i = _exactOffsets[bucket]; i < _exactOffsets[bucket + 1]; i++)
+            {
+                auto index = _exactIndices[i];
+                const auto& entry = _palette[index];
+                if (entry.Red == colour[0] && entry.Green == colour[1] && entry.Blue == colour[2])
+                {
+                    return index;
+                }
+            }
+            return PALETTE_TRANSPARENT;
+        }
+
+        /**
+         * @returns true if this colour is in the palette.
+         */
+        bool Contains(const int16_t* colour) const
+        {
+            return !(GetIndex(colour) == PALETTE_TRANSPARENT && !IsTransparentPixel(colour));
+        }
+
+        int32_t GetClosestIndex(const int16_t* colour) const
+        {
+            // Dithering can push a colour outside of the cube, the cells do not cover those
+            if (!InRange(colour))
+                return GetClosestPaletteIndex(_palette, colour);
+
+            auto cell = GetBucket(colour[0], colour[1], colour[2], kCellBits);
+            auto smallestError = std::numeric_limits<int32_t>::max();
+            auto bestMatch = PALETTE_TRANSPARENT;
+            for (auto i = _cellOffsets[cell]; i < _cellOffsets[cell + 1]; i++)
+            {
+                auto index = _cellIndices[i];
+                auto error = GetError(_palette[index], colour);
+                if (error < smallestError)
+                {
+                    bestMatch = index;
+                    smallestError = error;
+                }
+            }
+            return bestMatch;
+        }
+    };
+
+    const ImageImporter::PaletteLookup& ImageImporter::GetStandardPaletteLookup()
+    {
+        static const PaletteLookup lookup(StandardPalette);
+        return lookup;
+    }
+
     ImageImporter::ImportResult ImageImporter::Import(const Image& image, ImageImportMeta& meta) const
     {
         if (meta.srcSize.width == 0)
@@ -57,6 +238,32 @@ namespace OpenRCT2::Drawing
         return result;
     }
 
+    std::vector<ImageImporter::BatchResult> ImageImporter::ImportFiles(std::vector<BatchSource>& sources) const
+    {
+        std::vector<BatchResult> results(sources.size());
+
+        // Decoding, palette matching and encoding only touch the image at hand, so every file can be done on its own
+        // worker. Each worker writes into its own slot, the order of the results is that of the sources.
+        JobPool jobs;
+        jobs.ParallelFor(0, sources.size(), 1, [&](size_t begin, size_t end) {
+            for (auto i = begin; i < end; i++)
+            {
+                auto& source = sources[i];
+                try
+                {
+                    auto format = source.Meta.palette == Palette::KeepIndices ? IMAGE_FORMAT::PNG : IMAGE_FORMAT::PNG_32;
+                    auto image = Imaging::ReadFromFile(source.Path, format);
+                    results[i].Result = Import(image, source.Meta);
+                }
+                catch (const std::exception& e)
+                {
+                    results[i].Error = e.what();
+                }
+            }
+        });
+        return results;
+    }
+
     std::vector<int32_t> ImageImporter::GetPixels(const Image& image, const ImageImportMeta& meta)
     {
         const uint8_t* pixels = image.Pixels.data();
@@ -234,10 +441,11 @@ namespace OpenRCT2::Drawing
         ImportMode mode, int16_t* rgbaSrc, int32_t x, int32_t y, int32_t width, int32_t height)
     {
         auto& palette = StandardPalette;
-        auto paletteIndex = GetPaletteIndex(palette, rgbaSrc);
-        if ((mode == ImportMode::Closest || mode == ImportMode::Dithering) && !IsInPalette(palette, rgbaSrc))
+        auto& lookup = GetStandardPaletteLookup();
+        auto paletteIndex = lookup.GetIndex(rgbaSrc);
+        if ((mode == ImportMode::Closest || mode == ImportMode::Dithering) && !lookup.Contains(rgbaSrc))
         {
-            paletteIndex = GetClosestPaletteIndex(palette, rgbaSrc);
+            paletteIndex = lookup.GetClosestIndex(rgbaSrc);
             if (mode == ImportMode::Dithering)
             {
                 auto dr = rgbaSrc[0] - static_cast<int16_t>(palette[paletteIndex].Red);
@@ -249,8 +457,8 @@ namespace OpenRCT2::Drawing
 
                 if (x + 1 < width)
                 {
-                    if (!IsInPalette(palette, rgbaSrc + 4)
-                        && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(palette, rgbaSrc + 4)))
+                    if (!lookup.Contains(rgbaSrc + 4)
+                        && thisIndexType == GetPaletteIndexType(lookup.GetClosestIndex(rgbaSrc + 4)))
                     {
                         // Right
                         rgbaSrc[4] += dr * 7 / 16;
@@ -263,8 +471,8 @@ namespace OpenRCT2::Drawing
                 {
                     if (x > 0)
                     {
-                        if (!IsInPalette(palette, rgbaSrc + 4 * (width - 1))
-                            && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(palette, rgbaSrc + 4 * (width - 1))))
+                        if (!lookup.Contains(rgbaSrc + 4 * (width - 1))
+                            && thisIndexType == GetPaletteIndexType(lookup.GetClosestIndex(rgbaSrc + 4 * (width - 1))))
                         {
                             // Bottom left
                             rgbaSrc[4 * (width - 1)] += dr * 3 / 16;
@@ -274,8 +482,8 @@ namespace OpenRCT2::Drawing
                     }
 
                     // Bottom
-                    if (!IsInPalette(palette, rgbaSrc + 4 * width)
-                        && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(palette, rgbaSrc + 4 * width)))
+                    if (!lookup.Contains(rgbaSrc + 4 * width)
+                        && thisIndexType == GetPaletteIndexType(lookup.GetClosestIndex(rgbaSrc + 4 * width)))
                     {
                         rgbaSrc[4 * width] += dr * 5 / 16;
                         rgbaSrc[4 * width + 1] += dg * 5 / 16;
@@ -284,8 +492,8 @@ namespace OpenRCT2::Drawing
 
                     if (x + 1 < width)
                     {
-                        if (!IsInPalette(palette, rgbaSrc + 4 * (width + 1))
-                            && thisIndexType == GetPaletteIndexType(GetClosestPaletteIndex(palette, rgbaSrc + 4 * (width + 1))))
+                        if (!lookup.Contains(rgbaSrc + 4 * (width + 1))
+                            && thisIndexType == GetPaletteIndexType(lookup.GetClosestIndex(rgbaSrc + 4 * (width + 1))))
                         {
                             // Bottom right
                             rgbaSrc[4 * (width + 1)] += dr * 1 / 16;
@@ -300,35 +508,11 @@ namespace OpenRCT2::Drawing
         return paletteIndex;
     }
 
-    int32_t ImageImporter::GetPaletteIndex(const GamePalette& palette, int16_t* colour)
-    {
-        if (!IsTransparentPixel(colour))
-        {
-            for (uint32_t i = 0; i < PALETTE_SIZE; i++)
-            {
-                if (static_cast<int16_t>(palette[i].Red) == colour[0] && static_cast<int16_t>(palette[i].Green) == colour[1]
-                    && static_cast<int16_t>(palette[i].Blue) == colour[2])
-                {
-                    return i;
-                }
-            }
-        }
-        return PALETTE_TRANSPARENT;
-    }
-
     bool ImageImporter::IsTransparentPixel(const int16_t* colour)
     {
         return colour[3] < 128;
     }
 
-    /**
-     * @returns true if this colour is in the standard palette.
-     */
-    bool ImageImporter::IsInPalette(const GamePalette& palette, int16_t* colour)
-    {
-        return !(GetPaletteIndex(palette, colour) == PALETTE_TRANSPARENT && !IsTransparentPixel(colour));
-    }
-
     /**
      * @returns true if palette index is an index not used for a special purpose.
      */
@@ -13,6 +13,8 @@
 #include "../core/JsonFwd.hpp"
 #include "Drawing.h"
 
+#include <optional>
+#include <string>
 #include <string_view>
 #include <tuple>
 
@@ -62,8 +64,27 @@ namespace OpenRCT2::Drawing
             std::vector<uint8_t> Buffer;
         };
 
+        struct BatchSource
+        {
+            std::string Path;
+            ImageImportMeta Meta;
+        };
+
+        struct BatchResult
+        {
+            std::optional<ImportResult> Result;
+            std::string Error;
+        };
+
         ImportResult Import(const Image& image, ImageImportMeta& meta) const;
 
+        /**
+         * Reads and imports the given image files on all available cores. The results are in the same order as the
+         * sources, so the output does not depend on which worker finished first. A file that fails to import leaves
+         * its result empty with the reason in Error, the other files are still imported.
+         */
+        std::vector<BatchResult> ImportFiles(std::vector<BatchSource>& sources) const;
+
     private:
         enum class PaletteIndexType : uint8_t
         {
@@ -74,15 +95,16 @@ namespace OpenRCT2::Drawing
             Special,
         };
 
+        class PaletteLookup;
+
+        static const PaletteLookup& GetStandardPaletteLookup();
         static std::vector<int32_t> GetPixels(const Image& image, const ImageImportMeta& meta);
         static std::vector<uint8_t> EncodeRaw(const int32_t* pixels, ScreenSize size);
         static std::vector<uint8_t> EncodeRLE(const int32_t* pixels, ScreenSize size);
 
         static int32_t CalculatePaletteIndex(
             ImportMode mode, int16_t* rgbaSrc, int32_t x, int32_t y, int32_t width, int32_t height);
-        static int32_t GetPaletteIndex(const GamePalette& palette, int16_t* colour);
         static bool IsTransparentPixel(const int16_t* colour);
-        static bool IsInPalette(const GamePalette& palette, int16_t* colour);
         static bool IsChangablePixel(int32_t paletteIndex);
         static PaletteIndexType GetPaletteIndexType(int32_t paletteIndex);
         static int32_t GetClosestPaletteIndex(const GamePalette& palette, const int16_t* colour);
@@ -28,6 +28,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <unordered_map>
 
 static uint8_t _bakedLightTexture_lantern_0[32 * 32];
 static uint8_t _bakedLightTexture_lantern_1[64 * 64];
@@ -71,6 +72,7 @@ static LightListEntry* _LightListBack;
 static LightListEntry* _LightListFront;
 
 static uint32_t LightListCurrentCountBack;
+static std::unordered_map<uint64_t, uint32_t> _lightListBackIndex;
 static uint32_t LightListCurrentCountFront;
 
 static int16_t _current_view_x_front = 0;
@@ -124,6 +126,68 @@ static void CalcRescaleLightHalf(uint8_t* target, uint8_t* source, uint32_t targ
     }
 }
 
+void LightBlendScalar(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity)
+{
+    if (intensity == 0xFF)
+    {
+        for (int32_t y = 0; y < height; y++)
+        {
+            for (int32_t x = 0; x < width; x++)
+            {
+                *dst = std::min(0xFF, *dst + *src);
+                dst++;
+                src++;
+            }
+
+            dst += dstWrap;
+            src += srcWrap;
+        }
+    }
+    else
+    {
+        for (int32_t y = 0; y < height; y++)
+        {
+            for (int32_t x = 0; x < width; x++)
+            {
+                *dst = std::min(0xFF, *dst + (((*src) * (1 + intensity)) >> 8));
+                dst++;
+                src++;
+            }
+
+            dst += dstWrap;
+            src += srcWrap;
+        }
+    }
+}
+
+static auto GetLightBlendFunction()
+{
+    if (AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 light blend function");
+        return LightBlendAvx2;
+    }
+    else if (SSE41Available())
+    {
+        LOG_VERBOSE("registering SSE4.1 light blend function");
+        return LightBlendSse4_1;
+    }
+    else if (NEONAvailable())
+    {
+        LOG_VERBOSE("registering NEON light blend function");
+        return LightBlendNeon;
+    }
+    else
+    {
+        LOG_VERBOSE("registering scalar light blend function");
+        return LightBlendScalar;
+    }
+}
+
+static const auto LightBlendFunc = GetLightBlendFunction();
+
 void LightFXSetAvailable(bool available)
 {
     _lightfxAvailable = available;
@@ -205,8 +269,18 @@ void LightFXPrepareLightList()
         posOnScreenX = _current_view_zoom_front.ApplyInversedTo(posOnScreenX);
         posOnScreenY = _current_view_zoom_front.ApplyInversedTo(posOnScreenY);
 
-        if ((posOnScreenX < -128) || (posOnScreenY < -128) || (posOnScreenX > _pixelInfo.width + 128)
-            || (posOnScreenY > _pixelInfo.height + 128))
+        // Cull against the area the light texture will actually cover, before any of the occlusion probes are done.
+        // Zoomed out lights are drawn with a smaller texture, lights too small for the zoom level are dropped.
+        auto zoomedSize = GetLightTypeSize(entry->Type)
+            - std::max<int32_t>(0, static_cast<int8_t>(_current_view_zoom_front));
+        if (entry->Type == LightType::None || zoomedSize < 0)
+        {
+            entry->Type = LightType::None;
+            continue;
+        }
+        int32_t halfExtent = 16 << zoomedSize;
+        if ((posOnScreenX + halfExtent <= 0) || (posOnScreenY + halfExtent <= 0)
+            || (posOnScreenX - halfExtent >= _pixelInfo.width) || (posOnScreenY - halfExtent >= _pixelInfo.height))
         {
             entry->Type = LightType::None;
             continue;
@@ -387,17 +461,7 @@ void LightFXPrepareLightList()
         entry->LightIntensity = static_cast<uint8_t>(
             std::max<uint32_t>(0x00, entry->LightIntensity - static_cast<int8_t>(_current_view_zoom_front) * 5));
 
-        if (_current_view_zoom_front > ZoomLevel{ 0 })
-        {
-            if (GetLightTypeSize(entry->Type) < static_cast<int8_t>(_current_view_zoom_front))
-            {
-                entry->Type = LightType::None;
-                continue;
-            }
-
-            entry->Type = SetLightTypeSize(
-                entry->Type, GetLightTypeSize(entry->Type) - static_cast<int8_t>(_current_view_zoom_front));
-        }
+        entry->Type = SetLightTypeSize(entry->Type, static_cast<uint8_t>(zoomedSize));
     }
 }
 
@@ -417,6 +481,7 @@ void LightFXSwapBuffers()
 
     LightListCurrentCountFront = LightListCurrentCountBack;
     LightListCurrentCountBack = 0x0;
+    _lightListBackIndex.clear();
 
     uint32_t uTmp = _lightPolution_back;
     _lightPolution_back = _lightPolution_front;
@@ -581,36 +646,8 @@ void LightFXRenderLightsToFrontBuffer()
         bufReadSkip = bufReadWidth - bufWriteWidth;
         bufWriteSkip = _pixelInfo.width - bufWriteWidth;
 
-        if (entry->LightIntensity == 0xFF)
-        {
-            for (int32_t y = 0; y < bufWriteHeight; y++)
-            {
-                for (int32_t x = 0; x < bufWriteWidth; x++)
-                {
-                    *bufWriteBase = std::min(0xFF, *bufWriteBase + *bufReadBase);
-                    bufWriteBase++;
-                    bufReadBase++;
-                }
-
-                bufWriteBase += bufWriteSkip;
-                bufReadBase += bufReadSkip;
-            }
-        }
-        else
-        {
-            for (int32_t y = 0; y < bufWriteHeight; y++)
-            {
-                for (int32_t x = 0; x < bufWriteWidth; x++)
-                {
-                    *bufWriteBase = std::min(0xFF, *bufWriteBase + (((*bufReadBase) * (1 + entry->LightIntensity)) >> 8));
-                    bufWriteBase++;
-                    bufReadBase++;
-                }
-
-                bufWriteBase += bufWriteSkip;
-                bufReadBase += bufReadSkip;
-            }
-        }
+        LightBlendFunc(
+            bufWriteWidth, bufWriteHeight, bufReadBase, bufWriteBase, bufReadSkip, bufWriteSkip, entry->LightIntensity);
     }
 }
 
@@ -635,23 +672,16 @@ static void LightFXAdd3DLight(
 
     //  LOG_WARNING("%i lights in back", LightListCurrentCountBack);
 
-    for (uint32_t i = 0; i < LightListCurrentCountBack; i++)
+    // Lights are re-added every frame, look up an existing entry for the same light without scanning the whole list
+    auto key = (static_cast<uint64_t>(lightHash) << 16) | (static_cast<uint64_t>(qualifier) << 8) | id;
+    auto [it, inserted] = _lightListBackIndex.try_emplace(key, LightListCurrentCountBack);
+    if (!inserted)
     {
-        LightListEntry* entry = &_LightListBack[i];
-        if (entry->LightHash != lightHash)
-            continue;
-        if (entry->Qualifier != qualifier)
-            continue;
-        if (entry->LightID != id)
-            continue;
-
+        LightListEntry* entry = &_LightListBack[it->second];
         entry->Position = loc;
         entry->ViewCoords = Translate3DTo2DWithZ(GetCurrentRotation(), loc);
         entry->Type = lightType;
         entry->LightIntensity = 0xFF;
-        entry->LightHash = lightHash;
-        entry->Qualifier = qualifier;
-        entry->LightID = id;
         entry->LightLinger = 1;
 
         return;
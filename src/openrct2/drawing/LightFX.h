@@ -76,6 +76,20 @@ void LightFxAddShopLights(const CoordsXY& mapPosition, const uint8_t direction,
 
 uint32_t LightFXGetLightPolution();
 
+// Adds a light texture onto the light buffer with saturation, the texture is scaled by (intensity + 1) / 256 first.
+void LightBlendScalar(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity);
+void LightBlendSse4_1(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity);
+void LightBlendAvx2(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity);
+void LightBlendNeon(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity);
+
 void LightFXApplyPaletteFilter(uint8_t i, uint8_t* r, uint8_t* g, uint8_t* b);
 void LightFXRenderToTexture(
     void* dstPixels, uint32_t dstPitch, uint8_t* bits, uint32_t width, uint32_t height, const uint32_t* palette,
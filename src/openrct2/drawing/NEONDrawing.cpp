@@ -0,0 +1,105 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../common.h"
+#include "../core/Guard.hpp"
+#include "Drawing.h"
+#include "LightFX.h"
+
+#ifdef __ARM_NEON
+
+#    include <arm_neon.h>
+
+template<bool TRemapDst>
+static void RleRemapNeon(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    const uint8x16_t zero = vdupq_n_u8(0);
+    int32_t i = 0;
+    for (; i + 16 <= numPixels; i += 16)
+    {
+        // There is no byte gather, the lookups are done one by one but the transparency checks are not
+        alignas(16) uint8_t remapped[16];
+        for (int32_t j = 0; j < 16; j++)
+        {
+            remapped[j] = map[TRemapDst ? dst[i + j] : src[i + j]];
+        }
+
+        const uint8x16_t source = vld1q_u8(src + i);
+        const uint8x16_t dest = vld1q_u8(dst + i);
+        const uint8x16_t pixels = vld1q_u8(remapped);
+        const uint8x16_t transparent = vorrq_u8(vceqq_u8(source, zero), vceqq_u8(pixels, zero));
+        vst1q_u8(dst + i, vbslq_u8(transparent, dest, pixels));
+    }
+
+    if constexpr (TRemapDst)
+    {
+        RleRemapDstScalar(src + i, dst + i, map, numPixels - i);
+    }
+    else
+    {
+        RleRemapSrcScalar(src + i, dst + i, map, numPixels - i);
+    }
+}
+
+void RleRemapSrcNeon(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    RleRemapNeon<false>(src, dst, map, numPixels);
+}
+
+void RleRemapDstNeon(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    RleRemapNeon<true>(src, dst, map, numPixels);
+}
+
+void LightBlendNeon(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity)
+{
+    const uint16x8_t scale = vdupq_n_u16(static_cast<uint16_t>(1 + intensity));
+    for (int32_t y = 0; y < height; y++)
+    {
+        int32_t x = 0;
+        for (; x + 16 <= width; x += 16)
+        {
+            uint8x16_t light = vld1q_u8(src + x);
+            if (intensity != 0xFF)
+            {
+                const uint16x8_t lo = vmulq_u16(vmovl_u8(vget_low_u8(light)), scale);
+                const uint16x8_t hi = vmulq_u16(vmovl_u8(vget_high_u8(light)), scale);
+                light = vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+            }
+            vst1q_u8(dst + x, vqaddq_u8(vld1q_u8(dst + x), light));
+        }
+        LightBlendScalar(width - x, 1, src + x, dst + x, 0, 0, intensity);
+
+        src += width + srcWrap;
+        dst += width + dstWrap;
+    }
+}
+
+#else
+
+void RleRemapSrcNeon(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    Guard::Fail("NEON function called on a CPU that doesn't support NEON");
+}
+
+void RleRemapDstNeon(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    Guard::Fail("NEON function called on a CPU that doesn't support NEON");
+}
+
+void LightBlendNeon(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity)
+{
+    Guard::Fail("NEON function called on a CPU that doesn't support NEON");
+}
+
+#endif // __ARM_NEON
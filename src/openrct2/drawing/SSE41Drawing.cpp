@@ -10,6 +10,7 @@
 #include "../common.h"
 #include "../core/Guard.hpp"
 #include "Drawing.h"
+#include "LightFX.h"
 
 #ifdef __SSE4_1__
 
@@ -56,6 +57,78 @@ void MaskSse4_1(
     }
 }
 
+template<bool TRemapDst>
+static void RleRemapSse4_1(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    const __m128i zero128 = {};
+    int32_t i = 0;
+    for (; i + 16 <= numPixels; i += 16)
+    {
+        // There is no byte gather, the lookups are done one by one but the transparency checks are not
+        alignas(16) uint8_t remapped[16];
+        for (int32_t j = 0; j < 16; j++)
+        {
+            remapped[j] = map[TRemapDst ? dst[i + j] : src[i + j]];
+        }
+
+        const __m128i source = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i dest = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        const __m128i pixels = _mm_load_si128(reinterpret_cast<const __m128i*>(remapped));
+        const __m128i transparent = _mm_or_si128(_mm_cmpeq_epi8(source, zero128), _mm_cmpeq_epi8(pixels, zero128));
+        const __m128i blended = _mm_blendv_epi8(pixels, dest, transparent);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), blended);
+    }
+
+    if constexpr (TRemapDst)
+    {
+        RleRemapDstScalar(src + i, dst + i, map, numPixels - i);
+    }
+    else
+    {
+        RleRemapSrcScalar(src + i, dst + i, map, numPixels - i);
+    }
+}
+
+void RleRemapSrcSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    RleRemapSse4_1<false>(src, dst, map, numPixels);
+}
+
+void RleRemapDstSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    RleRemapSse4_1<true>(src, dst, map, numPixels);
+}
+
+void LightBlendSse4_1(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity)
+{
+    const __m128i zero128 = {};
+    const __m128i scale = _mm_set1_epi16(static_cast<int16_t>(1 + intensity));
+    for (int32_t y = 0; y < height; y++)
+    {
+        int32_t x = 0;
+        for (; x + 16 <= width; x += 16)
+        {
+            __m128i light = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(src + x));
+            if (intensity != 0xFF)
+            {
+                // (src * (intensity + 1)) >> 8 fits in 16 bits for every byte value
+                const __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(light, zero128), scale), 8);
+                const __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(light, zero128), scale), 8);
+                light = _mm_packus_epi16(lo, hi);
+            }
+            const __m128i dest = _mm_lddqu_si128(reinterpret_cast<const __m128i*>(dst + x));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x), _mm_adds_epu8(dest, light));
+        }
+        LightBlendScalar(width - x, 1, src + x, dst + x, 0, 0, intensity);
+
+        src += width + srcWrap;
+        dst += width + dstWrap;
+    }
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -69,4 +142,21 @@ void MaskSse4_1(
     Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
 }
 
+void RleRemapSrcSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+void RleRemapDstSse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t numPixels)
+{
+    Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+void LightBlendSse4_1(
+    int32_t width, int32_t height, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t srcWrap, int32_t dstWrap,
+    uint8_t intensity)
+{
+    Guard::Fail("SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
 #endif // __SSE4_1__
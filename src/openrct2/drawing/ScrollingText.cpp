@@ -22,7 +22,11 @@
 #include "TTF.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -42,10 +46,54 @@ static uint8_t _characterBitmaps[FONT_SPRITE_GLYPH_COUNT + SPR_G2_GLYPH_COUNT][8
 static uint32_t _drawSCrollNextIndex = 0;
 static std::mutex _scrollingTextMutex;
 
-static void ScrollingTextSetBitmapForSprite(
-    std::string_view text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour);
-static void ScrollingTextSetBitmapForTTF(
-    std::string_view text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour);
+/**
+ * A scrolling string rendered once as a row of 8 pixel high columns. The bitmap for any scroll position is made by
+ * copying the columns from the scroll offset onwards to the positions of the scrolling mode.
+ */
+struct ScrollingTextStrip
+{
+    struct Column
+    {
+        // Colour of each row, 0 where nothing is drawn
+        uint8_t Colours[8];
+        // Rows that are blended with what is under them instead of drawn over it, for simulated TTF hinting
+        uint8_t BlendMask;
+    };
+
+    std::vector<Column> Columns;
+    // TTF text wraps around forever, sprite font text is repeated up to four times
+    bool Wraps{};
+};
+
+/**
+ * Strips are cached by string, arguments and colour, spread over several shards by hash so paint threads looking up
+ * different strings rarely wait for each other.
+ */
+struct ScrollingTextStripCacheEntry
+{
+    StringId Id;
+    uint8_t StringArgs[32];
+    colour_t Colour;
+    bool UseTTF;
+    bool UpperCase;
+    uint32_t LastUse;
+    std::shared_ptr<const ScrollingTextStrip> Strip;
+};
+
+struct ScrollingTextStripCacheShard
+{
+    std::mutex Mutex;
+    std::vector<ScrollingTextStripCacheEntry> Entries;
+    uint32_t UseCounter{};
+};
+
+static constexpr size_t kScrollingTextStripCacheShards = 16;
+static constexpr size_t kScrollingTextStripCacheShardSize = 32;
+static std::array<ScrollingTextStripCacheShard, kScrollingTextStripCacheShards> _scrollingTextStripCache;
+static std::atomic<uint32_t> _scrollingTextStripGeneration{};
+
+static void ScrollingTextCreateStripForSprite(std::string_view text, colour_t colour, ScrollingTextStrip& strip);
+static void ScrollingTextCreateStripForTTF(std::string_view text, colour_t colour, ScrollingTextStrip& strip);
 
 static void ScrollingTextInitialiseCharacterBitmaps(uint32_t glyphStart, uint16_t offset, uint16_t count, bool isAntiAliased)
 {
@@ -146,15 +194,134 @@ static int32_t ScrollingTextGetMatchingOrOldest(
     return scrollIndex;
 }
 
-static void ScrollingTextFormat(utf8* dst, size_t size, DrawScrollText* scrollText)
+static void ScrollingTextFormat(utf8* dst, size_t size, StringId stringId, const uint8_t* stringArgs, bool upperCase)
 {
-    if (gConfigGeneral.UpperCaseBanners)
+    if (upperCase)
+    {
+        FormatStringToUpper(dst, size, stringId, stringArgs);
+    }
+    else
+    {
+        FormatStringLegacy(dst, size, stringId, stringArgs);
+    }
+}
+
+static std::shared_ptr<const ScrollingTextStrip> ScrollingTextGetStrip(
+    StringId stringId, const uint8_t* stringArgs, colour_t colour)
+{
+    constexpr size_t kStringArgsSize = sizeof(ScrollingTextStripCacheEntry::StringArgs);
+    const bool useTTF = LocalisationService_UseTrueTypeFont();
+    const bool upperCase = gConfigGeneral.UpperCaseBanners;
+
+    uint32_t hash = 2166136261u;
+    auto hashByte = [&hash](uint8_t value) { hash = (hash ^ value) * 16777619u; };
+    hashByte(stringId & 0xFF);
+    hashByte(stringId >> 8);
+    std::for_each_n(stringArgs, kStringArgsSize, hashByte);
+    hashByte(colour);
+    auto& shard = _scrollingTextStripCache[hash % kScrollingTextStripCacheShards];
+
+    auto findEntry = [&]() -> ScrollingTextStripCacheEntry* {
+        for (auto& entry : shard.Entries)
+        {
+            if (entry.Id == stringId && entry.Colour == colour && entry.UseTTF == useTTF
+                && entry.UpperCase == upperCase && std::memcmp(entry.StringArgs, stringArgs, kStringArgsSize) == 0)
+            {
+                entry.LastUse = ++shard.UseCounter;
+                return &entry;
+            }
+        }
+        return nullptr;
+    };
+
+    {
+        std::scoped_lock<std::mutex> lock(shard.Mutex);
+        if (auto* entry = findEntry(); entry != nullptr)
+            return entry->Strip;
+    }
+
+    // Render outside the lock so other strings in this shard can still be looked up
+    const auto generation = _scrollingTextStripGeneration.load();
+    utf8 scrollString[256];
+    ScrollingTextFormat(scrollString, sizeof(scrollString), stringId, stringArgs, upperCase);
+
+    auto strip = std::make_shared<ScrollingTextStrip>();
+    if (useTTF)
     {
-        FormatStringToUpper(dst, size, scrollText->string_id, scrollText->string_args);
+        ScrollingTextCreateStripForTTF(scrollString, colour, *strip);
     }
     else
     {
-        FormatStringLegacy(dst, size, scrollText->string_id, scrollText->string_args);
+        ScrollingTextCreateStripForSprite(scrollString, colour, *strip);
+    }
+
+    std::scoped_lock<std::mutex> lock(shard.Mutex);
+    if (auto* entry = findEntry(); entry != nullptr)
+        return entry->Strip;
+
+    // Strings may have been renamed while this one was rendered, do not cache it then
+    if (generation != _scrollingTextStripGeneration.load())
+        return strip;
+
+    ScrollingTextStripCacheEntry* entry;
+    if (shard.Entries.size() < kScrollingTextStripCacheShardSize)
+    {
+        entry = &shard.Entries.emplace_back();
+    }
+    else
+    {
+        entry = &*std::min_element(shard.Entries.begin(), shard.Entries.end(), [&shard](const auto& a, const auto& b) {
+            return shard.UseCounter - a.LastUse > shard.UseCounter - b.LastUse;
+        });
+    }
+    entry->Id = stringId;
+    std::memcpy(entry->StringArgs, stringArgs, kStringArgsSize);
+    entry->Colour = colour;
+    entry->UseTTF = useTTF;
+    entry->UpperCase = upperCase;
+    entry->LastUse = ++shard.UseCounter;
+    entry->Strip = strip;
+    return strip;
+}
+
+static void ScrollingTextDrawStrip(
+    const ScrollingTextStrip& strip, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets)
+{
+    const auto numColumns = static_cast<int32_t>(strip.Columns.size());
+    if (numColumns == 0)
+        return;
+
+    auto column = strip.Wraps ? scroll % numColumns : scroll;
+    for (; *scrollPositionOffsets != -1; scrollPositionOffsets++)
+    {
+        if (column >= numColumns)
+        {
+            if (!strip.Wraps)
+                return;
+            column = 0;
+        }
+
+        int16_t scrollPosition = *scrollPositionOffsets;
+        if (scrollPosition > -1)
+        {
+            const auto& src = strip.Columns[column];
+            uint8_t* dst = &bitmap[scrollPosition];
+            for (int32_t row = 0; row < 8; row++, dst += 64)
+            {
+                if (src.Colours[row] == 0)
+                    continue;
+
+                if (src.BlendMask & (1 << row))
+                {
+                    *dst = BlendColours(src.Colours[row], *dst);
+                }
+                else
+                {
+                    *dst = src.Colours[row];
+                }
+            }
+        }
+        column++;
     }
 }
 
@@ -1431,20 +1598,38 @@ void ScrollingTextInvalidate()
         scrollText.string_id = 0;
         std::memset(scrollText.string_args, 0, sizeof(scrollText.string_args));
     }
+
+    _scrollingTextStripGeneration++;
+    for (auto& shard : _scrollingTextStripCache)
+    {
+        std::scoped_lock<std::mutex> lock(shard.Mutex);
+        shard.Entries.clear();
+    }
 }
 
 ImageId ScrollingTextSetup(
     PaintSession& session, StringId stringId, Formatter& ft, uint16_t scroll, uint16_t scrollingMode, colour_t colour)
 {
-    std::scoped_lock<std::mutex> lock(_scrollingTextMutex);
-
     assert(scrollingMode < MAX_SCROLLING_TEXT_MODES);
 
     if (session.DPI.zoom_level > ZoomLevel{ 0 })
         return ImageId(SPR_SCROLLING_TEXT_DEFAULT);
 
-    _drawSCrollNextIndex++;
     ft.Rewind();
+    {
+        std::scoped_lock<std::mutex> lock(_scrollingTextMutex);
+        _drawSCrollNextIndex++;
+        int32_t scrollIndex = ScrollingTextGetMatchingOrOldest(stringId, ft, scroll, scrollingMode, colour);
+        if (scrollIndex >= SPR_SCROLLING_TEXT_START)
+            return ImageId(scrollIndex);
+    }
+
+    // Only a new string needs rendering, a new scroll position of a known one just copies from its strip
+    auto strip = ScrollingTextGetStrip(stringId, ft.Buf(), colour);
+
+    std::scoped_lock<std::mutex> lock(_scrollingTextMutex);
+
+    // Another thread may have set up the same text while the strip was looked up
     int32_t scrollIndex = ScrollingTextGetMatchingOrOldest(stringId, ft, scroll, scrollingMode, colour);
     if (scrollIndex >= SPR_SCROLLING_TEXT_START)
         return ImageId(scrollIndex);
@@ -1458,29 +1643,15 @@ ImageId ScrollingTextSetup(
     scrollText->mode = scrollingMode;
     scrollText->id = _drawSCrollNextIndex;
 
-    // Create the string to draw
-    utf8 scrollString[256];
-    ScrollingTextFormat(scrollString, 256, scrollText);
-
-    const int16_t* scrollingModePositions = _scrollPositions[scrollingMode];
-
     std::fill_n(scrollText->bitmap, 320 * 8, 0x00);
-    if (LocalisationService_UseTrueTypeFont())
-    {
-        ScrollingTextSetBitmapForTTF(scrollString, scroll, scrollText->bitmap, scrollingModePositions, colour);
-    }
-    else
-    {
-        ScrollingTextSetBitmapForSprite(scrollString, scroll, scrollText->bitmap, scrollingModePositions, colour);
-    }
+    ScrollingTextDrawStrip(*strip, scroll, scrollText->bitmap, _scrollPositions[scrollingMode]);
 
     uint32_t imageId = SPR_SCROLLING_TEXT_START + scrollIndex;
     DrawingEngineInvalidateImage(imageId);
     return ImageId(imageId);
 }
 
-static void ScrollingTextSetBitmapForSprite(
-    std::string_view text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour)
+static void ScrollingTextCreateStripForSprite(std::string_view text, colour_t colour, ScrollingTextStrip& strip)
 {
     auto characterColour = colour;
     auto fmt = FmtString(text);
@@ -1499,30 +1670,13 @@ static void ScrollingTextSetBitmapForSprite(
                     auto characterBitmap = FontSpriteGetCodepointBitmap(codepoint);
                     for (; characterWidth != 0; characterWidth--, characterBitmap++)
                     {
-                        // Skip any non-displayed columns
-                        if (scroll != 0)
-                        {
-                            scroll--;
-                            continue;
-                        }
-
-                        int16_t scrollPosition = *scrollPositionOffsets;
-                        if (scrollPosition == -1)
-                            return;
-
-                        if (scrollPosition > -1)
+                        auto& column = strip.Columns.emplace_back();
+                        int32_t row = 0;
+                        for (uint8_t char_bitmap = *characterBitmap; char_bitmap != 0; char_bitmap >>= 1, row++)
                         {
-                            auto dst = &bitmap[scrollPosition];
-                            for (uint8_t char_bitmap = *characterBitmap; char_bitmap != 0; char_bitmap >>= 1)
-                            {
-                                if (char_bitmap & 1)
-                                    *dst = characterColour;
-
-                                // Jump to next row
-                                dst += 64;
-                            }
+                            if (char_bitmap & 1)
+                                column.Colours[row] = characterColour;
                         }
-                        scrollPositionOffsets++;
                     }
                 }
             }
@@ -1537,16 +1691,16 @@ static void ScrollingTextSetBitmapForSprite(
             }
         }
     }
+    strip.Wraps = false;
 }
 
-static void ScrollingTextSetBitmapForTTF(
-    std::string_view text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour)
+static void ScrollingTextCreateStripForTTF(std::string_view text, colour_t colour, ScrollingTextStrip& strip)
 {
 #ifndef NO_TTF
     auto fontDesc = TTFGetFontFromSpriteBase(FontStyle::Tiny);
     if (fontDesc->font == nullptr)
     {
-        ScrollingTextSetBitmapForSprite(text, scroll, bitmap, scrollPositionOffsets, colour);
+        ScrollingTextCreateStripForSprite(text, colour, strip);
         return;
     }
 
@@ -1589,46 +1743,27 @@ static void ScrollingTextSetBitmapForTTF(
 
     bool use_hinting = gConfigFonts.EnableHinting && fontDesc->hinting_threshold > 0;
 
-    for (int32_t x = 0;; x++)
+    strip.Columns.resize(width);
+    for (int32_t x = 0; x < width; x++)
     {
-        if (x >= width)
-            x = 0;
-
-        // Skip any non-displayed columns
-        if (scroll == 0)
+        auto& column = strip.Columns[x];
+        for (int32_t y = min_vpos; y < max_vpos; y++)
         {
-            int16_t scrollPosition = *scrollPositionOffsets;
-            if (scrollPosition == -1)
-                return;
-
-            if (scrollPosition > -1)
+            const auto row = y - min_vpos;
+            uint8_t src_pixel = src[y * width + x];
+            if ((!use_hinting && src_pixel != 0) || src_pixel > 140)
             {
-                uint8_t* dst = &bitmap[scrollPosition];
-
-                for (int32_t y = min_vpos; y < max_vpos; y++)
-                {
-                    uint8_t src_pixel = src[y * width + x];
-                    if ((!use_hinting && src_pixel != 0) || src_pixel > 140)
-                    {
-                        // Centre of the glyph: use full colour.
-                        *dst = colour;
-                    }
-                    else if (use_hinting && src_pixel > fontDesc->hinting_threshold)
-                    {
-                        // Simulate font hinting by shading the background colour instead.
-                        *dst = BlendColours(colour, *dst);
-                    }
-
-                    // Jump to next row
-                    dst += 64;
-                }
+                // Centre of the glyph: use full colour.
+                column.Colours[row] = colour;
+            }
+            else if (use_hinting && src_pixel > fontDesc->hinting_threshold)
+            {
+                // Simulate font hinting by shading the background colour instead.
+                column.Colours[row] = colour;
+                column.BlendMask |= 1 << row;
             }
-            scrollPositionOffsets++;
-        }
-        else
-        {
-            scroll--;
         }
     }
+    strip.Wraps = true;
 #endif // NO_TTF
 }
@@ -9,7 +9,12 @@
 
 #ifndef NO_TTF
 
-#    include <mutex>
+#    include <algorithm>
+#    include <atomic>
+#    include <shared_mutex>
+#    include <tuple>
+#    include <unordered_map>
+#    include <vector>
 #    pragma clang diagnostic push
 #    pragma clang diagnostic ignored "-Wdocumentation"
 #    include <ft2build.h>
@@ -26,40 +31,54 @@
 
 static bool _ttfInitialised = false;
 
-#    define TTF_SURFACE_CACHE_SIZE 256
-#    define TTF_GETWIDTH_CACHE_SIZE 1024
+// Rendered strings and measured widths are evicted, least recently drawn first, once they use more than this
+static constexpr size_t kTTFSurfaceCacheMemoryBudget = 4 * 1024 * 1024;
+static constexpr size_t kTTFGetWidthCacheMemoryBudget = 256 * 1024;
 
 struct ttf_cache_entry
 {
+    ttf_cache_entry(TTFSurface* surface_, TTF_Font* font_, std::string_view text_)
+        : surface(surface_)
+        , font(font_)
+        , text(text_)
+        , lastUseTick(gCurrentDrawCount)
+    {
+    }
+
     TTFSurface* surface;
     TTF_Font* font;
     u8string text;
-    uint32_t lastUseTick;
+    // Entries drawn during the current frame are never evicted, so paint workers can keep using their surfaces
+    mutable std::atomic<uint32_t> lastUseTick;
 };
 
 struct ttf_getwidth_cache_entry
 {
+    ttf_getwidth_cache_entry(uint32_t width_, TTF_Font* font_, std::string_view text_)
+        : width(width_)
+        , font(font_)
+        , text(text_)
+        , lastUseTick(gCurrentDrawCount)
+    {
+    }
+
     uint32_t width;
     TTF_Font* font;
     u8string text;
-    uint32_t lastUseTick;
+    mutable std::atomic<uint32_t> lastUseTick;
 };
 
-static ttf_cache_entry _ttfSurfaceCache[TTF_SURFACE_CACHE_SIZE] = {};
-static int32_t _ttfSurfaceCacheCount = 0;
-static int32_t _ttfSurfaceCacheHitCount = 0;
-static int32_t _ttfSurfaceCacheMissCount = 0;
+// Keyed by TTFSurfaceCacheHash, entries with the same hash are told apart by font and text
+static std::unordered_multimap<uint32_t, ttf_cache_entry> _ttfSurfaceCache;
+static size_t _ttfSurfaceCacheMemory = 0;
+static std::unordered_multimap<uint32_t, ttf_getwidth_cache_entry> _ttfGetWidthCache;
+static size_t _ttfGetWidthCacheMemory = 0;
 
-static ttf_getwidth_cache_entry _ttfGetWidthCache[TTF_GETWIDTH_CACHE_SIZE] = {};
-static int32_t _ttfGetWidthCacheCount = 0;
-static int32_t _ttfGetWidthCacheHitCount = 0;
-static int32_t _ttfGetWidthCacheMissCount = 0;
-
-static std::mutex _mutex;
+// Lookups only need a shared lock, rendering or measuring a new string needs an exclusive one
+static std::shared_mutex _mutex;
 
 static TTF_Font* TTFOpenFont(const utf8* fontPath, int32_t ptSize);
 static void TTFCloseFont(TTF_Font* font);
-static void TTFSurfaceCacheDispose(ttf_cache_entry* entry);
 static void TTFSurfaceCacheDisposeAll();
 static void TTFGetWidthCacheDisposeAll();
 static bool TTFGetSize(TTF_Font* font, std::string_view text, int32_t* outWidth, int32_t* outHeight);
@@ -86,6 +105,26 @@ public:
     }
 };
 
+template<typename T> class FontSharedLockHelper
+{
+    T& _mutex;
+    const bool _enabled;
+
+public:
+    FontSharedLockHelper(T& mutex)
+        : _mutex(mutex)
+        , _enabled(gConfigGeneral.MultiThreading)
+    {
+        if (_enabled)
+            _mutex.lock_shared();
+    }
+    ~FontSharedLockHelper()
+    {
+        if (_enabled)
+            _mutex.unlock_shared();
+    }
+};
+
 static void TTFToggleHinting(bool)
 {
     if (!LocalisationService_UseTrueTypeFont())
@@ -100,15 +139,12 @@ static void TTFToggleHinting(bool)
         TTF_SetFontHinting(fontDesc->font, use_hinting ? 1 : 0);
     }
 
-    if (_ttfSurfaceCacheCount)
-    {
-        TTFSurfaceCacheDisposeAll();
-    }
+    TTFSurfaceCacheDisposeAll();
 }
 
 bool TTFInitialise()
 {
-    FontLockHelper<std::mutex> lock(_mutex);
+    FontLockHelper<std::shared_mutex> lock(_mutex);
 
     if (_ttfInitialised)
         return true;
@@ -147,7 +183,7 @@ bool TTFInitialise()
 
 void TTFDispose()
 {
-    FontLockHelper<std::mutex> lock(_mutex);
+    FontLockHelper<std::shared_mutex> lock(_mutex);
 
     if (!_ttfInitialised)
         return;
@@ -170,6 +206,25 @@ void TTFDispose()
     _ttfInitialised = false;
 }
 
+size_t TTFGetMemoryUsage()
+{
+    FontSharedLockHelper<std::shared_mutex> lock(_mutex);
+
+    size_t total = _ttfSurfaceCacheMemory + _ttfGetWidthCacheMemory;
+    if (_ttfInitialised)
+    {
+        for (int32_t i = 0; i < FontStyleCount; i++)
+        {
+            const TTFFontDescriptor* fontDesc = &(gCurrentTTFFontSet->size[i]);
+            if (fontDesc->font != nullptr)
+            {
+                total += TTF_GetGlyphCacheMemoryUsage(fontDesc->font);
+            }
+        }
+    }
+    return total;
+}
+
 static TTF_Font* TTFOpenFont(const utf8* fontPath, int32_t ptSize)
 {
     return TTF_OpenFont(fontPath, ptSize);
@@ -190,160 +245,167 @@ static uint32_t TTFSurfaceCacheHash(TTF_Font* font, std::string_view text)
     return hash;
 }
 
-static void TTFSurfaceCacheDispose(ttf_cache_entry* entry)
+static size_t TTFSurfaceCacheEntryMemory(const ttf_cache_entry& entry)
+{
+    // Roughly what a node of the map costs on top of the entry itself
+    constexpr size_t kNodeOverhead = 4 * sizeof(void*);
+    return kNodeOverhead + sizeof(ttf_cache_entry) + entry.text.capacity() + sizeof(TTFSurface)
+        + static_cast<size_t>(entry.surface->w) * entry.surface->h;
+}
+
+static size_t TTFGetWidthCacheEntryMemory(const ttf_getwidth_cache_entry& entry)
 {
-    if (entry->surface != nullptr)
+    constexpr size_t kNodeOverhead = 4 * sizeof(void*);
+    return kNodeOverhead + sizeof(ttf_getwidth_cache_entry) + entry.text.capacity();
+}
+
+/**
+ * Removes the least recently used entries until the cache is back under three quarters of its budget, so that
+ * evicting does not happen again for every new string. Entries used in the current frame are kept.
+ */
+template<typename TEntry, typename TMemoryFunc, typename TDisposeFunc>
+static void TTFCacheEvict(
+    std::unordered_multimap<uint32_t, TEntry>& cache, size_t& memory, size_t budget, TMemoryFunc memoryOf,
+    TDisposeFunc dispose)
+{
+    if (memory <= budget)
+        return;
+
+    using Iterator = typename std::unordered_multimap<uint32_t, TEntry>::iterator;
+    std::vector<std::pair<uint32_t, Iterator>> candidates;
+    candidates.reserve(cache.size());
+    for (auto it = cache.begin(); it != cache.end(); it++)
+    {
+        auto lastUseTick = it->second.lastUseTick.load(std::memory_order_relaxed);
+        if (lastUseTick != gCurrentDrawCount)
+        {
+            // Ages are compared as differences so the draw counter can wrap around
+            candidates.emplace_back(gCurrentDrawCount - lastUseTick, it);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+
+    const size_t target = budget / 4 * 3;
+    for (auto& [age, it] : candidates)
     {
-        TTFFreeSurface(entry->surface);
-        entry->text.clear();
-        entry->surface = nullptr;
-        entry->font = nullptr;
+        if (memory <= target)
+            break;
+
+        memory -= memoryOf(it->second);
+        dispose(it->second);
+        cache.erase(it);
     }
 }
 
 static void TTFSurfaceCacheDisposeAll()
 {
-    for (int32_t i = 0; i < TTF_SURFACE_CACHE_SIZE; i++)
+    for (auto& [hash, entry] : _ttfSurfaceCache)
     {
-        TTFSurfaceCacheDispose(&_ttfSurfaceCache[i]);
-        _ttfSurfaceCacheCount--;
+        TTFFreeSurface(entry.surface);
     }
+    _ttfSurfaceCache.clear();
+    _ttfSurfaceCacheMemory = 0;
 }
 
 void TTFToggleHinting()
 {
-    FontLockHelper<std::mutex> lock(_mutex);
+    FontLockHelper<std::shared_mutex> lock(_mutex);
     TTFToggleHinting(true);
 }
 
-TTFSurface* TTFSurfaceCacheGetOrAdd(TTF_Font* font, std::string_view text)
+template<typename TEntry>
+static const TEntry* TTFCacheFind(
+    const std::unordered_multimap<uint32_t, TEntry>& cache, uint32_t hash, TTF_Font* font, std::string_view text)
 {
-    ttf_cache_entry* entry;
+    auto [begin, end] = cache.equal_range(hash);
+    for (auto it = begin; it != end; it++)
+    {
+        const auto& entry = it->second;
+        if (entry.font == font && String::Equals(entry.text, text))
+        {
+            entry.lastUseTick.store(gCurrentDrawCount, std::memory_order_relaxed);
+            return &entry;
+        }
+    }
+    return nullptr;
+}
 
+TTFSurface* TTFSurfaceCacheGetOrAdd(TTF_Font* font, std::string_view text)
+{
     uint32_t hash = TTFSurfaceCacheHash(font, text);
-    int32_t index = hash % TTF_SURFACE_CACHE_SIZE;
-
-    FontLockHelper<std::mutex> lock(_mutex);
-
-    for (int32_t i = 0; i < TTF_SURFACE_CACHE_SIZE; i++)
     {
-        entry = &_ttfSurfaceCache[index];
-
-        // Check if entry is a hit
-        if (entry->surface == nullptr)
-            break;
-        if (entry->font == font && String::Equals(entry->text, text))
+        FontSharedLockHelper<std::shared_mutex> lock(_mutex);
+        if (auto* entry = TTFCacheFind(_ttfSurfaceCache, hash, font, text); entry != nullptr)
         {
-            _ttfSurfaceCacheHitCount++;
-            entry->lastUseTick = gCurrentDrawCount;
             return entry->surface;
         }
+    }
 
-        // If entry hasn't been used for a while, replace it
-        if (entry->lastUseTick < gCurrentDrawCount - 64)
-        {
-            break;
-        }
+    FontLockHelper<std::shared_mutex> lock(_mutex);
 
-        // Check if next entry is a hit
-        if (++index >= TTF_SURFACE_CACHE_SIZE)
-            index = 0;
+    // Another thread may have rendered the same string in the meantime
+    if (auto* entry = TTFCacheFind(_ttfSurfaceCache, hash, font, text); entry != nullptr)
+    {
+        return entry->surface;
     }
 
-    // Cache miss, replace entry with new surface
-    entry = &_ttfSurfaceCache[index];
-    TTFSurfaceCacheDispose(entry);
-
     TTFSurface* surface = TTFRender(font, text);
     if (surface == nullptr)
     {
         return nullptr;
     }
 
-    _ttfSurfaceCacheMissCount++;
-    // printf("CACHE HITS: %d   MISSES: %d)\n", _ttfSurfaceCacheHitCount, _ttfSurfaceCacheMissCount);
-
-    _ttfSurfaceCacheCount++;
-    entry->surface = surface;
-    entry->font = font;
-    entry->text = text;
-    entry->lastUseTick = gCurrentDrawCount;
-    return entry->surface;
-}
-
-static void TTFGetWidthCacheDispose(ttf_getwidth_cache_entry* entry)
-{
-    if (entry->text.empty())
-        return;
+    auto it = _ttfSurfaceCache.emplace(
+        std::piecewise_construct, std::forward_as_tuple(hash), std::forward_as_tuple(surface, font, text));
+    _ttfSurfaceCacheMemory += TTFSurfaceCacheEntryMemory(it->second);
 
-    entry->text.clear();
-    entry->width = 0;
-    entry->font = nullptr;
+    TTFCacheEvict(
+        _ttfSurfaceCache, _ttfSurfaceCacheMemory, kTTFSurfaceCacheMemoryBudget, TTFSurfaceCacheEntryMemory,
+        [](ttf_cache_entry& entry) { TTFFreeSurface(entry.surface); });
+    return surface;
 }
 
 static void TTFGetWidthCacheDisposeAll()
 {
-    for (int32_t i = 0; i < TTF_GETWIDTH_CACHE_SIZE; i++)
-    {
-        TTFGetWidthCacheDispose(&_ttfGetWidthCache[i]);
-        _ttfGetWidthCacheCount--;
-    }
+    _ttfGetWidthCache.clear();
+    _ttfGetWidthCacheMemory = 0;
 }
 
 uint32_t TTFGetWidthCacheGetOrAdd(TTF_Font* font, std::string_view text)
 {
-    ttf_getwidth_cache_entry* entry;
-
     uint32_t hash = TTFSurfaceCacheHash(font, text);
-    int32_t index = hash % TTF_GETWIDTH_CACHE_SIZE;
-
-    FontLockHelper<std::mutex> lock(_mutex);
-
-    for (int32_t i = 0; i < TTF_GETWIDTH_CACHE_SIZE; i++)
     {
-        entry = &_ttfGetWidthCache[index];
-
-        // Check if entry is a hit
-        if (entry->text.empty())
-            break;
-        if (entry->font == font && String::Equals(entry->text, text))
+        FontSharedLockHelper<std::shared_mutex> lock(_mutex);
+        if (auto* entry = TTFCacheFind(_ttfGetWidthCache, hash, font, text); entry != nullptr)
         {
-            _ttfGetWidthCacheHitCount++;
-            entry->lastUseTick = gCurrentDrawCount;
             return entry->width;
         }
+    }
 
-        // If entry hasn't been used for a while, replace it
-        if (entry->lastUseTick < gCurrentDrawCount - 64)
-        {
-            break;
-        }
+    FontLockHelper<std::shared_mutex> lock(_mutex);
 
-        // Check if next entry is a hit
-        if (++index >= TTF_GETWIDTH_CACHE_SIZE)
-            index = 0;
+    if (auto* entry = TTFCacheFind(_ttfGetWidthCache, hash, font, text); entry != nullptr)
+    {
+        return entry->width;
     }
 
-    // Cache miss, replace entry with new width
-    entry = &_ttfGetWidthCache[index];
-    TTFGetWidthCacheDispose(entry);
-
     int32_t width, height;
     TTFGetSize(font, text, &width, &height);
 
-    _ttfGetWidthCacheMissCount++;
+    auto it = _ttfGetWidthCache.emplace(
+        std::piecewise_construct, std::forward_as_tuple(hash),
+        std::forward_as_tuple(static_cast<uint32_t>(width), font, text));
+    _ttfGetWidthCacheMemory += TTFGetWidthCacheEntryMemory(it->second);
 
-    _ttfGetWidthCacheCount++;
-    entry->width = width;
-    entry->font = font;
-    entry->text = text;
-    entry->lastUseTick = gCurrentDrawCount;
-    return entry->width;
+    TTFCacheEvict(
+        _ttfGetWidthCache, _ttfGetWidthCacheMemory, kTTFGetWidthCacheMemoryBudget, TTFGetWidthCacheEntryMemory,
+        [](ttf_getwidth_cache_entry&) {});
+    return width;
 }
 
 TTFFontDescriptor* TTFGetFontFromSpriteBase(FontStyle fontStyle)
 {
-    FontLockHelper<std::mutex> lock(_mutex);
+    FontSharedLockHelper<std::shared_mutex> lock(_mutex);
     return &gCurrentTTFFontSet->size[EnumValue(fontStyle)];
 }
 
@@ -385,4 +447,9 @@ void TTFDispose()
 {
 }
 
+size_t TTFGetMemoryUsage()
+{
+    return 0;
+}
+
 #endif // NO_TTF
@@ -15,6 +15,7 @@
 
 bool TTFInitialise();
 void TTFDispose();
+size_t TTFGetMemoryUsage();
 struct TTFSurface;
 
 #ifndef NO_TTF
@@ -42,6 +43,7 @@ TTFSurface* TTF_RenderUTF8(TTF_Font* font, const char* text, bool shaded);
 void TTF_CloseFont(TTF_Font* font);
 void TTF_SetFontHinting(TTF_Font* font, int hinting);
 int TTF_GetFontHinting(const TTF_Font* font);
+size_t TTF_GetGlyphCacheMemoryUsage(const TTF_Font* font);
 void TTF_Quit(void);
 
 #endif // NO_TTF
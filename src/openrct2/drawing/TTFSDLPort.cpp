@@ -41,6 +41,8 @@ misrepresented as being the original software.
 #    include <stdio.h>
 #    include <stdlib.h>
 #    include <string.h>
+#    include <unordered_map>
+#    include <vector>
 
 #    pragma clang diagnostic push
 #    pragma clang diagnostic ignored "-Wdocumentation"
@@ -99,7 +101,18 @@ struct c_glyph
     int maxy;
     int yoffset;
     int advance;
-    uint16_t cached;
+    uint32_t lastUse;
+};
+
+/* Glyphs of one font, evicted least recently used first once their bitmaps take more than
+ * kGlyphCacheMemoryBudget. This keeps every glyph of a CJK string cached, unlike a fixed table. */
+static constexpr size_t kGlyphCacheMemoryBudget = 2 * 1024 * 1024;
+
+struct GlyphCache
+{
+    std::unordered_map<uint16_t, c_glyph> Glyphs;
+    size_t Memory{};
+    uint32_t UseCounter{};
 };
 
 /* The structure used to hold internal font information */
@@ -132,7 +145,7 @@ struct InternalTTFFont
 
     /* Cache for style-transformed glyphs */
     c_glyph* current;
-    c_glyph cache[257]; /* 257 is a prime */
+    GlyphCache* cache;
 
     /* We are responsible for closing the font stream */
     FILE* src;
@@ -402,6 +415,7 @@ static TTF_Font* TTF_OpenFontIndexRW(FILE* src, int freesrc, int ptsize, long in
 
     font->src = src;
     font->freesrc = freesrc;
+    font->cache = new GlyphCache();
 
     stream = static_cast<FT_Stream>(malloc(sizeof(*stream)));
     if (stream == NULL)
@@ -560,21 +574,71 @@ static void Flush_Glyph(c_glyph* glyph)
         free(glyph->pixmap.buffer);
         glyph->pixmap.buffer = 0;
     }
-    glyph->cached = 0;
+}
+
+static size_t Glyph_Memory(const c_glyph* glyph)
+{
+    /* Roughly what a node of the map costs on top of the glyph itself */
+    size_t memory = sizeof(c_glyph) + 4 * sizeof(void*);
+    if (glyph->bitmap.buffer != nullptr)
+    {
+        memory += static_cast<size_t>(glyph->bitmap.pitch) * glyph->bitmap.rows;
+    }
+    if (glyph->pixmap.buffer != nullptr)
+    {
+        memory += static_cast<size_t>(glyph->pixmap.pitch) * glyph->pixmap.rows;
+    }
+    return memory;
 }
 
 static void Flush_Cache(TTF_Font* font)
 {
-    int i;
-    int size = sizeof(font->cache) / sizeof(font->cache[0]);
+    if (font->cache == nullptr)
+    {
+        return;
+    }
+    for (auto& [ch, glyph] : font->cache->Glyphs)
+    {
+        Flush_Glyph(&glyph);
+    }
+    font->cache->Glyphs.clear();
+    font->cache->Memory = 0;
+    font->current = nullptr;
+}
 
-    for (i = 0; i < size; ++i)
+/* Drops the least recently used glyphs, apart from the current one, until the cache is back
+ * under three quarters of its budget. */
+static void Evict_Glyphs(TTF_Font* font)
+{
+    auto& cache = *font->cache;
+    if (cache.Memory <= kGlyphCacheMemoryBudget)
     {
-        if (font->cache[i].cached)
+        return;
+    }
+
+    std::vector<std::pair<uint32_t, uint16_t>> candidates;
+    candidates.reserve(cache.Glyphs.size());
+    for (const auto& [ch, glyph] : cache.Glyphs)
+    {
+        if (&glyph != font->current)
         {
-            Flush_Glyph(&font->cache[i]);
+            candidates.emplace_back(cache.UseCounter - glyph.lastUse, ch);
         }
     }
+    std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+
+    const size_t target = kGlyphCacheMemoryBudget / 4 * 3;
+    for (const auto& [age, ch] : candidates)
+    {
+        if (cache.Memory <= target)
+        {
+            break;
+        }
+        auto it = cache.Glyphs.find(ch);
+        cache.Memory -= Glyph_Memory(&it->second);
+        Flush_Glyph(&it->second);
+        cache.Glyphs.erase(it);
+    }
 }
 
 static FT_Error Load_Glyph(TTF_Font* font, uint16_t ch, c_glyph* cached, int want)
@@ -961,26 +1025,24 @@ static FT_Error Load_Glyph(TTF_Font* font, uint16_t ch, c_glyph* cached, int wan
         }
     }
 
-    /* We're done, mark this glyph cached */
-    cached->cached = ch;
-
     return 0;
 }
 
 static FT_Error Find_Glyph(TTF_Font* font, uint16_t ch, int want)
 {
     int retval = 0;
-    int hsize = sizeof(font->cache) / sizeof(font->cache[0]);
+    auto& cache = *font->cache;
 
-    int h = ch % hsize;
-    font->current = &font->cache[h];
-
-    if (font->current->cached != ch)
-        Flush_Glyph(font->current);
+    /* Pointers to map elements stay valid while other glyphs are added */
+    font->current = &cache.Glyphs.try_emplace(ch).first->second;
+    font->current->lastUse = ++cache.UseCounter;
 
     if ((font->current->stored & want) != want)
     {
+        size_t memoryBefore = Glyph_Memory(font->current);
         retval = Load_Glyph(font, ch, font->current, want);
+        cache.Memory += Glyph_Memory(font->current) - memoryBefore;
+        Evict_Glyphs(font);
     }
     return retval;
 }
@@ -990,6 +1052,7 @@ void TTF_CloseFont(TTF_Font* font)
     if (font)
     {
         Flush_Cache(font);
+        delete font->cache;
         if (font->face)
         {
             FT_Done_Face(font->face);
@@ -1416,6 +1479,11 @@ void TTF_SetFontHinting(TTF_Font* font, int hinting)
     Flush_Cache(font);
 }
 
+size_t TTF_GetGlyphCacheMemoryUsage(const TTF_Font* font)
+{
+    return font->cache != nullptr ? font->cache->Memory : 0;
+}
+
 int TTF_GetFontHinting(const TTF_Font* font)
 {
     if (font->hinting == FT_LOAD_TARGET_ALT(FT_RENDER_MODE_LIGHT))
@@ -9,11 +9,165 @@
 
 #include "Text.h"
 
+#include "../OpenRCT2.h"
+#include "../config/Config.h"
+#include "../localisation/Currency.h"
 #include "../localisation/Formatter.h"
 #include "../localisation/Formatting.h"
 #include "../localisation/Localisation.h"
 #include "Drawing.h"
 
+#include <array>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+using namespace OpenRCT2;
+
+namespace
+{
+    // Labels with more argument bytes than this are rare and are formatted every time
+    constexpr size_t kFormattedTextMaxArgsSize = 32;
+    constexpr size_t kFormattedTextCacheMaxEntries = 2048;
+
+    struct FormattedTextKey
+    {
+        StringId Format{};
+        FontStyle Style{};
+        uint8_t ArgsSize{};
+        std::array<uint8_t, kFormattedTextMaxArgsSize> Args{};
+
+        bool operator==(const FormattedTextKey& other) const
+        {
+            return Format == other.Format && Style == other.Style && ArgsSize == other.ArgsSize
+                && std::memcmp(Args.data(), other.Args.data(), ArgsSize) == 0;
+        }
+    };
+
+    struct FormattedTextKeyHash
+    {
+        size_t operator()(const FormattedTextKey& key) const
+        {
+            // FNV-1a
+            uint32_t hash = 2166136261u;
+            auto mix = [&hash](uint8_t b) {
+                hash ^= b;
+                hash *= 16777619u;
+            };
+            mix(static_cast<uint8_t>(key.Format));
+            mix(static_cast<uint8_t>(key.Format >> 8));
+            mix(static_cast<uint8_t>(key.Style));
+            for (size_t i = 0; i < key.ArgsSize; i++)
+            {
+                mix(key.Args[i]);
+            }
+            return hash;
+        }
+    };
+
+    struct FormattedText
+    {
+        std::string Text;
+        int32_t Width{};
+        uint32_t LastUseTick{};
+    };
+
+    // The configuration that formatting reads, a change of any of these makes every cached string stale
+    struct FormattedTextSettings
+    {
+        CurrencyType Currency{};
+        MeasurementFormat Measurement{};
+        int32_t CustomCurrencyRate{};
+        CurrencyAffix CustomCurrencyAffix{};
+        std::string CustomCurrencySymbol;
+
+        static FormattedTextSettings GetCurrent()
+        {
+            const auto& customCurrency = CurrencyDescriptors[EnumValue(CurrencyType::Custom)];
+            return { gConfigGeneral.CurrencyFormat, gConfigGeneral.MeasurementFormat, customCurrency.rate,
+                     customCurrency.affix_unicode, customCurrency.symbol_unicode };
+        }
+
+        bool operator==(const FormattedTextSettings& other) const = default;
+    };
+} // namespace
+
+static std::mutex _formattedTextMutex;
+static std::unordered_map<FormattedTextKey, FormattedText, FormattedTextKeyHash> _formattedTextCache;
+static FormattedTextSettings _formattedTextSettings;
+
+void FormattedTextCacheInvalidate()
+{
+    std::lock_guard<std::mutex> lock(_formattedTextMutex);
+    _formattedTextCache.clear();
+}
+
+static void FormattedTextCacheEvict()
+{
+    // Drop everything that was not drawn in the last few frames, or everything if all of it is in use
+    for (auto it = _formattedTextCache.begin(); it != _formattedTextCache.end();)
+    {
+        if (gCurrentDrawCount - it->second.LastUseTick > 8)
+            it = _formattedTextCache.erase(it);
+        else
+            ++it;
+    }
+    if (_formattedTextCache.size() >= kFormattedTextCacheMaxEntries)
+    {
+        _formattedTextCache.clear();
+    }
+}
+
+/**
+ * Formats a string into the buffer and returns its width in the given font style. Labels are redrawn every frame with
+ * mostly the same arguments, so the result is cached by the string id and the bytes of the arguments it reads.
+ */
+static int32_t FormatStringCached(utf8* buffer, size_t bufferLen, StringId format, const Formatter& ft, FontStyle fontStyle)
+{
+    size_t argsSize{};
+    if (!FormatStringLegacyGetArgsSize(format, ft.Data(), argsSize) || argsSize > kFormattedTextMaxArgsSize)
+    {
+        FormatStringLegacy(buffer, bufferLen, format, ft.Data());
+        return GfxGetStringWidth(buffer, fontStyle);
+    }
+
+    FormattedTextKey key;
+    key.Format = format;
+    key.Style = fontStyle;
+    key.ArgsSize = static_cast<uint8_t>(argsSize);
+    std::memcpy(key.Args.data(), ft.Data(), argsSize);
+
+    {
+        std::lock_guard<std::mutex> lock(_formattedTextMutex);
+        auto settings = FormattedTextSettings::GetCurrent();
+        if (!(settings == _formattedTextSettings))
+        {
+            _formattedTextSettings = std::move(settings);
+            _formattedTextCache.clear();
+        }
+
+        auto it = _formattedTextCache.find(key);
+        if (it != _formattedTextCache.end())
+        {
+            it->second.LastUseTick = gCurrentDrawCount;
+            String::Set(buffer, bufferLen, it->second.Text.c_str());
+            return it->second.Width;
+        }
+    }
+
+    FormatStringLegacy(buffer, bufferLen, format, ft.Data());
+    auto width = GfxGetStringWidth(buffer, fontStyle);
+
+    std::lock_guard<std::mutex> lock(_formattedTextMutex);
+    if (_formattedTextCache.size() >= kFormattedTextCacheMaxEntries)
+    {
+        FormattedTextCacheEvict();
+    }
+    _formattedTextCache.insert_or_assign(key, FormattedText{ buffer, width, gCurrentDrawCount });
+    return width;
+}
+
 class StaticLayout
 {
 private:
@@ -74,12 +228,10 @@ public:
     }
 };
 
-void DrawText(
-    DrawPixelInfo& dpi, const ScreenCoordsXY& coords, const TextPaint& paint, const_utf8string text, bool noFormatting)
+static void DrawText(
+    DrawPixelInfo& dpi, const ScreenCoordsXY& coords, const TextPaint& paint, const_utf8string text, bool noFormatting,
+    int32_t width)
 {
-    int32_t width = noFormatting ? GfxGetStringWidthNoFormatting(text, paint.FontStyle)
-                                 : GfxGetStringWidth(text, paint.FontStyle);
-
     auto alignedCoords = coords;
     switch (paint.Alignment)
     {
@@ -109,6 +261,14 @@ void DrawText(
     }
 }
 
+void DrawText(
+    DrawPixelInfo& dpi, const ScreenCoordsXY& coords, const TextPaint& paint, const_utf8string text, bool noFormatting)
+{
+    int32_t width = noFormatting ? GfxGetStringWidthNoFormatting(text, paint.FontStyle)
+                                 : GfxGetStringWidth(text, paint.FontStyle);
+    DrawText(dpi, coords, paint, text, noFormatting, width);
+}
+
 void DrawTextBasic(DrawPixelInfo& dpi, const ScreenCoordsXY& coords, StringId format)
 {
     Formatter ft{};
@@ -119,8 +279,8 @@ void DrawTextBasic(DrawPixelInfo& dpi, const ScreenCoordsXY& coords, StringId fo
 void DrawTextBasic(DrawPixelInfo& dpi, const ScreenCoordsXY& coords, StringId format, const Formatter& ft, TextPaint textPaint)
 {
     utf8 buffer[512];
-    OpenRCT2::FormatStringLegacy(buffer, sizeof(buffer), format, ft.Data());
-    DrawText(dpi, coords, textPaint, buffer);
+    auto width = FormatStringCached(buffer, sizeof(buffer), format, ft, textPaint.FontStyle);
+    DrawText(dpi, coords, textPaint, buffer, false, width);
 }
 
 void DrawTextEllipsised(DrawPixelInfo& dpi, const ScreenCoordsXY& coords, int32_t width, StringId format)
@@ -134,10 +294,16 @@ void DrawTextEllipsised(
     DrawPixelInfo& dpi, const ScreenCoordsXY& coords, int32_t width, StringId format, const Formatter& ft, TextPaint textPaint)
 {
     utf8 buffer[512];
-    OpenRCT2::FormatStringLegacy(buffer, sizeof(buffer), format, ft.Data());
-    GfxClipString(buffer, width, textPaint.FontStyle);
+    auto textWidth = FormatStringCached(buffer, sizeof(buffer), format, ft, textPaint.FontStyle);
+    if (textWidth > width || width < 6)
+    {
+        // Only text that does not fit needs to be clipped and measured again
+        GfxClipString(buffer, width, textPaint.FontStyle);
+        DrawText(dpi, coords, textPaint, buffer);
+        return;
+    }
 
-    DrawText(dpi, coords, textPaint, buffer);
+    DrawText(dpi, coords, textPaint, buffer, false, textWidth);
 }
 
 void GfxDrawString(DrawPixelInfo& dpi, const ScreenCoordsXY& coords, const_utf8string buffer, TextPaint textPaint)
@@ -156,3 +156,5 @@ void DrawTextEllipsised(
 int32_t DrawTextWrapped(
     DrawPixelInfo& dpi, const ScreenCoordsXY& coords, int32_t width, StringId format, const Formatter& ft,
     TextPaint textPaint = {});
+
+void FormattedTextCacheInvalidate();
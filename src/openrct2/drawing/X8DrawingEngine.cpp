@@ -31,16 +31,6 @@ using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 using namespace OpenRCT2::Ui;
 
-X8WeatherDrawer::X8WeatherDrawer()
-{
-    _weatherPixels = new WeatherPixel[_weatherPixelsCapacity];
-}
-
-X8WeatherDrawer::~X8WeatherDrawer()
-{
-    delete[] _weatherPixels;
-}
-
 void X8WeatherDrawer::Draw(
     DrawPixelInfo& dpi, int32_t x, int32_t y, int32_t width, int32_t height, int32_t xStart, int32_t yStart,
     const uint8_t* weatherpattern)
@@ -50,65 +40,52 @@ void X8WeatherDrawer::Draw(
     auto patternYSpace = *pattern++;
 
     uint8_t patternStartXOffset = xStart % patternXSpace;
-    uint8_t patternStartYOffset = yStart % patternYSpace;
-
-    uint32_t pixelOffset = (dpi.pitch + dpi.width) * y + x;
-    uint8_t patternYPos = patternStartYOffset % patternYSpace;
+    uint8_t patternStartYOffset = (static_cast<uint8_t>(yStart % patternYSpace)) % patternYSpace;
 
+    const uint32_t rowSize = dpi.pitch + dpi.width;
     uint8_t* screenBits = dpi.bits;
 
-    // Stores the colours of changed pixels
-    WeatherPixel* newPixels = &_weatherPixels[_weatherPixelsCount];
-    for (; height != 0; height--)
+    // Patterns only have a few rows with pixels, each of them is visited directly rather than every row of the area
+    for (uint32_t patternYPos = 0; patternYPos < patternYSpace; patternYPos++)
     {
         auto patternX = pattern[patternYPos * 2];
-        if (patternX != 0xFF)
+        if (patternX == 0xFF)
         {
-            if (_weatherPixelsCount < (_weatherPixelsCapacity - static_cast<uint32_t>(width)))
-            {
-                uint32_t finalPixelOffset = width + pixelOffset;
-
-                uint32_t xPixelOffset = pixelOffset;
-                xPixelOffset += (static_cast<uint8_t>(patternX - patternStartXOffset)) % patternXSpace;
-
-                auto patternPixel = pattern[patternYPos * 2 + 1];
-                for (; xPixelOffset < finalPixelOffset; xPixelOffset += patternXSpace)
-                {
-                    uint8_t current_pixel = screenBits[xPixelOffset];
-                    screenBits[xPixelOffset] = patternPixel;
-                    _weatherPixelsCount++;
+            continue;
+        }
 
-                    // Store colour and position
-                    *newPixels++ = { xPixelOffset, current_pixel };
-                }
+        auto patternPixel = pattern[patternYPos * 2 + 1];
+        auto xOffset = (static_cast<uint8_t>(patternX - patternStartXOffset)) % patternXSpace;
+        auto firstRow = (patternYPos + patternYSpace - patternStartYOffset) % patternYSpace;
+        for (int32_t row = firstRow; row < height; row += patternYSpace)
+        {
+            uint32_t pixelOffset = rowSize * (y + row) + x;
+            uint32_t finalPixelOffset = pixelOffset + width;
+            for (uint32_t xPixelOffset = pixelOffset + xOffset; xPixelOffset < finalPixelOffset;
+                 xPixelOffset += patternXSpace)
+            {
+                // Store colour and position
+                _weatherPixels.push_back({ xPixelOffset, screenBits[xPixelOffset] });
+                screenBits[xPixelOffset] = patternPixel;
             }
         }
-
-        pixelOffset += dpi.pitch + dpi.width;
-        patternYPos++;
-        patternYPos %= patternYSpace;
     }
 }
 
 void X8WeatherDrawer::Restore(DrawPixelInfo& dpi)
 {
-    if (_weatherPixelsCount > 0)
+    // Restored in reverse, where weather layers overlap the pixel has to end up with what was there before the first
+    uint32_t numPixels = (dpi.width + dpi.pitch) * dpi.height;
+    uint8_t* bits = dpi.bits;
+    for (auto it = _weatherPixels.rbegin(); it != _weatherPixels.rend(); it++)
     {
-        uint32_t numPixels = (dpi.width + dpi.pitch) * dpi.height;
-        uint8_t* bits = dpi.bits;
-        for (uint32_t i = 0; i < _weatherPixelsCount; i++)
+        // Pixels out of bounds are left, the screen has been resized since
+        if (it->Position < numPixels)
         {
-            WeatherPixel weatherPixel = _weatherPixels[i];
-            if (weatherPixel.Position >= numPixels)
-            {
-                // Pixel out of bounds, bail
-                break;
-            }
-
-            bits[weatherPixel.Position] = weatherPixel.Colour;
+            bits[it->Position] = it->Colour;
         }
-        _weatherPixelsCount = 0;
     }
+    _weatherPixels.clear();
 }
 
 #ifdef __WARN_SUGGEST_FINAL_METHODS__
@@ -272,7 +249,7 @@ DrawPixelInfo* X8DrawingEngine::GetDrawingPixelInfo()
 
 DRAWING_ENGINE_FLAGS X8DrawingEngine::GetFlags()
 {
-    return static_cast<DRAWING_ENGINE_FLAGS>(DEF_DIRTY_OPTIMISATIONS | DEF_PARALLEL_DRAWING);
+    return static_cast<DRAWING_ENGINE_FLAGS>(DEF_DIRTY_OPTIMISATIONS | DEF_PARALLEL_DRAWING | DEF_PIXEL_BUFFER);
 }
 
 void X8DrawingEngine::InvalidateImage([[maybe_unused]] uint32_t image)
@@ -280,6 +257,11 @@ void X8DrawingEngine::InvalidateImage([[maybe_unused]] uint32_t image)
     // Not applicable for this engine
 }
 
+size_t X8DrawingEngine::GetMemoryUsage()
+{
+    return _bitsSize + static_cast<size_t>(_dirtyGrid.BlockColumns) * _dirtyGrid.BlockRows;
+}
+
 DrawPixelInfo* X8DrawingEngine::GetDPI()
 {
     return &_bitsDPI;
@@ -362,24 +344,22 @@ void X8DrawingEngine::ConfigureDirtyGrid()
 
 void X8DrawingEngine::DrawAllDirtyBlocks()
 {
-    // TODO: For optimal performance it is currently limited to a single column.
-    // The optimal approach would be to extract all dirty regions as rectangles not including
-    // parts that are not marked dirty and have the grid more fine grained.
-    // A situation like following:
+    // Dirty blocks are drawn as rectangles that only contain dirty blocks. The first column of a region
+    // determines the rows, then the region is widened for as long as the same rows are dirty in the next
+    // column. A situation like following:
     //
     //   0 1 2 3 4 5 6 7 8 9
     //   1 - - - - - - - - -
     //   2 - x x x x - - - -
     //   3 - x x - - - - - -
     //   4 - - - - - - - - -
-    //   5 - - - - - - - - -
-    //   6 - - - - - - - - -
-    //   7 - - - - - - - - -
-    //   8 - - - - - - - - -
-    //   9 - - - - - - - - -
     //
-    // Would currently redraw {2,2} to {3,5} where {3,4} and {3,5} are not dirty. Choosing to do this
-    // per column eliminates this issue but limits it to rendering just a single column at a time.
+    // Is drawn as {1,2} to {2,3} and {3,2} to {4,2}. Every region results in all the overlapping windows
+    // being drawn, so fewer and wider regions also give the viewport rendering more columns to spread
+    // over the paint threads.
+    //
+    // The regions themselves are drawn one after another, window drawing runs the window events which
+    // are not safe to call from multiple threads.
 
     for (uint32_t x = 0; x < _dirtyGrid.BlockColumns; x++)
     {
@@ -391,11 +371,8 @@ void X8DrawingEngine::DrawAllDirtyBlocks()
                 continue;
             }
 
-            // See comment above as to why this is 1.
-            const uint32_t columns = 1;
-
-            // Check rows
-            auto rows = GetNumDirtyRows(x, y, columns);
+            auto rows = GetNumDirtyRows(x, y, 1);
+            auto columns = GetNumDirtyColumns(x, y, rows);
             DrawDirtyBlocks(x, y, columns, rows);
         }
     }
@@ -419,6 +396,23 @@ uint32_t X8DrawingEngine::GetNumDirtyRows(const uint32_t x, const uint32_t y, co
     return yy - y;
 }
 
+uint32_t X8DrawingEngine::GetNumDirtyColumns(const uint32_t x, const uint32_t y, const uint32_t rows)
+{
+    uint32_t xx = x;
+
+    for (xx = x; xx < _dirtyGrid.BlockColumns; xx++)
+    {
+        for (uint32_t yy = y; yy < y + rows; yy++)
+        {
+            if (_dirtyGrid.Blocks[yy * _dirtyGrid.BlockColumns + xx] == 0)
+            {
+                return xx - x;
+            }
+        }
+    }
+    return xx - x;
+}
+
 void X8DrawingEngine::DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows)
 {
     uint32_t dirtyBlockColumns = _dirtyGrid.BlockColumns;
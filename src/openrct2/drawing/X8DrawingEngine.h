@@ -13,6 +13,7 @@
 #include "IDrawingEngine.h"
 
 #include <memory>
+#include <vector>
 
 namespace OpenRCT2
 {
@@ -45,15 +46,10 @@ namespace OpenRCT2
                 uint8_t Colour;
             };
 
-            static constexpr uint32_t MaxWeatherPixels = 0xFFFE;
-
-            size_t _weatherPixelsCapacity = MaxWeatherPixels;
-            uint32_t _weatherPixelsCount = 0;
-            WeatherPixel* _weatherPixels = nullptr;
+            // What was underneath the drawn weather, restored before the next frame is drawn
+            std::vector<WeatherPixel> _weatherPixels;
 
         public:
-            X8WeatherDrawer();
-            ~X8WeatherDrawer();
             void Draw(
                 DrawPixelInfo& dpi, int32_t x, int32_t y, int32_t width, int32_t height, int32_t xStart, int32_t yStart,
                 const uint8_t* weatherpattern) override;
@@ -110,6 +106,7 @@ namespace OpenRCT2
             DrawPixelInfo* GetDrawingPixelInfo() override;
             DRAWING_ENGINE_FLAGS GetFlags() override;
             void InvalidateImage(uint32_t image) override;
+            size_t GetMemoryUsage() override;
 
             DrawPixelInfo* GetDPI();
 
@@ -121,6 +118,7 @@ namespace OpenRCT2
             void ConfigureDirtyGrid();
             void DrawAllDirtyBlocks();
             uint32_t GetNumDirtyRows(const uint32_t x, const uint32_t y, const uint32_t columns);
+            uint32_t GetNumDirtyColumns(const uint32_t x, const uint32_t y, const uint32_t rows);
             void DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows);
         };
 #ifdef __WARN_SUGGEST_FINAL_TYPES__
@@ -9,7 +9,9 @@
 
 #include "EntityBase.h"
 
+#include "../OpenRCT2.h"
 #include "../core/DataSerialiser.h"
+#include "GuestHotFields.h"
 
 // Required for GetEntity to return a default
 template<> bool EntityBase::Is<EntityBase>() const
@@ -27,11 +29,12 @@ void EntityBase::SetLocation(const CoordsXYZ& newLocation)
     x = newLocation.x;
     y = newLocation.y;
     z = newLocation.z;
+    GuestHotFieldsUpdate(*this);
 }
 
 void EntityBase::Invalidate()
 {
-    if (x == LOCATION_NULL)
+    if (x == LOCATION_NULL || !OpenRCT2HasPresentation())
         return;
 
     ZoomLevel maxZoom{ 0 };
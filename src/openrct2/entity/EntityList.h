@@ -13,17 +13,53 @@
 #include "../rct12/RCT12.h"
 #include "../world/Location.hpp"
 #include "EntityBase.h"
+#include "EntityListCursor.h"
 #include "EntityRegistry.h"
 
-#include <list>
+#include <type_traits>
 #include <vector>
 
-const std::list<EntityId>& GetEntityList(const EntityType id);
+struct Vehicle;
+
+const std::vector<EntityId>& GetEntityList(const EntityType id);
 
 uint16_t GetEntityListCount(EntityType list);
+// Changes whenever an entity is added to or removed from the list of the type, lets aggregates over a type be kept
+// until the list changes.
+uint32_t GetEntityListVersion(EntityType list);
 uint16_t GetMiscEntityCount();
 uint16_t GetNumFreeEntities();
+// Bytes used by the entity storage and its type lists, and separately by the spatial index chunks.
+size_t GetEntityMemoryUsage();
+size_t GetEntitySpatialIndexMemoryUsage();
 const std::vector<EntityId>& GetEntityTileList(const CoordsXY& spritePos);
+const std::vector<EntityId>& GetVehicleTileList(const CoordsXY& spritePos);
+// Gets a z range covering every entity on the tile, it may be wider than needed but not narrower. Returns false if there
+// are no entities on the tile.
+bool GetEntityTileHeights(const CoordsXY& spritePos, int32_t& minZ, int32_t& maxZ);
+// Returns false if no entity of the type can be on the tiles covered by the range, counted per spatial chunk so a true
+// result only means there may be one.
+bool AnyEntitiesInRange(const MapRange& range, EntityType type);
+// Appends the ids of all entities on the tiles covered by the range, tile by tile in x then y order.
+void GetEntityIdsInRange(const MapRange& range, std::vector<EntityId>& result);
+
+template<typename T = EntityBase> std::vector<T*> GetEntitiesInRange(const MapRange& range)
+{
+    std::vector<EntityId> ids;
+    GetEntityIdsInRange(range, ids);
+
+    std::vector<T*> result;
+    result.reserve(ids.size());
+    for (auto id : ids)
+    {
+        auto* entity = GetEntity<T>(id);
+        if (entity != nullptr)
+        {
+            result.push_back(entity);
+        }
+    }
+    return result;
+}
 
 template<typename T> class EntityTileIterator
 {
@@ -82,8 +118,9 @@ private:
     const std::vector<EntityId>& vec;
 
 public:
+    // Vehicles have their own tile lists, in the same order as they appear in the full ones
     EntityTileList(const CoordsXY& loc)
-        : vec(GetEntityTileList(loc))
+        : vec(std::is_same_v<T, Vehicle> ? GetVehicleTileList(loc) : GetEntityTileList(loc))
     {
     }
 
@@ -100,14 +137,12 @@ public:
 template<typename T> class EntityListIterator
 {
 private:
-    std::list<EntityId>::const_iterator iter;
-    std::list<EntityId>::const_iterator end;
+    EntityListCursor cursor;
     T* Entity = nullptr;
 
 public:
-    EntityListIterator(std::list<EntityId>::const_iterator _iter, std::list<EntityId>::const_iterator _end)
-        : iter(_iter)
-        , end(_end)
+    EntityListIterator(const std::vector<EntityId>& list, bool atEnd)
+        : cursor(list, atEnd)
     {
         ++(*this);
     }
@@ -115,9 +150,9 @@ public:
     {
         Entity = nullptr;
 
-        while (iter != end && Entity == nullptr)
+        while (!cursor.AtEnd() && Entity == nullptr)
         {
-            Entity = GetEntity<T>(*iter++);
+            Entity = GetEntity<T>(cursor.Next());
         }
         return *this;
     }
@@ -126,7 +161,7 @@ public:
     {
         EntityListIterator retval = *this;
         ++(*this);
-        return *iter;
+        return retval;
     }
     bool operator==(EntityListIterator other) const
     {
@@ -152,7 +187,7 @@ template<typename T = EntityBase> class EntityList
 {
 private:
     using EntityListIterator_t = EntityListIterator<T>;
-    const std::list<EntityId>& vec;
+    const std::vector<EntityId>& vec;
 
 public:
     EntityList()
@@ -162,10 +197,10 @@ public:
 
     EntityListIterator_t begin() const
     {
-        return EntityListIterator_t(std::cbegin(vec), std::cend(vec));
+        return EntityListIterator_t(vec, false);
     }
     EntityListIterator_t end() const
     {
-        return EntityListIterator_t(std::cend(vec), std::cend(vec));
+        return EntityListIterator_t(vec, true);
     }
 };
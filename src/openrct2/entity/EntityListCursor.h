@@ -0,0 +1,61 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../Identifiers.h"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * Walks a sorted entity id list by id instead of by position. Entities are commonly created and removed while their
+ * list is being iterated, which moves the elements of the vector around. The cursor remembers which id comes next at
+ * the time an element is visited and resumes from there, so iteration behaves the same as it did with a linked list:
+ * removing the current entity is safe and entities inserted behind the next one are only seen if they sort after it.
+ */
+class EntityListCursor
+{
+private:
+    const std::vector<EntityId>* _list;
+    size_t _position;
+    EntityId _next;
+
+public:
+    EntityListCursor(const std::vector<EntityId>& list, bool atEnd)
+        : _list(&list)
+        , _position(0)
+        , _next(atEnd || list.empty() ? EntityId::GetNull() : list.front())
+    {
+    }
+
+    bool AtEnd() const
+    {
+        return _next.IsNull();
+    }
+
+    EntityId Next()
+    {
+        const auto& list = *_list;
+        // Only search if the list changed since the previous step.
+        if (_position >= list.size() || list[_position] != _next)
+        {
+            _position = std::lower_bound(list.begin(), list.end(), _next) - list.begin();
+        }
+        if (_position >= list.size())
+        {
+            _next = EntityId::GetNull();
+            return EntityId::GetNull();
+        }
+
+        const auto current = list[_position++];
+        _next = _position < list.size() ? list[_position] : EntityId::GetNull();
+        return current;
+    }
+};
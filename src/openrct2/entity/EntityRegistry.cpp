@@ -18,6 +18,7 @@
 #include "../core/Guard.hpp"
 #include "../core/MemoryStream.h"
 #include "../entity/Peep.h"
+#include "../entity/PeepStringCache.h"
 #include "../entity/Staff.h"
 #include "../interface/Viewport.h"
 #include "../peep/RideUseSystem.h"
@@ -27,43 +28,90 @@
 #include "Balloon.h"
 #include "Duck.h"
 #include "EntityTweener.h"
+#include "GuestHotFields.h"
 #include "Fountain.h"
+#include "Litter.h"
 #include "MoneyEffect.h"
 #include "Particle.h"
 
 #include <algorithm>
 #include <cmath>
 #include <iterator>
+#include <memory>
 #include <numeric>
+#include <optional>
 #include <vector>
 
 using namespace OpenRCT2;
 
-static std::array<std::list<EntityId>, EnumValue(EntityType::Count)> gEntityLists;
-static std::vector<EntityId> _freeIdList;
+static const std::vector<EntityId> kEntitySpatialEmpty;
 
-static bool _entityFlashingList[MAX_ENTITIES];
-
-constexpr const uint32_t SPATIAL_INDEX_SIZE = (kMaximumMapSizeTechnical * kMaximumMapSizeTechnical) + 1;
-constexpr uint32_t SPATIAL_INDEX_LOCATION_NULL = SPATIAL_INDEX_SIZE - 1;
-
-static std::array<std::vector<EntityId>, SPATIAL_INDEX_SIZE> gEntitySpatialIndex;
+// Not part of the game state, it only has to differ from what was seen before whenever a list changes
+static std::array<uint32_t, EnumValue(EntityType::Count)> _entityListVersions{};
 
 static void FreeEntity(EntityBase& entity);
 
-static constexpr size_t GetSpatialIndexOffset(const CoordsXY& loc)
+static EntityRegistryState& GetEntityRegistry()
+{
+    return GetGameState().EntityRegistry;
+}
+
+static constexpr std::optional<TileCoordsXY> GetSpatialIndexTile(const CoordsXY& loc)
 {
     if (loc.IsNull())
-        return SPATIAL_INDEX_LOCATION_NULL;
+        return std::nullopt;
 
     // NOTE: The input coordinate is rotated and can have negative components.
     const auto tileX = std::abs(loc.x) / COORDS_XY_STEP;
     const auto tileY = std::abs(loc.y) / COORDS_XY_STEP;
 
     if (tileX >= kMaximumMapSizeTechnical || tileY >= kMaximumMapSizeTechnical)
-        return SPATIAL_INDEX_LOCATION_NULL;
+        return std::nullopt;
+
+    return TileCoordsXY{ tileX, tileY };
+}
+
+static constexpr size_t GetSpatialChunkIndex(const TileCoordsXY& tile)
+{
+    return (tile.x / kSpatialChunkSize) * kSpatialChunksPerSide + (tile.y / kSpatialChunkSize);
+}
+
+static constexpr size_t GetSpatialChunkTileIndex(const TileCoordsXY& tile)
+{
+    return (tile.x % kSpatialChunkSize) * kSpatialChunkSize + (tile.y % kSpatialChunkSize);
+}
+
+static std::vector<EntityId>& GetOrCreateSpatialList(const CoordsXY& loc)
+{
+    auto& registry = GetEntityRegistry();
+    const auto tile = GetSpatialIndexTile(loc);
+    if (!tile.has_value())
+        return registry.SpatialNull;
+
+    auto& chunk = registry.SpatialChunks[GetSpatialChunkIndex(*tile)];
+    if (chunk == nullptr)
+    {
+        chunk = std::make_unique<EntitySpatialChunk>();
+    }
+    return chunk->Tiles[GetSpatialChunkTileIndex(*tile)];
+}
+
+static std::vector<EntityId>& GetOrCreateVehicleSpatialList(const CoordsXY& loc)
+{
+    auto& registry = GetEntityRegistry();
+    const auto tile = GetSpatialIndexTile(loc);
+    if (!tile.has_value())
+        return registry.VehicleSpatialNull;
+
+    // The chunk was already created when the entity was added to the full list
+    return registry.SpatialChunks[GetSpatialChunkIndex(*tile)]->VehicleTiles[GetSpatialChunkTileIndex(*tile)];
+}
 
-    return tileX * kMaximumMapSizeTechnical + tileY;
+static EntitySpatialChunk* GetSpatialChunk(const std::optional<TileCoordsXY>& tile)
+{
+    if (!tile.has_value())
+        return nullptr;
+    return GetEntityRegistry().SpatialChunks[GetSpatialChunkIndex(*tile)].get();
 }
 
 constexpr bool EntityTypeIsMiscEntity(const EntityType type)
@@ -87,12 +135,52 @@ constexpr bool EntityTypeIsMiscEntity(const EntityType type)
 
 uint16_t GetEntityListCount(EntityType type)
 {
-    return static_cast<uint16_t>(gEntityLists[EnumValue(type)].size());
+    return static_cast<uint16_t>(GetEntityRegistry().EntityLists[EnumValue(type)].size());
+}
+
+uint32_t GetEntityListVersion(EntityType type)
+{
+    return _entityListVersions[EnumValue(type)];
 }
 
 uint16_t GetNumFreeEntities()
 {
-    return static_cast<uint16_t>(_freeIdList.size());
+    return static_cast<uint16_t>(GetEntityRegistry().FreeIdList.size());
+}
+
+size_t GetEntityMemoryUsage()
+{
+    auto& registry = GetEntityRegistry();
+    size_t bytes = sizeof(GetGameState().Entities) + sizeof(registry.FlashingList)
+        + registry.FreeIdList.capacity() * sizeof(EntityId);
+    for (const auto& list : registry.EntityLists)
+    {
+        bytes += list.capacity() * sizeof(EntityId);
+    }
+    return bytes;
+}
+
+size_t GetEntitySpatialIndexMemoryUsage()
+{
+    auto& registry = GetEntityRegistry();
+    size_t bytes = sizeof(registry.SpatialChunks)
+        + (registry.SpatialNull.capacity() + registry.VehicleSpatialNull.capacity()) * sizeof(EntityId);
+    for (const auto& chunk : registry.SpatialChunks)
+    {
+        if (chunk == nullptr)
+            continue;
+
+        bytes += sizeof(EntitySpatialChunk);
+        for (const auto& tile : chunk->Tiles)
+        {
+            bytes += tile.capacity() * sizeof(EntityId);
+        }
+        for (const auto& tile : chunk->VehicleTiles)
+        {
+            bytes += tile.capacity() * sizeof(EntityId);
+        }
+    }
+    return bytes;
 }
 
 std::string EntitiesChecksum::ToString() const
@@ -129,33 +217,136 @@ EntityBase* GetEntity(EntityId entityIndex)
 
 const std::vector<EntityId>& GetEntityTileList(const CoordsXY& spritePos)
 {
-    return gEntitySpatialIndex[GetSpatialIndexOffset(spritePos)];
+    const auto tile = GetSpatialIndexTile(spritePos);
+    if (!tile.has_value())
+        return GetEntityRegistry().SpatialNull;
+
+    const auto* chunk = GetSpatialChunk(tile);
+    if (chunk == nullptr)
+        return kEntitySpatialEmpty;
+    return chunk->Tiles[GetSpatialChunkTileIndex(*tile)];
+}
+
+bool GetEntityTileHeights(const CoordsXY& spritePos, int32_t& minZ, int32_t& maxZ)
+{
+    const auto tile = GetSpatialIndexTile(spritePos);
+    if (!tile.has_value())
+        return false;
+
+    const auto* chunk = GetSpatialChunk(tile);
+    if (chunk == nullptr)
+        return false;
+
+    const auto tileIndex = GetSpatialChunkTileIndex(*tile);
+    if (chunk->Tiles[tileIndex].empty())
+        return false;
+
+    minZ = chunk->TileHeights[tileIndex].MinZ;
+    maxZ = chunk->TileHeights[tileIndex].MaxZ;
+    return true;
+}
+
+const std::vector<EntityId>& GetVehicleTileList(const CoordsXY& spritePos)
+{
+    const auto tile = GetSpatialIndexTile(spritePos);
+    if (!tile.has_value())
+        return GetEntityRegistry().VehicleSpatialNull;
+
+    const auto* chunk = GetSpatialChunk(tile);
+    if (chunk == nullptr)
+        return kEntitySpatialEmpty;
+    return chunk->VehicleTiles[GetSpatialChunkTileIndex(*tile)];
+}
+
+bool AnyEntitiesInRange(const MapRange& range, EntityType type)
+{
+    auto& registry = GetEntityRegistry();
+    const auto normalised = range.Normalise();
+    if (normalised.GetRight() < 0 || normalised.GetBottom() < 0)
+        return false;
+
+    const auto left = std::max(normalised.GetLeft(), 0) / COORDS_XY_STEP;
+    const auto top = std::max(normalised.GetTop(), 0) / COORDS_XY_STEP;
+    const auto right = std::min(normalised.GetRight() / COORDS_XY_STEP, kMaximumMapSizeTechnical - 1);
+    const auto bottom = std::min(normalised.GetBottom() / COORDS_XY_STEP, kMaximumMapSizeTechnical - 1);
+
+    for (int32_t chunkX = left / kSpatialChunkSize; chunkX <= right / kSpatialChunkSize; chunkX++)
+    {
+        for (int32_t chunkY = top / kSpatialChunkSize; chunkY <= bottom / kSpatialChunkSize; chunkY++)
+        {
+            const auto* chunk = registry.SpatialChunks[chunkX * kSpatialChunksPerSide + chunkY].get();
+            if (chunk != nullptr && chunk->TypeCounts[EnumValue(type)] != 0)
+                return true;
+        }
+    }
+    return false;
+}
+
+void GetEntityIdsInRange(const MapRange& range, std::vector<EntityId>& result)
+{
+    auto& registry = GetEntityRegistry();
+    const auto normalised = range.Normalise();
+    if (normalised.GetRight() < 0 || normalised.GetBottom() < 0)
+        return;
+
+    const auto left = std::max(normalised.GetLeft(), 0) / COORDS_XY_STEP;
+    const auto top = std::max(normalised.GetTop(), 0) / COORDS_XY_STEP;
+    const auto right = std::min(normalised.GetRight() / COORDS_XY_STEP, kMaximumMapSizeTechnical - 1);
+    const auto bottom = std::min(normalised.GetBottom() / COORDS_XY_STEP, kMaximumMapSizeTechnical - 1);
+
+    for (int32_t chunkX = left / kSpatialChunkSize; chunkX <= right / kSpatialChunkSize; chunkX++)
+    {
+        for (int32_t chunkY = top / kSpatialChunkSize; chunkY <= bottom / kSpatialChunkSize; chunkY++)
+        {
+            const auto* chunk = registry.SpatialChunks[chunkX * kSpatialChunksPerSide + chunkY].get();
+            if (chunk == nullptr || chunk->Count == 0)
+                continue;
+
+            const auto tileLeft = std::max(left, chunkX * kSpatialChunkSize);
+            const auto tileRight = std::min(right, (chunkX + 1) * kSpatialChunkSize - 1);
+            const auto tileTop = std::max(top, chunkY * kSpatialChunkSize);
+            const auto tileBottom = std::min(bottom, (chunkY + 1) * kSpatialChunkSize - 1);
+            for (int32_t tileX = tileLeft; tileX <= tileRight; tileX++)
+            {
+                for (int32_t tileY = tileTop; tileY <= tileBottom; tileY++)
+                {
+                    const auto& tileList = chunk->Tiles[GetSpatialChunkTileIndex({ tileX, tileY })];
+                    result.insert(result.end(), tileList.begin(), tileList.end());
+                }
+            }
+        }
+    }
 }
 
 static void ResetEntityLists()
 {
-    for (auto& list : gEntityLists)
+    for (auto& list : GetEntityRegistry().EntityLists)
     {
         list.clear();
     }
+    for (auto& version : _entityListVersions)
+    {
+        version++;
+    }
 }
 
 static void ResetFreeIds()
 {
-    _freeIdList.clear();
-    _freeIdList.resize(MAX_ENTITIES);
+    auto& registry = GetEntityRegistry();
+    registry.FreeIdList.clear();
+    registry.FreeIdList.resize(MAX_ENTITIES);
 
     // List needs to be back to front to simplify removing
     auto nextId = 0;
-    std::for_each(std::rbegin(_freeIdList), std::rend(_freeIdList), [&](auto& elem) {
+    std::for_each(std::rbegin(registry.FreeIdList), std::rend(registry.FreeIdList), [&](auto& elem) {
         elem = EntityId::FromUnderlying(nextId);
         nextId++;
     });
 }
 
-const std::list<EntityId>& GetEntityList(const EntityType id)
+const std::vector<EntityId>& GetEntityList(const EntityType id)
 {
-    return gEntityLists[EnumValue(id)];
+    return GetEntityRegistry().EntityLists[EnumValue(id)];
 }
 
 /**
@@ -176,7 +367,9 @@ void ResetAllEntities()
     }
 
     auto& gameState = GetGameState();
+    auto& registry = gameState.EntityRegistry;
     std::fill(std::begin(gameState.Entities), std::end(gameState.Entities), Entity_t());
+    PeepStringCacheInvalidateAll();
     OpenRCT2::RideUse::GetHistory().Clear();
     OpenRCT2::RideUse::GetTypeHistory().Clear();
     for (int32_t i = 0; i < MAX_ENTITIES; ++i)
@@ -189,7 +382,7 @@ void ResetAllEntities()
         spr->Type = EntityType::Null;
         spr->Id = EntityId::FromUnderlying(i);
 
-        _entityFlashingList[i] = false;
+        registry.FlashingList[i] = false;
     }
     ResetEntityLists();
     ResetFreeIds();
@@ -197,6 +390,7 @@ void ResetAllEntities()
 }
 
 static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc);
+static void EntitySpatialUpdateHeights(const EntityBase* entity);
 
 /**
  *
@@ -206,18 +400,38 @@ static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc);
  */
 void ResetEntitySpatialIndices()
 {
-    for (auto& vec : gEntitySpatialIndex)
+    auto& registry = GetEntityRegistry();
+    for (auto& chunk : registry.SpatialChunks)
     {
-        vec.clear();
+        if (chunk == nullptr)
+            continue;
+
+        for (auto& vec : chunk->Tiles)
+        {
+            vec.clear();
+        }
+        for (auto& vec : chunk->VehicleTiles)
+        {
+            vec.clear();
+        }
+        chunk->Count = 0;
+        chunk->TypeCounts = {};
     }
+    registry.SpatialNull.clear();
+    registry.VehicleSpatialNull.clear();
     for (EntityId::UnderlyingType i = 0; i < MAX_ENTITIES; i++)
     {
         auto* spr = GetEntity(EntityId::FromUnderlying(i));
         if (spr != nullptr && spr->Type != EntityType::Null)
         {
             EntitySpatialInsert(spr, { spr->x, spr->y });
+            EntitySpatialUpdateHeights(spr);
         }
     }
+
+    // Loading writes entity memory directly, so the guest mirror and the litter index need refreshing at the same points.
+    GuestHotFieldsRebuild();
+    LitterIndexRebuild();
 }
 
 #ifndef DISABLE_NETWORK
@@ -235,30 +449,81 @@ template<typename... T> void NetworkSerialiseEntityTypes(DataSerialiser& ds)
     (NetworkSerialseEntityType<T>(ds), ...);
 }
 
-EntitiesChecksum GetAllEntitiesChecksum()
+EntitiesChecksum GetAllEntitiesChecksum(OpenRCT2::ChecksumAlgorithm algorithm)
 {
     EntitiesChecksum checksum{};
 
-    OpenRCT2::ChecksumStream ms(checksum.raw);
+    OpenRCT2::ChecksumStream ms(checksum.raw, algorithm);
     DataSerialiser ds(true, ms);
     NetworkSerialiseEntityTypes<Guest, Staff, Vehicle, Litter>(ds);
+    ms.Finish();
 
     return checksum;
 }
+
+static void SerialiseEntityForChecksum(EntityBase& entity, DataSerialiser& ds)
+{
+    switch (entity.Type)
+    {
+        case EntityType::Guest:
+            entity.As<Guest>()->Serialise(ds);
+            break;
+        case EntityType::Staff:
+            entity.As<Staff>()->Serialise(ds);
+            break;
+        case EntityType::Vehicle:
+            entity.As<Vehicle>()->Serialise(ds);
+            break;
+        case EntityType::Litter:
+            entity.As<Litter>()->Serialise(ds);
+            break;
+        default:
+            break;
+    }
+}
+
+EntityRangeChecksums GetEntityRangeChecksums()
+{
+    EntityRangeChecksums result{};
+    for (size_t range = 0; range < kNumEntityChecksumRanges; range++)
+    {
+        EntitiesChecksum checksum{};
+        OpenRCT2::ChecksumStream ms(checksum.raw);
+        DataSerialiser ds(true, ms);
+
+        const auto begin = range * kEntityChecksumRangeSize;
+        const auto end = std::min<size_t>(begin + kEntityChecksumRangeSize, MAX_ENTITIES);
+        for (auto i = begin; i < end; i++)
+        {
+            auto* entity = GetEntity(EntityId::FromUnderlying(static_cast<EntityId::UnderlyingType>(i)));
+            if (entity != nullptr)
+            {
+                SerialiseEntityForChecksum(*entity, ds);
+            }
+        }
+        std::memcpy(&result[range], checksum.raw.data(), sizeof(result[range]));
+    }
+    return result;
+}
 #else
 
-EntitiesChecksum GetAllEntitiesChecksum()
+EntitiesChecksum GetAllEntitiesChecksum(OpenRCT2::ChecksumAlgorithm algorithm)
 {
     return EntitiesChecksum{};
 }
 
+EntityRangeChecksums GetEntityRangeChecksums()
+{
+    return EntityRangeChecksums{};
+}
+
 #endif // DISABLE_NETWORK
 
 static void EntityReset(EntityBase* entity)
 {
     // Need to retain how the sprite is linked in lists
     auto entityIndex = entity->Id;
-    _entityFlashingList[entityIndex.ToUnderlying()] = false;
+    GetEntityRegistry().FlashingList[entityIndex.ToUnderlying()] = false;
 
     Entity_t* tempEntity = reinterpret_cast<Entity_t*>(entity);
     *tempEntity = Entity_t();
@@ -271,20 +536,30 @@ static constexpr uint16_t MAX_MISC_SPRITES = 1600;
 
 static void AddToEntityList(EntityBase* entity)
 {
-    auto& list = gEntityLists[EnumValue(entity->Type)];
+    auto& list = GetEntityRegistry().EntityLists[EnumValue(entity->Type)];
+    _entityListVersions[EnumValue(entity->Type)]++;
     // Entity list must be in sprite_index order to prevent desync issues
-    list.insert(std::lower_bound(std::begin(list), std::end(list), entity->Id), entity->Id);
+    if (list.empty() || list.back() < entity->Id)
+    {
+        list.push_back(entity->Id);
+    }
+    else
+    {
+        list.insert(std::lower_bound(std::begin(list), std::end(list), entity->Id), entity->Id);
+    }
 }
 
 static void AddToFreeList(EntityId index)
 {
     // Free list must be in reverse sprite_index order to prevent desync issues
-    _freeIdList.insert(std::upper_bound(std::rbegin(_freeIdList), std::rend(_freeIdList), index).base(), index);
+    auto& freeIds = GetEntityRegistry().FreeIdList;
+    freeIds.insert(std::upper_bound(std::rbegin(freeIds), std::rend(freeIds), index).base(), index);
 }
 
 static void RemoveFromEntityList(EntityBase* entity)
 {
-    auto& list = gEntityLists[EnumValue(entity->Type)];
+    auto& list = GetEntityRegistry().EntityLists[EnumValue(entity->Type)];
+    _entityListVersions[EnumValue(entity->Type)]++;
     auto ptr = BinaryFind(std::begin(list), std::end(list), entity->Id);
     if (ptr != std::end(list))
     {
@@ -304,15 +579,21 @@ uint16_t GetMiscEntityCount()
     return count;
 }
 
-static void PrepareNewEntity(EntityBase* base, const EntityType type)
+// Inserts ascending ids into a list kept in sprite_index order
+static void MergeIntoSortedList(std::vector<EntityId>& list, const std::vector<EntityId>& ids)
+{
+    const auto oldSize = list.size();
+    list.insert(list.end(), ids.begin(), ids.end());
+    std::inplace_merge(list.begin(), list.begin() + oldSize, list.end());
+}
+
+static void ResetNewEntity(EntityBase* base, const EntityType type)
 {
     // Need to reset all sprite data, as the uninitialised values
     // may contain garbage and cause a desync later on.
     EntityReset(base);
 
     base->Type = type;
-    AddToEntityList(base);
-
     base->x = LOCATION_NULL;
     base->y = LOCATION_NULL;
     base->z = 0;
@@ -320,13 +601,21 @@ static void PrepareNewEntity(EntityBase* base, const EntityType type)
     base->SpriteData.HeightMin = 0x14;
     base->SpriteData.HeightMax = 0x8;
     base->SpriteData.SpriteRect = {};
+}
 
+static void PrepareNewEntity(EntityBase* base, const EntityType type)
+{
+    ResetNewEntity(base, type);
+    AddToEntityList(base);
     EntitySpatialInsert(base, { LOCATION_NULL, 0 });
+    GuestHotFieldsUpdate(*base);
+    LitterIndexAdd(*base);
 }
 
 EntityBase* CreateEntity(EntityType type)
 {
-    if (_freeIdList.size() == 0)
+    auto& registry = GetEntityRegistry();
+    if (registry.FreeIdList.size() == 0)
     {
         // No free sprites.
         return nullptr;
@@ -341,18 +630,18 @@ EntityBase* CreateEntity(EntityType type)
         }
 
         // If there are less than MAX_MISC_SPRITES free slots, ensure other entities can be created.
-        if (_freeIdList.size() < MAX_MISC_SPRITES)
+        if (registry.FreeIdList.size() < MAX_MISC_SPRITES)
         {
             return nullptr;
         }
     }
 
-    auto* entity = GetEntity(_freeIdList.back());
+    auto* entity = GetEntity(registry.FreeIdList.back());
     if (entity == nullptr)
     {
         return nullptr;
     }
-    _freeIdList.pop_back();
+    registry.FreeIdList.pop_back();
 
     PrepareNewEntity(entity, type);
 
@@ -361,8 +650,9 @@ EntityBase* CreateEntity(EntityType type)
 
 EntityBase* CreateEntityAt(const EntityId index, const EntityType type)
 {
-    auto id = BinaryFind(std::rbegin(_freeIdList), std::rend(_freeIdList), index);
-    if (id == std::rend(_freeIdList))
+    auto& registry = GetEntityRegistry();
+    auto id = BinaryFind(std::rbegin(registry.FreeIdList), std::rend(registry.FreeIdList), index);
+    if (id == std::rend(registry.FreeIdList))
     {
         return nullptr;
     }
@@ -373,12 +663,58 @@ EntityBase* CreateEntityAt(const EntityId index, const EntityType type)
         return nullptr;
     }
 
-    _freeIdList.erase(std::next(id).base());
+    registry.FreeIdList.erase(std::next(id).base());
 
     PrepareNewEntity(entity, type);
     return entity;
 }
 
+std::vector<EntityBase*> CreateEntities(EntityType type, size_t count)
+{
+    auto& registry = GetEntityRegistry();
+    std::vector<EntityBase*> result;
+    count = std::min(count, registry.FreeIdList.size());
+    if (EntityTypeIsMiscEntity(type))
+    {
+        // Apply the same limits CreateEntity checks before handing out each misc entity
+        const size_t miscCount = GetMiscEntityCount();
+        if (miscCount >= MAX_MISC_SPRITES || registry.FreeIdList.size() < MAX_MISC_SPRITES)
+        {
+            return result;
+        }
+        count = std::min({ count, MAX_MISC_SPRITES - miscCount, registry.FreeIdList.size() - MAX_MISC_SPRITES + 1 });
+    }
+    if (count == 0)
+    {
+        return result;
+    }
+
+    // The free list is in reverse order, so its tail holds the lowest ids
+    const auto first = registry.FreeIdList.end() - count;
+    std::vector<EntityId> ids(std::make_reverse_iterator(registry.FreeIdList.end()), std::make_reverse_iterator(first));
+    registry.FreeIdList.erase(first, registry.FreeIdList.end());
+
+    result.reserve(count);
+    for (auto id : ids)
+    {
+        auto* entity = GetEntity(id);
+        ResetNewEntity(entity, type);
+        GuestHotFieldsUpdate(*entity);
+        LitterIndexAdd(*entity);
+        result.push_back(entity);
+    }
+
+    // New entities have no location yet, so they all go into the null spatial list
+    MergeIntoSortedList(registry.EntityLists[EnumValue(type)], ids);
+    MergeIntoSortedList(registry.SpatialNull, ids);
+    if (type == EntityType::Vehicle)
+    {
+        MergeIntoSortedList(registry.VehicleSpatialNull, ids);
+    }
+    _entityListVersions[EnumValue(type)]++;
+    return result;
+}
+
 template<typename T> void MiscUpdateAllType()
 {
     for (auto misc : EntityList<T>())
@@ -413,20 +749,51 @@ void UpdateMoneyEffect()
 // Performs a search to ensure that insert keeps next_in_quadrant in sprite_index order
 static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc)
 {
-    size_t newIndex = GetSpatialIndexOffset(newLoc);
-    auto& spatialVector = gEntitySpatialIndex[newIndex];
+    auto& spatialVector = GetOrCreateSpatialList(newLoc);
     auto index = std::lower_bound(std::begin(spatialVector), std::end(spatialVector), entity->Id);
     spatialVector.insert(index, entity->Id);
+
+    if (entity->Type == EntityType::Vehicle)
+    {
+        auto& vehicleVector = GetOrCreateVehicleSpatialList(newLoc);
+        vehicleVector.insert(std::lower_bound(std::begin(vehicleVector), std::end(vehicleVector), entity->Id), entity->Id);
+    }
+
+    auto* chunk = GetSpatialChunk(GetSpatialIndexTile(newLoc));
+    if (chunk != nullptr)
+    {
+        chunk->Count++;
+        if (entity->Type < EntityType::Count)
+            chunk->TypeCounts[EnumValue(entity->Type)]++;
+    }
 }
 
 static void EntitySpatialRemove(EntityBase* entity)
 {
-    size_t currentIndex = GetSpatialIndexOffset({ entity->x, entity->y });
-    auto& spatialVector = gEntitySpatialIndex[currentIndex];
+    const CoordsXY currentLoc = { entity->x, entity->y };
+    auto& spatialVector = GetOrCreateSpatialList(currentLoc);
     auto index = BinaryFind(std::begin(spatialVector), std::end(spatialVector), entity->Id);
     if (index != std::end(spatialVector))
     {
         spatialVector.erase(index, index + 1);
+
+        if (entity->Type == EntityType::Vehicle)
+        {
+            auto& vehicleVector = GetOrCreateVehicleSpatialList(currentLoc);
+            auto vehicleIndex = BinaryFind(std::begin(vehicleVector), std::end(vehicleVector), entity->Id);
+            if (vehicleIndex != std::end(vehicleVector))
+            {
+                vehicleVector.erase(vehicleIndex);
+            }
+        }
+
+        auto* chunk = GetSpatialChunk(GetSpatialIndexTile(currentLoc));
+        if (chunk != nullptr)
+        {
+            chunk->Count--;
+            if (entity->Type < EntityType::Count)
+                chunk->TypeCounts[EnumValue(entity->Type)]--;
+        }
     }
     else
     {
@@ -435,11 +802,32 @@ static void EntitySpatialRemove(EntityBase* entity)
     }
 }
 
+// Widens the z range of the entity's tile to include the entity, called once it is at its new location
+static void EntitySpatialUpdateHeights(const EntityBase* entity)
+{
+    const auto tile = GetSpatialIndexTile({ entity->x, entity->y });
+    auto* chunk = GetSpatialChunk(tile);
+    if (chunk == nullptr)
+        return;
+
+    const auto tileIndex = GetSpatialChunkTileIndex(*tile);
+    auto& heights = chunk->TileHeights[tileIndex];
+    if (chunk->Tiles[tileIndex].size() <= 1)
+    {
+        heights = { entity->z, entity->z };
+    }
+    else
+    {
+        heights.MinZ = std::min(heights.MinZ, entity->z);
+        heights.MaxZ = std::max(heights.MaxZ, entity->z);
+    }
+}
+
 static void EntitySpatialMove(EntityBase* entity, const CoordsXY& newLoc)
 {
-    size_t newIndex = GetSpatialIndexOffset(newLoc);
-    size_t currentIndex = GetSpatialIndexOffset({ entity->x, entity->y });
-    if (newIndex == currentIndex)
+    const auto newTile = GetSpatialIndexTile(newLoc);
+    const auto currentTile = GetSpatialIndexTile({ entity->x, entity->y });
+    if (newTile == currentTile)
         return;
 
     EntitySpatialRemove(entity);
@@ -464,13 +852,12 @@ void EntityBase::MoveTo(const CoordsXYZ& newLocation)
 
     if (loc.x == LOCATION_NULL)
     {
-        x = loc.x;
-        y = loc.y;
-        z = loc.z;
+        SetLocation(loc);
     }
     else
     {
         EntitySetCoordinates(loc, this);
+        EntitySpatialUpdateHeights(this);
         Invalidate(); // Invalidate new position.
     }
 }
@@ -502,7 +889,9 @@ static void FreeEntity(EntityBase& entity)
         guest->SetName({});
         OpenRCT2::RideUse::GetHistory().RemoveHandle(guest->Id);
         OpenRCT2::RideUse::GetTypeHistory().RemoveHandle(guest->Id);
+        GuestHotFieldsRemove(*guest);
     }
+    LitterIndexRemove(entity);
 }
 
 /**
@@ -521,42 +910,95 @@ void EntityRemove(EntityBase* entity)
     EntityReset(entity);
 }
 
+void RemoveEntities(std::span<EntityBase* const> entities)
+{
+    auto& registry = GetEntityRegistry();
+    if (entities.empty())
+        return;
+
+    std::vector<EntityId> removedIds;
+    removedIds.reserve(entities.size());
+    std::array<std::vector<EntityId>, EnumValue(EntityType::Count)> removedByType;
+    for (auto* entity : entities)
+    {
+        FreeEntity(*entity);
+        removedIds.push_back(entity->Id);
+        if (entity->Type < EntityType::Count)
+            removedByType[EnumValue(entity->Type)].push_back(entity->Id);
+    }
+
+    EntityTweener::Get().RemoveEntities(entities);
+
+    for (size_t type = 0; type < removedByType.size(); type++)
+    {
+        auto& removed = removedByType[type];
+        if (removed.empty())
+            continue;
+
+        std::sort(removed.begin(), removed.end());
+        _entityListVersions[type]++;
+        auto& list = registry.EntityLists[type];
+        list.erase(
+            std::remove_if(
+                list.begin(), list.end(), [&](EntityId id) { return std::binary_search(removed.begin(), removed.end(), id); }),
+            list.end());
+    }
+
+    // Free list must be in reverse sprite_index order to prevent desync issues
+    std::sort(removedIds.begin(), removedIds.end(), [](EntityId a, EntityId b) { return a > b; });
+    const auto oldSize = registry.FreeIdList.size();
+    registry.FreeIdList.insert(registry.FreeIdList.end(), removedIds.begin(), removedIds.end());
+    std::inplace_merge(
+        registry.FreeIdList.begin(), registry.FreeIdList.begin() + oldSize, registry.FreeIdList.end(),
+        [](EntityId a, EntityId b) { return a > b; });
+
+    for (auto* entity : entities)
+    {
+        EntitySpatialRemove(entity);
+        EntityReset(entity);
+    }
+}
+
 /**
  * Loops through all floating entities and removes them.
  * Returns the amount of removed objects as feedback.
  */
 uint16_t RemoveFloatingEntities()
 {
-    uint16_t removed = 0;
+    std::vector<EntityBase*> floating;
     for (auto* balloon : EntityList<Balloon>())
     {
-        EntityRemove(balloon);
-        removed++;
+        floating.push_back(balloon);
     }
     for (auto* duck : EntityList<Duck>())
     {
         if (duck->IsFlying())
         {
-            EntityRemove(duck);
-            removed++;
+            floating.push_back(duck);
         }
     }
     for (auto* money : EntityList<MoneyEffect>())
     {
-        EntityRemove(money);
-        removed++;
+        floating.push_back(money);
     }
-    return removed;
+    RemoveEntities(floating);
+    return static_cast<uint16_t>(floating.size());
 }
 
 void EntitySetFlashing(EntityBase* entity, bool flashing)
 {
     assert(entity->Id.ToUnderlying() < MAX_ENTITIES);
-    _entityFlashingList[entity->Id.ToUnderlying()] = flashing;
+    GetEntityRegistry().FlashingList[entity->Id.ToUnderlying()] = flashing;
 }
 
 bool EntityGetFlashing(EntityBase* entity)
 {
     assert(entity->Id.ToUnderlying() < MAX_ENTITIES);
-    return _entityFlashingList[entity->Id.ToUnderlying()];
+    return GetEntityRegistry().FlashingList[entity->Id.ToUnderlying()];
+}
+
+bool EntityGetFlashing(EntityId id)
+{
+    assert(id.ToUnderlying() < MAX_ENTITIES);
+    return GetEntityRegistry().FlashingList[id.ToUnderlying()];
 }
@@ -10,9 +10,12 @@
 #pragma once
 
 #include "../common.h"
+#include "../core/ChecksumStream.h"
 #include "EntityBase.h"
 
 #include <array>
+#include <span>
+#include <vector>
 
 namespace OpenRCT2
 {
@@ -52,6 +55,19 @@ template<typename T> T* CreateEntity()
     return static_cast<T*>(CreateEntity(T::cEntityType));
 }
 
+// Creates up to count entities in one go, with the same ids CreateEntity would have handed out one by one
+std::vector<EntityBase*> CreateEntities(EntityType type, size_t count);
+
+template<typename T> std::vector<T*> CreateEntities(size_t count)
+{
+    std::vector<T*> result;
+    for (auto* entity : CreateEntities(T::cEntityType, count))
+    {
+        result.push_back(static_cast<T*>(entity));
+    }
+    return result;
+}
+
 // Use only with imports that must happen at a specified index
 EntityBase* CreateEntityAt(const EntityId index, const EntityType type);
 // Use only with imports that must happen at a specified index
@@ -66,6 +82,8 @@ void UpdateAllMiscEntities();
 void UpdateMoneyEffect();
 void EntitySetCoordinates(const CoordsXYZ& entityPos, EntityBase* entity);
 void EntityRemove(EntityBase* entity);
+// Same as calling EntityRemove on each entity, every entity must only be passed once
+void RemoveEntities(std::span<EntityBase* const> entities);
 uint16_t RemoveFloatingEntities();
 
 #pragma pack(push, 1)
@@ -76,7 +94,15 @@ struct EntitiesChecksum
     std::string ToString() const;
 };
 #pragma pack(pop)
-EntitiesChecksum GetAllEntitiesChecksum();
+EntitiesChecksum GetAllEntitiesChecksum(OpenRCT2::ChecksumAlgorithm algorithm = OpenRCT2::ChecksumAlgorithm::FNV1a);
+
+// Checksums of the network relevant entities split into fixed ranges of entity indices, used to find out which part of
+// the entity list diverged after a desync.
+constexpr size_t kNumEntityChecksumRanges = 32;
+constexpr size_t kEntityChecksumRangeSize = (MAX_ENTITIES + kNumEntityChecksumRanges - 1) / kNumEntityChecksumRanges;
+using EntityRangeChecksums = std::array<uint64_t, kNumEntityChecksumRanges>;
+EntityRangeChecksums GetEntityRangeChecksums();
 
 void EntitySetFlashing(EntityBase* entity, bool flashing);
 bool EntityGetFlashing(EntityBase* entity);
+bool EntityGetFlashing(EntityId id);
@@ -0,0 +1,58 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../world/Map.h"
+#include "EntityRegistry.h"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace OpenRCT2
+{
+    // The spatial index is split into chunks of tiles that are only allocated once an entity enters them, so the memory
+    // used follows the area entities actually cover rather than the technical maximum map size.
+    constexpr int32_t kSpatialChunkSize = 32;
+    constexpr int32_t kSpatialChunksPerSide = (kMaximumMapSizeTechnical + kSpatialChunkSize - 1) / kSpatialChunkSize;
+
+    struct EntityTileHeights
+    {
+        int32_t MinZ;
+        int32_t MaxZ;
+    };
+
+    struct EntitySpatialChunk
+    {
+        std::array<std::vector<EntityId>, kSpatialChunkSize * kSpatialChunkSize> Tiles;
+        // Subset of Tiles holding only vehicles, so collision detection does not have to skip over guests and litter
+        std::array<std::vector<EntityId>, kSpatialChunkSize * kSpatialChunkSize> VehicleTiles;
+        uint32_t Count{};
+        // Number of entities of each type in the chunk, lets searches for one type skip the chunks without any
+        std::array<uint32_t, EnumValue(EntityType::Count)> TypeCounts{};
+        // Lowest and highest z of the entities on each tile, widened as entities move and reset once a single entity is
+        // left, so painting can skip tiles whose entities can not reach the view. Only meaningful for non-empty tiles.
+        std::array<EntityTileHeights, kSpatialChunkSize * kSpatialChunkSize> TileHeights{};
+    };
+
+    /**
+     * Bookkeeping the entity registry keeps next to the entity storage: the per type lists, the free ids, the flashing
+     * flags and the spatial index. It lives in the game state so that it always describes the entities of that state.
+     */
+    struct EntityRegistryState
+    {
+        std::array<std::vector<EntityId>, EnumValue(EntityType::Count)> EntityLists;
+        std::vector<EntityId> FreeIdList;
+        std::array<bool, MAX_ENTITIES> FlashingList{};
+        std::array<std::unique_ptr<EntitySpatialChunk>, kSpatialChunksPerSide * kSpatialChunksPerSide> SpatialChunks;
+        std::vector<EntityId> SpatialNull;
+        std::vector<EntityId> VehicleSpatialNull;
+    };
+} // namespace OpenRCT2
@@ -10,6 +10,7 @@
 
 #include "../entity/Guest.h"
 #include "../entity/Staff.h"
+#include "../interface/Viewport.h"
 #include "../ride/Vehicle.h"
 #include "EntityList.h"
 #include "EntityRegistry.h"
@@ -18,21 +19,21 @@
 
 void EntityTweener::AddEntity(EntityBase* entity)
 {
-    Entities.push_back(entity);
-    PrePos.emplace_back(entity->GetLocation());
+    // Entities that are not on screen don't need to move smoothly, they are put in their final position by Restore.
+    if (entity->x == LOCATION_NULL || !ViewportsIntersectViewRect(entity->SpriteData.SpriteRect))
+        return;
+
+    const auto index = entity->Id.ToUnderlying();
+    auto& slot = Slots[index];
+    slot.Entity = entity;
+    slot.PrePos = entity->GetLocation();
+    slot.PostPos = slot.PrePos;
+    Active.push_back(index);
 }
 
-void EntityTweener::PopulateEntities()
+template<typename T> void EntityTweener::PopulateEntities()
 {
-    for (auto ent : EntityList<Guest>())
-    {
-        AddEntity(ent);
-    }
-    for (auto ent : EntityList<Staff>())
-    {
-        AddEntity(ent);
-    }
-    for (auto ent : EntityList<Vehicle>())
+    for (auto ent : EntityList<T>())
     {
         AddEntity(ent);
     }
@@ -42,21 +43,23 @@ void EntityTweener::PreTick()
 {
     Restore();
     Reset();
-    PopulateEntities();
+
+    if (Slots.empty())
+        Slots.resize(MAX_ENTITIES);
+
+    PopulateEntities<Guest>();
+    PopulateEntities<Staff>();
+    PopulateEntities<Vehicle>();
 }
 
 void EntityTweener::PostTick()
 {
-    for (auto* ent : Entities)
+    for (auto index : Active)
     {
-        if (ent == nullptr)
-        {
-            // Sprite was removed, add a dummy position to keep the index aligned.
-            PostPos.emplace_back(0, 0, 0);
-        }
-        else
+        auto& slot = Slots[index];
+        if (slot.Entity != nullptr)
         {
-            PostPos.emplace_back(ent->GetLocation());
+            slot.PostPos = slot.Entity->GetLocation();
         }
     }
 }
@@ -76,22 +79,31 @@ void EntityTweener::RemoveEntity(EntityBase* entity)
         return;
     }
 
-    auto it = std::find(Entities.begin(), Entities.end(), entity);
-    if (it != Entities.end())
-        *it = nullptr;
+    const auto index = entity->Id.ToUnderlying();
+    if (index < Slots.size() && Slots[index].Entity == entity)
+        Slots[index].Entity = nullptr;
+}
+
+void EntityTweener::RemoveEntities(std::span<EntityBase* const> entities)
+{
+    for (auto* entity : entities)
+    {
+        RemoveEntity(entity);
+    }
 }
 
 void EntityTweener::Tween(float alpha)
 {
     const float inv = (1.0f - alpha);
-    for (size_t i = 0; i < Entities.size(); ++i)
+    for (auto index : Active)
     {
-        auto* ent = Entities[i];
+        auto& slot = Slots[index];
+        auto* ent = slot.Entity;
         if (ent == nullptr)
             continue;
 
-        auto& posA = PrePos[i];
-        auto& posB = PostPos[i];
+        auto& posA = slot.PrePos;
+        auto& posB = slot.PostPos;
 
         if (posA == posB)
             continue;
@@ -107,22 +119,25 @@ void EntityTweener::Tween(float alpha)
 
 void EntityTweener::Restore()
 {
-    for (size_t i = 0; i < Entities.size(); ++i)
+    for (auto index : Active)
     {
-        auto* ent = Entities[i];
+        auto& slot = Slots[index];
+        auto* ent = slot.Entity;
         if (ent == nullptr)
             continue;
 
-        EntitySetCoordinates(PostPos[i], ent);
+        EntitySetCoordinates(slot.PostPos, ent);
         ent->Invalidate();
     }
 }
 
 void EntityTweener::Reset()
 {
-    Entities.clear();
-    PrePos.clear();
-    PostPos.clear();
+    for (auto index : Active)
+    {
+        Slots[index].Entity = nullptr;
+    }
+    Active.clear();
 }
 
 static EntityTweener tweener;
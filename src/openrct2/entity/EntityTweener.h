@@ -11,16 +11,26 @@
 
 #include "EntityBase.h"
 
+#include <span>
 #include <vector>
 
 class EntityTweener
 {
-    std::vector<EntityBase*> Entities;
-    std::vector<CoordsXYZ> PrePos;
-    std::vector<CoordsXYZ> PostPos;
+    // Tween state of one entity, indexed by entity id. Entity is cleared when the entity is removed, so a slot is only
+    // used for the entity that was in it when the tick started even if the id is reused during the tick.
+    struct Slot
+    {
+        EntityBase* Entity{};
+        CoordsXYZ PrePos;
+        CoordsXYZ PostPos;
+    };
+
+    std::vector<Slot> Slots;
+    // Ids of the slots filled in this tick, only entities visible in a viewport are tweened.
+    std::vector<EntityId::UnderlyingType> Active;
 
 private:
-    void PopulateEntities();
+    template<typename T> void PopulateEntities();
     void AddEntity(EntityBase* entity);
 
 public:
@@ -29,6 +39,7 @@ public:
     void PreTick();
     void PostTick();
     void RemoveEntity(EntityBase* entity);
+    void RemoveEntities(std::span<EntityBase* const> entities);
     void Tween(float alpha);
     void Restore();
     void Reset();
@@ -21,6 +21,7 @@
 #include "../core/String.hpp"
 #include "../entity/Balloon.h"
 #include "../entity/EntityRegistry.h"
+#include "../entity/GuestHotFields.h"
 #include "../entity/MoneyEffect.h"
 #include "../entity/Particle.h"
 #include "../interface/Window_internal.h"
@@ -61,6 +62,7 @@
 #include "Staff.h"
 
 #include <algorithm>
+#include <array>
 #include <functional>
 #include <iterator>
 
@@ -625,9 +627,9 @@ void Guest::HandleEasterEggName()
 
     if (CheckEasterEggName(EASTEREGG_PEEP_NAME_MELANIE_WARN))
     {
-        Happiness = 250;
+        SetHappiness(250);
         HappinessTarget = 250;
-        Energy = 127;
+        SetEnergy(127);
         EnergyTarget = 127;
         Nausea = 0;
         NauseaTarget = 0;
@@ -740,35 +742,106 @@ int32_t Guest::CheckEasterEggName(int32_t index) const
     return String::IEquals(buffer, gPeepEasterEggNames[index]);
 }
 
-void Guest::Loc68F9F3()
+/**
+ * The needs of a guest that the periodic bookkeeping moves towards their targets. Kept apart from the guest so the
+ * arithmetic is plain data in, data out and can be run over many guests without touching the rest of the entity.
+ */
+struct GuestNeeds
+{
+    uint8_t Energy;
+    uint8_t EnergyTarget;
+    uint8_t Happiness;
+    uint8_t HappinessTarget;
+    uint8_t Nausea;
+    uint8_t NauseaTarget;
+    uint8_t Hunger;
+    uint8_t Thirst;
+    uint8_t Toilet;
+};
+
+static GuestNeeds GuestGetNeeds(const Guest& guest)
+{
+    return { guest.Energy, guest.EnergyTarget, guest.Happiness, guest.HappinessTarget, guest.Nausea,
+             guest.NauseaTarget, guest.Hunger, guest.Thirst, guest.Toilet };
+}
+
+static void GuestNeedsDecay(GuestNeeds& needs)
 {
     // Idle peep happiness tends towards 127 (50%).
-    if (HappinessTarget >= 128)
-        HappinessTarget--;
+    if (needs.HappinessTarget >= 128)
+        needs.HappinessTarget--;
     else
-        HappinessTarget++;
+        needs.HappinessTarget++;
 
-    NauseaTarget = std::max(NauseaTarget - 2, 0);
+    needs.NauseaTarget = std::max(needs.NauseaTarget - 2, 0);
 
-    if (Energy <= 50)
-    {
-        Energy = std::max(Energy - 2, 0);
-    }
+    if (needs.Energy <= 50)
+        needs.Energy = std::max(needs.Energy - 2, 0);
+
+    if (needs.Hunger < 10)
+        needs.Hunger = std::max(needs.Hunger - 1, 0);
+
+    if (needs.Thirst < 10)
+        needs.Thirst = std::max(needs.Thirst - 1, 0);
+
+    if (needs.Toilet >= 195)
+        needs.Toilet--;
+}
+
+static bool GuestNeedsShownChanged(const GuestNeeds& a, const GuestNeeds& b)
+{
+    return a.Energy != b.Energy || a.Happiness != b.Happiness || a.Nausea != b.Nausea || a.Hunger != b.Hunger
+        || a.Thirst != b.Thirst || a.Toilet != b.Toilet;
+}
+
+static uint8_t GuestNeedApproach(uint8_t value, uint8_t target)
+{
+    if (value >= target)
+        return std::max<int32_t>(std::max(value - 4, 0), target);
+    return std::min<int32_t>(std::min(255, value + 4), target);
+}
 
-    if (Hunger < 10)
+static void GuestNeedsConverge(GuestNeeds& needs)
+{
+    uint8_t newEnergy = needs.Energy;
+    uint8_t newTargetEnergy = needs.EnergyTarget;
+    if (newEnergy >= newTargetEnergy)
     {
-        Hunger = std::max(Hunger - 1, 0);
+        newEnergy -= 2;
+        if (newEnergy < newTargetEnergy)
+            newEnergy = newTargetEnergy;
     }
-
-    if (Thirst < 10)
+    else
     {
-        Thirst = std::max(Thirst - 1, 0);
+        newEnergy = std::min(PEEP_MAX_ENERGY_TARGET, newEnergy + 4);
+        if (newEnergy > newTargetEnergy)
+            newEnergy = newTargetEnergy;
     }
 
-    if (Toilet >= 195)
+    if (newEnergy < PEEP_MIN_ENERGY)
+        newEnergy = PEEP_MIN_ENERGY;
+
+    /* Previous code here suggested maximum energy is 128. */
+    needs.Energy = std::min(static_cast<uint8_t>(PEEP_MAX_ENERGY), newEnergy);
+
+    needs.Happiness = GuestNeedApproach(needs.Happiness, needs.HappinessTarget);
+    needs.Nausea = GuestNeedApproach(needs.Nausea, needs.NauseaTarget);
+}
+
+void Guest::Loc68F9F3()
+{
+    auto needs = GuestGetNeeds(*this);
+    GuestNeedsDecay(needs);
+
+    HappinessTarget = needs.HappinessTarget;
+    NauseaTarget = needs.NauseaTarget;
+    if (needs.Energy != Energy)
     {
-        Toilet--;
+        SetEnergy(needs.Energy);
     }
+    Hunger = needs.Hunger;
+    Thirst = needs.Thirst;
+    Toilet = needs.Toilet;
 
     if (State == PeepState::Walking && NauseaTarget >= 128)
     {
@@ -828,79 +901,28 @@ void Guest::Loc68FA89()
         }
     }
 
-    uint8_t newEnergy = Energy;
-    uint8_t newTargetEnergy = EnergyTarget;
-    if (newEnergy >= newTargetEnergy)
-    {
-        newEnergy -= 2;
-        if (newEnergy < newTargetEnergy)
-            newEnergy = newTargetEnergy;
-    }
-    else
-    {
-        newEnergy = std::min(PEEP_MAX_ENERGY_TARGET, newEnergy + 4);
-        if (newEnergy > newTargetEnergy)
-            newEnergy = newTargetEnergy;
-    }
-
-    if (newEnergy < PEEP_MIN_ENERGY)
-        newEnergy = PEEP_MIN_ENERGY;
-
-    /* Previous code here suggested maximum energy is 128. */
-    newEnergy = std::min(static_cast<uint8_t>(PEEP_MAX_ENERGY), newEnergy);
-
-    if (newEnergy != Energy)
-    {
-        Energy = newEnergy;
-        WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_2;
-    }
-
-    uint8_t newHappiness = Happiness;
-    uint8_t newHappinessGrowth = HappinessTarget;
-    if (newHappiness >= newHappinessGrowth)
-    {
-        newHappiness = std::max(newHappiness - 4, 0);
-        if (newHappiness < newHappinessGrowth)
-            newHappiness = newHappinessGrowth;
-    }
-    else
-    {
-        newHappiness = std::min(255, newHappiness + 4);
-        if (newHappiness > newHappinessGrowth)
-            newHappiness = newHappinessGrowth;
-    }
+    auto needs = GuestGetNeeds(*this);
+    GuestNeedsConverge(needs);
 
-    if (newHappiness != Happiness)
+    if (needs.Energy != Energy || needs.Happiness != Happiness || needs.Nausea != Nausea)
     {
-        Happiness = newHappiness;
         WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_2;
     }
-
-    uint8_t newNausea = Nausea;
-    uint8_t newNauseaGrowth = NauseaTarget;
-    if (newNausea >= newNauseaGrowth)
+    if (needs.Energy != Energy)
     {
-        newNausea = std::max(newNausea - 4, 0);
-        if (newNausea < newNauseaGrowth)
-            newNausea = newNauseaGrowth;
+        SetEnergy(needs.Energy);
     }
-    else
+    if (needs.Happiness != Happiness)
     {
-        newNausea = std::min(255, newNausea + 4);
-        if (newNausea > newNauseaGrowth)
-            newNausea = newNauseaGrowth;
-    }
-
-    if (newNausea != Nausea)
-    {
-        Nausea = newNausea;
-        WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_2;
+        SetHappiness(needs.Happiness);
     }
+    Nausea = needs.Nausea;
 }
 
 void Guest::Tick128UpdateGuest(uint32_t index)
 {
     const auto currentTicks = GetGameState().CurrentTicks;
+    const auto oldNeeds = GuestGetNeeds(*this);
 
     if ((index & 0x1FF) == (currentTicks & 0x1FF))
     {
@@ -1026,6 +1048,8 @@ void Guest::Tick128UpdateGuest(uint32_t index)
                     PeepUpdateHunger(this);
                     Loc68F9F3();
                     Loc68FA89();
+                    if (GuestNeedsShownChanged(oldNeeds, GuestGetNeeds(*this)))
+                        WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_STATS;
                     return;
                 }
             }
@@ -1220,6 +1244,10 @@ void Guest::Tick128UpdateGuest(uint32_t index)
     }
 
     Loc68FA89();
+
+    // Nearly all of the needs shown on the stats page change here, so the page only has to be redrawn when told to
+    if (GuestNeedsShownChanged(oldNeeds, GuestGetNeeds(*this)))
+        WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_STATS;
 }
 
 /**
@@ -1597,7 +1625,7 @@ bool Guest::DecideAndBuyItem(Ride& ride, const ShopItem shopItem, money64 price)
 
             int32_t happinessGrowth = itemValue * 4;
             HappinessTarget = std::min((HappinessTarget + happinessGrowth), PEEP_MAX_HAPPINESS);
-            Happiness = std::min((Happiness + happinessGrowth), PEEP_MAX_HAPPINESS);
+            SetHappiness(std::min((Happiness + happinessGrowth), PEEP_MAX_HAPPINESS));
         }
 
         // reset itemValue for satisfaction calculation
@@ -1757,11 +1785,11 @@ void Guest::OnExitRide(Ride& ride)
     if (PeepFlags & PEEP_FLAGS_RIDE_SHOULD_BE_MARKED_AS_FAVOURITE)
     {
         PeepFlags &= ~PEEP_FLAGS_RIDE_SHOULD_BE_MARKED_AS_FAVOURITE;
-        FavouriteRide = ride.id;
+        SetFavouriteRide(ride.id);
         // TODO fix this flag name or add another one
         WindowInvalidateFlags |= PEEP_INVALIDATE_STAFF_STATS;
     }
-    Happiness = HappinessTarget;
+    SetHappiness(HappinessTarget);
     Nausea = NauseaTarget;
     WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_STATS;
 
@@ -1838,24 +1866,93 @@ void Guest::PickRideToGoOn()
     }
 }
 
+/**
+ * Ride level inputs of the ride choice that are the same for every guest. PeepUpdateAll builds a table of these before
+ * updating the guests so each guest only has to evaluate the terms that depend on itself. None of these inputs are
+ * changed by guests, the queue full flag is therefore deliberately left out. Outside of the guest update the attributes
+ * are computed on demand.
+ */
+struct RideChoiceAttributes
+{
+    money64 Price;
+    bool IsOpen;
+    bool IsShopOrFacility;
+    bool IsFreeTransport;
+    bool HasRatings;
+    bool IsSheltered;
+};
+
+static std::array<RideChoiceAttributes, OpenRCT2::Limits::MaxRidesInPark> _rideChoiceTable;
+static OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark> _rideChoiceVisibleFromAnywhere;
+static bool _rideChoiceTableValid = false;
+
+static RideChoiceAttributes RideChoiceComputeAttributes(const Ride& ride)
+{
+    RideChoiceAttributes attributes{};
+    const auto& rtd = ride.GetRideTypeDescriptor();
+    attributes.Price = RideGetPrice(ride);
+    attributes.IsOpen = ride.status == RideStatus::Open && !(ride.lifecycle_flags & RIDE_LIFECYCLE_BROKEN_DOWN);
+    attributes.IsShopOrFacility = rtd.HasFlag(RIDE_TYPE_FLAG_IS_SHOP_OR_FACILITY);
+    attributes.IsFreeTransport = rtd.HasFlag(RIDE_TYPE_FLAG_TRANSPORT_RIDE) && ride.value != RIDE_VALUE_UNDEFINED
+        && attributes.Price == 0;
+    attributes.HasRatings = RideHasRatings(ride);
+    // Peeps will go on rides that are sufficiently undercover while it's raining.
+    // The threshold is fairly low and only requires about 10-15% of the ride to be undercover.
+    attributes.IsSheltered = ride.sheltered_eighths >= 3;
+    return attributes;
+}
+
+static bool RideIsVisibleFromAnywhere(const Ride& ride)
+{
+    // Realistic as you can usually see tall rides from anywhere in the park.
+    return ride.highest_drop_height > 66 || ride.excitement >= RIDE_RATING(8, 00);
+}
+
+static RideChoiceAttributes RideChoiceGetAttributes(const Ride& ride)
+{
+    if (_rideChoiceTableValid)
+    {
+        return _rideChoiceTable[ride.id.ToUnderlying()];
+    }
+    return RideChoiceComputeAttributes(ride);
+}
+
+void GuestRideChoiceTableBuild()
+{
+    _rideChoiceVisibleFromAnywhere.reset();
+    for (auto& ride : GetRideManager())
+    {
+        const auto rideIndex = ride.id.ToUnderlying();
+        _rideChoiceTable[rideIndex] = RideChoiceComputeAttributes(ride);
+        _rideChoiceVisibleFromAnywhere[rideIndex] = RideIsVisibleFromAnywhere(ride);
+    }
+    _rideChoiceTableValid = true;
+}
+
+void GuestRideChoiceTableClear()
+{
+    _rideChoiceTableValid = false;
+}
+
 Ride* Guest::FindBestRideToGoOn()
 {
     // Pick the most exciting ride
     auto rideConsideration = FindRidesToGoOn();
     Ride* mostExcitingRide = nullptr;
-    for (auto& ride : GetRideManager())
+    for (auto rideIndex : rideConsideration.set_bits())
     {
-        const auto rideIndex = ride.id.ToUnderlying();
-        if (rideConsideration.size() > rideIndex && rideConsideration[rideIndex])
+        auto* ride = GetRide(RideId::FromUnderlying(static_cast<RideId::UnderlyingType>(rideIndex)));
+        if (ride == nullptr)
+            continue;
+
+        if (!(ride->lifecycle_flags & RIDE_LIFECYCLE_QUEUE_FULL))
         {
-            if (!(ride.lifecycle_flags & RIDE_LIFECYCLE_QUEUE_FULL))
+            if (ShouldGoOnRide(*ride, StationIndex::FromUnderlying(0), false, true)
+                && RideChoiceGetAttributes(*ride).HasRatings)
             {
-                if (ShouldGoOnRide(ride, StationIndex::FromUnderlying(0), false, true) && RideHasRatings(ride))
+                if (mostExcitingRide == nullptr || ride->excitement > mostExcitingRide->excitement)
                 {
-                    if (mostExcitingRide == nullptr || ride.excitement > mostExcitingRide->excitement)
-                    {
-                        mostExcitingRide = &ride;
-                    }
+                    mostExcitingRide = ride;
                 }
             }
         }
@@ -1884,39 +1981,47 @@ OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark> Guest::FindRidesToGoOn()
     else
     {
         // Take nearby rides into consideration
-        constexpr auto radius = 10 * 32;
-        int32_t cx = Floor2(x, 32);
-        int32_t cy = Floor2(y, 32);
-        for (int32_t tileX = cx - radius; tileX <= cx + radius; tileX += COORDS_XY_STEP)
+        const auto* decidedRides = PeepGetDecidedNearbyRides(*this);
+        rideConsideration = decidedRides != nullptr ? *decidedRides : GuestFindNearbyRides(*this);
+
+        // Always take the tall rides into consideration (realistic as you can usually see them from anywhere in the park)
+        if (_rideChoiceTableValid)
+        {
+            rideConsideration |= _rideChoiceVisibleFromAnywhere;
+        }
+        else
         {
-            for (int32_t tileY = cy - radius; tileY <= cy + radius; tileY += COORDS_XY_STEP)
+            for (auto& ride : GetRideManager())
             {
-                auto location = CoordsXY{ tileX, tileY };
-                if (!MapIsLocationValid(location))
-                    continue;
-
-                for (auto* trackElement : TileElementsView<TrackElement>(location))
+                if (RideIsVisibleFromAnywhere(ride))
                 {
-                    auto rideIndex = trackElement->GetRideIndex();
-                    if (!rideIndex.IsNull())
-                    {
-                        rideConsideration[rideIndex.ToUnderlying()] = true;
-                    }
+                    rideConsideration[ride.id.ToUnderlying()] = true;
                 }
             }
         }
+    }
 
-        // Always take the tall rides into consideration (realistic as you can usually see them from anywhere in the park)
-        for (auto& ride : GetRideManager())
+    return rideConsideration;
+}
+
+OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark> GuestFindNearbyRides(const Guest& guest)
+{
+    OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark> nearbyRides;
+
+    constexpr auto radius = 10 * 32;
+    int32_t cx = Floor2(guest.x, 32);
+    int32_t cy = Floor2(guest.y, 32);
+    for (auto [location, trackElement] :
+         TileElementsRangeView<TrackElement>(MapRange{ cx - radius, cy - radius, cx + radius, cy + radius }))
+    {
+        auto rideIndex = trackElement->GetRideIndex();
+        if (!rideIndex.IsNull())
         {
-            if (ride.highest_drop_height > 66 || ride.excitement >= RIDE_RATING(8, 00))
-            {
-                rideConsideration[ride.id.ToUnderlying()] = true;
-            }
+            nearbyRides[rideIndex.ToUnderlying()] = true;
         }
     }
 
-    return rideConsideration;
+    return nearbyRides;
 }
 
 /**
@@ -1930,12 +2035,12 @@ bool Guest::ShouldGoOnRide(Ride& ride, StationIndex entranceNum, bool atQueue, b
     // Indicates whether a peep is physically at the ride, or is just thinking about going on the ride.
     bool peepAtRide = !thinking;
 
-    if (ride.status == RideStatus::Open && !(ride.lifecycle_flags & RIDE_LIFECYCLE_BROKEN_DOWN))
+    const auto attributes = RideChoiceGetAttributes(ride);
+    if (attributes.IsOpen)
     {
         // Peeps that are leaving the park will refuse to go on any rides, with the exception of free transport rides.
         assert(ride.type < std::size(RideTypeDescriptors));
-        if (!ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_TRANSPORT_RIDE) || ride.value == RIDE_VALUE_UNDEFINED
-            || RideGetPrice(ride) != 0)
+        if (!attributes.IsFreeTransport)
         {
             if (PeepFlags & PEEP_FLAGS_LEAVING_PARK)
             {
@@ -1944,7 +2049,7 @@ bool Guest::ShouldGoOnRide(Ride& ride, StationIndex entranceNum, bool atQueue, b
             }
         }
 
-        if (ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_IS_SHOP_OR_FACILITY))
+        if (attributes.IsShopOrFacility)
         {
             return ShouldGoToShop(ride, peepAtRide);
         }
@@ -1994,9 +2099,8 @@ bool Guest::ShouldGoOnRide(Ride& ride, StationIndex entranceNum, bool atQueue, b
 
         // Assuming the queue conditions are met, peeps will always go on free transport rides.
         // Ride ratings, recent crashes and weather will all be ignored.
-        auto ridePrice = RideGetPrice(ride);
-        if (!ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_TRANSPORT_RIDE) || ride.value == RIDE_VALUE_UNDEFINED
-            || ridePrice != 0)
+        auto ridePrice = attributes.Price;
+        if (!attributes.IsFreeTransport)
         {
             if (PreviousRide == ride.id)
             {
@@ -2042,7 +2146,7 @@ bool Guest::ShouldGoOnRide(Ride& ride, StationIndex entranceNum, bool atQueue, b
                 return false;
             }
 
-            if (RideHasRatings(ride))
+            if (attributes.HasRatings)
             {
                 // If a peep has already decided that they're going to go on a ride, they'll skip the weather and
                 // excitement check and will only do a basic intensity check when they arrive at the ride itself.
@@ -2132,7 +2236,7 @@ bool Guest::ShouldGoOnRide(Ride& ride, StationIndex entranceNum, bool atQueue, b
 
             // If the ride has not yet been rated and is capable of having g-forces,
             // there's a 90% chance that the peep will ignore it.
-            if (!RideHasRatings(ride) && ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_PEEP_CHECK_GFORCES))
+            if (!attributes.HasRatings && ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_PEEP_CHECK_GFORCES))
             {
                 if ((ScenarioRand() & 0xFFFF) > 0x1999U)
                 {
@@ -2162,7 +2266,6 @@ bool Guest::ShouldGoOnRide(Ride& ride, StationIndex entranceNum, bool atQueue, b
                     value /= 4;
 
                 // Peeps won't pay more than twice the value of the ride.
-                ridePrice = RideGetPrice(ride);
                 if (ridePrice > (value * 2))
                 {
                     if (peepAtRide)
@@ -2231,7 +2334,7 @@ bool Guest::ShouldGoToShop(Ride& ride, bool peepAtShop)
 
         // The amount that peeps are willing to pay to use the Toilets scales with their toilet stat.
         // It effectively has a minimum of $0.10 (due to the check above) and a maximum of $0.60.
-        if (RideGetPrice(ride) * 40 > Toilet)
+        if (RideChoiceGetAttributes(ride).Price * 40 > Toilet)
         {
             if (peepAtShop)
             {
@@ -2257,7 +2360,7 @@ bool Guest::ShouldGoToShop(Ride& ride, bool peepAtShop)
     }
 
     // Basic price checks
-    auto ridePrice = RideGetPrice(ride);
+    auto ridePrice = RideChoiceGetAttributes(ride).Price;
     if (ridePrice != 0 && ridePrice > CashInPocket)
     {
         if (peepAtShop)
@@ -2319,6 +2422,7 @@ void Guest::SpendMoney(money64& peep_expend_type, money64 amount, ExpenditureTyp
 void Guest::SetHasRidden(const Ride& ride)
 {
     OpenRCT2::RideUse::GetHistory().Add(Id, ride.id);
+    WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_RIDES;
 
     SetHasRiddenRideType(ride.type);
 }
@@ -2348,11 +2452,23 @@ int32_t Guest::GetParkEntryTime() const
     return ParkEntryTime;
 }
 
+void Guest::SetHappiness(uint8_t happiness)
+{
+    if (Happiness != happiness)
+        WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_STATS;
+    Happiness = happiness;
+    GuestHotFieldsUpdate(*this);
+}
+
+void Guest::SetFavouriteRide(RideId rideId)
+{
+    FavouriteRide = rideId;
+    GuestHotFieldsUpdate(*this);
+}
+
 bool Guest::ShouldRideWhileRaining(const Ride& ride)
 {
-    // Peeps will go on rides that are sufficiently undercover while it's raining.
-    // The threshold is fairly low and only requires about 10-15% of the ride to be undercover.
-    if (ride.sheltered_eighths >= 3)
+    if (RideChoiceGetAttributes(ride).IsSheltered)
     {
         return true;
     }
@@ -3160,27 +3276,18 @@ template<typename T> static void PeepHeadForNearestRide(Guest* peep, bool consid
         constexpr auto searchRadius = 10 * 32;
         int32_t cx = Floor2(peep->x, 32);
         int32_t cy = Floor2(peep->y, 32);
-        for (auto x = cx - searchRadius; x <= cx + searchRadius; x += COORDS_XY_STEP)
+        const auto searchRange = MapRange{ cx - searchRadius, cy - searchRadius, cx + searchRadius, cy + searchRadius };
+        for (auto [location, trackElement] : TileElementsRangeView<TrackElement>(searchRange))
         {
-            for (auto y = cy - searchRadius; y <= cy + searchRadius; y += COORDS_XY_STEP)
-            {
-                auto location = CoordsXY{ x, y };
-                if (!MapIsLocationValid(location))
-                    continue;
-
-                for (auto* trackElement : TileElementsView<TrackElement>(location))
-                {
-                    auto rideIndex = trackElement->GetRideIndex();
-                    auto ride = GetRide(rideIndex);
-                    if (ride == nullptr)
-                        continue;
+            auto rideIndex = trackElement->GetRideIndex();
+            auto ride = GetRide(rideIndex);
+            if (ride == nullptr)
+                continue;
 
-                    if (!predicate(*ride))
-                        continue;
+            if (!predicate(*ride))
+                continue;
 
-                    rideConsideration[ride->id.ToUnderlying()] = true;
-                }
-            }
+            rideConsideration[ride->id.ToUnderlying()] = true;
         }
     }
 
@@ -5099,12 +5206,13 @@ void Guest::UpdateRideShopInteract()
 
             SetDestination({ tileCentreX, tileCentreY }, 3);
             HappinessTarget = std::min(HappinessTarget + 30, PEEP_MAX_HAPPINESS);
-            Happiness = HappinessTarget;
+            SetHappiness(HappinessTarget);
         }
         else
         {
             Nausea--;
             NauseaTarget = Nausea;
+            WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_STATS;
         }
         return;
     }
@@ -5112,6 +5220,7 @@ void Guest::UpdateRideShopInteract()
     if (Toilet != 0)
     {
         Toilet--;
+        WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_STATS;
         return;
     }
 
@@ -5126,7 +5235,7 @@ void Guest::UpdateRideShopInteract()
     SetDestination({ tileCentreX, tileCentreY }, 3);
 
     HappinessTarget = std::min(HappinessTarget + 30, PEEP_MAX_HAPPINESS);
-    Happiness = HappinessTarget;
+    SetHappiness(HappinessTarget);
     StopPurchaseThought(ride->type);
 }
 
@@ -5509,7 +5618,7 @@ void Guest::UpdateWalking()
     for (; !(positions_free & (1 << chosen_position));)
         chosen_position = (chosen_position + 1) & 3;
 
-    CurrentRide = ride_to_view;
+    SetCurrentRide(ride_to_view);
     CurrentSeat = ride_seat_to_view;
     Var37 = chosen_edge | (chosen_position << 2);
 
@@ -7116,7 +7225,7 @@ Guest* Guest::Generate(const CoordsXYZ& coords)
     peep->WalkingFrameNum = 0;
     peep->ActionSpriteType = PeepActionSpriteType::None;
     peep->PeepFlags = 0;
-    peep->FavouriteRide = RideId::GetNull();
+    peep->SetFavouriteRide(RideId::GetNull());
     peep->FavouriteRideRating = 0;
 
     const SpriteBounds* spriteBounds = &GetSpriteBounds(peep->SpriteType, peep->ActionSpriteType);
@@ -7173,15 +7282,15 @@ Guest* Guest::Generate(const CoordsXYZ& coords)
     /* Scenario editor limits initial guest happiness to between 37..253.
      * To be on the safe side, assume the value could have been hacked
      * to any value 0..255. */
-    peep->Happiness = gameState.GuestInitialHappiness;
+    peep->SetHappiness(gameState.GuestInitialHappiness);
     /* Assume a default initial happiness of 0 is wrong and set
      * to 128 (50%) instead. */
     if (gameState.GuestInitialHappiness == 0)
-        peep->Happiness = 128;
+        peep->SetHappiness(128);
     /* Initial value will vary by -15..16 */
     int8_t happinessDelta = (ScenarioRand() & 0x1F) - 15;
     /* Adjust by the delta, clamping at min=0 and max=255. */
-    peep->Happiness = std::clamp(peep->Happiness + happinessDelta, 0, PEEP_MAX_HAPPINESS);
+    peep->SetHappiness(std::clamp(peep->Happiness + happinessDelta, 0, PEEP_MAX_HAPPINESS));
     peep->HappinessTarget = peep->Happiness;
     peep->Nausea = 0;
     peep->NauseaTarget = 0;
@@ -7260,7 +7369,7 @@ Guest* Guest::Generate(const CoordsXYZ& coords)
     /* Minimum energy is capped at 32 and maximum at 128, so this initialises
      * a peep with approx 34%-100% energy. (65 - 32) / (128 - 32) ≈ 34% */
     uint8_t energy = (ScenarioRand() % 64) + 65;
-    peep->Energy = energy;
+    peep->SetEnergy(energy);
     peep->EnergyTarget = energy;
 
     IncrementGuestsHeadingForPark();
@@ -7551,7 +7660,7 @@ void Guest::RemoveRideFromMemory(RideId rideId)
     {
         if (CurrentRide == rideId)
         {
-            CurrentRide = RideId::GetNull();
+            SetCurrentRide(RideId::GetNull());
             if (TimeToStand >= 50)
             {
                 // make peep stop watching the ride
@@ -7605,7 +7714,7 @@ void Guest::RemoveRideFromMemory(RideId rideId)
     }
     if (FavouriteRide == rideId)
     {
-        FavouriteRide = RideId::GetNull();
+        SetFavouriteRide(RideId::GetNull());
     }
 
     // Erase all thoughts that contain the ride.
@@ -350,6 +350,8 @@ public:
     bool HasRiddenRideType(int32_t rideType) const;
     void SetParkEntryTime(int32_t entryTime);
     int32_t GetParkEntryTime() const;
+    void SetHappiness(uint8_t happiness);
+    void SetFavouriteRide(RideId rideId);
     void CheckIfLost();
     void CheckCantFindRide();
     void CheckCantFindExit();
@@ -428,6 +430,14 @@ private:
 };
 
 void UpdateRideApproachVehicleWaypointsMotionSimulator(Guest&, const CoordsXY&, int16_t&);
+
+// Rides with track within 10 tiles of the guest, only reads tile elements so it is safe to call from worker threads.
+OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark> GuestFindNearbyRides(const Guest& guest);
+// Nearby rides resolved ahead of time by the decide phase of PeepUpdateAll, nullptr if none are available.
+const OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark>* PeepGetDecidedNearbyRides(const Guest& guest);
+// Precomputes the guest independent ride choice inputs for the duration of a guest update pass.
+void GuestRideChoiceTableBuild();
+void GuestRideChoiceTableClear();
 void UpdateRideApproachVehicleWaypointsDefault(Guest&, const CoordsXY&, int16_t&);
 
 static_assert(sizeof(Guest) <= 512);
@@ -0,0 +1,80 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "GuestHotFields.h"
+
+#include "EntityList.h"
+#include "Guest.h"
+
+static GuestHotFields CreateGuestHotFields()
+{
+    GuestHotFields hotFields{};
+    hotFields.FavouriteRide.fill(RideId::GetNull());
+    return hotFields;
+}
+
+static GuestHotFields _guestHotFields = CreateGuestHotFields();
+
+const GuestHotFields& GetGuestHotFields()
+{
+    return _guestHotFields;
+}
+
+static void SetFavouriteRide(size_t index, RideId rideId)
+{
+    auto& favouriteRide = _guestHotFields.FavouriteRide[index];
+    if (favouriteRide == rideId)
+        return;
+
+    auto& counts = _guestHotFields.FavouriteRideGuestCount;
+    if (!favouriteRide.IsNull() && favouriteRide.ToUnderlying() < counts.size())
+        counts[favouriteRide.ToUnderlying()]--;
+    if (!rideId.IsNull() && rideId.ToUnderlying() < counts.size())
+        counts[rideId.ToUnderlying()]++;
+    favouriteRide = rideId;
+}
+
+void GuestHotFieldsUpdate(const EntityBase& entity)
+{
+    if (entity.Type != EntityType::Guest)
+        return;
+
+    const auto& guest = static_cast<const Guest&>(entity);
+    const auto index = guest.Id.ToUnderlying();
+    if (index >= MAX_ENTITIES)
+        return;
+
+    _guestHotFields.Location[index] = guest.GetLocation();
+    _guestHotFields.Happiness[index] = guest.Happiness;
+    _guestHotFields.Energy[index] = guest.Energy;
+    SetFavouriteRide(index, guest.FavouriteRide);
+    _guestHotFields.CurrentRide[index] = guest.CurrentRide;
+}
+
+void GuestHotFieldsRemove(const EntityBase& entity)
+{
+    if (entity.Type != EntityType::Guest)
+        return;
+
+    const auto index = entity.Id.ToUnderlying();
+    if (index >= MAX_ENTITIES)
+        return;
+
+    SetFavouriteRide(index, RideId::GetNull());
+}
+
+void GuestHotFieldsRebuild()
+{
+    _guestHotFields.FavouriteRide.fill(RideId::GetNull());
+    _guestHotFields.FavouriteRideGuestCount.fill(0);
+    for (auto* guest : EntityList<Guest>())
+    {
+        GuestHotFieldsUpdate(*guest);
+    }
+}
@@ -0,0 +1,44 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../Identifiers.h"
+#include "../Limits.h"
+#include "../world/Location.hpp"
+#include "EntityRegistry.h"
+
+#include <array>
+
+struct EntityBase;
+
+/**
+ * Structure-of-arrays copy of the guest fields that aggregate passes read, indexed by entity id. Only the slots of live
+ * guests are meaningful, iterate GetEntityList(EntityType::Guest) to find them.
+ */
+struct GuestHotFields
+{
+    std::array<CoordsXYZ, MAX_ENTITIES> Location;
+    std::array<uint8_t, MAX_ENTITIES> Happiness;
+    std::array<uint8_t, MAX_ENTITIES> Energy;
+    std::array<RideId, MAX_ENTITIES> FavouriteRide;
+    std::array<RideId, MAX_ENTITIES> CurrentRide;
+
+    // Number of live guests whose FavouriteRide is the ride, indexed by ride id. Kept up to date by the same updates.
+    std::array<uint32_t, OpenRCT2::Limits::MaxRidesInPark> FavouriteRideGuestCount;
+};
+
+const GuestHotFields& GetGuestHotFields();
+
+// Copies the hot fields of the entity if it is a guest, called by the setters of the mirrored fields.
+void GuestHotFieldsUpdate(const EntityBase& entity);
+// Stops counting a guest that is about to be freed.
+void GuestHotFieldsRemove(const EntityBase& entity);
+// Refreshes all guests, required after entity memory has been written directly such as when loading a park.
+void GuestHotFieldsRebuild();
@@ -12,8 +12,20 @@
 #include "EntityList.h"
 #include "EntityRegistry.h"
 
+#include <algorithm>
+#include <set>
+#include <utility>
+
 using namespace OpenRCT2;
 
+// The original game allows 500 pieces of litter, which is kept for maps up to 256x256. Larger maps get a cap in
+// proportion to their area so litter can still build up across the whole park.
+constexpr size_t kLitterCap = 500;
+constexpr size_t kLitterCapMapArea = 256 * 256;
+
+// All litter ordered by creation tick and then id, the last entry is the newest piece.
+static std::set<std::pair<uint32_t, EntityId>> _litterByCreation;
+
 template<> bool EntityBase::Is<Litter>() const
 {
     return Type == EntityType::Litter;
@@ -43,6 +55,13 @@ static bool IsLocationLitterable(const CoordsXYZ& mapPos)
     return false;
 }
 
+static size_t GetLitterCap()
+{
+    const auto& mapSize = GetGameState().MapSize;
+    const auto mapArea = static_cast<size_t>(mapSize.x) * static_cast<size_t>(mapSize.y);
+    return std::max(kLitterCap, kLitterCap * mapArea / kLitterCapMapArea);
+}
+
 /**
  *
  *  rct2: 0x0067375D
@@ -59,19 +78,9 @@ void Litter::Create(const CoordsXYZD& litterPos, Type type)
     if (!IsLocationLitterable(offsetLitterPos))
         return;
 
-    if (GetEntityListCount(EntityType::Litter) >= 500)
+    if (GetEntityListCount(EntityType::Litter) >= GetLitterCap() && !_litterByCreation.empty())
     {
-        Litter* newestLitter = nullptr;
-        uint32_t newestLitterCreationTick = 0;
-        for (auto litter : EntityList<Litter>())
-        {
-            if (newestLitterCreationTick <= litter->creationTick)
-            {
-                newestLitterCreationTick = litter->creationTick;
-                newestLitter = litter;
-            }
-        }
-
+        auto* newestLitter = GetEntity<Litter>(_litterByCreation.rbegin()->second);
         if (newestLitter != nullptr)
         {
             newestLitter->Invalidate();
@@ -89,7 +98,7 @@ void Litter::Create(const CoordsXYZD& litterPos, Type type)
     litter->SpriteData.HeightMax = 3;
     litter->SubType = type;
     litter->MoveTo(offsetLitterPos);
-    litter->creationTick = GetGameState().CurrentTicks;
+    litter->SetCreationTick(GetGameState().CurrentTicks);
 }
 
 /**
@@ -143,6 +152,36 @@ uint32_t Litter::GetAge() const
     return GetGameState().CurrentTicks - creationTick;
 }
 
+void Litter::SetCreationTick(uint32_t tick)
+{
+    _litterByCreation.erase({ creationTick, Id });
+    creationTick = tick;
+    _litterByCreation.emplace(creationTick, Id);
+}
+
+void LitterIndexAdd(const EntityBase& entity)
+{
+    const auto* litter = entity.As<Litter>();
+    if (litter != nullptr)
+        _litterByCreation.emplace(litter->creationTick, litter->Id);
+}
+
+void LitterIndexRemove(const EntityBase& entity)
+{
+    const auto* litter = entity.As<Litter>();
+    if (litter != nullptr)
+        _litterByCreation.erase({ litter->creationTick, litter->Id });
+}
+
+void LitterIndexRebuild()
+{
+    _litterByCreation.clear();
+    for (auto* litter : EntityList<Litter>())
+    {
+        LitterIndexAdd(*litter);
+    }
+}
+
 void Litter::Serialise(DataSerialiser& stream)
 {
     EntityBase::Serialise(stream);
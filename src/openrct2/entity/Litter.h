@@ -42,5 +42,12 @@ struct Litter : EntityBase
     void Serialise(DataSerialiser& stream);
     StringId GetName() const;
     uint32_t GetAge() const;
+    void SetCreationTick(uint32_t tick);
     void Paint(PaintSession& session, int32_t imageDirection) const;
 };
+
+// Keep the creation ordered index of litter up to date, called by the entity registry alongside the entity lists.
+void LitterIndexAdd(const EntityBase& entity);
+void LitterIndexRemove(const EntityBase& entity);
+// Required after entity memory has been written directly such as when loading a park.
+void LitterIndexRebuild();
@@ -53,8 +53,13 @@ template<> bool EntityBase::Is<CrashSplashParticle>() const
  */
 void VehicleCrashParticle::Create(VehicleColour& colours, const CoordsXYZ& vehiclePos)
 {
-    VehicleCrashParticle* sprite = CreateEntity<VehicleCrashParticle>();
-    if (sprite != nullptr)
+    Create(colours, vehiclePos, 1);
+}
+
+void VehicleCrashParticle::Create(VehicleColour& colours, const CoordsXYZ& vehiclePos, size_t count)
+{
+    // Allocated in one go, the ids and random numbers match creating them one by one
+    for (auto* sprite : CreateEntities<VehicleCrashParticle>(count))
     {
         sprite->colour[0] = colours.Body;
         sprite->colour[1] = colours.Trim;
@@ -30,6 +30,7 @@ struct VehicleCrashParticle : EntityBase
     int32_t acceleration_y;
     int32_t acceleration_z;
     static void Create(VehicleColour& colours, const CoordsXYZ& vehiclePos);
+    static void Create(VehicleColour& colours, const CoordsXYZ& vehiclePos, size_t count);
     void Update();
     void Serialise(DataSerialiser& stream);
     void Paint(PaintSession& session, int32_t imageDirection) const;
@@ -9,20 +9,15 @@
 
 #include "PatrolArea.h"
 
-#include "../core/Algorithm.hpp"
 #include "EntityList.h"
 #include "Staff.h"
 
+#include <algorithm>
+#include <bit>
+
 static PatrolArea _consolidatedPatrolArea[EnumValue(StaffType::Count)];
 static std::variant<StaffType, EntityId> _patrolAreaToRender;
 
-static bool CompareTileCoordsXY(const TileCoordsXY& lhs, const TileCoordsXY& rhs)
-{
-    if (lhs.y == rhs.y)
-        return lhs.x < rhs.x;
-    return lhs.y < rhs.y;
-}
-
 const PatrolArea::Cell* PatrolArea::GetCell(const TileCoordsXY& pos) const
 {
     return const_cast<PatrolArea*>(this)->GetCell(pos);
@@ -30,6 +25,9 @@ const PatrolArea::Cell* PatrolArea::GetCell(const TileCoordsXY& pos) const
 
 PatrolArea::Cell* PatrolArea::GetCell(const TileCoordsXY& pos)
 {
+    if (pos.x < 0 || pos.y < 0)
+        return nullptr;
+
     auto areaPos = TileCoordsXY(pos.x / Cell::Width, pos.y / Cell::Height);
     if (areaPos.x < 0 || areaPos.x >= CellColumns || areaPos.y < 0 || areaPos.y >= CellRows)
         return nullptr;
@@ -47,8 +45,10 @@ void PatrolArea::Clear()
 {
     for (auto& area : Areas)
     {
-        area.SortedTiles.clear();
+        area.Rows.clear();
+        area.TileCount = 0;
     }
+    TileCount = 0;
 }
 
 bool PatrolArea::Get(const TileCoordsXY& pos) const
@@ -57,9 +57,11 @@ bool PatrolArea::Get(const TileCoordsXY& pos) const
     if (area == nullptr)
         return false;
 
-    auto it = BinaryFind(area->SortedTiles.begin(), area->SortedTiles.end(), pos, CompareTileCoordsXY);
-    auto found = it != area->SortedTiles.end();
-    return found;
+    if (area->TileCount == 0)
+        return false;
+
+    auto row = area->Rows[pos.y % Cell::Height];
+    return (row >> (pos.x % Cell::Width)) & 1;
 }
 
 bool PatrolArea::Get(const CoordsXY& pos) const
@@ -73,19 +75,33 @@ void PatrolArea::Set(const TileCoordsXY& pos, bool value)
     if (area == nullptr)
         return;
 
-    auto it = std::lower_bound(area->SortedTiles.begin(), area->SortedTiles.end(), pos, CompareTileCoordsXY);
-    auto found = it != area->SortedTiles.end() && *it == pos;
+    SetRowBits(*area, pos.y % Cell::Height, uint64_t{ 1 } << (pos.x % Cell::Width), value);
+}
+
+void PatrolArea::SetRowBits(Cell& cell, int32_t row, uint64_t mask, bool value)
+{
+    if (cell.Rows.empty())
+    {
+        if (!value)
+            return;
+        cell.Rows.resize(Cell::Height);
+    }
 
-    if (!found && value)
+    auto& bits = cell.Rows[row];
+    if (value)
     {
-        area->SortedTiles.insert(it, pos);
-        TileCount++;
+        auto added = static_cast<size_t>(std::popcount(mask & ~bits));
+        bits |= mask;
+        cell.TileCount += static_cast<uint16_t>(added);
+        TileCount += added;
     }
-    else if (found && !value)
+    else
     {
-        area->SortedTiles.erase(it);
-        assert(TileCount != 0);
-        TileCount--;
+        auto removed = static_cast<size_t>(std::popcount(mask & bits));
+        bits &= ~mask;
+        assert(cell.TileCount >= removed && TileCount >= removed);
+        cell.TileCount -= static_cast<uint16_t>(removed);
+        TileCount -= removed;
     }
 }
 
@@ -94,13 +110,46 @@ void PatrolArea::Set(const CoordsXY& pos, bool value)
     Set(TileCoordsXY(pos), value);
 }
 
+void PatrolArea::SetRange(const TileCoordsXY& start, const TileCoordsXY& end, bool value)
+{
+    // Tiles outside of the cells can never be set, so clip the range to them first
+    auto left = std::max(start.x, 0);
+    auto top = std::max(start.y, 0);
+    auto right = std::min(end.x, (CellColumns * Cell::Width) - 1);
+    auto bottom = std::min(end.y, (CellRows * Cell::Height) - 1);
+    if (left > right || top > bottom)
+        return;
+
+    for (auto cellX = left / Cell::Width; cellX <= right / Cell::Width; cellX++)
+    {
+        // Build the mask of the columns covered within this column of cells
+        auto firstBit = std::max(left - (cellX * Cell::Width), 0);
+        auto lastBit = std::min(right - (cellX * Cell::Width), Cell::Width - 1);
+        auto numBits = lastBit - firstBit + 1;
+        auto mask = (numBits == Cell::Width ? ~uint64_t{ 0 } : ((uint64_t{ 1 } << numBits) - 1)) << firstBit;
+
+        for (auto y = top; y <= bottom; y++)
+        {
+            auto& area = Areas[((y / Cell::Height) * CellColumns) + cellX];
+            SetRowBits(area, y % Cell::Height, mask, value);
+        }
+    }
+}
+
 void PatrolArea::Union(const PatrolArea& other)
 {
     for (size_t i = 0; i < Areas.size(); i++)
     {
-        for (const auto& pos : other.Areas[i].SortedTiles)
+        const auto& otherArea = other.Areas[i];
+        if (otherArea.TileCount == 0)
+            continue;
+
+        for (int32_t row = 0; row < Cell::Height; row++)
         {
-            Set(pos, true);
+            if (otherArea.Rows[row] != 0)
+            {
+                SetRowBits(Areas[i], row, otherArea.Rows[row], true);
+            }
         }
     }
 }
@@ -116,11 +165,24 @@ void PatrolArea::Union(const std::vector<TileCoordsXY>& other)
 std::vector<TileCoordsXY> PatrolArea::ToVector() const
 {
     std::vector<TileCoordsXY> result;
-    for (const auto& area : Areas)
+    result.reserve(TileCount);
+    for (size_t i = 0; i < Areas.size(); i++)
     {
-        for (const auto& pos : area.SortedTiles)
+        const auto& area = Areas[i];
+        if (area.TileCount == 0)
+            continue;
+
+        auto baseX = static_cast<int32_t>(i % CellColumns) * Cell::Width;
+        auto baseY = static_cast<int32_t>(i / CellColumns) * Cell::Height;
+        for (int32_t row = 0; row < Cell::Height; row++)
         {
-            result.push_back(pos);
+            auto bits = area.Rows[row];
+            while (bits != 0)
+            {
+                auto column = std::countr_zero(bits);
+                result.emplace_back(baseX + column, baseY + row);
+                bits &= bits - 1;
+            }
         }
     }
     return result;
@@ -12,6 +12,7 @@
 #include "../world/Map.h"
 #include "Peep.h"
 
+#include <cstdint>
 #include <variant>
 
 // The number of elements in the GameState_t.StaffPatrolAreas array per staff member. Every bit in the array represents a 4x4
@@ -28,8 +29,11 @@ private:
         static constexpr auto Width = 64;
         static constexpr auto Height = 64;
         static constexpr auto NumTiles = Width * Height;
+        static_assert(Width == 64, "A row of tiles in a cell is stored as one 64-bit word.");
 
-        std::vector<TileCoordsXY> SortedTiles;
+        // One word per row of tiles, only allocated once a tile in the cell is set.
+        std::vector<uint64_t> Rows;
+        uint16_t TileCount{};
     };
 
     static constexpr auto CellColumns = (kMaximumMapSizeTechnical + (Cell::Width - 1)) / Cell::Width;
@@ -41,6 +45,7 @@ private:
 
     const Cell* GetCell(const TileCoordsXY& pos) const;
     Cell* GetCell(const TileCoordsXY& pos);
+    void SetRowBits(Cell& cell, int32_t row, uint64_t mask, bool value);
 
 public:
     bool IsEmpty() const;
@@ -49,6 +54,7 @@ public:
     bool Get(const CoordsXY& pos) const;
     void Set(const TileCoordsXY& pos, bool value);
     void Set(const CoordsXY& pos, bool value);
+    void SetRange(const TileCoordsXY& start, const TileCoordsXY& end, bool value);
     void Union(const PatrolArea& other);
     void Union(const std::vector<TileCoordsXY>& other);
     std::vector<TileCoordsXY> ToVector() const;
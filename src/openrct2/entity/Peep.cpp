@@ -21,10 +21,13 @@
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../core/JobPool.h"
 #include "../drawing/LightFX.h"
 #include "../entity/Balloon.h"
 #include "../entity/EntityRegistry.h"
 #include "../entity/EntityTweener.h"
+#include "../entity/GuestHotFields.h"
+#include "../entity/PeepStringCache.h"
 #include "../interface/Window_internal.h"
 #include "../localisation/Formatter.h"
 #include "../localisation/Formatting.h"
@@ -185,6 +188,122 @@ int32_t PeepGetStaffCount()
     return GetEntityListCount(EntityType::Staff);
 }
 
+/**
+ * Results of the read-only decide phase of PeepUpdateAll. Everything in here is derived from state that does not change
+ * while guests are being updated (tile elements and the vehicle blocking flags), so a decision is valid for as long as
+ * the guest is still on the tile it was made for. The commit phase falls back to computing the value itself otherwise.
+ */
+struct GuestUpdateDecision
+{
+    EntityId Id;
+    TileCoordsXYZ Location;
+    bool PathBlockedByVehicle{};
+    bool HasNearbyRides{};
+    BitSet<OpenRCT2::Limits::MaxRidesInPark> NearbyRides;
+};
+
+static constexpr size_t kGuestDecisionMinGuests = 512;
+static constexpr size_t kGuestDecisionBatchSize = 256;
+
+static std::unique_ptr<JobPool> _guestDecisionJobs;
+static std::vector<GuestUpdateDecision> _guestDecisions;
+static const GuestUpdateDecision* _activeGuestDecision = nullptr;
+
+static bool GuestWillConsiderNearbyRides(const Guest& guest)
+{
+    // Mirrors the early outs of Guest::PickRideToGoOn, anything else is wasted work.
+    return guest.State == PeepState::Walking && guest.GuestHeadingToRideId.IsNull()
+        && !(guest.PeepFlags & PEEP_FLAGS_LEAVING_PARK) && !guest.HasFoodOrDrink() && guest.x != LOCATION_NULL
+        && !guest.HasItem(ShopItem::Map);
+}
+
+static void GuestDecide(GuestUpdateDecision& decision, bool considerRides)
+{
+    const auto* guest = GetEntity<Guest>(decision.Id);
+    if (guest == nullptr)
+        return;
+
+    decision.Location = TileCoordsXYZ(guest->GetLocation());
+    decision.PathBlockedByVehicle = FootpathIsBlockedByVehicle(decision.Location);
+    if (considerRides && GuestWillConsiderNearbyRides(*guest))
+    {
+        decision.NearbyRides = GuestFindNearbyRides(*guest);
+        decision.HasNearbyRides = true;
+    }
+}
+
+/**
+ * Whether the 128 tick bucket of a peep comes from its entity id rather than its position in the entity lists. Ids don't
+ * change when other peeps are removed and are stored in the park, so the buckets stay the same size and on load.
+ */
+static bool UseStablePeepTickBuckets()
+{
+    return gConfigGeneral.StableGuestTickBuckets && NetworkGetMode() == NETWORK_MODE_NONE;
+}
+
+/**
+ * Fans the decide phase out over the job pool. Guests are batched in entity id order and each batch only writes to its
+ * own decisions, the order in which batches finish has no influence on the result.
+ */
+static bool GuestDecideAll(uint32_t currentTicksMasked, uint32_t ticksMask, bool stableBuckets)
+{
+    const auto& guestList = GetEntityList(EntityType::Guest);
+    if (!gConfigGeneral.MultiThreading || guestList.size() < kGuestDecisionMinGuests)
+    {
+        _guestDecisionJobs.reset();
+        _guestDecisions.clear();
+        return false;
+    }
+
+    if (_guestDecisionJobs == nullptr)
+    {
+        _guestDecisionJobs = std::make_unique<JobPool>();
+    }
+
+    _guestDecisions.clear();
+    _guestDecisions.reserve(guestList.size());
+    for (auto id : guestList)
+    {
+        _guestDecisions.emplace_back().Id = id;
+    }
+
+    _guestDecisionJobs->ParallelFor(
+        0, _guestDecisions.size(), kGuestDecisionBatchSize,
+        [currentTicksMasked, ticksMask, stableBuckets](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+            {
+                auto& decision = _guestDecisions[i];
+                const auto bucket = stableBuckets ? decision.Id.ToUnderlying() : i;
+                GuestDecide(decision, (bucket & ticksMask) == currentTicksMasked);
+            }
+        });
+    return true;
+}
+
+static const GuestUpdateDecision* GuestFindDecision(size_t& cursor, EntityId id)
+{
+    // Both the decisions and the entity list are sorted by id, guests that got removed are skipped.
+    while (cursor < _guestDecisions.size() && _guestDecisions[cursor].Id.ToUnderlying() < id.ToUnderlying())
+    {
+        cursor++;
+    }
+    if (cursor < _guestDecisions.size() && _guestDecisions[cursor].Id == id)
+    {
+        return &_guestDecisions[cursor++];
+    }
+    return nullptr;
+}
+
+const BitSet<OpenRCT2::Limits::MaxRidesInPark>* PeepGetDecidedNearbyRides(const Guest& guest)
+{
+    if (_activeGuestDecision == nullptr || !_activeGuestDecision->HasNearbyRides || _activeGuestDecision->Id != guest.Id
+        || _activeGuestDecision->Location != TileCoordsXYZ(guest.GetLocation()))
+    {
+        return nullptr;
+    }
+    return &_activeGuestDecision->NearbyRides;
+}
+
 /**
  *
  *  rct2: 0x0068F0A9
@@ -201,13 +320,24 @@ void PeepUpdateAll()
     constexpr auto kTicks128Mask = 128U - 1U;
     const auto currentTicksMasked = currentTicks & kTicks128Mask;
 
+    const bool stableBuckets = UseStablePeepTickBuckets();
+    const bool hasDecisions = GuestDecideAll(currentTicksMasked, kTicks128Mask, stableBuckets);
+    size_t decisionCursor = 0;
+    GuestRideChoiceTableBuild();
+
     uint32_t index = 0;
     // Warning this loop can delete peeps
     for (auto peep : EntityList<Guest>())
     {
-        if ((index & kTicks128Mask) == currentTicksMasked)
+        if (hasDecisions)
         {
-            peep->Tick128UpdateGuest(index);
+            _activeGuestDecision = GuestFindDecision(decisionCursor, peep->Id);
+        }
+
+        const auto bucket = stableBuckets ? peep->Id.ToUnderlying() : index;
+        if ((bucket & kTicks128Mask) == currentTicksMasked)
+        {
+            peep->Tick128UpdateGuest(bucket);
         }
 
         // 128 tick can delete so double check its not deleted
@@ -218,10 +348,13 @@ void PeepUpdateAll()
 
         index++;
     }
+    _activeGuestDecision = nullptr;
+    GuestRideChoiceTableClear();
 
     for (auto staff : EntityList<Staff>())
     {
-        if ((index & kTicks128Mask) == currentTicksMasked)
+        const auto bucket = stableBuckets ? staff->Id.ToUnderlying() : index;
+        if ((bucket & kTicks128Mask) == currentTicksMasked)
         {
             staff->Tick128UpdateStaff();
         }
@@ -307,6 +440,10 @@ bool Peep::IsOnLevelCrossing()
 bool Peep::IsOnPathBlockedByVehicle()
 {
     auto curPos = TileCoordsXYZ(GetLocation());
+    if (_activeGuestDecision != nullptr && _activeGuestDecision->Id == Id && _activeGuestDecision->Location == curPos)
+    {
+        return _activeGuestDecision->PathBlockedByVehicle;
+    }
     return FootpathIsBlockedByVehicle(curPos);
 }
 
@@ -481,7 +618,7 @@ std::optional<CoordsXY> Peep::UpdateAction(int16_t& xy_distance)
     else
         guest->Nausea -= 30;
 
-    WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_2;
+    WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_2 | PEEP_INVALIDATE_PEEP_STATS;
 
     const auto curLoc = GetLocation();
     Litter::Create({ curLoc, Orientation }, (Id.ToUnderlying() & 1) ? Litter::Type::VomitAlt : Litter::Type::Vomit);
@@ -843,6 +980,18 @@ void Peep::SetState(PeepState new_state)
     PeepWindowStateUpdate(this);
 }
 
+void Peep::SetEnergy(uint8_t energy)
+{
+    Energy = energy;
+    GuestHotFieldsUpdate(*this);
+}
+
+void Peep::SetCurrentRide(RideId rideId)
+{
+    CurrentRide = rideId;
+    GuestHotFieldsUpdate(*this);
+}
+
 /**
  *
  *  rct2: 0x690009
@@ -1210,6 +1359,82 @@ void PeepStopCrowdNoise()
     }
 }
 
+// Guests out of view are silent and queuing guests count for half
+static int32_t GetCrowdNoiseWeight(const Viewport& viewport, const Guest& guest)
+{
+    if (guest.x == LOCATION_NULL)
+        return 0;
+    if (viewport.viewPos.x > guest.SpriteData.SpriteRect.GetRight())
+        return 0;
+    if (viewport.viewPos.x + viewport.view_width < guest.SpriteData.SpriteRect.GetLeft())
+        return 0;
+    if (viewport.viewPos.y > guest.SpriteData.SpriteRect.GetBottom())
+        return 0;
+    if (viewport.viewPos.y + viewport.view_height < guest.SpriteData.SpriteRect.GetTop())
+        return 0;
+
+    return guest.State == PeepState::Queuing ? 1 : 2;
+}
+
+/**
+ * Counts the crowd noise of the guests visible in the viewport by only looking at the tiles that can appear in it, unless
+ * the view covers more tiles than there are guests.
+ */
+static int32_t CountCrowdNoise(const Viewport& viewport)
+{
+    // Guest sprites extend well under this distance from the point they stand on
+    constexpr int32_t kSpriteMargin = 64;
+    const ScreenCoordsXY corners[] = {
+        { viewport.viewPos.x - kSpriteMargin, viewport.viewPos.y - kSpriteMargin },
+        { viewport.viewPos.x + viewport.view_width + kSpriteMargin, viewport.viewPos.y - kSpriteMargin },
+        { viewport.viewPos.x - kSpriteMargin, viewport.viewPos.y + viewport.view_height + kSpriteMargin },
+        { viewport.viewPos.x + viewport.view_width + kSpriteMargin, viewport.viewPos.y + viewport.view_height + kSpriteMargin },
+    };
+
+    // Guests can stand anywhere between the bottom and the top of the map, which shifts them up the screen
+    const auto rotation = GetCurrentRotation();
+    CoordsXY min{ std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::max() };
+    CoordsXY max{ std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::min() };
+    for (const auto& corner : corners)
+    {
+        for (int32_t z : { 0, kMaximumLandHeight * COORDS_Z_STEP })
+        {
+            auto mapPos = ViewportPosToMapPos(corner, z, rotation);
+            min = CoordsXY{ std::min(min.x, mapPos.x), std::min(min.y, mapPos.y) };
+            max = CoordsXY{ std::max(max.x, mapPos.x), std::max(max.y, mapPos.y) };
+        }
+    }
+
+    const auto& mapSize = GetGameState().MapSize;
+    const auto minTile = TileCoordsXY{ std::max(min.x / COORDS_XY_STEP, 0), std::max(min.y / COORDS_XY_STEP, 0) };
+    const auto maxTile = TileCoordsXY{ std::min(max.x / COORDS_XY_STEP, mapSize.x - 1),
+                                       std::min(max.y / COORDS_XY_STEP, mapSize.y - 1) };
+
+    int32_t noise = 0;
+    const int64_t numTiles = static_cast<int64_t>(std::max(maxTile.x - minTile.x + 1, 0))
+        * std::max(maxTile.y - minTile.y + 1, 0);
+    if (numTiles > GetEntityListCount(EntityType::Guest))
+    {
+        for (auto guest : EntityList<Guest>())
+        {
+            noise += GetCrowdNoiseWeight(viewport, *guest);
+        }
+        return noise;
+    }
+
+    for (int32_t y = minTile.y; y <= maxTile.y; y++)
+    {
+        for (int32_t x = minTile.x; x <= maxTile.x; x++)
+        {
+            for (auto guest : EntityTileList<Guest>(TileCoordsXY{ x, y }.ToCoordsXY()))
+            {
+                noise += GetCrowdNoiseWeight(viewport, *guest);
+            }
+        }
+    }
+    return noise;
+}
+
 /**
  *
  *  rct2: 0x006BD18A
@@ -1232,23 +1457,7 @@ void PeepUpdateCrowdNoise()
         return;
 
     // Count the number of peeps visible
-    auto visiblePeeps = 0;
-
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->x == LOCATION_NULL)
-            continue;
-        if (viewport->viewPos.x > peep->SpriteData.SpriteRect.GetRight())
-            continue;
-        if (viewport->viewPos.x + viewport->view_width < peep->SpriteData.SpriteRect.GetLeft())
-            continue;
-        if (viewport->viewPos.y > peep->SpriteData.SpriteRect.GetBottom())
-            continue;
-        if (viewport->viewPos.y + viewport->view_height < peep->SpriteData.SpriteRect.GetTop())
-            continue;
-
-        visiblePeeps += peep->State == PeepState::Queuing ? 1 : 2;
-    }
+    auto visiblePeeps = CountCrowdNoise(*viewport);
 
     // This function doesn't account for the fact that the screen might be so big that 100 peeps could potentially be very
     // spread out and therefore not produce any crowd noise. Perhaps a more sophisticated solution would check how many peeps
@@ -1556,9 +1765,7 @@ void Peep::FormatNameTo(Formatter& ft) const
 
 std::string Peep::GetName() const
 {
-    Formatter ft;
-    FormatNameTo(ft);
-    return FormatStringIDLegacy(STR_STRINGID, ft.Data());
+    return std::string(PeepGetCachedName(*this));
 }
 
 bool Peep::SetName(std::string_view value)
@@ -1567,6 +1774,7 @@ bool Peep::SetName(std::string_view value)
     {
         std::free(Name);
         Name = nullptr;
+        PeepStringCacheInvalidate(Id);
         return true;
     }
 
@@ -1577,6 +1785,7 @@ bool Peep::SetName(std::string_view value)
         newNameMemory[value.size()] = '\0';
         std::free(Name);
         Name = newNameMemory;
+        PeepStringCacheInvalidate(Id);
         return true;
     }
     return false;
@@ -1750,7 +1959,7 @@ static bool PeepInteractWithEntrance(Peep* peep, const CoordsXYE& coords, uint8_
         guest->GuestNextInQueue = previous_last;
         station.QueueLength++;
 
-        guest->CurrentRide = rideIndex;
+        guest->SetCurrentRide(rideIndex);
         guest->CurrentRideStation = stationNum;
         guest->DaysInQueue = 0;
         guest->SetState(PeepState::Queuing);
@@ -2178,7 +2387,7 @@ static void PeepInteractWithPath(Peep* peep, const CoordsXYE& coords)
                     station.QueueLength++;
 
                     PeepDecrementNumRiders(guest);
-                    guest->CurrentRide = rideIndex;
+                    guest->SetCurrentRide(rideIndex);
                     guest->CurrentRideStation = stationNum;
                     guest->State = PeepState::Queuing;
                     guest->DaysInQueue = 0;
@@ -2296,7 +2505,7 @@ static bool PeepInteractWithShop(Peep* peep, const CoordsXYE& coords)
 
         auto coordsCentre = coords.ToTileCentre();
         guest->SetDestination(coordsCentre, 3);
-        guest->CurrentRide = rideIndex;
+        guest->SetCurrentRide(rideIndex);
         guest->SetState(PeepState::EnteringRide);
         guest->RideSubState = PeepRideSubState::ApproachShop;
 
@@ -2321,7 +2530,7 @@ static bool PeepInteractWithShop(Peep* peep, const CoordsXYE& coords)
             guest->GuestHeadingToRideId = RideId::GetNull();
         guest->ActionSpriteImageOffset = _unk_F1AEF0;
         guest->SetState(PeepState::Buying);
-        guest->CurrentRide = rideIndex;
+        guest->SetCurrentRide(rideIndex);
         guest->SubState = 0;
     }
 
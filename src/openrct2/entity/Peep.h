@@ -303,6 +303,7 @@ enum PeepInvalidate
     PEEP_INVALIDATE_PEEP_INVENTORY = 1 << 3,
     PEEP_INVALIDATE_STAFF_STATS = 1 << 4,
     PEEP_INVALIDATE_PEEP_ACTION = 1 << 5, // Currently set only when GuestHeadingToRideId is changed
+    PEEP_INVALIDATE_PEEP_RIDES = 1 << 6,  // Set when a ride is added to the rides the guest has been on
 };
 
 struct Guest;
@@ -377,6 +378,8 @@ public: // Peep
     std::optional<CoordsXY> UpdateAction(int16_t& xy_distance);
     std::optional<CoordsXY> UpdateAction();
     void SetState(PeepState new_state);
+    void SetEnergy(uint8_t energy);
+    void SetCurrentRide(RideId rideId);
     void Remove();
     void UpdateCurrentActionSpriteType();
     void SwitchToSpecialSprite(uint8_t special_sprite_id);
@@ -0,0 +1,187 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "PeepStringCache.h"
+
+#include "../GameState.h"
+#include "../localisation/Formatter.h"
+#include "../localisation/Formatting.h"
+#include "../localisation/Localisation.h"
+#include "../localisation/StringIds.h"
+#include "Guest.h"
+#include "Peep.h"
+#include "Staff.h"
+
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+namespace
+{
+    // Where a string lives in the arena.
+    struct CachedString
+    {
+        uint32_t Offset{};
+        uint32_t Length{};
+        bool Valid{};
+    };
+
+    // Besides the explicit invalidation the inputs that are cheap to compare are kept, so switching real names on or
+    // off, a staff member changing type or a new thought is picked up without the code changing them knowing the cache.
+    struct PeepStrings
+    {
+        CachedString Name;
+        uint32_t PeepId{};
+        uint8_t StaffType{};
+        bool RealNames{};
+
+        CachedString Thought;
+        PeepThoughtType ThoughtType{};
+        uint16_t ThoughtItem{};
+    };
+} // namespace
+
+// Once the arena is at least this large it is compacted when less than half of it is still in use.
+static constexpr size_t kArenaMinCompactSize = 64 * 1024;
+
+static std::vector<PeepStrings> _peepStrings;
+static std::string _arena;
+static size_t _arenaLiveBytes{};
+
+static std::string_view GetString(const CachedString& cached)
+{
+    return std::string_view(_arena.data() + cached.Offset, cached.Length);
+}
+
+static void Release(CachedString& cached)
+{
+    if (cached.Valid)
+    {
+        _arenaLiveBytes -= cached.Length + 1;
+    }
+    cached.Valid = false;
+}
+
+static void CompactArena()
+{
+    std::string arena;
+    arena.reserve(_arenaLiveBytes * 2);
+    auto move = [&arena](CachedString& cached) {
+        if (!cached.Valid)
+            return;
+
+        const auto offset = static_cast<uint32_t>(arena.size());
+        arena.append(GetString(cached));
+        arena.push_back('\0');
+        cached.Offset = offset;
+    };
+    for (auto& strings : _peepStrings)
+    {
+        move(strings.Name);
+        move(strings.Thought);
+    }
+    _arena = std::move(arena);
+}
+
+static std::string_view Store(CachedString& cached, std::string_view value)
+{
+    Release(cached);
+    if (_arena.size() >= kArenaMinCompactSize && _arenaLiveBytes * 2 < _arena.size())
+    {
+        CompactArena();
+    }
+
+    cached.Offset = static_cast<uint32_t>(_arena.size());
+    cached.Length = static_cast<uint32_t>(value.size());
+    cached.Valid = true;
+    _arena.append(value);
+    _arena.push_back('\0');
+    _arenaLiveBytes += value.size() + 1;
+    return GetString(cached);
+}
+
+static PeepStrings& GetPeepStrings(EntityId id)
+{
+    const auto index = id.ToUnderlying();
+    if (index >= _peepStrings.size())
+    {
+        _peepStrings.resize(index + 1);
+    }
+    return _peepStrings[index];
+}
+
+std::string_view PeepGetCachedName(const Peep& peep)
+{
+    auto& strings = GetPeepStrings(peep.Id);
+
+    const auto* staff = peep.As<Staff>();
+    const auto staffType = staff != nullptr ? static_cast<uint8_t>(staff->AssignedStaffType) : 0;
+    const auto realNames = (GetGameState().Park.Flags & PARK_FLAGS_SHOW_REAL_GUEST_NAMES) != 0;
+    if (strings.Name.Valid && strings.PeepId == peep.PeepId && strings.StaffType == staffType
+        && strings.RealNames == realNames)
+    {
+        return GetString(strings.Name);
+    }
+
+    Formatter ft;
+    peep.FormatNameTo(ft);
+    const auto name = FormatStringIDLegacy(STR_STRINGID, ft.Data());
+    strings.PeepId = peep.PeepId;
+    strings.StaffType = staffType;
+    strings.RealNames = realNames;
+    return Store(strings.Name, name);
+}
+
+std::string_view GuestGetCachedThought(const Guest& guest)
+{
+    const PeepThought* current = nullptr;
+    for (const auto& thought : guest.Thoughts)
+    {
+        if (thought.type == PeepThoughtType::None)
+            break;
+        if (thought.freshness != 0)
+        {
+            current = &thought;
+            break;
+        }
+    }
+    if (current == nullptr)
+        return {};
+
+    auto& strings = GetPeepStrings(guest.Id);
+    if (strings.Thought.Valid && strings.ThoughtType == current->type && strings.ThoughtItem == current->item)
+    {
+        return GetString(strings.Thought);
+    }
+
+    Formatter ft;
+    PeepThoughtSetFormatArgs(current, ft);
+    const auto text = FormatStringIDLegacy(STR_STRINGID, ft.Data());
+    strings.ThoughtType = current->type;
+    strings.ThoughtItem = current->item;
+    return Store(strings.Thought, text);
+}
+
+void PeepStringCacheInvalidate(EntityId id)
+{
+    const auto index = id.ToUnderlying();
+    if (index < _peepStrings.size())
+    {
+        Release(_peepStrings[index].Name);
+        Release(_peepStrings[index].Thought);
+    }
+}
+
+void PeepStringCacheInvalidateAll()
+{
+    _peepStrings.clear();
+    _arena.clear();
+    _arenaLiveBytes = 0;
+}
@@ -0,0 +1,35 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../Identifiers.h"
+
+#include <string_view>
+
+struct Guest;
+struct Peep;
+
+/*
+ * Formatted peep names and guest thoughts, kept per entity in one string arena so that the guest list, the plugins and
+ * the console do not format the same strings again for every guest on every frame. The returned views are null
+ * terminated and stay valid until the next call into the cache. Only to be used from the main thread.
+ */
+
+// Same text as Peep::GetName.
+std::string_view PeepGetCachedName(const Peep& peep);
+
+// Text of the current thought of the guest, the first one that is not worn off, or an empty view if there is none.
+std::string_view GuestGetCachedThought(const Guest& guest);
+
+// For a change to a single peep that the cache can not notice itself, i.e. a new custom name.
+void PeepStringCacheInvalidate(EntityId id);
+
+// For changes to what the strings are made of: the language, ride names or the entities themselves.
+void PeepStringCacheInvalidateAll();
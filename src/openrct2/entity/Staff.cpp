@@ -303,13 +303,25 @@ void Staff::SetPatrolArea(const CoordsXY& coords, bool value)
 
 void Staff::SetPatrolArea(const MapRange& range, bool value)
 {
-    for (int32_t yy = range.GetTop(); yy <= range.GetBottom(); yy += COORDS_XY_STEP)
+    if (range.GetLeft() > range.GetRight() || range.GetTop() > range.GetBottom())
+        return;
+
+    if (PatrolInfo == nullptr)
     {
-        for (int32_t xx = range.GetLeft(); xx <= range.GetRight(); xx += COORDS_XY_STEP)
+        if (value)
+        {
+            PatrolInfo = new PatrolArea();
+        }
+        else
         {
-            SetPatrolArea({ xx, yy }, value);
+            return;
         }
     }
+
+    // Only the tiles hit by stepping a whole tile at a time from the top left corner are covered
+    auto end = CoordsXY{ range.GetLeft() + ((range.GetRight() - range.GetLeft()) / COORDS_XY_STEP) * COORDS_XY_STEP,
+                         range.GetTop() + ((range.GetBottom() - range.GetTop()) / COORDS_XY_STEP) * COORDS_XY_STEP };
+    PatrolInfo->SetRange(TileCoordsXY(CoordsXY{ range.GetLeft(), range.GetTop() }), TileCoordsXY(end), value);
 }
 
 void Staff::ClearPatrolArea()
@@ -333,11 +345,21 @@ Direction Staff::HandymanDirectionToNearestLitter() const
 {
     uint16_t nearestLitterDist = 0xFFFF;
     Litter* nearestLitter = nullptr;
-    for (auto litter : EntityList<Litter>())
+    // Only litter within MAX_LITTER_DISTANCE on both axes can be accepted below.
+    const auto range = MapRange(
+        x - MAX_LITTER_DISTANCE, y - MAX_LITTER_DISTANCE, x + MAX_LITTER_DISTANCE, y + MAX_LITTER_DISTANCE);
+    if (!AnyEntitiesInRange(range, EntityType::Litter))
+    {
+        return INVALID_DIRECTION;
+    }
+
+    for (auto litter : GetEntitiesInRange<Litter>(range))
     {
         uint16_t distance = abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
 
-        if (distance < nearestLitterDist)
+        // The range query is in tile order, ties go to the lowest id like a scan of the litter list.
+        if (distance < nearestLitterDist
+            || (distance == nearestLitterDist && nearestLitter != nullptr && litter->Id < nearestLitter->Id))
         {
             nearestLitterDist = distance;
             nearestLitter = litter;
@@ -876,9 +898,20 @@ bool Staff::IsMechanicHeadingToFixRideBlockingPath()
  */
 void Staff::EntertainerUpdateNearbyPeeps() const
 {
-    for (auto guest : EntityList<Guest>())
+    constexpr int32_t kEffectRange = 96;
+    const auto range = MapRange(x - kEffectRange, y - kEffectRange, x + kEffectRange, y + kEffectRange);
+    if (!AnyEntitiesInRange(range, EntityType::Guest))
+        return;
+
+    // Reused between calls, every entertainer runs this once per path step. Each guest is visited at most once and
+    // the adjustments only depend on the guest itself, so the order of the spatial lists does not matter.
+    static std::vector<EntityId> nearbyIds;
+    nearbyIds.clear();
+    GetEntityIdsInRange(range, nearbyIds);
+    for (auto id : nearbyIds)
     {
-        if (guest->x == LOCATION_NULL)
+        auto* guest = GetEntity<Guest>(id);
+        if (guest == nullptr || guest->x == LOCATION_NULL)
             continue;
 
         int16_t z_dist = abs(z - guest->z);
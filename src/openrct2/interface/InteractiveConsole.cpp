@@ -14,6 +14,7 @@
 #include "../EditorObjectSelectionSession.h"
 #include "../Game.h"
 #include "../GameState.h"
+#include "../GameStateFork.h"
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
 #include "../ReplayManager.h"
@@ -52,9 +53,15 @@
 #include "../object/ObjectList.h"
 #include "../object/ObjectManager.h"
 #include "../object/ObjectRepository.h"
+#include "../paint/Paint.h"
 #include "../platform/Platform.h"
+#include "../profiling/FramePacing.h"
+#include "../profiling/MemoryUsage.h"
+#include "../profiling/PaintStatistics.h"
 #include "../profiling/Profiling.h"
+#include "../profiling/Telemetry.h"
 #include "../ride/Ride.h"
+#include "../scripting/ScriptEngine.h"
 #include "../ride/RideData.h"
 #include "../ride/Vehicle.h"
 #include "../util/Util.h"
@@ -66,6 +73,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cinttypes>
 #include <cmath>
 #include <cstdarg>
 #include <cstdlib>
@@ -503,7 +511,7 @@ static int32_t ConsoleCommandStaff(InteractiveConsole& console, const arguments_
                     Peep* peep = GetEntity<Peep>(EntityId::FromUnderlying(int_val[0]));
                     if (peep != nullptr)
                     {
-                        peep->Energy = int_val[1];
+                        peep->SetEnergy(int_val[1]);
                         peep->EnergyTarget = int_val[1];
                     }
                 }
@@ -1420,8 +1428,7 @@ static int32_t ConsoleCommandRemoveParkFences(InteractiveConsole& console, [[may
 
 static int32_t ConsoleCommandShowLimits(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
-    const auto& tileElements = GetTileElements();
-    const auto tileElementCount = tileElements.size();
+    const auto tileElementCount = MapGetNumTileElementsInUse();
 
     int32_t rideCount = RideGetCount();
     int32_t spriteCount = 0;
@@ -1707,6 +1714,100 @@ static int32_t ConsoleCommandReplayStop(InteractiveConsole& console, const argum
     return 0;
 }
 
+static int32_t ConsoleCommandReplaySeek(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (NetworkGetMode() != NETWORK_MODE_NONE)
+    {
+        console.WriteFormatLine("This command is currently not supported in multiplayer mode.");
+        return 0;
+    }
+
+    if (argv.size() < 1)
+    {
+        console.WriteFormatLine("Parameters required <replay_tick>");
+        return 0;
+    }
+
+    uint32_t replayTick = atol(argv[0].c_str());
+
+    auto* replayManager = OpenRCT2::GetContext()->GetReplayManager();
+    if (replayManager->SeekPlayback(replayTick))
+    {
+        console.WriteFormatLine("Replay moved to tick %u", replayTick);
+        return 1;
+    }
+
+    console.WriteFormatLine("Replay not playing");
+    return 0;
+}
+
+static int32_t ConsoleCommandFastForward(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (NetworkGetMode() != NETWORK_MODE_NONE)
+    {
+        console.WriteFormatLine("This command is currently not supported in multiplayer mode.");
+        return 0;
+    }
+
+    if (argv.size() < 1)
+    {
+        console.WriteFormatLine("Parameters required <ticks>");
+        return 0;
+    }
+
+    if (GameIsPaused())
+    {
+        console.WriteLineError("The game is paused");
+        return 1;
+    }
+
+    auto numTicks = static_cast<uint32_t>(atol(argv[0].c_str()));
+    auto numUpdates = gameStateFastForward(numTicks);
+    console.WriteFormatLine("Fast-forwarded %u ticks", numUpdates);
+    return 0;
+}
+
+static int32_t ConsoleCommandWhatIf(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (argv.size() < 1)
+    {
+        console.WriteFormatLine("Parameters required <ticks>");
+        return 0;
+    }
+
+    if (!GameStateCanFork())
+    {
+        console.WriteLineError("The game state can not be forked in multiplayer or while a replay is running");
+        return 1;
+    }
+
+    if (GameIsPaused())
+    {
+        console.WriteLineError("The game is paused");
+        return 1;
+    }
+
+    auto& gameState = GetGameState();
+    const auto ratingBefore = gameState.Park.Rating;
+    const auto guestsBefore = gameState.NumGuestsInPark;
+    const auto cashBefore = gameState.Cash;
+
+    GameStateFork fork;
+    auto numTicks = static_cast<uint32_t>(atol(argv[0].c_str()));
+    auto numUpdates = fork.Simulate(numTicks);
+    console.WriteFormatLine("After %u ticks:", numUpdates);
+    console.WriteFormatLine("  park rating: %u -> %u", ratingBefore, gameState.Park.Rating);
+    console.WriteFormatLine("  guests in park: %u -> %u", guestsBefore, gameState.NumGuestsInPark);
+    console.WriteFormatLine(
+        "  cash: %" PRId64 " -> %" PRId64, static_cast<int64_t>(cashBefore), static_cast<int64_t>(gameState.Cash));
+    if (!fork.Restore())
+    {
+        console.WriteLineError("The park could not be restored");
+        return 1;
+    }
+    return 0;
+}
+
 static int32_t ConsoleCommandReplayNormalise(InteractiveConsole& console, const arguments_t& argv)
 {
     if (NetworkGetMode() != NETWORK_MODE_NONE)
@@ -1913,6 +2014,229 @@ static int32_t ConsoleCommandProfilerExportCSV(
     return 0;
 }
 
+static int32_t ConsoleCommandProfilerExportTrace(
+    [[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    if (argv.size() < 1)
+    {
+        console.WriteLineError("Missing argument: <file path>");
+        return 1;
+    }
+
+    const auto& traceFilePath = argv[0];
+    if (!OpenRCT2::Profiling::ExportChromeTrace(traceFilePath))
+    {
+        console.WriteFormatLine("Unable to export trace file to %s", traceFilePath.c_str());
+        return 1;
+    }
+
+    console.WriteFormatLine("Wrote trace file: \"%s\"", traceFilePath.c_str());
+    return 0;
+}
+
+static int32_t ConsoleCommandProfilerCounters(
+    [[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    if (argv.size() < 1 || (argv[0] != "on" && argv[0] != "off"))
+    {
+        console.WriteLineError("Expected argument: on | off");
+        return 1;
+    }
+
+    if (argv[0] == "off")
+    {
+        OpenRCT2::Profiling::DisableHardwareCounters();
+        console.WriteLine("Stopped collecting hardware counters");
+    }
+    else if (OpenRCT2::Profiling::EnableHardwareCounters())
+    {
+        console.WriteLine("Collecting hardware counters");
+    }
+    else
+    {
+        console.WriteLineError("Hardware counters are not supported on this platform");
+        return 1;
+    }
+    return 0;
+}
+
+static int32_t ConsoleCommandLogCategory(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (argv.empty())
+    {
+        for (uint8_t i = 0; i < EnumValue(DiagnosticCategory::Count); i++)
+        {
+            auto category = static_cast<DiagnosticCategory>(i);
+            console.WriteFormatLine(
+                "%s: %s", DiagnosticGetCategoryName(category), DiagnosticIsCategoryEnabled(category) ? "on" : "off");
+        }
+        return 0;
+    }
+
+    if (argv.size() < 2 || (argv[1] != "on" && argv[1] != "off"))
+    {
+        console.WriteLineError("Expected arguments: <category> on | off");
+        return 1;
+    }
+
+    for (uint8_t i = 0; i < EnumValue(DiagnosticCategory::Count); i++)
+    {
+        auto category = static_cast<DiagnosticCategory>(i);
+        if (argv[0] == DiagnosticGetCategoryName(category))
+        {
+            DiagnosticSetCategoryEnabled(category, argv[1] == "on");
+            console.WriteFormatLine("Logging for %s is %s", argv[0].c_str(), argv[1].c_str());
+            return 0;
+        }
+    }
+
+    console.WriteLineError("Unknown log category");
+    return 1;
+}
+
+static int32_t ConsoleCommandTelemetryStats(
+    [[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    if (argv.size() < 1)
+    {
+        console.WriteFormatLine("Printing tick statistics every %d ticks", gTelemetryStatsInterval);
+        return 0;
+    }
+
+    gTelemetryStatsInterval = std::max(std::atoi(argv[0].c_str()), 0);
+    if (gTelemetryStatsInterval == 0)
+        console.WriteLine("Stopped printing tick statistics");
+    else
+        console.WriteFormatLine("Printing tick statistics every %d ticks", gTelemetryStatsInterval);
+    return 0;
+}
+
+static int32_t ConsoleCommandMemoryStats(
+    [[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    if (argv.size() >= 1 && argv[0] == "reset")
+    {
+        OpenRCT2::MemoryUsage::ResetPeaks();
+    }
+
+    size_t totalBytes = 0;
+    size_t totalPeakBytes = 0;
+    for (const auto& usage : OpenRCT2::MemoryUsage::Collect())
+    {
+        const auto name = OpenRCT2::MemoryUsage::GetSubsystemName(usage.Id);
+        console.WriteFormatLine(
+            "%-16.*s %10.1f KiB (peak %.1f KiB)", static_cast<int>(name.size()), name.data(), usage.Bytes / 1024.0,
+            usage.PeakBytes / 1024.0);
+        totalBytes += usage.Bytes;
+        totalPeakBytes += usage.PeakBytes;
+    }
+    console.WriteFormatLine("%-16s %10.1f KiB (peak %.1f KiB)", "total", totalBytes / 1024.0, totalPeakBytes / 1024.0);
+    return 0;
+}
+
+static int32_t ConsoleCommandFrameStats(
+    [[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    if (argv.size() >= 1 && argv[0] == "reset")
+    {
+        OpenRCT2::FramePacing::Reset();
+        console.WriteLine("Cleared the recorded frames");
+        return 0;
+    }
+
+    const auto summary = OpenRCT2::FramePacing::GetSummary();
+    console.WriteFormatLine(
+        "%u frames: %.2f ms avg, %.2f ms std dev, %.2f ms p99, %.2f ms max", summary.Frames, summary.MeanMs,
+        summary.StdDevMs, summary.P99Ms, summary.MaxMs);
+    console.WriteFormatLine(
+        "input latency over %u frames: %.2f ms avg, %.2f ms p95, %.2f ms max", summary.InputSamples,
+        summary.InputLatencyMeanMs, summary.InputLatencyP95Ms, summary.InputLatencyMaxMs);
+    console.WriteFormatLine("%u missed frames", summary.Missed);
+    for (size_t i = 0; i < summary.MissedByPhase.size(); i++)
+    {
+        if (summary.MissedByPhase[i] == 0)
+            continue;
+
+        const auto name = OpenRCT2::FramePacing::GetPhaseName(static_cast<OpenRCT2::FramePacing::Phase>(i));
+        console.WriteFormatLine("  %.*s: %u", static_cast<int>(name.size()), name.data(), summary.MissedByPhase[i]);
+    }
+    return 0;
+}
+
+static int32_t ConsoleCommandPaintStats(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (argv.size() >= 1)
+    {
+        if (argv[0] == "on" || argv[0] == "off")
+        {
+            gPaintStatistics = argv[0] == "on";
+            OpenRCT2::PaintStatistics::Reset();
+            GfxInvalidateScreen();
+        }
+        else if (argv[0] == "reset")
+        {
+            OpenRCT2::PaintStatistics::Reset();
+        }
+        else
+        {
+            console.WriteLineError("Unknown argument, expected on, off or reset");
+            return 1;
+        }
+    }
+
+    if (!gPaintStatistics)
+    {
+        console.WriteLine("Paint statistics are off, use paint_stats on to gather them");
+        return 0;
+    }
+
+    const auto summary = OpenRCT2::PaintStatistics::GetSummary();
+    const auto& perFrame = summary.PerFrame;
+    console.WriteFormatLine("%u painted frames in the last second, per frame:", summary.Frames);
+    console.WriteFormatLine(
+        "%u columns, %u paint structs, %u sprites drawn, %llu pixels covered", summary.Columns, perFrame.PaintStructs,
+        perFrame.SpritesDrawn, static_cast<unsigned long long>(perFrame.PixelsCovered));
+    console.WriteFormatLine(
+        "generate %.3f ms, arrange %.3f ms, draw %.3f ms", perFrame.GenerateMs, perFrame.ArrangeMs, perFrame.DrawMs);
+    if (gPaintOverdrawHeatmap)
+    {
+        console.WriteFormatLine("max overdraw %u", perFrame.MaxOverdraw);
+    }
+    return 0;
+}
+
+static int32_t ConsoleCommandPluginStats(
+    [[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+#ifdef ENABLE_SCRIPTING
+    auto& scriptEngine = OpenRCT2::GetContext()->GetScriptEngine();
+    if (argv.size() >= 1 && argv[0] == "reset")
+    {
+        scriptEngine.ResetPluginTimeStats();
+        console.WriteLine("Cleared the plugin timings");
+        return 0;
+    }
+
+    if (gConfigPlugin.TickBudget > 0)
+    {
+        console.WriteFormatLine("Tick budget: %.2f ms", gConfigPlugin.TickBudget);
+    }
+    for (const auto& plugin : scriptEngine.GetPlugins())
+    {
+        const auto& stats = plugin->GetTimeStats();
+        const auto meanMs = stats.Ticks != 0 ? stats.TotalMs / stats.Ticks : 0.0;
+        console.WriteFormatLine(
+            "%s: %.2f ms total, %.3f ms/tick avg, %.3f ms peak, %llu calls, %llu skipped, %u ticks over budget",
+            plugin->GetMetadata().Name.c_str(), stats.TotalMs, meanMs, stats.PeakTickMs,
+            static_cast<unsigned long long>(stats.Calls), static_cast<unsigned long long>(stats.SkippedCalls),
+            stats.OverBudgetTicks);
+    }
+#else
+    console.WriteLineError("Plugins are not supported in this build");
+#endif
+    return 0;
+}
+
 static int32_t ConsoleCommandProfilerStop(
     [[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
@@ -2049,6 +2373,12 @@ static constexpr ConsoleCommand console_command_table[] = {
     { "replay_stoprecord", ConsoleCommandReplayStopRecord, "Stops recording a new replay.", "replay_stoprecord" },
     { "replay_start", ConsoleCommandReplayStart, "Starts a replay", "replay_start <name>" },
     { "replay_stop", ConsoleCommandReplayStop, "Stops the replay", "replay_stop" },
+    { "replay_seek", ConsoleCommandReplaySeek, "Moves the replay to a tick, counted from its start",
+      "replay_seek <replay_tick>" },
+    { "fast_forward", ConsoleCommandFastForward, "Runs the game for a number of ticks as fast as possible",
+      "fast_forward <ticks>" },
+    { "what_if", ConsoleCommandWhatIf, "Simulates a number of ticks on a fork of the park and reports the outcome",
+      "what_if <ticks>" },
     { "replay_normalise", ConsoleCommandReplayNormalise, "Normalises the replay to remove all gaps",
       "replay_normalise <input file> <output file>" },
     { "mp_desync", ConsoleCommandMpDesync, "Forces a multiplayer desync",
@@ -2058,6 +2388,22 @@ static constexpr ConsoleCommand console_command_table[] = {
     { "profiler_stop", ConsoleCommandProfilerStop, "Stops the profiler.", "profiler_stop [<output file>]" },
     { "profiler_exportcsv", ConsoleCommandProfilerExportCSV, "Exports the current profiler data.",
       "profiler_exportcsv <output file>" },
+    { "profiler_counters", ConsoleCommandProfilerCounters, "Collects hardware performance counters with the profiler.",
+      "profiler_counters <on|off>" },
+    { "log_category", ConsoleCommandLogCategory, "Lists the log categories or turns one on or off.",
+      "log_category [<category> <on|off>]" },
+    { "telemetry_stats", ConsoleCommandTelemetryStats, "Prints tick statistics every given number of ticks, 0 stops.",
+      "telemetry_stats [<ticks>]" },
+    { "memory_stats", ConsoleCommandMemoryStats, "Prints the memory used by each subsystem, reset clears the peaks.",
+      "memory_stats [reset]" },
+    { "frame_stats", ConsoleCommandFrameStats,
+      "Prints frame time variance, input latency and why frames missed their deadline.", "frame_stats [reset]" },
+    { "paint_stats", ConsoleCommandPaintStats, "Prints what painting the viewports costs per frame.",
+      "paint_stats [on|off|reset]" },
+    { "plugin_stats", ConsoleCommandPluginStats, "Prints the time each plugin has spent in its callbacks.",
+      "plugin_stats [reset]" },
+    { "profiler_exporttrace", ConsoleCommandProfilerExportTrace, "Exports the profiler timeline as a Chrome trace.",
+      "profiler_exporttrace <output file>" },
 };
 
 static int32_t ConsoleCommandWindows(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
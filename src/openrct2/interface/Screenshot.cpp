@@ -20,6 +20,7 @@
 #include "../core/Console.hpp"
 #include "../core/File.h"
 #include "../core/Imaging.h"
+#include "../core/Json.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../drawing/Drawing.h"
@@ -27,6 +28,7 @@
 #include "../localisation/Formatter.h"
 #include "../localisation/Localisation.h"
 #include "../platform/Platform.h"
+#include "../profiling/Profiling.h"
 #include "../util/Util.h"
 #include "../world/Climate.h"
 #include "../world/Map.h"
@@ -38,6 +40,9 @@
 #include <cctype>
 #include <chrono>
 #include <cstdlib>
+#include <fstream>
+#include <future>
+#include <iostream>
 #include <memory>
 #include <optional>
 #include <string>
@@ -345,9 +350,90 @@ static void RenderViewport(IDrawingEngine* drawingEngine, const Viewport& viewpo
     ViewportRender(dpi, &viewport, { { 0, 0 }, { viewport.width, viewport.height } });
 }
 
+/**
+ * Renders the viewport and writes it to a png a band of rows at a time, so only two bands are ever held in memory. The
+ * finished band is compressed and written on another thread while the next one is being rendered.
+ */
+/**
+ * Renders the viewport into a PNG file band by band. The returned future completes once the last band has been
+ * written and the file closed; rendering itself has finished by the time this returns, so the game state may be
+ * changed while the remaining output is still being encoded.
+ */
+static std::future<void> RenderViewportToFileAsync(std::string_view path, const Viewport& viewport)
+{
+    constexpr size_t kBandMaxBytes = 32 * 1024 * 1024;
+    constexpr int32_t kBandMinHeight = 64;
+
+    auto width = viewport.width;
+    auto bandHeight = static_cast<int32_t>(kBandMaxBytes / std::max(width, 1));
+    bandHeight = std::min(std::max(bandHeight, kBandMinHeight), viewport.height);
+
+    // Shared with the encoding tasks, which may outlive this function
+    struct RenderState
+    {
+        std::unique_ptr<Imaging::IImageStreamWriter> Writer;
+        std::vector<uint8_t> Bands[2];
+    };
+    auto state = std::make_shared<RenderState>();
+    state->Writer = Imaging::CreatePngStreamWriter(path, viewport.width, viewport.height, gPalette);
+
+    // Ensure sprites appear regardless of rotation
+    ResetAllSpriteQuadrantPlacements();
+    auto drawingEngine = std::make_unique<X8DrawingEngine>(GetContext()->GetUiContext());
+
+    std::future<void> pendingWrite;
+    auto bandIndex = 0;
+    for (int32_t top = 0; top < viewport.height; top += bandHeight)
+    {
+        auto height = std::min(bandHeight, viewport.height - top);
+        auto& pixels = state->Bands[bandIndex];
+        bandIndex ^= 1;
+        pixels.resize(static_cast<size_t>(width) * bandHeight);
+        if (viewport.flags & VIEWPORT_FLAG_TRANSPARENT_BACKGROUND)
+        {
+            std::fill(pixels.begin(), pixels.end(), PALETTE_INDEX_0);
+        }
+
+        DrawPixelInfo dpi;
+        dpi.DrawingEngine = drawingEngine.get();
+        dpi.bits = pixels.data();
+        dpi.y = top;
+        dpi.width = width;
+        dpi.height = height;
+        ViewportRender(dpi, &viewport, { { 0, top }, { width, top + height } });
+
+        // The previous band has to be written before this one, and its buffer is the one rendered into next
+        if (pendingWrite.valid())
+        {
+            pendingWrite.get();
+        }
+        auto isLastBand = top + height >= viewport.height;
+        pendingWrite = std::async(std::launch::async, [state, &pixels, height, width, isLastBand]() {
+            state->Writer->WriteRows(pixels.data(), height, width);
+            if (isLastBand)
+            {
+                state->Writer->Finish();
+            }
+        });
+    }
+    if (!pendingWrite.valid())
+    {
+        state->Writer->Finish();
+    }
+    return pendingWrite;
+}
+
+static void RenderViewportToFile(std::string_view path, const Viewport& viewport)
+{
+    auto pendingWrite = RenderViewportToFileAsync(path, viewport);
+    if (pendingWrite.valid())
+    {
+        pendingWrite.get();
+    }
+}
+
 void ScreenshotGiant()
 {
-    DrawPixelInfo dpi{};
     try
     {
         auto path = ScreenshotGetNextPath();
@@ -375,10 +461,7 @@ void ScreenshotGiant()
             viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
         }
 
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(path.value(), dpi, gPalette);
+        RenderViewportToFile(path.value(), viewport);
 
         // Show user that screenshot saved successfully
         const auto filename = Path::GetFileName(path.value());
@@ -392,8 +475,6 @@ void ScreenshotGiant()
         LOG_ERROR("%s", e.what());
         ContextShowError(STR_SCREENSHOT_FAILED, STR_NONE, {});
     }
-
-    ReleaseDPI(dpi);
 }
 
 static void ApplyOptions(const ScreenshotOptions* options, Viewport& viewport)
@@ -444,21 +525,145 @@ static void ApplyOptions(const ScreenshotOptions* options, Viewport& viewport)
     }
 }
 
-int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOptions* options)
+static int32_t CountPositionalArguments(const char** argv, int32_t argc)
 {
     // Don't include options in the count (they have been handled by CommandLine::ParseOptions already)
     for (int32_t i = 0; i < argc; i++)
     {
         if (argv[i][0] == '-')
         {
-            // Setting argc to i works, because options can only be at the end of the command
-            argc = i;
-            break;
+            // Options can only be at the end of the command
+            return i;
         }
     }
+    return argc;
+}
 
+static bool IsValidScreenshotJob(const char** argv, int32_t argc)
+{
     bool giantScreenshot = (argc == 5) && String::IEquals(argv[2], "giant");
-    if (argc != 4 && argc != 8 && !giantScreenshot)
+    return argc == 4 || argc == 8 || giantScreenshot;
+}
+
+static std::unique_ptr<IContext> CreateScreenshotContext()
+{
+    gOpenRCT2Headless = true;
+    auto context = CreateContext();
+    if (!context->Initialise())
+    {
+        throw std::runtime_error("Failed to initialize context.");
+    }
+
+    DrawingEngineInit();
+    return context;
+}
+
+/**
+ * Loads the park and renders one screenshot described by the positional arguments of the screenshot command. The
+ * returned future completes once the image has been fully written.
+ */
+static std::future<void> RenderScreenshotJob(
+    IContext& context, const char** argv, int32_t argc, const ScreenshotOptions* options)
+{
+    bool giantScreenshot = (argc == 5) && String::IEquals(argv[2], "giant");
+    bool customLocation = false;
+    bool centreMapX = false;
+    bool centreMapY = false;
+
+    const char* inputPath = argv[0];
+    const char* outputPath = argv[1];
+
+    if (!context.LoadParkFromFile(inputPath))
+    {
+        throw std::runtime_error("Failed to load park.");
+    }
+
+    gIntroState = IntroState::None;
+    gScreenFlags = SCREEN_FLAGS_PLAYING;
+
+    Viewport viewport{};
+    if (giantScreenshot)
+    {
+        auto customZoom = static_cast<int8_t>(std::atoi(argv[3]));
+        auto zoom = ZoomLevel{ customZoom };
+        auto rotation = std::atoi(argv[4]) & 3;
+        viewport = GetGiantViewport(rotation, zoom);
+    }
+    else
+    {
+        int32_t resolutionWidth = std::atoi(argv[2]);
+        int32_t resolutionHeight = std::atoi(argv[3]);
+        int32_t customX = 0;
+        int32_t customY = 0;
+        int32_t customZoom = 0;
+        int32_t customRotation = 0;
+        if (argc == 8)
+        {
+            customLocation = true;
+            if (argv[4][0] == 'c')
+                centreMapX = true;
+            else
+                customX = std::atoi(argv[4]);
+
+            if (argv[5][0] == 'c')
+                centreMapY = true;
+            else
+                customY = std::atoi(argv[5]);
+
+            customZoom = std::atoi(argv[6]);
+            customRotation = std::atoi(argv[7]) & 3;
+        }
+
+        const auto& mapSize = GetGameState().MapSize;
+        if (resolutionWidth == 0 || resolutionHeight == 0)
+        {
+            resolutionWidth = (mapSize.x * COORDS_XY_STEP * 2) >> customZoom;
+            resolutionHeight = (mapSize.y * COORDS_XY_STEP * 1) >> customZoom;
+
+            resolutionWidth += 8;
+            resolutionHeight += 128;
+        }
+
+        viewport.width = resolutionWidth;
+        viewport.height = resolutionHeight;
+        viewport.view_width = viewport.width;
+        viewport.view_height = viewport.height;
+        if (customLocation)
+        {
+            if (centreMapX)
+                customX = (mapSize.x / 2) * 32 + 16;
+            if (centreMapY)
+                customY = (mapSize.y / 2) * 32 + 16;
+
+            int32_t z = TileElementHeight({ customX, customY });
+            CoordsXYZ coords3d = { customX, customY, z };
+
+            auto coords2d = Translate3DTo2DWithZ(customRotation, coords3d);
+
+            viewport.viewPos = { coords2d.x - ((viewport.view_width << customZoom) / 2),
+                                 coords2d.y - ((viewport.view_height << customZoom) / 2) };
+            viewport.zoom = ZoomLevel{ static_cast<int8_t>(customZoom) };
+            viewport.rotation = customRotation;
+        }
+        else
+        {
+            auto& gameState = GetGameState();
+            viewport.viewPos = { gameState.SavedView
+                                 - ScreenCoordsXY{ (viewport.view_width / 2), (viewport.view_height / 2) } };
+            viewport.zoom = gameState.SavedViewZoom;
+            viewport.rotation = gameState.SavedViewRotation;
+        }
+    }
+
+    ApplyOptions(options, viewport);
+
+    return RenderViewportToFileAsync(outputPath, viewport);
+}
+
+int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOptions* options)
+{
+    argc = CountPositionalArguments(argv, argc);
+    if (!IsValidScreenshotJob(argv, argc))
     {
         std::printf("Usage: openrct2 screenshot <file> <output_image> <width> <height> [<x> <y> <zoom> <rotation>]\n");
         std::printf("Usage: openrct2 screenshot <file> <output_image> giant <zoom> <rotation>\n");
@@ -466,15 +671,283 @@ int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOpti
     }
 
     int32_t exitCode = 1;
-    DrawPixelInfo dpi;
     try
     {
-        bool customLocation = false;
-        bool centreMapX = false;
-        bool centreMapY = false;
+        auto context = CreateScreenshotContext();
+
+        auto pendingWrite = RenderScreenshotJob(*context, argv, argc, options);
+        if (pendingWrite.valid())
+        {
+            pendingWrite.get();
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::printf("%s\n", e.what());
+        exitCode = -1;
+    }
+
+    DrawingEngineDispose();
+
+    return exitCode;
+}
+
+static std::vector<std::string> SplitScreenshotJobLine(std::string_view line)
+{
+    std::vector<std::string> result;
+    std::string current;
+    bool inToken = false;
+    bool inQuotes = false;
+    for (auto c : line)
+    {
+        if (c == '"')
+        {
+            inQuotes = !inQuotes;
+            inToken = true;
+        }
+        else if (!inQuotes && std::isspace(static_cast<unsigned char>(c)))
+        {
+            if (inToken)
+            {
+                result.push_back(std::move(current));
+                current.clear();
+                inToken = false;
+            }
+        }
+        else
+        {
+            current.push_back(c);
+            inToken = true;
+        }
+    }
+    if (inToken)
+    {
+        result.push_back(std::move(current));
+    }
+    return result;
+}
+
+int32_t CommandLineForScreenshotBatch(const char** argv, int32_t argc, ScreenshotOptions* options)
+{
+    argc = CountPositionalArguments(argv, argc);
+    if (argc > 1)
+    {
+        std::printf("Usage: openrct2 screenshot batch [<jobs_file>]\n");
+        return -1;
+    }
+
+    std::ifstream jobsFile;
+    if (argc == 1)
+    {
+        jobsFile.open(fs::u8path(argv[0]));
+        if (!jobsFile.is_open())
+        {
+            std::printf("Unable to open %s\n", argv[0]);
+            return -1;
+        }
+    }
+    std::istream& jobs = argc == 1 ? static_cast<std::istream&>(jobsFile) : std::cin;
+
+    int32_t exitCode = 1;
+    try
+    {
+        auto context = CreateScreenshotContext();
+
+        // The image of the previous job is still being encoded while the next park is loaded and rendered
+        std::string pendingOutput;
+        std::future<void> pendingWrite;
+        auto finishPending = [&]() {
+            if (!pendingWrite.valid())
+                return;
+            try
+            {
+                pendingWrite.get();
+                std::printf("ok %s\n", pendingOutput.c_str());
+            }
+            catch (const std::exception& e)
+            {
+                std::printf("error %s: %s\n", pendingOutput.c_str(), e.what());
+                exitCode = -1;
+            }
+            std::fflush(stdout);
+        };
+
+        std::string line;
+        while (std::getline(jobs, line))
+        {
+            auto args = SplitScreenshotJobLine(line);
+            if (args.empty() || args[0][0] == '#')
+                continue;
+
+            std::vector<const char*> jobArgv;
+            for (const auto& arg : args)
+                jobArgv.push_back(arg.c_str());
+            auto jobArgc = static_cast<int32_t>(jobArgv.size());
+
+            std::string error;
+            std::future<void> jobWrite;
+            if (!IsValidScreenshotJob(jobArgv.data(), jobArgc))
+            {
+                error = "invalid job, expected the arguments of the screenshot command";
+            }
+            else
+            {
+                try
+                {
+                    jobWrite = RenderScreenshotJob(*context, jobArgv.data(), jobArgc, options);
+                }
+                catch (const std::exception& e)
+                {
+                    error = e.what();
+                }
+            }
 
+            finishPending();
+            auto output = jobArgc >= 2 ? args[1] : args[0];
+            if (!error.empty())
+            {
+                std::printf("error %s: %s\n", output.c_str(), error.c_str());
+                std::fflush(stdout);
+                exitCode = -1;
+            }
+            else
+            {
+                pendingOutput = std::move(output);
+                pendingWrite = std::move(jobWrite);
+            }
+        }
+        finishPending();
+    }
+    catch (const std::exception& e)
+    {
+        std::printf("%s\n", e.what());
+        exitCode = -1;
+    }
+
+    DrawingEngineDispose();
+
+    return exitCode;
+}
+
+struct GfxBenchCamera
+{
+    CoordsXY Location;
+    ZoomLevel Zoom;
+    uint8_t Rotation{};
+};
+
+// Without a camera path every rotation is rendered at the first few zoom levels around the centre of the map
+static std::vector<GfxBenchCamera> GetDefaultGfxBenchCameras()
+{
+    const auto& mapSize = GetGameState().MapSize;
+    const auto centre = CoordsXY{ (mapSize.x / 2) * COORDS_XY_STEP, (mapSize.y / 2) * COORDS_XY_STEP }.ToTileCentre();
+
+    std::vector<GfxBenchCamera> cameras;
+    for (int8_t zoom = 0; zoom <= 2; zoom++)
+    {
+        for (uint8_t rotation = 0; rotation < 4; rotation++)
+        {
+            cameras.push_back({ centre, ZoomLevel{ zoom }, rotation });
+        }
+    }
+    return cameras;
+}
+
+// Reads a JSON array of { "x", "y", "zoom", "rotation" } objects, x and y being map coordinates
+static std::vector<GfxBenchCamera> LoadGfxBenchCameras(const std::string& path)
+{
+    auto jsonCameras = Json::AsArray(Json::ReadFromFile(path));
+
+    std::vector<GfxBenchCamera> cameras;
+    for (const auto& jsonCamera : jsonCameras)
+    {
+        GfxBenchCamera camera;
+        camera.Location = { Json::GetNumber<int32_t>(jsonCamera["x"]), Json::GetNumber<int32_t>(jsonCamera["y"]) };
+        const auto zoom = std::clamp<int32_t>(
+            Json::GetNumber<int32_t>(jsonCamera["zoom"]), static_cast<int8_t>(ZoomLevel::min()),
+            static_cast<int8_t>(ZoomLevel::max()));
+        camera.Zoom = ZoomLevel{ static_cast<int8_t>(zoom) };
+        camera.Rotation = Json::GetNumber<uint8_t>(jsonCamera["rotation"]) & 3;
+        cameras.push_back(camera);
+    }
+    return cameras;
+}
+
+static Viewport GetGfxBenchViewport(const GfxBenchCamera& camera, int32_t width, int32_t height)
+{
+    Viewport viewport{};
+    viewport.width = width;
+    viewport.height = height;
+    viewport.view_width = camera.Zoom.ApplyTo(width);
+    viewport.view_height = camera.Zoom.ApplyTo(height);
+    viewport.zoom = camera.Zoom;
+    viewport.rotation = camera.Rotation;
+
+    auto z = TileElementHeight(camera.Location);
+    auto coords2d = Translate3DTo2DWithZ(camera.Rotation, { camera.Location, z });
+    viewport.viewPos = coords2d - ScreenCoordsXY{ viewport.view_width / 2, viewport.view_height / 2 };
+    return viewport;
+}
+
+struct GfxBenchPhaseTimes
+{
+    double GenerateUs{};
+    double ArrangeUs{};
+    double DrawUs{};
+};
+
+static double GetProfiledFunctionTotal(std::string_view name)
+{
+    for (const auto* func : Profiling::GetData())
+    {
+        if (std::string_view(func->GetName()).find(name) != std::string_view::npos)
+            return func->GetTotalTime();
+    }
+    return 0.0;
+}
+
+// Totals over all paint columns, so with multithreaded painting these are CPU time rather than wall time
+static GfxBenchPhaseTimes GetGfxBenchPhaseTimes()
+{
+    return { GetProfiledFunctionTotal("PaintSessionGenerate("), GetProfiledFunctionTotal("PaintSessionArrange("),
+             GetProfiledFunctionTotal("PaintDrawStructs(") };
+}
+
+// Nearest rank percentile of already sorted samples
+static double GetPercentile(const std::vector<double>& sortedSamples, double percentile)
+{
+    if (sortedSamples.empty())
+        return 0.0;
+
+    auto rank = static_cast<size_t>(percentile / 100.0 * static_cast<double>(sortedSamples.size()));
+    return sortedSamples[std::min(rank, sortedSamples.size() - 1)];
+}
+
+int32_t CommandLineForGfxbench(const char** argv, int32_t argc, const GfxBenchOptions& options)
+{
+    // Don't include options in the count (they have been handled by CommandLine::ParseOptions already)
+    for (int32_t i = 0; i < argc; i++)
+    {
+        if (argv[i][0] == '-')
+        {
+            argc = i;
+            break;
+        }
+    }
+
+    if (argc != 1 && argc != 2)
+    {
+        std::printf("Usage: openrct2 benchgfx <file> [<camera_path>] [--iterations <n>] [--width <w>] [--height <h>]"
+                    " [--json]\n");
+        return -1;
+    }
+
+    int32_t exitCode = 1;
+    DrawPixelInfo dpi;
+    try
+    {
         const char* inputPath = argv[0];
-        const char* outputPath = argv[1];
+        const auto iterations = std::max(options.iterations, 1);
 
         gOpenRCT2Headless = true;
         auto context = CreateContext();
@@ -493,86 +966,128 @@ int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOpti
         gIntroState = IntroState::None;
         gScreenFlags = SCREEN_FLAGS_PLAYING;
 
-        Viewport viewport{};
-        if (giantScreenshot)
+        auto cameras = argc == 2 ? LoadGfxBenchCameras(argv[1]) : GetDefaultGfxBenchCameras();
+        if (cameras.empty())
         {
-            auto customZoom = static_cast<int8_t>(std::atoi(argv[3]));
-            auto zoom = ZoomLevel{ customZoom };
-            auto rotation = std::atoi(argv[4]) & 3;
-            viewport = GetGiantViewport(rotation, zoom);
+            throw std::runtime_error("The camera path is empty.");
         }
-        else
-        {
-            int32_t resolutionWidth = std::atoi(argv[2]);
-            int32_t resolutionHeight = std::atoi(argv[3]);
-            int32_t customX = 0;
-            int32_t customY = 0;
-            int32_t customZoom = 0;
-            int32_t customRotation = 0;
-            if (argc == 8)
-            {
-                customLocation = true;
-                if (argv[4][0] == 'c')
-                    centreMapX = true;
-                else
-                    customX = std::atoi(argv[4]);
-
-                if (argv[5][0] == 'c')
-                    centreMapY = true;
-                else
-                    customY = std::atoi(argv[5]);
-
-                customZoom = std::atoi(argv[6]);
-                customRotation = std::atoi(argv[7]) & 3;
-            }
 
-            const auto& mapSize = GetGameState().MapSize;
-            if (resolutionWidth == 0 || resolutionHeight == 0)
-            {
-                resolutionWidth = (mapSize.x * COORDS_XY_STEP * 2) >> customZoom;
-                resolutionHeight = (mapSize.y * COORDS_XY_STEP * 1) >> customZoom;
+        Viewport dpiViewport{};
+        dpiViewport.width = std::max(options.width, 1);
+        dpiViewport.height = std::max(options.height, 1);
+        dpi = CreateDPI(dpiViewport);
 
-                resolutionWidth += 8;
-                resolutionHeight += 128;
-            }
+        // Render every camera once first, so loading images and growing paint buffers is not measured
+        for (const auto& camera : cameras)
+        {
+            RenderViewport(nullptr, GetGfxBenchViewport(camera, dpi.width, dpi.height), dpi);
+        }
+
+        const bool profilerWasEnabled = Profiling::IsEnabled();
+        Profiling::ResetData();
+        Profiling::Enable();
 
-            viewport.width = resolutionWidth;
-            viewport.height = resolutionHeight;
-            viewport.view_width = viewport.width;
-            viewport.view_height = viewport.height;
-            if (customLocation)
+        using Clock = std::chrono::high_resolution_clock;
+        std::vector<double> frameTimesUs;
+        std::vector<double> cameraTotalUs(cameras.size());
+        std::vector<GfxBenchPhaseTimes> cameraPhases(cameras.size());
+        for (int32_t i = 0; i < iterations; i++)
+        {
+            for (size_t cameraIndex = 0; cameraIndex < cameras.size(); cameraIndex++)
             {
-                if (centreMapX)
-                    customX = (mapSize.x / 2) * 32 + 16;
-                if (centreMapY)
-                    customY = (mapSize.y / 2) * 32 + 16;
+                auto viewport = GetGfxBenchViewport(cameras[cameraIndex], dpi.width, dpi.height);
+                const auto phasesBefore = GetGfxBenchPhaseTimes();
+                const auto start = Clock::now();
+                RenderViewport(nullptr, viewport, dpi);
+                const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+                const auto phasesAfter = GetGfxBenchPhaseTimes();
+
+                const auto frameUs = elapsed.count() / 1000.0;
+                frameTimesUs.push_back(frameUs);
+                cameraTotalUs[cameraIndex] += frameUs;
+                cameraPhases[cameraIndex].GenerateUs += phasesAfter.GenerateUs - phasesBefore.GenerateUs;
+                cameraPhases[cameraIndex].ArrangeUs += phasesAfter.ArrangeUs - phasesBefore.ArrangeUs;
+                cameraPhases[cameraIndex].DrawUs += phasesAfter.DrawUs - phasesBefore.DrawUs;
+            }
+        }
 
-                int32_t z = TileElementHeight({ customX, customY });
-                CoordsXYZ coords3d = { customX, customY, z };
+        if (!profilerWasEnabled)
+        {
+            Profiling::Disable();
+        }
 
-                auto coords2d = Translate3DTo2DWithZ(customRotation, coords3d);
+        const auto totals = GetGfxBenchPhaseTimes();
+        double totalUs = 0.0;
+        for (auto frameTime : frameTimesUs)
+        {
+            totalUs += frameTime;
+        }
+        const auto numFrames = static_cast<double>(frameTimesUs.size());
+        std::sort(frameTimesUs.begin(), frameTimesUs.end());
 
-                viewport.viewPos = { coords2d.x - ((viewport.view_width << customZoom) / 2),
-                                     coords2d.y - ((viewport.view_height << customZoom) / 2) };
-                viewport.zoom = ZoomLevel{ static_cast<int8_t>(customZoom) };
-                viewport.rotation = customRotation;
+        if (options.json)
+        {
+            json_t result = {
+                { "park", inputPath },
+                { "engine", "software" },
+                { "width", dpi.width },
+                { "height", dpi.height },
+                { "iterations", iterations },
+                { "frames", frameTimesUs.size() },
+                { "framesPerSecond", totalUs > 0.0 ? numFrames / (totalUs / 1000000.0) : 0.0 },
+                { "frameUs",
+                  { { "mean", totalUs / numFrames },
+                    { "p50", GetPercentile(frameTimesUs, 50) },
+                    { "p95", GetPercentile(frameTimesUs, 95) },
+                    { "p99", GetPercentile(frameTimesUs, 99) } } },
+                { "phaseUs",
+                  { { "generate", totals.GenerateUs / numFrames },
+                    { "arrange", totals.ArrangeUs / numFrames },
+                    { "draw", totals.DrawUs / numFrames } } },
+            };
+
+            auto camerasJson = json_t::array();
+            for (size_t cameraIndex = 0; cameraIndex < cameras.size(); cameraIndex++)
+            {
+                const auto& camera = cameras[cameraIndex];
+                const auto& phases = cameraPhases[cameraIndex];
+                camerasJson.push_back({
+                    { "x", camera.Location.x },
+                    { "y", camera.Location.y },
+                    { "zoom", static_cast<int8_t>(camera.Zoom) },
+                    { "rotation", camera.Rotation },
+                    { "frameUs", cameraTotalUs[cameraIndex] / iterations },
+                    { "generateUs", phases.GenerateUs / iterations },
+                    { "arrangeUs", phases.ArrangeUs / iterations },
+                    { "drawUs", phases.DrawUs / iterations },
+                });
             }
-            else
+            result["cameras"] = std::move(camerasJson);
+
+            Console::WriteLine("%s", result.dump(4).c_str());
+        }
+        else
+        {
+            Console::WriteLine(
+                "Rendered %zu frames of %dx%d in %.2f ms (%.1f fps)", frameTimesUs.size(), dpi.width, dpi.height,
+                totalUs / 1000.0, totalUs > 0.0 ? numFrames / (totalUs / 1000000.0) : 0.0);
+            Console::WriteLine(
+                "Frame time (us): mean %.1f, p50 %.1f, p95 %.1f, p99 %.1f", totalUs / numFrames,
+                GetPercentile(frameTimesUs, 50), GetPercentile(frameTimesUs, 95), GetPercentile(frameTimesUs, 99));
+            Console::WriteLine(
+                "Phase time per frame (us): generate %.1f, arrange %.1f, draw %.1f", totals.GenerateUs / numFrames,
+                totals.ArrangeUs / numFrames, totals.DrawUs / numFrames);
+            for (size_t cameraIndex = 0; cameraIndex < cameras.size(); cameraIndex++)
             {
-                auto& gameState = GetGameState();
-                viewport.viewPos = { gameState.SavedView
-                                     - ScreenCoordsXY{ (viewport.view_width / 2), (viewport.view_height / 2) } };
-                viewport.zoom = gameState.SavedViewZoom;
-                viewport.rotation = gameState.SavedViewRotation;
+                const auto& camera = cameras[cameraIndex];
+                const auto& phases = cameraPhases[cameraIndex];
+                Console::WriteLine(
+                    "  (%d, %d) zoom %d rotation %d: %.1f us (generate %.1f, arrange %.1f, draw %.1f)", camera.Location.x,
+                    camera.Location.y, static_cast<int8_t>(camera.Zoom), camera.Rotation,
+                    cameraTotalUs[cameraIndex] / iterations, phases.GenerateUs / iterations, phases.ArrangeUs / iterations,
+                    phases.DrawUs / iterations);
             }
         }
-
-        ApplyOptions(options, viewport);
-
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(outputPath, dpi, gPalette);
     }
     catch (const std::exception& e)
     {
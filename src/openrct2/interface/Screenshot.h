@@ -36,6 +36,14 @@ struct ScreenshotOptions
     bool transparent = false;
 };
 
+struct GfxBenchOptions
+{
+    int32_t iterations = 10;
+    int32_t width = 1920;
+    int32_t height = 1080;
+    bool json = false;
+};
+
 struct CaptureView
 {
     int32_t Width{};
@@ -59,5 +67,7 @@ std::string ScreenshotDumpPNG32bpp(int32_t width, int32_t height, const void* pi
 
 void ScreenshotGiant();
 int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOptions* options);
+int32_t CommandLineForScreenshotBatch(const char** argv, int32_t argc, ScreenshotOptions* options);
+int32_t CommandLineForGfxbench(const char** argv, int32_t argc, const GfxBenchOptions& options);
 
 void CaptureImage(const CaptureOptions& options);
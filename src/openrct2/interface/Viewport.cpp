@@ -17,6 +17,7 @@
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
 #include "../core/JobPool.h"
+#include "../core/Timer.hpp"
 #include "../drawing/Drawing.h"
 #include "../drawing/IDrawingEngine.h"
 #include "../entity/EntityList.h"
@@ -26,7 +27,9 @@
 #include "../object/LargeSceneryEntry.h"
 #include "../object/SmallSceneryEntry.h"
 #include "../object/WallSceneryEntry.h"
+#include "../paint/Paint.TileCache.h"
 #include "../paint/Paint.h"
+#include "../profiling/PaintStatistics.h"
 #include "../profiling/Profiling.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
@@ -62,9 +65,69 @@ uint8_t gShowConstructionRightsRefCount;
 static std::list<Viewport> _viewports;
 Viewport* g_music_tracking_viewport;
 
+// A map space invalidation waiting for ViewportsFlushInvalidations. The area invalidated is the projected position
+// extended by Width either side, MinHeight above and MaxHeight below.
+struct PendingInvalidation
+{
+    CoordsXYZ Pos;
+    int32_t Width;
+    int32_t MinHeight;
+    int32_t MaxHeight;
+    ZoomLevel MaxZoom;
+    // Viewports zoomed out further than MaxZoom still drop the area from their far zoom cache.
+    bool FarZoomCache;
+
+    bool operator==(const PendingInvalidation& other) const
+    {
+        return Pos == other.Pos && Width == other.Width && MinHeight == other.MinHeight && MaxHeight == other.MaxHeight
+            && MaxZoom == other.MaxZoom && FarZoomCache == other.FarZoomCache;
+    }
+};
+static std::vector<PendingInvalidation> _pendingInvalidations;
+
 static std::unique_ptr<JobPool> _paintJobs;
 static std::vector<PaintSession*> _paintColumns;
 
+// Entities are not painted beyond this zoom level, so everything drawn is static apart from tile animations that are
+// only refreshed when zoomed in further. The view is cached in square chunks of pixels, aligned in view coordinates
+// so that neighbouring chunks join up exactly, and is copied out of the cache instead of being painted again.
+static constexpr ZoomLevel kFarZoomCacheMinZoom{ 3 };
+static constexpr int32_t kFarZoomChunkSize = 256;
+static constexpr size_t kFarZoomCacheMaxChunks = 256;
+// Viewports with different flags, zoom or rotation each keep their own chunks, the chunk budget is shared between them.
+static constexpr size_t kFarZoomCacheMaxContexts = 4;
+
+struct FarZoomCacheContext
+{
+    uint32_t ViewFlags{};
+    ZoomLevel Zoom{};
+    uint8_t Rotation{};
+    uint8_t Settings{};
+    FilterPaletteID Gloom{};
+
+    bool operator==(const FarZoomCacheContext& rhs) const
+    {
+        return ViewFlags == rhs.ViewFlags && Zoom == rhs.Zoom && Rotation == rhs.Rotation && Settings == rhs.Settings
+            && Gloom == rhs.Gloom;
+    }
+};
+
+struct FarZoomChunk
+{
+    std::vector<uint8_t> Pixels;
+    uint32_t LastUsed{};
+};
+
+struct FarZoomCache
+{
+    FarZoomCacheContext Context;
+    std::unordered_map<uint64_t, FarZoomChunk> Chunks;
+    uint32_t LastUsed{};
+};
+
+static std::vector<FarZoomCache> _farZoomCaches;
+static uint32_t _farZoomCacheUseCount;
+
 static uint32_t _currentImageType;
 InteractionInfo::InteractionInfo(const PaintStruct* ps)
     : Loc(ps->MapPos)
@@ -74,8 +137,30 @@ InteractionInfo::InteractionInfo(const PaintStruct* ps)
 {
 }
 
+// What was painted over the pixel of the last interaction query. Tools and tooltips query the same pixel many times with
+// different filters, the filter only applies after painting so the painted pixel is reused until anything redraws.
+struct InteractionQueryCache
+{
+    bool Valid{};
+    const Viewport* ViewportPtr{};
+    ScreenCoordsXY ViewLoc;
+    ZoomLevel Zoom;
+    uint8_t Rotation{};
+    uint32_t ViewFlags{};
+    uint32_t DrawCount{};
+    std::vector<InteractionInfo> Candidates;
+};
+static InteractionQueryCache _interactionQueryCache;
+
+static void InteractionQueryCacheInvalidate()
+{
+    _interactionQueryCache.Valid = false;
+}
+
 static void ViewportPaintWeatherGloom(DrawPixelInfo& dpi);
 static void ViewportPaint(const Viewport* viewport, DrawPixelInfo& dpi, const ScreenRect& screenRect);
+static void ViewportPaintUncached(const Viewport* viewport, DrawPixelInfo& dpi, const ScreenRect& screenRect);
+static void ViewportFarZoomCacheInvalidateRect(const Viewport* viewport, const ScreenRect& screenRect);
 static void ViewportUpdateFollowSprite(WindowBase* window);
 static void ViewportUpdateSmartFollowEntity(WindowBase* window);
 static void ViewportUpdateSmartFollowStaff(WindowBase* window, const Staff& peep);
@@ -95,6 +180,7 @@ void ViewportInitAll()
     }
 
     WindowInitAll();
+    InteractionQueryCacheInvalidate();
 
     // ?
     InputResetFlags();
@@ -231,6 +317,7 @@ void ViewportRemove(Viewport* viewport)
         return;
     }
     _viewports.erase(it);
+    InteractionQueryCacheInvalidate();
 }
 
 static Viewport* ViewportGetMain()
@@ -243,52 +330,142 @@ static Viewport* ViewportGetMain()
     return mainWindow->viewport;
 }
 
+static void ViewportsQueueInvalidation(const PendingInvalidation& invalidation)
+{
+    InteractionQueryCacheInvalidate();
+
+    // Nothing to redraw, e.g. on a headless server
+    if (_viewports.empty())
+        return;
+
+    // The same area is often invalidated several times in a row, e.g. by consecutive tile element changes
+    if (!_pendingInvalidations.empty() && _pendingInvalidations.back() == invalidation)
+        return;
+
+    _pendingInvalidations.push_back(invalidation);
+}
+
 void ViewportsInvalidate(int32_t x, int32_t y, int32_t z0, int32_t z1, ZoomLevel maxZoom)
 {
+    ViewportsQueueInvalidation({ { x + 16, y + 16, 0 }, 32, 32 + z1, 32 - z0, maxZoom, true });
+}
+
+void ViewportsInvalidate(const CoordsXYZ& pos, int32_t width, int32_t minHeight, int32_t maxHeight, ZoomLevel maxZoom)
+{
+    ViewportsQueueInvalidation({ pos, width, minHeight, maxHeight, maxZoom, false });
+}
+
+/**
+ * Projects the map space invalidations queued since the last call into every viewport and marks the covered screen
+ * areas dirty. Called at the end of every tick and before drawing.
+ */
+void ViewportsFlushInvalidations()
+{
+    PROFILED_FUNCTION();
+
+    if (_pendingInvalidations.empty())
+        return;
+
     for (auto& vp : _viewports)
     {
-        if (maxZoom == ZoomLevel{ -1 } || vp.zoom <= ZoomLevel{ maxZoom })
+        for (const auto& invalidation : _pendingInvalidations)
         {
-            int32_t x1, y1, x2, y2;
-
-            x += 16;
-            y += 16;
-            auto screenCoord = Translate3DTo2DWithZ(vp.rotation, CoordsXYZ{ x, y, 0 });
+            auto screenCoords = Translate3DTo2DWithZ(vp.rotation, invalidation.Pos);
+            auto screenRect = ScreenRect(
+                screenCoords - ScreenCoordsXY{ invalidation.Width, invalidation.MinHeight },
+                screenCoords + ScreenCoordsXY{ invalidation.Width, invalidation.MaxHeight });
 
-            x1 = screenCoord.x - 32;
-            y1 = screenCoord.y - 32 - z1;
-            x2 = screenCoord.x + 32;
-            y2 = screenCoord.y + 32 - z0;
-
-            ViewportInvalidate(&vp, ScreenRect{ { x1, y1 }, { x2, y2 } });
+            if (invalidation.MaxZoom == ZoomLevel{ -1 } || vp.zoom <= invalidation.MaxZoom)
+            {
+                ViewportInvalidate(&vp, screenRect);
+            }
+            else if (invalidation.FarZoomCache)
+            {
+                // The viewport does not redraw changes this small, but the tile has changed for the far zoom cache
+                ViewportFarZoomCacheInvalidateRect(&vp, screenRect);
+            }
         }
     }
+    _pendingInvalidations.clear();
 }
 
-void ViewportsInvalidate(const CoordsXYZ& pos, int32_t width, int32_t minHeight, int32_t maxHeight, ZoomLevel maxZoom)
+void ViewportsInvalidate(const ScreenRect& screenRect, ZoomLevel maxZoom)
 {
     for (auto& vp : _viewports)
     {
         if (maxZoom == ZoomLevel{ -1 } || vp.zoom <= ZoomLevel{ maxZoom })
         {
-            auto screenCoords = Translate3DTo2DWithZ(vp.rotation, pos);
-            auto screenPos = ScreenRect(
-                screenCoords - ScreenCoordsXY{ width, minHeight }, screenCoords + ScreenCoordsXY{ width, maxHeight });
+            ViewportInvalidate(&vp, screenRect);
+        }
+    }
+}
 
-            ViewportInvalidate(&vp, screenPos);
+/**
+ * Whether any uncovered viewport zoomed in at least as far as maxZoom may show part of the given map range, for
+ * heights between 0 and maxHeight.
+ */
+bool ViewportsIntersectMapRange(const MapRange& range, int32_t maxHeight, ZoomLevel maxZoom)
+{
+    for (auto& vp : _viewports)
+    {
+        if (vp.visibility == VisibilityCache::Covered || vp.zoom > maxZoom)
+            continue;
+
+        const CoordsXYZ corners[] = {
+            { range.GetLeft(), range.GetTop(), 0 },
+            { range.GetRight(), range.GetTop(), 0 },
+            { range.GetLeft(), range.GetBottom(), 0 },
+            { range.GetRight(), range.GetBottom(), 0 },
+        };
+        auto topLeft = Translate3DTo2DWithZ(vp.rotation, corners[0]);
+        auto bottomRight = topLeft;
+        for (const auto& corner : corners)
+        {
+            auto screenCoords = Translate3DTo2DWithZ(vp.rotation, corner);
+            topLeft = { std::min(topLeft.x, screenCoords.x), std::min(topLeft.y, screenCoords.y) };
+            bottomRight = { std::max(bottomRight.x, screenCoords.x), std::max(bottomRight.y, screenCoords.y) };
+        }
+        topLeft.y -= maxHeight;
+
+        if (bottomRight.x > vp.viewPos.x && bottomRight.y > vp.viewPos.y && topLeft.x < vp.viewPos.x + vp.view_width
+            && topLeft.y < vp.viewPos.y + vp.view_height)
+        {
+            return true;
         }
     }
+    return false;
 }
 
-void ViewportsInvalidate(const ScreenRect& screenRect, ZoomLevel maxZoom)
+/**
+ * Redraws every viewport in full, including its far zoom cache.
+ */
+void ViewportsInvalidateAll()
 {
+    InteractionQueryCacheInvalidate();
     for (auto& vp : _viewports)
     {
-        if (maxZoom == ZoomLevel{ -1 } || vp.zoom <= ZoomLevel{ maxZoom })
+        vp.Invalidate();
+    }
+}
+
+/**
+ * Whether any uncovered viewport may show part of a rectangle given in viewport coordinates, such as an entity's
+ * sprite rectangle.
+ */
+bool ViewportsIntersectViewRect(const ScreenRect& rect)
+{
+    for (auto& vp : _viewports)
+    {
+        if (vp.visibility == VisibilityCache::Covered)
+            continue;
+
+        if (rect.GetRight() > vp.viewPos.x && rect.GetBottom() > vp.viewPos.y
+            && rect.GetLeft() < vp.viewPos.x + vp.view_width && rect.GetTop() < vp.viewPos.y + vp.view_height)
         {
-            ViewportInvalidate(&vp, screenRect);
+            return true;
         }
     }
+    return false;
 }
 
 /**
@@ -969,14 +1146,28 @@ static void ViewportFillColumn(PaintSession& session)
 {
     PROFILED_FUNCTION();
 
+    if (!gPaintStatistics)
+    {
+        PaintSessionGenerate(session);
+        PaintSessionArrange(session);
+        return;
+    }
+
+    Timer timer;
     PaintSessionGenerate(session);
+    session.Stats.GenerateMs = timer.GetElapsedTimeAndRestart().count() * 1000.0f;
     PaintSessionArrange(session);
+    session.Stats.ArrangeMs = timer.GetElapsedTime().count() * 1000.0f;
+    session.Stats.PaintStructs = static_cast<uint32_t>(session.PaintEntryChain.GetCount());
 }
 
 static void ViewportPaintColumn(PaintSession& session)
 {
     PROFILED_FUNCTION();
 
+    Timer timer;
+    PaintOverdrawPrepare(session);
+
     if (session.ViewFlags
             & (VIEWPORT_FLAG_HIDE_VERTICAL | VIEWPORT_FLAG_HIDE_BASE | VIEWPORT_FLAG_UNDERGROUND_INSIDE
                | VIEWPORT_FLAG_CLIP_VIEW)
@@ -1002,6 +1193,33 @@ static void ViewportPaintColumn(PaintSession& session)
     {
         PaintDrawMoneyStructs(session.DPI, session.PSStringHead);
     }
+
+    PaintDrawOverdrawHeatmap(session);
+    session.Stats.DrawMs = timer.GetElapsedTime().count() * 1000.0f;
+}
+
+/**
+ * Runs fn for every paint column. With multithreading each worker claims the next column that has not been started yet
+ * until none are left, rather than getting a fixed share up front, so a few dense columns do not leave the other
+ * workers idle.
+ */
+static void ViewportProcessColumns(void (*fn)(PaintSession&), bool parallel)
+{
+    if (!parallel || _paintJobs->CountThreads() == 0)
+    {
+        for (auto* session : _paintColumns)
+        {
+            fn(*session);
+        }
+        return;
+    }
+
+    _paintJobs->ParallelFor(0, _paintColumns.size(), 1, [fn](size_t begin, size_t end) {
+        for (size_t column = begin; column < end; column++)
+        {
+            fn(*_paintColumns[column]);
+        }
+    });
 }
 
 /**
@@ -1014,7 +1232,263 @@ static void ViewportPaintColumn(PaintSession& session)
  *  edi: dpi
  *  ebp: bottom
  */
+static FarZoomCacheContext ViewportFarZoomCacheGetContext(const Viewport& viewport)
+{
+    FarZoomCacheContext context;
+    context.ViewFlags = viewport.flags;
+    context.Zoom = viewport.zoom;
+    context.Rotation = viewport.rotation;
+    context.Settings = PaintCacheGetSettings();
+    context.Gloom = FilterPaletteID::PaletteNull;
+    if (gConfigGeneral.RenderWeatherGloom && !(viewport.flags & VIEWPORT_FLAG_HIDE_ENTITIES)
+        && !(viewport.flags & VIEWPORT_FLAG_HIGHLIGHT_PATH_ISSUES))
+    {
+        context.Gloom = ClimateGetWeatherGloomPaletteId(GetGameState().ClimateCurrent);
+    }
+    return context;
+}
+
+static uint64_t ViewportFarZoomChunkKey(int32_t chunkX, int32_t chunkY)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(chunkX)) << 32) | static_cast<uint32_t>(chunkY);
+}
+
+// Returns the cache for the context, taking over the least recently used cache when there are too many.
+static FarZoomCache& ViewportFarZoomCacheGet(const FarZoomCacheContext& context)
+{
+    auto it = std::find_if(_farZoomCaches.begin(), _farZoomCaches.end(), [&context](const FarZoomCache& cache) {
+        return cache.Context == context;
+    });
+    if (it == _farZoomCaches.end())
+    {
+        if (_farZoomCaches.size() < kFarZoomCacheMaxContexts)
+        {
+            it = _farZoomCaches.emplace(_farZoomCaches.end());
+        }
+        else
+        {
+            it = std::min_element(_farZoomCaches.begin(), _farZoomCaches.end(), [](const auto& a, const auto& b) {
+                return a.LastUsed < b.LastUsed;
+            });
+            it->Chunks.clear();
+        }
+        it->Context = context;
+    }
+    it->LastUsed = _farZoomCacheUseCount;
+    return *it;
+}
+
+// Drops the least recently used chunk of all caches once they hold as many as the budget allows.
+static void ViewportFarZoomCacheMakeRoom()
+{
+    size_t numChunks = 0;
+    for (const auto& cache : _farZoomCaches)
+    {
+        numChunks += cache.Chunks.size();
+    }
+    if (numChunks < kFarZoomCacheMaxChunks)
+        return;
+
+    FarZoomCache* oldestCache = nullptr;
+    std::unordered_map<uint64_t, FarZoomChunk>::iterator oldest;
+    for (auto& cache : _farZoomCaches)
+    {
+        for (auto it = cache.Chunks.begin(); it != cache.Chunks.end(); ++it)
+        {
+            if (oldestCache == nullptr || it->second.LastUsed < oldest->second.LastUsed)
+            {
+                oldestCache = &cache;
+                oldest = it;
+            }
+        }
+    }
+    if (oldestCache != nullptr)
+    {
+        oldestCache->Chunks.erase(oldest);
+    }
+}
+
+static const FarZoomChunk& ViewportFarZoomCacheGetChunk(
+    FarZoomCache& cache, const Viewport& viewport, Drawing::IDrawingEngine* drawingEngine, int32_t chunkX, int32_t chunkY)
+{
+    auto key = ViewportFarZoomChunkKey(chunkX, chunkY);
+    auto it = cache.Chunks.find(key);
+    if (it != cache.Chunks.end())
+    {
+        it->second.LastUsed = _farZoomCacheUseCount;
+        return it->second;
+    }
+
+    ViewportFarZoomCacheMakeRoom();
+
+    auto& chunk = cache.Chunks[key];
+    chunk.LastUsed = _farZoomCacheUseCount;
+    chunk.Pixels.assign(kFarZoomChunkSize * kFarZoomChunkSize, PALETTE_INDEX_0);
+
+    // Paint the chunk as if it was a viewport of its own
+    const auto chunkViewSize = viewport.zoom.ApplyTo(kFarZoomChunkSize);
+    Viewport chunkViewport{};
+    chunkViewport.width = kFarZoomChunkSize;
+    chunkViewport.height = kFarZoomChunkSize;
+    chunkViewport.viewPos = { chunkX * chunkViewSize, chunkY * chunkViewSize };
+    chunkViewport.view_width = chunkViewSize;
+    chunkViewport.view_height = chunkViewSize;
+    chunkViewport.flags = viewport.flags;
+    chunkViewport.zoom = viewport.zoom;
+    chunkViewport.rotation = viewport.rotation;
+
+    DrawPixelInfo chunkDpi;
+    chunkDpi.DrawingEngine = drawingEngine;
+    chunkDpi.bits = chunk.Pixels.data();
+    chunkDpi.width = kFarZoomChunkSize;
+    chunkDpi.height = kFarZoomChunkSize;
+    ViewportPaintUncached(
+        &chunkViewport, chunkDpi,
+        { chunkViewport.viewPos, chunkViewport.viewPos + ScreenCoordsXY{ chunkViewSize, chunkViewSize } });
+    return chunk;
+}
+
+/**
+ * Draws the given part of a far zoomed viewport out of cached chunks, painting the chunks that are missing.
+ * Returns false if the viewport can not use the cache.
+ */
+static bool ViewportPaintFromFarZoomCache(const Viewport* viewport, DrawPixelInfo& dpi, const ScreenRect& screenRect)
+{
+    if (viewport->zoom < kFarZoomCacheMinZoom || dpi.zoom_level != ZoomLevel{ 0 } || dpi.DrawingEngine == nullptr)
+        return false;
+    // Only viewports on screen are told about invalidations, screenshots paint everything once anyway
+    if (std::none_of(_viewports.begin(), _viewports.end(), [viewport](const Viewport& vp) { return &vp == viewport; }))
+        return false;
+    if (!(dpi.DrawingEngine->GetFlags() & DEF_PIXEL_BUFFER))
+        return false;
+    if (!PaintCacheIsAllowed(viewport->flags))
+        return false;
+
+    _farZoomCacheUseCount++;
+    auto& cache = ViewportFarZoomCacheGet(ViewportFarZoomCacheGetContext(*viewport));
+
+    // Work in pixels at the viewport zoom, these are aligned the same way ViewportPaint aligns the view
+    const auto zoomShift = static_cast<int8_t>(viewport->zoom);
+    const auto viewLeft = viewport->viewPos.x >> zoomShift;
+    const auto viewTop = viewport->viewPos.y >> zoomShift;
+    auto left = screenRect.GetLeft() >> zoomShift;
+    auto top = screenRect.GetTop() >> zoomShift;
+    auto right = left + (screenRect.GetWidth() >> zoomShift);
+    auto bottom = top + (screenRect.GetHeight() >> zoomShift);
+
+    // Clip to the target, in pixels at the viewport zoom
+    const auto toScreen = viewport->pos - ScreenCoordsXY{ viewLeft, viewTop };
+    left = std::max(left, dpi.x - toScreen.x);
+    top = std::max(top, dpi.y - toScreen.y);
+    right = std::min(right, dpi.x + dpi.width - toScreen.x);
+    bottom = std::min(bottom, dpi.y + dpi.height - toScreen.y);
+    if (left >= right || top >= bottom)
+        return true;
+
+    const auto dstStride = dpi.width + dpi.pitch;
+    for (auto chunkY = Floor2(top, kFarZoomChunkSize); chunkY < bottom; chunkY += kFarZoomChunkSize)
+    {
+        for (auto chunkX = Floor2(left, kFarZoomChunkSize); chunkX < right; chunkX += kFarZoomChunkSize)
+        {
+            const auto& chunk = ViewportFarZoomCacheGetChunk(
+                cache, *viewport, dpi.DrawingEngine, chunkX / kFarZoomChunkSize, chunkY / kFarZoomChunkSize);
+
+            const auto copyLeft = std::max(left, chunkX);
+            const auto copyRight = std::min(right, chunkX + kFarZoomChunkSize);
+            const auto copyTop = std::max(top, chunkY);
+            const auto copyBottom = std::min(bottom, chunkY + kFarZoomChunkSize);
+            for (auto y = copyTop; y < copyBottom; y++)
+            {
+                const auto* src = chunk.Pixels.data() + (y - chunkY) * kFarZoomChunkSize + (copyLeft - chunkX);
+                auto* dst = dpi.bits + (y + toScreen.y - dpi.y) * dstStride + (copyLeft + toScreen.x - dpi.x);
+                std::memcpy(dst, src, copyRight - copyLeft);
+            }
+        }
+    }
+    return true;
+}
+
+// The rectangle is in view coordinates of the rotation of the cache.
+static void ViewportFarZoomCacheInvalidateRect(FarZoomCache& cache, const ScreenRect& screenRect)
+{
+    auto& chunks = cache.Chunks;
+    if (chunks.empty())
+        return;
+
+    const auto chunkViewSize = cache.Context.Zoom.ApplyTo(kFarZoomChunkSize);
+    const auto left = Floor2(screenRect.GetLeft(), chunkViewSize) / chunkViewSize;
+    const auto top = Floor2(screenRect.GetTop(), chunkViewSize) / chunkViewSize;
+    const auto right = Floor2(screenRect.GetRight(), chunkViewSize) / chunkViewSize;
+    const auto bottom = Floor2(screenRect.GetBottom(), chunkViewSize) / chunkViewSize;
+    if (static_cast<size_t>(right - left + 1) * (bottom - top + 1) > chunks.size())
+    {
+        for (auto it = chunks.begin(); it != chunks.end();)
+        {
+            const auto chunkX = static_cast<int32_t>(it->first >> 32);
+            const auto chunkY = static_cast<int32_t>(static_cast<uint32_t>(it->first));
+            if (chunkX >= left && chunkX <= right && chunkY >= top && chunkY <= bottom)
+                it = chunks.erase(it);
+            else
+                ++it;
+        }
+        return;
+    }
+    for (auto chunkY = top; chunkY <= bottom; chunkY++)
+    {
+        for (auto chunkX = left; chunkX <= right; chunkX++)
+        {
+            chunks.erase(ViewportFarZoomChunkKey(chunkX, chunkY));
+        }
+    }
+}
+
+static void ViewportFarZoomCacheInvalidateRect(const Viewport* viewport, const ScreenRect& screenRect)
+{
+    for (auto& cache : _farZoomCaches)
+    {
+        if (cache.Context.Rotation == viewport->rotation)
+        {
+            ViewportFarZoomCacheInvalidateRect(cache, screenRect);
+        }
+        else if (std::none_of(_viewports.begin(), _viewports.end(), [&cache](const Viewport& vp) {
+                     return vp.rotation == cache.Context.Rotation;
+                 }))
+        {
+            // No viewport passes on changes in the rotation of this cache, the rectangle says nothing about it
+            cache.Chunks.clear();
+        }
+    }
+}
+
+/**
+ * Drops the far zoom chunks showing the given tile. Used for tile changes while nothing is presented, which do not
+ * reach the viewports but would otherwise leave chunks that are painted already showing the old tile.
+ */
+void ViewportFarZoomCacheInvalidateTile(int32_t x, int32_t y, int32_t z0, int32_t z1)
+{
+    for (auto& cache : _farZoomCaches)
+    {
+        const auto screenCoords = Translate3DTo2DWithZ(cache.Context.Rotation, CoordsXYZ{ x + 16, y + 16, 0 });
+        ViewportFarZoomCacheInvalidateRect(
+            cache, ScreenRect(screenCoords - ScreenCoordsXY{ 32, 32 + z1 }, screenCoords + ScreenCoordsXY{ 32, 32 - z0 }));
+    }
+}
+
+void ViewportFarZoomCacheInvalidate()
+{
+    InteractionQueryCacheInvalidate();
+    _farZoomCaches.clear();
+}
+
 static void ViewportPaint(const Viewport* viewport, DrawPixelInfo& dpi, const ScreenRect& screenRect)
+{
+    if (ViewportPaintFromFarZoomCache(viewport, dpi, screenRect))
+        return;
+
+    ViewportPaintUncached(viewport, dpi, screenRect);
+}
+
+static void ViewportPaintUncached(const Viewport* viewport, DrawPixelInfo& dpi, const ScreenRect& screenRect)
 {
     PROFILED_FUNCTION();
 
@@ -1096,42 +1570,20 @@ static void ViewportPaint(const Viewport* viewport, DrawPixelInfo& dpi, const Sc
             dpi2.pitch += dpi2.zoom_level.ApplyInversedTo(rightPitch);
         }
         dpi2.width = paintRight - dpi2.x;
-
-        if (useMultithreading)
-        {
-            _paintJobs->AddTask([session]() -> void { ViewportFillColumn(*session); });
-        }
-        else
-        {
-            ViewportFillColumn(*session);
-        }
     }
 
-    if (useMultithreading)
-    {
-        _paintJobs->Join();
-    }
+    ViewportProcessColumns(ViewportFillColumn, useMultithreading);
 
     // Paint columns.
-    for (auto* session : _paintColumns)
-    {
-        if (useParallelDrawing)
-        {
-            _paintJobs->AddTask([session]() -> void { ViewportPaintColumn(*session); });
-        }
-        else
-        {
-            ViewportPaintColumn(*session);
-        }
-    }
-    if (useParallelDrawing)
-    {
-        _paintJobs->Join();
-    }
+    ViewportProcessColumns(ViewportPaintColumn, useParallelDrawing);
 
     // Release resources.
     for (auto* session : _paintColumns)
     {
+        if (gPaintStatistics || gPaintOverdrawHeatmap)
+        {
+            PaintStatistics::RecordColumn(session->Stats);
+        }
         PaintSessionFree(session);
     }
 }
@@ -1556,12 +2008,11 @@ VisibilityKind GetPaintStructVisibility(const PaintStruct* ps, uint32_t viewFlag
 /**
  * Checks if a PaintStruct sprite type is in the filter mask.
  */
-static bool PSSpriteTypeIsInFilter(PaintStruct* ps, uint16_t filter)
+static bool InteractionItemIsInFilter(ViewportInteractionItem item, uint16_t filter)
 {
-    if (ps->InteractionItem != ViewportInteractionItem::None && ps->InteractionItem != ViewportInteractionItem::Label
-        && ps->InteractionItem <= ViewportInteractionItem::Banner)
+    if (item != ViewportInteractionItem::None && item != ViewportInteractionItem::Label && item <= ViewportInteractionItem::Banner)
     {
-        auto mask = EnumToFlag(ps->InteractionItem);
+        auto mask = EnumToFlag(item);
         if (filter & mask)
         {
             return true;
@@ -1870,15 +2321,13 @@ static bool IsSpriteInteractedWith(DrawPixelInfo& dpi, ImageId imageId, const Sc
 }
 
 /**
- *
- *  rct2: 0x0068862C
+ * Collects everything visible that was painted over the session's pixel, in paint order. What the pixel shows for a
+ * filter is the last candidate that passes it.
  */
-InteractionInfo SetInteractionInfoFromPaintSession(PaintSession* session, uint32_t viewFlags, uint16_t filter)
+static void CollectInteractionCandidates(PaintSession* session, uint32_t viewFlags, std::vector<InteractionInfo>& candidates)
 {
     PROFILED_FUNCTION();
 
-    InteractionInfo info{};
-
     PaintStruct* ps = session->PaintHead;
     while (ps != nullptr)
     {
@@ -1889,9 +2338,9 @@ InteractionInfo SetInteractionInfoFromPaintSession(PaintSession* session, uint32
             ps = next_ps;
             if (IsSpriteInteractedWith(session->DPI, ps->image_id, ps->ScreenPos))
             {
-                if (PSSpriteTypeIsInFilter(ps, filter) && GetPaintStructVisibility(ps, viewFlags) != VisibilityKind::Hidden)
+                if (GetPaintStructVisibility(ps, viewFlags) != VisibilityKind::Hidden)
                 {
-                    info = { ps };
+                    candidates.emplace_back(ps);
                 }
             }
             next_ps = ps->Children;
@@ -1903,9 +2352,9 @@ InteractionInfo SetInteractionInfoFromPaintSession(PaintSession* session, uint32
         {
             if (IsSpriteInteractedWith(session->DPI, attached_ps->image_id, ps->ScreenPos + attached_ps->RelativePos))
             {
-                if (PSSpriteTypeIsInFilter(ps, filter) && GetPaintStructVisibility(ps, viewFlags) != VisibilityKind::Hidden)
+                if (GetPaintStructVisibility(ps, viewFlags) != VisibilityKind::Hidden)
                 {
-                    info = { ps };
+                    candidates.emplace_back(ps);
                 }
             }
         }
@@ -1913,7 +2362,31 @@ InteractionInfo SetInteractionInfoFromPaintSession(PaintSession* session, uint32
 
         ps = old_ps->NextQuadrantEntry;
     }
-    return info;
+}
+
+static InteractionInfo GetFilteredInteractionInfo(const std::vector<InteractionInfo>& candidates, uint16_t filter)
+{
+    for (auto it = candidates.rbegin(); it != candidates.rend(); it++)
+    {
+        if (InteractionItemIsInFilter(it->SpriteType, filter))
+        {
+            return *it;
+        }
+    }
+    return {};
+}
+
+/**
+ *
+ *  rct2: 0x0068862C
+ */
+InteractionInfo SetInteractionInfoFromPaintSession(PaintSession* session, uint32_t viewFlags, uint16_t filter)
+{
+    PROFILED_FUNCTION();
+
+    std::vector<InteractionInfo> candidates;
+    CollectInteractionCandidates(session, viewFlags, candidates);
+    return GetFilteredInteractionInfo(candidates, filter);
 }
 
 /**
@@ -1956,18 +2429,35 @@ InteractionInfo GetMapCoordinatesFromPosWindow(WindowBase* window, const ScreenC
             viewLoc.x &= viewport->zoom.ApplyTo(0xFFFFFFFF) & 0xFFFFFFFF;
             viewLoc.y &= viewport->zoom.ApplyTo(0xFFFFFFFF) & 0xFFFFFFFF;
         }
-        DrawPixelInfo dpi;
-        dpi.x = viewLoc.x;
-        dpi.y = viewLoc.y;
-        dpi.height = 1;
-        dpi.zoom_level = viewport->zoom;
-        dpi.width = 1;
-
-        PaintSession* session = PaintSessionAlloc(dpi, viewport->flags, viewport->rotation);
-        PaintSessionGenerate(*session);
-        PaintSessionArrange(*session);
-        info = SetInteractionInfoFromPaintSession(session, viewport->flags, flags & 0xFFFF);
-        PaintSessionFree(session);
+
+        auto& cache = _interactionQueryCache;
+        if (!cache.Valid || cache.ViewportPtr != viewport || cache.ViewLoc != viewLoc || cache.Zoom != viewport->zoom
+            || cache.Rotation != viewport->rotation || cache.ViewFlags != viewport->flags
+            || cache.DrawCount != gCurrentDrawCount)
+        {
+            DrawPixelInfo dpi;
+            dpi.x = viewLoc.x;
+            dpi.y = viewLoc.y;
+            dpi.height = 1;
+            dpi.zoom_level = viewport->zoom;
+            dpi.width = 1;
+
+            PaintSession* session = PaintSessionAlloc(dpi, viewport->flags, viewport->rotation);
+            PaintSessionGenerate(*session);
+            PaintSessionArrange(*session);
+            cache.Candidates.clear();
+            CollectInteractionCandidates(session, viewport->flags, cache.Candidates);
+            PaintSessionFree(session);
+
+            cache.Valid = true;
+            cache.ViewportPtr = viewport;
+            cache.ViewLoc = viewLoc;
+            cache.Zoom = viewport->zoom;
+            cache.Rotation = viewport->rotation;
+            cache.ViewFlags = viewport->flags;
+            cache.DrawCount = gCurrentDrawCount;
+        }
+        info = GetFilteredInteractionInfo(cache.Candidates, flags & 0xFFFF);
     }
     return info;
 }
@@ -1979,6 +2469,11 @@ void ViewportInvalidate(const Viewport* viewport, const ScreenRect& screenRect)
 {
     PROFILED_FUNCTION();
 
+    InteractionQueryCacheInvalidate();
+
+    // Before any visibility checks or clipping, chunks out of view may be shown again later on
+    ViewportFarZoomCacheInvalidateRect(viewport, screenRect);
+
     // if unknown viewport visibility, use the containing window to discover the status
     if (viewport->visibility == VisibilityCache::Unknown)
     {
@@ -135,11 +135,17 @@ void ViewportRemove(Viewport* viewport);
 void ViewportsInvalidate(int32_t x, int32_t y, int32_t z0, int32_t z1, ZoomLevel maxZoom);
 void ViewportsInvalidate(const CoordsXYZ& pos, int32_t width, int32_t minHeight, int32_t maxHeight, ZoomLevel maxZoom);
 void ViewportsInvalidate(const ScreenRect& screenRect, ZoomLevel maxZoom = ZoomLevel{ -1 });
+void ViewportsFlushInvalidations();
+void ViewportsInvalidateAll();
+bool ViewportsIntersectMapRange(const MapRange& range, int32_t maxHeight, ZoomLevel maxZoom);
+bool ViewportsIntersectViewRect(const ScreenRect& rect);
 void ViewportUpdatePosition(WindowBase* window);
 void ViewportUpdateSmartFollowGuest(WindowBase* window, const Guest& peep);
 void ViewportRotateSingle(WindowBase* window, int32_t direction);
 void ViewportRotateAll(int32_t direction);
 void ViewportRender(DrawPixelInfo& dpi, const Viewport* viewport, const ScreenRect& screenRect);
+void ViewportFarZoomCacheInvalidate();
+void ViewportFarZoomCacheInvalidateTile(int32_t x, int32_t y, int32_t z0, int32_t z1);
 
 CoordsXYZ ViewportAdjustForMapHeight(const ScreenCoordsXY& startCoords, uint8_t rotation);
 
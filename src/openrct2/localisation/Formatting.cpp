@@ -15,6 +15,7 @@
 #include "Localisation.h"
 #include "StringIds.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 
@@ -816,6 +817,24 @@ namespace OpenRCT2
         return FormatStringAny(buffer, bufferLen, fmt, anyArgs);
     }
 
+    bool FormatStringLegacyGetArgsSize(StringId id, const void* args, size_t& outSize)
+    {
+        thread_local std::vector<FormatArg_t> anyArgs;
+        anyArgs.clear();
+        auto argsEnd = args;
+        BuildAnyArgListFromLegacyArgBuffer(GetFmtStringById(id), anyArgs, argsEnd);
+
+        // String arguments are pointers, what they point to can change without the argument bytes changing
+        auto hasStringArgs = std::any_of(anyArgs.begin(), anyArgs.end(), [](const FormatArg_t& arg) {
+            return std::holds_alternative<const char*>(arg) || std::holds_alternative<std::string>(arg);
+        });
+        if (hasStringArgs)
+            return false;
+
+        outSize = static_cast<size_t>(static_cast<const uint8_t*>(argsEnd) - static_cast<const uint8_t*>(args));
+        return true;
+    }
+
     static void FormatMonthYear(FormatBuffer& ss, int32_t month, int32_t year)
     {
         thread_local std::vector<FormatArg_t> tempArgs;
@@ -306,4 +306,10 @@ namespace OpenRCT2
     std::string FormatStringAny(const FmtString& fmt, const std::vector<FormatArg_t>& args);
     size_t FormatStringAny(char* buffer, size_t bufferLen, const FmtString& fmt, const std::vector<FormatArg_t>& args);
     size_t FormatStringLegacy(char* buffer, size_t bufferLen, StringId id, const void* args);
+
+    /**
+     * Gets the number of bytes of the legacy argument buffer that formatting the given string reads. Returns false if
+     * the arguments contain strings, in which case the formatted result depends on more than those bytes.
+     */
+    bool FormatStringLegacyGetArgsSize(StringId id, const void* args, size_t& outSize);
 } // namespace OpenRCT2
@@ -10,6 +10,8 @@
 #include "../Context.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
+#include "../drawing/Text.h"
+#include "../entity/PeepStringCache.h"
 #include "../interface/FontFamilies.h"
 #include "../interface/Fonts.h"
 #include "../interface/Window.h"
@@ -86,6 +88,8 @@ bool LanguageOpen(int32_t id)
         // Objects and their localised strings need to be refreshed
         objectManager.ResetObjects();
         ScrollingTextInvalidate();
+        FormattedTextCacheInvalidate();
+        PeepStringCacheInvalidateAll();
         WindowNotifyLanguageChange();
         return true;
     }
@@ -109,10 +113,12 @@ void LanguageFreeObjectString(StringId stringId)
 {
     auto& localisationService = OpenRCT2::GetContext()->GetLocalisationService();
     localisationService.FreeObjectString(stringId);
+    FormattedTextCacheInvalidate();
 }
 
 StringId LanguageAllocateObjectString(const std::string& target)
 {
     auto& localisationService = OpenRCT2::GetContext()->GetLocalisationService();
+    FormattedTextCacheInvalidate();
     return localisationService.AllocateObjectString(target);
 }
@@ -22,6 +22,8 @@
 #include "LocalisationService.h"
 
 #include <algorithm>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
@@ -42,8 +44,12 @@ struct ScenarioOverride
 class LanguagePack final : public ILanguagePack
 {
 private:
+    static constexpr uint32_t kNoString = std::numeric_limits<uint32_t>::max();
+
     uint16_t const _id;
-    std::vector<std::string> _strings;
+    // All strings of the pack, null terminated one after another, the offsets give where each string id starts
+    std::string _stringData;
+    std::vector<uint32_t> _stringOffsets;
     std::vector<ScenarioOverride> _scenarioOverrides;
 
     ///////////////////////////////////////////////////////////////////////////
@@ -92,6 +98,9 @@ public:
     {
         Guard::ArgumentNotNull(text);
 
+        // The strings take up about as much as the file, less the identifiers and comments
+        _stringData.reserve(std::strlen(text));
+
         auto reader = UTF8StringReader(text);
         while (reader.CanRead())
         {
@@ -101,6 +110,7 @@ public:
         // Clean up the parsing work data
         _currentGroup.clear();
         _currentScenarioOverride = nullptr;
+        _stringData.shrink_to_fit();
     }
 
     uint16_t GetId() const override
@@ -110,22 +120,25 @@ public:
 
     uint32_t GetCount() const override
     {
-        return static_cast<uint32_t>(_strings.size());
+        return static_cast<uint32_t>(_stringOffsets.size());
     }
 
     void RemoveString(StringId stringId) override
     {
-        if (_strings.size() > static_cast<size_t>(stringId))
+        if (_stringOffsets.size() > static_cast<size_t>(stringId))
         {
-            _strings[stringId].clear();
+            _stringOffsets[stringId] = kNoString;
         }
     }
 
+    /**
+     * @note Strings previously returned by GetString may move when the string data has to grow.
+     */
     void SetString(StringId stringId, const std::string& str) override
     {
-        if (_strings.size() > static_cast<size_t>(stringId))
+        if (_stringOffsets.size() > static_cast<size_t>(stringId))
         {
-            _strings[stringId] = str;
+            _stringOffsets[stringId] = AppendStringData(str);
         }
     }
 
@@ -146,9 +159,13 @@ public:
             return nullptr;
         }
 
-        if ((_strings.size() > static_cast<size_t>(stringId)) && !_strings[stringId].empty())
+        if (_stringOffsets.size() > static_cast<size_t>(stringId))
         {
-            return _strings[stringId].c_str();
+            auto offset = _stringOffsets[stringId];
+            if (offset != kNoString && _stringData[offset] != '\0')
+            {
+                return _stringData.c_str() + offset;
+            }
         }
 
         return nullptr;
@@ -177,6 +194,14 @@ public:
     }
 
 private:
+    uint32_t AppendStringData(std::string_view str)
+    {
+        auto offset = static_cast<uint32_t>(_stringData.size());
+        _stringData.append(str);
+        _stringData.push_back('\0');
+        return offset;
+    }
+
     ScenarioOverride* GetScenarioOverride(const std::string& scenarioIdentifier)
     {
         for (auto& so : _scenarioOverrides)
@@ -460,11 +485,11 @@ private:
         if (_currentGroup.empty())
         {
             // Make sure the list is big enough to contain this string id
-            if (static_cast<size_t>(stringId) >= _strings.size())
+            if (static_cast<size_t>(stringId) >= _stringOffsets.size())
             {
-                _strings.resize(stringId + 1);
+                _stringOffsets.resize(stringId + 1, kNoString);
             }
-            _strings[stringId] = s;
+            _stringOffsets[stringId] = AppendStringData(s);
         }
         else
         {
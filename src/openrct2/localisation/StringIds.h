@@ -4043,6 +4043,16 @@ enum : uint16_t
 
     STR_ERR_INVALID_COLOUR = 6625,
 
+    STR_MULTIPLAYER_CATCHING_UP = 6626,
+
+    STR_DEBUG_PAINT_SHOW_STATISTICS = 6627,
+    STR_DEBUG_PAINT_SHOW_OVERDRAW_HEATMAP = 6628,
+    STR_DEBUG_PAINT_STATS_PAINT_STRUCTS = 6629,
+    STR_DEBUG_PAINT_STATS_SPRITES_DRAWN = 6630,
+    STR_DEBUG_PAINT_STATS_PIXELS_COVERED = 6631,
+    STR_DEBUG_PAINT_STATS_MAX_OVERDRAW = 6632,
+    STR_DEBUG_PAINT_STATS_TIMES = 6633,
+
     // Have to include resource strings (from scenarios and objects) for the time being now that language is partially working
     /* MAX_STR_COUNT = 32768 */ // MAX_STR_COUNT - upper limit for number of strings, not the current count strings
 };
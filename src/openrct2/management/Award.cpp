@@ -23,6 +23,9 @@
 #include "NewsItem.h"
 
 #include <algorithm>
+#include <array>
+#include <limits>
+#include <type_traits>
 
 using namespace OpenRCT2;
 
@@ -76,34 +79,100 @@ bool AwardIsPositive(AwardType type)
 
 #pragma region Award checks
 
-/** More than 1/16 of the total guests must be thinking untidy thoughts. */
-static bool AwardIsDeservedMostUntidy(int32_t activeAwardTypes)
+/**
+ * Tally of the guests in the park by their most recent thought, only thoughts that are still fresh are counted. The
+ * guest based checks all look at the same thoughts, so they are counted in one pass instead of a loop per check.
+ */
+struct GuestThoughtCounts
 {
-    if (activeAwardTypes & EnumToFlag(AwardType::MostBeautiful))
-        return false;
-    if (activeAwardTypes & EnumToFlag(AwardType::BestStaff))
-        return false;
-    if (activeAwardTypes & EnumToFlag(AwardType::MostTidy))
-        return false;
+    uint32_t GuestsInPark{};
+    std::array<uint32_t, std::numeric_limits<std::underlying_type_t<PeepThoughtType>>::max() + 1> FreshThoughts{};
+
+    uint32_t Get(PeepThoughtType type) const
+    {
+        return FreshThoughts[EnumValue(type)];
+    }
 
-    uint32_t negativeCount = 0;
+    uint32_t GetUntidy() const
+    {
+        return Get(PeepThoughtType::BadLitter) + Get(PeepThoughtType::PathDisgusting) + Get(PeepThoughtType::Vandalism);
+    }
+};
+
+static GuestThoughtCounts CountGuestThoughts()
+{
+    GuestThoughtCounts counts;
     for (auto peep : EntityList<Guest>())
     {
         if (peep->OutsideOfPark)
             continue;
 
+        counts.GuestsInPark++;
         const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
+        if (thought.freshness <= 5)
+            counts.FreshThoughts[EnumValue(thought.type)]++;
+    }
+    return counts;
+}
+
+static uint32_t CountOpenRidesInCategory(uint8_t category)
+{
+    uint32_t count = 0;
+    for (const auto& ride : GetRideManager())
+    {
+        if (ride.status != RideStatus::Open || (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
+            continue;
+
+        auto rideEntry = ride.GetRideEntry();
+        if (rideEntry != nullptr && RideEntryHasCategory(*rideEntry, category))
+            count++;
+    }
+    return count;
+}
+
+struct FoodShopCounts
+{
+    uint32_t Shops{};
+    uint32_t UniqueShops{};
+};
+
+static FoodShopCounts CountOpenFoodShops()
+{
+    FoodShopCounts counts;
+    uint64_t shopTypes = 0;
+    for (const auto& ride : GetRideManager())
+    {
+        if (ride.status != RideStatus::Open)
+            continue;
+        if (!ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_SELLS_FOOD))
             continue;
 
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
+        counts.Shops++;
+        auto rideEntry = ride.GetRideEntry();
+        if (rideEntry != nullptr)
         {
-            negativeCount++;
+            if (!(shopTypes & EnumToFlag(rideEntry->shop_item[0])))
+            {
+                shopTypes |= EnumToFlag(rideEntry->shop_item[0]);
+                counts.UniqueShops++;
+            }
         }
     }
+    return counts;
+}
+
+/** More than 1/16 of the total guests must be thinking untidy thoughts. */
+static bool AwardIsDeservedMostUntidy(int32_t activeAwardTypes)
+{
+    if (activeAwardTypes & EnumToFlag(AwardType::MostBeautiful))
+        return false;
+    if (activeAwardTypes & EnumToFlag(AwardType::BestStaff))
+        return false;
+    if (activeAwardTypes & EnumToFlag(AwardType::MostTidy))
+        return false;
 
-    return (negativeCount > GetGameState().NumGuestsInPark / 16);
+    const auto thoughts = CountGuestThoughts();
+    return (thoughts.GetUntidy() > GetGameState().NumGuestsInPark / 16);
 }
 
 /** More than 1/64 of the total guests must be thinking tidy thoughts and less than 6 guests thinking untidy thoughts. */
@@ -114,55 +183,15 @@ static bool AwardIsDeservedMostTidy(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::VeryClean)
-            positiveCount++;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
-    return (negativeCount <= 5 && positiveCount > GetGameState().NumGuestsInPark / 64);
+    const auto thoughts = CountGuestThoughts();
+    return (
+        thoughts.GetUntidy() <= 5 && thoughts.Get(PeepThoughtType::VeryClean) > GetGameState().NumGuestsInPark / 64);
 }
 
 /** At least 6 open roller coasters. */
 static bool AwardIsDeservedBestRollercoasters([[maybe_unused]] int32_t activeAwardTypes)
 {
-    auto rollerCoasters = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        auto rideEntry = ride.GetRideEntry();
-        if (rideEntry == nullptr)
-        {
-            continue;
-        }
-
-        if (ride.status != RideStatus::Open || (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
-        {
-            continue;
-        }
-
-        if (!RideEntryHasCategory(*rideEntry, RIDE_CATEGORY_ROLLERCOASTER))
-        {
-            continue;
-        }
-
-        rollerCoasters++;
-    }
-    return (rollerCoasters >= 6);
+    return (CountOpenRidesInCategory(RIDE_CATEGORY_ROLLERCOASTER) >= 6);
 }
 
 /** Entrance fee is 0.10 less than half of the total ride value. */
@@ -196,29 +225,9 @@ static bool AwardIsDeservedMostBeautiful(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    auto list = EntityList<Guest>();
-    for (auto peep : list)
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::Scenery)
-            positiveCount++;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
-    return (negativeCount <= 15 && positiveCount > GetGameState().NumGuestsInPark / 128);
+    const auto thoughts = CountGuestThoughts();
+    return (
+        thoughts.GetUntidy() <= 15 && thoughts.Get(PeepThoughtType::Scenery) > GetGameState().NumGuestsInPark / 128);
 }
 
 /** Entrance fee is more than total ride value. */
@@ -242,18 +251,8 @@ static bool AwardIsDeservedWorstValue(int32_t activeAwardTypes)
 /** No more than 2 people who think the vandalism is bad and no crashes. */
 static bool AwardIsDeservedSafest([[maybe_unused]] int32_t activeAwardTypes)
 {
-    auto peepsWhoDislikeVandalism = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Vandalism)
-            peepsWhoDislikeVandalism++;
-    }
-
-    if (peepsWhoDislikeVandalism > 2)
+    const auto thoughts = CountGuestThoughts();
+    if (thoughts.Get(PeepThoughtType::Vandalism) > 2)
         return false;
 
     // Check for rides that have crashed maybe?
@@ -286,43 +285,12 @@ static bool AwardIsDeservedBestFood(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(AwardType::WorstFood))
         return false;
 
-    uint32_t shops = 0;
-    uint32_t uniqueShops = 0;
-    uint64_t shopTypes = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        if (ride.status != RideStatus::Open)
-            continue;
-        if (!ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_SELLS_FOOD))
-            continue;
-
-        shops++;
-        auto rideEntry = GetRideEntryByIndex(ride.subtype);
-        if (rideEntry != nullptr)
-        {
-            if (!(shopTypes & EnumToFlag(rideEntry->shop_item[0])))
-            {
-                shopTypes |= EnumToFlag(rideEntry->shop_item[0]);
-                uniqueShops++;
-            }
-        }
-    }
-
-    if (shops < 7 || uniqueShops < 4 || shops < GetGameState().NumGuestsInPark / 128)
+    const auto shops = CountOpenFoodShops();
+    if (shops.Shops < 7 || shops.UniqueShops < 4 || shops.Shops < GetGameState().NumGuestsInPark / 128)
         return false;
 
-    // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
-    return (hungryPeeps <= 12);
+    const auto thoughts = CountGuestThoughts();
+    return (thoughts.Get(PeepThoughtType::Hungry) <= 12);
 }
 
 /** No more than 2 unique shops, less than one shop per 256 guests and more than 15 hungry guests. */
@@ -331,43 +299,12 @@ static bool AwardIsDeservedWorstFood(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(AwardType::BestFood))
         return false;
 
-    uint32_t shops = 0;
-    uint32_t uniqueShops = 0;
-    uint64_t shopTypes = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        if (ride.status != RideStatus::Open)
-            continue;
-        if (!ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_SELLS_FOOD))
-            continue;
-
-        shops++;
-        auto rideEntry = ride.GetRideEntry();
-        if (rideEntry != nullptr)
-        {
-            if (!(shopTypes & EnumToFlag(rideEntry->shop_item[0])))
-            {
-                shopTypes |= EnumToFlag(rideEntry->shop_item[0]);
-                uniqueShops++;
-            }
-        }
-    }
-
-    if (uniqueShops > 2 || shops > GetGameState().NumGuestsInPark / 256)
+    const auto shops = CountOpenFoodShops();
+    if (shops.UniqueShops > 2 || shops.Shops > GetGameState().NumGuestsInPark / 256)
         return false;
 
-    // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
-    return (hungryPeeps > 15);
+    const auto thoughts = CountGuestThoughts();
+    return (thoughts.Get(PeepThoughtType::Hungry) > 15);
 }
 
 /** At least 4 toilets, 1 toilet per 128 guests and no more than 16 guests who think they need the toilet. */
@@ -389,17 +326,8 @@ static bool AwardIsDeservedBestToilets([[maybe_unused]] int32_t activeAwardTypes
         return false;
 
     // Count number of guests who are thinking they need the toilet
-    auto guestsWhoNeedToilet = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Toilet)
-            guestsWhoNeedToilet++;
-    }
-    return (guestsWhoNeedToilet <= 16);
+    const auto thoughts = CountGuestThoughts();
+    return (thoughts.Get(PeepThoughtType::Toilet) <= 16);
 }
 
 /** More than half of the rides have satisfaction <= 6 and park rating <= 650. */
@@ -432,29 +360,7 @@ static bool AwardIsDeservedMostDisappointing(int32_t activeAwardTypes)
 /** At least 6 open water rides. */
 static bool AwardIsDeservedBestWaterRides([[maybe_unused]] int32_t activeAwardTypes)
 {
-    auto waterRides = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        auto rideEntry = ride.GetRideEntry();
-        if (rideEntry == nullptr)
-        {
-            continue;
-        }
-
-        if (ride.status != RideStatus::Open || (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
-        {
-            continue;
-        }
-
-        if (!RideEntryHasCategory(*rideEntry, RIDE_CATEGORY_WATER))
-        {
-            continue;
-        }
-
-        waterRides++;
-    }
-
-    return (waterRides >= 6);
+    return (CountOpenRidesInCategory(RIDE_CATEGORY_WATER) >= 6);
 }
 
 /** At least 6 custom designed rides. */
@@ -520,48 +426,15 @@ static bool AwardIsDeservedMostDazzlingRideColours(int32_t activeAwardTypes)
 /** At least 10 peeps and more than 1/64 of total guests are lost or can't find something. */
 static bool AwardIsDeservedMostConfusingLayout([[maybe_unused]] int32_t activeAwardTypes)
 {
-    uint32_t peepsCounted = 0;
-    uint32_t peepsLost = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        peepsCounted++;
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && (thought.type == PeepThoughtType::Lost || thought.type == PeepThoughtType::CantFind))
-            peepsLost++;
-    }
-
-    return (peepsLost >= 10 && peepsLost >= peepsCounted / 64);
+    const auto thoughts = CountGuestThoughts();
+    const auto peepsLost = thoughts.Get(PeepThoughtType::Lost) + thoughts.Get(PeepThoughtType::CantFind);
+    return (peepsLost >= 10 && peepsLost >= thoughts.GuestsInPark / 64);
 }
 
 /** At least 10 open gentle rides. */
 static bool AwardIsDeservedBestGentleRides([[maybe_unused]] int32_t activeAwardTypes)
 {
-    auto gentleRides = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        auto rideEntry = ride.GetRideEntry();
-        if (rideEntry == nullptr)
-        {
-            continue;
-        }
-
-        if (ride.status != RideStatus::Open || (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
-        {
-            continue;
-        }
-
-        if (!RideEntryHasCategory(*rideEntry, RIDE_CATEGORY_GENTLE))
-        {
-            continue;
-        }
-
-        gentleRides++;
-    }
-
-    return (gentleRides >= 10);
+    return (CountOpenRidesInCategory(RIDE_CATEGORY_GENTLE) >= 10);
 }
 
 using award_deserved_check = bool (*)(int32_t);
@@ -13,6 +13,7 @@
 #include "../Game.h"
 #include "../GameState.h"
 #include "../OpenRCT2.h"
+#include "../entity/EntityList.h"
 #include "../entity/Peep.h"
 #include "../entity/Staff.h"
 #include "../interface/Window.h"
@@ -91,6 +92,37 @@ void FinancePayment(money64 amount, ExpenditureType type)
     ContextBroadcastIntent(&intent);
 }
 
+// Number of staff of each type, wages are derived from these instead of walking the staff list on every payment. The
+// counts are taken again once the staff list changed or a staff member was given another type.
+struct StaffCounts
+{
+    std::array<uint32_t, EnumValue(StaffType::Count)> Counts{};
+    uint32_t ListVersion{};
+    bool Valid{};
+};
+static StaffCounts _staffCounts;
+
+static const StaffCounts& FinanceGetStaffCounts()
+{
+    const auto listVersion = GetEntityListVersion(EntityType::Staff);
+    if (!_staffCounts.Valid || _staffCounts.ListVersion != listVersion)
+    {
+        _staffCounts.Counts = {};
+        for (auto peep : EntityList<Staff>())
+        {
+            _staffCounts.Counts[EnumValue(peep->AssignedStaffType)]++;
+        }
+        _staffCounts.ListVersion = listVersion;
+        _staffCounts.Valid = true;
+    }
+    return _staffCounts;
+}
+
+void FinanceInvalidateStaffWages()
+{
+    _staffCounts.Valid = false;
+}
+
 /**
  * Pays the wages of all active staff members in the park.
  *  rct2: 0x006C18A9
@@ -104,9 +136,16 @@ void FinancePayWages()
         return;
     }
 
-    for (auto peep : EntityList<Staff>())
+    // Paid as a single payment, the quarter wage is still rounded per staff member
+    money64 wages = 0;
+    const auto& staffCounts = FinanceGetStaffCounts();
+    for (size_t i = 0; i < staffCounts.Counts.size(); i++)
+    {
+        wages += staffCounts.Counts[i] * (GetStaffWage(static_cast<StaffType>(i)) / 4);
+    }
+    if (wages != 0)
     {
-        FinancePayment(GetStaffWage(peep->AssignedStaffType) / 4, ExpenditureType::Wages);
+        FinancePayment(wages, ExpenditureType::Wages);
     }
 }
 
@@ -158,6 +197,7 @@ void FinancePayRideUpkeep()
 {
     PROFILED_FUNCTION();
 
+    money64 totalUpkeep = 0;
     for (auto& ride : GetRideManager())
     {
         if (!(ride.lifecycle_flags & RIDE_LIFECYCLE_EVER_BEEN_OPENED))
@@ -172,7 +212,7 @@ void FinancePayRideUpkeep()
             {
                 ride.total_profit -= upkeep;
                 ride.window_invalidate_flags |= RIDE_INVALIDATE_RIDE_INCOME;
-                FinancePayment(upkeep, ExpenditureType::RideRunningCosts);
+                totalUpkeep += upkeep;
             }
         }
 
@@ -181,6 +221,12 @@ void FinancePayRideUpkeep()
             ride.last_crash_type--;
         }
     }
+
+    // One payment for all rides, so the cash is not updated and broadcast once per ride
+    if (totalUpkeep != 0)
+    {
+        FinancePayment(totalUpkeep, ExpenditureType::RideRunningCosts);
+    }
 }
 
 void FinanceResetHistory()
@@ -255,9 +301,10 @@ void FinanceUpdateDailyProfit()
     if (!(gameState.Park.Flags & PARK_FLAGS_NO_MONEY))
     {
         // Staff costs
-        for (auto peep : EntityList<Staff>())
+        const auto& staffCounts = FinanceGetStaffCounts();
+        for (size_t i = 0; i < staffCounts.Counts.size(); i++)
         {
-            current_profit -= GetStaffWage(peep->AssignedStaffType);
+            current_profit -= staffCounts.Counts[i] * GetStaffWage(static_cast<StaffType>(i));
         }
 
         // Research costs
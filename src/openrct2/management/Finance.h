@@ -42,6 +42,8 @@ bool FinanceCheckMoneyRequired(uint32_t flags);
 bool FinanceCheckAffordability(money64 cost, uint32_t flags);
 void FinancePayment(money64 amount, ExpenditureType type);
 void FinancePayWages();
+// Call when the type of a staff member changed, hiring and firing are picked up from the staff list.
+void FinanceInvalidateStaffWages();
 void FinancePayResearch();
 void FinancePayInterest();
 void FinancePayRideUpkeep();
@@ -0,0 +1,185 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ActionPrediction.h"
+
+#include "../Context.h"
+#include "../Game.h"
+#include "../GameState.h"
+#include "../actions/FootpathPlaceAction.h"
+#include "../actions/FootpathRemoveAction.h"
+#include "../actions/SmallSceneryPlaceAction.h"
+#include "../actions/SmallSceneryRemoveAction.h"
+#include "../config/Config.h"
+#include "network.h"
+
+#include <deque>
+
+using namespace OpenRCT2;
+
+// Actions rejected by the server are never sent back, their prediction is dropped after this many ticks
+static constexpr uint32_t kPredictionTimeout = 10 * kGameUpdateFPS;
+
+static constexpr uint32_t kPredictionFlags = GAME_COMMAND_FLAG_GHOST | GAME_COMMAND_FLAG_ALLOW_DURING_PAUSED
+    | GAME_COMMAND_FLAG_NO_SPEND;
+
+struct PredictedAction
+{
+    GameAction::Ptr Ghost;
+    uint32_t NetworkId{};
+    uint32_t Tick{};
+    // Where the ghost ended up, needed to remove it again
+    CoordsXYZ Position;
+    uint8_t Quadrant{};
+    // Visible is false once the ghost could not be placed, the prediction is then only kept to be matched
+    bool Visible{};
+    bool Placed{};
+};
+
+static std::deque<PredictedAction> _predictions;
+
+static bool IsPredictable(const GameAction& action)
+{
+    if (action.GetFlags() & (GAME_COMMAND_FLAG_GHOST | GAME_COMMAND_FLAG_NO_SPEND))
+        return false;
+
+    switch (action.GetType())
+    {
+        case GameCommand::PlacePath:
+        case GameCommand::PlaceScenery:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static void PlacePrediction(PredictedAction& prediction)
+{
+    // Executed directly rather than through GameActions so the ghost stays local and is not seen by script hooks
+    auto result = prediction.Ghost->Query();
+    if (result.Error == GameActions::Status::Ok)
+    {
+        result = prediction.Ghost->Execute();
+    }
+    if (result.Error != GameActions::Status::Ok)
+    {
+        prediction.Visible = false;
+        return;
+    }
+
+    prediction.Position = result.Position;
+    if (prediction.Ghost->GetType() == GameCommand::PlaceScenery)
+    {
+        auto sceneryResult = result.GetData<SmallSceneryPlaceActionResult>();
+        prediction.Position.z = sceneryResult.BaseHeight;
+        prediction.Quadrant = sceneryResult.SceneryQuadrant;
+    }
+    prediction.Placed = true;
+}
+
+static void RemovePrediction(PredictedAction& prediction)
+{
+    if (!prediction.Placed)
+        return;
+    prediction.Placed = false;
+
+    switch (prediction.Ghost->GetType())
+    {
+        case GameCommand::PlacePath:
+        {
+            auto removeAction = FootpathRemoveAction(prediction.Position);
+            removeAction.SetFlags(kPredictionFlags);
+            removeAction.Execute();
+            break;
+        }
+        case GameCommand::PlaceScenery:
+        {
+            const auto& placeAction = static_cast<const SmallSceneryPlaceAction&>(*prediction.Ghost);
+            auto removeAction = SmallSceneryRemoveAction(
+                prediction.Position, prediction.Quadrant, placeAction.GetSceneryType());
+            removeAction.SetFlags(kPredictionFlags);
+            removeAction.Execute();
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void NetworkPredictAction(const GameAction& action)
+{
+    if (!gConfigNetwork.PredictLocalActions || NetworkGetMode() != NETWORK_MODE_CLIENT || !IsPredictable(action))
+        return;
+
+    PredictedAction prediction;
+    prediction.Ghost = GameActions::Clone(&action);
+    prediction.Ghost->SetCallback(nullptr);
+    prediction.Ghost->SetFlags(action.GetFlags() | kPredictionFlags);
+    prediction.NetworkId = action.GetNetworkId();
+    prediction.Tick = GetGameState().CurrentTicks;
+    prediction.Visible = true;
+    PlacePrediction(prediction);
+    _predictions.push_back(std::move(prediction));
+}
+
+void NetworkPredictionBeginAuthoritative(const GameAction& action)
+{
+    if (_predictions.empty())
+        return;
+
+    NetworkRemovePredictions();
+
+    if (action.GetPlayer().id != NetworkGetCurrentPlayerId())
+        return;
+
+    // The server runs a client's actions in the order they were sent, so every prediction older than this action
+    // belongs to an action that was rejected.
+    const auto networkId = action.GetNetworkId();
+    while (!_predictions.empty() && _predictions.front().NetworkId <= networkId)
+    {
+        _predictions.pop_front();
+    }
+}
+
+void NetworkPredictionEndAuthoritative()
+{
+    NetworkRestorePredictions();
+}
+
+void NetworkRemovePredictions()
+{
+    // Newest first, a later prediction may have been placed on top of an earlier one
+    for (auto it = _predictions.rbegin(); it != _predictions.rend(); it++)
+    {
+        RemovePrediction(*it);
+    }
+}
+
+void NetworkRestorePredictions()
+{
+    const auto currentTick = GetGameState().CurrentTicks;
+    while (!_predictions.empty() && currentTick - _predictions.front().Tick > kPredictionTimeout)
+    {
+        RemovePrediction(_predictions.front());
+        _predictions.pop_front();
+    }
+
+    for (auto& prediction : _predictions)
+    {
+        if (prediction.Visible && !prediction.Placed)
+        {
+            PlacePrediction(prediction);
+        }
+    }
+}
+
+void NetworkClearPredictions()
+{
+    _predictions.clear();
+}
@@ -0,0 +1,45 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+class GameAction;
+
+/*
+ * Client side prediction of the player's own actions. While an action travels to the server and back, a ghost of its
+ * result is shown so building does not feel delayed by the connection. The ghosts never take part in the simulation:
+ * they are taken off the map around every authoritative change and dropped once the server's action arrives or when
+ * it never does.
+ */
+
+/*
+ * Places a ghost of the given action if it can be predicted, called when a client sends an action to the server.
+ */
+void NetworkPredictAction(const GameAction& action);
+
+/*
+ * Takes all predictions off the map before an action from the server is executed, dropping the oldest prediction
+ * of the same kind if the action is one of the player's own.
+ */
+void NetworkPredictionBeginAuthoritative(const GameAction& action);
+
+/*
+ * Puts the remaining predictions back on the map after an action from the server was executed.
+ */
+void NetworkPredictionEndAuthoritative();
+
+void NetworkRemovePredictions();
+void NetworkRestorePredictions();
+
+/*
+ * Forgets all predictions without touching the map, for when the map is replaced.
+ */
+void NetworkClearPredictions();
@@ -119,6 +119,7 @@ const std::array<NetworkAction, static_cast<size_t>(NetworkPermission::Count)> N
             GameCommand::SetRidePrice,
             GameCommand::SetBrakesSpeed,
             GameCommand::SetColourScheme,
+            GameCommand::SimulateRideTest,
         },
     },
     NetworkAction{
@@ -127,6 +128,7 @@ const std::array<NetworkAction, static_cast<size_t>(NetworkPermission::Count)> N
         {
             GameCommand::RemoveScenery,
             GameCommand::PlaceScenery,
+            GameCommand::PlaceSceneryBatch,
             GameCommand::SetBrakesSpeed,
             GameCommand::RemoveWall,
             GameCommand::PlaceWall,
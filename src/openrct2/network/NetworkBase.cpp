@@ -28,6 +28,7 @@
 #include "../localisation/Formatting.h"
 #include "../park/ParkFile.h"
 #include "../platform/Platform.h"
+#include "../profiling/Profiling.h"
 #include "../scenario/Scenario.h"
 #include "../scripting/ScriptEngine.h"
 #include "../ui/UiContext.h"
@@ -46,7 +47,7 @@ using namespace OpenRCT2;
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
 
-#define NETWORK_STREAM_VERSION "0"
+#define NETWORK_STREAM_VERSION "6"
 
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
@@ -59,6 +60,15 @@ static int32_t _pickup_peep_old_x = LOCATION_NULL;
 // with uint16_t and needs some spare room for other data in the packet.
 static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
 
+// Id of the built-in spectator group, used for players joining through a spectator slot.
+static constexpr uint8_t kSpectatorGroupId = 1;
+
+// Game action batches are sent before reaching this size, leaves room for the packet header.
+static constexpr size_t kMaxActionBatchSize = 1024 * 60;
+// Batches smaller than this are not worth compressing.
+static constexpr size_t kMinCompressedActionBatchSize = 512;
+static constexpr uint8_t kActionBatchFlagCompressed = 1 << 0;
+
 // If data is sent fast enough it would halt the entire server, process only a maximum amount.
 // This limit is per connection, the current value was determined by tests with fuzzing.
 static constexpr uint32_t MaxPacketsPerUpdate = 100;
@@ -95,14 +105,18 @@ static constexpr uint32_t MaxPacketsPerUpdate = 100;
 #    include <algorithm>
 #    include <array>
 #    include <cerrno>
+#    include <chrono>
 #    include <cmath>
+#    include <cstring>
 #    include <fstream>
 #    include <functional>
+#    include <limits>
 #    include <list>
 #    include <map>
 #    include <memory>
 #    include <set>
 #    include <string>
+#    include <unordered_set>
 #    include <vector>
 
 using namespace OpenRCT2;
@@ -125,6 +139,7 @@ NetworkBase::NetworkBase(OpenRCT2::IContext& context)
     client_command_handlers[NetworkCommand::Map] = &NetworkBase::Client_Handle_MAP;
     client_command_handlers[NetworkCommand::Chat] = &NetworkBase::Client_Handle_CHAT;
     client_command_handlers[NetworkCommand::GameAction] = &NetworkBase::Client_Handle_GAME_ACTION;
+    client_command_handlers[NetworkCommand::GameActionBatch] = &NetworkBase::Client_Handle_GAME_ACTION_BATCH;
     client_command_handlers[NetworkCommand::Tick] = &NetworkBase::Client_Handle_TICK;
     client_command_handlers[NetworkCommand::PlayerList] = &NetworkBase::Client_Handle_PLAYERLIST;
     client_command_handlers[NetworkCommand::PlayerInfo] = &NetworkBase::Client_Handle_PLAYERINFO;
@@ -207,6 +222,8 @@ void NetworkBase::Close()
         _serverTickData.clear();
         _pendingPlayerLists.clear();
         _pendingPlayerInfo.clear();
+        _serverMapCache = {};
+        _serverActionBatch = {};
 
 #    ifdef ENABLE_SCRIPTING
         auto& scriptEngine = GetContext().GetScriptEngine();
@@ -242,7 +259,9 @@ void NetworkBase::CloseConnection()
     }
     else if (mode == NETWORK_MODE_SERVER)
     {
+        StopIoThread();
         _listenSocket.reset();
+        _socketPoller.reset();
         _advertiser.reset();
     }
 
@@ -334,7 +353,7 @@ bool NetworkBase::BeginClient(const std::string& host, uint16_t port)
         bool ok = false;
         try
         {
-            LOG_VERBOSE("Loading key from %s", keyPath.c_str());
+            LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "Loading key from %s", keyPath.c_str());
             auto fs = FileStream(keyPath, FILE_MODE_OPEN);
             ok = _key.LoadPrivate(&fs);
         }
@@ -362,7 +381,7 @@ bool NetworkBase::BeginServer(uint16_t port, const std::string& address)
 
     _userManager.Load();
 
-    LOG_VERBOSE("Begin listening for clients");
+    LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "Begin listening for clients");
 
     _listenSocket = CreateTcpSocket();
     try
@@ -376,6 +395,21 @@ bool NetworkBase::BeginServer(uint16_t port, const std::string& address)
         return false;
     }
 
+    try
+    {
+        _socketPoller = CreateTcpSocketPoller();
+    }
+    catch (const std::exception& ex)
+    {
+        // Not fatal, every connection will be read from each update instead
+        LOG_WARNING("Unable to create socket poller: %s", ex.what());
+    }
+
+    if (gConfigNetwork.IoThread)
+    {
+        StartIoThread();
+    }
+
     ServerName = gConfigNetwork.ServerName;
     ServerDescription = gConfigNetwork.ServerDescription;
     ServerGreeting = gConfigNetwork.ServerGreeting;
@@ -468,6 +502,8 @@ NetworkConnection* NetworkBase::GetPlayerConnection(uint8_t id) const
 
 void NetworkBase::Update()
 {
+    PROFILED_FUNCTION();
+
     _closeLock = true;
 
     // Update is not necessarily called per game tick, maintain our own delta time
@@ -499,9 +535,19 @@ void NetworkBase::Update()
 
 void NetworkBase::Flush()
 {
+    PROFILED_FUNCTION();
+
     if (GetMode() == NETWORK_MODE_CLIENT)
     {
         _serverConnection->SendQueuedPackets();
+        return;
+    }
+
+    ServerFlushGameActions();
+    if (_ioThread.joinable())
+    {
+        // Let the I/O thread send what was queued during this update straight away
+        _ioWake.notify_one();
     }
     else
     {
@@ -514,13 +560,23 @@ void NetworkBase::Flush()
 
 void NetworkBase::UpdateServer()
 {
+    // Only read from connections that have data waiting, all connections are still checked for time outs.
+    std::unordered_set<const ITcpSocket*> readySockets;
+    if (_socketPoller != nullptr && !_ioThread.joinable())
+    {
+        const auto& polledSockets = _socketPoller->Poll();
+        readySockets.insert(polledSockets.begin(), polledSockets.end());
+    }
+
     for (auto& connection : client_connection_list)
     {
         // This can be called multiple times before the connection is removed.
         if (!connection->IsValid())
             continue;
 
-        if (!ProcessConnection(*connection))
+        const bool hasData = _socketPoller == nullptr || _ioThread.joinable()
+            || readySockets.count(connection->Socket.get()) != 0;
+        if (!ProcessConnection(*connection, hasData))
         {
             connection->Disconnect();
         }
@@ -549,6 +605,68 @@ void NetworkBase::UpdateServer()
     }
 }
 
+void NetworkBase::StartIoThread()
+{
+    _ioThreadStop = false;
+    _ioThread = std::thread([this]() { IoThreadMain(); });
+}
+
+void NetworkBase::StopIoThread()
+{
+    if (_ioThread.joinable())
+    {
+        _ioThreadStop = true;
+        _ioWake.notify_one();
+        _ioThread.join();
+    }
+}
+
+/**
+ * Sends and receives for every client connection independently of the game loop, so that a slow tick does not
+ * hold back outgoing packets. Received packets are queued on their connection and handled by the game thread.
+ */
+void NetworkBase::IoThreadMain()
+{
+    std::unordered_set<const ITcpSocket*> readySockets;
+    while (!_ioThreadStop)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_connectionListLock);
+            readySockets.clear();
+            if (_socketPoller != nullptr)
+            {
+                const auto& polledSockets = _socketPoller->Poll();
+                readySockets.insert(polledSockets.begin(), polledSockets.end());
+            }
+
+            for (auto& connection : client_connection_list)
+            {
+                if (connection->Socket->GetStatus() != SocketStatus::Connected)
+                {
+                    continue;
+                }
+
+                try
+                {
+                    connection->SendQueuedPackets();
+                }
+                catch (const std::exception& ex)
+                {
+                    LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "Unable to send to client: %s", ex.what());
+                }
+
+                if (_socketPoller == nullptr || readySockets.count(connection->Socket.get()) != 0)
+                {
+                    connection->ReceivePackets();
+                }
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(_ioWakeLock);
+        _ioWake.wait_for(lock, std::chrono::milliseconds(1));
+    }
+}
+
 void NetworkBase::UpdateClient()
 {
     assert(_serverConnection != nullptr);
@@ -704,6 +822,12 @@ int32_t NetworkBase::GetTotalNumPlayers() const noexcept
     return static_cast<int32_t>(player_list.size());
 }
 
+int32_t NetworkBase::GetNumSpectatorSlotsUsed() const noexcept
+{
+    return static_cast<int32_t>(
+        std::count_if(player_list.begin(), player_list.end(), [](const auto& player) { return player->SpectatorSlot; }));
+}
+
 int32_t NetworkBase::GetNumVisiblePlayers() const noexcept
 {
     if (IsServerPlayerInvisible)
@@ -729,6 +853,8 @@ const char* NetworkBase::FormatChat(NetworkPlayer* fromplayer, const char* text)
 
 void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, bool gameCmd) const
 {
+    // Encode the packet once, every connection queues the same buffer.
+    const NetworkSharedPacket sharedPacket(packet);
     for (auto& client_connection : client_connection_list)
     {
         if (gameCmd)
@@ -742,7 +868,7 @@ void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, b
                 continue;
             }
         }
-        client_connection->QueuePacket(packet, front);
+        client_connection->QueuePacket(sharedPacket, front);
     }
 }
 
@@ -767,11 +893,15 @@ bool NetworkBase::CheckSRAND(uint32_t tick, uint32_t srand0)
 
     if (!storedTick.spriteHash.empty())
     {
-        EntitiesChecksum checksum = GetAllEntitiesChecksum();
+        EntitiesChecksum checksum = GetAllEntitiesChecksum(ChecksumAlgorithm::FNV1aLanes);
         std::string clientSpriteHash = checksum.ToString();
         if (clientSpriteHash != storedTick.spriteHash)
         {
             LOG_INFO("Sprite hash mismatch, client = %s, server = %s", clientSpriteHash.c_str(), storedTick.spriteHash.c_str());
+            if (storedTick.entityRangeHashes.has_value())
+            {
+                LogDivergedEntityRanges(*storedTick.entityRangeHashes);
+            }
             return false;
         }
     }
@@ -779,6 +909,20 @@ bool NetworkBase::CheckSRAND(uint32_t tick, uint32_t srand0)
     return true;
 }
 
+void NetworkBase::LogDivergedEntityRanges(const EntityRangeChecksums& serverHashes)
+{
+    const auto clientHashes = GetEntityRangeChecksums();
+    for (size_t i = 0; i < kNumEntityChecksumRanges; i++)
+    {
+        if (clientHashes[i] != serverHashes[i])
+        {
+            const auto first = i * kEntityChecksumRangeSize;
+            const auto last = std::min<size_t>(first + kEntityChecksumRangeSize, MAX_ENTITIES) - 1;
+            LOG_INFO("Entities %zu to %zu differ from the server", first, last);
+        }
+    }
+}
+
 bool NetworkBase::IsDesynchronised() const noexcept
 {
     return _serverState.state == NetworkServerStatus::Desynced;
@@ -999,7 +1143,7 @@ void NetworkBase::SetupDefaultGroups()
     auto spectator = std::make_unique<NetworkGroup>();
     spectator->SetName("Spectator");
     spectator->ToggleActionPermission(NetworkPermission::Chat);
-    spectator->Id = 1;
+    spectator->Id = kSpectatorGroupId;
     group_list.push_back(std::move(spectator));
 
     // User group
@@ -1187,11 +1331,11 @@ void NetworkBase::Client_Send_RequestGameState(uint32_t tick)
 {
     if (_serverState.gamestateSnapshotsEnabled == false)
     {
-        LOG_VERBOSE("Server does not store a gamestate history");
+        LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "Server does not store a gamestate history");
         return;
     }
 
-    LOG_VERBOSE("Requesting gamestate from server for tick %u", tick);
+    LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "Requesting gamestate from server for tick %u", tick);
 
     NetworkPacket packet(NetworkCommand::RequestGameState);
     packet << tick;
@@ -1200,7 +1344,7 @@ void NetworkBase::Client_Send_RequestGameState(uint32_t tick)
 
 void NetworkBase::Client_Send_TOKEN()
 {
-    LOG_VERBOSE("requesting token");
+    LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "requesting token");
     NetworkPacket packet(NetworkCommand::Token);
     _serverConnection->AuthStatus = NetworkAuth::Requested;
     _serverConnection->QueuePacket(std::move(packet));
@@ -1223,13 +1367,13 @@ void NetworkBase::Client_Send_AUTH(
 
 void NetworkBase::Client_Send_MAPREQUEST(const std::vector<ObjectEntryDescriptor>& objects)
 {
-    LOG_VERBOSE("client requests %u objects", uint32_t(objects.size()));
+    LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "client requests %u objects", uint32_t(objects.size()));
     NetworkPacket packet(NetworkCommand::MapRequest);
     packet << static_cast<uint32_t>(objects.size());
     for (const auto& object : objects)
     {
         std::string name(object.GetName());
-        LOG_VERBOSE("client requests object %s", name.c_str());
+        LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "client requests object %s", name.c_str());
         if (object.Generation == ObjectGeneration::DAT)
         {
             packet << static_cast<uint8_t>(0);
@@ -1255,7 +1399,7 @@ void NetworkBase::ServerSendToken(NetworkConnection& connection)
 void NetworkBase::ServerSendObjectsList(
     NetworkConnection& connection, const std::vector<const ObjectRepositoryItem*>& objects) const
 {
-    LOG_VERBOSE("Server sends objects list with %u items", objects.size());
+    LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "Server sends objects list with %u items", objects.size());
 
     if (objects.empty())
     {
@@ -1266,30 +1410,49 @@ void NetworkBase::ServerSendObjectsList(
     }
     else
     {
-        for (size_t i = 0; i < objects.size(); ++i)
-        {
-            const auto* object = objects[i];
-
+        // Many entries are sent per packet, the client only needs to know where each packet starts
+        NetworkPacket entries;
+        uint32_t firstIndex = 0;
+        uint32_t numEntries = 0;
+        const auto sendEntries = [&]() {
             NetworkPacket packet(NetworkCommand::ObjectsList);
-            packet << static_cast<uint32_t>(i) << static_cast<uint32_t>(objects.size());
+            packet << firstIndex << static_cast<uint32_t>(objects.size()) << numEntries;
+            packet.Write(entries.Data.data(), entries.Data.size());
+            connection.QueuePacket(std::move(packet));
+
+            entries = NetworkPacket();
+            firstIndex += numEntries;
+            numEntries = 0;
+        };
+
+        for (const auto* object : objects)
+        {
+            const size_t entrySize = sizeof(uint8_t)
+                + (object->Identifier.empty() ? sizeof(RCTObjectEntry) : object->Identifier.size() + 1);
+            if (numEntries > 0 && entries.Data.size() + entrySize > CHUNK_SIZE)
+            {
+                sendEntries();
+            }
 
             if (object->Identifier.empty())
             {
                 // DAT
-                LOG_VERBOSE("Object %.8s (checksum %x)", object->ObjectEntry.name, object->ObjectEntry.checksum);
-                packet << static_cast<uint8_t>(0);
-                packet.Write(&object->ObjectEntry, sizeof(RCTObjectEntry));
+                LOG_VERBOSE_CATEGORY(
+                    DiagnosticCategory::Network, "Object %.8s (checksum %x)", object->ObjectEntry.name,
+                    object->ObjectEntry.checksum);
+                entries << static_cast<uint8_t>(0);
+                entries.Write(&object->ObjectEntry, sizeof(RCTObjectEntry));
             }
             else
             {
                 // JSON
-                LOG_VERBOSE("Object %s", object->Identifier.c_str());
-                packet << static_cast<uint8_t>(1);
-                packet.WriteString(object->Identifier);
+                LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "Object %s", object->Identifier.c_str());
+                entries << static_cast<uint8_t>(1);
+                entries.WriteString(object->Identifier);
             }
-
-            connection.QueuePacket(std::move(packet));
+            numEntries++;
         }
+        sendEntries();
     }
 }
 
@@ -1302,7 +1465,7 @@ void NetworkBase::ServerSendScripts(NetworkConnection& connection)
 
     // Get remote plugin list.
     const auto remotePlugins = scriptEngine.GetRemotePlugins();
-    LOG_VERBOSE("Server sends %zu scripts", remotePlugins.size());
+    LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "Server sends %zu scripts", remotePlugins.size());
 
     // Build the data contents for each plugin.
     MemoryStream pluginData;
@@ -1347,7 +1510,7 @@ void NetworkBase::ServerSendScripts(NetworkConnection& connection)
 
 void NetworkBase::Client_Send_HEARTBEAT(NetworkConnection& connection) const
 {
-    LOG_VERBOSE("Sending heartbeat");
+    LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "Sending heartbeat");
 
     NetworkPacket packet(NetworkCommand::Heartbeat);
     connection.QueuePacket(std::move(packet));
@@ -1358,22 +1521,57 @@ NetworkStats NetworkBase::GetStats() const
     NetworkStats stats = {};
     if (mode == NETWORK_MODE_CLIENT)
     {
-        stats = _serverConnection->Stats;
+        stats = _serverConnection->GetStats();
     }
     else
     {
         for (auto& connection : client_connection_list)
         {
+            const auto connectionStats = connection->GetStats();
             for (size_t n = 0; n < EnumValue(NetworkStatisticsGroup::Max); n++)
             {
-                stats.bytesReceived[n] += connection->Stats.bytesReceived[n];
-                stats.bytesSent[n] += connection->Stats.bytesSent[n];
+                stats.bytesReceived[n] += connectionStats.bytesReceived[n];
+                stats.bytesSent[n] += connectionStats.bytesSent[n];
             }
+            stats.roundTripTime.Merge(connectionStats.roundTripTime);
+            stats.queueDepth.Merge(connectionStats.queueDepth);
+            stats.bytesPerFlush.Merge(connectionStats.bytesPerFlush);
+            stats.actionLatency.Merge(connectionStats.actionLatency);
         }
     }
     return stats;
 }
 
+size_t NetworkBase::GetQueuedPacketCount() const
+{
+    if (mode == NETWORK_MODE_CLIENT)
+    {
+        return _serverConnection != nullptr ? _serverConnection->GetQueuedPacketCount() : 0;
+    }
+
+    size_t count = 0;
+    for (auto& connection : client_connection_list)
+    {
+        count += connection->GetQueuedPacketCount();
+    }
+    return count;
+}
+
+size_t NetworkBase::GetMemoryUsage() const
+{
+    if (mode == NETWORK_MODE_CLIENT)
+    {
+        return _serverConnection != nullptr ? _serverConnection->GetBufferedBytes() : 0;
+    }
+
+    size_t total = 0;
+    for (auto& connection : client_connection_list)
+    {
+        total += connection->GetBufferedBytes();
+    }
+    return total;
+}
+
 void NetworkBase::ServerSendAuth(NetworkConnection& connection)
 {
     uint8_t new_playerid = 0;
@@ -1396,6 +1594,9 @@ void NetworkBase::ServerSendAuth(NetworkConnection& connection)
 
 void NetworkBase::ServerSendMap(NetworkConnection* connection)
 {
+    // The map will include the effects of every action executed so far, those must not be sent again after it.
+    ServerFlushGameActions();
+
     std::vector<const ObjectRepositoryItem*> objects;
     if (connection != nullptr)
     {
@@ -1408,9 +1609,12 @@ void NetworkBase::ServerSendMap(NetworkConnection* connection)
         auto& context = GetContext();
         auto& objManager = context.GetObjectManager();
         objects = objManager.GetPackableObjects();
+
+        // Sent after a new map was loaded which may have the same tick as the cached map
+        _serverMapCache = {};
     }
 
-    auto header = SaveForNetwork(objects);
+    const auto& header = GetMapForNetwork(objects);
     if (header.empty())
     {
         if (connection != nullptr)
@@ -1454,6 +1658,27 @@ std::vector<uint8_t> NetworkBase::SaveForNetwork(const std::vector<const ObjectR
     return result;
 }
 
+const std::vector<uint8_t>& NetworkBase::GetMapForNetwork(const std::vector<const ObjectRepositoryItem*>& objects)
+{
+    // Clients that join during the same tick, such as everyone reconnecting after a server hiccup, all get the same
+    // map. Any game action executed since then invalidates it as those are not replayed for joining clients.
+    const auto currentTicks = GetGameState().CurrentTicks;
+    auto& cache = _serverMapCache;
+    if (cache.Data.empty() || cache.Tick != currentTicks || cache.ActionRevision != _serverActionRevision
+        || cache.Objects != objects)
+    {
+        cache.Data = SaveForNetwork(objects);
+        cache.Tick = currentTicks;
+        cache.ActionRevision = _serverActionRevision;
+        cache.Objects = objects;
+    }
+    else
+    {
+        LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "Reusing map serialised for tick %u", currentTicks);
+    }
+    return cache.Data;
+}
+
 void NetworkBase::Client_Send_CHAT(const char* text)
 {
     NetworkPacket packet(NetworkCommand::Chat);
@@ -1498,7 +1723,8 @@ void NetworkBase::Client_Send_GAME_ACTION(const GameAction* action)
         _gameActionCallbacks.insert(std::make_pair(networkId, action->GetCallback()));
     }
 
-    DataSerialiser stream(true);
+    auto& stream = _actionSerialiser;
+    stream.Reset();
     action->Serialise(stream);
 
     packet << GetGameState().CurrentTicks << action->GetType() << stream;
@@ -1507,18 +1733,85 @@ void NetworkBase::Client_Send_GAME_ACTION(const GameAction* action)
 
 void NetworkBase::ServerSendGameAction(const GameAction* action)
 {
-    NetworkPacket packet(NetworkCommand::GameAction);
-
-    DataSerialiser stream(true);
+    auto& stream = _actionSerialiser;
+    stream.Reset();
     action->Serialise(stream);
+    const auto& actionData = stream.GetStream();
+    const auto actionSize = static_cast<size_t>(actionData.GetLength());
 
-    packet << GetGameState().CurrentTicks << action->GetType() << stream;
+    const auto currentTicks = GetGameState().CurrentTicks;
+    auto& batch = _serverActionBatch;
+    if (batch.NumActions > 0
+        && (batch.Tick != currentTicks
+            || batch.Payload.Data.size() + actionSize + sizeof(GameCommand) + 2 * sizeof(uint16_t) > kMaxActionBatchSize))
+    {
+        ServerFlushGameActions();
+    }
+    if (batch.NumActions == 0)
+    {
+        batch.Tick = currentTicks;
+        batch.Payload = NetworkPacket();
+        batch.Payload << currentTicks;
+    }
+
+    // Continue the current run if the action is of the same type, otherwise start a new one
+    if (batch.RunCount == 0 || batch.RunType != action->GetType() || batch.RunCount == std::numeric_limits<uint16_t>::max())
+    {
+        batch.Payload << action->GetType();
+        batch.RunType = action->GetType();
+        batch.RunCount = 0;
+        batch.RunCountOffset = batch.Payload.Data.size();
+        batch.Payload << batch.RunCount;
+    }
+    batch.RunCount++;
+    const auto runCount = ByteSwapBE(batch.RunCount);
+    std::memcpy(batch.Payload.Data.data() + batch.RunCountOffset, &runCount, sizeof(runCount));
+
+    batch.Payload << static_cast<uint16_t>(actionSize);
+    batch.Payload.Write(actionData.GetData(), actionSize);
+    batch.NumActions++;
+
+    _serverActionRevision++;
+}
+
+/**
+ * Sends all game actions executed since the last flush to the clients as a single packet.
+ */
+void NetworkBase::ServerFlushGameActions()
+{
+    auto& batch = _serverActionBatch;
+    if (batch.NumActions == 0)
+    {
+        return;
+    }
+
+    NetworkPacket packet(NetworkCommand::GameActionBatch);
+    const auto& payload = batch.Payload.Data;
+    std::vector<uint8_t> compressed;
+    if (payload.size() >= kMinCompressedActionBatchSize)
+    {
+        compressed = Gzip(payload.data(), payload.size());
+    }
+    if (!compressed.empty() && compressed.size() < payload.size())
+    {
+        packet << kActionBatchFlagCompressed << static_cast<uint32_t>(payload.size());
+        packet.Write(compressed.data(), compressed.size());
+    }
+    else
+    {
+        packet << static_cast<uint8_t>(0);
+        packet.Write(payload.data(), payload.size());
+    }
 
+    batch = {};
     SendPacketToClients(packet);
 }
 
 void NetworkBase::ServerSendTick()
 {
+    // Clients need every action of a tick before they can run it
+    ServerFlushGameActions();
+
     NetworkPacket packet(NetworkCommand::Tick);
     packet << GetGameState().CurrentTicks << ScenarioRandState().s0;
     uint32_t flags = 0;
@@ -1530,16 +1823,23 @@ void NetworkBase::ServerSendTick()
     if (checksum_counter >= 100)
     {
         checksum_counter = 0;
-        flags |= NETWORK_TICK_FLAG_CHECKSUMS;
+        flags |= NETWORK_TICK_FLAG_CHECKSUMS | NETWORK_TICK_FLAG_RANGE_CHECKSUMS;
     }
     // Send flags always, so we can understand packet structure on the other end,
     // and allow for some expansion.
     packet << flags;
     if (flags & NETWORK_TICK_FLAG_CHECKSUMS)
     {
-        EntitiesChecksum checksum = GetAllEntitiesChecksum();
+        EntitiesChecksum checksum = GetAllEntitiesChecksum(ChecksumAlgorithm::FNV1aLanes);
         packet.WriteString(checksum.ToString());
     }
+    if (flags & NETWORK_TICK_FLAG_RANGE_CHECKSUMS)
+    {
+        for (auto rangeChecksum : GetEntityRangeChecksums())
+        {
+            packet << rangeChecksum;
+        }
+    }
 
     SendPacketToClients(packet);
 }
@@ -1676,12 +1976,22 @@ void NetworkBase::ServerSendEventPlayerDisconnected(const char* playerName, cons
     SendPacketToClients(packet);
 }
 
-bool NetworkBase::ProcessConnection(NetworkConnection& connection)
+bool NetworkBase::ProcessConnection(NetworkConnection& connection, bool readPackets)
 {
-    NetworkReadPacket packetStatus;
+    if (_ioThread.joinable())
+    {
+        // Packets have already been read by the I/O thread
+        readPackets = false;
+        if (!ProcessReceivedPackets(connection))
+        {
+            return false;
+        }
+    }
+
+    NetworkReadPacket packetStatus = NetworkReadPacket::NoData;
 
     uint32_t countProcessed = 0;
-    do
+    while (readPackets)
     {
         countProcessed++;
         packetStatus = connection.ReadPacket();
@@ -1709,7 +2019,11 @@ bool NetworkBase::ProcessConnection(NetworkConnection& connection)
                 // could not read anything from socket
                 break;
         }
-    } while (packetStatus == NetworkReadPacket::Success && countProcessed < MaxPacketsPerUpdate);
+        if (packetStatus != NetworkReadPacket::Success || countProcessed >= MaxPacketsPerUpdate)
+        {
+            break;
+        }
+    }
 
     if (!connection.ReceivedPacketRecently())
     {
@@ -1723,6 +2037,32 @@ bool NetworkBase::ProcessConnection(NetworkConnection& connection)
     return true;
 }
 
+bool NetworkBase::ProcessReceivedPackets(NetworkConnection& connection)
+{
+    NetworkPacket packet;
+    uint32_t countProcessed = 0;
+    while (countProcessed < MaxPacketsPerUpdate && connection.TakeReceivedPacket(packet))
+    {
+        countProcessed++;
+        ProcessPacket(connection, packet);
+        if (!connection.IsValid())
+        {
+            return false;
+        }
+    }
+
+    if (connection.IsReceiveClosed())
+    {
+        // closed connection or network error
+        if (!connection.GetLastDisconnectReason())
+        {
+            connection.SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
+        }
+        return false;
+    }
+    return true;
+}
+
 void NetworkBase::ProcessPacket(NetworkConnection& connection, NetworkPacket& packet)
 {
     const auto& handlerList = GetMode() == NETWORK_MODE_SERVER ? server_command_handlers : client_command_handlers;
@@ -1735,11 +2075,18 @@ void NetworkBase::ProcessPacket(NetworkConnection& connection, NetworkPacket& pa
         {
             try
             {
+                const auto startTime = std::chrono::steady_clock::now();
                 (this->*commandHandler)(connection, packet);
+                if (packet.GetCommand() == NetworkCommand::GameAction)
+                {
+                    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - startTime);
+                    connection.RecordActionLatency(static_cast<uint32_t>(elapsed.count()));
+                }
             }
             catch (const std::exception& ex)
             {
-                LOG_VERBOSE("Exception during packet processing: %s", ex.what());
+                LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "Exception during packet processing: %s", ex.what());
             }
         }
     }
@@ -1948,6 +2295,7 @@ void NetworkBase::ProcessPlayerInfo()
 
 void NetworkBase::ProcessDisconnectedClients()
 {
+    std::lock_guard<std::mutex> lock(_connectionListLock);
     for (auto it = client_connection_list.begin(); it != client_connection_list.end();)
     {
         auto& connection = *it;
@@ -1960,6 +2308,10 @@ void NetworkBase::ProcessDisconnectedClients()
 
         // Make sure to send all remaining packets out before disconnecting.
         connection->SendQueuedPackets();
+        if (_socketPoller != nullptr)
+        {
+            _socketPoller->Remove(*connection->Socket);
+        }
         connection->Socket->Disconnect();
 
         ServerClientDisconnected(connection);
@@ -1980,6 +2332,20 @@ void NetworkBase::AddClient(std::unique_ptr<ITcpSocket>&& socket)
     auto connection = std::make_unique<NetworkConnection>();
     connection->Socket = std::move(socket);
 
+    std::lock_guard<std::mutex> lock(_connectionListLock);
+    if (_socketPoller != nullptr)
+    {
+        try
+        {
+            _socketPoller->Add(*connection->Socket);
+        }
+        catch (const std::exception& ex)
+        {
+            LOG_WARNING("Unable to poll client socket, reading all connections instead: %s", ex.what());
+            _socketPoller.reset();
+        }
+    }
+
     client_connection_list.push_back(std::move(connection));
 }
 
@@ -2238,7 +2604,7 @@ void NetworkBase::ServerHandleRequestGamestate(NetworkConnection& connection, Ne
 
 void NetworkBase::ServerHandleHeartbeat(NetworkConnection& connection, NetworkPacket& packet)
 {
-    LOG_VERBOSE("Client %s heartbeat", connection.Socket->GetHostName());
+    LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "Client %s heartbeat", connection.Socket->GetHostName());
     connection.ResetLastPacketTime();
 }
 
@@ -2290,12 +2656,23 @@ void NetworkBase::Client_Handle_AUTH(NetworkConnection& connection, NetworkPacke
     }
 }
 
-void NetworkBase::ServerClientJoined(std::string_view name, const std::string& keyhash, NetworkConnection& connection)
+void NetworkBase::ServerClientJoined(
+    std::string_view name, const std::string& keyhash, NetworkConnection& connection, bool spectatorSlot)
 {
     auto player = AddPlayer(std::string(name), keyhash);
     connection.Player = player;
     if (player != nullptr)
     {
+        if (spectatorSlot)
+        {
+            // Players beyond the player limit may only watch, regardless of the group they normally belong to
+            player->SpectatorSlot = true;
+            if (GetGroupByID(kSpectatorGroupId) != nullptr)
+            {
+                player->Group = kSpectatorGroupId;
+            }
+        }
+
         char text[256];
         const char* player_name = static_cast<const char*>(player->Name.c_str());
         FormatStringLegacy(text, 256, STR_MULTIPLAYER_PLAYER_HAS_JOINED_THE_GAME, &player_name);
@@ -2334,6 +2711,7 @@ void NetworkBase::Client_Handle_OBJECTS_LIST(NetworkConnection& connection, Netw
 
     uint32_t index = 0;
     uint32_t totalObjects = 0;
+    uint32_t numEntries = 0;
     packet >> index >> totalObjects;
 
     static constexpr uint32_t OBJECT_START_INDEX = 0;
@@ -2344,9 +2722,11 @@ void NetworkBase::Client_Handle_OBJECTS_LIST(NetworkConnection& connection, Netw
 
     if (totalObjects > 0)
     {
+        packet >> numEntries;
+
         char objectListMsg[256];
         const uint32_t args[] = {
-            index + 1,
+            std::min(index + numEntries, totalObjects),
             totalObjects,
         };
         FormatStringLegacy(objectListMsg, 256, STR_MULTIPLAYER_RECEIVING_OBJECTS_LIST, &args);
@@ -2356,51 +2736,57 @@ void NetworkBase::Client_Handle_OBJECTS_LIST(NetworkConnection& connection, Netw
         intent.PutExtra(INTENT_EXTRA_CALLBACK, []() -> void { ::GetContext()->GetNetwork().Close(); });
         ContextOpenIntent(&intent);
 
-        uint8_t objectType{};
-        packet >> objectType;
-
-        if (objectType == 0)
+        for (uint32_t i = 0; i < numEntries; i++)
         {
-            // DAT
-            auto entry = reinterpret_cast<const RCTObjectEntry*>(packet.Read(sizeof(RCTObjectEntry)));
-            if (entry != nullptr)
+            uint8_t objectType{};
+            packet >> objectType;
+
+            if (objectType == 0)
             {
-                const auto* object = repo.FindObject(entry);
-                if (object == nullptr)
-                {
-                    auto objectName = std::string(entry->GetName());
-                    LOG_VERBOSE("Requesting object %s with checksum %x from server", objectName.c_str(), entry->checksum);
-                    _missingObjects.push_back(ObjectEntryDescriptor(*entry));
-                }
-                else if (object->ObjectEntry.checksum != entry->checksum || object->ObjectEntry.flags != entry->flags)
+                // DAT
+                auto entry = reinterpret_cast<const RCTObjectEntry*>(packet.Read(sizeof(RCTObjectEntry)));
+                if (entry != nullptr)
                 {
-                    auto objectName = std::string(entry->GetName());
-                    LOG_WARNING(
-                        "Object %s has different checksum/flags (%x/%x) than server (%x/%x).", objectName.c_str(),
-                        object->ObjectEntry.checksum, object->ObjectEntry.flags, entry->checksum, entry->flags);
+                    const auto* object = repo.FindObject(entry);
+                    if (object == nullptr)
+                    {
+                        auto objectName = std::string(entry->GetName());
+                        LOG_VERBOSE_CATEGORY(
+                            DiagnosticCategory::Network, "Requesting object %s with checksum %x from server",
+                            objectName.c_str(), entry->checksum);
+                        _missingObjects.push_back(ObjectEntryDescriptor(*entry));
+                    }
+                    else if (object->ObjectEntry.checksum != entry->checksum || object->ObjectEntry.flags != entry->flags)
+                    {
+                        auto objectName = std::string(entry->GetName());
+                        LOG_WARNING(
+                            "Object %s has different checksum/flags (%x/%x) than server (%x/%x).", objectName.c_str(),
+                            object->ObjectEntry.checksum, object->ObjectEntry.flags, entry->checksum, entry->flags);
+                    }
                 }
             }
-        }
-        else
-        {
-            // JSON
-            auto identifier = packet.ReadString();
-            if (!identifier.empty())
+            else
             {
-                const auto* object = repo.FindObject(identifier);
-                if (object == nullptr)
+                // JSON
+                auto identifier = packet.ReadString();
+                if (!identifier.empty())
                 {
-                    auto objectName = std::string(identifier);
-                    LOG_VERBOSE("Requesting object %s from server", objectName.c_str());
-                    _missingObjects.push_back(ObjectEntryDescriptor(objectName));
+                    const auto* object = repo.FindObject(identifier);
+                    if (object == nullptr)
+                    {
+                        auto objectName = std::string(identifier);
+                        LOG_VERBOSE_CATEGORY(
+                            DiagnosticCategory::Network, "Requesting object %s from server", objectName.c_str());
+                        _missingObjects.push_back(ObjectEntryDescriptor(objectName));
+                    }
                 }
             }
         }
     }
 
-    if (index + 1 >= totalObjects)
+    if (index + numEntries >= totalObjects)
     {
-        LOG_VERBOSE("client received object list, it has %u entries", totalObjects);
+        LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "client received object list, it has %u entries", totalObjects);
         Client_Send_MAPREQUEST(_missingObjects);
         _missingObjects.clear();
     }
@@ -2482,8 +2868,8 @@ void NetworkBase::Client_Handle_GAMESTATE(NetworkConnection& connection, Network
     const uint8_t* data = packet.Read(dataSize);
     _serverGameState.Write(data, dataSize);
 
-    LOG_VERBOSE(
-        "Received Game State %.02f%%",
+    LOG_VERBOSE_CATEGORY(
+        DiagnosticCategory::Network, "Received Game State %.02f%%",
         (static_cast<float>(_serverGameState.GetLength()) / static_cast<float>(totalSize)) * 100.0f);
 
     if (_serverGameState.GetLength() == totalSize)
@@ -2534,8 +2920,10 @@ void NetworkBase::ServerHandleMapRequest(NetworkConnection& connection, NetworkP
 {
     uint32_t size;
     packet >> size;
-    LOG_VERBOSE("Client requested %u objects", size);
+    LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "Client requested %u objects", size);
     auto& repo = GetContext().GetObjectRepository();
+    std::unordered_set<const ObjectRepositoryItem*> requestedItems(
+        connection.RequestedObjects.begin(), connection.RequestedObjects.end());
     for (uint32_t i = 0; i < size; i++)
     {
         uint8_t generation{};
@@ -2547,13 +2935,13 @@ void NetworkBase::ServerHandleMapRequest(NetworkConnection& connection, NetworkP
         {
             const auto* entry = reinterpret_cast<const RCTObjectEntry*>(packet.Read(sizeof(RCTObjectEntry)));
             objectName = std::string(entry->GetName());
-            LOG_VERBOSE("Client requested object %s", objectName.c_str());
+            LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "Client requested object %s", objectName.c_str());
             item = repo.FindObject(entry);
         }
         else
         {
             objectName = std::string(packet.ReadString());
-            LOG_VERBOSE("Client requested object %s", objectName.c_str());
+            LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "Client requested object %s", objectName.c_str());
             item = repo.FindObject(objectName);
         }
 
@@ -2561,8 +2949,9 @@ void NetworkBase::ServerHandleMapRequest(NetworkConnection& connection, NetworkP
         {
             LOG_WARNING("Client tried getting non-existent object %s from us.", objectName.c_str());
         }
-        else
+        else if (requestedItems.insert(item).second)
         {
+            // A DAT and JSON identifier can refer to the same object, it only needs to be packed into the map once
             connection.RequestedObjects.push_back(item);
         }
     }
@@ -2622,10 +3011,13 @@ void NetworkBase::ServerHandleAuth(NetworkConnection& connection, NetworkPacket&
                 const std::string hash = connection.Key.PublicKeyHash();
                 if (verified)
                 {
-                    LOG_VERBOSE("Connection %s: Signature verification ok. Hash %s", hostName, hash.c_str());
+                    LOG_VERBOSE_CATEGORY(
+                        DiagnosticCategory::Network, "Connection %s: Signature verification ok. Hash %s", hostName,
+                        hash.c_str());
                     if (gConfigNetwork.KnownKeysOnly && _userManager.GetUserByHash(hash) == nullptr)
                     {
-                        LOG_VERBOSE("Connection %s: Hash %s, not known", hostName, hash.c_str());
+                        LOG_VERBOSE_CATEGORY(
+                            DiagnosticCategory::Network, "Connection %s: Hash %s, not known", hostName, hash.c_str());
                         connection.AuthStatus = NetworkAuth::UnknownKeyDisallowed;
                     }
                     else
@@ -2636,13 +3028,15 @@ void NetworkBase::ServerHandleAuth(NetworkConnection& connection, NetworkPacket&
                 else
                 {
                     connection.AuthStatus = NetworkAuth::VerificationFailure;
-                    LOG_VERBOSE("Connection %s: Signature verification failed!", hostName);
+                    LOG_VERBOSE_CATEGORY(
+                        DiagnosticCategory::Network, "Connection %s: Signature verification failed!", hostName);
                 }
             }
             catch (const std::exception&)
             {
                 connection.AuthStatus = NetworkAuth::VerificationFailure;
-                LOG_VERBOSE("Connection %s: Signature verification failed, invalid data!", hostName);
+                LOG_VERBOSE_CATEGORY(
+                    DiagnosticCategory::Network, "Connection %s: Signature verification failed, invalid data!", hostName);
             }
         }
 
@@ -2679,7 +3073,10 @@ void NetworkBase::ServerHandleAuth(NetworkConnection& connection, NetworkPacket&
             }
         }
 
-        if (GetNumVisiblePlayers() >= gConfigNetwork.Maxplayers)
+        // Once all player slots are taken, further clients may still join as spectators
+        const auto numSpectatorSlotsUsed = GetNumSpectatorSlotsUsed();
+        const bool spectatorSlot = GetNumVisiblePlayers() - numSpectatorSlotsUsed >= gConfigNetwork.Maxplayers;
+        if (spectatorSlot && numSpectatorSlotsUsed >= gConfigNetwork.MaxSpectators)
         {
             connection.AuthStatus = NetworkAuth::Full;
             LOG_INFO("Connection %s: Server is full.", hostName);
@@ -2690,7 +3087,7 @@ void NetworkBase::ServerHandleAuth(NetworkConnection& connection, NetworkPacket&
             if (ProcessPlayerAuthenticatePluginHooks(connection, name, hash))
             {
                 connection.AuthStatus = NetworkAuth::Ok;
-                ServerClientJoined(name, hash, connection);
+                ServerClientJoined(name, hash, connection, spectatorSlot);
             }
             else
             {
@@ -2916,9 +3313,62 @@ void NetworkBase::Client_Handle_GAME_ACTION([[maybe_unused]] NetworkConnection&
     GameCommand actionType;
     packet >> tick >> actionType;
 
-    MemoryStream stream;
     const size_t size = packet.Header.Size - packet.BytesRead;
-    stream.WriteArray(packet.Read(size), size);
+    ClientEnqueueGameAction(tick, actionType, packet.Read(size), size);
+}
+
+void NetworkBase::Client_Handle_GAME_ACTION_BATCH([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint8_t flags;
+    packet >> flags;
+
+    NetworkPacket payload;
+    if (flags & kActionBatchFlagCompressed)
+    {
+        uint32_t uncompressedSize;
+        packet >> uncompressedSize;
+        const size_t size = packet.Header.Size - packet.BytesRead;
+        auto data = Ungzip(packet.Read(size), size);
+        if (data.size() != uncompressedSize)
+        {
+            LOG_ERROR("Received corrupt game action batch.");
+            return;
+        }
+        payload.Write(data.data(), data.size());
+    }
+    else
+    {
+        const size_t size = packet.Header.Size - packet.BytesRead;
+        payload.Write(packet.Read(size), size);
+    }
+    payload.Header.Size = static_cast<uint16_t>(payload.Data.size());
+
+    uint32_t tick;
+    payload >> tick;
+    while (payload.BytesRead < payload.Header.Size)
+    {
+        GameCommand actionType;
+        uint16_t runCount;
+        payload >> actionType >> runCount;
+        for (uint16_t i = 0; i < runCount; i++)
+        {
+            uint16_t actionSize;
+            payload >> actionSize;
+            const auto* actionData = payload.Read(actionSize);
+            if (actionData == nullptr)
+            {
+                LOG_ERROR("Received truncated game action batch.");
+                return;
+            }
+            ClientEnqueueGameAction(tick, actionType, actionData, actionSize);
+        }
+    }
+}
+
+void NetworkBase::ClientEnqueueGameAction(uint32_t tick, GameCommand actionType, const uint8_t* data, size_t size)
+{
+    MemoryStream stream;
+    stream.WriteArray(data, size);
     stream.SetPosition(0);
 
     DataSerialiser ds(false, stream);
@@ -3038,6 +3488,14 @@ void NetworkBase::Client_Handle_TICK([[maybe_unused]] NetworkConnection& connect
             tickData.spriteHash = text;
         }
     }
+    if (flags & NETWORK_TICK_FLAG_RANGE_CHECKSUMS)
+    {
+        auto& rangeHashes = tickData.entityRangeHashes.emplace();
+        for (auto& rangeHash : rangeHashes)
+        {
+            packet >> rangeHash;
+        }
+    }
 
     // Don't let the history grow too much.
     while (_serverTickData.size() >= 100)
@@ -3090,6 +3548,7 @@ void NetworkBase::ServerHandlePing(NetworkConnection& connection, [[maybe_unused
     {
         ping = 0;
     }
+    connection.RecordRoundTripTime(ping);
     if (connection.Player != nullptr)
     {
         connection.Player->Ping = ping;
@@ -3184,7 +3643,7 @@ void NetworkBase::Client_Handle_EVENT([[maybe_unused]] NetworkConnection& connec
 
 void NetworkBase::Client_Send_GAMEINFO()
 {
-    LOG_VERBOSE("requesting gameinfo");
+    LOG_VERBOSE_CATEGORY(DiagnosticCategory::Network, "requesting gameinfo");
     NetworkPacket packet(NetworkCommand::GameInfo);
     _serverConnection->QueuePacket(std::move(packet));
 }
@@ -3290,6 +3749,16 @@ uint32_t NetworkGetServerTick()
     return OpenRCT2::GetContext()->GetNetwork().GetServerTick();
 }
 
+size_t NetworkGetQueuedPacketCount()
+{
+    return OpenRCT2::GetContext()->GetNetwork().GetQueuedPacketCount();
+}
+
+size_t NetworkGetMemoryUsage()
+{
+    return OpenRCT2::GetContext()->GetNetwork().GetMemoryUsage();
+}
+
 uint8_t NetworkGetCurrentPlayerId()
 {
     return OpenRCT2::GetContext()->GetNetwork().GetPlayerID();
@@ -3356,6 +3825,17 @@ std::string NetworkGetPlayerIPAddress(uint32_t id)
     return {};
 }
 
+NetworkStats NetworkGetPlayerStats(uint32_t id)
+{
+    auto& network = OpenRCT2::GetContext()->GetNetwork();
+    auto conn = network.GetPlayerConnection(id);
+    if (conn != nullptr)
+    {
+        return conn->GetStats();
+    }
+    return {};
+}
+
 std::string NetworkGetPlayerPublicKeyHash(uint32_t id)
 {
     auto& network = OpenRCT2::GetContext()->GetNetwork();
@@ -4045,6 +4525,14 @@ uint32_t NetworkGetServerTick()
 {
     return GetGameState().CurrentTicks;
 }
+size_t NetworkGetQueuedPacketCount()
+{
+    return 0;
+}
+size_t NetworkGetMemoryUsage()
+{
+    return 0;
+}
 void NetworkFlush()
 {
 }
@@ -4115,6 +4603,10 @@ std::string NetworkGetPlayerIPAddress(uint32_t id)
 {
     return {};
 }
+NetworkStats NetworkGetPlayerStats(uint32_t id)
+{
+    return {};
+}
 std::string NetworkGetPlayerPublicKeyHash(uint32_t id)
 {
     return {};
@@ -2,6 +2,7 @@
 
 #include "../System.hpp"
 #include "../actions/GameAction.h"
+#include "../entity/EntityRegistry.h"
 #include "../object/Object.h"
 #include "NetworkConnection.h"
 #include "NetworkGroup.h"
@@ -10,8 +11,13 @@
 #include "NetworkTypes.h"
 #include "NetworkUser.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <fstream>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
 
 #ifndef DISABLE_NETWORK
 
@@ -44,6 +50,7 @@ public: // Common
     NetworkGroup* GetGroupByID(uint8_t id) const;
     int32_t GetTotalNumPlayers() const noexcept;
     int32_t GetNumVisiblePlayers() const noexcept;
+    int32_t GetNumSpectatorSlotsUsed() const noexcept;
     void SetPassword(u8string_view password);
     uint8_t GetDefaultGroup() const noexcept;
     std::string BeginLog(const std::string& directory, const std::string& midName, const std::string& filenameFormat);
@@ -52,8 +59,11 @@ public: // Common
     void AppendChatLog(std::string_view s);
     void CloseChatLog();
     NetworkStats GetStats() const;
+    size_t GetQueuedPacketCount() const;
+    size_t GetMemoryUsage() const;
     json_t GetServerInfoAsJson() const;
-    bool ProcessConnection(NetworkConnection& connection);
+    bool ProcessConnection(NetworkConnection& connection, bool readPackets = true);
+    bool ProcessReceivedPackets(NetworkConnection& connection);
     void CloseConnection();
     NetworkPlayer* AddPlayer(const std::string& name, const std::string& keyhash);
     void ProcessPacket(NetworkConnection& connection, NetworkPacket& packet);
@@ -77,9 +87,13 @@ public: // Server
     void SetupDefaultGroups();
     void RemovePlayer(std::unique_ptr<NetworkConnection>& connection);
     void UpdateServer();
+    void StartIoThread();
+    void StopIoThread();
+    void IoThreadMain();
     void ServerClientDisconnected(std::unique_ptr<NetworkConnection>& connection);
     bool SaveMap(OpenRCT2::IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects) const;
     std::vector<uint8_t> SaveForNetwork(const std::vector<const ObjectRepositoryItem*>& objects) const;
+    const std::vector<uint8_t>& GetMapForNetwork(const std::vector<const ObjectRepositoryItem*>& objects);
     std::string MakePlayerNameUnique(const std::string& name);
 
     // Packet dispatchers.
@@ -88,6 +102,7 @@ public: // Server
     void ServerSendMap(NetworkConnection* connection = nullptr);
     void ServerSendChat(const char* text, const std::vector<uint8_t>& playerIds = {});
     void ServerSendGameAction(const GameAction* action);
+    void ServerFlushGameActions();
     void ServerSendTick();
     void ServerSendPlayerInfo(int32_t playerId);
     void ServerSendPlayerList();
@@ -106,7 +121,8 @@ public: // Server
     void ServerHandleRequestGamestate(NetworkConnection& connection, NetworkPacket& packet);
     void ServerHandleHeartbeat(NetworkConnection& connection, NetworkPacket& packet);
     void ServerHandleAuth(NetworkConnection& connection, NetworkPacket& packet);
-    void ServerClientJoined(std::string_view name, const std::string& keyhash, NetworkConnection& connection);
+    void ServerClientJoined(
+        std::string_view name, const std::string& keyhash, NetworkConnection& connection, bool spectatorSlot);
     void ServerHandleChat(NetworkConnection& connection, NetworkPacket& packet);
     void ServerHandleGameAction(NetworkConnection& connection, NetworkPacket& packet);
     void ServerHandlePing(NetworkConnection& connection, NetworkPacket& packet);
@@ -125,6 +141,7 @@ public: // Client
     static const char* FormatChat(NetworkPlayer* fromplayer, const char* text);
     void SendPacketToClients(const NetworkPacket& packet, bool front = false, bool gameCmd = false) const;
     bool CheckSRAND(uint32_t tick, uint32_t srand0);
+    void LogDivergedEntityRanges(const EntityRangeChecksums& serverHashes);
     bool CheckDesynchronizaton();
     void RequestStateSnapshot();
     bool IsDesynchronised() const noexcept;
@@ -150,6 +167,8 @@ public: // Client
     void Client_Handle_MAP(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_CHAT(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_Handle_GAME_ACTION_BATCH(NetworkConnection& connection, NetworkPacket& packet);
+    void ClientEnqueueGameAction(uint32_t tick, GameCommand actionType, const uint8_t* data, size_t size);
     void Client_Handle_TICK(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_PLAYERINFO(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_PLAYERLIST(NetworkConnection& connection, NetworkPacket& packet);
@@ -197,6 +216,13 @@ private: // Common Data
 private: // Server Data
     std::unordered_map<NetworkCommand, CommandHandler> server_command_handlers;
     std::unique_ptr<ITcpSocket> _listenSocket;
+    std::unique_ptr<ITcpSocketPoller> _socketPoller;
+    // Optional thread which sends and receives for all client connections, guarded by the connection list lock.
+    std::thread _ioThread;
+    std::atomic_bool _ioThreadStop = false;
+    std::mutex _connectionListLock;
+    std::mutex _ioWakeLock;
+    std::condition_variable _ioWake;
     std::unique_ptr<INetworkServerAdvertiser> _advertiser;
     std::list<std::unique_ptr<NetworkConnection>> client_connection_list;
     std::string _serverLogPath;
@@ -216,6 +242,28 @@ private: // Client Data
         uint32_t srand0;
         uint32_t tick;
         std::string spriteHash;
+        std::optional<EntityRangeChecksums> entityRangeHashes;
+    };
+
+    // Game actions executed during the current tick which have not been sent to the clients yet. Consecutive
+    // actions of the same type are stored as one run: type, count, then the size and data of each action.
+    struct ServerActionBatch
+    {
+        uint32_t Tick{};
+        uint32_t NumActions{};
+        GameCommand RunType{};
+        uint16_t RunCount{};
+        size_t RunCountOffset{};
+        NetworkPacket Payload;
+    };
+
+    // A serialised map which can be sent to every client joining before the game state changes.
+    struct ServerMapCache
+    {
+        uint32_t Tick{};
+        uint32_t ActionRevision{};
+        std::vector<const ObjectRepositoryItem*> Objects;
+        std::vector<uint8_t> Data;
     };
 
     struct ServerScriptsData
@@ -241,6 +289,7 @@ private: // Client Data
     uint32_t last_ping_sent_time = 0;
     uint32_t server_connect_time = 0;
     uint32_t _actionId;
+    uint32_t _serverActionRevision = 0;
     int32_t status = NETWORK_STATUS_NONE;
     uint8_t player_id = 0;
     uint16_t _port = 0;
@@ -248,6 +297,10 @@ private: // Client Data
     bool _requireReconnect = false;
     bool _clientMapLoaded = false;
     ServerScriptsData _serverScriptsData{};
+    ServerMapCache _serverMapCache{};
+    ServerActionBatch _serverActionBatch{};
+    // Reused for every game action sent, so sending does not allocate once it has grown.
+    DataSerialiser _actionSerialiser{ true };
 };
 
 #endif // DISABLE_NETWORK
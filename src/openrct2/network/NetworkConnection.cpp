@@ -18,6 +18,9 @@
 #    include "Socket.h"
 #    include "network.h"
 
+#    include <algorithm>
+#    include <array>
+
 constexpr size_t NETWORK_DISCONNECT_REASON_BUFFER_SIZE = 256;
 constexpr size_t NetworkBufferSize = 1024 * 64; // 64 KiB, maximum packet size.
 
@@ -86,7 +89,7 @@ NetworkReadPacket NetworkConnection::ReadPacket()
             // Received complete packet.
             _lastPacketTime = Platform::GetTicks();
 
-            RecordPacketStats(InboundPacket, false);
+            RecordPacketStats(InboundPacket.GetCommand(), InboundPacket.BytesTransferred, false);
 
             return NetworkReadPacket::Success;
         }
@@ -95,12 +98,12 @@ NetworkReadPacket NetworkConnection::ReadPacket()
     return NetworkReadPacket::MoreData;
 }
 
-bool NetworkConnection::SendPacket(NetworkPacket& packet)
+NetworkSharedPacket::NetworkSharedPacket(const NetworkPacket& packet)
+    : Command(packet.GetCommand())
+    , RequiresAuth(packet.CommandRequiresAuth())
 {
-    auto header = packet.Header;
-
-    std::vector<uint8_t> buffer;
-    buffer.reserve(sizeof(header) + header.Size);
+    PacketHeader header = packet.Header;
+    header.Size = static_cast<uint16_t>(packet.Data.size());
 
     // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
     // Previously the Id field was not part of the header rather part of the body.
@@ -108,29 +111,20 @@ bool NetworkConnection::SendPacket(NetworkPacket& packet)
     header.Size = Convert::HostToNetwork(header.Size);
     header.Id = ByteSwapBE(header.Id);
 
-    buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
-    buffer.insert(buffer.end(), packet.Data.begin(), packet.Data.end());
-
-    size_t bufferSize = buffer.size() - packet.BytesTransferred;
-    size_t sent = Socket->SendData(buffer.data() + packet.BytesTransferred, bufferSize);
-    if (sent > 0)
-    {
-        packet.BytesTransferred += sent;
-    }
-
-    bool sendComplete = packet.BytesTransferred == buffer.size();
-    if (sendComplete)
-    {
-        RecordPacketStats(packet, true);
-    }
-    return sendComplete;
+    auto buffer = std::make_shared<std::vector<uint8_t>>();
+    buffer->reserve(sizeof(header) + packet.Data.size());
+    buffer->insert(
+        buffer->end(), reinterpret_cast<const uint8_t*>(&header), reinterpret_cast<const uint8_t*>(&header) + sizeof(header));
+    buffer->insert(buffer->end(), packet.Data.begin(), packet.Data.end());
+    Buffer = std::move(buffer);
 }
 
-void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
+void NetworkConnection::QueuePacket(const NetworkSharedPacket& packet, bool front)
 {
-    if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
+    if (AuthStatus == NetworkAuth::Ok || !packet.RequiresAuth)
     {
-        packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
+        OutboundPacket outbound{ packet.Command, packet.Buffer };
+        std::lock_guard<std::mutex> lock(_outboundLock);
         if (front)
         {
             // If the first packet was already partially sent add new packet to second position
@@ -138,16 +132,16 @@ void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
             {
                 auto it = _outboundPackets.begin();
                 it++; // Second position
-                _outboundPackets.insert(it, std::move(packet));
+                _outboundPackets.insert(it, std::move(outbound));
             }
             else
             {
-                _outboundPackets.push_front(std::move(packet));
+                _outboundPackets.push_front(std::move(outbound));
             }
         }
         else
         {
-            _outboundPackets.push_back(std::move(packet));
+            _outboundPackets.push_back(std::move(outbound));
         }
     }
 }
@@ -164,9 +158,57 @@ bool NetworkConnection::IsValid() const
 
 void NetworkConnection::SendQueuedPackets()
 {
-    while (!_outboundPackets.empty() && SendPacket(_outboundPackets.front()))
+    // Hand as many queued packets as possible to the socket at once, stopping when it no longer accepts everything.
+    constexpr size_t kMaxBuffersPerSend = 64;
+    std::array<SocketBuffer, kMaxBuffersPerSend> buffers;
+    std::lock_guard<std::mutex> lock(_outboundLock);
+    if (!_outboundPackets.empty())
+    {
+        size_t queuedBytes = 0;
+        for (const auto& packet : _outboundPackets)
+        {
+            queuedBytes += packet.Buffer->size() - packet.BytesTransferred;
+        }
+
+        std::lock_guard<std::mutex> statsLock(_statsLock);
+        _stats.queueDepth.Add(_outboundPackets.size());
+        _stats.bytesPerFlush.Add(queuedBytes);
+    }
+    while (!_outboundPackets.empty())
     {
-        _outboundPackets.pop_front();
+        size_t count = 0;
+        size_t pendingBytes = 0;
+        for (const auto& packet : _outboundPackets)
+        {
+            if (count == buffers.size())
+            {
+                break;
+            }
+            const auto& data = *packet.Buffer;
+            buffers[count++] = { data.data() + packet.BytesTransferred, data.size() - packet.BytesTransferred };
+            pendingBytes += data.size() - packet.BytesTransferred;
+        }
+
+        size_t sent = Socket->SendData(buffers.data(), count);
+        const bool sentAll = sent == pendingBytes;
+        while (sent > 0)
+        {
+            auto& packet = _outboundPackets.front();
+            const auto packetSize = packet.Buffer->size();
+            const auto consumed = std::min(sent, packetSize - packet.BytesTransferred);
+            packet.BytesTransferred += consumed;
+            sent -= consumed;
+            if (packet.BytesTransferred == packetSize)
+            {
+                RecordPacketStats(packet.Command, packetSize, true);
+                _outboundPackets.pop_front();
+            }
+        }
+
+        if (!sentAll)
+        {
+            break;
+        }
     }
 }
 
@@ -203,14 +245,112 @@ void NetworkConnection::SetLastDisconnectReason(const StringId string_id, void*
     SetLastDisconnectReason(buffer);
 }
 
-void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool sending)
+NetworkStats NetworkConnection::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(_statsLock);
+    return _stats;
+}
+
+size_t NetworkConnection::GetQueuedPacketCount() const
+{
+    std::lock_guard<std::mutex> lock(_outboundLock);
+    return _outboundPackets.size();
+}
+
+size_t NetworkConnection::GetBufferedBytes() const
+{
+    size_t total = InboundPacket.Data.capacity();
+    {
+        std::lock_guard<std::mutex> lock(_outboundLock);
+        for (const auto& packet : _outboundPackets)
+        {
+            total += sizeof(OutboundPacket) + (packet.Buffer != nullptr ? packet.Buffer->capacity() : 0);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(_receivedLock);
+        for (const auto& packet : _receivedPackets)
+        {
+            total += sizeof(NetworkPacket) + packet.Data.capacity();
+        }
+    }
+    return total;
+}
+
+void NetworkConnection::RecordRoundTripTime(uint32_t milliseconds)
+{
+    std::lock_guard<std::mutex> lock(_statsLock);
+    _stats.roundTripTime.Add(milliseconds);
+}
+
+void NetworkConnection::RecordActionLatency(uint32_t microseconds)
+{
+    std::lock_guard<std::mutex> lock(_statsLock);
+    _stats.actionLatency.Add(microseconds);
+}
+
+void NetworkConnection::ReceivePackets()
+{
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_receivedLock);
+            if (_receiveClosed || _receivedPackets.size() >= kMaxReceivedPackets)
+            {
+                return;
+            }
+        }
+
+        NetworkReadPacket status;
+        try
+        {
+            status = ReadPacket();
+        }
+        catch (const std::exception&)
+        {
+            status = NetworkReadPacket::Disconnected;
+        }
+
+        std::lock_guard<std::mutex> lock(_receivedLock);
+        if (status == NetworkReadPacket::Success)
+        {
+            _receivedPackets.push_back(std::move(InboundPacket));
+            InboundPacket = {};
+        }
+        else
+        {
+            _receiveClosed = status == NetworkReadPacket::Disconnected;
+            return;
+        }
+    }
+}
+
+bool NetworkConnection::TakeReceivedPacket(NetworkPacket& packet)
+{
+    std::lock_guard<std::mutex> lock(_receivedLock);
+    if (_receivedPackets.empty())
+    {
+        return false;
+    }
+    packet = std::move(_receivedPackets.front());
+    _receivedPackets.pop_front();
+    return true;
+}
+
+bool NetworkConnection::IsReceiveClosed() const
+{
+    std::lock_guard<std::mutex> lock(_receivedLock);
+    return _receiveClosed && _receivedPackets.empty();
+}
+
+void NetworkConnection::RecordPacketStats(NetworkCommand command, size_t packetSize, bool sending)
 {
-    uint32_t packetSize = static_cast<uint32_t>(packet.BytesTransferred);
     NetworkStatisticsGroup trafficGroup;
 
-    switch (packet.GetCommand())
+    switch (command)
     {
         case NetworkCommand::GameAction:
+        case NetworkCommand::GameActionBatch:
             trafficGroup = NetworkStatisticsGroup::Commands;
             break;
         case NetworkCommand::Map:
@@ -221,15 +361,16 @@ void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool send
             break;
     }
 
+    std::lock_guard<std::mutex> lock(_statsLock);
     if (sending)
     {
-        Stats.bytesSent[EnumValue(trafficGroup)] += packetSize;
-        Stats.bytesSent[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
+        _stats.bytesSent[EnumValue(trafficGroup)] += packetSize;
+        _stats.bytesSent[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
     }
     else
     {
-        Stats.bytesReceived[EnumValue(trafficGroup)] += packetSize;
-        Stats.bytesReceived[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
+        _stats.bytesReceived[EnumValue(trafficGroup)] += packetSize;
+        _stats.bytesReceived[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
     }
 }
 
@@ -16,21 +16,34 @@
 #    include "NetworkTypes.h"
 #    include "Socket.h"
 
+#    include <atomic>
 #    include <deque>
 #    include <memory>
+#    include <mutex>
 #    include <string_view>
 #    include <vector>
 
 class NetworkPlayer;
 struct ObjectRepositoryItem;
 
+/**
+ * A packet encoded for sending, the buffer is immutable so it can be queued on any number of connections.
+ */
+struct NetworkSharedPacket
+{
+    NetworkCommand Command = NetworkCommand::Invalid;
+    bool RequiresAuth = true;
+    std::shared_ptr<const std::vector<uint8_t>> Buffer;
+
+    explicit NetworkSharedPacket(const NetworkPacket& packet);
+};
+
 class NetworkConnection final
 {
 public:
     std::unique_ptr<ITcpSocket> Socket = nullptr;
     NetworkPacket InboundPacket;
     NetworkAuth AuthStatus = NetworkAuth::None;
-    NetworkStats Stats = {};
     NetworkPlayer* Player = nullptr;
     uint32_t PingTime = 0;
     NetworkKey Key;
@@ -41,12 +54,11 @@ public:
     NetworkConnection() noexcept;
 
     NetworkReadPacket ReadPacket();
-    void QueuePacket(NetworkPacket&& packet, bool front = false);
     void QueuePacket(const NetworkPacket& packet, bool front = false)
     {
-        auto copy = packet;
-        return QueuePacket(std::move(copy), front);
+        QueuePacket(NetworkSharedPacket(packet), front);
     }
+    void QueuePacket(const NetworkSharedPacket& packet, bool front = false);
 
     // This will not immediately disconnect the client. The disconnect
     // will happen post-tick.
@@ -56,18 +68,54 @@ public:
     void SendQueuedPackets();
     void ResetLastPacketTime() noexcept;
     bool ReceivedPacketRecently() const noexcept;
+    NetworkStats GetStats() const;
+    size_t GetQueuedPacketCount() const;
+    // Bytes held by the packet queues, buffers shared by a broadcast are counted for every connection.
+    size_t GetBufferedBytes() const;
+    void RecordRoundTripTime(uint32_t milliseconds);
+    void RecordActionLatency(uint32_t microseconds);
+
+    /**
+     * Reads complete packets from the socket into the received queue until no more data is available or
+     * the queue is full. Used when a network I/O thread owns the socket.
+     */
+    void ReceivePackets();
+    /**
+     * Takes the oldest packet from the received queue, returns false if the queue is empty.
+     */
+    bool TakeReceivedPacket(NetworkPacket& packet);
+    /**
+     * Whether the socket was closed and every packet received before that has been taken.
+     */
+    bool IsReceiveClosed() const;
 
     const utf8* GetLastDisconnectReason() const noexcept;
     void SetLastDisconnectReason(std::string_view src);
     void SetLastDisconnectReason(const StringId string_id, void* args = nullptr);
 
 private:
-    std::deque<NetworkPacket> _outboundPackets;
-    uint32_t _lastPacketTime = 0;
+    struct OutboundPacket
+    {
+        NetworkCommand Command;
+        std::shared_ptr<const std::vector<uint8_t>> Buffer;
+        size_t BytesTransferred = 0;
+    };
+
+    // Bounds the received queue so a flooding client is throttled by TCP instead of growing the queue.
+    static constexpr size_t kMaxReceivedPackets = 256;
+
+    // The queues can be accessed by both the game thread and the network I/O thread.
+    mutable std::mutex _outboundLock;
+    std::deque<OutboundPacket> _outboundPackets;
+    mutable std::mutex _receivedLock;
+    std::deque<NetworkPacket> _receivedPackets;
+    bool _receiveClosed = false;
+    mutable std::mutex _statsLock;
+    NetworkStats _stats = {};
+    std::atomic<uint32_t> _lastPacketTime = 0;
     std::string _lastDisconnectReason;
 
-    void RecordPacketStats(const NetworkPacket& packet, bool sending);
-    bool SendPacket(NetworkPacket& packet);
+    void RecordPacketStats(NetworkCommand command, size_t packetSize, bool sending);
 };
 
 #endif // DISABLE_NETWORK
@@ -39,6 +39,8 @@ public:
     uint32_t LastDemolishRideTime = 0;
     uint32_t LastPlaceSceneryTime = 0;
     std::unordered_map<GameCommand, int32_t> CooldownTime;
+    // Server only, the player joined while all player slots were taken and is kept in the spectator group.
+    bool SpectatorSlot = false;
     NetworkPlayer() noexcept = default;
 
     void SetName(std::string_view name);
@@ -190,7 +190,7 @@ private:
         request.body = body.dump();
         request.header["Content-Type"] = "application/json";
 
-        Http::DoAsync(request, [&](Http::Response response) -> void {
+        Http::DoAsyncOnMainThread(request, [&](Http::Response& response) -> void {
             if (response.status != Http::Status::Ok)
             {
                 Console::Error::WriteLine("Unable to connect to master server");
@@ -214,7 +214,7 @@ private:
         request.header["Content-Type"] = "application/json";
 
         _lastHeartbeatTime = Platform::GetTicks();
-        Http::DoAsync(request, [&](Http::Response response) -> void {
+        Http::DoAsyncOnMainThread(request, [&](Http::Response& response) -> void {
             if (response.status != Http::Status::Ok)
             {
                 Console::Error::WriteLine("Unable to connect to master server");
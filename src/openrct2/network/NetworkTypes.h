@@ -14,6 +14,10 @@
 #include "../ride/RideTypes.h"
 #include "../util/Util.h"
 
+#include <algorithm>
+#include <array>
+#include <bit>
+
 enum
 {
     SERVER_EVENT_PLAYER_JOINED,
@@ -23,6 +27,7 @@ enum
 enum
 {
     NETWORK_TICK_FLAG_CHECKSUMS = 1 << 0,
+    NETWORK_TICK_FLAG_RANGE_CHECKSUMS = 1 << 1,
 };
 
 enum
@@ -84,6 +89,7 @@ enum class NetworkCommand : uint32_t
     ScriptsHeader,
     ScriptsData,
     Heartbeat,
+    GameActionBatch,
     Max,
     Invalid = static_cast<uint32_t>(-1),
 };
@@ -141,8 +147,44 @@ enum class NetworkStatisticsGroup : uint32_t
     Max,
 };
 
+// Distribution of samples in power of two buckets, bucket n counts the values from 2^(n-1) up to 2^n - 1.
+// The last bucket also counts everything larger.
+struct NetworkHistogram
+{
+    static constexpr size_t kNumBuckets = 24;
+
+    std::array<uint64_t, kNumBuckets> buckets{};
+    uint64_t count{};
+    uint64_t sum{};
+    uint64_t max{};
+
+    void Add(uint64_t value) noexcept
+    {
+        const auto bucket = std::min<size_t>(std::bit_width(value), kNumBuckets - 1);
+        buckets[bucket]++;
+        count++;
+        sum += value;
+        max = std::max(max, value);
+    }
+
+    void Merge(const NetworkHistogram& other) noexcept
+    {
+        for (size_t i = 0; i < kNumBuckets; i++)
+        {
+            buckets[i] += other.buckets[i];
+        }
+        count += other.count;
+        sum += other.sum;
+        max = std::max(max, other.max);
+    }
+};
+
 struct NetworkStats
 {
     uint64_t bytesReceived[EnumValue(NetworkStatisticsGroup::Max)];
     uint64_t bytesSent[EnumValue(NetworkStatisticsGroup::Max)];
+    NetworkHistogram roundTripTime;   // Milliseconds between a ping and its reply, server only.
+    NetworkHistogram queueDepth;      // Packets waiting in the send queue each time it is flushed.
+    NetworkHistogram bytesPerFlush;   // Bytes waiting in the send queue each time it is flushed.
+    NetworkHistogram actionLatency;   // Microseconds spent handling a received game action.
 };
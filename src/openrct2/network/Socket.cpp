@@ -9,6 +9,8 @@
 
 #ifndef DISABLE_NETWORK
 
+#    include <algorithm>
+#    include <array>
 #    include <atomic>
 #    include <chrono>
 #    include <cmath>
@@ -53,7 +55,13 @@
     #include <sys/select.h>
     #include <sys/socket.h>
     #include <sys/time.h>
+    #include <sys/uio.h>
     #include <unistd.h>
+    #if defined(__linux__)
+        #include <sys/epoll.h>
+    #else
+        #include <poll.h>
+    #endif
     #include "../common.h"
     using SOCKET = int32_t;
     #define SOCKET_ERROR -1
@@ -248,6 +256,9 @@ private:
 class TcpSocket final : public ITcpSocket, protected Socket
 {
 private:
+    // Well below IOV_MAX on every platform
+    static constexpr size_t kMaxSendBuffers = 64;
+
     std::atomic<SocketStatus> _status{ SocketStatus::Closed };
     uint16_t _listeningPort = 0;
     SOCKET _socket = INVALID_SOCKET;
@@ -268,6 +279,11 @@ public:
     {
     }
 
+    SOCKET GetHandle() const noexcept
+    {
+        return _socket;
+    }
+
     ~TcpSocket() override
     {
         if (_connectFuture.valid())
@@ -572,6 +588,46 @@ public:
         return totalSent;
     }
 
+    size_t SendData(const SocketBuffer* buffers, size_t count) override
+    {
+        if (_status != SocketStatus::Connected)
+        {
+            throw std::runtime_error("Socket not connected.");
+        }
+
+        count = std::min(count, kMaxSendBuffers);
+#    ifdef _WIN32
+        std::array<WSABUF, kMaxSendBuffers> wsaBuffers;
+        for (size_t i = 0; i < count; i++)
+        {
+            wsaBuffers[i].buf = const_cast<char*>(static_cast<const char*>(buffers[i].Data));
+            wsaBuffers[i].len = static_cast<ULONG>(buffers[i].Size);
+        }
+        DWORD sentBytes = 0;
+        if (WSASend(_socket, wsaBuffers.data(), static_cast<DWORD>(count), &sentBytes, 0, nullptr, nullptr) == SOCKET_ERROR)
+        {
+            return 0;
+        }
+        return sentBytes;
+#    else
+        std::array<iovec, kMaxSendBuffers> ioBuffers;
+        for (size_t i = 0; i < count; i++)
+        {
+            ioBuffers[i].iov_base = const_cast<void*>(buffers[i].Data);
+            ioBuffers[i].iov_len = buffers[i].Size;
+        }
+        msghdr message{};
+        message.msg_iov = ioBuffers.data();
+        message.msg_iovlen = count;
+        auto sentBytes = sendmsg(_socket, &message, FLAG_NO_PIPE);
+        if (sentBytes == SOCKET_ERROR)
+        {
+            return 0;
+        }
+        return static_cast<size_t>(sentBytes);
+#    endif
+    }
+
     NetworkReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) override
     {
         if (_status != SocketStatus::Connected)
@@ -862,6 +918,118 @@ private:
     }
 };
 
+class TcpSocketPoller final : public ITcpSocketPoller
+{
+private:
+#    if defined(__linux__)
+    static constexpr size_t kMaxEventsPerPoll = 256;
+    int _epoll = -1;
+#    elif defined(_WIN32)
+    std::vector<WSAPOLLFD> _pollFds;
+    std::vector<ITcpSocket*> _pollSockets;
+#    else
+    std::vector<pollfd> _pollFds;
+    std::vector<ITcpSocket*> _pollSockets;
+#    endif
+    std::vector<ITcpSocket*> _readySockets;
+
+public:
+    TcpSocketPoller()
+    {
+#    if defined(__linux__)
+        _epoll = epoll_create1(EPOLL_CLOEXEC);
+        if (_epoll == -1)
+        {
+            throw SocketException("Unable to create epoll instance.");
+        }
+#    endif
+    }
+
+    ~TcpSocketPoller() override
+    {
+#    if defined(__linux__)
+        close(_epoll);
+#    endif
+    }
+
+    void Add(ITcpSocket& socket) override
+    {
+        auto handle = GetHandle(socket);
+#    if defined(__linux__)
+        epoll_event event{};
+        event.events = EPOLLIN | EPOLLRDHUP;
+        event.data.ptr = &socket;
+        if (epoll_ctl(_epoll, EPOLL_CTL_ADD, handle, &event) == -1)
+        {
+            throw SocketException("Unable to add socket to epoll instance.");
+        }
+#    else
+        auto& pollFd = _pollFds.emplace_back();
+        pollFd.fd = handle;
+        pollFd.events = POLLIN;
+        _pollSockets.push_back(&socket);
+#    endif
+    }
+
+    void Remove(ITcpSocket& socket) override
+    {
+#    if defined(__linux__)
+        epoll_ctl(_epoll, EPOLL_CTL_DEL, GetHandle(socket), nullptr);
+#    else
+        auto it = std::find(_pollSockets.begin(), _pollSockets.end(), &socket);
+        if (it != _pollSockets.end())
+        {
+            auto index = std::distance(_pollSockets.begin(), it);
+            _pollSockets.erase(it);
+            _pollFds.erase(_pollFds.begin() + index);
+        }
+#    endif
+    }
+
+    const std::vector<ITcpSocket*>& Poll() override
+    {
+        _readySockets.clear();
+#    if defined(__linux__)
+        std::array<epoll_event, kMaxEventsPerPoll> events;
+        int32_t count = epoll_wait(_epoll, events.data(), static_cast<int32_t>(events.size()), 0);
+        for (int32_t i = 0; i < count; i++)
+        {
+            _readySockets.push_back(static_cast<ITcpSocket*>(events[i].data.ptr));
+        }
+#    else
+        if (_pollFds.empty())
+        {
+            return _readySockets;
+        }
+#        if defined(_WIN32)
+        int32_t count = WSAPoll(_pollFds.data(), static_cast<ULONG>(_pollFds.size()), 0);
+#        else
+        int32_t count = poll(_pollFds.data(), static_cast<nfds_t>(_pollFds.size()), 0);
+#        endif
+        for (size_t i = 0; i < _pollFds.size() && count > 0; i++)
+        {
+            if (_pollFds[i].revents != 0)
+            {
+                _readySockets.push_back(_pollSockets[i]);
+                count--;
+            }
+        }
+#    endif
+        return _readySockets;
+    }
+
+private:
+    static SOCKET GetHandle(ITcpSocket& socket)
+    {
+        auto* tcpSocket = dynamic_cast<TcpSocket*>(&socket);
+        if (tcpSocket == nullptr)
+        {
+            throw std::invalid_argument("socket is not compatible.");
+        }
+        return tcpSocket->GetHandle();
+    }
+};
+
 std::unique_ptr<ITcpSocket> CreateTcpSocket()
 {
     InitialiseWSA();
@@ -874,6 +1042,12 @@ std::unique_ptr<IUdpSocket> CreateUdpSocket()
     return std::make_unique<UdpSocket>();
 }
 
+std::unique_ptr<ITcpSocketPoller> CreateTcpSocketPoller()
+{
+    InitialiseWSA();
+    return std::make_unique<TcpSocketPoller>();
+}
+
 #    ifdef _WIN32
 static std::vector<INTERFACE_INFO> GetNetworkInterfaces()
 {
@@ -45,6 +45,15 @@ struct INetworkEndpoint
     virtual std::string GetHostname() const abstract;
 };
 
+/**
+ * A region of memory to send as part of a vectored write.
+ */
+struct SocketBuffer
+{
+    const void* Data;
+    size_t Size;
+};
+
 /**
  * Represents a TCP socket / connection or listener.
  */
@@ -66,6 +75,11 @@ public:
     virtual void ConnectAsync(const std::string& address, uint16_t port) abstract;
 
     virtual size_t SendData(const void* buffer, size_t size) abstract;
+    /**
+     * Sends as much of the given buffers as the socket accepts without blocking in a single call.
+     * @returns the number of bytes sent, continuing into the next buffer once one is complete.
+     */
+    virtual size_t SendData(const SocketBuffer* buffers, size_t count) abstract;
     virtual NetworkReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) abstract;
 
     virtual void SetNoDelay(bool noDelay) abstract;
@@ -98,8 +112,27 @@ public:
     virtual void Close() abstract;
 };
 
+/**
+ * Tracks many connected TCP sockets and reports which of them can be read from, so that sockets without
+ * any data waiting do not need to be touched. Uses epoll on Linux and poll / WSAPoll elsewhere.
+ */
+struct ITcpSocketPoller
+{
+public:
+    virtual ~ITcpSocketPoller() = default;
+
+    virtual void Add(ITcpSocket& socket) abstract;
+    virtual void Remove(ITcpSocket& socket) abstract;
+
+    /**
+     * Returns the sockets that have data waiting or have been closed by the peer, this does not block.
+     */
+    virtual const std::vector<ITcpSocket*>& Poll() abstract;
+};
+
 [[nodiscard]] std::unique_ptr<ITcpSocket> CreateTcpSocket();
 [[nodiscard]] std::unique_ptr<IUdpSocket> CreateUdpSocket();
+[[nodiscard]] std::unique_ptr<ITcpSocketPoller> CreateTcpSocketPoller();
 [[nodiscard]] std::vector<std::unique_ptr<INetworkEndpoint>> GetBroadcastAddresses();
 
 namespace Convert
@@ -54,6 +54,8 @@ void NetworkFlush();
 
 [[nodiscard]] NetworkAuth NetworkGetAuthstatus();
 [[nodiscard]] uint32_t NetworkGetServerTick();
+[[nodiscard]] size_t NetworkGetQueuedPacketCount();
+[[nodiscard]] size_t NetworkGetMemoryUsage();
 [[nodiscard]] uint8_t NetworkGetCurrentPlayerId();
 [[nodiscard]] int32_t NetworkGetNumPlayers();
 [[nodiscard]] int32_t NetworkGetNumVisiblePlayers();
@@ -64,6 +66,7 @@ void NetworkFlush();
 [[nodiscard]] money64 NetworkGetPlayerMoneySpent(uint32_t index);
 [[nodiscard]] std::string NetworkGetPlayerIPAddress(uint32_t id);
 [[nodiscard]] std::string NetworkGetPlayerPublicKeyHash(uint32_t id);
+[[nodiscard]] NetworkStats NetworkGetPlayerStats(uint32_t id);
 void NetworkIncrementPlayerNumCommands(uint32_t playerIndex);
 void NetworkAddPlayerMoneySpent(uint32_t index, money64 cost);
 [[nodiscard]] int32_t NetworkGetPlayerLastAction(uint32_t index, int32_t time);
@@ -12,10 +12,15 @@
 #include "../Context.h"
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
+#include "../Version.h"
+#include "../config/Config.h"
+#include "../core/Crypt.h"
 #include "../core/File.h"
 #include "../core/FileScanner.h"
+#include "../core/FileStream.h"
 #include "../core/IStream.hpp"
 #include "../core/Json.hpp"
+#include "../core/MemoryMappedFile.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../drawing/ImageImporter.h"
@@ -25,11 +30,42 @@
 
 #include <algorithm>
 #include <memory>
+#include <random>
 #include <stdexcept>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 
+// Increment this when the layout of the image cache files changes
+constexpr uint32_t kImageCacheMagic = 0x43544D49; // IMTC
+constexpr uint32_t kImageCacheVersion = 1;
+constexpr uint32_t kImageCacheNullOffset = 0xFFFFFFFF;
+
+#pragma pack(push, 1)
+struct ImageCacheHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t KeyLength;
+    uint32_t NumImages;
+    uint64_t DataSize;
+};
+assert_struct_size(ImageCacheHeader, 24);
+
+struct ImageCacheEntry
+{
+    uint32_t Offset;
+    int16_t Width;
+    int16_t Height;
+    int16_t XOffset;
+    int16_t YOffset;
+    uint16_t Flags;
+    uint16_t Padding;
+    int32_t ZoomedOffset;
+};
+assert_struct_size(ImageCacheEntry, 20);
+#pragma pack(pop)
+
 static thread_local std::map<u8string, std::unique_ptr<Object>> _objDataCache = {};
 
 struct ImageTable::RequiredImage
@@ -403,7 +439,7 @@ std::string ImageTable::FindLegacyObject(const std::string& name)
 
 ImageTable::~ImageTable()
 {
-    if (_data == nullptr)
+    if (_data == nullptr && _mapping == nullptr)
     {
         for (auto& entry : _entries)
         {
@@ -412,6 +448,19 @@ ImageTable::~ImageTable()
     }
 }
 
+size_t ImageTable::GetMemoryUsage() const
+{
+    size_t bytes = _entries.capacity() * sizeof(G1Element);
+    for (const auto& entry : _entries)
+    {
+        if (entry.offset != nullptr)
+        {
+            bytes += G1CalculateDataSize(&entry);
+        }
+    }
+    return bytes;
+}
+
 void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
 {
     if (gOpenRCT2NoGraphics)
@@ -523,6 +572,19 @@ bool ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
             usesFallbackSprites = true;
         }
 
+        // Decoded images can be shared between processes if this exact object has been loaded before
+        std::string cacheKey;
+        if (gConfigGeneral.SharedImageCache && _entries.empty() && !context->GetImageCacheKey().empty())
+        {
+            cacheKey = String::StdFormat(
+                "%s|%s|%d", std::string(context->GetImageCacheKey()).c_str(), gVersionInfoFull, usesFallbackSprites);
+            if (ReadCache(cacheKey))
+            {
+                _objDataCache.clear();
+                return usesFallbackSprites;
+            }
+        }
+
         auto imageSources = GetImageSources(context, jsonImages);
 
         for (auto& jsonImage : jsonImages)
@@ -603,6 +665,11 @@ bool ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
                 }
             }
         }
+
+        if (!cacheKey.empty())
+        {
+            WriteCache(cacheKey);
+        }
     }
 
     _objDataCache.clear();
@@ -625,3 +692,144 @@ void ImageTable::AddImage(const G1Element* g1)
     }
     _entries.push_back(std::move(newg1));
 }
+
+std::string ImageTable::GetCachePath(std::string_view key)
+{
+    auto hash = Crypt::FNV1a(key.data(), key.size());
+    std::string fileName;
+    for (auto b : hash)
+    {
+        fileName += String::StdFormat("%02x", b);
+    }
+    auto env = GetContext()->GetPlatformEnvironment();
+    auto directory = Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE), u8"images");
+    return Path::Combine(directory, fileName + u8".dat");
+}
+
+bool ImageTable::ReadCache(std::string_view key)
+{
+    auto path = GetCachePath(key);
+    if (!File::Exists(path))
+    {
+        return false;
+    }
+
+    try
+    {
+        auto mapping = std::make_shared<MemoryMappedFile>(path);
+        const auto* base = mapping->GetData();
+        const auto length = mapping->GetLength();
+        if (length < sizeof(ImageCacheHeader))
+        {
+            return false;
+        }
+
+        ImageCacheHeader header;
+        std::memcpy(&header, base, sizeof(header));
+        const uint64_t entriesStart = sizeof(ImageCacheHeader) + header.KeyLength;
+        const uint64_t dataStart = entriesStart + static_cast<uint64_t>(header.NumImages) * sizeof(ImageCacheEntry);
+        if (header.Magic != kImageCacheMagic || header.Version != kImageCacheVersion || header.KeyLength != key.size()
+            || dataStart + header.DataSize != length
+            || std::memcmp(base + sizeof(ImageCacheHeader), key.data(), key.size()) != 0)
+        {
+            // Stale or from a different object with the same hash
+            return false;
+        }
+
+        auto* data = mapping->GetData() + dataStart;
+        std::vector<G1Element> entries(header.NumImages);
+        for (uint32_t i = 0; i < header.NumImages; i++)
+        {
+            ImageCacheEntry cacheEntry;
+            std::memcpy(&cacheEntry, base + entriesStart + i * sizeof(ImageCacheEntry), sizeof(cacheEntry));
+
+            auto& g1 = entries[i];
+            g1.width = cacheEntry.Width;
+            g1.height = cacheEntry.Height;
+            g1.x_offset = cacheEntry.XOffset;
+            g1.y_offset = cacheEntry.YOffset;
+            g1.flags = cacheEntry.Flags;
+            g1.zoomed_offset = cacheEntry.ZoomedOffset;
+            if (cacheEntry.Offset != kImageCacheNullOffset)
+            {
+                if (cacheEntry.Offset + G1CalculateDataSize(&g1) > header.DataSize)
+                {
+                    return false;
+                }
+                g1.offset = data + cacheEntry.Offset;
+            }
+        }
+
+        _mapping = std::move(mapping);
+        _entries = std::move(entries);
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to read image cache '%s': %s", path.c_str(), e.what());
+        return false;
+    }
+}
+
+void ImageTable::WriteCache(std::string_view key) const
+{
+    auto path = GetCachePath(key);
+
+    std::vector<ImageCacheEntry> cacheEntries;
+    cacheEntries.reserve(_entries.size());
+    uint64_t dataSize = 0;
+    for (const auto& g1 : _entries)
+    {
+        auto length = g1.offset == nullptr ? 0 : G1CalculateDataSize(&g1);
+        auto& cacheEntry = cacheEntries.emplace_back();
+        cacheEntry.Offset = g1.offset == nullptr ? kImageCacheNullOffset : static_cast<uint32_t>(dataSize);
+        cacheEntry.Width = g1.width;
+        cacheEntry.Height = g1.height;
+        cacheEntry.XOffset = g1.x_offset;
+        cacheEntry.YOffset = g1.y_offset;
+        cacheEntry.Flags = g1.flags;
+        cacheEntry.Padding = 0;
+        cacheEntry.ZoomedOffset = g1.zoomed_offset;
+        dataSize += length;
+    }
+    if (dataSize >= kImageCacheNullOffset)
+    {
+        return;
+    }
+
+    // Other processes may be writing the same entry, write to a unique file and move it into place
+    auto tempPath = path + String::StdFormat(".%08x", std::random_device{}());
+    try
+    {
+        Path::CreateDirectory(Path::GetDirectory(path));
+        {
+            auto fs = FileStream(tempPath, FILE_MODE_WRITE);
+
+            ImageCacheHeader header{};
+            header.Magic = kImageCacheMagic;
+            header.Version = kImageCacheVersion;
+            header.KeyLength = static_cast<uint32_t>(key.size());
+            header.NumImages = static_cast<uint32_t>(_entries.size());
+            header.DataSize = dataSize;
+            fs.WriteValue(header);
+            fs.Write(key.data(), key.size());
+            fs.Write(cacheEntries.data(), cacheEntries.size() * sizeof(ImageCacheEntry));
+            for (const auto& g1 : _entries)
+            {
+                if (g1.offset != nullptr)
+                {
+                    fs.Write(g1.offset, G1CalculateDataSize(&g1));
+                }
+            }
+        }
+        if (!File::Move(tempPath, path))
+        {
+            File::Delete(tempPath);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to write image cache '%s': %s", path.c_str(), e.what());
+        File::Delete(tempPath);
+    }
+}
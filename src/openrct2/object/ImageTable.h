@@ -21,12 +21,14 @@ struct IReadObjectContext;
 namespace OpenRCT2
 {
     struct IStream;
-}
+    class MemoryMappedFile;
+} // namespace OpenRCT2
 
 class ImageTable
 {
 private:
     std::unique_ptr<uint8_t[]> _data;
+    std::shared_ptr<OpenRCT2::MemoryMappedFile> _mapping;
     std::vector<G1Element> _entries;
 
     /**
@@ -47,6 +49,9 @@ private:
     [[nodiscard]] static std::string FindLegacyObject(const std::string& name);
     [[nodiscard]] static std::vector<std::unique_ptr<ImageTable::RequiredImage>> LoadImageArchiveImages(
         IReadObjectContext* context, const std::string& path, const std::vector<int32_t>& range = {});
+    [[nodiscard]] static std::string GetCachePath(std::string_view key);
+    bool ReadCache(std::string_view key);
+    void WriteCache(std::string_view key) const;
 
 public:
     ImageTable() = default;
@@ -68,4 +73,6 @@ public:
         return static_cast<uint32_t>(_entries.size());
     }
     void AddImage(const G1Element* g1);
+    // Bytes used by the element table and the image data it points to.
+    size_t GetMemoryUsage() const;
 };
@@ -175,6 +175,11 @@ struct IReadObjectContext
     virtual bool ShouldLoadImages() abstract;
     virtual std::vector<uint8_t> GetData(std::string_view path) abstract;
     virtual ObjectAsset GetAsset(std::string_view path) abstract;
+    /**
+     * Returns a key identifying this exact revision of the object's images, or an empty string if the
+     * decoded images can not be cached.
+     */
+    virtual std::string_view GetImageCacheKey() abstract;
 
     virtual void LogVerbose(ObjectError code, const utf8* text) abstract;
     virtual void LogWarning(ObjectError code, const utf8* text) abstract;
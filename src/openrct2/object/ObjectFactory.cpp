@@ -13,6 +13,7 @@
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
 #include "../audio/audio.h"
+#include "../config/Config.h"
 #include "../core/Console.hpp"
 #include "../core/File.h"
 #include "../core/FileStream.h"
@@ -53,6 +54,11 @@ struct IFileDataRetriever
     virtual ~IFileDataRetriever() = default;
     virtual std::vector<uint8_t> GetData(std::string_view path) const abstract;
     virtual ObjectAsset GetAsset(std::string_view path) const abstract;
+    /**
+     * Returns a stamp which changes whenever any of the retrievable data changes, or an empty string if
+     * that can not be determined cheaply.
+     */
+    virtual std::string GetCacheStamp() const abstract;
 };
 
 class FileSystemDataRetriever : public IFileDataRetriever
@@ -84,6 +90,12 @@ public:
             return ObjectAsset(absolutePath);
         }
     }
+
+    std::string GetCacheStamp() const override
+    {
+        // Loose image files can change without the object file changing
+        return {};
+    }
 };
 
 class ZipDataRetriever : public IFileDataRetriever
@@ -108,6 +120,11 @@ public:
     {
         return ObjectAsset(_path, path);
     }
+
+    std::string GetCacheStamp() const override
+    {
+        return _path + "|" + std::to_string(File::GetSize(_path)) + "|" + std::to_string(File::GetLastModified(_path));
+    }
 };
 
 class ReadObjectContext : public IReadObjectContext
@@ -117,6 +134,7 @@ private:
     const IFileDataRetriever* _fileDataRetriever;
 
     std::string _identifier;
+    std::string _imageCacheKey;
     bool _loadImages;
     std::string _basePath;
     bool _wasVerbose = false;
@@ -162,6 +180,16 @@ public:
         return _loadImages;
     }
 
+    std::string_view GetImageCacheKey() override
+    {
+        return _imageCacheKey;
+    }
+
+    void SetImageCacheKey(std::string&& key)
+    {
+        _imageCacheKey = std::move(key);
+    }
+
     std::vector<uint8_t> GetData(std::string_view path) override
     {
         if (_fileDataRetriever != nullptr)
@@ -569,6 +597,14 @@ namespace ObjectFactory
             result->SetDescriptor(descriptor);
             result->MarkAsJsonObject();
             auto readContext = ReadObjectContext(objectRepository, id, loadImageTable, fileRetriever);
+            if (loadImageTable && fileRetriever != nullptr && gConfigGeneral.SharedImageCache)
+            {
+                auto cacheStamp = fileRetriever->GetCacheStamp();
+                if (!cacheStamp.empty())
+                {
+                    readContext.SetImageCacheKey(id + "|" + VersionString(version) + "|" + cacheStamp);
+                }
+            }
             result->ReadJson(&readContext, jRoot);
             if (readContext.WasError())
             {
@@ -13,8 +13,11 @@
 #include "../ParkImporter.h"
 #include "../audio/audio.h"
 #include "../core/Console.hpp"
+#include "../core/JobPool.h"
 #include "../core/Memory.hpp"
+#include "../interface/Viewport.h"
 #include "../localisation/StringIds.h"
+#include "../paint/Paint.TileCache.h"
 #include "../ride/Ride.h"
 #include "../ride/RideAudio.h"
 #include "../util/Util.h"
@@ -31,9 +34,9 @@
 
 #include <algorithm>
 #include <array>
+#include <future>
 #include <memory>
-#include <mutex>
-#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
 /**
@@ -58,16 +61,28 @@ private:
     // Used to return a safe empty vector back from GetAllRideEntries, can be removed when std::span is available
     std::vector<ObjectEntryIndex> _nullRideTypeEntries;
 
+    std::unique_ptr<JobPool> _loadJobs;
+
+    // Objects read ahead of time by PreloadObjects, keyed by their file as the repository may change while they are
+    // being read. The next LoadObjects takes over the ones it needs and drops the rest.
+    using PreloadedObjects = std::unordered_map<std::string, std::unique_ptr<Object>>;
+    PreloadedObjects _preloadedObjects;
+    std::future<PreloadedObjects> _preloadJob;
+
 public:
     explicit ObjectManager(IObjectRepository& objectRepository)
         : _objectRepository(objectRepository)
     {
+        // The preload reads from the repository on another thread
+        _objectRepository.SetBeforeChangeCallback([this]() { FinishPreload(); });
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
     }
 
     ~ObjectManager() override
     {
+        _objectRepository.SetBeforeChangeCallback(nullptr);
+        CancelPreload();
         UnloadAll();
     }
 
@@ -192,6 +207,63 @@ public:
         // Update indices.
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        PaintTileCacheInvalidate();
+        ViewportFarZoomCacheInvalidate();
+    }
+
+    void PreloadObjects(const ObjectList& objectList) override
+    {
+        FinishPreload();
+
+        std::vector<ObjectToLoad> requiredObjects;
+        try
+        {
+            requiredObjects = GetRequiredObjects(objectList);
+        }
+        catch (const ObjectLoadException&)
+        {
+            // Reported again by the LoadObjects that follows
+            return;
+        }
+
+        // The background thread works on copies of the repository items, it only needs to know where to read from
+        std::vector<ObjectRepositoryItem> itemsToLoad;
+        for (const auto& requiredObject : requiredObjects)
+        {
+            const auto* repositoryItem = requiredObject.RepositoryItem;
+            if (repositoryItem == nullptr || repositoryItem->LoadedObject != nullptr
+                || _preloadedObjects.count(repositoryItem->Path) != 0)
+                continue;
+
+            auto& item = itemsToLoad.emplace_back(*repositoryItem);
+            item.LoadedObject = nullptr;
+        }
+        if (itemsToLoad.empty())
+            return;
+
+        _preloadJob = std::async(std::launch::async, [this, itemsToLoad = std::move(itemsToLoad)]() {
+            PreloadedObjects result;
+            for (const auto& item : itemsToLoad)
+            {
+                try
+                {
+                    result.emplace(item.Path, _objectRepository.LoadObject(&item));
+                }
+                catch (const std::exception& e)
+                {
+                    LOG_ERROR("Unable to preload object: %s", e.what());
+                }
+            }
+            return result;
+        });
+    }
+
+    void CancelPreload() override
+    {
+        if (_preloadJob.valid())
+            _preloadJob.wait();
+        _preloadJob = {};
+        _preloadedObjects.clear();
     }
 
     void UnloadObjects(const std::vector<ObjectEntryDescriptor>& entries) override
@@ -219,6 +291,8 @@ public:
         {
             UpdateSceneryGroupIndexes();
             ResetTypeToRideEntryIndexMap();
+            PaintTileCacheInvalidate();
+            ViewportFarZoomCacheInvalidate();
         }
     }
 
@@ -247,6 +321,8 @@ public:
         }
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        PaintTileCacheInvalidate();
+        ViewportFarZoomCacheInvalidate();
 
         // We will need to replay the title music if the title music object got reloaded
         OpenRCT2::Audio::StopTitleMusic();
@@ -325,6 +401,8 @@ private:
         }
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        PaintTileCacheInvalidate();
+        ViewportFarZoomCacheInvalidate();
     }
 
     Object* LoadObject(ObjectEntryIndex slot, std::string_view identifier)
@@ -370,6 +448,8 @@ private:
                 list[*slot] = object;
                 UpdateSceneryGroupIndexes();
                 ResetTypeToRideEntryIndexMap();
+                PaintTileCacheInvalidate();
+                ViewportFarZoomCacheInvalidate();
             }
         }
         return loadedObject;
@@ -554,30 +634,6 @@ private:
         return requiredObjects;
     }
 
-    template<typename T, typename TFunc> static void ParallelFor(const std::vector<T>& items, TFunc func)
-    {
-        auto partitions = std::thread::hardware_concurrency();
-        auto partitionSize = (items.size() + (partitions - 1)) / partitions;
-        std::vector<std::thread> threads;
-        for (size_t n = 0; n < partitions; n++)
-        {
-            auto begin = n * partitionSize;
-            auto end = std::min(items.size(), begin + partitionSize);
-            threads.emplace_back(
-                [func](size_t pbegin, size_t pend) {
-                    for (size_t i = pbegin; i < pend; i++)
-                    {
-                        func(i);
-                    }
-                },
-                begin, end);
-        }
-        for (auto& t : threads)
-        {
-            t.join();
-        }
-    }
-
     void LoadObjects(std::vector<ObjectToLoad>& requiredObjects)
     {
         std::vector<Object*> objects;
@@ -602,19 +658,58 @@ private:
         }
 
         // De-duplicate the list, since loading happens in parallel we can't have it race the repository item.
-        std::sort(objectsToLoad.begin(), objectsToLoad.end());
-        objectsToLoad.erase(std::unique(objectsToLoad.begin(), objectsToLoad.end()), objectsToLoad.end());
+        // The order of the required objects is kept so that objects are always published and loaded the same way.
+        std::unordered_set<const ObjectRepositoryItem*> seenItems;
+        objectsToLoad.erase(
+            std::remove_if(
+                objectsToLoad.begin(), objectsToLoad.end(),
+                [&seenItems](const ObjectRepositoryItem* item) { return !seenItems.insert(item).second; }),
+            objectsToLoad.end());
+
+        // Take over what was preloaded, whatever is left over was meant for a different list.
+        std::vector<std::unique_ptr<Object>> loadResults(objectsToLoad.size());
+        FinishPreload();
+        if (!_preloadedObjects.empty())
+        {
+            for (size_t i = 0; i < objectsToLoad.size(); i++)
+            {
+                auto it = _preloadedObjects.find(objectsToLoad[i]->Path);
+                if (it != _preloadedObjects.end())
+                {
+                    loadResults[i] = std::move(it->second);
+                }
+            }
+            _preloadedObjects.clear();
+        }
 
-        // Load the objects.
-        std::mutex commonMutex;
-        ParallelFor(objectsToLoad, [&](size_t i) {
-            const auto* requiredObject = objectsToLoad[i];
+        // Read, parse and decode the remaining objects in parallel, each result only ever touches its own slot.
+        if (_loadJobs == nullptr)
+        {
+            _loadJobs = std::make_unique<JobPool>();
+        }
+        _loadJobs->ParallelFor(0, objectsToLoad.size(), 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+            {
+                if (loadResults[i] != nullptr)
+                    continue;
 
-            // Object requires to be loaded, if the object successfully loads it will register it
-            // as a loaded object otherwise placed into the badObjects list.
-            auto newObject = _objectRepository.LoadObject(requiredObject);
+                try
+                {
+                    loadResults[i] = _objectRepository.LoadObject(objectsToLoad[i]);
+                }
+                catch (const std::exception& e)
+                {
+                    LOG_ERROR("Unable to load object: %s", e.what());
+                }
+            }
+        });
 
-            std::lock_guard<std::mutex> guard(commonMutex);
+        // Publish the results in order, if the object successfully loaded it will be registered
+        // as a loaded object otherwise placed into the badObjects list.
+        for (size_t i = 0; i < objectsToLoad.size(); i++)
+        {
+            const auto* requiredObject = objectsToLoad[i];
+            auto& newObject = loadResults[i];
             if (newObject == nullptr)
             {
                 badObjects.push_back(ObjectEntryDescriptor(requiredObject->ObjectEntry));
@@ -626,7 +721,7 @@ private:
                 // Connect the ori to the registered object
                 _objectRepository.RegisterLoadedObject(requiredObject, std::move(newObject));
             }
-        });
+        }
 
         // Assign the loaded objects to the required objects
         for (auto& requiredObject : requiredObjects)
@@ -746,6 +841,19 @@ private:
         }
     }
 
+    // Waits for a running preload and keeps its objects for the next LoadObjects.
+    void FinishPreload()
+    {
+        if (!_preloadJob.valid())
+            return;
+
+        auto preloaded = _preloadJob.get();
+        for (auto& [path, object] : preloaded)
+        {
+            _preloadedObjects.insert_or_assign(path, std::move(object));
+        }
+    }
+
     static void ReportMissingObject(const ObjectEntryDescriptor& entry)
     {
         std::string name(entry.GetName());
@@ -772,6 +880,25 @@ Object* ObjectManagerGetLoadedObject(const ObjectEntryDescriptor& entry)
     return loadedObject;
 }
 
+size_t ObjectManagerGetImageMemoryUsage()
+{
+    auto& objectManager = OpenRCT2::GetContext()->GetObjectManager();
+    size_t bytes = 0;
+    for (auto objectType : ObjectTypes)
+    {
+        const auto limit = GetObjectTypeLimit(objectType);
+        for (size_t i = 0; i < limit; i++)
+        {
+            const auto* loadedObject = objectManager.GetLoadedObject(objectType, i);
+            if (loadedObject != nullptr)
+            {
+                bytes += loadedObject->GetImageTable().GetMemoryUsage();
+            }
+        }
+    }
+    return bytes;
+}
+
 ObjectEntryIndex ObjectManagerGetLoadedObjectEntryIndex(const Object* loadedObject)
 {
     auto& objectManager = OpenRCT2::GetContext()->GetObjectManager();
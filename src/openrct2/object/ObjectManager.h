@@ -38,6 +38,11 @@ struct IObjectManager
     virtual Object* LoadObject(const ObjectEntryDescriptor& descriptor) abstract;
     virtual Object* LoadObject(const ObjectEntryDescriptor& descriptor, ObjectEntryIndex slot) abstract;
     virtual void LoadObjects(const ObjectList& entries) abstract;
+    // Starts reading and decoding the objects of the list that are not loaded yet on a background thread, so a later
+    // LoadObjects with the same list only has to register them.
+    virtual void PreloadObjects(const ObjectList& entries) abstract;
+    // Waits for a running preload and drops everything it has read.
+    virtual void CancelPreload() abstract;
     virtual void UnloadObjects(const std::vector<ObjectEntryDescriptor>& entries) abstract;
     virtual void UnloadAllTransient() abstract;
     virtual void UnloadAll() abstract;
@@ -56,4 +61,6 @@ struct IObjectManager
 Object* ObjectManagerLoadObject(const RCTObjectEntry* entry);
 void ObjectManagerUnloadObjects(const std::vector<ObjectEntryDescriptor>& entries);
 void ObjectManagerUnloadAllObjects();
+// Bytes used by the image tables of all loaded objects.
+[[nodiscard]] size_t ObjectManagerGetImageMemoryUsage();
 [[nodiscard]] StringId ObjectManagerGetSourceGameString(const ObjectSourceGame sourceGame);
@@ -42,6 +42,7 @@
 #include "RideObject.h"
 
 #include <algorithm>
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -183,6 +184,7 @@ class ObjectRepository final : public IObjectRepository
     std::vector<ObjectRepositoryItem> _items;
     ObjectIdentifierMap _newItemMap;
     ObjectEntryMap _itemMap;
+    std::function<void()> _beforeChange;
 
 public:
     explicit ObjectRepository(const std::shared_ptr<IPlatformEnvironment>& env)
@@ -198,6 +200,7 @@ public:
 
     void LoadOrConstruct(int32_t language) override
     {
+        OnBeforeChange();
         ClearItems();
         auto items = _fileIndex.LoadOrBuild(language);
         AddItems(items);
@@ -206,6 +209,7 @@ public:
 
     void Construct(int32_t language) override
     {
+        OnBeforeChange();
         auto items = _fileIndex.Rebuild(language);
         AddItems(items);
         SortItems();
@@ -298,6 +302,7 @@ public:
 
     void AddObject(const RCTObjectEntry* objectEntry, const void* data, size_t dataSize) override
     {
+        OnBeforeChange();
         utf8 objectName[9];
         ObjectEntryGetNameFixed(objectName, sizeof(objectName), objectEntry);
 
@@ -325,6 +330,7 @@ public:
 
     void AddObjectFromFile(ObjectGeneration generation, std::string_view objectName, const void* data, size_t dataSize) override
     {
+        OnBeforeChange();
         LOG_VERBOSE("Adding object: [%s]", std::string(objectName).c_str());
         auto path = GetPathForNewObject(generation, objectName);
         try
@@ -356,7 +362,18 @@ public:
         }
     }
 
+    void SetBeforeChangeCallback(std::function<void()> callback) override
+    {
+        _beforeChange = std::move(callback);
+    }
+
 private:
+    void OnBeforeChange()
+    {
+        if (_beforeChange != nullptr)
+            _beforeChange();
+    }
+
     void ClearItems()
     {
         _items.clear();
@@ -13,6 +13,7 @@
 #include "../object/Object.h"
 #include "RideObject.h"
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -99,6 +100,9 @@ struct IObjectRepository
         ObjectGeneration generation, std::string_view objectName, const void* data, size_t dataSize) abstract;
 
     virtual void ExportPackedObject(OpenRCT2::IStream* stream) abstract;
+
+    // Called before the repository adds, removes or rescans items, so readers on other threads can be waited for.
+    virtual void SetBeforeChangeCallback(std::function<void()> callback) abstract;
 };
 
 [[nodiscard]] std::unique_ptr<IObjectRepository> CreateObjectRepository(
@@ -333,6 +333,7 @@ void RideObject::Load()
                 carEntry.peep_loading_waypoints = std::move(_peepLoadingWaypoints[i]);
             }
         }
+        CarEntryBuildSpriteOffsets(carEntry);
     }
 }
 
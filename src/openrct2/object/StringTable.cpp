@@ -19,6 +19,9 @@
 #include "Object.h"
 
 #include <algorithm>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
 
 static constexpr uint8_t RCT2ToOpenRCT2LanguageId[] = {
     LANGUAGE_ENGLISH_UK,
@@ -37,6 +40,56 @@ static constexpr uint8_t RCT2ToOpenRCT2LanguageId[] = {
     LANGUAGE_PORTUGUESE_BR,
 };
 
+namespace
+{
+    // Objects are loaded on several threads at once, so the shared texts are guarded by a mutex. The texts are keyed by a
+    // view of themselves and a text removes itself once the last entry using it is gone.
+    struct InternedStrings
+    {
+        std::mutex Mutex;
+        std::unordered_map<std::string_view, std::weak_ptr<const std::string>> Strings;
+    };
+} // namespace
+
+static InternedStrings& GetInternedStrings()
+{
+    // Never destroyed, objects may still release their texts while the program exits
+    static auto* internedStrings = new InternedStrings();
+    return *internedStrings;
+}
+
+static std::shared_ptr<const std::string> InternString(std::string&& text)
+{
+    auto& interned = GetInternedStrings();
+    std::lock_guard<std::mutex> lock(interned.Mutex);
+    auto it = interned.Strings.find(text);
+    if (it != interned.Strings.end())
+    {
+        if (auto result = it->second.lock())
+        {
+            return result;
+        }
+
+        // The text is on its way out, its key has to go along with it
+        interned.Strings.erase(it);
+    }
+
+    auto result = std::shared_ptr<const std::string>(new std::string(std::move(text)), [](const std::string* str) {
+        {
+            auto& deleteInterned = GetInternedStrings();
+            std::lock_guard<std::mutex> deleteLock(deleteInterned.Mutex);
+            auto entry = deleteInterned.Strings.find(*str);
+            if (entry != deleteInterned.Strings.end() && entry->first.data() == str->data())
+            {
+                deleteInterned.Strings.erase(entry);
+            }
+        }
+        delete str;
+    });
+    interned.Strings.emplace(*result, result);
+    return result;
+}
+
 static bool StringIsBlank(const utf8* str)
 {
     for (auto ch = str; *ch != '\0'; ch++)
@@ -68,7 +121,7 @@ void StringTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream, O
                 StringTableEntry entry{};
                 entry.Id = id;
                 entry.LanguageId = languageId;
-                entry.Text = std::move(stringAsUtf8);
+                entry.Text = InternString(std::move(stringAsUtf8));
                 _strings.push_back(std::move(entry));
             }
         }
@@ -126,7 +179,7 @@ std::string StringTable::GetString(ObjectStringID id) const
     {
         if (string.Id == id)
         {
-            return string.Text;
+            return *string.Text;
         }
     }
     return std::string();
@@ -138,7 +191,7 @@ std::string StringTable::GetString(uint8_t language, ObjectStringID id) const
     {
         if (string.LanguageId == language && string.Id == id)
         {
-            return string.Text;
+            return *string.Text;
         }
     }
     return std::string();
@@ -149,7 +202,7 @@ void StringTable::SetString(ObjectStringID id, uint8_t language, const std::stri
     StringTableEntry entry;
     entry.Id = id;
     entry.LanguageId = language;
-    entry.Text = text;
+    entry.Text = InternString(std::string(text));
     _strings.push_back(std::move(entry));
 }
 
@@ -161,7 +214,7 @@ void StringTable::Sort()
         {
             if (a.LanguageId == b.LanguageId)
             {
-                return String::Compare(a.Text, b.Text, true) < 0;
+                return String::Compare(*a.Text, *b.Text, true) < 0;
             }
 
             for (const auto& language : languageOrder)
@@ -13,6 +13,7 @@
 #include "../core/JsonFwd.hpp"
 #include "../localisation/Language.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -38,7 +39,8 @@ struct StringTableEntry
 {
     ObjectStringID Id = ObjectStringID::UNKNOWN;
     uint8_t LanguageId = LANGUAGE_UNDEFINED;
-    std::string Text;
+    // Shared by all entries with the same text, many objects repeat the same names and descriptions
+    std::shared_ptr<const std::string> Text;
 };
 
 class StringTable
@@ -30,6 +30,32 @@
 #include "../world/Park.h"
 #include "Paint.h"
 
+// How far an entity's sprite can reach from its position on screen: the sprite extents are stored in a byte, plus a
+// little for the positions in between ticks.
+static constexpr int32_t kEntitySpriteReach = 256 + 16;
+
+/**
+ * Tests the whole tile against the view before visiting its entities. Tiles are visited for every paint column and for
+ * many rows below the view to catch tall sprites, most of them can not show any of their entities.
+ */
+static bool EntityTileMayBeVisible(const PaintSession& session, const CoordsXY& pos)
+{
+    int32_t minZ;
+    int32_t maxZ;
+    if (!GetEntityTileHeights(pos, minZ, maxZ))
+        return false;
+
+    // Within a tile the screen position moves by up to 32 pixels horizontally and 16 vertically from the centre
+    const auto centre = Translate3DTo2DWithZ(session.CurrentRotation, CoordsXYZ{ pos.ToTileCentre(), 0 });
+    const int32_t top = centre.y - 16 - maxZ - kEntitySpriteReach;
+    const int32_t bottom = centre.y + 16 - minZ + kEntitySpriteReach;
+    const int32_t left = centre.x - 32 - kEntitySpriteReach;
+    const int32_t right = centre.x + 32 + kEntitySpriteReach;
+
+    const auto& dpi = session.DPI;
+    return top < dpi.y + dpi.height && bottom > dpi.y && left < dpi.x + dpi.width && right > dpi.x;
+}
+
 /**
  * Paint Quadrant
  *  rct2: 0x0069E8B0
@@ -52,6 +78,11 @@ void EntityPaintSetup(PaintSession& session, const CoordsXY& pos)
         return;
     }
 
+    if (!EntityTileMayBeVisible(session, pos))
+    {
+        return;
+    }
+
     const bool highlightPathIssues = (session.ViewFlags & VIEWPORT_FLAG_HIGHLIGHT_PATH_ISSUES);
 
     for (auto* spr : EntityTileList(pos))
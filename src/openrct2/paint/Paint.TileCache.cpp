@@ -0,0 +1,508 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Paint.TileCache.h"
+
+#include "../OpenRCT2.h"
+#include "../config/Config.h"
+#include "../entity/PatrolArea.h"
+#include "../interface/Viewport.h"
+#include "../object/SmallSceneryEntry.h"
+#include "../object/WallSceneryEntry.h"
+#include "../ride/TrackDesign.h"
+#include "../world/Banner.h"
+#include "../world/Map.h"
+#include "Paint.SessionFlags.h"
+#include "Paint.h"
+#include "tile_element/Paint.TileElement.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// The cache stores the paint calls made for the elements of a tile and plays them back on later frames, as long as the
+// tile and its neighbours are unchanged. Painting a tile is a function of the tile elements, the surfaces around it and
+// the view settings in the key, anything animated or relying on other global state is simply never cached. The calls
+// are played back through the regular paint functions so culling and child/attach chaining behave exactly as if the
+// painters had run again.
+
+struct PaintTileCacheCommand
+{
+    PaintTileCacheCommandType Type;
+    ImageId Image;
+    ImageId ColourImage;
+    CoordsXYZ Offset;
+    BoundBoxXYZ BoundBox;
+    CoordsXY SpritePosition;
+    CoordsXY MapPosition;
+    ViewportInteractionItem InteractionType;
+    int16_t ElementIndex;
+};
+
+// Element pointers are stored as index into the tile, the tile elements may be moved around without changing.
+static constexpr int16_t kPaintTileCacheNoElement = -1;
+static constexpr int16_t kPaintTileCacheUnchangedElement = -2;
+
+// Session state left behind by the painters that is not reproduced by playing back the paint calls.
+struct PaintTileCacheEndState
+{
+    CoordsXY SpritePosition;
+    CoordsXY MapPosition;
+    std::array<SupportHeight, 9> SupportSegments;
+    SupportHeight Support;
+    uint16_t WaterHeight;
+    uint8_t Flags;
+    ViewportInteractionItem InteractionType;
+    int16_t CurrentlyDrawnElement;
+    int16_t Surface;
+    int16_t PathElementOnSameHeight;
+    int16_t TrackElementOnSameHeight;
+};
+
+struct PaintTileCacheKey
+{
+    uint32_t ViewFlags;
+    ZoomLevel Zoom;
+    uint8_t Rotation;
+    uint8_t Settings;
+
+    bool operator==(const PaintTileCacheKey& rhs) const
+    {
+        return ViewFlags == rhs.ViewFlags && Zoom == rhs.Zoom && Rotation == rhs.Rotation && Settings == rhs.Settings;
+    }
+};
+
+// Surface painting looks at the surrounding tiles to draw edges.
+static constexpr std::array<TileCoordsXY, 8> kPaintTileCacheNeighbours = {
+    TileCoordsXY{ -1, -1 }, TileCoordsXY{ 0, -1 }, TileCoordsXY{ 1, -1 }, TileCoordsXY{ -1, 0 },
+    TileCoordsXY{ 1, 0 },   TileCoordsXY{ -1, 1 }, TileCoordsXY{ 0, 1 },  TileCoordsXY{ 1, 1 },
+};
+
+struct PaintTileCacheEntry
+{
+    PaintTileCacheKey Key;
+    std::vector<TileElement> Elements;
+    std::array<TileElement, kPaintTileCacheNeighbours.size()> Neighbours;
+    uint8_t NeighbourMask;
+    std::vector<PaintTileCacheCommand> Commands;
+    PaintTileCacheEndState EndState;
+};
+
+struct PaintTileCacheRecording
+{
+    PaintTileCacheKey Key;
+    const TileElement* FirstElement;
+    size_t NumElements;
+    bool Valid;
+    std::vector<PaintTileCacheCommand> Commands;
+    // Used to tell whether a painter changed any of these directly.
+    PaintStruct* LastPS;
+    AttachedPaintStruct* LastAttachedPS;
+    PaintStruct* WoodenSupportsPrependTo;
+    const SurfaceElement* Surface;
+    const TileElement* CurrentlyDrawnTileElement;
+};
+
+// Every viewport looking at a tile shares its entries. Viewports with a different zoom, rotation or view flags need
+// their own entry, a tile keeps a few of them so that e.g. the main view and a ride window following a vehicle at
+// another zoom level do not keep replacing each other's recordings. The oldest entry of a tile is replaced first.
+static constexpr size_t kPaintTileCacheMaxTileEntries = 4;
+
+struct PaintTileCacheTile
+{
+    std::vector<PaintTileCacheEntry> Entries;
+};
+
+// Columns are painted in parallel, so the entries are spread over a number of independently locked shards.
+static constexpr size_t kPaintTileCacheShards = 64;
+static constexpr size_t kPaintTileCacheMaxShardEntries = 4096;
+
+struct PaintTileCacheShard
+{
+    std::mutex Mutex;
+    std::unordered_map<uint32_t, PaintTileCacheTile> Tiles;
+    size_t NumEntries{};
+};
+
+static std::array<PaintTileCacheShard, kPaintTileCacheShards> _paintTileCacheShards;
+static thread_local PaintTileCacheRecording _paintTileCacheRecording;
+
+static constexpr uint32_t kPaintTileCacheUnsupportedViewFlags = VIEWPORT_FLAG_CLIP_VIEW | VIEWPORT_FLAG_LAND_OWNERSHIP
+    | VIEWPORT_FLAG_LAND_HEIGHTS | VIEWPORT_FLAG_TRACK_HEIGHTS | VIEWPORT_FLAG_PATH_HEIGHTS;
+
+void PaintTileCacheInvalidate()
+{
+    for (auto& shard : _paintTileCacheShards)
+    {
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        shard.Tiles.clear();
+        shard.NumEntries = 0;
+    }
+}
+
+bool PaintCacheIsAllowed(uint32_t viewFlags)
+{
+    if (!gConfigGeneral.TilePaintCache)
+        return false;
+    if (viewFlags & kPaintTileCacheUnsupportedViewFlags)
+        return false;
+    if (gMapSelectFlags & (MAP_SELECT_FLAG_ENABLE | MAP_SELECT_FLAG_ENABLE_CONSTRUCT))
+        return false;
+    if (gScreenFlags & (SCREEN_FLAGS_TRACK_DESIGNER | SCREEN_FLAGS_TRACK_MANAGER))
+        return false;
+    if (gPaintWidePathsAsGhost || gShowSupportSegmentHeights)
+        return false;
+    // Both count the sprites as they are drawn, which a cached far zoom chunk skips
+    if (gPaintStatistics || gPaintOverdrawHeatmap)
+        return false;
+    if (gTrackDesignSaveMode)
+        return false;
+
+    auto patrolAreaToRender = GetPatrolAreaToRender();
+    const auto* staffId = std::get_if<EntityId>(&patrolAreaToRender);
+    return staffId != nullptr && staffId->IsNull();
+}
+
+static bool PaintTileCacheIsUsable(const PaintSession& session)
+{
+    if (session.Flags & PaintSessionFlags::IsTrackPiecePreview)
+        return false;
+    if (session.SelectedElement != nullptr)
+        return false;
+    return PaintCacheIsAllowed(session.ViewFlags);
+}
+
+uint8_t PaintCacheGetSettings()
+{
+    uint8_t settings = 0;
+    if (gConfigGeneral.LandscapeSmoothing)
+        settings |= (1u << 0);
+    if (gPaintBlockedTiles)
+        settings |= (1u << 1);
+    return settings;
+}
+
+static PaintTileCacheKey PaintTileCacheGetKey(const PaintSession& session)
+{
+    return { session.ViewFlags, session.DPI.zoom_level, session.CurrentRotation, PaintCacheGetSettings() };
+}
+
+static uint32_t PaintTileCacheGetTileIndex(const CoordsXY& mapPosition)
+{
+    const auto tilePos = TileCoordsXY(mapPosition);
+    return (tilePos.y * kMaximumMapSizeTechnical) + tilePos.x;
+}
+
+static bool PaintTileCacheIsElementSupported(const TileElement& element)
+{
+    switch (element.GetType())
+    {
+        case TileElementType::Surface:
+            return true;
+        case TileElementType::Path:
+            // Queues show the ride status and scroll their banners.
+            return !element.AsPath()->IsQueue();
+        case TileElementType::SmallScenery:
+        {
+            const auto* entry = element.AsSmallScenery()->GetEntry();
+            return entry != nullptr && !entry->HasFlag(SMALL_SCENERY_FLAG_ANIMATED);
+        }
+        case TileElementType::Wall:
+        {
+            const auto* entry = element.AsWall()->GetEntry();
+            return entry != nullptr && !(entry->flags2 & WALL_SCENERY_2_ANIMATED)
+                && entry->scrolling_mode == SCROLLING_MODE_NONE;
+        }
+        default:
+            return false;
+    }
+}
+
+static uint8_t PaintTileCacheGetNeighbours(
+    const CoordsXY& mapPosition, std::array<TileElement, kPaintTileCacheNeighbours.size()>& neighbours)
+{
+    uint8_t mask = 0;
+    for (size_t i = 0; i < kPaintTileCacheNeighbours.size(); i++)
+    {
+        const auto position = mapPosition + kPaintTileCacheNeighbours[i].ToCoordsXY();
+        if (!MapIsLocationValid(position))
+            continue;
+
+        const auto* surfaceElement = MapGetSurfaceElementAt(position);
+        if (surfaceElement == nullptr)
+            continue;
+
+        neighbours[i] = *reinterpret_cast<const TileElement*>(surfaceElement);
+        mask |= (1u << i);
+    }
+    return mask;
+}
+
+static size_t PaintTileCacheCountElements(const TileElement* firstElement)
+{
+    const auto* element = firstElement;
+    while (!(element++)->IsLastForTile())
+    {
+    }
+    return element - firstElement;
+}
+
+static int16_t PaintTileCacheGetElementIndex(const PaintTileCacheRecording& recording, const TileElement* element)
+{
+    if (element == nullptr)
+        return kPaintTileCacheNoElement;
+    if (element < recording.FirstElement || element >= recording.FirstElement + recording.NumElements)
+        return kPaintTileCacheUnchangedElement;
+    return static_cast<int16_t>(element - recording.FirstElement);
+}
+
+static const TileElement* PaintTileCacheGetElement(const TileElement* firstElement, int16_t index)
+{
+    return index == kPaintTileCacheNoElement ? nullptr : firstElement + index;
+}
+
+static PaintTileCacheResult PaintTileCacheExecute(PaintSession& session, const PaintTileCacheCommand& command)
+{
+    switch (command.Type)
+    {
+        case PaintTileCacheCommandType::Parent:
+            return { PaintAddImageAsParent(session, command.Image, command.Offset, command.BoundBox), true };
+        case PaintTileCacheCommandType::ParentKeepLast:
+            return { PaintAddImageAsParentKeepLast(session, command.Image, command.Offset, command.BoundBox), true };
+        case PaintTileCacheCommandType::Child:
+            return { PaintAddImageAsChild(session, command.Image, command.Offset, command.BoundBox), true };
+        case PaintTileCacheCommandType::AttachToPreviousPS:
+            return { nullptr, PaintAttachToPreviousPS(session, command.Image, command.Offset.x, command.Offset.y) };
+        case PaintTileCacheCommandType::AttachToPreviousPSMasked:
+            return { nullptr,
+                     PaintAttachToPreviousPSMasked(
+                         session, command.Image, command.ColourImage, command.Offset.x, command.Offset.y) };
+        case PaintTileCacheCommandType::AttachToPreviousAttach:
+            return { nullptr, PaintAttachToPreviousAttach(session, command.Image, command.Offset.x, command.Offset.y) };
+    }
+    return { nullptr, false };
+}
+
+bool PaintTileCacheReplay(PaintSession& session, const TileElement* firstElement)
+{
+    if (!PaintTileCacheIsUsable(session))
+        return false;
+
+    const auto key = PaintTileCacheGetKey(session);
+    const auto tileIndex = PaintTileCacheGetTileIndex(session.MapPosition);
+    auto& shard = _paintTileCacheShards[tileIndex % kPaintTileCacheShards];
+
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    auto it = shard.Tiles.find(tileIndex);
+    if (it == shard.Tiles.end())
+        return false;
+
+    const auto& tileEntries = it->second.Entries;
+    auto entryIt = std::find_if(
+        tileEntries.begin(), tileEntries.end(), [&key](const PaintTileCacheEntry& e) { return e.Key == key; });
+    if (entryIt == tileEntries.end())
+        return false;
+
+    const auto& entry = *entryIt;
+
+    const auto numElements = PaintTileCacheCountElements(firstElement);
+    if (numElements != entry.Elements.size()
+        || std::memcmp(entry.Elements.data(), firstElement, numElements * sizeof(TileElement)) != 0)
+        return false;
+
+    std::array<TileElement, kPaintTileCacheNeighbours.size()> neighbours;
+    const auto neighbourMask = PaintTileCacheGetNeighbours(session.MapPosition, neighbours);
+    if (neighbourMask != entry.NeighbourMask)
+        return false;
+    for (size_t i = 0; i < neighbours.size(); i++)
+    {
+        if ((neighbourMask & (1u << i)) && std::memcmp(&neighbours[i], &entry.Neighbours[i], sizeof(TileElement)) != 0)
+            return false;
+    }
+
+    for (const auto& command : entry.Commands)
+    {
+        session.SpritePosition = command.SpritePosition;
+        session.MapPosition = command.MapPosition;
+        session.InteractionType = command.InteractionType;
+        session.CurrentlyDrawnTileElement = const_cast<TileElement*>(
+            PaintTileCacheGetElement(firstElement, command.ElementIndex));
+        PaintTileCacheExecute(session, command);
+    }
+
+    const auto& endState = entry.EndState;
+    session.SpritePosition = endState.SpritePosition;
+    session.MapPosition = endState.MapPosition;
+    std::copy(endState.SupportSegments.begin(), endState.SupportSegments.end(), std::begin(session.SupportSegments));
+    session.Support = endState.Support;
+    session.WaterHeight = endState.WaterHeight;
+    session.Flags = endState.Flags;
+    session.InteractionType = endState.InteractionType;
+    if (endState.CurrentlyDrawnElement != kPaintTileCacheUnchangedElement)
+    {
+        session.CurrentlyDrawnTileElement = const_cast<TileElement*>(
+            PaintTileCacheGetElement(firstElement, endState.CurrentlyDrawnElement));
+    }
+    if (endState.Surface != kPaintTileCacheUnchangedElement)
+    {
+        session.Surface = PaintTileCacheGetElement(firstElement, endState.Surface)->AsSurface();
+    }
+    session.PathElementOnSameHeight = PaintTileCacheGetElement(firstElement, endState.PathElementOnSameHeight);
+    session.TrackElementOnSameHeight = PaintTileCacheGetElement(firstElement, endState.TrackElementOnSameHeight);
+    return true;
+}
+
+bool PaintTileCacheBeginRecording(PaintSession& session, const TileElement* firstElement)
+{
+    if (!PaintTileCacheIsUsable(session))
+        return false;
+
+    const auto numElements = PaintTileCacheCountElements(firstElement);
+    for (size_t i = 0; i < numElements; i++)
+    {
+        if (!PaintTileCacheIsElementSupported(firstElement[i]))
+            return false;
+    }
+
+    auto& recording = _paintTileCacheRecording;
+    recording.Key = PaintTileCacheGetKey(session);
+    recording.FirstElement = firstElement;
+    recording.NumElements = numElements;
+    recording.Valid = true;
+    recording.Commands.clear();
+    recording.LastPS = session.LastPS;
+    recording.LastAttachedPS = session.LastAttachedPS;
+    recording.WoodenSupportsPrependTo = session.WoodenSupportsPrependTo;
+    recording.Surface = session.Surface;
+    recording.CurrentlyDrawnTileElement = session.CurrentlyDrawnTileElement;
+    session.TileCacheRecording = &recording;
+    return true;
+}
+
+static bool PaintTileCacheGetEndState(
+    const PaintTileCacheRecording& recording, const PaintSession& session, PaintTileCacheEndState& endState)
+{
+    // Tunnels are only pushed by track pieces, which are never cached.
+    if (session.LeftTunnelCount != 0 || session.RightTunnelCount != 0 || session.VerticalTunnelHeight != 0xFF)
+        return false;
+
+    endState.SpritePosition = session.SpritePosition;
+    endState.MapPosition = session.MapPosition;
+    std::copy(std::begin(session.SupportSegments), std::end(session.SupportSegments), endState.SupportSegments.begin());
+    endState.Support = session.Support;
+    endState.WaterHeight = session.WaterHeight;
+    endState.Flags = session.Flags;
+    endState.InteractionType = session.InteractionType;
+    endState.CurrentlyDrawnElement = PaintTileCacheGetElementIndex(recording, session.CurrentlyDrawnTileElement);
+    endState.Surface = session.Surface == recording.Surface
+        ? kPaintTileCacheUnchangedElement
+        : PaintTileCacheGetElementIndex(recording, reinterpret_cast<const TileElement*>(session.Surface));
+    endState.PathElementOnSameHeight = PaintTileCacheGetElementIndex(recording, session.PathElementOnSameHeight);
+    endState.TrackElementOnSameHeight = PaintTileCacheGetElementIndex(recording, session.TrackElementOnSameHeight);
+
+    // Only the surface and the currently drawn element may be left pointing outside of the tile, as they were before.
+    if (endState.CurrentlyDrawnElement == kPaintTileCacheUnchangedElement
+        && session.CurrentlyDrawnTileElement != recording.CurrentlyDrawnTileElement)
+        return false;
+    return endState.Surface != kPaintTileCacheNoElement
+        && endState.PathElementOnSameHeight != kPaintTileCacheUnchangedElement
+        && endState.TrackElementOnSameHeight != kPaintTileCacheUnchangedElement;
+}
+
+void PaintTileCacheEndRecording(PaintSession& session)
+{
+    auto& recording = *session.TileCacheRecording;
+    session.TileCacheRecording = nullptr;
+
+    if (!recording.Valid || session.LastPS != recording.LastPS || session.LastAttachedPS != recording.LastAttachedPS
+        || session.WoodenSupportsPrependTo != recording.WoodenSupportsPrependTo)
+        return;
+
+    PaintTileCacheEntry entry;
+    if (!PaintTileCacheGetEndState(recording, session, entry.EndState))
+        return;
+
+    entry.Key = recording.Key;
+    entry.Elements.assign(recording.FirstElement, recording.FirstElement + recording.NumElements);
+    entry.NeighbourMask = PaintTileCacheGetNeighbours(session.MapPosition, entry.Neighbours);
+    entry.Commands = recording.Commands;
+
+    const auto tileIndex = PaintTileCacheGetTileIndex(session.MapPosition);
+    auto& shard = _paintTileCacheShards[tileIndex % kPaintTileCacheShards];
+
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    if (shard.NumEntries >= kPaintTileCacheMaxShardEntries)
+    {
+        shard.Tiles.clear();
+        shard.NumEntries = 0;
+    }
+
+    auto& tileEntries = shard.Tiles[tileIndex].Entries;
+    auto existing = std::find_if(
+        tileEntries.begin(), tileEntries.end(), [&entry](const PaintTileCacheEntry& e) { return e.Key == entry.Key; });
+    if (existing != tileEntries.end())
+    {
+        *existing = std::move(entry);
+        return;
+    }
+    if (tileEntries.size() >= kPaintTileCacheMaxTileEntries)
+    {
+        tileEntries.erase(tileEntries.begin());
+        shard.NumEntries--;
+    }
+    tileEntries.push_back(std::move(entry));
+    shard.NumEntries++;
+}
+
+PaintTileCacheResult PaintTileCacheRecord(
+    PaintSession& session, PaintTileCacheCommandType type, ImageId imageId, ImageId colourImageId, const CoordsXYZ& offset,
+    const BoundBoxXYZ& boundBox)
+{
+    auto& recording = *session.TileCacheRecording;
+
+    // Anything changed outside of the paint functions would not be played back.
+    if (session.LastPS != recording.LastPS || session.LastAttachedPS != recording.LastAttachedPS)
+    {
+        recording.Valid = false;
+    }
+
+    auto& command = recording.Commands.emplace_back();
+    command.Type = type;
+    command.Image = imageId;
+    command.ColourImage = colourImageId;
+    command.Offset = offset;
+    command.BoundBox = boundBox;
+    command.SpritePosition = session.SpritePosition;
+    command.MapPosition = session.MapPosition;
+    command.InteractionType = session.InteractionType;
+    command.ElementIndex = PaintTileCacheGetElementIndex(recording, session.CurrentlyDrawnTileElement);
+    if (command.ElementIndex == kPaintTileCacheUnchangedElement)
+    {
+        recording.Valid = false;
+    }
+
+    session.TileCacheRecording = nullptr;
+    const auto result = PaintTileCacheExecute(session, command);
+    session.TileCacheRecording = &recording;
+
+    recording.LastPS = session.LastPS;
+    recording.LastAttachedPS = session.LastAttachedPS;
+    return result;
+}
+
+void PaintTileCacheRecordUnsupported(PaintSession& session)
+{
+    if (session.TileCacheRecording != nullptr)
+    {
+        session.TileCacheRecording->Valid = false;
+    }
+}
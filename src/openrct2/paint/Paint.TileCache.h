@@ -0,0 +1,65 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../drawing/ImageId.hpp"
+#include "../world/Location.hpp"
+#include "Boundbox.h"
+
+#include <cstdint>
+
+struct PaintSession;
+struct PaintStruct;
+struct TileElement;
+
+enum class PaintTileCacheCommandType : uint8_t
+{
+    Parent,
+    ParentKeepLast,
+    Child,
+    AttachToPreviousPS,
+    AttachToPreviousPSMasked,
+    AttachToPreviousAttach,
+};
+
+struct PaintTileCacheResult
+{
+    PaintStruct* Struct;
+    bool Success;
+};
+
+void PaintTileCacheInvalidate();
+
+/**
+ * Whether painting with the given view flags only depends on the map and the settings returned by
+ * PaintCacheGetSettings, so previously painted output may be reused. False while anything is highlighted or
+ * overlaid on the map, e.g. a construction selection or a patrol area.
+ */
+bool PaintCacheIsAllowed(uint32_t viewFlags);
+uint8_t PaintCacheGetSettings();
+
+/**
+ * Paints the elements of the current tile from the cache, returns false if nothing usable is cached for the tile.
+ * @param firstElement The first element of the tile at session.MapPosition.
+ */
+bool PaintTileCacheReplay(PaintSession& session, const TileElement* firstElement);
+
+/**
+ * Starts recording the paint calls made for the elements of the current tile, returns false if the tile can not be
+ * cached. Every successful call must be matched by PaintTileCacheEndRecording once the elements are painted.
+ */
+bool PaintTileCacheBeginRecording(PaintSession& session, const TileElement* firstElement);
+void PaintTileCacheEndRecording(PaintSession& session);
+
+// Used by the paint functions while session.TileCacheRecording is set.
+PaintTileCacheResult PaintTileCacheRecord(
+    PaintSession& session, PaintTileCacheCommandType type, ImageId imageId, ImageId colourImageId, const CoordsXYZ& offset,
+    const BoundBoxXYZ& boundBox);
+void PaintTileCacheRecordUnsupported(PaintSession& session);
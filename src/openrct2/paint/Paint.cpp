@@ -22,10 +22,14 @@
 #include "../util/Math.hpp"
 #include "Boundbox.h"
 #include "Paint.Entity.h"
+#include "Paint.TileCache.h"
 #include "tile_element/Paint.TileElement.h"
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <limits>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -53,10 +57,107 @@ static constexpr uint8_t BoundBoxDebugColours[] = {
 bool gShowDirtyVisuals;
 bool gPaintBoundingBoxes;
 bool gPaintBlockedTiles;
+bool gPaintStatistics;
+bool gPaintOverdrawHeatmap;
+
+static void PaintAttachedPS(PaintSession& session, PaintStruct* ps);
+
+/**
+ * Counts a sprite that is about to be drawn for the paint statistics and the overdraw heatmap. Only the part of the
+ * sprite bounds inside the column is counted, in pixels of the zoomed view.
+ */
+static void PaintRecordSprite(PaintSession& session, const ImageId imageId, const ScreenCoordsXY& screenPos)
+{
+    if (!gPaintStatistics && !gPaintOverdrawHeatmap)
+        return;
+    if (!imageId.HasValue())
+        return;
+
+    const auto* g1 = GfxGetG1Element(imageId);
+    if (g1 == nullptr)
+        return;
+
+    const auto& dpi = session.DPI;
+    const auto spriteLeft = screenPos.x + g1->x_offset;
+    const auto spriteTop = screenPos.y + g1->y_offset;
+    const auto left = dpi.zoom_level.ApplyInversedTo(std::max(spriteLeft, dpi.x) - dpi.x);
+    const auto top = dpi.zoom_level.ApplyInversedTo(std::max(spriteTop, dpi.y) - dpi.y);
+    const auto right = dpi.zoom_level.ApplyInversedTo(std::min(spriteLeft + g1->width, dpi.x + dpi.width) - dpi.x);
+    const auto bottom = dpi.zoom_level.ApplyInversedTo(std::min(spriteTop + g1->height, dpi.y + dpi.height) - dpi.y);
+    if (left >= right || top >= bottom)
+        return;
+
+    session.Stats.SpritesDrawn++;
+    session.Stats.PixelsCovered += static_cast<uint64_t>(right - left) * (bottom - top);
+
+    if (session.Overdraw.empty())
+        return;
+
+    const auto columnWidth = dpi.zoom_level.ApplyInversedTo(dpi.width);
+    for (auto y = top; y < bottom; y++)
+    {
+        auto* counts = session.Overdraw.data() + y * columnWidth;
+        for (auto x = left; x < right; x++)
+        {
+            if (counts[x] != std::numeric_limits<uint8_t>::max())
+                counts[x]++;
+        }
+    }
+}
+
+void PaintOverdrawPrepare(PaintSession& session)
+{
+    if (!gPaintOverdrawHeatmap)
+    {
+        session.Overdraw.clear();
+        return;
+    }
+
+    const auto& dpi = session.DPI;
+    const auto columnWidth = dpi.zoom_level.ApplyInversedTo(dpi.width);
+    const auto columnHeight = dpi.zoom_level.ApplyInversedTo(dpi.height);
+    session.Overdraw.assign(static_cast<size_t>(std::max(columnWidth, 0)) * std::max(columnHeight, 0), 0);
+}
+
+void PaintDrawOverdrawHeatmap(PaintSession& session)
+{
+    // From a single sprite over the pixel to eight or more.
+    static constexpr colour_t kHeatmapColours[] = {
+        COLOUR_BLACK,         COLOUR_DARK_BLUE,  COLOUR_LIGHT_BLUE, COLOUR_DARK_GREEN, COLOUR_BRIGHT_GREEN,
+        COLOUR_BRIGHT_YELLOW, COLOUR_DARK_ORANGE, COLOUR_BRIGHT_RED, COLOUR_WHITE,
+    };
+
+    if (session.Overdraw.empty())
+        return;
+
+    const auto maxOverdraw = *std::max_element(session.Overdraw.begin(), session.Overdraw.end());
+    session.Stats.MaxOverdraw = std::max<uint32_t>(session.Stats.MaxOverdraw, maxOverdraw);
+
+    // The heatmap replaces the pixels, which only the software drawing engines give access to.
+    auto& dpi = session.DPI;
+    if (dpi.bits == nullptr)
+        return;
+
+    const auto columnWidth = dpi.zoom_level.ApplyInversedTo(dpi.width);
+    const auto columnHeight = dpi.zoom_level.ApplyInversedTo(dpi.height);
+    const auto stride = columnWidth + dpi.pitch;
+    for (int32_t y = 0; y < columnHeight; y++)
+    {
+        const auto* counts = session.Overdraw.data() + y * columnWidth;
+        auto* dst = dpi.bits + y * stride;
+        for (int32_t x = 0; x < columnWidth; x++)
+        {
+            const auto colour = kHeatmapColours[std::min<size_t>(counts[x], std::size(kHeatmapColours) - 1)];
+            dst[x] = ColourMapA[colour].mid_light;
+        }
+    }
+}
 
-static void PaintAttachedPS(DrawPixelInfo& dpi, PaintStruct* ps, uint32_t viewFlags);
 static void PaintPSImageWithBoundingBoxes(PaintSession& session, PaintStruct* ps, ImageId imageId, int32_t x, int32_t y);
 static ImageId PaintPSColourifyImage(const PaintStruct* ps, ImageId imageId, uint32_t viewFlags);
+static PaintStruct* PaintAddImageAsParentImpl(
+    PaintSession& session, const ImageId image_id, const CoordsXYZ& offset, const BoundBoxXYZ& boundBox);
+static bool PaintAttachToPreviousPSImpl(PaintSession& session, const ImageId image_id, int32_t x, int32_t y);
 
 static int32_t RemapPositionToQuadrant(const PaintStruct& ps, uint8_t rotation)
 {
@@ -243,6 +344,8 @@ template<uint8_t direction> void PaintSessionGenerateRotate(PaintSession& sessio
  */
 void PaintSessionGenerate(PaintSession& session)
 {
+    PROFILED_FUNCTION();
+
     switch (DirectionFlipXAxis(session.CurrentRotation))
     {
         case 0:
@@ -468,7 +571,7 @@ static void PaintStructsLinkQuadrants(PaintSessionCore& session, PaintStruct& ps
     } while (++quadrantIndex <= session.QuadrantFrontIndex);
 }
 
-template<int TRotation> static void PaintSessionArrangeImpl(PaintSessionCore& session)
+template<int TRotation> static void PaintSessionArrangeLinkedImpl(PaintSessionCore& session)
 {
     uint32_t quadrantIndex = session.QuadrantBackIndex;
     if (quadrantIndex == UINT32_MAX)
@@ -493,13 +596,200 @@ template<int TRotation> static void PaintSessionArrangeImpl(PaintSessionCore& se
     session.PaintHead = psHead.NextQuadrantEntry;
 }
 
+// The contiguous backend runs the exact same sort as the linked one above, but on a compact copy of the sort relevant
+// fields where the links are indices. Crowded quadrants are walked many times and touching the full paint structs
+// scattered over the paint entry pool each time is what makes the linked version slow.
+struct PaintSortNode
+{
+    PaintStructBoundBox Bounds;
+    uint32_t Next;
+    uint16_t QuadrantIndex;
+    uint8_t SortFlags;
+};
+
+static constexpr uint32_t kPaintSortNodeNull = UINT32_MAX;
+
+struct PaintSortBuffer
+{
+    std::vector<PaintSortNode> Nodes;
+    std::vector<PaintStruct*> Structs;
+};
+
+// Paint sessions of separate columns are arranged in parallel.
+static thread_local PaintSortBuffer _paintSortBuffer;
+
+static uint32_t PaintSortNodesFirstInQuadrant(const PaintSortNode* nodes, uint32_t next, uint16_t quadrantIndex)
+{
+    uint32_t index;
+    do
+    {
+        index = next;
+        next = nodes[next].Next;
+        if (next == kPaintSortNodeNull)
+            return index;
+    } while (quadrantIndex > nodes[next].QuadrantIndex);
+    return index;
+}
+
+static void PaintSortNodesInitializeSort(PaintSortNode* nodes, uint32_t index, uint16_t quadrantIndex, uint8_t flag)
+{
+    do
+    {
+        index = nodes[index].Next;
+        if (index == kPaintSortNodeNull)
+            break;
+
+        auto& node = nodes[index];
+        if (node.QuadrantIndex > quadrantIndex + 1)
+        {
+            node.SortFlags = PaintSortFlags::OutsideQuadrant;
+        }
+        else if (node.QuadrantIndex == quadrantIndex + 1)
+        {
+            node.SortFlags = PaintSortFlags::Neighbour | PaintSortFlags::PendingVisit;
+        }
+        else if (node.QuadrantIndex == quadrantIndex)
+        {
+            node.SortFlags = flag | PaintSortFlags::PendingVisit;
+        }
+    } while (nodes[index].QuadrantIndex <= quadrantIndex + 1);
+}
+
+static std::pair<uint32_t, uint32_t> PaintSortNodesGetNextPending(const PaintSortNode* nodes, uint32_t index)
+{
+    while (true)
+    {
+        const auto next = nodes[index].Next;
+        if (next == kPaintSortNodeNull || (nodes[next].SortFlags & PaintSortFlags::OutsideQuadrant))
+        {
+            return { kPaintSortNodeNull, kPaintSortNodeNull };
+        }
+        if (nodes[next].SortFlags & PaintSortFlags::PendingVisit)
+        {
+            return { index, next };
+        }
+        index = next;
+    }
+}
+
+template<uint8_t TRotation> static void PaintSortNodesSortQuadrant(PaintSortNode* nodes, uint32_t parent, uint32_t child)
+{
+    nodes[child].SortFlags &= ~PaintSortFlags::PendingVisit;
+
+    const PaintStructBoundBox initialBBox = nodes[child].Bounds;
+    for (;;)
+    {
+        const auto previous = child;
+        child = nodes[child].Next;
+
+        if (child == kPaintSortNodeNull || nodes[child].SortFlags & PaintSortFlags::OutsideQuadrant)
+        {
+            break;
+        }
+
+        if (!(nodes[child].SortFlags & PaintSortFlags::Neighbour))
+        {
+            continue;
+        }
+
+        if (CheckBoundingBox<TRotation>(initialBBox, nodes[child].Bounds))
+        {
+            // Child node intersects with current node, move behind.
+            nodes[previous].Next = nodes[child].Next;
+            nodes[child].Next = nodes[parent].Next;
+            nodes[parent].Next = child;
+            child = previous;
+        }
+    }
+}
+
+template<uint8_t TRotation>
+static uint32_t PaintSortNodesArrangeQuadrant(
+    PaintSortNode* nodes, uint32_t quadrantEntry, uint16_t quadrantIndex, uint8_t flag)
+{
+    quadrantEntry = PaintSortNodesFirstInQuadrant(nodes, quadrantEntry, quadrantIndex);
+    PaintSortNodesInitializeSort(nodes, quadrantEntry, quadrantIndex, flag);
+
+    for (auto index = quadrantEntry;;)
+    {
+        const auto [parent, child] = PaintSortNodesGetNextPending(nodes, index);
+        if (parent == kPaintSortNodeNull)
+        {
+            break;
+        }
+
+        PaintSortNodesSortQuadrant<TRotation>(nodes, parent, child);
+        index = parent;
+    }
+
+    return quadrantEntry;
+}
+
+template<int TRotation> static void PaintSessionArrangeContiguousImpl(PaintSessionCore& session)
+{
+    uint32_t quadrantIndex = session.QuadrantBackIndex;
+    if (quadrantIndex == UINT32_MAX)
+    {
+        return;
+    }
+
+    // Node 0 takes the place of the head node of the linked version.
+    auto& nodes = _paintSortBuffer.Nodes;
+    auto& structs = _paintSortBuffer.Structs;
+    nodes.clear();
+    structs.clear();
+    nodes.push_back({ {}, kPaintSortNodeNull, 0, 0 });
+    structs.push_back(nullptr);
+
+    do
+    {
+        for (auto* ps = session.Quadrants[quadrantIndex]; ps != nullptr; ps = ps->NextQuadrantEntry)
+        {
+            nodes.back().Next = static_cast<uint32_t>(nodes.size());
+            nodes.push_back({ ps->Bounds, kPaintSortNodeNull, ps->QuadrantIndex, ps->SortFlags });
+            structs.push_back(ps);
+        }
+    } while (++quadrantIndex <= session.QuadrantFrontIndex);
+
+    quadrantIndex = session.QuadrantBackIndex;
+    auto nextQuadrant = PaintSortNodesArrangeQuadrant<TRotation>(
+        nodes.data(), 0, session.QuadrantBackIndex, PaintSortFlags::Neighbour);
+
+    while (++quadrantIndex < session.QuadrantFrontIndex)
+    {
+        nextQuadrant = PaintSortNodesArrangeQuadrant<TRotation>(
+            nodes.data(), nextQuadrant, quadrantIndex, PaintSortFlags::None);
+    }
+
+    // Write the resulting order back into the paint structs.
+    PaintStruct psHead{};
+    PaintStruct* psLast = &psHead;
+    for (auto index = nodes[0].Next; index != kPaintSortNodeNull; index = nodes[index].Next)
+    {
+        auto* ps = structs[index];
+        ps->SortFlags = nodes[index].SortFlags;
+        psLast->NextQuadrantEntry = ps;
+        psLast = ps;
+    }
+    psLast->NextQuadrantEntry = nullptr;
+
+    session.PaintHead = psHead.NextQuadrantEntry;
+}
+
 using PaintArrangeWithRotation = void (*)(PaintSessionCore& session);
 
-constexpr std::array _paintArrangeFuncs = {
-    PaintSessionArrangeImpl<0>,
-    PaintSessionArrangeImpl<1>,
-    PaintSessionArrangeImpl<2>,
-    PaintSessionArrangeImpl<3>,
+constexpr std::array _paintArrangeLinkedFuncs = {
+    PaintSessionArrangeLinkedImpl<0>,
+    PaintSessionArrangeLinkedImpl<1>,
+    PaintSessionArrangeLinkedImpl<2>,
+    PaintSessionArrangeLinkedImpl<3>,
+};
+
+constexpr std::array _paintArrangeContiguousFuncs = {
+    PaintSessionArrangeContiguousImpl<0>,
+    PaintSessionArrangeContiguousImpl<1>,
+    PaintSessionArrangeContiguousImpl<2>,
+    PaintSessionArrangeContiguousImpl<3>,
 };
 
 /**
@@ -509,7 +799,13 @@ constexpr std::array _paintArrangeFuncs = {
 void PaintSessionArrange(PaintSessionCore& session)
 {
     PROFILED_FUNCTION();
-    return _paintArrangeFuncs[session.CurrentRotation](session);
+    return _paintArrangeContiguousFuncs[session.CurrentRotation](session);
+}
+
+void PaintSessionArrangeLinked(PaintSessionCore& session)
+{
+    PROFILED_FUNCTION();
+    return _paintArrangeLinkedFuncs[session.CurrentRotation](session);
 }
 
 static void PaintDrawStruct(PaintSession& session, PaintStruct* ps)
@@ -530,6 +826,7 @@ static void PaintDrawStruct(PaintSession& session, PaintStruct* ps)
     }
 
     auto imageId = PaintPSColourifyImage(ps, ps->image_id, session.ViewFlags);
+    PaintRecordSprite(session, imageId, screenPos);
     if (gPaintBoundingBoxes && session.DPI.zoom_level == ZoomLevel{ 0 })
     {
         PaintPSImageWithBoundingBoxes(session, ps, imageId, screenPos.x, screenPos.y);
@@ -545,7 +842,7 @@ static void PaintDrawStruct(PaintSession& session, PaintStruct* ps)
     }
     else
     {
-        PaintAttachedPS(session.DPI, ps, session.ViewFlags);
+        PaintAttachedPS(session, ps);
     }
 }
 
@@ -568,14 +865,16 @@ void PaintDrawStructs(PaintSession& session)
  *  rct2: 0x00688596
  *  Part of 0x688485
  */
-static void PaintAttachedPS(DrawPixelInfo& dpi, PaintStruct* ps, uint32_t viewFlags)
+static void PaintAttachedPS(PaintSession& session, PaintStruct* ps)
 {
+    auto& dpi = session.DPI;
     AttachedPaintStruct* attached_ps = ps->Attached;
     for (; attached_ps != nullptr; attached_ps = attached_ps->NextEntry)
     {
         const auto screenCoords = ps->ScreenPos + attached_ps->RelativePos;
 
-        auto imageId = PaintPSColourifyImage(ps, attached_ps->image_id, viewFlags);
+        auto imageId = PaintPSColourifyImage(ps, attached_ps->image_id, session.ViewFlags);
+        PaintRecordSprite(session, imageId, screenCoords);
         if (attached_ps->IsMasked)
         {
             GfxDrawSpriteRawMasked(dpi, screenCoords, imageId, attached_ps->ColourImageId);
@@ -699,6 +998,19 @@ void PaintSessionFree(PaintSession* session)
     GetContext()->GetPainter()->ReleaseSession(session);
 }
 
+PaintColumnVisibility::PaintColumnVisibility(const PaintSession& session)
+    : _baseScreenY(Translate3DTo2DWithZ(session.CurrentRotation, CoordsXYZ{ session.SpritePosition, 0 }).y)
+    , _viewTop(session.DPI.y)
+    , _viewBottom(session.DPI.y + session.DPI.height)
+{
+    if (session.TileCacheRecording != nullptr)
+    {
+        // Recorded calls are played back into other views, none of them may be left out
+        _viewTop = std::numeric_limits<int32_t>::min() / 2;
+        _viewBottom = std::numeric_limits<int32_t>::max() / 2;
+    }
+}
+
 /**
  *  rct2: 0x00686806, 0x006869B2, 0x00686B6F, 0x00686D31, 0x0098197C
  *
@@ -717,6 +1029,30 @@ void PaintSessionFree(PaintSession* session)
 // Track Pieces, Shops.
 PaintStruct* PaintAddImageAsParent(
     PaintSession& session, const ImageId image_id, const CoordsXYZ& offset, const BoundBoxXYZ& boundBox)
+{
+    if (session.TileCacheRecording != nullptr)
+    {
+        return PaintTileCacheRecord(session, PaintTileCacheCommandType::Parent, image_id, {}, offset, boundBox).Struct;
+    }
+    return PaintAddImageAsParentImpl(session, image_id, offset, boundBox);
+}
+
+PaintStruct* PaintAddImageAsParentKeepLast(
+    PaintSession& session, const ImageId imageId, const CoordsXYZ& offset, const BoundBoxXYZ& boundBox)
+{
+    if (session.TileCacheRecording != nullptr)
+    {
+        return PaintTileCacheRecord(session, PaintTileCacheCommandType::ParentKeepLast, imageId, {}, offset, boundBox).Struct;
+    }
+
+    auto* backup = session.LastPS;
+    auto* ps = PaintAddImageAsParentImpl(session, imageId, offset, boundBox);
+    session.LastPS = backup;
+    return ps;
+}
+
+static PaintStruct* PaintAddImageAsParentImpl(
+    PaintSession& session, const ImageId image_id, const CoordsXYZ& offset, const BoundBoxXYZ& boundBox)
 {
     session.LastPS = nullptr;
     session.LastAttachedPS = nullptr;
@@ -752,6 +1088,9 @@ PaintStruct* PaintAddImageAsParent(
 [[nodiscard]] PaintStruct* PaintAddImageAsOrphan(
     PaintSession& session, const ImageId imageId, const CoordsXYZ& offset, const BoundBoxXYZ& boundBox)
 {
+    // The caller links the result up itself, which can not be replayed.
+    PaintTileCacheRecordUnsupported(session);
+
     session.LastPS = nullptr;
     session.LastAttachedPS = nullptr;
     return CreateNormalPaintStruct(session, imageId, offset, boundBox);
@@ -777,10 +1116,15 @@ PaintStruct* PaintAddImageAsParent(
 PaintStruct* PaintAddImageAsChild(
     PaintSession& session, const ImageId image_id, const CoordsXYZ& offset, const BoundBoxXYZ& boundBox)
 {
+    if (session.TileCacheRecording != nullptr)
+    {
+        return PaintTileCacheRecord(session, PaintTileCacheCommandType::Child, image_id, {}, offset, boundBox).Struct;
+    }
+
     PaintStruct* parentPS = session.LastPS;
     if (parentPS == nullptr)
     {
-        return PaintAddImageAsParent(session, image_id, offset, boundBox);
+        return PaintAddImageAsParentImpl(session, image_id, offset, boundBox);
     }
 
     auto* ps = CreateNormalPaintStruct(session, image_id, offset, boundBox);
@@ -804,10 +1148,16 @@ PaintStruct* PaintAddImageAsChild(
  */
 bool PaintAttachToPreviousAttach(PaintSession& session, const ImageId imageId, int32_t x, int32_t y)
 {
+    if (session.TileCacheRecording != nullptr)
+    {
+        return PaintTileCacheRecord(session, PaintTileCacheCommandType::AttachToPreviousAttach, imageId, {}, { x, y, 0 }, {})
+            .Success;
+    }
+
     auto* previousAttachedPS = session.LastAttachedPS;
     if (previousAttachedPS == nullptr)
     {
-        return PaintAttachToPreviousPS(session, imageId, x, y);
+        return PaintAttachToPreviousPSImpl(session, imageId, x, y);
     }
 
     auto* ps = session.AllocateAttachedPaintEntry();
@@ -835,6 +1185,40 @@ bool PaintAttachToPreviousAttach(PaintSession& session, const ImageId imageId, i
  * @return (!CF) success
  */
 bool PaintAttachToPreviousPS(PaintSession& session, const ImageId image_id, int32_t x, int32_t y)
+{
+    if (session.TileCacheRecording != nullptr)
+    {
+        return PaintTileCacheRecord(session, PaintTileCacheCommandType::AttachToPreviousPS, image_id, {}, { x, y, 0 }, {})
+            .Success;
+    }
+    return PaintAttachToPreviousPSImpl(session, image_id, x, y);
+}
+
+/**
+ * Attaches an image that is drawn through the mask of image_id, used for blending terrain edges.
+ */
+bool PaintAttachToPreviousPSMasked(
+    PaintSession& session, const ImageId imageId, const ImageId colourImageId, int32_t x, int32_t y)
+{
+    if (session.TileCacheRecording != nullptr)
+    {
+        return PaintTileCacheRecord(
+                   session, PaintTileCacheCommandType::AttachToPreviousPSMasked, imageId, colourImageId, { x, y, 0 }, {})
+            .Success;
+    }
+
+    if (!PaintAttachToPreviousPSImpl(session, imageId, x, y))
+    {
+        return false;
+    }
+
+    auto* ps = session.LastAttachedPS;
+    ps->ColourImageId = colourImageId;
+    ps->IsMasked = true;
+    return true;
+}
+
+static bool PaintAttachToPreviousPSImpl(PaintSession& session, const ImageId image_id, int32_t x, int32_t y)
 {
     auto* masterPs = session.LastPS;
     if (masterPs == nullptr)
@@ -873,6 +1257,8 @@ void PaintFloatingMoneyEffect(
     PaintSession& session, money64 amount, StringId string_id, int32_t y, int32_t z, int8_t y_offsets[], int32_t offset_x,
     uint32_t rotation)
 {
+    PaintTileCacheRecordUnsupported(session);
+
     auto* ps = session.AllocateStringPaintEntry();
     if (ps == nullptr)
     {
@@ -1005,30 +1391,74 @@ size_t PaintEntryPool::Chain::GetCount() const
     return count;
 }
 
+/**
+ * Nodes are handed out from a list local to the calling thread, so the threads filling paint columns only take the
+ * lock once per NodeBatchSize nodes. The pool owns every node it allocated, the thread lists only borrow them and are
+ * tagged with the id of their pool so a list left behind by a destroyed pool is never used.
+ */
+struct PaintEntryThreadNodes
+{
+    uint32_t PoolId{};
+    std::vector<PaintEntryPool::Node*> Nodes;
+};
+
+static thread_local PaintEntryThreadNodes _paintEntryThreadNodes;
+static std::atomic<uint32_t> _nextPaintEntryPoolId{ 1 };
+
+PaintEntryPool::PaintEntryPool()
+    : _id(_nextPaintEntryPoolId++)
+{
+}
+
 PaintEntryPool::~PaintEntryPool()
 {
-    for (auto node : _available)
+    for (auto node : _allNodes)
     {
         delete node;
     }
+    _allNodes.clear();
     _available.clear();
 }
 
 PaintEntryPool::Node* PaintEntryPool::AllocateNode()
+{
+    auto& threadNodes = _paintEntryThreadNodes;
+    if (threadNodes.PoolId != _id)
+    {
+        threadNodes.PoolId = _id;
+        threadNodes.Nodes.clear();
+    }
+
+    if (threadNodes.Nodes.empty() && !RefillThreadNodes(threadNodes.Nodes))
+    {
+        return nullptr;
+    }
+
+    auto* result = threadNodes.Nodes.back();
+    threadNodes.Nodes.pop_back();
+    return result;
+}
+
+bool PaintEntryPool::RefillThreadNodes(std::vector<Node*>& threadNodes)
 {
     std::lock_guard<std::mutex> lock(_mutex);
 
-    PaintEntryPool::Node* result;
-    if (_available.size() > 0)
+    while (threadNodes.size() < NodeBatchSize && _available.size() > 0)
     {
-        result = _available.back();
+        threadNodes.push_back(_available.back());
         _available.pop_back();
     }
-    else
+    while (threadNodes.size() < NodeBatchSize)
     {
-        result = new (std::nothrow) PaintEntryPool::Node();
+        auto* node = new (std::nothrow) PaintEntryPool::Node();
+        if (node == nullptr)
+        {
+            break;
+        }
+        _allNodes.push_back(node);
+        threadNodes.push_back(node);
     }
-    return result;
+    return threadNodes.size() > 0;
 }
 
 PaintEntryPool::Chain PaintEntryPool::Create()
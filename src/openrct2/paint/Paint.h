@@ -13,18 +13,21 @@
 #include "../core/FixedVector.h"
 #include "../drawing/Drawing.h"
 #include "../interface/Colour.h"
+#include "../profiling/PaintStatistics.h"
 #include "../world/Location.hpp"
 #include "../world/Map.h"
 #include "Boundbox.h"
 
 #include <mutex>
 #include <thread>
+#include <vector>
 
 struct EntityBase;
 struct TileElement;
 struct SurfaceElement;
 enum class RailingEntrySupportType : uint8_t;
 enum class ViewportInteractionItem : uint8_t;
+struct PaintTileCacheRecording;
 
 struct AttachedPaintStruct
 {
@@ -137,6 +140,8 @@ static constexpr int32_t MaxPaintQuadrants = kMaximumMapSizeTechnical * 2;
 class PaintEntryPool
 {
     static constexpr size_t NodeSize = 512;
+    // Number of nodes a thread takes from or hands back to the shared list at once.
+    static constexpr size_t NodeBatchSize = 16;
 
 public:
     struct Node
@@ -165,12 +170,16 @@ public:
     };
 
 private:
+    const uint32_t _id;
     std::vector<Node*> _available;
+    std::vector<Node*> _allNodes;
     std::mutex _mutex;
 
     Node* AllocateNode();
+    bool RefillThreadNodes(std::vector<Node*>& threadNodes);
 
 public:
+    PaintEntryPool();
     ~PaintEntryPool();
 
     Chain Create();
@@ -216,6 +225,12 @@ struct PaintSession : public PaintSessionCore
 {
     DrawPixelInfo DPI;
     PaintEntryPool::Chain PaintEntryChain;
+    // Set while the paint calls for a tile are recorded into the tile paint cache.
+    PaintTileCacheRecording* TileCacheRecording{};
+    // Cost of painting the column, only filled in while gPaintStatistics or gPaintOverdrawHeatmap is set.
+    OpenRCT2::PaintStatistics::ColumnStats Stats;
+    // Number of sprites drawn over each pixel of the column while the overdraw heatmap is shown.
+    std::vector<uint8_t> Overdraw;
 
     PaintStruct* AllocateNormalPaintEntry() noexcept
     {
@@ -288,8 +303,36 @@ constexpr ImageId ShopSupportColour = ImageId(0, COLOUR_DARK_BROWN);
 extern bool gShowDirtyVisuals;
 extern bool gPaintBoundingBoxes;
 extern bool gPaintBlockedTiles;
+extern bool gPaintStatistics;
+extern bool gPaintOverdrawHeatmap;
 extern bool gPaintWidePathsAsGhost;
 
+/**
+ * Tells which heights of a column of sprites stacked straight up from the current sprite position can reach the
+ * session's view. Tall supports use it to skip the sprites that would only be culled again when they are added.
+ */
+class PaintColumnVisibility
+{
+private:
+    // How far the sprites of a column reach above and below their position on screen, including their offset within
+    // the tile.
+    static constexpr int32_t kMarginAbove = 96;
+    static constexpr int32_t kMarginBelow = 64;
+
+    int32_t _baseScreenY;
+    int32_t _viewTop;
+    int32_t _viewBottom;
+
+public:
+    explicit PaintColumnVisibility(const PaintSession& session);
+
+    bool MayBeVisible(int32_t z) const
+    {
+        const int32_t screenY = _baseScreenY - z;
+        return screenY + kMarginBelow > _viewTop && screenY - kMarginAbove < _viewBottom;
+    }
+};
+
 PaintStruct* PaintAddImageAsParent(
     PaintSession& session, const ImageId image_id, const CoordsXYZ& offset, const BoundBoxXYZ& boundBox);
 /**
@@ -310,6 +353,15 @@ inline PaintStruct* PaintAddImageAsParent(
     return PaintAddImageAsParent(session, image_id, offset, { offset, boundBoxSize });
 }
 
+// Adds a parent paint struct without making it the target of following child and attach calls.
+PaintStruct* PaintAddImageAsParentKeepLast(
+    PaintSession& session, const ImageId imageId, const CoordsXYZ& offset, const BoundBoxXYZ& boundBox);
+inline PaintStruct* PaintAddImageAsParentKeepLast(
+    PaintSession& session, const ImageId imageId, const CoordsXYZ& offset, const CoordsXYZ& boundBoxSize)
+{
+    return PaintAddImageAsParentKeepLast(session, imageId, offset, { offset, boundBoxSize });
+}
+
 [[nodiscard]] PaintStruct* PaintAddImageAsOrphan(
     PaintSession& session, const ImageId image_id, const CoordsXYZ& offset, const BoundBoxXYZ& boundBox);
 PaintStruct* PaintAddImageAsChild(
@@ -334,6 +386,8 @@ void PaintUtilPushTunnelRotated(PaintSession& session, uint8_t direction, uint16
 
 bool PaintAttachToPreviousAttach(PaintSession& session, const ImageId imageId, int32_t x, int32_t y);
 bool PaintAttachToPreviousPS(PaintSession& session, const ImageId image_id, int32_t x, int32_t y);
+bool PaintAttachToPreviousPSMasked(
+    PaintSession& session, const ImageId imageId, const ImageId colourImageId, int32_t x, int32_t y);
 void PaintFloatingMoneyEffect(
     PaintSession& session, money64 amount, StringId string_id, int32_t y, int32_t z, int8_t y_offsets[], int32_t offset_x,
     uint32_t rotation);
@@ -342,5 +396,11 @@ PaintSession* PaintSessionAlloc(DrawPixelInfo& dpi, uint32_t viewFlags, uint8_t
 void PaintSessionFree(PaintSession* session);
 void PaintSessionGenerate(PaintSession& session);
 void PaintSessionArrange(PaintSessionCore& session);
+// Sorts the quadrant lists in place, same order as PaintSessionArrange which sorts a compact copy instead.
+void PaintSessionArrangeLinked(PaintSessionCore& session);
 void PaintDrawStructs(PaintSession& session);
+// Sizes the overdraw counters of the session to its column, or drops them if the heatmap is not shown.
+void PaintOverdrawPrepare(PaintSession& session);
+// Replaces the drawn column by the number of sprites drawn over each pixel.
+void PaintDrawOverdrawHeatmap(PaintSession& session);
 void PaintDrawMoneyStructs(DrawPixelInfo& dpi, PaintStringStruct* ps);
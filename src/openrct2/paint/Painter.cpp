@@ -23,6 +23,7 @@
 #include "../localisation/Formatting.h"
 #include "../localisation/Language.h"
 #include "../paint/Paint.h"
+#include "../profiling/PaintStatistics.h"
 #include "../profiling/Profiling.h"
 #include "../title/TitleScreen.h"
 #include "../ui/UiContext.h"
@@ -82,6 +83,7 @@ void Painter::Paint(IDrawingEngine& de)
     {
         PaintFPS(*dpi);
     }
+    PaintStatistics::EndFrame();
     gCurrentDrawCount++;
 }
 
@@ -166,6 +168,8 @@ PaintSession* Painter::CreateSession(DrawPixelInfo& dpi, uint32_t viewFlags, uin
     session->PaintHead = nullptr;
     session->LastPS = nullptr;
     session->LastAttachedPS = nullptr;
+    session->TileCacheRecording = nullptr;
+    session->Stats = {};
     session->PSStringHead = nullptr;
     session->LastPSString = nullptr;
     session->WoodenSupportsPrependTo = nullptr;
@@ -320,6 +320,7 @@ bool MetalASupportsPaintSetup(
     height += heightDiff;
     // 6632e6
 
+    const PaintColumnVisibility column(session);
     for (uint8_t count = 0;; count++)
     {
         if (count >= 4)
@@ -344,8 +345,11 @@ bool MetalASupportsPaintSetup(
         if (count == 3 && z == 0x10)
             imageIndex++;
 
-        auto image_id = imageTemplate.WithIndex(imageIndex);
-        PaintAddImageAsParent(session, image_id, { xOffset, yOffset, height }, { 0, 0, z - 1 });
+        if (column.MayBeVisible(height))
+        {
+            auto image_id = imageTemplate.WithIndex(imageIndex);
+            PaintAddImageAsParent(session, image_id, { xOffset, yOffset, height }, { 0, 0, z - 1 });
+        }
 
         height += z;
     }
@@ -382,11 +386,14 @@ bool MetalASupportsPaintSetup(
         int8_t xOffset = SupportBoundBoxes[segment].x;
         int8_t yOffset = SupportBoundBoxes[segment].y;
 
-        uint32_t imageIndex = _97B190[supportType].beam_id;
-        imageIndex += z - 1;
-        auto image_id = imageTemplate.WithIndex(imageIndex);
+        if (column.MayBeVisible(height))
+        {
+            uint32_t imageIndex = _97B190[supportType].beam_id;
+            imageIndex += z - 1;
+            auto image_id = imageTemplate.WithIndex(imageIndex);
 
-        PaintAddImageAsParent(session, image_id, { xOffset, yOffset, height }, { boundBoxOffset, { 0, 0, 0 } });
+            PaintAddImageAsParent(session, image_id, { xOffset, yOffset, height }, { boundBoxOffset, { 0, 0, 0 } });
+        }
 
         height += z;
     }
@@ -521,6 +528,7 @@ bool MetalBSupportsPaintSetup(
 
     int16_t endHeight;
 
+    const PaintColumnVisibility column(session);
     int32_t i = 1;
     while (true)
     {
@@ -548,8 +556,12 @@ bool MetalBSupportsPaintSetup(
             }
         }
 
-        PaintAddImageAsParent(
-            session, imageTemplate.WithIndex(imageId), { SupportBoundBoxes[segment], baseHeight }, { 0, 0, beamLength - 1 });
+        if (column.MayBeVisible(baseHeight))
+        {
+            PaintAddImageAsParent(
+                session, imageTemplate.WithIndex(imageId), { SupportBoundBoxes[segment], baseHeight },
+                { 0, 0, beamLength - 1 });
+        }
 
         baseHeight += beamLength;
         i++;
@@ -576,10 +588,13 @@ bool MetalBSupportsPaintSetup(
                 break;
             }
 
-            uint32_t imageId = _97B15C[supportType].beam_id + (beamLength - 1);
-            PaintAddImageAsParent(
-                session, imageTemplate.WithIndex(imageId), { SupportBoundBoxes[originalSegment], baseHeight },
-                { { SupportBoundBoxes[originalSegment], height }, { 0, 0, 0 } });
+            if (column.MayBeVisible(baseHeight))
+            {
+                uint32_t imageId = _97B15C[supportType].beam_id + (beamLength - 1);
+                PaintAddImageAsParent(
+                    session, imageTemplate.WithIndex(imageId), { SupportBoundBoxes[originalSegment], baseHeight },
+                    { { SupportBoundBoxes[originalSegment], height }, { 0, 0, 0 } });
+            }
             baseHeight += beamLength;
         }
     }
@@ -708,6 +723,7 @@ bool PathPoleSupportsPaintSetup(
 
     baseHeight += heightDiff;
 
+    const PaintColumnVisibility column(session);
     bool keepGoing = true;
     while (keepGoing)
     {
@@ -734,9 +750,12 @@ bool PathPoleSupportsPaintSetup(
                 break;
             }
 
-            PaintAddImageAsParent(
-                session, imageTemplate.WithIndex(pathPaintInfo.BridgeImageId + 20 + (z - 1)),
-                { SupportBoundBoxes[segment], baseHeight }, { 0, 0, (z - 1) });
+            if (column.MayBeVisible(baseHeight))
+            {
+                PaintAddImageAsParent(
+                    session, imageTemplate.WithIndex(pathPaintInfo.BridgeImageId + 20 + (z - 1)),
+                    { SupportBoundBoxes[segment], baseHeight }, { 0, 0, (z - 1) });
+            }
 
             baseHeight += z;
         }
@@ -752,8 +771,11 @@ bool PathPoleSupportsPaintSetup(
             imageIndex += 1;
         }
 
-        PaintAddImageAsParent(
-            session, imageTemplate.WithIndex(imageIndex), { SupportBoundBoxes[segment], baseHeight }, { 0, 0, (z - 1) });
+        if (column.MayBeVisible(baseHeight))
+        {
+            PaintAddImageAsParent(
+                session, imageTemplate.WithIndex(imageIndex), { SupportBoundBoxes[segment], baseHeight }, { 0, 0, (z - 1) });
+        }
 
         baseHeight += z;
     }
@@ -320,24 +320,31 @@ static void WoodenABPaintRepeatedSupports(
     WoodenSupportType supportType, WoodenSupportSubType subType, const ImageId& imageTemplate, int16_t heightSteps,
     PaintSession& session, uint16_t& baseHeight, bool& hasSupports)
 {
+    const PaintColumnVisibility column(session);
     while (heightSteps > 0)
     {
         const bool isHalf = baseHeight & 0x10 || heightSteps == 1 || baseHeight + WATER_HEIGHT_STEP == session.WaterHeight;
         if (isHalf)
         {
             // Half support
-            auto imageId = imageTemplate.WithIndex(GetWoodenSupportIds(supportType, subType).Half);
-            uint8_t boundBoxHeight = (heightSteps == 1) ? 7 : 12;
-            PaintAddImageAsParent(session, imageId, { 0, 0, baseHeight }, { 32, 32, boundBoxHeight });
+            if (column.MayBeVisible(baseHeight))
+            {
+                auto imageId = imageTemplate.WithIndex(GetWoodenSupportIds(supportType, subType).Half);
+                uint8_t boundBoxHeight = (heightSteps == 1) ? 7 : 12;
+                PaintAddImageAsParent(session, imageId, { 0, 0, baseHeight }, { 32, 32, boundBoxHeight });
+            }
             baseHeight += 16;
             heightSteps -= 1;
         }
         else
         {
             // Full support
-            auto imageId = imageTemplate.WithIndex(GetWoodenSupportIds(supportType, subType).Full);
-            uint8_t boundBoxHeight = (heightSteps == 2) ? 23 : 28;
-            PaintAddImageAsParent(session, imageId, { 0, 0, baseHeight }, { 32, 32, boundBoxHeight });
+            if (column.MayBeVisible(baseHeight))
+            {
+                auto imageId = imageTemplate.WithIndex(GetWoodenSupportIds(supportType, subType).Full);
+                uint8_t boundBoxHeight = (heightSteps == 2) ? 23 : 28;
+                PaintAddImageAsParent(session, imageId, { 0, 0, baseHeight }, { 32, 32, boundBoxHeight });
+            }
             baseHeight += 32;
             heightSteps -= 2;
         }
@@ -13,6 +13,7 @@
 #include "../../drawing/LightFX.h"
 #include "../../object/PathAdditionEntry.h"
 #include "../../profiling/Profiling.h"
+#include "../Paint.TileCache.h"
 #include "Paint.TileElement.h"
 
 static ImageIndex GetEdgeImageOffset(edge_t edge)
@@ -273,6 +274,9 @@ void PaintLampLightEffects(PaintSession& session, const PathElement& pathEl, uin
             auto* pathAddEntry = pathEl.GetAdditionEntry();
             if (pathAddEntry != nullptr && pathAddEntry->flags & PATH_ADDITION_FLAG_LAMP)
             {
+                // The lights are added to the light effect list rather than painted, which can not be replayed.
+                PaintTileCacheRecordUnsupported(session);
+
                 if (!(pathEl.GetEdges() & EDGE_NE))
                 {
                     LightFXAdd3DLightMagicFromDrawingTile(session.MapPosition, -16, 0, height + 23, LightType::Lantern3);
@@ -512,13 +512,7 @@ static void ViewportSurfaceSmoothenEdge(
 
     const auto image_id = ImageId(maskImageBase + Byte97B444[self.slope]);
 
-    if (PaintAttachToPreviousPS(session, image_id, 0, 0))
-    {
-        AttachedPaintStruct* out = session.LastAttachedPS;
-        // set content and enable masking
-        out->ColourImageId = GetSurfacePattern(neighbour.surfaceObject, cl);
-        out->IsMasked = true;
-    }
+    PaintAttachToPreviousPSMasked(session, image_id, GetSurfacePattern(neighbour.surfaceObject, cl), 0, 0);
 }
 
 static bool TileIsInsideClipView(const TileDescriptor& tile)
@@ -980,9 +974,7 @@ static void PaintPatrolArea(PaintSession& session, const SurfaceElement& element
         auto [localZ, localSurfaceShape] = SurfaceGetHeightAboveWater(element, height, surfaceShape);
         auto imageId = ImageId(SPR_TERRAIN_SELECTION_PATROL_AREA + Byte97B444[localSurfaceShape], *colour);
 
-        auto* backup = session.LastPS;
-        PaintAddImageAsParent(session, imageId, { 0, 0, localZ }, { 32, 32, 1 });
-        session.LastPS = backup;
+        PaintAddImageAsParentKeepLast(session, imageId, { 0, 0, localZ }, { 32, 32, 1 });
     }
 }
 
@@ -1003,11 +995,9 @@ static void PaintSurfaceLandOwnership(
         const auto tileIsUnderWater = height != aboveWaterHeight || surfaceShape != aboveWaterSurfaceShape;
         if (tileIsUnderWater)
         {
-            PaintStruct* backup = session.LastPS;
-            PaintAddImageAsParent(
+            PaintAddImageAsParentKeepLast(
                 session, ImageId(SPR_TERRAIN_SELECTION_SQUARE + Byte97B444[aboveWaterSurfaceShape]), { 0, 0, aboveWaterHeight },
                 { 32, 32, 1 });
-            session.LastPS = backup;
         }
     }
     else if (tileElement.GetOwnership() & OWNERSHIP_AVAILABLE)
@@ -1015,9 +1005,7 @@ static void PaintSurfaceLandOwnership(
         const auto pos = CoordsXYZ(session.MapPosition.x + 16, session.MapPosition.y + 16, aboveWaterHeight);
         const auto height2 = TileElementHeight(pos, aboveWaterSurfaceShape) + ForSaleSignZOffset;
 
-        PaintStruct* backup = session.LastPS;
-        PaintAddImageAsParent(session, ImageId(SPR_LAND_OWNERSHIP_AVAILABLE), { 16, 16, height2 }, { 1, 1, 0 });
-        session.LastPS = backup;
+        PaintAddImageAsParentKeepLast(session, ImageId(SPR_LAND_OWNERSHIP_AVAILABLE), { 16, 16, height2 }, { 1, 1, 0 });
     }
 }
 
@@ -1037,11 +1025,9 @@ static void PaintSurfaceConstructionRights(
         const auto tileIsUnderWater = height != aboveWaterHeight || surfaceShape != aboveWaterSurfaceShape;
         if (tileIsUnderWater)
         {
-            PaintStruct* backup = session.LastPS;
-            PaintAddImageAsParent(
+            PaintAddImageAsParentKeepLast(
                 session, ImageId(SPR_TERRAIN_SELECTION_DOTTED + Byte97B444[aboveWaterSurfaceShape]), { 0, 0, aboveWaterHeight },
                 { 32, 32, 1 });
-            session.LastPS = backup;
         }
     }
     else if (tileElement.GetOwnership() & OWNERSHIP_CONSTRUCTION_RIGHTS_AVAILABLE)
@@ -1049,9 +1035,8 @@ static void PaintSurfaceConstructionRights(
         const auto pos = CoordsXYZ(session.MapPosition.x + 16, session.MapPosition.y + 16, aboveWaterHeight);
         const auto height2 = TileElementHeight(pos, aboveWaterSurfaceShape) + ForSaleSignZOffset;
 
-        PaintStruct* backup = session.LastPS;
-        PaintAddImageAsParent(session, ImageId(SPR_LAND_CONSTRUCTION_RIGHTS_AVAILABLE), { 16, 16, height2 }, { 1, 1, 0 });
-        session.LastPS = backup;
+        PaintAddImageAsParentKeepLast(
+            session, ImageId(SPR_LAND_CONSTRUCTION_RIGHTS_AVAILABLE), { 16, 16, height2 }, { 1, 1, 0 });
     }
 }
 
@@ -1276,9 +1261,7 @@ void PaintSurface(PaintSession& session, uint8_t direction, uint16_t height, con
                 if (isUnderWater)
                 {
                     const auto imageId2 = ImageId(SPR_TERRAIN_SELECTION_CORNER + Byte97B444[waterSurfaceShape], fpId);
-                    PaintStruct* backup = session.LastPS;
-                    PaintAddImageAsParent(session, imageId2, { 0, 0, waterHeight }, { 32, 32, 1 });
-                    session.LastPS = backup;
+                    PaintAddImageAsParentKeepLast(session, imageId2, { 0, 0, waterHeight }, { 32, 32, 1 });
                 }
             }
             else
@@ -1289,9 +1272,7 @@ void PaintSurface(PaintSession& session, uint8_t direction, uint16_t height, con
                 const auto fpId = FilterPaletteID::PaletteWaterMarker;
                 const auto image_id = ImageId(SPR_TERRAIN_SELECTION_CORNER + Byte97B444[local_surfaceShape], fpId);
 
-                PaintStruct* backup = session.LastPS;
-                PaintAddImageAsParent(session, image_id, { 0, 0, local_height }, { 32, 32, 1 });
-                session.LastPS = backup;
+                PaintAddImageAsParentKeepLast(session, image_id, { 0, 0, local_height }, { 32, 32, 1 });
             }
         }
     }
@@ -1321,9 +1302,7 @@ void PaintSurface(PaintSession& session, uint8_t direction, uint16_t height, con
             if (isUnderWater)
             {
                 const auto imageId2 = ImageId(SPR_TERRAIN_SELECTION_CORNER + Byte97B444[waterSurfaceShape], fpId);
-                PaintStruct* backup = session.LastPS;
-                PaintAddImageAsParent(session, imageId2, { 0, 0, waterHeight }, { 32, 32, 0 });
-                session.LastPS = backup;
+                PaintAddImageAsParentKeepLast(session, imageId2, { 0, 0, waterHeight }, { 32, 32, 0 });
             }
 
             break;
@@ -28,6 +28,7 @@
 #include "../../world/Scenery.h"
 #include "../../world/Surface.h"
 #include "../Paint.SessionFlags.h"
+#include "../Paint.TileCache.h"
 #include "../Paint.h"
 #include "../VirtualFloor.h"
 #include "../support/WoodenSupports.h"
@@ -210,6 +211,11 @@ static void PaintTileElementBase(PaintSession& session, const CoordsXY& origCoor
     session.SpritePosition.y = coords.y;
     session.Flags &= ~PaintSessionFlags::PassedSurface;
 
+    if (!partOfVirtualFloor && PaintTileCacheReplay(session, tile_element))
+        return;
+
+    const bool isRecording = !partOfVirtualFloor && PaintTileCacheBeginRecording(session, tile_element);
+
     int32_t previousBaseZ = 0;
     do
     {
@@ -285,6 +291,11 @@ static void PaintTileElementBase(PaintSession& session, const CoordsXY& origCoor
         session.MapPosition = mapPosition;
     } while (!(tile_element++)->IsLastForTile());
 
+    if (isRecording)
+    {
+        PaintTileCacheEndRecording(session);
+    }
+
     if (gConfigGeneral.VirtualFloorStyle != VirtualFloorStyles::Off && partOfVirtualFloor)
     {
         VirtualFloorPaint(session);
@@ -16,10 +16,13 @@
 #include "../OpenRCT2.h"
 #include "../ParkImporter.h"
 #include "../Version.h"
+#include "../config/Config.h"
 #include "../core/Console.hpp"
 #include "../core/Crypt.h"
 #include "../core/DataSerialiser.h"
 #include "../core/File.h"
+#include "../core/FileStream.h"
+#include "../core/MemoryStream.h"
 #include "../core/OrcaStream.hpp"
 #include "../core/Path.hpp"
 #include "../drawing/Drawing.h"
@@ -59,6 +62,7 @@
 
 #include <cstdint>
 #include <ctime>
+#include <future>
 #include <numeric>
 #include <optional>
 #include <string_view>
@@ -102,6 +106,8 @@ namespace OpenRCT2
         ObjectList RequiredObjects;
         std::vector<const ObjectRepositoryItem*> ExportObjectsList;
         bool OmitTracklessRides{};
+        uint32_t Compression = OrcaStream::COMPRESSION_GZIP;
+        uint8_t CompressionLevel = OrcaStream::COMPRESSION_LEVEL_DEFAULT;
 
     private:
         std::unique_ptr<OrcaStream> _os;
@@ -143,9 +149,21 @@ namespace OpenRCT2
             ReadWritePackedObjectsChunk(*_os);
         }
 
+        /**
+         * Only reads the scenario chunk, so the details of a park can be listed without loading its map and objects.
+         * Parks saved with chunked compression do not need to be decompressed as a whole for this.
+         */
+        void LoadScenarioDetails(IStream& stream)
+        {
+            _os = std::make_unique<OrcaStream>(
+                stream, OrcaStream::Mode::READING, std::vector<uint32_t>{ ParkFileChunkType::SCENARIO });
+            ThrowIfIncompatibleVersion();
+        }
+
         void Import(GameState_t& gameState)
         {
             auto& os = *_os;
+            os.DecompressAllChunks();
             ReadWriteTilesChunk(gameState, os);
             ReadWriteBannersChunk(gameState, os);
             ReadWriteRidesChunk(gameState, os);
@@ -177,6 +195,12 @@ namespace OpenRCT2
             header.Magic = PARK_FILE_MAGIC;
             header.TargetVersion = PARK_FILE_CURRENT_VERSION;
             header.MinVersion = PARK_FILE_MIN_VERSION;
+            header.Compression = Compression;
+            header.CompressionLevel = CompressionLevel;
+            if (Compression == OrcaStream::COMPRESSION_GZIP_CHUNKED)
+            {
+                header.MinVersion = PARK_FILE_CHUNKED_COMPRESSION_VERSION;
+            }
 
             ReadWriteAuthoringChunk(os);
             ReadWriteObjectsChunk(os);
@@ -2536,6 +2560,62 @@ enum : uint32_t
     S6_SAVE_FLAG_AUTOMATIC = 1u << 31,
 };
 
+static std::future<void> _backgroundSaveTask;
+
+/**
+ * Compresses and writes a park that was serialised without compression on a worker thread.
+ */
+static void ScenarioWriteInBackground(MemoryStream&& stream, u8string_view path, uint32_t compression)
+{
+    // Only allow one save in flight so slow disks can not pile up writes
+    ScenarioWaitForBackgroundSave();
+    _backgroundSaveTask = std::async(
+        std::launch::async, [stream = std::move(stream), path = u8string(path), compression]() {
+            try
+            {
+                // The stream was serialised uncompressed, so its header does not require chunked compression yet
+                const auto minVersion = compression == OrcaStream::COMPRESSION_GZIP_CHUNKED
+                    ? PARK_FILE_CHUNKED_COMPRESSION_VERSION
+                    : 0;
+                FileStream fs(path, FILE_MODE_WRITE);
+                OrcaStream::Compress(stream.GetData(), stream.GetLength(), compression, fs, minVersion);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_ERROR("Unable to save '%s': %s", path.c_str(), e.what());
+            }
+        });
+}
+
+/**
+ * Blocks until a save started by ScenarioWriteInBackground has been written, so the file is complete before it is
+ * read again or the game shuts down.
+ */
+void ScenarioWaitForBackgroundSave()
+{
+    if (_backgroundSaveTask.valid())
+    {
+        _backgroundSaveTask.get();
+    }
+}
+
+bool ParkFileGetScenarioDetails(std::string_view path, ScenarioIndexEntry& entry)
+{
+    try
+    {
+        FileStream fs(path, FILE_MODE_OPEN);
+        auto parkFile = std::make_unique<OpenRCT2::ParkFile>();
+        parkFile->LoadScenarioDetails(fs);
+        entry = parkFile->ReadScenarioChunk();
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to read scenario details of '%s': %s", std::string(path).c_str(), e.what());
+    }
+    return false;
+}
+
 int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
 {
     if (flags & S6_SAVE_FLAG_SCENARIO)
@@ -2565,6 +2645,11 @@ int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
             parkFile->ExportObjectsList = objManager.GetPackableObjects();
         }
         parkFile->OmitTracklessRides = true;
+        if (flags & S6_SAVE_FLAG_AUTOMATIC)
+        {
+            // Autosaves happen during play, favour a short stall over a smaller file
+            parkFile->CompressionLevel = OrcaStream::COMPRESSION_LEVEL_FASTEST;
+        }
         if (flags & S6_SAVE_FLAG_SCENARIO)
         {
             // s6exporter->SaveScenario(path);
@@ -2573,7 +2658,26 @@ int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
         {
             // s6exporter->SaveGame(path);
         }
-        parkFile->Save(gameState, path);
+        if (gConfigGeneral.ChunkedParkCompression)
+        {
+            parkFile->Compression = OrcaStream::COMPRESSION_GZIP_CHUNKED;
+        }
+        if ((flags & S6_SAVE_FLAG_AUTOMATIC) && gConfigGeneral.BackgroundAutosave)
+        {
+            // Serialising has to happen on the game thread as it reads the live game state, but the compression
+            // and the file write can be done without stalling the game.
+            const auto compression = parkFile->Compression;
+            parkFile->Compression = OrcaStream::COMPRESSION_NONE;
+            MemoryStream ms;
+            parkFile->Save(gameState, ms);
+            ScenarioWriteInBackground(std::move(ms), path, compression);
+        }
+        else
+        {
+            // An autosave may still be writing to the same file
+            ScenarioWaitForBackgroundSave();
+            parkFile->Save(gameState, path);
+        }
         result = true;
     }
     catch (const std::exception& e)
@@ -5,17 +5,21 @@
 #include <vector>
 
 struct ObjectRepositoryItem;
+struct ScenarioIndexEntry;
 
 namespace OpenRCT2
 {
     struct GameState_t;
 
     // Current version that is saved.
-    constexpr uint32_t PARK_FILE_CURRENT_VERSION = 33;
+    constexpr uint32_t PARK_FILE_CURRENT_VERSION = 34;
 
     // The minimum version that is forwards compatible with the current version.
     constexpr uint32_t PARK_FILE_MIN_VERSION = 33;
 
+    // The minimum version that can read parks saved with independently compressed chunks.
+    constexpr uint32_t PARK_FILE_CHUNKED_COMPRESSION_VERSION = 34;
+
     // The minimum version that is backwards compatible with the current version.
     // If this is increased beyond 0, uncomment the checks in ParkFile.cpp and Context.cpp!
     constexpr uint32_t PARK_FILE_MIN_SUPPORTED_VERSION = 0x0;
@@ -33,3 +37,8 @@ public:
     void Export(OpenRCT2::GameState_t& gameState, std::string_view path);
     void Export(OpenRCT2::GameState_t& gameState, OpenRCT2::IStream& stream);
 };
+
+/**
+ * Reads the scenario details of a park file without loading its map or objects.
+ */
+bool ParkFileGetScenarioDetails(std::string_view path, ScenarioIndexEntry& entry);
@@ -10,9 +10,11 @@
 #include "GuestPathfinding.h"
 
 #include "../GameState.h"
+#include "../config/Config.h"
 #include "../core/Guard.hpp"
 #include "../entity/Guest.h"
 #include "../entity/Staff.h"
+#include "../network/network.h"
 #include "../profiling/Profiling.h"
 #include "../ride/RideData.h"
 #include "../ride/Station.h"
@@ -21,9 +23,15 @@
 #include "../util/Util.h"
 #include "../world/Entrance.h"
 #include "../world/Footpath.h"
+#include "../world/TileElementsView.h"
 
+#include <array>
 #include <bitset>
 #include <cstring>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 bool gPeepPathFindIgnoreForeignQueues;
 RideId gPeepPathFindQueueRideIndex;
@@ -64,29 +72,26 @@ namespace OpenRCT2::PathFinding
     };
 
 #pragma region Pathfinding Logging
-    // In case this is set to true it will enable code paths that log path finding. The peep will additionally
+    // Logs path finding when the pathfinding diagnostic category is enabled at runtime. The peep will additionally
     // require to have PEEP_FLAGS_DEBUG_PATHFINDING set in PeepFlags in order to activate logging.
-    static constexpr bool kLogPathfinding = false;
-
-    template<typename... TArgs>
-    static void LogPathfinding([[maybe_unused]] const Peep* peep, [[maybe_unused]] const char* format, TArgs&&... args)
+    template<typename... TArgs> static void LogPathfinding(const Peep* peep, const char* format, TArgs&&... args)
     {
-        if constexpr (kLogPathfinding)
-        {
-            if ((peep->PeepFlags & PEEP_FLAGS_DEBUG_PATHFINDING) == 0)
-                return;
+        if (!DiagnosticIsCategoryEnabled(DiagnosticCategory::Pathfinding))
+            return;
+        if (peep != nullptr && (peep->PeepFlags & PEEP_FLAGS_DEBUG_PATHFINDING) == 0)
+            return;
 
-            char buffer[256];
-            snprintf(buffer, sizeof(buffer), format, std::forward<TArgs>(args)...);
+        char buffer[256];
+        snprintf(buffer, sizeof(buffer), format, std::forward<TArgs>(args)...);
 
-            if (peep != nullptr)
-            {
-                LOG_INFO("[%05u:%s] %s", peep->Id.ToUnderlying(), peep->GetName().c_str(), buffer);
-            }
-            else
-            {
-                LOG_INFO("%s", buffer);
-            }
+        if (peep != nullptr)
+        {
+            LOG_INFO_CATEGORY(
+                DiagnosticCategory::Pathfinding, "[%05u:%s] %s", peep->Id.ToUnderlying(), peep->GetName().c_str(), buffer);
+        }
+        else
+        {
+            LOG_INFO_CATEGORY(DiagnosticCategory::Pathfinding, "%s", buffer);
         }
     }
 
@@ -167,12 +172,59 @@ namespace OpenRCT2::PathFinding
         return edges;
     }
 
+    /**
+     * Clears the edges of a path that only lead onto provisional paths. These are only left on the map during the
+     * update when MapKeepsProvisionalElements() is true, otherwise they have already been removed along with the edges.
+     */
+    static int32_t PathClearGhostEdges(const TileCoordsXY& loc, PathElement* pathElement, int32_t edges)
+    {
+        if (!MapKeepsProvisionalElements())
+            return edges;
+
+        // Only the footpath being placed is avoided, so the neighbours need no look up unless an edge leads to its tile
+        if (!(gProvisionalFootpath.Flags & PROVISIONAL_PATH_FLAG_1))
+            return edges;
+        const auto provisionalLoc = TileCoordsXY(gProvisionalFootpath.Position);
+
+        for (Direction direction = 0; direction < NumOrthogonalDirections; direction++)
+        {
+            if (!(edges & (1 << direction)))
+                continue;
+
+            int32_t z = pathElement->BaseHeight;
+            if (pathElement->IsSloped() && pathElement->GetSlopeDirection() == direction)
+                z += 2;
+
+            auto nextLoc = loc + TileDirectionDelta[direction];
+            if (nextLoc != provisionalLoc)
+                continue;
+
+            bool hasGhostPath = false;
+            bool hasPath = false;
+            for (auto* nextPathElement : TileElementsView<PathElement>(nextLoc.ToCoordsXY()))
+            {
+                if (!IsValidPathZAndDirection(nextPathElement->as<TileElement>(), z, direction))
+                    continue;
+                if (nextPathElement->IsGhost())
+                    hasGhostPath = true;
+                else
+                    hasPath = true;
+            }
+            if (hasGhostPath && !hasPath)
+            {
+                edges &= ~(1 << direction);
+            }
+        }
+        return edges;
+    }
+
     /**
      * Gets the connected edges of a path that are permitted (i.e. no 'no entry' signs)
      */
-    static int32_t PathGetPermittedEdges(bool ignoreBanners, PathElement* pathElement)
+    static int32_t PathGetPermittedEdges(bool ignoreBanners, const TileCoordsXY& loc, PathElement* pathElement)
     {
-        return BannerClearPathEdges(ignoreBanners, pathElement, pathElement->GetEdgesAndCorners()) & 0x0F;
+        auto edges = BannerClearPathEdges(ignoreBanners, pathElement, pathElement->GetEdgesAndCorners()) & 0x0F;
+        return PathClearGhostEdges(loc, pathElement, edges);
     }
 
     /**
@@ -444,7 +496,7 @@ namespace OpenRCT2::PathFinding
                     if (tileElement->AsPath()->IsWide())
                         return PathSearchResult::Wide;
 
-                    uint8_t edges = PathGetPermittedEdges(ignoreBanners, tileElement->AsPath());
+                    uint8_t edges = PathGetPermittedEdges(ignoreBanners, loc, tileElement->AsPath());
                     edges &= ~(1 << DirectionReverse(chosenDirection));
                     loc.z = tileElement->BaseHeight;
 
@@ -610,6 +662,43 @@ namespace OpenRCT2::PathFinding
         return isThinJunction;
     }
 
+    /**
+     * Junction classification memo for a single ChooseDirection search. The heuristic search reaches the same
+     * junctions again through different routes and the map cannot change while it runs, so the neighbours of each
+     * path element only need to be checked once. Entries are tagged with the search they belong to rather than being
+     * cleared, a colliding entry is simply replaced.
+     */
+    struct ThinJunctionCacheEntry
+    {
+        const PathElement* Element;
+        uint32_t Search;
+        bool IsThinJunction;
+    };
+
+    static std::array<ThinJunctionCacheEntry, 4096> _thinJunctionCache;
+    static uint32_t _thinJunctionCacheSearch;
+
+    static void ThinJunctionCacheBeginSearch()
+    {
+        _thinJunctionCacheSearch++;
+        if (_thinJunctionCacheSearch == 0)
+        {
+            _thinJunctionCache.fill({});
+            _thinJunctionCacheSearch = 1;
+        }
+    }
+
+    static bool PathIsThinJunctionCached(PathElement* path, const TileCoordsXYZ& loc)
+    {
+        const auto slot = (reinterpret_cast<uintptr_t>(path) / sizeof(TileElement)) % _thinJunctionCache.size();
+        auto& entry = _thinJunctionCache[slot];
+        if (entry.Element != path || entry.Search != _thinJunctionCacheSearch)
+        {
+            entry = { path, _thinJunctionCacheSearch, PathIsThinJunction(path, loc) };
+        }
+        return entry.IsThinJunction;
+    }
+
     static int32_t CalculateHeuristicPathingScore(const TileCoordsXYZ& loc1, const TileCoordsXYZ& loc2)
     {
         auto xDelta = abs(loc1.x - loc2.x) * 32;
@@ -978,7 +1067,7 @@ namespace OpenRCT2::PathFinding
 
             /* Get all the permitted_edges of the map element. */
             Guard::Assert(tileElement->AsPath() != nullptr);
-            uint8_t edges = PathGetPermittedEdges(staff != nullptr, tileElement->AsPath());
+            uint8_t edges = PathGetPermittedEdges(staff != nullptr, loc, tileElement->AsPath());
 
             LogPathfinding(
                 &peep, "Path element at %d,%d,%d; Steps: %u; Edges (0123):%d%d%d%d; Reverse: %d", loc.x >> 5, loc.y >> 5, loc.z,
@@ -1036,7 +1125,7 @@ namespace OpenRCT2::PathFinding
             {
                 /* Check if this is a thin junction. And perform additional
                  * necessary checks. */
-                isThinJunction = PathIsThinJunction(tileElement->AsPath(), loc);
+                isThinJunction = PathIsThinJunctionCached(tileElement->AsPath(), loc);
 
                 if (isThinJunction)
                 {
@@ -1150,7 +1239,7 @@ namespace OpenRCT2::PathFinding
                     height += 2;
                 }
 
-                if constexpr (kLogPathfinding)
+                if (DiagnosticIsCategoryEnabled(DiagnosticCategory::Pathfinding))
                 {
                     if (searchResult == PathSearchResult::Junction)
                     {
@@ -1204,6 +1293,223 @@ namespace OpenRCT2::PathFinding
         }
     }
 
+    /**
+     * Optional flow field cache for destinations that many guests are heading for at once (popular ride entrances,
+     * the park exit). Once a goal has been asked for often enough a breadth first distance map is flooded backwards
+     * from it over the walkable footpath, after which junctions towards that goal are resolved with a lookup instead
+     * of a heuristic search. Guests take different (shortest) routes than the heuristic would choose, so the cache is
+     * opt-in and never used in multiplayer where every client has to make the same decision.
+     *
+     * Fields are dropped whenever a game action changes the map and are rebuilt after kFlowFieldMaxAge ticks to pick
+     * up edits made outside of game actions. A stale field can only pick a worse edge, every candidate edge is still
+     * checked against the current map.
+     */
+    static constexpr uint32_t kFlowFieldMinRequests = 32;
+    static constexpr uint32_t kFlowFieldMaxAge = 2048;
+    static constexpr size_t kFlowFieldMaxFields = 16;
+    static constexpr uint16_t kFlowFieldMaxDistance = 0xFFFE;
+
+    struct FlowField
+    {
+        TileCoordsXYZ Goal;
+        RideId QueueRideIndex;
+        bool IgnoreForeignQueues;
+        bool Built;
+        uint32_t Requests;
+        uint32_t BuiltTick;
+        uint32_t LastUsedTick;
+        std::unordered_map<uint32_t, uint16_t> Distances;
+    };
+
+    static std::vector<FlowField> _flowFields;
+
+    void FlowFieldInvalidateAll()
+    {
+        _flowFields.clear();
+    }
+
+    static bool FlowFieldsEnabled()
+    {
+        return gConfigGeneral.PathfindingFlowFields && NetworkGetMode() == NETWORK_MODE_NONE;
+    }
+
+    static uint32_t FlowFieldKey(int32_t x, int32_t y, int32_t z)
+    {
+        return (static_cast<uint32_t>(x) << 18) | (static_cast<uint32_t>(y) << 8) | static_cast<uint32_t>(z & 0xFF);
+    }
+
+    static bool FlowFieldIsWalkable(const FlowField& field, PathElement* pathElement)
+    {
+        if (pathElement->IsGhost() || pathElement->IsWide())
+            return false;
+        if (field.IgnoreForeignQueues && pathElement->IsQueue() && !pathElement->GetRideIndex().IsNull()
+            && pathElement->GetRideIndex() != field.QueueRideIndex)
+            return false;
+        return true;
+    }
+
+    static int32_t FlowFieldExitHeight(const PathElement* pathElement, Direction direction)
+    {
+        int32_t height = pathElement->BaseHeight;
+        if (pathElement->IsSloped() && pathElement->GetSlopeDirection() == direction)
+            height += 2;
+        return height;
+    }
+
+    /**
+     * Returns true if a guest leaving a path at the given height in the given direction arrives on a walkable
+     * path element at loc.
+     */
+    static bool FlowFieldArrivesAt(const FlowField& field, const TileCoordsXYZ& loc, int32_t height, Direction direction)
+    {
+        for (auto* pathElement : TileElementsView<PathElement>(loc.ToCoordsXY()))
+        {
+            if (pathElement->BaseHeight != loc.z || !FlowFieldIsWalkable(field, pathElement))
+                continue;
+            if (IsValidPathZAndDirection(pathElement->as<TileElement>(), height, direction))
+                return true;
+        }
+        return false;
+    }
+
+    static void FlowFieldBuild(FlowField& field)
+    {
+        PROFILED_FUNCTION();
+
+        field.Distances.clear();
+        field.Distances[FlowFieldKey(field.Goal.x, field.Goal.y, field.Goal.z)] = 0;
+
+        std::vector<TileCoordsXYZ> frontier;
+        std::vector<TileCoordsXYZ> nextFrontier;
+        frontier.push_back(field.Goal);
+
+        for (uint16_t distance = 1; !frontier.empty() && distance <= kFlowFieldMaxDistance; distance++)
+        {
+            for (const auto& loc : frontier)
+            {
+                const bool isGoal = loc == field.Goal;
+                for (Direction direction : ALL_DIRECTIONS)
+                {
+                    // Look for path elements that lead onto loc when walking in direction.
+                    const auto fromLoc = TileCoordsXY{ loc } + TileDirectionDelta[DirectionReverse(direction)];
+                    if (!MapIsLocationValid(fromLoc.ToCoordsXY()))
+                        continue;
+
+                    for (auto* pathElement : TileElementsView<PathElement>(fromLoc.ToCoordsXY()))
+                    {
+                        if (!FlowFieldIsWalkable(field, pathElement))
+                            continue;
+                        if (!(PathGetPermittedEdges(false, fromLoc, pathElement) & (1 << direction)))
+                            continue;
+
+                        const auto key = FlowFieldKey(fromLoc.x, fromLoc.y, pathElement->BaseHeight);
+                        if (field.Distances.count(key) != 0)
+                            continue;
+
+                        const auto height = FlowFieldExitHeight(pathElement, direction);
+                        // The goal itself does not have to be a path, e.g. a ride or park entrance.
+                        if (!(isGoal && height == loc.z) && !FlowFieldArrivesAt(field, loc, height, direction))
+                            continue;
+
+                        field.Distances.emplace(key, distance);
+                        nextFrontier.emplace_back(fromLoc, pathElement->BaseHeight);
+                    }
+                }
+            }
+            std::swap(frontier, nextFrontier);
+            nextFrontier.clear();
+        }
+
+        field.Built = true;
+        field.BuiltTick = GetGameState().CurrentTicks;
+    }
+
+    static FlowField* FlowFieldGet(const TileCoordsXYZ& goal)
+    {
+        const auto currentTicks = GetGameState().CurrentTicks;
+        auto it = std::find_if(_flowFields.begin(), _flowFields.end(), [&goal](const FlowField& field) {
+            return field.Goal == goal && field.QueueRideIndex == gPeepPathFindQueueRideIndex
+                && field.IgnoreForeignQueues == gPeepPathFindIgnoreForeignQueues;
+        });
+        if (it == _flowFields.end())
+        {
+            if (_flowFields.size() >= kFlowFieldMaxFields)
+            {
+                // Replace the field that has gone unused for the longest.
+                it = std::min_element(_flowFields.begin(), _flowFields.end(), [](const FlowField& a, const FlowField& b) {
+                    return a.LastUsedTick < b.LastUsedTick;
+                });
+                *it = {};
+            }
+            else
+            {
+                it = _flowFields.insert(_flowFields.end(), FlowField{});
+            }
+            it->Goal = goal;
+            it->QueueRideIndex = gPeepPathFindQueueRideIndex;
+            it->IgnoreForeignQueues = gPeepPathFindIgnoreForeignQueues;
+        }
+
+        auto& field = *it;
+        field.LastUsedTick = currentTicks;
+        if (field.Built && currentTicks - field.BuiltTick > kFlowFieldMaxAge)
+        {
+            field.Built = false;
+            field.Requests = 0;
+        }
+        if (!field.Built)
+        {
+            if (++field.Requests < kFlowFieldMinRequests)
+                return nullptr;
+            FlowFieldBuild(field);
+        }
+        return &field;
+    }
+
+    /**
+     * Picks the edge out of edges that is closest to goal according to its flow field.
+     * Returns INVALID_DIRECTION if flow fields are disabled, the goal is not targeted often enough yet, or none of the
+     * edges lead towards the goal.
+     */
+    static Direction FlowFieldChooseDirection(
+        const TileCoordsXYZ& loc, const TileCoordsXYZ& goal, const PathElement* pathElement, uint8_t edges)
+    {
+        if (!FlowFieldsEnabled())
+            return INVALID_DIRECTION;
+
+        auto* field = FlowFieldGet(goal);
+        if (field == nullptr)
+            return INVALID_DIRECTION;
+
+        Direction bestDirection = INVALID_DIRECTION;
+        uint32_t bestDistance = std::numeric_limits<uint32_t>::max();
+        for (Direction direction : ALL_DIRECTIONS)
+        {
+            if (!(edges & (1 << direction)))
+                continue;
+
+            const auto height = FlowFieldExitHeight(pathElement, direction);
+            const auto nextLoc = TileCoordsXY{ loc } + TileDirectionDelta[direction];
+            if (nextLoc == TileCoordsXY{ goal } && height == goal.z)
+                return direction;
+
+            for (auto* nextPathElement : TileElementsView<PathElement>(nextLoc.ToCoordsXY()))
+            {
+                if (!FlowFieldIsWalkable(*field, nextPathElement)
+                    || !IsValidPathZAndDirection(nextPathElement->as<TileElement>(), height, direction))
+                    continue;
+
+                auto it = field->Distances.find(FlowFieldKey(nextLoc.x, nextLoc.y, nextPathElement->BaseHeight));
+                if (it != field->Distances.end() && it->second < bestDistance)
+                {
+                    bestDistance = it->second;
+                    bestDirection = direction;
+                }
+            }
+        }
+        return bestDirection;
+    }
+
     /**
      * Returns:
      *   -1   - no direction chosen
@@ -1215,6 +1521,8 @@ namespace OpenRCT2::PathFinding
     {
         PROFILED_FUNCTION();
 
+        ThinJunctionCacheBeginSearch();
+
         // The max number of thin junctions searched - a per-search-path limit.
         _peepPathFindMaxJunctions = PeepPathfindGetMaxNumberJunctions(peep);
 
@@ -1266,10 +1574,10 @@ namespace OpenRCT2::PathFinding
              * check if the combination is 'thin'!
              * The junction is considered 'thin' simply if any of the
              * overlaid path elements there is a 'thin junction'. */
-            isThin = isThin || PathIsThinJunction(destTileElement->AsPath(), loc);
+            isThin = isThin || PathIsThinJunctionCached(destTileElement->AsPath(), loc);
 
             // Collect the permitted edges of ALL matching path elements at this location.
-            permittedEdges |= PathGetPermittedEdges(peep.Is<Staff>(), destTileElement->AsPath());
+            permittedEdges |= PathGetPermittedEdges(peep.Is<Staff>(), loc, destTileElement->AsPath());
         } while (!(destTileElement++)->IsLastForTile());
         // Peep is not on a path.
         if (!found)
@@ -1353,8 +1661,19 @@ namespace OpenRCT2::PathFinding
 
         int32_t chosenEdge = UtilBitScanForward(edges);
 
+        Direction flowFieldEdge = INVALID_DIRECTION;
+        if ((edges & ~(1 << chosenEdge)) && peep.Is<Guest>())
+        {
+            flowFieldEdge = FlowFieldChooseDirection(loc, goal, firstTileElement->AsPath(), edges);
+        }
+
+        if (flowFieldEdge != INVALID_DIRECTION)
+        {
+            chosenEdge = flowFieldEdge;
+            LogPathfinding(&peep, "Flow field edge %d for goal %d,%d,%d", chosenEdge, goal.x, goal.y, goal.z);
+        }
         // Peep has multiple edges still to try.
-        if (edges & ~(1 << chosenEdge))
+        else if (edges & ~(1 << chosenEdge))
         {
             uint8_t bestJunctions = 0;
             TileCoordsXYZ bestJunctionList[16];
@@ -1440,7 +1759,7 @@ namespace OpenRCT2::PathFinding
                     { loc.x, loc.y, height }, goal, peep, firstTileElement, inPatrolArea, 0, &score, testEdge, &endJunctions,
                     endJunctionList, endDirectionList, &endXYZ, &endSteps);
 
-                if constexpr (kLogPathfinding)
+                if (DiagnosticIsCategoryEnabled(DiagnosticCategory::Pathfinding))
                 {
                     LogPathfinding(
                         &peep, "Pathfind test edge: %d score: %d steps: %d end: %d,%d,%d junctions: %d", testEdge, score,
@@ -1459,7 +1778,7 @@ namespace OpenRCT2::PathFinding
                     bestScore = score;
                     bestSub = endSteps;
 
-                    if constexpr (kLogPathfinding)
+                    if (DiagnosticIsCategoryEnabled(DiagnosticCategory::Pathfinding))
                     {
                         bestJunctions = endJunctions;
                         for (uint8_t index = 0; index < endJunctions; index++)
@@ -1485,7 +1804,7 @@ namespace OpenRCT2::PathFinding
                 return INVALID_DIRECTION;
             }
 
-            if constexpr (kLogPathfinding)
+            if (DiagnosticIsCategoryEnabled(DiagnosticCategory::Pathfinding))
             {
                 LogPathfinding(&peep, "Pathfind best edge %d with score %d steps %d", chosenEdge, bestScore, bestSub);
                 for (uint8_t listIdx = 0; listIdx < bestJunctions; listIdx++)
@@ -1538,6 +1857,148 @@ namespace OpenRCT2::PathFinding
         return chosenEdge;
     }
 
+    /**
+     * Path regions label every path element with the connected component of the footpath network it belongs to, as
+     * walked by guests heading for the park exit or a peep spawn. Picking the nearest goal that shares the guest's
+     * region first means the heuristic search is only ever asked for a goal it can actually reach, instead of a closer
+     * one on the other side of a fence that leaves the guest looping around the park.
+     *
+     * Regions are marked stale alongside the flow fields and are rebuilt at most every kPathRegionsMinAge ticks, a
+     * stale labelling only influences which goal is picked. Guests pick different goals than they would otherwise, so
+     * the regions are opt-in and never used in multiplayer.
+     */
+    static constexpr uint32_t kPathRegionsMinAge = 64;
+    static constexpr uint32_t kPathRegionNone = 0;
+
+    struct PathRegions
+    {
+        bool Built;
+        bool Stale;
+        uint32_t BuiltTick;
+        std::unordered_map<uint32_t, uint32_t> Labels;
+    };
+
+    static PathRegions _pathRegions;
+
+    void PathRegionsInvalidate()
+    {
+        _pathRegions.Stale = true;
+    }
+
+    static bool PathRegionsEnabled()
+    {
+        return gConfigGeneral.PathfindingRegions && NetworkGetMode() == NETWORK_MODE_NONE;
+    }
+
+    static bool PathRegionIsWalkable(const PathElement* pathElement)
+    {
+        if (pathElement->IsGhost())
+            return false;
+        // Guests heading for the exit or a spawn ignore all ride queues.
+        return !pathElement->IsQueue() || pathElement->GetRideIndex().IsNull();
+    }
+
+    static void PathRegionsFlood(const TileCoordsXYZ& start, uint32_t label)
+    {
+        std::vector<TileCoordsXYZ> frontier;
+        frontier.push_back(start);
+        _pathRegions.Labels[FlowFieldKey(start.x, start.y, start.z)] = label;
+        while (!frontier.empty())
+        {
+            const auto loc = frontier.back();
+            frontier.pop_back();
+
+            auto* pathElement = MapGetPathElementAt(loc);
+            if (pathElement == nullptr)
+                continue;
+
+            const uint8_t edges = PathGetPermittedEdges(false, loc, pathElement);
+            for (Direction direction : ALL_DIRECTIONS)
+            {
+                if (!(edges & (1 << direction)))
+                    continue;
+
+                const auto nextLoc = TileCoordsXY{ loc } + TileDirectionDelta[direction];
+                if (!MapIsLocationValid(nextLoc.ToCoordsXY()))
+                    continue;
+
+                const auto height = FlowFieldExitHeight(pathElement, direction);
+                for (auto* nextPathElement : TileElementsView<PathElement>(nextLoc.ToCoordsXY()))
+                {
+                    if (!PathRegionIsWalkable(nextPathElement))
+                        continue;
+                    if (!IsValidPathZAndDirection(nextPathElement->as<TileElement>(), height, direction))
+                        continue;
+
+                    const auto key = FlowFieldKey(nextLoc.x, nextLoc.y, nextPathElement->BaseHeight);
+                    if (_pathRegions.Labels.emplace(key, label).second)
+                    {
+                        frontier.emplace_back(nextLoc, nextPathElement->BaseHeight);
+                    }
+                }
+            }
+        }
+    }
+
+    static void PathRegionsBuild()
+    {
+        PROFILED_FUNCTION();
+
+        _pathRegions.Labels.clear();
+        uint32_t nextLabel = kPathRegionNone + 1;
+        const auto& mapSize = GetGameState().MapSize;
+        const auto mapRange = MapRange{ 0, 0, (mapSize.x - 1) * COORDS_XY_STEP, (mapSize.y - 1) * COORDS_XY_STEP };
+        for (auto [loc, pathElement] : TileElementsRangeView<PathElement>(mapRange))
+        {
+            if (!PathRegionIsWalkable(pathElement))
+                continue;
+            if (_pathRegions.Labels.count(FlowFieldKey(loc.x, loc.y, pathElement->BaseHeight)) != 0)
+                continue;
+            PathRegionsFlood({ loc.x, loc.y, pathElement->BaseHeight }, nextLabel++);
+        }
+
+        _pathRegions.Built = true;
+        _pathRegions.Stale = false;
+        _pathRegions.BuiltTick = GetGameState().CurrentTicks;
+    }
+
+    static bool PathRegionsPrepare()
+    {
+        if (!PathRegionsEnabled())
+        {
+            if (_pathRegions.Built)
+                _pathRegions = {};
+            return false;
+        }
+        if (!_pathRegions.Built
+            || (_pathRegions.Stale && GetGameState().CurrentTicks - _pathRegions.BuiltTick >= kPathRegionsMinAge))
+        {
+            PathRegionsBuild();
+        }
+        return true;
+    }
+
+    static uint32_t PathRegionAt(const TileCoordsXY& loc, int32_t baseHeight)
+    {
+        auto it = _pathRegions.Labels.find(FlowFieldKey(loc.x, loc.y, baseHeight));
+        return it != _pathRegions.Labels.end() ? it->second : kPathRegionNone;
+    }
+
+    /**
+     * A park entrance joins the paths in front of and behind it, either of which may lead up to it on a slope.
+     */
+    static bool ParkEntranceIsInRegion(const CoordsXYZD& entrance, uint32_t region)
+    {
+        const TileCoordsXYZ entranceLoc{ entrance };
+        for (auto direction : { entrance.direction, DirectionReverse(entrance.direction) })
+        {
+            const auto loc = TileCoordsXY{ entranceLoc } + TileDirectionDelta[direction];
+            if (PathRegionAt(loc, entranceLoc.z) == region || PathRegionAt(loc, entranceLoc.z - 2) == region)
+                return true;
+        }
+        return false;
+    }
+
     /**
      * Gets the nearest park entrance relative to point, by using Manhattan distance.
      * @param x x coordinate of location
@@ -1560,6 +2021,36 @@ namespace OpenRCT2::PathFinding
         return chosenEntrance;
     }
 
+    /**
+     * Gets the nearest park entrance the guest can walk to, or the nearest one overall if the path regions are not in use
+     * or none of the entrances are reachable.
+     */
+    static std::optional<CoordsXYZ> GetNearestReachableParkEntrance(const Peep& peep)
+    {
+        const TileCoordsXYZ loc{ peep.NextLoc };
+        const auto region = PathRegionsPrepare() ? PathRegionAt(loc, loc.z) : kPathRegionNone;
+        if (region != kPathRegionNone)
+        {
+            std::optional<CoordsXYZ> chosenEntrance = std::nullopt;
+            uint16_t nearestDist = 0xFFFF;
+            for (const auto& parkEntrance : GetGameState().Park.Entrances)
+            {
+                if (!ParkEntranceIsInRegion(parkEntrance, region))
+                    continue;
+
+                auto dist = abs(parkEntrance.x - peep.NextLoc.x) + abs(parkEntrance.y - peep.NextLoc.y);
+                if (dist < nearestDist)
+                {
+                    nearestDist = dist;
+                    chosenEntrance = parkEntrance;
+                }
+            }
+            if (chosenEntrance.has_value())
+                return chosenEntrance;
+        }
+        return GetNearestParkEntrance(peep.NextLoc);
+    }
+
     /**
      *
      *  rct2: 0x006952C0
@@ -1567,7 +2058,7 @@ namespace OpenRCT2::PathFinding
     int32_t GuestPathFindParkEntranceEntering(Peep& peep, uint8_t edges)
     {
         // Send peeps to the nearest park entrance.
-        auto chosenEntrance = GetNearestParkEntrance(peep.NextLoc);
+        auto chosenEntrance = GetNearestReachableParkEntrance(peep);
 
         // If no defined park entrances are found, walk aimlessly.
         if (!chosenEntrance.has_value())
@@ -1609,6 +2100,39 @@ namespace OpenRCT2::PathFinding
         return chosenSpawn;
     }
 
+    /**
+     * Gets the nearest peep spawn the guest can walk to, or the nearest one overall if the path regions are not in use or
+     * none of the spawns are reachable.
+     */
+    static uint8_t GetNearestReachablePeepSpawnIndex(const Peep& peep)
+    {
+        const TileCoordsXYZ loc{ peep.NextLoc };
+        const auto region = PathRegionsPrepare() ? PathRegionAt(loc, loc.z) : kPathRegionNone;
+        if (region != kPathRegionNone)
+        {
+            uint8_t chosenSpawn = 0xFF;
+            uint16_t nearestDist = 0xFFFF;
+            uint8_t i = 0;
+            for (const auto& spawn : GetGameState().PeepSpawns)
+            {
+                const TileCoordsXYZ spawnLoc{ spawn };
+                if (PathRegionAt(spawnLoc, spawnLoc.z) == region)
+                {
+                    uint16_t dist = abs(spawn.x - peep.NextLoc.x) + abs(spawn.y - peep.NextLoc.y);
+                    if (dist < nearestDist)
+                    {
+                        nearestDist = dist;
+                        chosenSpawn = i;
+                    }
+                }
+                i++;
+            }
+            if (chosenSpawn != 0xFF)
+                return chosenSpawn;
+        }
+        return GetNearestPeepSpawnIndex(peep.NextLoc.x, peep.NextLoc.y);
+    }
+
     /**
      *
      *  rct2: 0x0069536C
@@ -1616,7 +2140,7 @@ namespace OpenRCT2::PathFinding
     int32_t GuestPathFindPeepSpawn(Peep& peep, uint8_t edges)
     {
         // Send peeps to the nearest spawn point.
-        uint8_t chosenSpawn = GetNearestPeepSpawnIndex(peep.NextLoc.x, peep.NextLoc.y);
+        uint8_t chosenSpawn = GetNearestReachablePeepSpawnIndex(peep);
 
         // If no defined spawns were found, walk aimlessly.
         if (chosenSpawn == 0xFF)
@@ -1661,7 +2185,7 @@ namespace OpenRCT2::PathFinding
 
         if (!(peep.PeepFlags & PEEP_FLAGS_PARK_ENTRANCE_CHOSEN))
         {
-            auto chosenEntrance = GetNearestParkEntrance(peep.NextLoc);
+            auto chosenEntrance = GetNearestReachableParkEntrance(peep);
 
             if (!chosenEntrance.has_value())
                 return GuestPathfindAimless(peep, edges);
@@ -1861,6 +2385,86 @@ namespace OpenRCT2::PathFinding
 
         return StationIndex::FromUnderlying(0);
     }
+
+    /**
+     * Queue lanes remember, for each plain stretch of queue, the two edges that lead back down the queue and on towards
+     * the ride. Only queue tiles with exactly those two permitted edges and no wide path on either side become
+     * slots; on those the generic decision always picks the edge the guest did not come from, so queuing guests
+     * advance through the slots without looking at the map. Anything else, such as a junction, falls back to the
+     * generic decision.
+     *
+     * Slots are dropped alongside the flow fields and after kQueueLaneMaxAge ticks to pick up edits made outside of
+     * game actions. A slot that goes stale could send a guest over a removed path until its next path check, so the
+     * lanes are opt-in and not used in multiplayer.
+     */
+    static constexpr uint32_t kQueueLaneMaxAge = 2048;
+
+    struct QueueLaneSlot
+    {
+        std::array<Direction, 2> Edges;
+        uint32_t BuiltTick;
+    };
+
+    static std::unordered_map<uint32_t, std::optional<QueueLaneSlot>> _queueLaneSlots;
+
+    void QueueLanesInvalidateAll()
+    {
+        _queueLaneSlots.clear();
+    }
+
+    static bool QueueLanesEnabled()
+    {
+        return gConfigGeneral.QueuePathLanes && NetworkGetMode() == NETWORK_MODE_NONE;
+    }
+
+    static std::optional<QueueLaneSlot> QueueLaneBuildSlot(const TileCoordsXYZ& loc)
+    {
+        auto* pathElement = MapGetPathElementAt(loc);
+        if (pathElement == nullptr || !pathElement->IsQueue())
+            return std::nullopt;
+
+        const uint8_t edges = PathGetPermittedEdges(false, loc, pathElement);
+        if (BitCount(edges) != 2)
+            return std::nullopt;
+
+        std::array<Direction, 2> directions{};
+        size_t numDirections = 0;
+        for (Direction direction : ALL_DIRECTIONS)
+        {
+            if (!(edges & (1 << direction)))
+                continue;
+            if (FootpathElementNextInDirection(loc, pathElement, direction) == PathSearchResult::Wide)
+                return std::nullopt;
+            directions[numDirections++] = direction;
+        }
+        return QueueLaneSlot{ directions, GetGameState().CurrentTicks };
+    }
+
+    /**
+     * Returns the edge the queuing guest moves on to, or nothing if the generic decision has to be made.
+     */
+    static std::optional<Direction> QueueLaneNextDirection(const Guest& peep, const TileCoordsXYZ& loc)
+    {
+        const auto currentTicks = GetGameState().CurrentTicks;
+        const auto key = FlowFieldKey(loc.x, loc.y, loc.z);
+        auto it = _queueLaneSlots.find(key);
+        if (it == _queueLaneSlots.end() || (it->second.has_value() && currentTicks - it->second->BuiltTick > kQueueLaneMaxAge))
+        {
+            it = _queueLaneSlots.insert_or_assign(key, QueueLaneBuildSlot(loc)).first;
+        }
+        if (!it->second.has_value())
+            return std::nullopt;
+
+        // The slot's edges are unordered, the guest continues on whichever one it did not arrive from.
+        const auto& slot = *it->second;
+        const Direction cameFrom = DirectionReverse(peep.PeepDirection);
+        if (cameFrom == slot.Edges[0])
+            return slot.Edges[1];
+        if (cameFrom == slot.Edges[1])
+            return slot.Edges[0];
+        return std::nullopt;
+    }
+
     /**
      *
      *  rct2: 0x00694C35
@@ -1876,6 +2480,16 @@ namespace OpenRCT2::PathFinding
 
         TileCoordsXYZ loc{ peep.NextLoc };
 
+        if (peep.State == PeepState::Queuing && QueueLanesEnabled())
+        {
+            if (auto direction = QueueLaneNextDirection(peep, loc); direction.has_value())
+            {
+                LogPathfinding(&peep, "Completed CalculateNextDestination - following queue lane: %d.", *direction);
+
+                return PeepMoveOneTile(*direction, peep);
+            }
+        }
+
         auto* pathElement = MapGetPathElementAt(loc);
         if (pathElement == nullptr)
         {
@@ -1883,7 +2497,7 @@ namespace OpenRCT2::PathFinding
         }
 
         // Because this function is called for guests only, never ignore banners.
-        uint8_t edges = PathGetPermittedEdges(false, pathElement);
+        uint8_t edges = PathGetPermittedEdges(false, loc, pathElement);
 
         if (edges == 0)
         {
@@ -46,4 +46,11 @@ namespace OpenRCT2::PathFinding
 
     bool IsValidPathZAndDirection(TileElement* tileElement, int32_t currentZ, int32_t currentDirection);
 
+    // Drops all cached flow fields, must be called whenever footpaths may have changed.
+    void FlowFieldInvalidateAll();
+    // Drops all cached queue lane slots, must be called whenever footpaths may have changed.
+    void QueueLanesInvalidateAll();
+    // Marks the path regions stale, must be called whenever footpaths may have changed.
+    void PathRegionsInvalidate();
+
 }; // namespace OpenRCT2::PathFinding
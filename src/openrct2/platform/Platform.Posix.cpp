@@ -29,6 +29,7 @@
 #    include <pwd.h>
 #    include <sys/stat.h>
 #    include <sys/time.h>
+#    include <sys/wait.h>
 #    include <unistd.h>
 
 // The name of the mutex used to prevent multiple instances of the game from running
@@ -133,7 +134,7 @@ namespace Platform
             size_t readBytes;
             while ((readBytes = fread(buffer, 1, sizeof(buffer), fpipe)) > 0)
             {
-                outputBuffer.insert(outputBuffer.begin(), buffer, buffer + readBytes);
+                outputBuffer.insert(outputBuffer.end(), buffer, buffer + readBytes);
             }
 
             // Trim line breaks
@@ -166,6 +167,90 @@ namespace Platform
 #    endif // __EMSCRIPTEN__
     }
 
+    int32_t Execute(const std::vector<std::string>& arguments, std::string* output)
+    {
+#    ifndef __EMSCRIPTEN__
+        if (arguments.empty())
+        {
+            return -1;
+        }
+        LOG_VERBOSE("executing \"%s\"...", arguments[0].c_str());
+
+        // Built before forking, the child may only make async-signal-safe calls when other threads are running
+        std::vector<char*> argv;
+        for (const auto& argument : arguments)
+        {
+            argv.push_back(const_cast<char*>(argument.c_str()));
+        }
+        argv.push_back(nullptr);
+
+        int fds[2];
+        if (pipe(fds) != 0)
+        {
+            return -1;
+        }
+        // Processes started from other threads at the same time must not inherit the pipe, it would not be closed
+        // until they exit
+        fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+        fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+
+        const pid_t pid = fork();
+        if (pid == -1)
+        {
+            close(fds[0]);
+            close(fds[1]);
+            return -1;
+        }
+        if (pid == 0)
+        {
+            dup2(fds[1], STDOUT_FILENO);
+            dup2(fds[1], STDERR_FILENO);
+            execvp(argv[0], argv.data());
+            _exit(127);
+        }
+        close(fds[1]);
+
+        std::string result;
+        char buffer[1024];
+        for (;;)
+        {
+            const auto readBytes = read(fds[0], buffer, sizeof(buffer));
+            if (readBytes > 0)
+            {
+                result.append(buffer, readBytes);
+            }
+            else if (readBytes == 0 || errno != EINTR)
+            {
+                break;
+            }
+        }
+        close(fds[0]);
+
+        int status = 0;
+        while (waitpid(pid, &status, 0) == -1)
+        {
+            if (errno != EINTR)
+            {
+                return -1;
+            }
+        }
+
+        if (output != nullptr)
+        {
+            // Trim line breaks
+            while (!result.empty() && result.back() == '\n')
+            {
+                result.pop_back();
+            }
+            *output = std::move(result);
+        }
+        return status;
+#    else
+        LOG_WARNING("Emscripten cannot execute processes. The program was '%s'.", arguments.front().c_str());
+        return -1;
+#    endif // __EMSCRIPTEN__
+    }
+
     uint64_t GetLastModified(std::string_view path)
     {
         uint64_t lastModified = 0;
@@ -14,6 +14,7 @@
 
 #include <ctime>
 #include <string>
+#include <vector>
 
 #ifdef _WIN32
 #    define PATH_SEPARATOR u8"\\"
@@ -83,6 +84,9 @@ namespace Platform
 #if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__)) || defined(__FreeBSD__)
     std::string GetEnvironmentPath(const char* name);
     std::string GetHomePath();
+    // Runs the program directly instead of through the shell, so the arguments need no quoting. The output includes
+    // what the program writes to its standard error.
+    int32_t Execute(const std::vector<std::string>& arguments, std::string* output = nullptr);
 #endif
 #ifndef NO_TTF
     std::string GetFontPath(const TTFFontDescriptor& font);
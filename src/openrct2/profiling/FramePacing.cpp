@@ -0,0 +1,178 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include "FramePacing.h"
+
+#include "../Context.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <optional>
+#include <vector>
+
+namespace OpenRCT2::FramePacing
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    // Everything here is only used by the thread running the game loop.
+    static std::array<FrameSample, kMaxFrameSamples> _samples;
+    static size_t _samplesWritten{};
+
+    static int32_t _refreshRate{};
+    static Clock::time_point _phaseStart = Clock::now();
+    static std::optional<Clock::time_point> _lastPresent;
+    static std::optional<Clock::time_point> _oldestPendingInput;
+    static std::array<float, kPhaseCount> _phaseMs{};
+
+    static float ToMilliseconds(Clock::duration duration)
+    {
+        return std::chrono::duration<float, std::milli>(duration).count();
+    }
+
+    std::string_view GetPhaseName(Phase phase)
+    {
+        switch (phase)
+        {
+            case Phase::Events:
+                return "events";
+            case Phase::GameTicks:
+                return "game_ticks";
+            case Phase::UiUpdate:
+                return "ui_update";
+            case Phase::Paint:
+                return "paint";
+            case Phase::Present:
+                return "present";
+            case Phase::Sleep:
+                return "sleep";
+            default:
+                return "none";
+        }
+    }
+
+    void SetRefreshRate(int32_t refreshRate)
+    {
+        _refreshRate = std::max(refreshRate, 0);
+    }
+
+    void RecordInput(uint32_t ageMs)
+    {
+        const auto received = Clock::now() - std::chrono::milliseconds(ageMs);
+        if (!_oldestPendingInput.has_value() || received < *_oldestPendingInput)
+        {
+            _oldestPendingInput = received;
+        }
+    }
+
+    void EndPhase(Phase phase)
+    {
+        const auto now = Clock::now();
+        _phaseMs[static_cast<size_t>(phase)] += ToMilliseconds(now - _phaseStart);
+        _phaseStart = now;
+    }
+
+    void RecordPresent(bool variableFrame)
+    {
+        EndPhase(Phase::Present);
+        const auto now = _phaseStart;
+
+        if (_lastPresent.has_value())
+        {
+            FrameSample sample;
+            sample.IntervalMs = ToMilliseconds(now - *_lastPresent);
+            sample.TargetMs = variableFrame && _refreshRate > 0 ? 1000.0f / _refreshRate : kGameUpdateTimeMS * 1000.0f;
+            sample.PhaseMs = _phaseMs;
+            if (_oldestPendingInput.has_value())
+            {
+                sample.InputLatencyMs = ToMilliseconds(now - *_oldestPendingInput);
+            }
+            if (sample.IntervalMs > sample.TargetMs * 1.5f)
+            {
+                sample.Missed = true;
+                const auto longest = std::max_element(_phaseMs.begin(), _phaseMs.end());
+                sample.MissReason = static_cast<Phase>(std::distance(_phaseMs.begin(), longest));
+            }
+            _samples[_samplesWritten % kMaxFrameSamples] = sample;
+            _samplesWritten++;
+        }
+
+        _lastPresent = now;
+        _oldestPendingInput.reset();
+        _phaseMs.fill(0.0f);
+    }
+
+    static float Percentile(std::vector<float>& values, float percentile)
+    {
+        if (values.empty())
+            return 0.0f;
+
+        const auto index = static_cast<size_t>(percentile * (values.size() - 1));
+        std::nth_element(values.begin(), values.begin() + index, values.end());
+        return values[index];
+    }
+
+    Summary GetSummary()
+    {
+        Summary summary;
+        const auto count = std::min(_samplesWritten, kMaxFrameSamples);
+        if (count == 0)
+            return summary;
+
+        std::vector<float> intervals;
+        std::vector<float> latencies;
+        intervals.reserve(count);
+        double total = 0.0;
+        double totalLatency = 0.0;
+        for (size_t i = 0; i < count; i++)
+        {
+            const auto& sample = _samples[i];
+            intervals.push_back(sample.IntervalMs);
+            total += sample.IntervalMs;
+            summary.MaxMs = std::max(summary.MaxMs, sample.IntervalMs);
+            if (sample.Missed)
+            {
+                summary.Missed++;
+                summary.MissedByPhase[static_cast<size_t>(sample.MissReason)]++;
+            }
+            if (sample.InputLatencyMs >= 0.0f)
+            {
+                latencies.push_back(sample.InputLatencyMs);
+                totalLatency += sample.InputLatencyMs;
+                summary.InputLatencyMaxMs = std::max(summary.InputLatencyMaxMs, sample.InputLatencyMs);
+            }
+        }
+
+        summary.Frames = static_cast<uint32_t>(count);
+        const auto mean = total / count;
+        double variance = 0.0;
+        for (auto interval : intervals)
+        {
+            variance += (interval - mean) * (interval - mean);
+        }
+        summary.MeanMs = static_cast<float>(mean);
+        summary.StdDevMs = static_cast<float>(std::sqrt(variance / count));
+        summary.P99Ms = Percentile(intervals, 0.99f);
+
+        summary.InputSamples = static_cast<uint32_t>(latencies.size());
+        if (!latencies.empty())
+        {
+            summary.InputLatencyMeanMs = static_cast<float>(totalLatency / latencies.size());
+            summary.InputLatencyP95Ms = Percentile(latencies, 0.95f);
+        }
+        return summary;
+    }
+
+    void Reset()
+    {
+        _samplesWritten = 0;
+        _lastPresent.reset();
+        _oldestPendingInput.reset();
+        _phaseMs.fill(0.0f);
+    }
+} // namespace OpenRCT2::FramePacing
@@ -0,0 +1,79 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace OpenRCT2::FramePacing
+{
+    // The parts of the game loop that the time between two presented frames is spent in.
+    enum class Phase : uint8_t
+    {
+        Events,
+        GameTicks,
+        UiUpdate,
+        Paint,
+        Present,
+        Sleep,
+        Count,
+    };
+
+    constexpr size_t kPhaseCount = static_cast<size_t>(Phase::Count);
+    constexpr size_t kMaxFrameSamples = 1024;
+
+    struct FrameSample
+    {
+        float IntervalMs{};
+        float TargetMs{};
+        std::array<float, kPhaseCount> PhaseMs{};
+        // Time from the oldest input event handled in the frame to the frame being presented, negative if none.
+        float InputLatencyMs = -1.0f;
+        bool Missed{};
+        // Phase that took the longest in a missed frame.
+        Phase MissReason = Phase::Count;
+    };
+
+    struct Summary
+    {
+        uint32_t Frames{};
+        float MeanMs{};
+        float StdDevMs{};
+        float P99Ms{};
+        float MaxMs{};
+        uint32_t Missed{};
+        std::array<uint32_t, kPhaseCount> MissedByPhase{};
+        uint32_t InputSamples{};
+        float InputLatencyMeanMs{};
+        float InputLatencyP95Ms{};
+        float InputLatencyMaxMs{};
+    };
+
+    std::string_view GetPhaseName(Phase phase);
+
+    // Refresh rate of the display the window is on, 0 if unknown.
+    void SetRefreshRate(int32_t refreshRate);
+
+    // Called for every input event when it is taken from the queue, age is how long it waited in the queue.
+    void RecordInput(uint32_t ageMs);
+
+    // Accounts the time since the previous call to the given phase.
+    void EndPhase(Phase phase);
+
+    // Closes the frame once the drawing engine has presented it. A frame misses its deadline when it takes more
+    // than one and a half refresh intervals, or game ticks for fixed frames.
+    void RecordPresent(bool variableFrame);
+
+    // Frame time statistics over the most recent kMaxFrameSamples frames.
+    Summary GetSummary();
+
+    void Reset();
+} // namespace OpenRCT2::FramePacing
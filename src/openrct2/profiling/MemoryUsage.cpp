@@ -0,0 +1,116 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include "MemoryUsage.h"
+
+#include "../Context.h"
+#include "../GameStateSnapshots.h"
+#include "../drawing/Drawing.h"
+#include "../drawing/IDrawingEngine.h"
+#include "../drawing/TTF.h"
+#include "../entity/EntityList.h"
+#include "../network/network.h"
+#include "../object/ObjectManager.h"
+#include "../util/Util.h"
+#include "../world/Map.h"
+
+#include <algorithm>
+#include <array>
+
+namespace OpenRCT2::MemoryUsage
+{
+    static std::array<size_t, EnumValue(Subsystem::Count)> _peakBytes{};
+
+    static size_t Measure(Subsystem id)
+    {
+        auto* context = GetContext();
+        switch (id)
+        {
+            case Subsystem::TileElements:
+                return MapGetMemoryUsage();
+            case Subsystem::Entities:
+                return GetEntityMemoryUsage();
+            case Subsystem::SpatialIndex:
+                return GetEntitySpatialIndexMemoryUsage();
+            case Subsystem::ObjectImages:
+                return ObjectManagerGetImageMemoryUsage() + GfxGetImageListMemoryUsage();
+            case Subsystem::G1:
+                return GfxGetG1MemoryUsage();
+            case Subsystem::TrueTypeFonts:
+                return TTFGetMemoryUsage();
+            case Subsystem::DrawingEngine:
+            {
+                auto* drawingEngine = context != nullptr ? context->GetDrawingEngine() : nullptr;
+                return drawingEngine != nullptr ? drawingEngine->GetMemoryUsage() : 0;
+            }
+            case Subsystem::Network:
+                return NetworkGetMemoryUsage();
+            case Subsystem::Snapshots:
+            {
+                auto* snapshots = context != nullptr ? context->GetGameStateSnapshots() : nullptr;
+                return snapshots != nullptr ? snapshots->GetMemoryUsage() : 0;
+            }
+            default:
+                return 0;
+        }
+    }
+
+    std::string_view GetSubsystemName(Subsystem id)
+    {
+        switch (id)
+        {
+            case Subsystem::TileElements:
+                return "tile_elements";
+            case Subsystem::Entities:
+                return "entities";
+            case Subsystem::SpatialIndex:
+                return "spatial_index";
+            case Subsystem::ObjectImages:
+                return "object_images";
+            case Subsystem::G1:
+                return "g1";
+            case Subsystem::TrueTypeFonts:
+                return "ttf";
+            case Subsystem::DrawingEngine:
+                return "drawing_engine";
+            case Subsystem::Network:
+                return "network";
+            case Subsystem::Snapshots:
+                return "snapshots";
+            default:
+                return "unknown";
+        }
+    }
+
+    std::vector<SubsystemUsage> Collect()
+    {
+        std::vector<SubsystemUsage> result;
+        result.reserve(EnumValue(Subsystem::Count));
+        for (size_t i = 0; i < _peakBytes.size(); i++)
+        {
+            const auto id = static_cast<Subsystem>(i);
+            const auto bytes = Measure(id);
+            _peakBytes[i] = std::max(_peakBytes[i], bytes);
+            result.push_back({ id, bytes, _peakBytes[i] });
+        }
+        return result;
+    }
+
+    void Update(uint32_t currentTicks)
+    {
+        if (currentTicks % kSampleInterval == 0)
+        {
+            Collect();
+        }
+    }
+
+    void ResetPeaks()
+    {
+        _peakBytes.fill(0);
+    }
+} // namespace OpenRCT2::MemoryUsage
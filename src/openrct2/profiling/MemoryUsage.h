@@ -0,0 +1,54 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace OpenRCT2::MemoryUsage
+{
+    // The sizes are reported by the subsystems from the capacity of their containers, so they are a close estimate of
+    // what is allocated rather than an exact count of the heap.
+    enum class Subsystem : uint8_t
+    {
+        TileElements,
+        Entities,
+        SpatialIndex,
+        ObjectImages,
+        G1,
+        TrueTypeFonts,
+        DrawingEngine,
+        Network,
+        Snapshots,
+        Count,
+    };
+
+    struct SubsystemUsage
+    {
+        Subsystem Id{};
+        size_t Bytes{};
+        // Highest size seen by any measurement since the start or the last reset.
+        size_t PeakBytes{};
+    };
+
+    // Number of ticks between the measurements taken while the game runs.
+    constexpr uint32_t kSampleInterval = 400;
+
+    std::string_view GetSubsystemName(Subsystem id);
+
+    // Measures every subsystem now, the peaks are updated with the result.
+    std::vector<SubsystemUsage> Collect();
+
+    // Measures every subsystem once every kSampleInterval ticks so the peaks are tracked without any tool attached.
+    void Update(uint32_t currentTicks);
+
+    void ResetPeaks();
+} // namespace OpenRCT2::MemoryUsage
@@ -0,0 +1,88 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include "PaintStatistics.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace OpenRCT2::PaintStatistics
+{
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr auto kSummaryInterval = std::chrono::seconds(1);
+
+    // Everything here is only used by the thread running the game loop.
+    static ColumnStats _total{};
+    static uint32_t _totalColumns{};
+    static uint32_t _totalFrames{};
+    static uint32_t _frameColumns{};
+    static Clock::time_point _intervalStart = Clock::now();
+    static Summary _summary{};
+
+    void RecordColumn(const ColumnStats& stats)
+    {
+        _total.PaintStructs += stats.PaintStructs;
+        _total.SpritesDrawn += stats.SpritesDrawn;
+        _total.PixelsCovered += stats.PixelsCovered;
+        _total.MaxOverdraw = std::max(_total.MaxOverdraw, stats.MaxOverdraw);
+        _total.GenerateMs += stats.GenerateMs;
+        _total.ArrangeMs += stats.ArrangeMs;
+        _total.DrawMs += stats.DrawMs;
+        _frameColumns++;
+    }
+
+    void EndFrame()
+    {
+        if (_frameColumns != 0)
+        {
+            _totalColumns += _frameColumns;
+            _totalFrames++;
+            _frameColumns = 0;
+        }
+
+        const auto now = Clock::now();
+        if (now - _intervalStart < kSummaryInterval)
+            return;
+
+        _summary = {};
+        _summary.Frames = _totalFrames;
+        if (_totalFrames != 0)
+        {
+            auto& perFrame = _summary.PerFrame;
+            _summary.Columns = _totalColumns / _totalFrames;
+            perFrame.PaintStructs = _total.PaintStructs / _totalFrames;
+            perFrame.SpritesDrawn = _total.SpritesDrawn / _totalFrames;
+            perFrame.PixelsCovered = _total.PixelsCovered / _totalFrames;
+            perFrame.MaxOverdraw = _total.MaxOverdraw;
+            perFrame.GenerateMs = _total.GenerateMs / _totalFrames;
+            perFrame.ArrangeMs = _total.ArrangeMs / _totalFrames;
+            perFrame.DrawMs = _total.DrawMs / _totalFrames;
+        }
+
+        _total = {};
+        _totalColumns = 0;
+        _totalFrames = 0;
+        _intervalStart = now;
+    }
+
+    Summary GetSummary()
+    {
+        return _summary;
+    }
+
+    void Reset()
+    {
+        _total = {};
+        _totalColumns = 0;
+        _totalFrames = 0;
+        _frameColumns = 0;
+        _intervalStart = Clock::now();
+        _summary = {};
+    }
+} // namespace OpenRCT2::PaintStatistics
@@ -0,0 +1,50 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+namespace OpenRCT2::PaintStatistics
+{
+    // What painting a single viewport column cost. Every column is painted by one thread only, so the counters are
+    // plain fields of its paint session that are summed once all columns are done.
+    struct ColumnStats
+    {
+        uint32_t PaintStructs{};
+        uint32_t SpritesDrawn{};
+        // Pixels inside the bounds of the drawn sprites, transparent ones included.
+        uint64_t PixelsCovered{};
+        // Highest number of sprites drawn over the same pixel, only counted while the overdraw heatmap is shown.
+        uint32_t MaxOverdraw{};
+        float GenerateMs{};
+        float ArrangeMs{};
+        float DrawMs{};
+    };
+
+    struct Summary
+    {
+        // Frames in the last interval that painted at least one viewport.
+        uint32_t Frames{};
+        uint32_t Columns{};
+        // Averages per painted frame, except MaxOverdraw which is the highest of the interval. The times are summed
+        // over all columns, so with multithreading they are CPU time rather than wall time.
+        ColumnStats PerFrame{};
+    };
+
+    // Adds the columns of one viewport paint to the current frame.
+    void RecordColumn(const ColumnStats& stats);
+
+    // Closes the frame, called once per presented frame. The summary is refreshed about once a second.
+    void EndFrame();
+
+    Summary GetSummary();
+
+    void Reset();
+} // namespace OpenRCT2::PaintStatistics
@@ -13,8 +13,16 @@
 #include <chrono>
 #include <fstream>
 #include <iomanip>
+#include <memory>
 #include <stack>
 
+#ifdef __linux__
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
 namespace OpenRCT2::Profiling
 {
     inline static bool _enabled = false;
@@ -34,6 +42,150 @@ namespace OpenRCT2::Profiling
         return _enabled;
     }
 
+    inline static std::atomic<bool> _hardwareCountersEnabled = false;
+
+    const char* GetHardwareCounterName(HardwareCounter counter)
+    {
+        switch (counter)
+        {
+            case HardwareCounter::Cycles:
+                return "cycles";
+            case HardwareCounter::Instructions:
+                return "instructions";
+            case HardwareCounter::CacheMisses:
+                return "cache_misses";
+            case HardwareCounter::BranchMisses:
+                return "branch_misses";
+            default:
+                return "";
+        }
+    }
+
+    namespace Detail
+    {
+        // The counters are opened per thread the first time that thread enters a profiled function with hardware
+        // counters enabled. A thread that fails to open them, e.g. in a VM without a PMU, reports zeros.
+        class ThreadHardwareCounters
+        {
+#ifdef __linux__
+            std::array<int, NumHardwareCounters> _fds;
+            bool _opened = false;
+            bool _valid = false;
+
+            static int OpenCounter(uint64_t config, int groupFd)
+            {
+                perf_event_attr attr{};
+                attr.size = sizeof(attr);
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = config;
+                attr.disabled = groupFd == -1 ? 1 : 0;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                attr.read_format = PERF_FORMAT_GROUP;
+                return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+            }
+
+            void Open()
+            {
+                _opened = true;
+                constexpr std::array<uint64_t, NumHardwareCounters> configs = {
+                    PERF_COUNT_HW_CPU_CYCLES,
+                    PERF_COUNT_HW_INSTRUCTIONS,
+                    PERF_COUNT_HW_CACHE_MISSES,
+                    PERF_COUNT_HW_BRANCH_MISSES,
+                };
+
+                _fds.fill(-1);
+                for (size_t i = 0; i < NumHardwareCounters; i++)
+                {
+                    _fds[i] = OpenCounter(configs[i], _fds[0]);
+                    if (_fds[i] == -1)
+                    {
+                        Close();
+                        return;
+                    }
+                }
+                ioctl(_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+                _valid = true;
+            }
+
+            void Close()
+            {
+                for (auto& fd : _fds)
+                {
+                    if (fd != -1)
+                        close(fd);
+                    fd = -1;
+                }
+                _valid = false;
+            }
+
+        public:
+            ~ThreadHardwareCounters()
+            {
+                if (_opened)
+                    Close();
+            }
+
+            // Returns false when the counters could not be read, values is left untouched then.
+            bool Read(HardwareCounterValues& values)
+            {
+                if (!_opened)
+                    Open();
+
+                if (!_valid)
+                    return false;
+
+                struct
+                {
+                    uint64_t Count;
+                    std::array<uint64_t, NumHardwareCounters> Values;
+                } group{};
+                if (read(_fds[0], &group, sizeof(group)) != static_cast<ssize_t>(sizeof(group)))
+                    return false;
+
+                values = group.Values;
+                return true;
+            }
+#else
+        public:
+            bool Read(HardwareCounterValues&)
+            {
+                return false;
+            }
+#endif
+        };
+
+        static thread_local ThreadHardwareCounters _threadHardwareCounters;
+
+        static bool ReadHardwareCounters(HardwareCounterValues& values)
+        {
+            if (!_hardwareCountersEnabled)
+                return false;
+            return _threadHardwareCounters.Read(values);
+        }
+    } // namespace Detail
+
+    bool EnableHardwareCounters()
+    {
+#ifdef __linux__
+        _hardwareCountersEnabled = true;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void DisableHardwareCounters()
+    {
+        _hardwareCountersEnabled = false;
+    }
+
+    bool AreHardwareCountersEnabled()
+    {
+        return _hardwareCountersEnabled;
+    }
+
     namespace Detail
     {
         using Clock = std::chrono::high_resolution_clock;
@@ -44,17 +196,70 @@ namespace OpenRCT2::Profiling
             FunctionInternal* Parent;
             FunctionInternal* Func;
             Tp EntryTime;
+            HardwareCounterValues EntryCounters;
+            // Counters can be enabled or fail to read between entry and exit, only a pair of reads gives a delta.
+            bool HasEntryCounters;
 
-            FunctionEntry(FunctionInternal* parent, FunctionInternal* func, const Tp& entryTime)
+            FunctionEntry(
+                FunctionInternal* parent, FunctionInternal* func, const Tp& entryTime,
+                const HardwareCounterValues& entryCounters, bool hasEntryCounters)
                 : Parent(parent)
                 , Func(func)
                 , EntryTime(entryTime)
+                , EntryCounters(entryCounters)
+                , HasEntryCounters(hasEntryCounters)
             {
             }
         };
 
         static thread_local std::stack<FunctionEntry> _callStack;
 
+        // Every thread that hits a profiled function records its calls into its own ring buffer, so recording only
+        // contends with an export.
+        static constexpr size_t MaxTraceEventsPerThread = 1 << 15;
+
+        struct TraceEvent
+        {
+            const FunctionInternal* Func;
+            Tp Begin;
+            Tp End;
+            HardwareCounterValues Counters;
+        };
+
+        struct ThreadTimeline
+        {
+            std::mutex Mutex;
+            uint32_t ThreadIndex{};
+            std::vector<TraceEvent> Events;
+            size_t NextEvent{};
+        };
+
+        static const Tp _traceEpoch = Clock::now();
+        static std::mutex _timelinesMutex;
+        static std::vector<std::unique_ptr<ThreadTimeline>> _timelines;
+        static thread_local ThreadTimeline* _threadTimeline = nullptr;
+
+        static void RecordTraceEvent(
+            const FunctionInternal* func, const Tp& begin, const Tp& end, const HardwareCounterValues& counters)
+        {
+            if (_threadTimeline == nullptr)
+            {
+                // Timelines outlive their threads, so the calls of finished workers can still be exported
+                std::scoped_lock lock(_timelinesMutex);
+                auto& timeline = _timelines.emplace_back(std::make_unique<ThreadTimeline>());
+                timeline->ThreadIndex = static_cast<uint32_t>(_timelines.size() - 1);
+                _threadTimeline = timeline.get();
+            }
+
+            std::scoped_lock lock(_threadTimeline->Mutex);
+            auto& events = _threadTimeline->Events;
+            if (events.size() < MaxTraceEventsPerThread)
+                events.push_back({ func, begin, end, counters });
+            else
+                events[_threadTimeline->NextEvent % MaxTraceEventsPerThread] = { func, begin, end, counters };
+            _threadTimeline->NextEvent++;
+        }
+
         void FunctionEnter(Function& func)
         {
             const auto entryTime = Clock::now();
@@ -67,17 +272,31 @@ namespace OpenRCT2::Profiling
             if (!_callStack.empty())
                 parent = _callStack.top().Func;
 
-            _callStack.emplace(parent, &funcInternal, entryTime);
+            HardwareCounterValues entryCounters{};
+            const bool hasEntryCounters = ReadHardwareCounters(entryCounters);
+            _callStack.emplace(parent, &funcInternal, entryTime, entryCounters, hasEntryCounters);
         }
 
         void FunctionExit(Function& func)
         {
+            HardwareCounterValues exitCounters{};
+            const bool hasExitCounters = ReadHardwareCounters(exitCounters);
             const auto exitTime = Clock::now();
 
             assert(!_callStack.empty());
 
             auto& stackEntry = _callStack.top();
 
+            const bool hasCounters = stackEntry.HasEntryCounters && hasExitCounters;
+            HardwareCounterValues counters{};
+            if (hasCounters)
+            {
+                for (size_t i = 0; i < NumHardwareCounters; i++)
+                {
+                    counters[i] = exitCounters[i] - stackEntry.EntryCounters[i];
+                }
+            }
+
             const auto deltaTime = exitTime - stackEntry.EntryTime;
 
             // Elapsed microseconds.
@@ -109,8 +328,17 @@ namespace OpenRCT2::Profiling
 
                 funcData->MaxTimeUs = std::max(elapsedTimeUs, funcData->MaxTimeUs);
                 funcData->TotalTimeUs += elapsedTimeUs;
+                if (hasCounters)
+                {
+                    for (size_t i = 0; i < NumHardwareCounters; i++)
+                    {
+                        funcData->CounterTotals[i] += counters[i];
+                    }
+                }
             }
 
+            RecordTraceEvent(funcData, stackEntry.EntryTime, exitTime, counters);
+
             _callStack.pop();
         }
 
@@ -137,10 +365,20 @@ namespace OpenRCT2::Profiling
             funcInternal->CallCount = 0;
             funcInternal->MinTimeUs = 0.0;
             funcInternal->MaxTimeUs = 0.0;
+            funcInternal->TotalTimeUs = 0.0;
+            funcInternal->CounterTotals = {};
             funcInternal->SampleIterator = 0;
             funcInternal->Children.clear();
             funcInternal->Parents.clear();
         }
+
+        std::scoped_lock lock(Detail::_timelinesMutex);
+        for (auto& timeline : Detail::_timelines)
+        {
+            std::scoped_lock timelineLock(timeline->Mutex);
+            timeline->Events.clear();
+            timeline->NextEvent = 0;
+        }
     }
 
     bool ExportCSV(const std::string& filePath)
@@ -149,7 +387,12 @@ namespace OpenRCT2::Profiling
         if (!out.is_open())
             return false;
 
-        out << "function_name;calls;min_microseconds;max_microseconds;average_microseconds\n";
+        out << "function_name;calls;min_microseconds;max_microseconds;average_microseconds";
+        for (size_t i = 0; i < NumHardwareCounters; i++)
+        {
+            out << ";" << GetHardwareCounterName(static_cast<HardwareCounter>(i));
+        }
+        out << "\n";
         out << std::setprecision(12);
 
         const auto& data = GetData();
@@ -165,8 +408,81 @@ namespace OpenRCT2::Profiling
             if (func->GetCallCount() > 0)
                 avg = func->GetTotalTime() / func->GetCallCount();
 
-            out << avg << "\n";
+            out << avg;
+
+            const auto counters = func->GetHardwareCounterTotals();
+            for (auto value : counters)
+            {
+                out << ";" << value;
+            }
+            out << "\n";
+        }
+
+        return true;
+    }
+
+    static void WriteJsonString(std::ostream& out, const char* str)
+    {
+        out << '"';
+        for (; *str != '\0'; str++)
+        {
+            if (*str == '"' || *str == '\\')
+                out << '\\';
+            out << *str;
+        }
+        out << '"';
+    }
+
+    bool ExportChromeTrace(const std::string& filePath)
+    {
+        std::ofstream out(filePath);
+        if (!out.is_open())
+            return false;
+
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        out << std::fixed << std::setprecision(3);
+
+        // Only add the counters when they were collected, they would all be 0 otherwise
+        const bool withCounters = AreHardwareCountersEnabled();
+        bool first = true;
+        std::scoped_lock lock(Detail::_timelinesMutex);
+        for (auto& timeline : Detail::_timelines)
+        {
+            std::scoped_lock timelineLock(timeline->Mutex);
+            const auto& events = timeline->Events;
+
+            // Once the ring buffer has wrapped the oldest event is the one that gets overwritten next
+            const auto start = events.size() < Detail::MaxTraceEventsPerThread
+                ? 0
+                : timeline->NextEvent % Detail::MaxTraceEventsPerThread;
+            for (size_t i = 0; i < events.size(); i++)
+            {
+                const auto& event = events[(start + i) % events.size()];
+                const auto begin = std::chrono::duration<double, std::micro>(event.Begin - Detail::_traceEpoch).count();
+                const auto duration = std::chrono::duration<double, std::micro>(event.End - event.Begin).count();
+
+                if (!first)
+                    out << ",";
+                first = false;
+
+                out << "\n{\"name\":";
+                WriteJsonString(out, event.Func->GetName());
+                out << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << timeline->ThreadIndex << ",\"ts\":" << begin
+                    << ",\"dur\":" << duration;
+                if (withCounters)
+                {
+                    out << ",\"args\":{";
+                    for (size_t c = 0; c < NumHardwareCounters; c++)
+                    {
+                        out << (c == 0 ? "" : ",") << "\"" << GetHardwareCounterName(static_cast<HardwareCounter>(c))
+                            << "\":" << event.Counters[c];
+                    }
+                    out << "}";
+                }
+                out << "}";
+            }
         }
+        out << "\n]}\n";
 
         return true;
     }
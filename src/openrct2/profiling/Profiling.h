@@ -24,6 +24,26 @@ namespace OpenRCT2::Profiling
     void Disable();
     bool IsEnabled();
 
+    enum class HardwareCounter : uint8_t
+    {
+        Cycles,
+        Instructions,
+        CacheMisses,
+        BranchMisses,
+        Count,
+    };
+
+    static constexpr size_t NumHardwareCounters = static_cast<size_t>(HardwareCounter::Count);
+    using HardwareCounterValues = std::array<uint64_t, NumHardwareCounters>;
+
+    const char* GetHardwareCounterName(HardwareCounter counter);
+
+    // Also reads the hardware performance counters of the calling thread on every profiled call. This is a lot more
+    // expensive than only taking the time, returns false if the platform does not support it.
+    bool EnableHardwareCounters();
+    void DisableHardwareCounters();
+    bool AreHardwareCountersEnabled();
+
     struct Function
     {
         virtual ~Function() = default;
@@ -51,6 +71,9 @@ namespace OpenRCT2::Profiling
 
         // Returns a list of function this function is calling.
         virtual std::vector<Function*> GetChildren() const = 0;
+
+        // Returns the hardware counter totals of all calls, these stay 0 unless hardware counters are enabled.
+        virtual HardwareCounterValues GetHardwareCounterTotals() const = 0;
     };
 
     namespace Detail
@@ -89,6 +112,8 @@ namespace OpenRCT2::Profiling
 
             double TotalTimeUs{};
 
+            HardwareCounterValues CounterTotals{};
+
             // Functions that called us.
             std::unordered_set<Function*> Parents;
 
@@ -135,6 +160,12 @@ namespace OpenRCT2::Profiling
                 std::scoped_lock lock(Mutex);
                 return MaxTimeUs;
             }
+
+            HardwareCounterValues GetHardwareCounterTotals() const override
+            {
+                std::scoped_lock lock(Mutex);
+                return CounterTotals;
+            }
         };
 
         template<typename TName> struct FunctionWrapper : FunctionInternal
@@ -190,4 +221,8 @@ namespace OpenRCT2::Profiling
 
     bool ExportCSV(const std::string& filePath);
 
+    // Exports the most recent calls of every thread as a timeline in the Chrome trace event format, which Perfetto
+    // can open as well.
+    bool ExportChromeTrace(const std::string& filePath);
+
 } // namespace OpenRCT2::Profiling
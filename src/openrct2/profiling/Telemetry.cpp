@@ -0,0 +1,128 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include "Telemetry.h"
+
+#include "../GameState.h"
+#include "../core/Console.hpp"
+#include "../entity/EntityList.h"
+#include "../network/network.h"
+#include "../world/Map.h"
+
+#include <algorithm>
+#include <mutex>
+
+int32_t gTelemetryStatsInterval = 0;
+
+namespace OpenRCT2::Telemetry
+{
+    // Only the game thread writes samples, the lock is only there for readers on other threads and is held once per
+    // tick for the copy of a single sample.
+    static std::mutex _samplesMutex;
+    static std::array<TickSample, kMaxTickSamples> _samples;
+    static uint64_t _samplesWritten{};
+
+    static float _lastFrameTimeMs{};
+    static uint16_t _gameActionsThisTick{};
+
+    void RecordFrame(float frameTimeMs)
+    {
+        _lastFrameTimeMs = frameTimeMs;
+    }
+
+    void RecordGameAction()
+    {
+        if (_gameActionsThisTick != UINT16_MAX)
+            _gameActionsThisTick++;
+    }
+
+    std::vector<TickSample> GetRecentTicks(size_t count)
+    {
+        std::lock_guard<std::mutex> lock(_samplesMutex);
+        const auto written = _samplesWritten;
+        const auto available = static_cast<size_t>(std::min<uint64_t>(written, kMaxTickSamples));
+        count = std::min(count, available);
+
+        std::vector<TickSample> result;
+        result.reserve(count);
+        for (auto i = written - count; i < written; i++)
+        {
+            result.push_back(_samples[i % kMaxTickSamples]);
+        }
+        return result;
+    }
+
+    static void PrintStats(const TickSample& last)
+    {
+        const auto samples = GetRecentTicks(static_cast<size_t>(gTelemetryStatsInterval));
+        if (samples.empty())
+            return;
+
+        float totalTickTime = 0.0f;
+        float maxTickTime = 0.0f;
+        uint32_t gameActions = 0;
+        for (const auto& sample : samples)
+        {
+            totalTickTime += sample.TickTimeMs;
+            maxTickTime = std::max(maxTickTime, sample.TickTimeMs);
+            gameActions += sample.GameActions;
+        }
+
+        uint32_t entities = 0;
+        for (auto count : last.EntityCounts)
+        {
+            entities += count;
+        }
+
+        Console::WriteLine(
+            "[stats] tick %u: tick %.2f ms avg, %.2f ms max, frame %.2f ms, %u guests, %u entities, %u tile elements, "
+            "%u queued packets, %u actions",
+            last.Tick, totalTickTime / samples.size(), maxTickTime, last.FrameTimeMs,
+            last.EntityCounts[EnumValue(EntityType::Guest)], entities, last.TileElements, last.NetworkQueueDepth,
+            gameActions);
+    }
+
+    ScopedTick::ScopedTick()
+        : _start(std::chrono::high_resolution_clock::now())
+        , _tick(GetGameState().CurrentTicks)
+    {
+    }
+
+    ScopedTick::~ScopedTick()
+    {
+        const auto tick = GetGameState().CurrentTicks;
+        if (tick == _tick)
+            return;
+
+        const auto elapsed = std::chrono::high_resolution_clock::now() - _start;
+
+        TickSample sample;
+        sample.Tick = tick;
+        sample.TickTimeMs = std::chrono::duration<float, std::milli>(elapsed).count();
+        sample.FrameTimeMs = _lastFrameTimeMs;
+        sample.TileElements = static_cast<uint32_t>(MapGetNumTileElementsInUse());
+        sample.NetworkQueueDepth = static_cast<uint32_t>(NetworkGetQueuedPacketCount());
+        sample.GameActions = _gameActionsThisTick;
+        for (size_t type = 0; type < sample.EntityCounts.size(); type++)
+        {
+            sample.EntityCounts[type] = GetEntityListCount(static_cast<EntityType>(type));
+        }
+        _gameActionsThisTick = 0;
+
+        {
+            std::lock_guard<std::mutex> lock(_samplesMutex);
+            _samples[_samplesWritten % kMaxTickSamples] = sample;
+            _samplesWritten++;
+        }
+
+        if (gTelemetryStatsInterval > 0 && tick % gTelemetryStatsInterval == 0)
+        {
+            PrintStats(sample);
+        }
+    }
+} // namespace OpenRCT2::Telemetry
@@ -0,0 +1,55 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#pragma once
+
+#include "../entity/EntityBase.h"
+#include "../util/Util.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+// Prints a summary of the recorded ticks to stdout every given number of ticks, 0 disables it.
+extern int32_t gTelemetryStatsInterval;
+
+namespace OpenRCT2::Telemetry
+{
+    // Unlike the profiler these counters are always recorded, they are cheap enough to keep around so there is
+    // something to look at after a lag spike has already happened.
+    struct TickSample
+    {
+        uint32_t Tick{};
+        float TickTimeMs{};
+        float FrameTimeMs{};
+        uint32_t TileElements{};
+        uint32_t NetworkQueueDepth{};
+        uint16_t GameActions{};
+        std::array<uint16_t, EnumValue(EntityType::Count)> EntityCounts{};
+    };
+
+    constexpr size_t kMaxTickSamples = 4096;
+
+    // Measures one game tick, the sample is recorded when the scope ends unless the tick did not advance.
+    class ScopedTick
+    {
+        std::chrono::high_resolution_clock::time_point _start;
+        uint32_t _tick;
+
+    public:
+        ScopedTick();
+        ~ScopedTick();
+    };
+
+    void RecordFrame(float frameTimeMs);
+    void RecordGameAction();
+
+    // Returns up to count of the most recent samples, oldest first.
+    std::vector<TickSample> GetRecentTicks(size_t count = kMaxTickSamples);
+} // namespace OpenRCT2::Telemetry
@@ -22,6 +22,8 @@
 #include "../core/Guard.hpp"
 #include "../core/IStream.hpp"
 #include "../core/Memory.hpp"
+#include "../core/MemoryMappedFile.h"
+#include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../entity/Balloon.h"
@@ -124,9 +126,6 @@ namespace RCT1
         BitSet<MAX_RIDE_OBJECTS> _researchRideEntryUsed{};
         BitSet<EnumValue(RideType::Count)> _researchRideTypeUsed{};
 
-        // Scenario repository - used for determining scenario name
-        IScenarioRepository* _scenarioRepository = GetScenarioRepository();
-
     public:
         ParkLoadResult Load(const u8string& path) override
         {
@@ -145,16 +144,26 @@ namespace RCT1
 
         ParkLoadResult LoadSavedGame(const u8string& path, bool skipObjectCheck = false) override
         {
-            auto fs = FileStream(path, FILE_MODE_OPEN);
-            auto result = LoadFromStream(&fs, false, skipObjectCheck, path);
-            return result;
+            return LoadFromFile(path, false, skipObjectCheck);
         }
 
         ParkLoadResult LoadScenario(const u8string& path, bool skipObjectCheck = false) override
         {
-            auto fs = FileStream(path, FILE_MODE_OPEN);
-            auto result = LoadFromStream(&fs, true, skipObjectCheck, path);
-            return result;
+            return LoadFromFile(path, true, skipObjectCheck);
+        }
+
+        // Reads the file through a mapping, or the regular way if it can not be mapped
+        ParkLoadResult LoadFromFile(const u8string& path, bool isScenario, bool skipObjectCheck)
+        {
+            auto file = MemoryMappedFile::TryOpen(path);
+            if (file == nullptr)
+            {
+                auto fs = FileStream(path, FILE_MODE_OPEN);
+                return LoadFromStream(&fs, isScenario, skipObjectCheck, path);
+            }
+
+            auto ms = MemoryStream(file->GetData(), static_cast<size_t>(file->GetLength()));
+            return LoadFromStream(&ms, isScenario, skipObjectCheck, path);
         }
 
         ParkLoadResult LoadFromStream(
@@ -290,25 +299,37 @@ namespace RCT1
     private:
         std::unique_ptr<S4> ReadAndDecodeS4(IStream* stream, bool isScenario)
         {
-            auto s4 = std::make_unique<S4>();
+            // Decode straight from the stream memory when it is already in memory, e.g. a mapped file
             size_t dataSize = stream->GetLength() - stream->GetPosition();
-            auto data = stream->ReadArray<uint8_t>(dataSize);
-            auto decodedData = std::make_unique<uint8_t[]>(sizeof(S4));
+            std::unique_ptr<uint8_t[]> dataBuffer;
+            const uint8_t* data = nullptr;
+            if (auto* memoryStream = dynamic_cast<MemoryStream*>(stream); memoryStream != nullptr)
+            {
+                data = static_cast<const uint8_t*>(memoryStream->GetData()) + memoryStream->GetPosition();
+                memoryStream->Seek(dataSize, STREAM_SEEK_CURRENT);
+            }
+            else
+            {
+                dataBuffer = stream->ReadArray<uint8_t>(dataSize);
+                data = dataBuffer.get();
+            }
+
+            auto s4 = std::make_unique<S4>();
+            auto* decodedData = reinterpret_cast<uint8_t*>(s4.get());
 
             size_t decodedSize;
-            int32_t fileType = SawyerCodingDetectFileType(data.get(), dataSize);
+            int32_t fileType = SawyerCodingDetectFileType(data, dataSize);
             if (isScenario && (fileType & FILE_VERSION_MASK) != FILE_VERSION_RCT1)
             {
-                decodedSize = SawyerCodingDecodeSC4(data.get(), decodedData.get(), dataSize, sizeof(S4));
+                decodedSize = SawyerCodingDecodeSC4(data, decodedData, dataSize, sizeof(S4));
             }
             else
             {
-                decodedSize = SawyerCodingDecodeSV4(data.get(), decodedData.get(), dataSize, sizeof(S4));
+                decodedSize = SawyerCodingDecodeSV4(data, decodedData, dataSize, sizeof(S4));
             }
 
             if (decodedSize == sizeof(S4))
             {
-                std::memcpy(s4.get(), decodedData.get(), sizeof(S4));
                 return s4;
             }
 
@@ -333,7 +354,8 @@ namespace RCT1
 
         std::string GetRCT1ScenarioName()
         {
-            const ScenarioIndexEntry* scenarioEntry = _scenarioRepository->GetByInternalName(_s4.ScenarioName);
+            // Looked up on use, the scenario repository creates S4 importers while it is being scanned
+            const ScenarioIndexEntry* scenarioEntry = GetScenarioRepository()->GetByInternalName(_s4.ScenarioName);
             if (scenarioEntry == nullptr)
             {
                 return "";
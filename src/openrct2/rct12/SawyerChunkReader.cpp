@@ -10,7 +10,7 @@
 #include "SawyerChunkReader.h"
 
 #include "../core/IStream.hpp"
-#include "../core/Numerics.hpp"
+#include "../core/MemoryStream.h"
 
 // malloc is very slow for large allocations in MSVC debug builds as it allocates
 // memory on a special debug heap and then initialises all the memory to 0xCC.
@@ -131,6 +131,11 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunkTrack()
 
 void SawyerChunkReader::ReadChunk(void* dst, size_t length)
 {
+    if (TryReadChunkInPlace(dst, length))
+    {
+        return;
+    }
+
     auto chunk = ReadChunk();
     auto chunkData = static_cast<const uint8_t*>(chunk->GetData());
     auto chunkLength = chunk->GetLength();
@@ -150,6 +155,57 @@ void SawyerChunkReader::ReadChunk(void* dst, size_t length)
     }
 }
 
+/**
+ * Decodes the chunk straight from the stream memory into dst if the stream is held in memory (e.g. a mapped file) and
+ * the chunk fits, which avoids allocating the intermediate chunk buffers. Returns false with the stream position
+ * unchanged otherwise, so the caller can take the buffered path.
+ */
+bool SawyerChunkReader::TryReadChunkInPlace(void* dst, size_t length)
+{
+    auto* memoryStream = dynamic_cast<OpenRCT2::MemoryStream*>(_stream);
+    if (memoryStream == nullptr)
+    {
+        return false;
+    }
+
+    const uint64_t originalPosition = _stream->GetPosition();
+    if (originalPosition + sizeof(SawyerCodingChunkHeader) > _stream->GetLength())
+    {
+        return false;
+    }
+
+    const auto header = _stream->ReadValue<SawyerCodingChunkHeader>();
+    const uint64_t dataPosition = _stream->GetPosition();
+    if (header.length >= MAX_UNCOMPRESSED_CHUNK_SIZE || dataPosition + header.length > _stream->GetLength())
+    {
+        _stream->SetPosition(originalPosition);
+        return false;
+    }
+
+    size_t uncompressedLength = 0;
+    try
+    {
+        const auto* src = static_cast<const uint8_t*>(memoryStream->GetData()) + dataPosition;
+        uncompressedLength = DecodeChunk(dst, length, src, header);
+    }
+    catch (const SawyerChunkException&)
+    {
+        // Either corrupt or larger than dst, the buffered path reports the former and truncates the latter.
+    }
+    if (uncompressedLength == 0)
+    {
+        _stream->SetPosition(originalPosition);
+        return false;
+    }
+
+    if (uncompressedLength < length)
+    {
+        std::fill_n(static_cast<uint8_t*>(dst) + uncompressedLength, length - uncompressedLength, 0x00);
+    }
+    _stream->SetPosition(dataPosition + header.length);
+    return true;
+}
+
 size_t SawyerChunkReader::DecodeChunk(void* dst, size_t dstCapacity, const void* src, const SawyerCodingChunkHeader& header)
 {
     size_t resultLength;
@@ -278,13 +334,6 @@ size_t SawyerChunkReader::DecodeChunkRotate(void* dst, size_t dstCapacity, const
         throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
     }
 
-    auto src8 = static_cast<const uint8_t*>(src);
-    auto dst8 = static_cast<uint8_t*>(dst);
-    uint8_t code = 1;
-    for (size_t i = 0; i < srcLength; i++)
-    {
-        dst8[i] = Numerics::ror8(src8[i], code);
-        code = (code + 2) % 8;
-    }
+    SawyerCodingDecodeRotate(static_cast<uint8_t*>(dst), static_cast<const uint8_t*>(src), srcLength);
     return srcLength;
 }
@@ -44,6 +44,8 @@ class SawyerChunkReader final
 private:
     OpenRCT2::IStream* const _stream = nullptr;
 
+    bool TryReadChunkInPlace(void* dst, size_t length);
+
 public:
     explicit SawyerChunkReader(OpenRCT2::IStream* stream);
 
@@ -18,6 +18,7 @@
 #include "../core/Console.hpp"
 #include "../core/FileStream.h"
 #include "../core/IStream.hpp"
+#include "../core/MemoryMappedFile.h"
 #include "../core/MemoryStream.h"
 #include "../core/Numerics.hpp"
 #include "../core/Path.hpp"
@@ -126,20 +127,32 @@ namespace RCT2
 
         ParkLoadResult LoadSavedGame(const u8string& path, bool skipObjectCheck = false) override
         {
-            auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_OPEN);
-            auto result = LoadFromStream(&fs, false, skipObjectCheck);
+            auto result = LoadFromFile(path, false, skipObjectCheck);
             _s6Path = path;
             return result;
         }
 
         ParkLoadResult LoadScenario(const u8string& path, bool skipObjectCheck = false) override
         {
-            auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_OPEN);
-            auto result = LoadFromStream(&fs, true, skipObjectCheck);
+            auto result = LoadFromFile(path, true, skipObjectCheck);
             _s6Path = path;
             return result;
         }
 
+        // Reads the file through a mapping, or the regular way if it can not be mapped
+        ParkLoadResult LoadFromFile(const u8string& path, bool isScenario, bool skipObjectCheck)
+        {
+            auto file = OpenRCT2::MemoryMappedFile::TryOpen(path);
+            if (file == nullptr)
+            {
+                auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_OPEN);
+                return LoadFromStream(&fs, isScenario, skipObjectCheck);
+            }
+
+            auto ms = OpenRCT2::MemoryStream(file->GetData(), static_cast<size_t>(file->GetLength()));
+            return LoadFromStream(&ms, isScenario, skipObjectCheck);
+        }
+
         ParkLoadResult LoadFromStream(
             OpenRCT2::IStream* stream, bool isScenario, [[maybe_unused]] bool skipObjectCheck = false,
             const u8string& path = {}) override
@@ -36,8 +36,34 @@ uint32_t CarEntry::GroupImageId(SpriteGroupType spriteGroup) const
 
 uint32_t CarEntry::SpriteOffset(SpriteGroupType spriteGroup, int32_t imageDirection, uint8_t rankIndex) const
 {
-    return ((SpriteByYaw(imageDirection, spriteGroup) + NumRotationSprites(spriteGroup) * rankIndex) * base_num_frames)
-        + GroupImageId(spriteGroup);
+    const auto& group = SpriteGroups[EnumValue(spriteGroup)];
+    if (!group.Enabled())
+        return group.imageId;
+    return SpriteOffsets[group.offsetsStart + imageDirection] + group.rankStride * rankIndex;
+}
+
+/**
+ * Precomputes the sprite offset of every yaw of the enabled sprite groups, painting a car then only has to look up its
+ * yaw and add the rank. Has to be called again whenever the groups or their images change.
+ */
+void CarEntryBuildSpriteOffsets(CarEntry& carEntry)
+{
+    carEntry.SpriteOffsets.clear();
+    for (uint8_t i = 0; i < EnumValue(SpriteGroupType::Count); i++)
+    {
+        auto& group = carEntry.SpriteGroups[i];
+        if (!group.Enabled())
+            continue;
+
+        const auto spriteGroup = static_cast<SpriteGroupType>(i);
+        group.offsetsStart = static_cast<uint16_t>(carEntry.SpriteOffsets.size());
+        group.rankStride = carEntry.NumRotationSprites(spriteGroup) * carEntry.base_num_frames;
+        for (int32_t yaw = 0; yaw < OpenRCT2::Entity::Yaw::BaseRotation; yaw++)
+        {
+            carEntry.SpriteOffsets.push_back(
+                (carEntry.SpriteByYaw(yaw, spriteGroup) * carEntry.base_num_frames) + group.imageId);
+        }
+    }
 }
 
 /**
@@ -171,6 +171,9 @@ struct VehicleSpriteGroup
 {
     uint32_t imageId{};
     OpenRCT2::Entity::Yaw::SpritePrecision spritePrecision{};
+    // Where the group's sprite offsets by yaw start in CarEntry::SpriteOffsets, and the distance between its ranks
+    uint16_t offsetsStart{};
+    uint32_t rankStride{};
     bool Enabled() const
     {
         return spritePrecision != OpenRCT2::Entity::Yaw::SpritePrecision::None;
@@ -220,6 +223,8 @@ struct CarEntry
     } SteamEffect;
     std::vector<std::array<CoordsXY, 3>> peep_loading_waypoints = {};
     std::vector<int8_t> peep_loading_positions = {};
+    // Offset of the first sprite for each yaw of every enabled sprite group, built by CarEntryBuildSpriteOffsets
+    std::vector<uint32_t> SpriteOffsets = {};
 
     uint32_t NumRotationSprites(SpriteGroupType rotationType) const;
     int32_t SpriteByYaw(int32_t yaw, SpriteGroupType rotationType) const;
@@ -229,3 +234,4 @@ struct CarEntry
 };
 
 void CarEntrySetImageMaxSizes(CarEntry& carEntry, int32_t numImages);
+void CarEntryBuildSpriteOffsets(CarEntry& carEntry);
@@ -29,7 +29,9 @@
 #include "../core/Guard.hpp"
 #include "../core/Numerics.hpp"
 #include "../entity/EntityRegistry.h"
+#include "../entity/GuestHotFields.h"
 #include "../entity/Peep.h"
+#include "../entity/PeepStringCache.h"
 #include "../entity/Staff.h"
 #include "../interface/Window_internal.h"
 #include "../localisation/Date.h"
@@ -77,6 +79,7 @@
 #include "Vehicle.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <climits>
 #include <cstdlib>
@@ -102,6 +105,15 @@ static size_t _endOfUsedRange = 0;
 // A special instance of Ride that is used to draw previews such as the track designs.
 static Ride _previewRide{};
 
+// Rides whose measurement is still being recorded. At most kMaxRideMeasurements rides have a measurement, so the tick
+// walks this list instead of every ride in the park. Rebuilt whenever a measurement may have been added.
+static std::vector<RideId> _rideMeasurementsActive;
+static bool _rideMeasurementsActiveValid = false;
+
+// Recording stops once nothing asked for the measurement of a ride for this long (about five minutes), it picks up
+// again from the next departure as soon as the graph is looked at.
+static constexpr uint32_t kRideMeasurementIdleTicks = 5 * 60 * 40;
+
 struct StationIndexWithMessage
 {
     ::StationIndex StationIndex;
@@ -121,6 +133,32 @@ static void RideMechanicStatusUpdate(Ride& ride, int32_t mechanicStatus);
 static void RideMusicUpdate(Ride& ride);
 static void RideShopConnected(const Ride& ride);
 
+// The periodic ride subsystems all wake on the same ticks for every ride, so which of them have work is decided once
+// per tick by Ride::UpdateAll rather than by each ride.
+struct RideUpdateSchedule
+{
+    bool Breakdowns{};
+    bool DowntimeHistory{};
+    bool Inspections{};
+    uint8_t BreakdownStatusRide{};
+};
+
+static RideUpdateSchedule _rideUpdateSchedule;
+
+static RideUpdateSchedule GetRideUpdateSchedule(uint32_t currentTicks)
+{
+    RideUpdateSchedule schedule;
+    const bool trackDesigner = (gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) != 0;
+    schedule.Breakdowns = !trackDesigner && !(currentTicks & 255);
+    schedule.DowntimeHistory = schedule.Breakdowns && !(currentTicks & 8191);
+    schedule.Inspections = !trackDesigner && !(currentTicks & 2047);
+    // Breakdown updates originally were performed when (id == (gCurrentTicks / 2) & 0xFF)
+    // with the increased MAX_RIDES the update is tied to the first byte of the id this allows
+    // for identical balance with vanilla.
+    schedule.BreakdownStatusRide = static_cast<uint8_t>((currentTicks / 2) & 0xFF);
+    return schedule;
+}
+
 RideManager GetRideManager()
 {
     return {};
@@ -183,6 +221,7 @@ Ride* RideAllocateAtIndex(RideId index)
     std::fill(std::begin(result->vehicles), std::end(result->vehicles), EntityId::GetNull());
 
     result->id = index;
+    _rideMeasurementsActiveValid = false;
     return result;
 }
 
@@ -209,6 +248,7 @@ void RideDelete(RideId id)
 
     auto& ride = gameState.Rides[idx];
     RideReset(ride);
+    PeepStringCacheInvalidateAll();
 
     // Shrink maximum ride size.
     while (_endOfUsedRange > 0 && gameState.Rides[_endOfUsedRange - 1].id.IsNull())
@@ -369,16 +409,29 @@ void Ride::QueueInsertGuestAtFront(StationIndex stationIndex, Guest* peep)
     assert(peep != nullptr);
 
     peep->GuestNextInQueue = EntityId::GetNull();
-    auto* queueHeadGuest = GetQueueHeadGuest(peep->CurrentRideStation);
+
+    // Find the head and count the queue in one walk, the guest becomes the new head
+    auto& station = GetStation(peep->CurrentRideStation);
+    Guest* queueHeadGuest = nullptr;
+    uint16_t count = 0;
+    Guest* otherGuest;
+    auto spriteIndex = station.LastPeepInQueue;
+    while ((otherGuest = TryGetEntity<Guest>(spriteIndex)) != nullptr)
+    {
+        spriteIndex = otherGuest->GuestNextInQueue;
+        queueHeadGuest = otherGuest;
+        count++;
+    }
+
     if (queueHeadGuest == nullptr)
     {
-        GetStation(peep->CurrentRideStation).LastPeepInQueue = peep->Id;
+        station.LastPeepInQueue = peep->Id;
     }
     else
     {
         queueHeadGuest->GuestNextInQueue = peep->Id;
     }
-    UpdateQueueLength(peep->CurrentRideStation);
+    station.QueueLength = count + 1;
 }
 
 /**
@@ -387,22 +440,28 @@ void Ride::QueueInsertGuestAtFront(StationIndex stationIndex, Guest* peep)
  */
 void RideUpdateFavouritedStat()
 {
+    // The counts are kept up to date whenever a guest changes their favourite ride, only publish them here.
+    const auto& favouriteCounts = GetGuestHotFields().FavouriteRideGuestCount;
     for (auto& ride : GetRideManager())
-        ride.guests_favourite = 0;
-
-    for (auto peep : EntityList<Guest>())
     {
-        if (!peep->FavouriteRide.IsNull())
+        const auto guestsFavourite = favouriteCounts[ride.id.ToUnderlying()];
+        if (ride.guests_favourite != guestsFavourite)
         {
-            auto ride = GetRide(peep->FavouriteRide);
-            if (ride != nullptr)
-            {
-                ride->guests_favourite++;
-                ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
-            }
+            ride.guests_favourite = guestsFavourite;
+            ride.window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
         }
     }
 
+#ifdef _DEBUG
+    std::array<uint32_t, OpenRCT2::Limits::MaxRidesInPark> scannedCounts{};
+    for (auto* guest : EntityList<Guest>())
+    {
+        if (!guest->FavouriteRide.IsNull() && guest->FavouriteRide.ToUnderlying() < scannedCounts.size())
+            scannedCounts[guest->FavouriteRide.ToUnderlying()]++;
+    }
+    Guard::Assert(scannedCounts == favouriteCounts, "Incremental favourite ride counts are out of sync");
+#endif
+
     WindowInvalidateByClass(WindowClass::RideList);
 }
 
@@ -952,6 +1011,7 @@ void RideInitAll()
     auto& gameState = GetGameState();
     std::for_each(std::begin(gameState.Rides), std::end(gameState.Rides), RideReset);
     _endOfUsedRange = 0;
+    _rideMeasurementsActiveValid = false;
 }
 
 /**
@@ -1006,6 +1066,8 @@ void Ride::UpdateAll()
 
     WindowUpdateViewportRideMusic();
 
+    _rideUpdateSchedule = GetRideUpdateSchedule(GetGameState().CurrentTicks);
+
     // Update rides
     for (auto& ride : GetRideManager())
         ride.Update();
@@ -1129,20 +1191,18 @@ void Ride::Update()
     if (rtd.RideUpdate != nullptr)
         rtd.RideUpdate(*this);
 
-    RideBreakdownUpdate(*this);
+    if (_rideUpdateSchedule.Breakdowns)
+        RideBreakdownUpdate(*this);
 
     // Various things include news messages
     if (lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_DUE_INSPECTION))
     {
-        // Breakdown updates originally were performed when (id == (gCurrentTicks / 2) & 0xFF)
-        // with the increased MAX_RIDES the update is tied to the first byte of the id this allows
-        // for identical balance with vanilla.
-        const auto updatingRideByte = static_cast<uint8_t>((GetGameState().CurrentTicks / 2) & 0xFF);
-        if (updatingRideByte == static_cast<uint8_t>(id.ToUnderlying()))
+        if (_rideUpdateSchedule.BreakdownStatusRide == static_cast<uint8_t>(id.ToUnderlying()))
             RideBreakdownStatusUpdate(*this);
     }
 
-    RideInspectionUpdate(*this);
+    if (_rideUpdateSchedule.Inspections)
+        RideInspectionUpdate(*this);
 
     // If ride is simulating but crashed, reset the vehicles
     if (status == RideStatus::Simulating && (lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
@@ -1321,11 +1381,6 @@ static uint8_t _breakdownProblemProbabilities[] = {
  */
 static void RideInspectionUpdate(Ride& ride)
 {
-    if (GetGameState().CurrentTicks & 2047)
-        return;
-    if (gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER)
-        return;
-
     ride.last_inspection++;
     if (ride.last_inspection == 0)
         ride.last_inspection--;
@@ -1386,17 +1441,10 @@ static int32_t GetAgePenalty(const Ride& ride)
  */
 static void RideBreakdownUpdate(Ride& ride)
 {
-    const auto currentTicks = GetGameState().CurrentTicks;
-    if (currentTicks & 255)
-        return;
-
-    if (gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER)
-        return;
-
     if (ride.lifecycle_flags & (RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_CRASHED))
         ride.downtime_history[0]++;
 
-    if (!(currentTicks & 8191))
+    if (_rideUpdateSchedule.DowntimeHistory)
     {
         int32_t totalDowntime = 0;
 
@@ -1796,11 +1844,18 @@ Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspecti
     Staff* closestMechanic = nullptr;
     uint32_t closestDistance = std::numeric_limits<uint32_t>::max();
 
+    // The patrol check is the same for every mechanic, only look up whether it applies once.
+    const auto location = entrancePosition.ToTileStart();
+    const bool checkPatrol = MapIsLocationInPark(location);
+
     for (auto peep : EntityList<Staff>())
     {
         if (!peep->IsMechanic())
             continue;
 
+        if (peep->x == LOCATION_NULL)
+            continue;
+
         if (!forInspection)
         {
             if (peep->State == PeepState::HeadingToInspection)
@@ -1820,12 +1875,7 @@ Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspecti
                 continue;
         }
 
-        auto location = entrancePosition.ToTileStart();
-        if (MapIsLocationInPark(location))
-            if (!peep->IsLocationInPatrol(location))
-                continue;
-
-        if (peep->x == LOCATION_NULL)
+        if (checkPatrol && !peep->IsLocationInPatrol(location))
             continue;
 
         // Manhattan distance
@@ -2076,6 +2126,32 @@ static void RideMeasurementUpdate(Ride& ride, RideMeasurement& measurement)
     }
 }
 
+static bool RideMeasurementIsIdle(const RideMeasurement& measurement)
+{
+    return GetGameState().CurrentTicks - measurement.last_use_tick >= kRideMeasurementIdleTicks;
+}
+
+static void RideMeasurementsRebuildActive()
+{
+    _rideMeasurementsActive.clear();
+    for (auto& ride : GetRideManager())
+    {
+        if (ride.measurement == nullptr)
+            continue;
+
+        if (RideMeasurementIsIdle(*ride.measurement))
+        {
+            // Stops the same way as a measurement that goes idle while on the list
+            ride.measurement->flags &= ~RIDE_MEASUREMENT_FLAG_RUNNING;
+        }
+        else
+        {
+            _rideMeasurementsActive.push_back(ride.id);
+        }
+    }
+    _rideMeasurementsActiveValid = true;
+}
+
 /**
  *
  *  rct2: 0x006B6456
@@ -2087,11 +2163,29 @@ void RideMeasurementsUpdate()
     if (gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR)
         return;
 
+    if (!_rideMeasurementsActiveValid)
+    {
+        RideMeasurementsRebuildActive();
+    }
+
+    // Drop the rides that were removed, lost their measurement or have not been looked at for a while
+    std::erase_if(_rideMeasurementsActive, [](RideId rideId) {
+        auto* ride = GetRide(rideId);
+        if (ride == nullptr || ride->measurement == nullptr)
+            return true;
+        if (!RideMeasurementIsIdle(*ride->measurement))
+            return false;
+
+        ride->measurement->flags &= ~RIDE_MEASUREMENT_FLAG_RUNNING;
+        return true;
+    });
+
     // For each ride measurement
-    for (auto& ride : GetRideManager())
+    for (auto rideId : _rideMeasurementsActive)
     {
+        auto& ride = *GetRide(rideId);
         auto measurement = ride.measurement.get();
-        if (measurement != nullptr && (ride.lifecycle_flags & RIDE_LIFECYCLE_ON_TRACK) && ride.status != RideStatus::Simulating)
+        if ((ride.lifecycle_flags & RIDE_LIFECYCLE_ON_TRACK) && ride.status != RideStatus::Simulating)
         {
             if (measurement->flags & RIDE_MEASUREMENT_FLAG_RUNNING)
             {
@@ -2172,6 +2266,12 @@ std::pair<RideMeasurement*, OpenRCT2String> Ride::GetMeasurement()
         }
         RideFreeOldMeasurements();
         assert(measurement != nullptr);
+        _rideMeasurementsActiveValid = false;
+    }
+    else if (RideMeasurementIsIdle(*measurement))
+    {
+        // Recording had stopped, the ride has to be put back on the active list
+        _rideMeasurementsActiveValid = false;
     }
 
     measurement->last_use_tick = GetGameState().CurrentTicks;
@@ -5917,6 +6017,8 @@ ResultWithMessage Ride::ChangeStatusCheckCompleteCircuit(const CoordsXYE& trackE
 
 ResultWithMessage Ride::ChangeStatusCheckTrackValidity(const CoordsXYE& trackElement)
 {
+    // The checks below all walk the same circuit
+    TrackCircuitCacheScope trackCircuitCache;
     CoordsXYE problematicTrackElement = {};
 
     if (IsBlockSectioned())
@@ -152,8 +152,49 @@ namespace OpenRCT2::RideAudio
         }
     };
 
+    /**
+     * Everything about the music tracking viewport that the audibility of a ride depends on.
+     */
+    struct MusicViewState
+    {
+        const Viewport* TrackingViewport{};
+        ScreenCoordsXY Pos{};
+        ScreenCoordsXY ViewPos{};
+        int32_t ViewWidth{};
+        int32_t ViewHeight{};
+        ZoomLevel Zoom{};
+        uint8_t Rotation{};
+        int32_t ScreenWidth{};
+        int32_t ScreenHeight{};
+        int32_t VolumeAdjustZoom{};
+
+        bool operator==(const MusicViewState& other) const
+        {
+            return TrackingViewport == other.TrackingViewport && Pos == other.Pos && ViewPos == other.ViewPos
+                && ViewWidth == other.ViewWidth && ViewHeight == other.ViewHeight && Zoom == other.Zoom
+                && Rotation == other.Rotation && ScreenWidth == other.ScreenWidth && ScreenHeight == other.ScreenHeight
+                && VolumeAdjustZoom == other.VolumeAdjustZoom;
+        }
+    };
+
+    /**
+     * The volume and pan of a ride's music as heard from the tracking viewport, only valid while the view state it was
+     * calculated for is unchanged.
+     */
+    struct RideMusicAudibility
+    {
+        uint32_t Generation{};
+        CoordsXYZ RideCoords{};
+        bool Audible{};
+        int16_t Volume{};
+        int16_t Pan{};
+    };
+
     static std::vector<ViewportRideMusicInstance> _musicInstances;
     static std::vector<RideMusicChannel> _musicChannels;
+    static MusicViewState _musicViewState;
+    static uint32_t _musicViewGeneration = 1;
+    static std::vector<RideMusicAudibility> _rideMusicAudibility;
 
     void StopAllChannels()
     {
@@ -256,6 +297,9 @@ namespace OpenRCT2::RideAudio
         if ((gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR) != 0 || (gScreenFlags & SCREEN_FLAGS_TITLE_DEMO) != 0)
             return;
 
+        if (gOpenRCT2Headless)
+            return;
+
         // TODO Allow circus music (CSS24) to play if ride music is disabled (that should be sound)
         if (gGameSoundsOff || !gConfigSound.RideMusicEnabled)
             return;
@@ -375,6 +419,95 @@ namespace OpenRCT2::RideAudio
         return result;
     }
 
+    static MusicViewState GetMusicViewState(const Viewport& viewport)
+    {
+        MusicViewState state;
+        state.TrackingViewport = &viewport;
+        state.Pos = viewport.pos;
+        state.ViewPos = viewport.viewPos;
+        state.ViewWidth = viewport.view_width;
+        state.ViewHeight = viewport.view_height;
+        state.Zoom = viewport.zoom;
+        state.Rotation = GetCurrentRotation();
+        state.ScreenWidth = std::max(ContextGetWidth(), 64);
+        state.ScreenHeight = std::max(ContextGetHeight(), 64);
+        state.VolumeAdjustZoom = gVolumeAdjustZoom;
+        return state;
+    }
+
+    static RideMusicAudibility CalculateAudibility(const MusicViewState& state, const CoordsXYZ& rideCoords)
+    {
+        RideMusicAudibility result;
+        result.Generation = _musicViewGeneration;
+        result.RideCoords = rideCoords;
+
+        auto rotatedCoords = Translate3DTo2DWithZ(state.Rotation, rideCoords);
+        auto viewWidth = state.ViewWidth;
+        auto viewWidth2 = viewWidth * 2;
+        auto viewX = state.ViewPos.x - viewWidth2;
+        auto viewY = state.ViewPos.y - viewWidth;
+        auto viewX2 = viewWidth2 + viewWidth2 + state.ViewWidth + viewX;
+        auto viewY2 = viewWidth + viewWidth + state.ViewHeight + viewY;
+        if (viewX >= rotatedCoords.x || viewY >= rotatedCoords.y || viewX2 < rotatedCoords.x || viewY2 < rotatedCoords.y)
+        {
+            return result;
+        }
+
+        auto x2 = (state.Pos.x + state.Zoom.ApplyInversedTo(rotatedCoords.x - state.ViewPos.x)) * 0x10000;
+        auto panX = ((x2 / state.ScreenWidth) - 0x8000) >> 4;
+
+        auto y2 = (state.Pos.y + state.Zoom.ApplyInversedTo(rotatedCoords.y - state.ViewPos.y)) * 0x10000;
+        auto panY = ((y2 / state.ScreenHeight) - 0x8000) >> 4;
+
+        auto volX = CalculateVolume(panX);
+        auto volY = CalculateVolume(panY);
+        auto volXY = std::min(volX, volY);
+        if (volXY < state.VolumeAdjustZoom * 3)
+        {
+            volXY = 0;
+        }
+        else
+        {
+            volXY = volXY - (state.VolumeAdjustZoom * 3);
+        }
+
+        int16_t newVolume = -((static_cast<uint8_t>(-volXY - 1) * static_cast<uint8_t>(-volXY - 1)) / 16) - 700;
+        if (volXY != 0 && newVolume >= -4000)
+        {
+            result.Audible = true;
+            result.Volume = newVolume;
+            result.Pan = std::clamp(panX, -10000, 10000);
+        }
+        return result;
+    }
+
+    /**
+     * Gets how the ride's music is heard from the tracking viewport, recalculating it only when the view has moved, zoomed
+     * or rotated since it was last calculated or the ride's music now comes from elsewhere.
+     */
+    static const RideMusicAudibility& GetAudibility(const Ride& ride, const CoordsXYZ& rideCoords)
+    {
+        auto state = GetMusicViewState(*g_music_tracking_viewport);
+        if (!(state == _musicViewState))
+        {
+            _musicViewState = state;
+            _musicViewGeneration++;
+        }
+
+        const auto index = ride.id.ToUnderlying();
+        if (index >= _rideMusicAudibility.size())
+        {
+            _rideMusicAudibility.resize(index + 1);
+        }
+
+        auto& audibility = _rideMusicAudibility[index];
+        if (audibility.Generation != _musicViewGeneration || audibility.RideCoords != rideCoords)
+        {
+            audibility = CalculateAudibility(state, rideCoords);
+        }
+        return audibility;
+    }
+
     /**
      * Register an instance of audible ride music for this frame at the given coordinates.
      */
@@ -382,50 +515,14 @@ namespace OpenRCT2::RideAudio
     {
         if (!(gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR) && !gGameSoundsOff && g_music_tracking_viewport != nullptr)
         {
-            auto rotatedCoords = Translate3DTo2DWithZ(GetCurrentRotation(), rideCoords);
-            auto viewport = g_music_tracking_viewport;
-            auto viewWidth = viewport->view_width;
-            auto viewWidth2 = viewWidth * 2;
-            auto viewX = viewport->viewPos.x - viewWidth2;
-            auto viewY = viewport->viewPos.y - viewWidth;
-            auto viewX2 = viewWidth2 + viewWidth2 + viewport->view_width + viewX;
-            auto viewY2 = viewWidth + viewWidth + viewport->view_height + viewY;
-            if (viewX >= rotatedCoords.x || viewY >= rotatedCoords.y || viewX2 < rotatedCoords.x || viewY2 < rotatedCoords.y)
+            const auto& audibility = GetAudibility(ride, rideCoords);
+            if (audibility.Audible)
             {
-                RideUpdateMusicPosition(ride);
+                RideUpdateMusicPosition(ride, audibility.Volume, audibility.Pan, sampleRate);
             }
             else
             {
-                auto x2 = (viewport->pos.x + viewport->zoom.ApplyInversedTo(rotatedCoords.x - viewport->viewPos.x)) * 0x10000;
-                auto screenWidth = std::max(ContextGetWidth(), 64);
-                auto panX = ((x2 / screenWidth) - 0x8000) >> 4;
-
-                auto y2 = (viewport->pos.y + viewport->zoom.ApplyInversedTo(rotatedCoords.y - viewport->viewPos.y)) * 0x10000;
-                auto screenHeight = std::max(ContextGetHeight(), 64);
-                auto panY = ((y2 / screenHeight) - 0x8000) >> 4;
-
-                auto volX = CalculateVolume(panX);
-                auto volY = CalculateVolume(panY);
-                auto volXY = std::min(volX, volY);
-                if (volXY < gVolumeAdjustZoom * 3)
-                {
-                    volXY = 0;
-                }
-                else
-                {
-                    volXY = volXY - (gVolumeAdjustZoom * 3);
-                }
-
-                int16_t newVolume = -((static_cast<uint8_t>(-volXY - 1) * static_cast<uint8_t>(-volXY - 1)) / 16) - 700;
-                if (volXY != 0 && newVolume >= -4000)
-                {
-                    auto newPan = std::clamp(panX, -10000, 10000);
-                    RideUpdateMusicPosition(ride, newVolume, newPan, sampleRate);
-                }
-                else
-                {
-                    RideUpdateMusicPosition(ride);
-                }
+                RideUpdateMusicPosition(ride);
             }
         }
     }
@@ -339,25 +339,20 @@ void Ride::RemovePeeps()
 
 void RideClearBlockedTiles(const Ride& ride)
 {
-    auto& gameState = GetGameState();
-    for (TileCoordsXY tilePos = {}; tilePos.x < gameState.MapSize.x; ++tilePos.x)
+    const auto& mapSize = GetGameState().MapSize;
+    const auto mapRange = MapRange{ 0, 0, (mapSize.x - 1) * COORDS_XY_STEP, (mapSize.y - 1) * COORDS_XY_STEP };
+    for (auto [tilePos, trackElement] : TileElementsRangeView<TrackElement>(mapRange))
     {
-        for (tilePos.y = 0; tilePos.y < gameState.MapSize.y; ++tilePos.y)
-        {
-            for (auto* trackElement : TileElementsView<TrackElement>(tilePos.ToCoordsXY()))
-            {
-                if (trackElement->GetRideIndex() != ride.id)
-                    continue;
+        if (trackElement->GetRideIndex() != ride.id)
+            continue;
 
-                // Unblock footpath element that is at same position
-                auto* footpathElement = MapGetFootpathElement(TileCoordsXYZ{ tilePos, trackElement->BaseHeight }.ToCoordsXYZ());
+        // Unblock footpath element that is at same position
+        auto* footpathElement = MapGetFootpathElement(TileCoordsXYZ{ tilePos, trackElement->BaseHeight }.ToCoordsXYZ());
 
-                if (footpathElement == nullptr)
-                    continue;
+        if (footpathElement == nullptr)
+            continue;
 
-                footpathElement->SetIsBlockedByVehicle(false);
-            }
-        }
+        footpathElement->SetIsBlockedByVehicle(false);
     }
 }
 
@@ -13,8 +13,11 @@
 #include "../Context.h"
 #include "../GameState.h"
 #include "../OpenRCT2.h"
+#include "../config/Config.h"
+#include "../core/JobPool.h"
 #include "../interface/Window.h"
 #include "../localisation/Date.h"
+#include "../network/network.h"
 #include "../profiling/Profiling.h"
 #include "../scripting/ScriptEngine.h"
 #include "../world/Footpath.h"
@@ -27,6 +30,10 @@
 
 #include <algorithm>
 #include <iterator>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
@@ -82,6 +89,123 @@ struct ShelteredEights
 // The total amount would be MaxRideRatingSubSteps * RideRatingMaxUpdateStates which
 // would be currently 80, this is the worst case of sub-steps and may break out earlier.
 static constexpr size_t MaxRideRatingUpdateSubSteps = 20;
+// Upper bound for walking the track of a single ride in one go, only reached by track that never ends or loops back.
+static constexpr size_t MaxRideRatingInstantSubSteps = 100000;
+
+static std::unique_ptr<JobPool> _rideRatingJobs;
+
+/**
+ * The proximity scoring looks at the element stacks of the tiles along the track and beside it, neighbouring track
+ * pieces share most of those tiles. Each stack is reduced to the elements the scoring looks at the first time it is
+ * needed. The cache only lives for one batch of track pieces as the map may change between batches, it is thread local
+ * so the track walks of different update states can run concurrently.
+ */
+struct ProximityTileElement
+{
+    TileElementType Type;
+    uint8_t BaseHeight;
+    uint8_t ClearanceHeight;
+    Direction ElementDirection;
+    bool IsQueue;
+    bool IsStation;
+    uint8_t SequenceIndex;
+    track_type_t TrackType;
+    RideId RideIndex;
+    int32_t WaterHeight;
+
+    int32_t GetBaseZ() const
+    {
+        return BaseHeight * COORDS_Z_STEP;
+    }
+
+    int32_t GetClearanceZ() const
+    {
+        return ClearanceHeight * COORDS_Z_STEP;
+    }
+};
+
+class ProximityTileCache
+{
+    struct Tile
+    {
+        uint32_t Begin;
+        uint32_t Count;
+        bool HasElements;
+    };
+
+    std::unordered_map<uint32_t, Tile> _tiles;
+    std::vector<ProximityTileElement> _elements;
+
+public:
+    void Clear()
+    {
+        _tiles.clear();
+        _elements.clear();
+    }
+
+    // Returns false if there is no element stack at loc at all.
+    bool Get(const CoordsXY& loc, std::span<const ProximityTileElement>& elements)
+    {
+        const auto tileKey = (static_cast<uint32_t>(loc.x / COORDS_XY_STEP) << 16)
+            | static_cast<uint32_t>(loc.y / COORDS_XY_STEP);
+        auto it = _tiles.find(tileKey);
+        if (it == _tiles.end())
+        {
+            it = _tiles.emplace(tileKey, Classify(loc)).first;
+        }
+        elements = { _elements.data() + it->second.Begin, it->second.Count };
+        return it->second.HasElements;
+    }
+
+private:
+    Tile Classify(const CoordsXY& loc)
+    {
+        Tile tile{ static_cast<uint32_t>(_elements.size()), 0, false };
+        TileElement* tileElement = MapGetFirstElementAt(loc);
+        if (tileElement == nullptr)
+            return tile;
+
+        tile.HasElements = true;
+        do
+        {
+            if (tileElement->IsGhost())
+                continue;
+
+            const auto type = tileElement->GetType();
+            if (type != TileElementType::Surface && type != TileElementType::Path && type != TileElementType::Track
+                && type != TileElementType::SmallScenery && type != TileElementType::LargeScenery)
+                continue;
+
+            ProximityTileElement element{};
+            element.Type = type;
+            element.BaseHeight = tileElement->BaseHeight;
+            element.ClearanceHeight = tileElement->ClearanceHeight;
+            element.ElementDirection = tileElement->GetDirection();
+            element.RideIndex = RideId::GetNull();
+            if (type == TileElementType::Surface)
+            {
+                element.WaterHeight = tileElement->AsSurface()->GetWaterHeight();
+            }
+            else if (type == TileElementType::Path)
+            {
+                element.IsQueue = tileElement->AsPath()->IsQueue();
+            }
+            else if (type == TileElementType::Track)
+            {
+                const auto* trackElement = tileElement->AsTrack();
+                element.IsStation = trackElement->IsStation();
+                element.SequenceIndex = trackElement->GetSequenceIndex();
+                element.TrackType = trackElement->GetTrackType();
+                element.RideIndex = trackElement->GetRideIndex();
+            }
+            _elements.push_back(element);
+            tile.Count++;
+        } while (!(tileElement++)->IsLastForTile());
+        return tile;
+    }
+};
+
+static thread_local ProximityTileCache _proximityTileCache;
 
 static void ride_ratings_update_state(RideRatingUpdateState& state);
 static void ride_ratings_update_state_0(RideRatingUpdateState& state);
@@ -173,6 +297,7 @@ void RideRatingsUpdateRide(const Ride& ride)
     {
         state.CurrentRide = ride.id;
         state.State = RIDE_RATINGS_STATE_INITIALISE;
+        _proximityTileCache.Clear();
         while (state.State != RIDE_RATINGS_STATE_FIND_NEXT_RIDE)
         {
             ride_ratings_update_state(state);
@@ -180,6 +305,74 @@ void RideRatingsUpdateRide(const Ride& ride)
     }
 }
 
+static bool RideRatingsInstantEnabled()
+{
+    return gConfigGeneral.InstantRideRatings && NetworkGetMode() == NETWORK_MODE_NONE;
+}
+
+/**
+ * Walks the track of the ride the state is rating up to the point where the ratings are ready to be calculated. This
+ * only reads the map and the ride, so the states can be walked concurrently while the game state is not modified.
+ */
+static void RideRatingsWalkTrack(RideRatingUpdateState& state)
+{
+    _proximityTileCache.Clear();
+    for (size_t i = 0; i < MaxRideRatingInstantSubSteps; ++i)
+    {
+        if (state.State == RIDE_RATINGS_STATE_FIND_NEXT_RIDE || state.State == RIDE_RATINGS_STATE_CALCULATE)
+            break;
+
+        ride_ratings_update_state(state);
+    }
+}
+
+/**
+ * Rates a whole ride per update state each tick instead of advancing each state by a few track pieces. Picking the
+ * next ride and committing the ratings happen on the main thread, only the track walks in between are spread over the
+ * job pool.
+ */
+static void RideRatingsUpdateAllInstant(RideRatingUpdateStates& updateStates)
+{
+    for (auto& updateState : updateStates)
+    {
+        if (updateState.State == RIDE_RATINGS_STATE_FIND_NEXT_RIDE)
+        {
+            ride_ratings_update_state(updateState);
+        }
+    }
+
+    const auto numWalks = std::count_if(updateStates.begin(), updateStates.end(), [](const auto& updateState) {
+        return updateState.State != RIDE_RATINGS_STATE_FIND_NEXT_RIDE && updateState.State != RIDE_RATINGS_STATE_CALCULATE;
+    });
+    if (gConfigGeneral.MultiThreading && numWalks > 1)
+    {
+        if (_rideRatingJobs == nullptr)
+        {
+            _rideRatingJobs = std::make_unique<JobPool>();
+        }
+        for (auto& updateState : updateStates)
+        {
+            _rideRatingJobs->AddTask([&updateState]() { RideRatingsWalkTrack(updateState); });
+        }
+        _rideRatingJobs->Join();
+    }
+    else
+    {
+        for (auto& updateState : updateStates)
+        {
+            RideRatingsWalkTrack(updateState);
+        }
+    }
+
+    for (auto& updateState : updateStates)
+    {
+        if (updateState.State == RIDE_RATINGS_STATE_CALCULATE)
+        {
+            ride_ratings_update_state(updateState);
+        }
+    }
+}
+
 /**
  *
  *  rct2: 0x006B5A2A
@@ -191,8 +384,15 @@ void RideRatingsUpdateAll()
     if (gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR)
         return;
 
+    if (RideRatingsInstantEnabled())
+    {
+        RideRatingsUpdateAllInstant(GetGameState().RideRatingUpdateStates);
+        return;
+    }
+
     for (auto& updateState : GetGameState().RideRatingUpdateStates)
     {
+        _proximityTileCache.Clear();
         for (size_t i = 0; i < MaxRideRatingUpdateSubSteps; ++i)
         {
             ride_ratings_update_state(updateState);
@@ -565,35 +765,33 @@ static void ride_ratings_score_close_proximity_in_direction(
     if (!MapIsLocationValid(scorePos))
         return;
 
-    TileElement* tileElement = MapGetFirstElementAt(scorePos);
-    if (tileElement == nullptr)
+    std::span<const ProximityTileElement> tileElements;
+    if (!_proximityTileCache.Get(scorePos, tileElements))
         return;
-    do
-    {
-        if (tileElement->IsGhost())
-            continue;
 
-        switch (tileElement->GetType())
+    for (const auto& tileElement : tileElements)
+    {
+        switch (tileElement.Type)
         {
             case TileElementType::Surface:
                 if (state.ProximityBaseHeight <= inputTileElement->BaseHeight)
                 {
-                    if (inputTileElement->ClearanceHeight <= tileElement->BaseHeight)
+                    if (inputTileElement->ClearanceHeight <= tileElement.BaseHeight)
                     {
                         proximity_score_increment(state, PROXIMITY_SURFACE_SIDE_CLOSE);
                     }
                 }
                 break;
             case TileElementType::Path:
-                if (abs(inputTileElement->GetBaseZ() - tileElement->GetBaseZ()) <= 2 * COORDS_Z_STEP)
+                if (abs(inputTileElement->GetBaseZ() - tileElement.GetBaseZ()) <= 2 * COORDS_Z_STEP)
                 {
                     proximity_score_increment(state, PROXIMITY_PATH_SIDE_CLOSE);
                 }
                 break;
             case TileElementType::Track:
-                if (inputTileElement->AsTrack()->GetRideIndex() != tileElement->AsTrack()->GetRideIndex())
+                if (inputTileElement->AsTrack()->GetRideIndex() != tileElement.RideIndex)
                 {
-                    if (abs(inputTileElement->GetBaseZ() - tileElement->GetBaseZ()) <= 2 * COORDS_Z_STEP)
+                    if (abs(inputTileElement->GetBaseZ() - tileElement.GetBaseZ()) <= 2 * COORDS_Z_STEP)
                     {
                         proximity_score_increment(state, PROXIMITY_FOREIGN_TRACK_SIDE_CLOSE);
                     }
@@ -601,9 +799,9 @@ static void ride_ratings_score_close_proximity_in_direction(
                 break;
             case TileElementType::SmallScenery:
             case TileElementType::LargeScenery:
-                if (tileElement->GetBaseZ() < inputTileElement->GetClearanceZ())
+                if (tileElement.GetBaseZ() < inputTileElement->GetClearanceZ())
                 {
-                    if (inputTileElement->GetBaseZ() > tileElement->GetClearanceZ())
+                    if (inputTileElement->GetBaseZ() > tileElement.GetClearanceZ())
                     {
                         proximity_score_increment(state, PROXIMITY_SCENERY_SIDE_ABOVE);
                     }
@@ -616,48 +814,45 @@ static void ride_ratings_score_close_proximity_in_direction(
             default:
                 break;
         }
-    } while (!(tileElement++)->IsLastForTile());
+    }
 }
 
 static void ride_ratings_score_close_proximity_loops_helper(RideRatingUpdateState& state, const CoordsXYE& coordsElement)
 {
-    TileElement* tileElement = MapGetFirstElementAt(coordsElement);
-    if (tileElement == nullptr)
+    std::span<const ProximityTileElement> tileElements;
+    if (!_proximityTileCache.Get(coordsElement, tileElements))
         return;
-    do
-    {
-        if (tileElement->IsGhost())
-            continue;
 
-        auto type = tileElement->GetType();
-        if (type == TileElementType::Path)
+    for (const auto& tileElement : tileElements)
+    {
+        if (tileElement.Type == TileElementType::Path)
         {
-            int32_t zDiff = static_cast<int32_t>(tileElement->BaseHeight)
+            int32_t zDiff = static_cast<int32_t>(tileElement.BaseHeight)
                 - static_cast<int32_t>(coordsElement.element->BaseHeight);
             if (zDiff >= 0 && zDiff <= 16)
             {
                 proximity_score_increment(state, PROXIMITY_PATH_TROUGH_VERTICAL_LOOP);
             }
         }
-        else if (type == TileElementType::Track)
+        else if (tileElement.Type == TileElementType::Track)
         {
-            bool elementsAreAt90DegAngle = ((tileElement->GetDirection() ^ coordsElement.element->GetDirection()) & 1) != 0;
+            bool elementsAreAt90DegAngle = ((tileElement.ElementDirection ^ coordsElement.element->GetDirection()) & 1) != 0;
             if (elementsAreAt90DegAngle)
             {
-                int32_t zDiff = static_cast<int32_t>(tileElement->BaseHeight)
+                int32_t zDiff = static_cast<int32_t>(tileElement.BaseHeight)
                     - static_cast<int32_t>(coordsElement.element->BaseHeight);
                 if (zDiff >= 0 && zDiff <= 16)
                 {
                     proximity_score_increment(state, PROXIMITY_TRACK_THROUGH_VERTICAL_LOOP);
-                    if (tileElement->AsTrack()->GetTrackType() == TrackElemType::LeftVerticalLoop
-                        || tileElement->AsTrack()->GetTrackType() == TrackElemType::RightVerticalLoop)
+                    if (tileElement.TrackType == TrackElemType::LeftVerticalLoop
+                        || tileElement.TrackType == TrackElemType::RightVerticalLoop)
                     {
                         proximity_score_increment(state, PROXIMITY_INTERSECTING_VERTICAL_LOOP);
                     }
                 }
             }
         }
-    } while (!(tileElement++)->IsLastForTile());
+    }
 }
 
 /**
@@ -689,24 +884,22 @@ static void ride_ratings_score_close_proximity(RideRatingUpdateState& state, Til
     }
 
     state.ProximityTotal++;
-    TileElement* tileElement = MapGetFirstElementAt(state.Proximity);
-    if (tileElement == nullptr)
+    std::span<const ProximityTileElement> tileElements;
+    if (!_proximityTileCache.Get(state.Proximity, tileElements))
         return;
-    do
-    {
-        if (tileElement->IsGhost())
-            continue;
 
+    for (const auto& tileElement : tileElements)
+    {
         int32_t waterHeight;
-        switch (tileElement->GetType())
+        switch (tileElement.Type)
         {
             case TileElementType::Surface:
-                state.ProximityBaseHeight = tileElement->BaseHeight;
-                if (tileElement->GetBaseZ() == state.Proximity.z)
+                state.ProximityBaseHeight = tileElement.BaseHeight;
+                if (tileElement.GetBaseZ() == state.Proximity.z)
                 {
                     proximity_score_increment(state, PROXIMITY_SURFACE_TOUCH);
                 }
-                waterHeight = tileElement->AsSurface()->GetWaterHeight();
+                waterHeight = tileElement.WaterHeight;
                 if (waterHeight != 0)
                 {
                     auto z = waterHeight;
@@ -731,28 +924,28 @@ static void ride_ratings_score_close_proximity(RideRatingUpdateState& state, Til
                 }
                 break;
             case TileElementType::Path:
-                if (!tileElement->AsPath()->IsQueue())
+                if (!tileElement.IsQueue)
                 {
-                    if (tileElement->GetClearanceZ() == inputTileElement->GetBaseZ())
+                    if (tileElement.GetClearanceZ() == inputTileElement->GetBaseZ())
                     {
                         proximity_score_increment(state, PROXIMITY_PATH_TOUCH_ABOVE);
                     }
-                    if (tileElement->GetBaseZ() == inputTileElement->GetClearanceZ())
+                    if (tileElement.GetBaseZ() == inputTileElement->GetClearanceZ())
                     {
                         proximity_score_increment(state, PROXIMITY_PATH_TOUCH_UNDER);
                     }
                 }
                 else
                 {
-                    if (tileElement->GetClearanceZ() <= inputTileElement->GetBaseZ())
+                    if (tileElement.GetClearanceZ() <= inputTileElement->GetBaseZ())
                     {
                         proximity_score_increment(state, PROXIMITY_QUEUE_PATH_OVER);
                     }
-                    if (tileElement->GetClearanceZ() == inputTileElement->GetBaseZ())
+                    if (tileElement.GetClearanceZ() == inputTileElement->GetBaseZ())
                     {
                         proximity_score_increment(state, PROXIMITY_QUEUE_PATH_TOUCH_ABOVE);
                     }
-                    if (tileElement->GetBaseZ() == inputTileElement->GetClearanceZ())
+                    if (tileElement.GetBaseZ() == inputTileElement->GetClearanceZ())
                     {
                         proximity_score_increment(state, PROXIMITY_QUEUE_PATH_TOUCH_UNDER);
                     }
@@ -760,39 +953,39 @@ static void ride_ratings_score_close_proximity(RideRatingUpdateState& state, Til
                 break;
             case TileElementType::Track:
             {
-                auto trackType = tileElement->AsTrack()->GetTrackType();
+                auto trackType = tileElement.TrackType;
                 if (trackType == TrackElemType::LeftVerticalLoop || trackType == TrackElemType::RightVerticalLoop)
                 {
-                    int32_t sequence = tileElement->AsTrack()->GetSequenceIndex();
+                    int32_t sequence = tileElement.SequenceIndex;
                     if (sequence == 3 || sequence == 6)
                     {
-                        if (tileElement->BaseHeight - inputTileElement->ClearanceHeight <= 10)
+                        if (tileElement.BaseHeight - inputTileElement->ClearanceHeight <= 10)
                         {
                             proximity_score_increment(state, PROXIMITY_THROUGH_VERTICAL_LOOP);
                         }
                     }
                 }
-                if (inputTileElement->AsTrack()->GetRideIndex() != tileElement->AsTrack()->GetRideIndex())
+                if (inputTileElement->AsTrack()->GetRideIndex() != tileElement.RideIndex)
                 {
                     proximity_score_increment(state, PROXIMITY_FOREIGN_TRACK_ABOVE_OR_BELOW);
-                    if (tileElement->GetClearanceZ() == inputTileElement->GetBaseZ())
+                    if (tileElement.GetClearanceZ() == inputTileElement->GetBaseZ())
                     {
                         proximity_score_increment(state, PROXIMITY_FOREIGN_TRACK_TOUCH_ABOVE);
                     }
-                    if (tileElement->ClearanceHeight + 2 <= inputTileElement->BaseHeight)
+                    if (tileElement.ClearanceHeight + 2 <= inputTileElement->BaseHeight)
                     {
-                        if (tileElement->ClearanceHeight + 10 >= inputTileElement->BaseHeight)
+                        if (tileElement.ClearanceHeight + 10 >= inputTileElement->BaseHeight)
                         {
                             proximity_score_increment(state, PROXIMITY_FOREIGN_TRACK_CLOSE_ABOVE);
                         }
                     }
-                    if (inputTileElement->ClearanceHeight == tileElement->BaseHeight)
+                    if (inputTileElement->ClearanceHeight == tileElement.BaseHeight)
                     {
                         proximity_score_increment(state, PROXIMITY_FOREIGN_TRACK_TOUCH_ABOVE);
                     }
-                    if (inputTileElement->ClearanceHeight + 2 == tileElement->BaseHeight)
+                    if (inputTileElement->ClearanceHeight + 2 == tileElement.BaseHeight)
                     {
-                        if (static_cast<uint8_t>(inputTileElement->ClearanceHeight + 10) >= tileElement->BaseHeight)
+                        if (static_cast<uint8_t>(inputTileElement->ClearanceHeight + 10) >= tileElement.BaseHeight)
                         {
                             proximity_score_increment(state, PROXIMITY_FOREIGN_TRACK_CLOSE_ABOVE);
                         }
@@ -800,8 +993,8 @@ static void ride_ratings_score_close_proximity(RideRatingUpdateState& state, Til
                 }
                 else
                 {
-                    bool isStation = tileElement->AsTrack()->IsStation();
-                    if (tileElement->ClearanceHeight == inputTileElement->BaseHeight)
+                    bool isStation = tileElement.IsStation;
+                    if (tileElement.ClearanceHeight == inputTileElement->BaseHeight)
                     {
                         proximity_score_increment(state, PROXIMITY_OWN_TRACK_TOUCH_ABOVE);
                         if (isStation)
@@ -809,9 +1002,9 @@ static void ride_ratings_score_close_proximity(RideRatingUpdateState& state, Til
                             proximity_score_increment(state, PROXIMITY_OWN_STATION_TOUCH_ABOVE);
                         }
                     }
-                    if (tileElement->ClearanceHeight + 2 <= inputTileElement->BaseHeight)
+                    if (tileElement.ClearanceHeight + 2 <= inputTileElement->BaseHeight)
                     {
-                        if (tileElement->ClearanceHeight + 10 >= inputTileElement->BaseHeight)
+                        if (tileElement.ClearanceHeight + 10 >= inputTileElement->BaseHeight)
                         {
                             proximity_score_increment(state, PROXIMITY_OWN_TRACK_CLOSE_ABOVE);
                             if (isStation)
@@ -821,7 +1014,7 @@ static void ride_ratings_score_close_proximity(RideRatingUpdateState& state, Til
                         }
                     }
 
-                    if (inputTileElement->GetClearanceZ() == tileElement->GetBaseZ())
+                    if (inputTileElement->GetClearanceZ() == tileElement.GetBaseZ())
                     {
                         proximity_score_increment(state, PROXIMITY_OWN_TRACK_TOUCH_ABOVE);
                         if (isStation)
@@ -829,9 +1022,9 @@ static void ride_ratings_score_close_proximity(RideRatingUpdateState& state, Til
                             proximity_score_increment(state, PROXIMITY_OWN_STATION_TOUCH_ABOVE);
                         }
                     }
-                    if (inputTileElement->ClearanceHeight + 2 <= tileElement->BaseHeight)
+                    if (inputTileElement->ClearanceHeight + 2 <= tileElement.BaseHeight)
                     {
-                        if (inputTileElement->ClearanceHeight + 10 >= tileElement->BaseHeight)
+                        if (inputTileElement->ClearanceHeight + 10 >= tileElement.BaseHeight)
                         {
                             proximity_score_increment(state, PROXIMITY_OWN_TRACK_CLOSE_ABOVE);
                             if (isStation)
@@ -845,8 +1038,8 @@ static void ride_ratings_score_close_proximity(RideRatingUpdateState& state, Til
             }
             default:
                 break;
-        } // switch tileElement->GetType
-    } while (!(tileElement++)->IsLastForTile());
+        } // switch tileElement.Type
+    }
 
     uint8_t direction = inputTileElement->GetDirection();
     ride_ratings_score_close_proximity_in_direction(state, inputTileElement, (direction + 1) & 3);
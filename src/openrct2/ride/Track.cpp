@@ -35,6 +35,8 @@
 #include "TrackData.h"
 #include "TrackDesign.h"
 
+#include <unordered_map>
+
 using namespace OpenRCT2;
 using namespace OpenRCT2::TrackMetaData;
 
@@ -403,6 +405,73 @@ ResultWithMessage TrackRemoveStationElement(const CoordsXYZD& loc, RideId rideIn
     return { true };
 }
 
+struct TrackCircuitNextPiece
+{
+    CoordsXYE Element;
+    int32_t Z;
+    int32_t Direction;
+};
+
+static int32_t _trackCircuitCacheDepth;
+static std::unordered_map<const TileElement*, TrackCircuitNextPiece> _trackCircuitNextCache;
+static std::unordered_map<const TileElement*, TrackBeginEnd> _trackCircuitPreviousCache;
+
+TrackCircuitCacheScope::TrackCircuitCacheScope()
+{
+    _trackCircuitCacheDepth++;
+}
+
+TrackCircuitCacheScope::~TrackCircuitCacheScope()
+{
+    if (--_trackCircuitCacheDepth == 0)
+    {
+        _trackCircuitNextCache.clear();
+        _trackCircuitPreviousCache.clear();
+    }
+}
+
+// Only successful steps are remembered, as a failed one leaves some of the outputs untouched
+static bool TrackCircuitGetNext(CoordsXYE* input, CoordsXYE* output, int32_t* z, int32_t* direction)
+{
+    if (_trackCircuitCacheDepth == 0)
+        return TrackBlockGetNext(input, output, z, direction);
+
+    auto it = _trackCircuitNextCache.find(input->element);
+    if (it != _trackCircuitNextCache.end())
+    {
+        *output = it->second.Element;
+        *z = it->second.Z;
+        *direction = it->second.Direction;
+        return true;
+    }
+
+    const auto* inputElement = input->element;
+    if (!TrackBlockGetNext(input, output, z, direction))
+        return false;
+
+    _trackCircuitNextCache.emplace(inputElement, TrackCircuitNextPiece{ *output, *z, *direction });
+    return true;
+}
+
+static bool TrackCircuitGetPrevious(const CoordsXYE& input, TrackBeginEnd* output)
+{
+    if (_trackCircuitCacheDepth == 0)
+        return TrackBlockGetPrevious(input, output);
+
+    auto it = _trackCircuitPreviousCache.find(input.element);
+    if (it != _trackCircuitPreviousCache.end())
+    {
+        *output = it->second;
+        return true;
+    }
+
+    if (!TrackBlockGetPrevious(input, output))
+        return false;
+
+    _trackCircuitPreviousCache.emplace(input.element, *output);
+    return true;
+}
+
 void TrackCircuitIteratorBegin(TrackCircuitIterator* it, CoordsXYE first)
 {
     it->last = first;
@@ -417,7 +486,7 @@ bool TrackCircuitIteratorPrevious(TrackCircuitIterator* it)
 
     if (it->first == nullptr)
     {
-        if (!TrackBlockGetPrevious({ it->last.x, it->last.y, it->last.element }, &trackBeginEnd))
+        if (!TrackCircuitGetPrevious({ it->last.x, it->last.y, it->last.element }, &trackBeginEnd))
             return false;
 
         it->current.x = trackBeginEnd.begin_x;
@@ -439,7 +508,7 @@ bool TrackCircuitIteratorPrevious(TrackCircuitIterator* it)
     it->firstIteration = false;
     it->last = it->current;
 
-    if (TrackBlockGetPrevious({ it->last.x, it->last.y, it->last.element }, &trackBeginEnd))
+    if (TrackCircuitGetPrevious({ it->last.x, it->last.y, it->last.element }, &trackBeginEnd))
     {
         it->current.x = trackBeginEnd.end_x;
         it->current.y = trackBeginEnd.end_y;
@@ -456,7 +525,7 @@ bool TrackCircuitIteratorNext(TrackCircuitIterator* it)
 {
     if (it->first == nullptr)
     {
-        if (!TrackBlockGetNext(&it->last, &it->current, &it->currentZ, &it->currentDirection))
+        if (!TrackCircuitGetNext(&it->last, &it->current, &it->currentZ, &it->currentDirection))
             return false;
 
         it->first = it->current.element;
@@ -471,7 +540,7 @@ bool TrackCircuitIteratorNext(TrackCircuitIterator* it)
 
     it->firstIteration = false;
     it->last = it->current;
-    return TrackBlockGetNext(&it->last, &it->current, &it->currentZ, &it->currentDirection);
+    return TrackCircuitGetNext(&it->last, &it->current, &it->currentZ, &it->currentDirection);
 }
 
 bool TrackCircuitIteratorsMatch(const TrackCircuitIterator* firstIt, const TrackCircuitIterator* secondIt)
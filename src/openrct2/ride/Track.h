@@ -669,6 +669,19 @@ PitchAndRoll TrackPitchAndRollEnd(track_type_t trackType);
 
 int32_t TrackIsConnectedByShape(TileElement* a, TileElement* b);
 
+/**
+ * While a scope is alive, circuit iterators remember the pieces they step between, so the several checks made over
+ * the same circuit only search the tile elements once. The map must not be changed while a scope is active.
+ */
+class TrackCircuitCacheScope
+{
+public:
+    TrackCircuitCacheScope();
+    ~TrackCircuitCacheScope();
+    TrackCircuitCacheScope(const TrackCircuitCacheScope&) = delete;
+    TrackCircuitCacheScope& operator=(const TrackCircuitCacheScope&) = delete;
+};
+
 void TrackCircuitIteratorBegin(TrackCircuitIterator* it, CoordsXYE first);
 bool TrackCircuitIteratorPrevious(TrackCircuitIterator* it);
 bool TrackCircuitIteratorNext(TrackCircuitIterator* it);
@@ -7996,6 +7996,12 @@ namespace OpenRCT2
                 desc.Description = RideConfigurationStringIds[i];
                 desc.AlternativeType = AlternativeTrackTypes[i];
                 desc.Block = const_cast<PreviewTrack*>(TrackBlocks[i]);
+                desc.NumSequences = 0;
+                if (desc.Block != nullptr)
+                {
+                    while (desc.Block[desc.NumSequences].index != 255)
+                        desc.NumSequences++;
+                }
                 desc.Coordinates = _trackCoordinates[i];
                 desc.CurveChain = gTrackCurveChain[i];
                 desc.Flags = TrackFlags[i];
@@ -8032,19 +8038,13 @@ namespace OpenRCT2
 
 const PreviewTrack* TrackElementDescriptor::GetBlockForSequence(uint8_t sequenceIndex) const
 {
-    const auto* trackBlock = Block;
-    if (trackBlock == nullptr)
+    if (Block == nullptr)
         return nullptr;
 
     // The sequence index may be higher than the amount of sequences actually present.
-    // We don’t know the amount of sequences present in the block upfront, but there is an end marker consisting of all 255s.
-    for (auto i = 0; i < sequenceIndex; i++)
-    {
-        trackBlock++;
-
-        if (trackBlock == nullptr || trackBlock->index == 255)
-            return nullptr;
-    }
+    // The first sequence always maps to the first block, even for pieces that only hold the end marker.
+    if (sequenceIndex != 0 && sequenceIndex >= NumSequences)
+        return nullptr;
 
-    return trackBlock;
+    return Block + sequenceIndex;
 }
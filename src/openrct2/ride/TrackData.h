@@ -79,6 +79,8 @@ struct TrackElementDescriptor
     TrackCoordinates Coordinates;
 
     PreviewTrack* Block;
+    // Number of blocks before the end marker
+    uint8_t NumSequences;
     uint8_t PieceLength;
     TrackCurveChain CurveChain;
     track_type_t AlternativeType;
@@ -1253,29 +1253,12 @@ static GameActions::Result TrackDesignPlaceSceneryElement(
 
                 if (tds.PlaceOperation == PTD_OPERATION_PLACE)
                 {
-                    FootpathQueueChainReset();
+                    if (tds.PathsToConnect.empty())
+                    {
+                        FootpathQueueChainReset();
+                    }
                     FootpathRemoveEdgesAt(mapCoord, reinterpret_cast<TileElement*>(pathElement));
-                }
-
-                flags = GAME_COMMAND_FLAG_APPLY;
-                if (tds.PlaceOperation == PTD_OPERATION_PLACE_TRACK_PREVIEW)
-                {
-                    flags = GAME_COMMAND_FLAG_APPLY | GAME_COMMAND_FLAG_ALLOW_DURING_PAUSED | GAME_COMMAND_FLAG_NO_SPEND;
-                }
-                if (tds.PlaceOperation == PTD_OPERATION_PLACE_GHOST)
-                {
-                    flags = GAME_COMMAND_FLAG_APPLY | GAME_COMMAND_FLAG_ALLOW_DURING_PAUSED | GAME_COMMAND_FLAG_NO_SPEND
-                        | GAME_COMMAND_FLAG_GHOST;
-                }
-                if (tds.IsReplay)
-                {
-                    flags |= GAME_COMMAND_FLAG_REPLAY;
-                }
-
-                if (tds.PlaceOperation == PTD_OPERATION_PLACE)
-                {
-                    FootpathConnectEdges(mapCoord, reinterpret_cast<TileElement*>(pathElement), flags);
-                    FootpathUpdateQueueChains();
+                    tds.PathsToConnect.emplace_back(mapCoord.x, mapCoord.y, z);
                 }
 
                 return GameActions::Result();
@@ -1302,6 +1285,21 @@ static GameActions::Result TrackDesignPlaceAllScenery(
     const auto& origin = tds.Origin;
 
     money64 cost = 0;
+    tds.PathsToConnect.clear();
+
+    // The paths are connected once after all scenery has been placed, rather than one by one as they are found
+    auto connectPaths = [&tds]() {
+        if (tds.PathsToConnect.empty())
+            return;
+
+        int32_t flags = GAME_COMMAND_FLAG_APPLY;
+        if (tds.IsReplay)
+        {
+            flags |= GAME_COMMAND_FLAG_REPLAY;
+        }
+        FootpathConnectEdgesBatch(tds.PathsToConnect, flags);
+        tds.PathsToConnect.clear();
+    };
 
     for (uint8_t mode = 0; mode <= 1; mode++)
     {
@@ -1326,12 +1324,14 @@ static GameActions::Result TrackDesignPlaceAllScenery(
                 // Allow operation to fail when its removing ghosts.
                 if (tds.PlaceOperation != PTD_OPERATION_REMOVE_GHOST)
                 {
+                    connectPaths();
                     return placementRes;
                 }
             }
             cost += placementRes.Cost;
         }
     }
+    connectPaths();
 
     auto res = GameActions::Result();
     res.Cost = cost;
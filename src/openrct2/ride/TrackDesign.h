@@ -35,6 +35,8 @@ struct TrackDesignState
     bool HasScenery{};
     bool PlaceScenery{};
     bool IsReplay{};
+    // Paths placed by the design, connected to their neighbours together once all scenery is in place
+    std::vector<CoordsXYZ> PathsToConnect;
 };
 
 /* Track Entrance entry */
@@ -279,6 +279,14 @@ bool TrackPaintUtilHasFence(
     return (entranceLoc != station.Entrance && entranceLoc != station.Exit);
 }
 
+void TrackPaintUtilPaintSprite(PaintSession& session, uint8_t direction, int32_t height, const TrackPaintSprite& sprite)
+{
+    const CoordsXYZ heightOffset = { 0, 0, height };
+    PaintAddImageAsParentRotated(
+        session, direction, session.TrackColours.WithIndex(sprite.Images[direction]), sprite.Offset + heightOffset,
+        { sprite.BoundBox.offset + heightOffset, sprite.BoundBox.length });
+}
+
 void TrackPaintUtilPaintFloor(
     PaintSession& session, uint8_t edges, ImageId colourFlags, uint16_t height, const uint32_t floorSprites[4],
     const StationObject* stationStyle)
@@ -282,6 +282,18 @@ ImageId GetShopSupportColourScheme(PaintSession& session, const TrackElement& tr
 
 bool TrackPaintUtilHasFence(
     enum edge_t edge, const CoordsXY& position, const TrackElement& trackElement, const Ride& ride, uint8_t rotation);
+/**
+ * A track sprite described as data instead of a switch over the direction. The offset and bound box are those of
+ * direction 0, relative to the track height, and are rotated for the other directions.
+ */
+struct TrackPaintSprite
+{
+    std::array<ImageIndex, NumOrthogonalDirections> Images;
+    CoordsXYZ Offset;
+    BoundBoxXYZ BoundBox;
+};
+
+void TrackPaintUtilPaintSprite(PaintSession& session, uint8_t direction, int32_t height, const TrackPaintSprite& sprite);
 void TrackPaintUtilPaintFloor(
     PaintSession& session, uint8_t edges, ImageId colourFlags, uint16_t height, const uint32_t floorSprites[4],
     const StationObject* stationStyle);
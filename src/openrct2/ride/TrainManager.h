@@ -9,9 +9,10 @@
 #pragma once
 
 #include "../Identifiers.h"
+#include "../entity/EntityListCursor.h"
 
 #include <cstdint>
-#include <list>
+#include <vector>
 
 struct Vehicle;
 
@@ -21,19 +22,17 @@ namespace TrainManager
     class View
     {
     private:
-        const std::list<EntityId>* vec;
+        const std::vector<EntityId>* vec;
 
         class Iterator
         {
         private:
-            std::list<EntityId>::const_iterator iter;
-            std::list<EntityId>::const_iterator end;
+            EntityListCursor cursor;
             Vehicle* Entity = nullptr;
 
         public:
-            Iterator(std::list<EntityId>::const_iterator _iter, std::list<EntityId>::const_iterator _end)
-                : iter(_iter)
-                , end(_end)
+            Iterator(const std::vector<EntityId>& list, bool atEnd)
+                : cursor(list, atEnd)
             {
                 ++(*this);
             }
@@ -70,11 +69,11 @@ namespace TrainManager
 
         Iterator begin()
         {
-            return Iterator(std::cbegin(*vec), std::cend(*vec));
+            return Iterator(*vec, false);
         }
         Iterator end()
         {
-            return Iterator(std::cend(*vec), std::cend(*vec));
+            return Iterator(*vec, true);
         }
     };
 } // namespace TrainManager
@@ -28,6 +28,7 @@
 #include "../localisation/Localisation.h"
 #include "../management/NewsItem.h"
 #include "../math/Trigonometry.hpp"
+#include "../network/network.h"
 #include "../object/SmallSceneryEntry.h"
 #include "../platform/Platform.h"
 #include "../profiling/Profiling.h"
@@ -560,6 +561,52 @@ uint16_t Vehicle::GetTrackProgress() const
     return VehicleGetMoveInfoSize(TrackSubposition, GetTrackType(), GetTrackDirection());
 }
 
+struct VehicleMotionTable
+{
+    // Distance travelled from the first subposition of the piece to each subposition
+    std::vector<int64_t> Distance;
+    // Sum of the pitch accelerations of all subpositions before each subposition, with one extra entry for the end
+    std::vector<int64_t> Acceleration;
+};
+
+/**
+ * Returns the cumulative motion of a track piece, built from its subposition data the first time it is needed.
+ */
+static const VehicleMotionTable& GetVehicleMotionTable(
+    VehicleTrackSubposition trackSubposition, track_type_t type, uint8_t direction)
+{
+    static std::vector<VehicleMotionTable> tables(
+        EnumValue(VehicleTrackSubposition::Count) * VehicleTrackSubpositionSizeDefault);
+
+    uint16_t typeAndDirection = (type << 2) | (direction & 3);
+    auto& table = tables[EnumValue(trackSubposition) * VehicleTrackSubpositionSizeDefault + typeAndDirection];
+    if (table.Acceleration.empty())
+    {
+        const auto size = VehicleGetMoveInfoSize(trackSubposition, type, direction);
+        table.Distance.resize(size);
+        table.Acceleration.resize(size + 1);
+        for (uint16_t progress = 0; progress < size; progress++)
+        {
+            const auto* moveInfo = vehicle_get_move_info(trackSubposition, type, direction, progress);
+            if (progress > 0)
+            {
+                const auto* prevMoveInfo = vehicle_get_move_info(trackSubposition, type, direction, progress - 1);
+                uint8_t remainingDistanceFlags = 0;
+                if (moveInfo->x != prevMoveInfo->x)
+                    remainingDistanceFlags |= 1;
+                if (moveInfo->y != prevMoveInfo->y)
+                    remainingDistanceFlags |= 2;
+                if (moveInfo->z != prevMoveInfo->z)
+                    remainingDistanceFlags |= 4;
+                table.Distance[progress] = table.Distance[progress - 1]
+                    + SubpositionTranslationDistances[remainingDistanceFlags];
+            }
+            table.Acceleration[progress + 1] = table.Acceleration[progress] + AccelerationFromPitch[moveInfo->Pitch];
+        }
+    }
+    return table;
+}
+
 void Vehicle::ApplyMass(int16_t appliedMass)
 {
     mass = std::clamp<int32_t>(mass + appliedMass, 1, std::numeric_limits<decltype(mass)>::max());
@@ -599,6 +646,30 @@ void VehicleUpdateAll()
     if ((gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) && GetGameState().EditorStep != EditorStep::RollercoasterDesigner)
         return;
 
+    if (gConfigGeneral.GroupVehicleUpdatesByRide && NetworkGetMode() == NETWORK_MODE_NONE)
+    {
+        // Trains of the same ride share their ride, station and track data, so updating them one ride after
+        // another keeps that data in cache. Ids are collected first as an update may remove other vehicles.
+        static std::vector<std::pair<RideId, EntityId>> trains;
+        trains.clear();
+        for (auto vehicle : TrainManager::View())
+        {
+            trains.emplace_back(vehicle->ride, vehicle->Id);
+        }
+        std::stable_sort(trains.begin(), trains.end(), [](const auto& a, const auto& b) {
+            return a.first.ToUnderlying() < b.first.ToUnderlying();
+        });
+        for (const auto& train : trains)
+        {
+            auto* vehicle = GetEntity<Vehicle>(train.second);
+            if (vehicle != nullptr && vehicle->IsHead())
+            {
+                vehicle->Update();
+            }
+        }
+        return;
+    }
+
     for (auto vehicle : TrainManager::View())
     {
         vehicle->Update();
@@ -2850,10 +2921,7 @@ void Vehicle::UpdateCollisionSetup()
 
         ExplosionCloud::Create(trainLoc);
 
-        for (int32_t i = 0; i < 10; i++)
-        {
-            VehicleCrashParticle::Create(train->colours, trainLoc);
-        }
+        VehicleCrashParticle::Create(train->colours, trainLoc, 10);
 
         train->SetFlag(VehicleFlags::Crashed);
         train->animationState = ScenarioRand() & 0xFFFF;
@@ -4633,10 +4701,8 @@ void Vehicle::CrashOnLand()
     ExplosionCloud::Create(curLoc);
     ExplosionFlare::Create(curLoc);
 
-    uint8_t numParticles = std::min(SpriteData.Width, static_cast<uint8_t>(7));
-
-    while (numParticles-- != 0)
-        VehicleCrashParticle::Create(colours, curLoc);
+    const uint8_t numParticles = std::min(SpriteData.Width, static_cast<uint8_t>(7));
+    VehicleCrashParticle::Create(colours, curLoc, numParticles);
 
     SetFlag(VehicleFlags::Crashed);
     animation_frame = 0;
@@ -4704,8 +4770,7 @@ void Vehicle::CrashOnWater()
     CrashSplashParticle::Create(curLoc + CoordsXYZ{ 11, 8, 0 });
     CrashSplashParticle::Create(curLoc + CoordsXYZ{ -4, 8, 0 });
 
-    for (int32_t i = 0; i < 10; ++i)
-        VehicleCrashParticle::Create(colours, curLoc + CoordsXYZ{ -4, 8, 0 });
+    VehicleCrashParticle::Create(colours, curLoc + CoordsXYZ{ -4, 8, 0 }, 10);
 
     SetFlag(VehicleFlags::Crashed);
     animation_frame = 0;
@@ -7054,6 +7119,58 @@ bool Vehicle::UpdateTrackMotionForwardsGetNewTrack(uint16_t trackType, const Rid
     return true;
 }
 
+/**
+ * Whether a car can be moved over several subpositions of its current track piece at once. This only holds when
+ * nothing happens in between: the front car checks for collisions at every subposition and some pieces and cars
+ * have effects tied to particular subpositions.
+ */
+bool Vehicle::CanSkipTrackMotionSubpositions(const CarEntry& carEntry, const Ride& curRide, track_type_t trackType) const
+{
+    if (this == _vehicleFrontVehicle)
+        return false;
+    if (carEntry.flags & CAR_ENTRY_FLAG_WOODEN_WILD_MOUSE_SWING)
+        return false;
+    if (TrackSubposition == VehicleTrackSubposition::ReverserRCFrontBogie
+        || TrackSubposition == VehicleTrackSubposition::ReverserRCRearBogie)
+        return false;
+
+    switch (trackType)
+    {
+        case TrackElemType::HeartLineTransferUp:
+        case TrackElemType::HeartLineTransferDown:
+        case TrackElemType::PoweredLift:
+        case TrackElemType::BrakeForDrop:
+        case TrackElemType::LogFlumeReverser:
+        case TrackElemType::LeftReverser:
+        case TrackElemType::RightReverser:
+        case TrackElemType::Watersplash:
+            return false;
+        case TrackElemType::Flat:
+            if (curRide.type == RIDE_TYPE_REVERSE_FREEFALL_COASTER)
+                return false;
+            break;
+    }
+    if (TrackTypeIsBrakes(trackType) || TrackTypeIsBooster(trackType))
+        return false;
+
+    // The distance of the first step is measured from the current position rather than the previous subposition
+    const auto* moveInfo = GetMoveInfo();
+    const auto position = TrackLocation
+        + CoordsXYZ{ moveInfo->x, moveInfo->y, moveInfo->z + GetRideTypeDescriptor(curRide.type).Heights.VehicleZOffset };
+    return position == _vehicleCurPosition;
+}
+
+void Vehicle::SetTrackMotionSubposition(const Ride& curRide, uint16_t progress)
+{
+    track_progress = progress;
+    const auto* moveInfo = GetMoveInfo();
+    _vehicleCurPosition = TrackLocation
+        + CoordsXYZ{ moveInfo->x, moveInfo->y, moveInfo->z + GetRideTypeDescriptor(curRide.type).Heights.VehicleZOffset };
+    Orientation = moveInfo->direction;
+    bank_rotation = moveInfo->bank_rotation;
+    Pitch = moveInfo->Pitch;
+}
+
 /**
  *
  *  rct2: 0x006DAEB9
@@ -7154,6 +7271,38 @@ Loc6DAEB9:
         }
     }
 
+    constexpr auto kSubpositionEffectFlags = RIDE_ENTRY_FLAG_RIDER_CONTROLS_SPEED | RIDE_ENTRY_FLAG_PLAY_SPLASH_SOUND
+        | RIDE_ENTRY_FLAG_PLAY_SPLASH_SOUND_SLIDE;
+    if (!(rideEntry.flags & kSubpositionEffectFlags) && CanSkipTrackMotionSubpositions(*carEntry, curRide, trackType))
+    {
+        // Move straight to the subposition where the car comes to rest, or to the end of the piece
+        const auto& table = GetVehicleMotionTable(TrackSubposition, trackType, GetTrackDirection());
+        const auto lastProgress = static_cast<int32_t>(table.Distance.size()) - 1;
+        const auto startProgress = static_cast<int32_t>(track_progress);
+        if (startProgress < lastProgress)
+        {
+            const auto startDistance = table.Distance[startProgress];
+            const auto it = std::upper_bound(
+                table.Distance.begin() + startProgress + 1, table.Distance.end(),
+                startDistance + remaining_distance - 0x368A);
+            const bool comesToRest = it != table.Distance.end();
+            const auto progress = comesToRest ? static_cast<int32_t>(it - table.Distance.begin()) : lastProgress;
+
+            // Pitch acceleration is applied for every subposition passed without coming to rest
+            const auto lastAccelerated = comesToRest ? progress - 1 : progress;
+            remaining_distance -= static_cast<int32_t>(table.Distance[progress] - startDistance);
+            acceleration += static_cast<int32_t>(
+                table.Acceleration[lastAccelerated + 1] - table.Acceleration[startProgress + 1]);
+            _vehicleUnkF64E10 += lastAccelerated - startProgress;
+            SetTrackMotionSubposition(curRide, progress);
+            if (comesToRest)
+            {
+                return true;
+            }
+            goto Loc6DAEB9;
+        }
+    }
+
     uint16_t newTrackProgress = track_progress + 1;
 
     // Track Total Progress is in the two bytes before the move info list
@@ -7492,6 +7641,30 @@ bool Vehicle::UpdateTrackMotionBackwards(const CarEntry* carEntry, const Ride& c
             }
         }
 
+        if (track_progress > 0 && CanSkipTrackMotionSubpositions(*carEntry, curRide, trackType))
+        {
+            // Move straight to the subposition where the car comes to rest, or to the start of the piece
+            const auto& table = GetVehicleMotionTable(TrackSubposition, trackType, GetTrackDirection());
+            const auto startProgress = static_cast<int32_t>(track_progress);
+            const auto startDistance = table.Distance[startProgress];
+            const auto it = std::upper_bound(
+                table.Distance.begin(), table.Distance.begin() + startProgress, startDistance + remaining_distance);
+            const bool comesToRest = it != table.Distance.begin();
+            const auto progress = comesToRest ? static_cast<int32_t>(it - table.Distance.begin()) - 1 : 0;
+
+            // Pitch acceleration is applied for every subposition passed without coming to rest
+            const auto firstAccelerated = comesToRest ? progress + 1 : progress;
+            remaining_distance += static_cast<int32_t>(startDistance - table.Distance[progress]);
+            acceleration += static_cast<int32_t>(table.Acceleration[startProgress] - table.Acceleration[firstAccelerated]);
+            _vehicleUnkF64E10 += startProgress - firstAccelerated;
+            SetTrackMotionSubposition(curRide, progress);
+            if (comesToRest)
+            {
+                return true;
+            }
+            continue;
+        }
+
         uint16_t newTrackProgress = track_progress - 1;
         if (newTrackProgress == 0xFFFF)
         {
@@ -334,6 +334,8 @@ private:
     bool CurrentTowerElementIsTop();
     bool UpdateTrackMotionForwards(const CarEntry* carEntry, const Ride& curRide, const RideObjectEntry& rideEntry);
     bool UpdateTrackMotionBackwards(const CarEntry* carEntry, const Ride& curRide, const RideObjectEntry& rideEntry);
+    bool CanSkipTrackMotionSubpositions(const CarEntry& carEntry, const Ride& curRide, track_type_t trackType) const;
+    void SetTrackMotionSubposition(const Ride& curRide, uint16_t progress);
     int32_t UpdateTrackMotionPoweredRideAcceleration(
         const CarEntry* carEntry, uint32_t totalMass, const int32_t curAcceleration);
     int32_t NumPeepsUntilTrainTail() const;
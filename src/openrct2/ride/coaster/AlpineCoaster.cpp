@@ -30,61 +30,26 @@ namespace AlpineRC
         PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
         const TrackElement& trackElement)
     {
-        if (trackElement.HasChain())
-        {
-            switch (direction)
+        static constexpr TrackPaintSprite kFlatSprites[] = {
             {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_LIFT_TRACK_FLAT + 0)),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_LIFT_TRACK_FLAT + 1)),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_LIFT_TRACK_FLAT + 2)),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_LIFT_TRACK_FLAT + 3)),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
-            if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
+                { SPR_G2_ALPINE_TRACK_FLAT + 0, SPR_G2_ALPINE_TRACK_FLAT + 1,
+                  SPR_G2_ALPINE_TRACK_FLAT + 0, SPR_G2_ALPINE_TRACK_FLAT + 1 },
+                { 0, 0, 0 },
+                { { 0, 6, 0 }, { 32, 20, 3 } },
+            },
             {
-                MetalASupportsPaintSetup(
-                    session, direction & 1 ? MetalSupportType::ForkAlt : MetalSupportType::Fork, MetalSupportPlace::Centre, 0,
-                    height, session.SupportColours);
-            }
-        }
-        else
+                { SPR_G2_ALPINE_LIFT_TRACK_FLAT + 0, SPR_G2_ALPINE_LIFT_TRACK_FLAT + 1,
+                  SPR_G2_ALPINE_LIFT_TRACK_FLAT + 2, SPR_G2_ALPINE_LIFT_TRACK_FLAT + 3 },
+                { 0, 0, 0 },
+                { { 0, 6, 0 }, { 32, 20, 3 } },
+            },
+        };
+        TrackPaintUtilPaintSprite(session, direction, height, kFlatSprites[trackElement.HasChain() ? 1 : 0]);
+        if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
-            switch (direction)
-            {
-                case 0:
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_TRACK_FLAT + 0)), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_TRACK_FLAT + 1)), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
-            if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
-            {
-                MetalASupportsPaintSetup(
-                    session, direction & 1 ? MetalSupportType::ForkAlt : MetalSupportType::Fork, MetalSupportPlace::Centre, 0,
-                    height, session.SupportColours);
-            }
+            MetalASupportsPaintSetup(
+                session, direction & 1 ? MetalSupportType::ForkAlt : MetalSupportType::Fork, MetalSupportPlace::Centre, 0,
+                height, session.SupportColours);
         }
         PaintUtilPushTunnelRotated(session, direction, height, TUNNEL_0);
         PaintUtilSetSegmentSupportHeight(
@@ -132,69 +97,26 @@ namespace AlpineRC
         PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
         const TrackElement& trackElement)
     {
-        if (trackElement.HasChain())
-        {
-            switch (direction)
+        static constexpr TrackPaintSprite k25DegUpSprites[] = {
             {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 8)),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 9)),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 10)),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 11)),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
-            if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
+                { SPR_G2_ALPINE_TRACK_GENTLE + 8, SPR_G2_ALPINE_TRACK_GENTLE + 9,
+                  SPR_G2_ALPINE_TRACK_GENTLE + 10, SPR_G2_ALPINE_TRACK_GENTLE + 11 },
+                { 0, 0, 0 },
+                { { 0, 6, 0 }, { 32, 20, 3 } },
+            },
             {
-                MetalASupportsPaintSetup(
-                    session, direction & 1 ? MetalSupportType::ForkAlt : MetalSupportType::Fork, MetalSupportPlace::Centre, 8,
-                    height, session.SupportColours);
-            }
-        }
-        else
+                { SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 8, SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 9,
+                  SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 10, SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 11 },
+                { 0, 0, 0 },
+                { { 0, 6, 0 }, { 32, 20, 3 } },
+            },
+        };
+        TrackPaintUtilPaintSprite(session, direction, height, k25DegUpSprites[trackElement.HasChain() ? 1 : 0]);
+        if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_TRACK_GENTLE + 8)), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_TRACK_GENTLE + 9)), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_TRACK_GENTLE + 10)), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_TRACK_GENTLE + 11)), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
-            if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
-            {
-                MetalASupportsPaintSetup(
-                    session, direction & 1 ? MetalSupportType::ForkAlt : MetalSupportType::Fork, MetalSupportPlace::Centre, 8,
-                    height, session.SupportColours);
-            }
+            MetalASupportsPaintSetup(
+                session, direction & 1 ? MetalSupportType::ForkAlt : MetalSupportType::Fork, MetalSupportPlace::Centre, 8,
+                height, session.SupportColours);
         }
         if (direction == 0 || direction == 3)
         {
@@ -216,69 +138,26 @@ namespace AlpineRC
         PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
         const TrackElement& trackElement)
     {
-        if (trackElement.HasChain())
-        {
-            switch (direction)
+        static constexpr TrackPaintSprite kFlatTo25DegUpSprites[] = {
             {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 0)),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 1)),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 2)),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 3)),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
-            if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
+                { SPR_G2_ALPINE_TRACK_GENTLE + 0, SPR_G2_ALPINE_TRACK_GENTLE + 1,
+                  SPR_G2_ALPINE_TRACK_GENTLE + 2, SPR_G2_ALPINE_TRACK_GENTLE + 3 },
+                { 0, 0, 0 },
+                { { 0, 6, 0 }, { 32, 20, 3 } },
+            },
             {
-                MetalASupportsPaintSetup(
-                    session, direction & 1 ? MetalSupportType::ForkAlt : MetalSupportType::Fork, MetalSupportPlace::Centre, 3,
-                    height, session.SupportColours);
-            }
-        }
-        else
+                { SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 0, SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 1,
+                  SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 2, SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 3 },
+                { 0, 0, 0 },
+                { { 0, 6, 0 }, { 32, 20, 3 } },
+            },
+        };
+        TrackPaintUtilPaintSprite(session, direction, height, kFlatTo25DegUpSprites[trackElement.HasChain() ? 1 : 0]);
+        if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_TRACK_GENTLE + 0)), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_TRACK_GENTLE + 1)), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_TRACK_GENTLE + 2)), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_TRACK_GENTLE + 3)), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
-            if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
-            {
-                MetalASupportsPaintSetup(
-                    session, direction & 1 ? MetalSupportType::ForkAlt : MetalSupportType::Fork, MetalSupportPlace::Centre, 3,
-                    height, session.SupportColours);
-            }
+            MetalASupportsPaintSetup(
+                session, direction & 1 ? MetalSupportType::ForkAlt : MetalSupportType::Fork, MetalSupportPlace::Centre, 3,
+                height, session.SupportColours);
         }
         if (direction == 0 || direction == 3)
         {
@@ -300,69 +179,26 @@ namespace AlpineRC
         PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
         const TrackElement& trackElement)
     {
-        if (trackElement.HasChain())
-        {
-            switch (direction)
+        static constexpr TrackPaintSprite k25DegUpToFlatSprites[] = {
             {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 4)),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 5)),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 6)),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 7)),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
-            if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
+                { SPR_G2_ALPINE_TRACK_GENTLE + 4, SPR_G2_ALPINE_TRACK_GENTLE + 5,
+                  SPR_G2_ALPINE_TRACK_GENTLE + 6, SPR_G2_ALPINE_TRACK_GENTLE + 7 },
+                { 0, 0, 0 },
+                { { 0, 6, 0 }, { 32, 20, 3 } },
+            },
             {
-                MetalASupportsPaintSetup(
-                    session, direction & 1 ? MetalSupportType::ForkAlt : MetalSupportType::Fork, MetalSupportPlace::Centre, 6,
-                    height, session.SupportColours);
-            }
-        }
-        else
+                { SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 4, SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 5,
+                  SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 6, SPR_G2_ALPINE_LIFT_TRACK_GENTLE + 7 },
+                { 0, 0, 0 },
+                { { 0, 6, 0 }, { 32, 20, 3 } },
+            },
+        };
+        TrackPaintUtilPaintSprite(session, direction, height, k25DegUpToFlatSprites[trackElement.HasChain() ? 1 : 0]);
+        if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_TRACK_GENTLE + 4)), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_TRACK_GENTLE + 5)), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_TRACK_GENTLE + 6)), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex((SPR_G2_ALPINE_TRACK_GENTLE + 7)), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
-            if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
-            {
-                MetalASupportsPaintSetup(
-                    session, direction & 1 ? MetalSupportType::ForkAlt : MetalSupportType::Fork, MetalSupportPlace::Centre, 6,
-                    height, session.SupportColours);
-            }
+            MetalASupportsPaintSetup(
+                session, direction & 1 ? MetalSupportType::ForkAlt : MetalSupportType::Fork, MetalSupportPlace::Centre, 6,
+                height, session.SupportColours);
         }
         if (direction == 0 || direction == 3)
         {
@@ -25,6 +25,7 @@
 #include "../localisation/Language.h"
 #include "../localisation/Localisation.h"
 #include "../localisation/LocalisationService.h"
+#include "../park/ParkFile.h"
 #include "../platform/Platform.h"
 #include "../rct12/RCT12.h"
 #include "../rct12/SawyerChunkReader.h"
@@ -33,8 +34,10 @@
 #include "ScenarioSources.h"
 
 #include <algorithm>
+#include <cctype>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 using namespace OpenRCT2;
@@ -208,24 +211,14 @@ private:
             std::string extension = Path::GetExtension(path);
             if (String::IEquals(extension, ".park"))
             {
-                // OpenRCT2 park
-                bool result = false;
-                try
+                // OpenRCT2 park, only the scenario chunk is needed for the index
+                if (ParkFileGetScenarioDetails(path, *entry))
                 {
-                    auto& objRepository = OpenRCT2::GetContext()->GetObjectRepository();
-                    auto importer = ParkImporter::CreateParkFile(objRepository);
-                    importer->LoadScenario(path, true);
-                    if (importer->GetDetails(entry))
-                    {
-                        entry->Path = path;
-                        entry->Timestamp = timestamp;
-                        result = true;
-                    }
+                    entry->Path = path;
+                    entry->Timestamp = timestamp;
+                    return true;
                 }
-                catch (const std::exception&)
-                {
-                }
-                return result;
+                return false;
             }
 
             if (String::IEquals(extension, ".sc4"))
@@ -344,6 +337,8 @@ private:
     std::shared_ptr<IPlatformEnvironment> const _env;
     ScenarioFileIndex const _fileIndex;
     std::vector<ScenarioIndexEntry> _scenarios;
+    // Index into _scenarios by file name, see GetFilenameKey
+    std::unordered_map<std::string, size_t> _scenarioIndexByFilename;
     std::vector<ScenarioHighscoreEntry*> _highscores;
 
 public:
@@ -364,6 +359,7 @@ public:
 
         // Reload scenarios from index
         _scenarios.clear();
+        _scenarioIndexByFilename.clear();
         auto scenarios = _fileIndex.LoadOrBuild(language);
         for (const auto& scenario : scenarios)
         {
@@ -394,15 +390,11 @@ public:
 
     const ScenarioIndexEntry* GetByFilename(u8string_view filename) const override
     {
-        for (const auto& scenario : _scenarios)
+        // Note: this is always case insensitive search for cross platform consistency
+        auto it = _scenarioIndexByFilename.find(GetFilenameKey(filename));
+        if (it != _scenarioIndexByFilename.end())
         {
-            const auto scenarioFilename = Path::GetFileName(scenario.Path);
-
-            // Note: this is always case insensitive search for cross platform consistency
-            if (String::IEquals(filename, scenarioFilename))
-            {
-                return &scenario;
-            }
+            return &_scenarios[it->second];
         }
         return nullptr;
     }
@@ -501,17 +493,34 @@ public:
 private:
     ScenarioIndexEntry* GetByFilename(u8string_view filename)
     {
-        for (auto& scenario : _scenarios)
-        {
-            const auto scenarioFilename = Path::GetFileName(scenario.Path);
+        const ScenarioRepository* repo = this;
+        return const_cast<ScenarioIndexEntry*>(repo->GetByFilename(filename));
+    }
 
-            // Note: this is always case insensitive search for cross platform consistency
-            if (String::IEquals(filename, scenarioFilename))
+    /**
+     * File names are compared ignoring the case of ASCII characters, the same as String::IEquals.
+     */
+    static std::string GetFilenameKey(u8string_view filename)
+    {
+        std::string key(filename);
+        for (auto& ch : key)
+        {
+            if ((static_cast<unsigned char>(ch) & 0x80) == 0)
             {
-                return &scenario;
+                ch = static_cast<char>(tolower(static_cast<unsigned char>(ch)));
             }
         }
-        return nullptr;
+        return key;
+    }
+
+    void IndexScenarioFilenames()
+    {
+        _scenarioIndexByFilename.clear();
+        _scenarioIndexByFilename.reserve(_scenarios.size());
+        for (size_t i = 0; i < _scenarios.size(); i++)
+        {
+            _scenarioIndexByFilename.emplace(GetFilenameKey(Path::GetFileName(_scenarios[i].Path)), i);
+        }
     }
 
     ScenarioIndexEntry* GetByPath(const utf8* path)
@@ -586,6 +595,7 @@ private:
             }
             else
             {
+                _scenarioIndexByFilename.emplace(GetFilenameKey(filename), _scenarios.size());
                 _scenarios.push_back(entry);
             }
         }
@@ -611,6 +621,7 @@ private:
                     return ScenarioIndexEntryCompareByCategory(a, b) < 0;
                 });
         }
+        IndexScenarioFilenames();
     }
 
     void LoadScores()
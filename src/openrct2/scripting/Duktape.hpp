@@ -73,6 +73,14 @@ namespace OpenRCT2::Scripting
         {
         }
 
+        // Sets the properties on an existing object instead of creating a new one.
+        explicit DukObject(const DukValue& existing)
+            : _ctx(existing.context())
+        {
+            existing.push();
+            _idx = duk_normalize_index(_ctx, -1);
+        }
+
         DukObject(const DukObject&) = delete;
 
         DukObject(DukObject&& m) noexcept
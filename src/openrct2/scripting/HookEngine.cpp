@@ -42,6 +42,21 @@ HOOK_TYPE OpenRCT2::Scripting::GetHookType(const std::string& name)
     return (result != HooksLookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
 }
 
+bool OpenRCT2::Scripting::IsBatchableHook(HOOK_TYPE type)
+{
+    switch (type)
+    {
+        case HOOK_TYPE::ACTION_EXECUTE:
+        case HOOK_TYPE::GUEST_GENERATION:
+        case HOOK_TYPE::VEHICLE_CRASH:
+        case HOOK_TYPE::NETWORK_JOIN:
+        case HOOK_TYPE::NETWORK_LEAVE:
+            return true;
+        default:
+            return false;
+    }
+}
+
 HookEngine::HookEngine(ScriptEngine& scriptEngine)
     : _scriptEngine(scriptEngine)
 {
@@ -52,11 +67,12 @@ HookEngine::HookEngine(ScriptEngine& scriptEngine)
     }
 }
 
-uint32_t HookEngine::Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function)
+uint32_t HookEngine::Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function, bool batched)
 {
     auto& hookList = GetHookList(type);
     auto cookie = _nextCookie++;
-    hookList.Hooks.emplace_back(cookie, owner, function);
+    hookList.Hooks.emplace_back(cookie, owner, function, batched);
+    UpdateSubscribedHooks(hookList);
     return cookie;
 }
 
@@ -72,6 +88,7 @@ void HookEngine::Unsubscribe(HOOK_TYPE type, uint32_t cookie)
             break;
         }
     }
+    UpdateSubscribedHooks(hookList);
 }
 
 void HookEngine::UnsubscribeAll(std::shared_ptr<const Plugin> owner)
@@ -81,6 +98,7 @@ void HookEngine::UnsubscribeAll(std::shared_ptr<const Plugin> owner)
         auto& hooks = hookList.Hooks;
         auto isOwner = [&](auto& obj) { return obj.Owner == owner; };
         hooks.erase(std::remove_if(hooks.begin(), hooks.end(), isOwner), hooks.end());
+        UpdateSubscribedHooks(hookList);
     }
 }
 
@@ -90,13 +108,25 @@ void HookEngine::UnsubscribeAll()
     {
         auto& hooks = hookList.Hooks;
         hooks.clear();
+        UpdateSubscribedHooks(hookList);
+        hookList.ReusableArgs = {};
     }
 }
 
-bool HookEngine::HasSubscriptions(HOOK_TYPE type) const
+void HookEngine::UpdateSubscribedHooks(HookList& hookList)
 {
-    auto& hookList = GetHookList(type);
-    return !hookList.Hooks.empty();
+    hookList.NumBatchedHooks = std::count_if(
+        hookList.Hooks.begin(), hookList.Hooks.end(), [](const Hook& hook) { return hook.Batched; });
+    if (hookList.NumBatchedHooks == 0)
+    {
+        hookList.PendingBatch.clear();
+    }
+
+    const auto bit = 1u << static_cast<uint32_t>(hookList.Type);
+    if (hookList.Hooks.empty())
+        _subscribedHooks &= ~bit;
+    else
+        _subscribedHooks |= bit;
 }
 
 bool HookEngine::IsValidHookForPlugin(HOOK_TYPE type, Plugin& plugin) const
@@ -110,6 +140,9 @@ bool HookEngine::IsValidHookForPlugin(HOOK_TYPE type, Plugin& plugin) const
 
 void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
 {
+    if (!HasSubscriptions(type))
+        return;
+
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
@@ -119,45 +152,107 @@ void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
 
 void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable)
 {
-    auto& hookList = GetHookList(type);
+    if (!HasSubscriptions(type))
+        return;
+
+    CallHooks(GetHookList(type), arg, isGameStateMutable);
+}
+
+void HookEngine::Call(
+    HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable)
+{
+    if (!HasSubscriptions(type))
+        return;
+
+    auto ctx = _scriptEngine.GetContext();
+
+    // Convert key/value pairs into an object, shared by all subscriptions
+    auto objIdx = duk_push_object(ctx);
+    for (const auto& arg : args)
+    {
+        if (arg.second.type() == typeid(int32_t))
+        {
+            auto val = std::any_cast<int32_t>(arg.second);
+            duk_push_int(ctx, val);
+        }
+        else if (arg.second.type() == typeid(std::string))
+        {
+            const auto& val = std::any_cast<std::string>(arg.second);
+            duk_push_string(ctx, val.c_str());
+        }
+        else
+        {
+            throw std::runtime_error("Not implemented");
+        }
+        duk_put_prop_string(ctx, objIdx, arg.first.data());
+    }
+
+    CallHooks(GetHookList(type), DukValue::take_from_stack(ctx), isGameStateMutable);
+}
+
+void HookEngine::CallHooks(HookList& hookList, const DukValue& arg, bool isGameStateMutable)
+{
+    if (hookList.NumBatchedHooks != 0)
+    {
+        if (hookList.PendingBatch.empty())
+        {
+            hookList.PendingBatchGameStateMutable = isGameStateMutable;
+        }
+        hookList.PendingBatch.push_back(arg);
+        if (hookList.NumBatchedHooks == hookList.Hooks.size())
+            return;
+    }
+
+    const std::vector<DukValue> dukArgs = { arg };
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable);
+        if (!hook.Batched)
+        {
+            _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable);
+        }
     }
 }
 
-void HookEngine::Call(
-    HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable)
+const DukValue& HookEngine::GetReusableArgs(HOOK_TYPE type)
 {
     auto& hookList = GetHookList(type);
-    for (auto& hook : hookList.Hooks)
+    if (hookList.ReusableArgs.type() != DukValue::Type::OBJECT)
+    {
+        auto ctx = _scriptEngine.GetContext();
+        duk_push_object(ctx);
+        hookList.ReusableArgs = DukValue::take_from_stack(ctx);
+    }
+    return hookList.ReusableArgs;
+}
+
+void HookEngine::DispatchBatches()
+{
+    for (auto& hookList : _hookMap)
     {
+        if (hookList.PendingBatch.empty())
+            continue;
+
+        // Take the events first, the callbacks can cause new events for the next batch
+        auto events = std::move(hookList.PendingBatch);
+        hookList.PendingBatch.clear();
+
         auto ctx = _scriptEngine.GetContext();
+        duk_push_array(ctx);
+        for (size_t i = 0; i < events.size(); i++)
+        {
+            events[i].push();
+            duk_put_prop_index(ctx, -2, static_cast<duk_uarridx_t>(i));
+        }
+        const std::vector<DukValue> dukArgs = { DukValue::take_from_stack(ctx) };
 
-        // Convert key/value pairs into an object
-        auto objIdx = duk_push_object(ctx);
-        for (const auto& arg : args)
+        for (auto& hook : hookList.Hooks)
         {
-            if (arg.second.type() == typeid(int32_t))
-            {
-                auto val = std::any_cast<int32_t>(arg.second);
-                duk_push_int(ctx, val);
-            }
-            else if (arg.second.type() == typeid(std::string))
+            if (hook.Batched)
             {
-                const auto& val = std::any_cast<std::string>(arg.second);
-                duk_push_string(ctx, val.c_str());
+                _scriptEngine.ExecutePluginCall(
+                    hook.Owner, hook.Function, dukArgs, hookList.PendingBatchGameStateMutable);
             }
-            else
-            {
-                throw std::runtime_error("Not implemented");
-            }
-            duk_put_prop_string(ctx, objIdx, arg.first.data());
         }
-
-        std::vector<DukValue> dukArgs;
-        dukArgs.push_back(DukValue::take_from_stack(ctx));
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable);
     }
 }
 
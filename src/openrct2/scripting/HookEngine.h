@@ -49,17 +49,23 @@ namespace OpenRCT2::Scripting
     constexpr size_t NUM_HOOK_TYPES = static_cast<size_t>(HOOK_TYPE::COUNT);
     HOOK_TYPE GetHookType(const std::string& name);
 
+    // Whether the callbacks of the hook only observe, so they can receive the events of a tick in one call.
+    bool IsBatchableHook(HOOK_TYPE type);
+
     struct Hook
     {
         uint32_t Cookie;
         std::shared_ptr<Plugin> Owner;
         DukValue Function;
+        // Receives an array of the events of the tick once the tick has finished, instead of each event.
+        bool Batched{};
 
         Hook() = default;
-        Hook(uint32_t cookie, std::shared_ptr<Plugin> owner, const DukValue& function)
+        Hook(uint32_t cookie, std::shared_ptr<Plugin> owner, const DukValue& function, bool batched = false)
             : Cookie(cookie)
             , Owner(owner)
             , Function(function)
+            , Batched(batched)
         {
         }
     };
@@ -68,6 +74,11 @@ namespace OpenRCT2::Scripting
     {
         HOOK_TYPE Type{};
         std::vector<Hook> Hooks;
+        size_t NumBatchedHooks{};
+        std::vector<DukValue> PendingBatch;
+        bool PendingBatchGameStateMutable{};
+        // Argument object reused by every call of the hook, see HookEngine::GetReusableArgs.
+        DukValue ReusableArgs;
 
         HookList() = default;
         HookList(const HookList&) = delete;
@@ -79,25 +90,47 @@ namespace OpenRCT2::Scripting
     private:
         ScriptEngine& _scriptEngine;
         std::vector<HookList> _hookMap;
+        // One bit per hook type with at least one subscription, so the check is cheap enough for hot paths.
+        uint32_t _subscribedHooks{};
         uint32_t _nextCookie = 1;
 
+        static_assert(NUM_HOOK_TYPES <= 32);
+
     public:
         HookEngine(ScriptEngine& scriptEngine);
         HookEngine(const HookEngine&) = delete;
-        uint32_t Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function);
+        uint32_t Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, const DukValue& function, bool batched = false);
         void Unsubscribe(HOOK_TYPE type, uint32_t cookie);
         void UnsubscribeAll(std::shared_ptr<const Plugin> owner);
         void UnsubscribeAll();
-        bool HasSubscriptions(HOOK_TYPE type) const;
+        bool HasSubscriptions(HOOK_TYPE type) const
+        {
+            return (_subscribedHooks & (1u << static_cast<uint32_t>(type))) != 0;
+        }
         bool IsValidHookForPlugin(HOOK_TYPE type, Plugin& plugin) const;
         void Call(HOOK_TYPE type, bool isGameStateMutable);
         void Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable);
         void Call(
             HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable);
 
+        /**
+         * Returns an argument object that is created once per hook type and passed to every call of it. The caller
+         * overwrites every property before each call, so it must only be used for hooks whose event objects are
+         * documented as being valid during the callback only.
+         */
+        const DukValue& GetReusableArgs(HOOK_TYPE type);
+
+        /**
+         * Calls the batched subscriptions with the events collected since the last dispatch, called once at the
+         * end of every game tick.
+         */
+        void DispatchBatches();
+
     private:
         HookList& GetHookList(HOOK_TYPE type);
         const HookList& GetHookList(HOOK_TYPE type) const;
+        void UpdateSubscribedHooks(HookList& hookList);
+        void CallHooks(HookList& hookList, const DukValue& arg, bool isGameStateMutable);
     };
 } // namespace OpenRCT2::Scripting
 
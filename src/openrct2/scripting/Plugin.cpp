@@ -11,18 +11,41 @@
 
 #    include "Plugin.h"
 
+#    include "../Context.h"
 #    include "../Diagnostic.h"
 #    include "../OpenRCT2.h"
+#    include "../PlatformEnvironment.h"
+#    include "../Version.h"
+#    include "../core/Crypt.h"
 #    include "../core/File.h"
+#    include "../core/FileStream.h"
+#    include "../core/Path.hpp"
+#    include "../core/String.hpp"
 #    include "Duktape.hpp"
 #    include "ScriptEngine.h"
 
 #    include <algorithm>
+#    include <cstring>
 #    include <fstream>
 #    include <memory>
+#    include <random>
 
+using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
 
+constexpr uint32_t kBytecodeCacheMagic = 0x43534A4F; // OJSC
+constexpr uint32_t kBytecodeCacheVersion = 1;
+
+struct BytecodeCacheHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t DuktapeVersion;
+    uint32_t KeyLength;
+    uint64_t DataSize;
+};
+assert_struct_size(BytecodeCacheHeader, 24);
+
 Plugin::Plugin(duk_context* context, std::string_view path)
     : _context(context)
     , _path(path)
@@ -63,9 +86,25 @@ void Plugin::Load()
         "     })(" + projectedVariables + ");";
     // clang-format on
 
-    auto flags = DUK_COMPILE_EVAL | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
-    auto result = duk_eval_raw(_context, code.c_str(), code.size(), flags);
-    if (result != DUK_ERR_NONE)
+    // Compiling large plug-ins is slow, so the bytecode is cached until the code or the game changes.
+    // Network plug-ins have no path and are always compiled.
+    auto cacheKey = std::string(gVersionInfoFull) + '\n' + code;
+    if (_path.empty() || !ReadBytecodeCache(cacheKey))
+    {
+        auto flags = DUK_COMPILE_EVAL | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
+        if (duk_compile_raw(_context, code.c_str(), code.size(), flags) != DUK_EXEC_SUCCESS)
+        {
+            auto val = std::string(duk_safe_to_string(_context, -1));
+            duk_pop(_context);
+            throw std::runtime_error("Failed to load plug-in script: " + val);
+        }
+        if (!_path.empty())
+        {
+            WriteBytecodeCache(cacheKey);
+        }
+    }
+
+    if (duk_pcall(_context, 0) != DUK_EXEC_SUCCESS)
     {
         auto val = std::string(duk_safe_to_string(_context, -1));
         duk_pop(_context);
@@ -140,6 +179,101 @@ void Plugin::LoadCodeFromFile()
     _code = File::ReadAllText(_path);
 }
 
+std::string Plugin::GetBytecodeCachePath(std::string_view pluginPath)
+{
+    // One entry per plug-in file so editing a plug-in replaces its entry
+    auto hash = Crypt::FNV1a(pluginPath.data(), pluginPath.size());
+    std::string fileName;
+    for (auto b : hash)
+    {
+        fileName += String::StdFormat("%02x", b);
+    }
+    auto env = GetContext()->GetPlatformEnvironment();
+    auto directory = Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE), u8"plugin");
+    return Path::Combine(directory, fileName + u8".jsc");
+}
+
+bool Plugin::ReadBytecodeCache(std::string_view key)
+{
+    auto path = GetBytecodeCachePath(_path);
+    if (!File::Exists(path))
+    {
+        return false;
+    }
+
+    try
+    {
+        auto data = File::ReadAllBytes(path);
+        if (data.size() < sizeof(BytecodeCacheHeader))
+        {
+            return false;
+        }
+
+        BytecodeCacheHeader header;
+        std::memcpy(&header, data.data(), sizeof(header));
+        const uint64_t dataStart = sizeof(BytecodeCacheHeader) + header.KeyLength;
+        if (header.Magic != kBytecodeCacheMagic || header.Version != kBytecodeCacheVersion
+            || header.DuktapeVersion != DUK_VERSION || header.KeyLength != key.size() || header.DataSize == 0
+            || dataStart + header.DataSize != data.size()
+            || std::memcmp(data.data() + sizeof(BytecodeCacheHeader), key.data(), key.size()) != 0)
+        {
+            // Bytecode is not validated when loaded, so anything that does not match exactly is recompiled
+            return false;
+        }
+
+        auto buffer = duk_push_fixed_buffer(_context, static_cast<duk_size_t>(header.DataSize));
+        std::memcpy(buffer, data.data() + dataStart, static_cast<size_t>(header.DataSize));
+        duk_load_function(_context);
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to read plug-in bytecode cache '%s': %s", path.c_str(), e.what());
+        return false;
+    }
+}
+
+void Plugin::WriteBytecodeCache(std::string_view key)
+{
+    auto path = GetBytecodeCachePath(_path);
+
+    // Dump a copy, the compiled function is left on the stack to be called
+    duk_dup_top(_context);
+    duk_dump_function(_context);
+    duk_size_t dataSize{};
+    auto data = duk_get_buffer(_context, -1, &dataSize);
+
+    // Other processes may be writing the same entry, write to a unique file and move it into place
+    auto tempPath = path + String::StdFormat(".%08x", std::random_device{}());
+    try
+    {
+        Path::CreateDirectory(Path::GetDirectory(path));
+        {
+            auto fs = FileStream(tempPath, FILE_MODE_WRITE);
+
+            BytecodeCacheHeader header{};
+            header.Magic = kBytecodeCacheMagic;
+            header.Version = kBytecodeCacheVersion;
+            header.DuktapeVersion = DUK_VERSION;
+            header.KeyLength = static_cast<uint32_t>(key.size());
+            header.DataSize = dataSize;
+            fs.WriteValue(header);
+            fs.Write(key.data(), key.size());
+            fs.Write(data, dataSize);
+        }
+        if (!File::Move(tempPath, path))
+        {
+            File::Delete(tempPath);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to write plug-in bytecode cache '%s': %s", path.c_str(), e.what());
+        File::Delete(tempPath);
+    }
+    duk_pop(_context);
+}
+
 static std::string TryGetString(const DukValue& value, const std::string& message)
 {
     if (value.type() != DukValue::Type::STRING)
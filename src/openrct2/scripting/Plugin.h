@@ -52,6 +52,23 @@ namespace OpenRCT2::Scripting
         DukValue Main;
     };
 
+    /**
+     * CPU time spent in a plugin's callbacks, excluding time spent in callbacks of other plugins
+     * that it triggered. A tick is the window between two updates of the script engine.
+     */
+    struct PluginTimeStats
+    {
+        uint64_t Calls{};
+        uint64_t SkippedCalls{};
+        double TotalMs{};
+        double CurrentTickMs{};
+        double LastTickMs{};
+        double PeakTickMs{};
+        uint32_t Ticks{};
+        uint32_t OverBudgetTicks{};
+        bool OverBudget{};
+    };
+
     class Plugin
     {
     private:
@@ -62,6 +79,7 @@ namespace OpenRCT2::Scripting
         bool _hasLoaded{};
         bool _hasStarted{};
         bool _isStopping{};
+        PluginTimeStats _timeStats{};
 
     public:
         std::string_view GetPath() const
@@ -99,6 +117,16 @@ namespace OpenRCT2::Scripting
             return _hasLoaded;
         }
 
+        PluginTimeStats& GetTimeStats()
+        {
+            return _timeStats;
+        }
+
+        const PluginTimeStats& GetTimeStats() const
+        {
+            return _timeStats;
+        }
+
         int32_t GetTargetAPIVersion() const;
 
         Plugin() = default;
@@ -119,6 +147,10 @@ namespace OpenRCT2::Scripting
 
     private:
         void LoadCodeFromFile();
+        bool ReadBytecodeCache(std::string_view key);
+        void WriteBytecodeCache(std::string_view key);
+
+        static std::string GetBytecodeCachePath(std::string_view pluginPath);
 
         static PluginMetadata GetMetadata(const DukValue& dukMetadata);
         static PluginType ParsePluginType(std::string_view type);
@@ -16,10 +16,12 @@
 #    include "../actions/GameAction.h"
 #    include "../actions/RideCreateAction.h"
 #    include "../actions/StaffHireNewAction.h"
+#    include "../actions/TileModifyAction.h"
 #    include "../config/Config.h"
 #    include "../core/EnumMap.hpp"
 #    include "../core/File.h"
 #    include "../core/FileScanner.h"
+#    include "../core/FileStream.h"
 #    include "../core/Path.hpp"
 #    include "../interface/InteractiveConsole.h"
 #    include "../platform/Platform.h"
@@ -36,6 +38,7 @@
 #    include "bindings/game/ScDisposable.hpp"
 #    include "bindings/game/ScPlugin.hpp"
 #    include "bindings/game/ScProfiler.hpp"
+#    include "bindings/game/ScWorker.hpp"
 #    include "bindings/network/ScNetwork.hpp"
 #    include "bindings/network/ScPlayer.hpp"
 #    include "bindings/network/ScPlayerGroup.hpp"
@@ -55,6 +58,10 @@
 #    include "bindings/world/ScTile.hpp"
 #    include "bindings/world/ScTileElement.hpp"
 
+#    include <algorithm>
+#    include <atomic>
+#    include <chrono>
+#    include <cstdio>
 #    include <iostream>
 #    include <memory>
 #    include <stdexcept>
@@ -390,6 +397,15 @@ ScriptEngine::ScriptEngine(InteractiveConsole& console, IPlatformEnvironment& en
 {
 }
 
+ScriptEngine::~ScriptEngine()
+{
+    WaitForSharedStorageSave();
+    if (!_sharedStorageChanges.empty())
+    {
+        SaveSharedStorage();
+    }
+}
+
 void ScriptEngine::Initialise()
 {
     if (_initialised)
@@ -440,6 +456,7 @@ void ScriptEngine::Initialise()
     ScSocket::Register(ctx);
     ScListener::Register(ctx);
 #    endif
+    ScWorker::Register(ctx);
     ScScenario::Register(ctx);
     ScScenarioObjective::Register(ctx);
     ScPatrolArea::Register(ctx);
@@ -762,6 +779,7 @@ void ScriptEngine::StopPlugin(std::shared_ptr<Plugin> plugin)
         RemoveCustomGameActions(plugin);
         RemoveIntervals(plugin);
         RemoveSockets(plugin);
+        RemoveWorkers(plugin);
         _hookEngine.UnsubscribeAll(plugin);
 
         plugin->StopEnd();
@@ -910,13 +928,71 @@ void ScriptEngine::Tick()
 {
     PROFILED_FUNCTION();
 
+    UpdatePluginBudgets();
     CheckAndStartPlugins();
     UpdateIntervals();
     UpdateSockets();
+    UpdateWorkers();
+    UpdateSharedStorage();
     ProcessREPL();
     DoAutoReloadPluginCheck();
 }
 
+void ScriptEngine::UpdatePluginBudgets()
+{
+    const auto budget = static_cast<double>(gConfigPlugin.TickBudget);
+    const auto policy = gConfigPlugin.BudgetPolicy;
+
+    // Copy the list, stopping a plugin notifies other plugins which may change it
+    auto plugins = _plugins;
+    for (const auto& plugin : plugins)
+    {
+        auto& stats = plugin->GetTimeStats();
+        stats.LastTickMs = stats.CurrentTickMs;
+        stats.PeakTickMs = std::max(stats.PeakTickMs, stats.CurrentTickMs);
+        stats.CurrentTickMs = 0;
+        if (!plugin->HasStarted())
+        {
+            stats.OverBudget = false;
+            continue;
+        }
+
+        stats.Ticks++;
+        const auto wasOverBudget = stats.OverBudget;
+        stats.OverBudget = budget > 0 && stats.LastTickMs > budget;
+        if (!stats.OverBudget)
+        {
+            continue;
+        }
+
+        stats.OverBudgetTicks++;
+        if (policy == PluginBudgetPolicy::Disable)
+        {
+            char buffer[128];
+            snprintf(buffer, sizeof(buffer), "Took %.2f ms in one tick, over the %.2f ms budget", stats.LastTickMs, budget);
+            LogPluginInfo(plugin, buffer);
+            stats.OverBudget = false;
+            StopPlugin(plugin);
+        }
+        else if (!wasOverBudget)
+        {
+            char buffer[128];
+            snprintf(
+                buffer, sizeof(buffer), "Took %.2f ms in one tick, over the %.2f ms budget%s", stats.LastTickMs, budget,
+                policy == PluginBudgetPolicy::Throttle ? ", skipping callbacks next tick" : "");
+            LogPluginInfo(plugin, buffer);
+        }
+    }
+}
+
+void ScriptEngine::ResetPluginTimeStats()
+{
+    for (const auto& plugin : _plugins)
+    {
+        plugin->GetTimeStats() = {};
+    }
+}
+
 void ScriptEngine::CheckAndStartPlugins()
 {
     auto startIntransient = !_intransientPluginsStarted;
@@ -984,6 +1060,15 @@ DukValue ScriptEngine::ExecutePluginCall(
     DukStackFrame frame(_context);
     if (func.is_function() && plugin->HasStarted())
     {
+        auto& stats = plugin->GetTimeStats();
+
+        // Callbacks that can change the game state must always run to keep clients in sync
+        if (stats.OverBudget && !isGameStateMutable && gConfigPlugin.BudgetPolicy == PluginBudgetPolicy::Throttle)
+        {
+            stats.SkippedCalls++;
+            return DukValue();
+        }
+
         ScriptExecutionInfo::PluginScope scope(_execInfo, plugin, isGameStateMutable);
         func.push();
         thisValue.push();
@@ -991,7 +1076,21 @@ DukValue ScriptEngine::ExecutePluginCall(
         {
             arg.push();
         }
+
+        const auto parentNestedCallMs = _nestedCallMs;
+        _nestedCallMs = 0;
+        const auto startTime = std::chrono::high_resolution_clock::now();
         auto result = duk_pcall_method(_context, static_cast<duk_idx_t>(args.size()));
+        const auto elapsedMs = std::chrono::duration<double, std::milli>(
+                                   std::chrono::high_resolution_clock::now() - startTime)
+                                   .count();
+        const auto selfMs = std::max(0.0, elapsedMs - _nestedCallMs);
+        _nestedCallMs = parentNestedCallMs + elapsedMs;
+
+        stats.Calls++;
+        stats.TotalMs += selfMs;
+        stats.CurrentTickMs += selfMs;
+
         if (result == DUK_EXEC_SUCCESS)
         {
             return DukValue::take_from_stack(_context);
@@ -1372,6 +1471,7 @@ const static EnumMap<GameCommand> ActionNameToType = {
     { "ridesetsetting", GameCommand::SetRideSetting },
     { "ridesetstatus", GameCommand::SetRideStatus },
     { "ridesetvehicle", GameCommand::SetRideVehicles },
+    { "ridesimulatetest", GameCommand::SimulateRideTest },
     { "scenariosetsetting", GameCommand::EditScenarioOptions },
     { "cheatset", GameCommand::Cheat },
     { "signsetname", GameCommand::SetSignName },
@@ -1490,9 +1590,46 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Res
     }
 }
 
+// A tile modify action with a modifications array applies all of them as one batch.
+static std::unique_ptr<GameAction> CreateTileModifyBatchAction(const DukValue& modifications)
+{
+    const auto modificationList = modifications.as_array();
+    if (modificationList.size() > TileModifyAction::kMaxBatchSize)
+    {
+        duk_error(
+            modifications.context(), DUK_ERR_RANGE_ERROR, "A tile modification batch is limited to %u modifications.",
+            static_cast<uint32_t>(TileModifyAction::kMaxBatchSize));
+    }
+
+    std::vector<TileModifyEntry> batch;
+    batch.reserve(modificationList.size());
+    for (const auto& modification : modificationList)
+    {
+        TileModifyEntry entry;
+        entry.Loc = { AsOrDefault(modification["x"], 0), AsOrDefault(modification["y"], 0) };
+        entry.Setting = static_cast<TileModifyType>(AsOrDefault(modification["setting"], 0));
+        entry.Value1 = static_cast<uint32_t>(AsOrDefault(modification["value1"], 0));
+        entry.Value2 = static_cast<uint32_t>(AsOrDefault(modification["value2"], 0));
+        batch.push_back(entry);
+    }
+    return std::make_unique<TileModifyAction>(std::move(batch));
+}
+
 std::unique_ptr<GameAction> ScriptEngine::CreateGameAction(
     const std::string& actionid, const DukValue& args, const std::string& pluginName)
 {
+    if (actionid == "tilemodify" && args.type() == DukValue::Type::OBJECT && args["modifications"].is_array())
+    {
+        auto action = CreateTileModifyBatchAction(args["modifications"]);
+        if (args["flags"].type() == DukValue::Type::NUMBER)
+        {
+            DukValue argsCopy = args;
+            DukToGameActionParameterVisitor visitor(std::move(argsCopy));
+            action->AcceptFlags(visitor);
+        }
+        return action;
+    }
+
     auto action = CreateGameActionFromActionId(actionid);
     if (action != nullptr)
     {
@@ -1536,7 +1673,16 @@ void ScriptEngine::InitSharedStorage()
 
 void ScriptEngine::LoadSharedStorage()
 {
+    // Nothing written from memory may be lost by reading the file again
+    WaitForSharedStorageSave();
+    if (!_sharedStorageChanges.empty())
+    {
+        SaveSharedStorage();
+    }
+
     InitSharedStorage();
+    _sharedStorageSize = 0;
+    _sharedStorageJournalSize = 0;
 
     auto path = _env.GetFilePath(PATHID::PLUGIN_STORE);
     try
@@ -1549,6 +1695,7 @@ void ScriptEngine::LoadSharedStorage()
             if (result)
             {
                 _sharedStorage = std::move(*result);
+                _sharedStorageSize = data.size();
             }
         }
     }
@@ -1556,10 +1703,40 @@ void ScriptEngine::LoadSharedStorage()
     {
         Console::Error::WriteLine("Unable to read '%s'", path.c_str());
     }
+
+    // Replay the changes made since the store was last written in full
+    auto journalPath = GetSharedStorageJournalPath();
+    try
+    {
+        if (File::Exists(journalPath))
+        {
+            ScConfiguration storage(ScConfigurationKind::Shared, _sharedStorage);
+            for (const auto& line : File::ReadAllLines(journalPath))
+            {
+                if (line.empty())
+                    continue;
+
+                // A line is incomplete if the game exited or the disk filled up while appending it
+                auto change = DuktapeTryParseJson(_context, line);
+                if (change && (*change)["key"].type() == DukValue::Type::STRING)
+                {
+                    storage.SetValue(_context, (*change)["key"].as_string(), (*change)["value"]);
+                }
+            }
+            SaveSharedStorage();
+        }
+    }
+    catch (const std::exception&)
+    {
+        Console::Error::WriteLine("Unable to read '%s'", journalPath.c_str());
+    }
 }
 
 void ScriptEngine::SaveSharedStorage()
 {
+    WaitForSharedStorageSave();
+    _sharedStorageChanges.clear();
+
     auto path = _env.GetFilePath(PATHID::PLUGIN_STORE);
     try
     {
@@ -1568,6 +1745,9 @@ void ScriptEngine::SaveSharedStorage()
         duk_pop(_context);
 
         File::WriteAllBytes(path, json.c_str(), json.size());
+        File::Delete(GetSharedStorageJournalPath());
+        _sharedStorageSize = json.size();
+        _sharedStorageJournalSize = 0;
     }
     catch (const std::exception&)
     {
@@ -1575,6 +1755,122 @@ void ScriptEngine::SaveSharedStorage()
     }
 }
 
+std::string ScriptEngine::GetSharedStorageJournalPath() const
+{
+    return _env.GetFilePath(PATHID::PLUGIN_STORE) + u8".journal";
+}
+
+void ScriptEngine::MarkSharedStorageChanged(std::string_view key, const DukValue& value)
+{
+    duk_push_object(_context);
+    duk_push_lstring(_context, key.data(), key.size());
+    duk_put_prop_string(_context, -2, "key");
+    if (value.type() != DukValue::Type::UNDEFINED)
+    {
+        value.push();
+        duk_put_prop_string(_context, -2, "value");
+    }
+    auto line = std::string(duk_json_encode(_context, -1));
+    duk_pop(_context);
+
+    auto timestamp = Platform::GetTicks();
+    if (_sharedStorageChanges.empty())
+    {
+        _sharedStorageFirstChangeTimestamp = timestamp;
+    }
+    _sharedStorageLastChangeTimestamp = timestamp;
+    _sharedStorageChanges.push_back(std::move(line));
+}
+
+// Shared storage is written once plugins stop changing it for this long, in milliseconds.
+static constexpr uint32_t kSharedStorageSaveDelay = 1000;
+static constexpr uint32_t kSharedStorageMaxSaveDelay = 10000;
+
+// Smallest journal that causes the store to be written in full, even if the store is smaller.
+static constexpr size_t kSharedStorageMinCompactSize = 64 * 1024;
+
+void ScriptEngine::UpdateSharedStorage()
+{
+    if (_sharedStorageChanges.empty())
+        return;
+
+    // Wait for plugins to stop writing, but not forever if they write continuously
+    auto timestamp = Platform::GetTicks();
+    if (timestamp - _sharedStorageLastChangeTimestamp < kSharedStorageSaveDelay
+        && timestamp - _sharedStorageFirstChangeTimestamp < kSharedStorageMaxSaveDelay)
+        return;
+
+    // The previous write must finish first so the files are written in order
+    if (_sharedStorageSaveJob.valid()
+        && _sharedStorageSaveJob.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return;
+    WaitForSharedStorageSave();
+
+    auto path = _env.GetFilePath(PATHID::PLUGIN_STORE);
+    auto journalPath = GetSharedStorageJournalPath();
+
+    size_t changesSize = 0;
+    for (const auto& line : _sharedStorageChanges)
+    {
+        changesSize += line.size() + 1;
+    }
+
+    if (_sharedStorageJournalSize + changesSize > std::max(_sharedStorageSize, kSharedStorageMinCompactSize))
+    {
+        // The journal has outgrown the store, write the store in full instead
+        _sharedStorage.push();
+        auto json = std::string(duk_json_encode(_context, -1));
+        duk_pop(_context);
+        _sharedStorageSize = json.size();
+        _sharedStorageJournalSize = 0;
+
+        _sharedStorageSaveJob = std::async(
+            std::launch::async, [path = std::move(path), journalPath = std::move(journalPath), json = std::move(json)]() {
+                try
+                {
+                    File::WriteAllBytes(path, json.c_str(), json.size());
+                    File::Delete(journalPath);
+                }
+                catch (const std::exception&)
+                {
+                    Console::Error::WriteLine("Unable to write to '%s'", path.c_str());
+                }
+            });
+    }
+    else
+    {
+        _sharedStorageJournalSize += changesSize + 1;
+        _sharedStorageSaveJob = std::async(
+            std::launch::async, [journalPath = std::move(journalPath), changes = std::move(_sharedStorageChanges)]() {
+                try
+                {
+                    // A failed earlier append can leave a torn line at the end, the new lines must not continue it.
+                    // The empty line this gives otherwise is skipped when the journal is replayed.
+                    auto fs = FileStream(journalPath, FILE_MODE_APPEND);
+                    fs.Write("\n", 1);
+                    for (const auto& line : changes)
+                    {
+                        fs.Write(line.data(), line.size());
+                        fs.Write("\n", 1);
+                    }
+                }
+                catch (const std::exception&)
+                {
+                    Console::Error::WriteLine("Unable to write to '%s'", journalPath.c_str());
+                }
+            });
+    }
+    _sharedStorageChanges.clear();
+}
+
+void ScriptEngine::WaitForSharedStorageSave()
+{
+    if (_sharedStorageSaveJob.valid())
+    {
+        _sharedStorageSaveJob.get();
+    }
+}
+
 void ScriptEngine::ClearParkStorage()
 {
     duk_push_object(_context);
@@ -1762,6 +2058,48 @@ void ScriptEngine::RemoveSockets(const std::shared_ptr<Plugin>& plugin)
 #    endif
 }
 
+void ScriptEngine::AddWorker(const std::shared_ptr<ScWorker>& worker)
+{
+    _workers.push_back(worker);
+}
+
+void ScriptEngine::UpdateWorkers()
+{
+    // Use simple for i loop as Update calls can modify the list
+    auto it = _workers.begin();
+    while (it != _workers.end())
+    {
+        auto worker = *it;
+        worker->Update();
+        if (worker->IsDisposed())
+        {
+            it = _workers.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
+void ScriptEngine::RemoveWorkers(const std::shared_ptr<Plugin>& plugin)
+{
+    auto it = _workers.begin();
+    while (it != _workers.end())
+    {
+        auto worker = it->get();
+        if (worker->GetPlugin() == plugin)
+        {
+            worker->Dispose();
+            it = _workers.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
 std::string OpenRCT2::Scripting::Stringify(const DukValue& val)
 {
     return ExpressionStringifier::StringifyExpression(val);
@@ -1818,9 +2156,11 @@ int32_t OpenRCT2::Scripting::GetTargetAPIVersion()
     return plugin->GetTargetAPIVersion();
 }
 
-duk_bool_t duk_exec_timeout_check(void*)
+duk_bool_t duk_exec_timeout_check(void* udata)
 {
-    return false;
+    // Only worker heaps are created with user data, see ScriptWorker
+    auto terminating = static_cast<const std::atomic<bool>*>(udata);
+    return terminating != nullptr && terminating->load();
 }
 
 #endif
@@ -47,7 +47,7 @@ namespace OpenRCT2
 
 namespace OpenRCT2::Scripting
 {
-    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 84;
+    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 94;
 
     // Versions marking breaking changes.
     static constexpr int32_t API_VERSION_33_PEEP_DEPRECATION = 33;
@@ -57,6 +57,7 @@ namespace OpenRCT2::Scripting
 
 #    ifndef DISABLE_NETWORK
     class ScSocketBase;
+    class ScWorker;
 #    endif
 
     class ScriptExecutionInfo
@@ -156,7 +157,16 @@ namespace OpenRCT2::Scripting
         DukValue _sharedStorage;
         DukValue _parkStorage;
 
+        // Changes to shared storage not yet written, as journal lines
+        std::vector<std::string> _sharedStorageChanges;
+        uint32_t _sharedStorageFirstChangeTimestamp{};
+        uint32_t _sharedStorageLastChangeTimestamp{};
+        size_t _sharedStorageSize{};
+        size_t _sharedStorageJournalSize{};
+        std::future<void> _sharedStorageSaveJob;
+
         uint32_t _lastIntervalTimestamp{};
+        double _nestedCallMs{};
         std::map<IntervalHandle, ScriptInterval> _intervals;
         IntervalHandle _nextIntervalHandle = 1;
 
@@ -177,10 +187,12 @@ namespace OpenRCT2::Scripting
 #    ifndef DISABLE_NETWORK
         std::list<std::shared_ptr<ScSocketBase>> _sockets;
 #    endif
+        std::list<std::shared_ptr<ScWorker>> _workers;
 
     public:
         ScriptEngine(InteractiveConsole& console, IPlatformEnvironment& env);
         ScriptEngine(ScriptEngine&) = delete;
+        ~ScriptEngine();
 
         duk_context* GetContext()
         {
@@ -241,6 +253,8 @@ namespace OpenRCT2::Scripting
         void LogPluginInfo(std::string_view message);
         void LogPluginInfo(const std::shared_ptr<Plugin>& plugin, std::string_view message);
 
+        void ResetPluginTimeStats();
+
         void SubscribeToPluginStoppedEvent(std::function<void(std::shared_ptr<Plugin>)> callback)
         {
             _pluginStoppedSubscriptions.push_back(callback);
@@ -258,6 +272,7 @@ namespace OpenRCT2::Scripting
         [[nodiscard]] DukValue GameActionResultToDuk(const GameAction& action, const GameActions::Result& result);
 
         void SaveSharedStorage();
+        void MarkSharedStorageChanged(std::string_view key, const DukValue& value);
 
         IntervalHandle AddInterval(const std::shared_ptr<Plugin>& plugin, int32_t delay, bool repeat, DukValue&& callback);
         void RemoveInterval(const std::shared_ptr<Plugin>& plugin, IntervalHandle handle);
@@ -265,6 +280,7 @@ namespace OpenRCT2::Scripting
 #    ifndef DISABLE_NETWORK
         void AddSocket(const std::shared_ptr<ScSocketBase>& socket);
 #    endif
+        void AddWorker(const std::shared_ptr<ScWorker>& worker);
 
     private:
         void RegisterConstants();
@@ -287,6 +303,7 @@ namespace OpenRCT2::Scripting
         void DoAutoReloadPluginCheck();
         void AutoReloadPlugins();
         void ProcessREPL();
+        void UpdatePluginBudgets();
         void RemoveCustomGameActions(const std::shared_ptr<Plugin>& plugin);
         [[nodiscard]] GameActions::Result DukToGameActionResult(const DukValue& d);
         static std::string_view ExpenditureTypeToString(ExpenditureType expenditureType);
@@ -294,6 +311,9 @@ namespace OpenRCT2::Scripting
 
         void InitSharedStorage();
         void LoadSharedStorage();
+        void UpdateSharedStorage();
+        void WaitForSharedStorageSave();
+        std::string GetSharedStorageJournalPath() const;
 
         IntervalHandle AllocateHandle();
         void UpdateIntervals();
@@ -301,6 +321,8 @@ namespace OpenRCT2::Scripting
 
         void UpdateSockets();
         void RemoveSockets(const std::shared_ptr<Plugin>& plugin);
+        void UpdateWorkers();
+        void RemoveWorkers(const std::shared_ptr<Plugin>& plugin);
     };
 
     bool IsGameStateMutable();
@@ -0,0 +1,204 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "ScriptWorker.h"
+
+using namespace OpenRCT2::Scripting;
+
+static constexpr const char* kWorkerStashKey = "worker";
+static constexpr const char* kHandlerStashKey = "onMessage";
+
+ScriptWorker::ScriptWorker(std::string code)
+    : _code(std::move(code))
+    , _thread([this]() { Run(); })
+{
+}
+
+ScriptWorker::~ScriptWorker()
+{
+    Terminate();
+}
+
+bool ScriptWorker::Send(std::string json)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_inbox.size() >= kMaxQueuedMessages)
+        {
+            return false;
+        }
+        _inbox.push_back(std::move(json));
+    }
+    _inboxCondition.notify_one();
+    return true;
+}
+
+std::vector<WorkerMessage> ScriptWorker::Receive()
+{
+    std::vector<WorkerMessage> messages;
+    std::lock_guard<std::mutex> lock(_mutex);
+    messages.swap(_outbox);
+    return messages;
+}
+
+void ScriptWorker::Terminate()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _terminating = true;
+    }
+    _inboxCondition.notify_one();
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+bool ScriptWorker::IsTerminating() const
+{
+    return _terminating;
+}
+
+void ScriptWorker::Run()
+{
+    // The heap's user data is read by duk_exec_timeout_check to interrupt the worker
+    auto ctx = duk_create_heap(nullptr, nullptr, nullptr, &_terminating, nullptr);
+    if (ctx == nullptr)
+    {
+        Post(WorkerMessageType::Error, "Unable to initialise duktape context.");
+        return;
+    }
+
+    duk_push_global_stash(ctx);
+    duk_push_pointer(ctx, this);
+    duk_put_prop_string(ctx, -2, kWorkerStashKey);
+    duk_pop(ctx);
+
+    duk_push_global_object(ctx);
+    duk_push_c_function(ctx, NativePostMessage, 1);
+    duk_put_prop_string(ctx, -2, "postMessage");
+    duk_push_c_function(ctx, NativeOnMessage, 1);
+    duk_put_prop_string(ctx, -2, "onMessage");
+    duk_push_object(ctx);
+    duk_push_c_function(ctx, NativeLog, DUK_VARARGS);
+    duk_put_prop_string(ctx, -2, "log");
+    duk_put_prop_string(ctx, -2, "console");
+    duk_pop(ctx);
+
+    if (duk_peval_lstring(ctx, _code.data(), _code.size()) != 0 && !_terminating)
+    {
+        Post(WorkerMessageType::Error, duk_safe_to_string(ctx, -1));
+    }
+    duk_pop(ctx);
+
+    while (true)
+    {
+        std::string message;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _inboxCondition.wait(lock, [this]() { return _terminating || !_inbox.empty(); });
+            if (_terminating)
+            {
+                break;
+            }
+            message = std::move(_inbox.front());
+            _inbox.pop_front();
+        }
+
+        duk_push_lstring(ctx, message.data(), message.size());
+        if (duk_safe_call(ctx, CallMessageHandler, nullptr, 1, 1) != DUK_EXEC_SUCCESS && !_terminating)
+        {
+            Post(WorkerMessageType::Error, duk_safe_to_string(ctx, -1));
+        }
+        duk_pop(ctx);
+    }
+
+    duk_destroy_heap(ctx);
+}
+
+void ScriptWorker::Post(WorkerMessageType type, std::string data)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _outbox.push_back({ type, std::move(data) });
+}
+
+ScriptWorker& ScriptWorker::GetWorker(duk_context* ctx)
+{
+    duk_push_global_stash(ctx);
+    duk_get_prop_string(ctx, -1, kWorkerStashKey);
+    auto worker = static_cast<ScriptWorker*>(duk_get_pointer(ctx, -1));
+    duk_pop_2(ctx);
+    return *worker;
+}
+
+duk_ret_t ScriptWorker::CallMessageHandler(duk_context* ctx, void*)
+{
+    duk_json_decode(ctx, -1);
+    duk_push_global_stash(ctx);
+    duk_get_prop_string(ctx, -1, kHandlerStashKey);
+    if (!duk_is_function(ctx, -1))
+    {
+        return 0;
+    }
+    duk_dup(ctx, -3);
+    duk_call(ctx, 1);
+    return 0;
+}
+
+duk_ret_t ScriptWorker::NativePostMessage(duk_context* ctx)
+{
+    auto& worker = GetWorker(ctx);
+    if (worker._terminating)
+    {
+        return 0;
+    }
+
+    auto json = duk_json_encode(ctx, 0);
+    {
+        std::lock_guard<std::mutex> lock(worker._mutex);
+        if (worker._outbox.size() >= kMaxQueuedMessages)
+        {
+            duk_error(ctx, DUK_ERR_RANGE_ERROR, "Too many messages waiting to be received.");
+        }
+    }
+    worker.Post(WorkerMessageType::Message, json != nullptr ? json : "null");
+    return 0;
+}
+
+duk_ret_t ScriptWorker::NativeOnMessage(duk_context* ctx)
+{
+    if (!duk_is_function(ctx, 0) && !duk_is_null_or_undefined(ctx, 0))
+    {
+        duk_error(ctx, DUK_ERR_TYPE_ERROR, "Expected a function.");
+    }
+    duk_push_global_stash(ctx);
+    duk_dup(ctx, 0);
+    duk_put_prop_string(ctx, -2, kHandlerStashKey);
+    return 0;
+}
+
+duk_ret_t ScriptWorker::NativeLog(duk_context* ctx)
+{
+    std::string line;
+    auto numArgs = duk_get_top(ctx);
+    for (duk_idx_t i = 0; i < numArgs; i++)
+    {
+        if (i != 0)
+        {
+            line.push_back(' ');
+        }
+        line += duk_safe_to_string(ctx, i);
+    }
+    GetWorker(ctx).Post(WorkerMessageType::Log, std::move(line));
+    return 0;
+}
+
+#endif
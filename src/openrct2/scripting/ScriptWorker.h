@@ -0,0 +1,94 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "Duktape.hpp"
+
+#    include <atomic>
+#    include <condition_variable>
+#    include <deque>
+#    include <mutex>
+#    include <string>
+#    include <thread>
+#    include <vector>
+
+namespace OpenRCT2::Scripting
+{
+    enum class WorkerMessageType
+    {
+        Message,
+        Error,
+        Log,
+    };
+
+    struct WorkerMessage
+    {
+        WorkerMessageType Type{};
+        std::string Data;
+    };
+
+    /**
+     * Runs plugin code in its own duktape heap on a background thread. The heap has no bindings to the
+     * game, values are exchanged with the owning plugin as JSON so neither side can hold a reference
+     * into the other heap.
+     */
+    class ScriptWorker
+    {
+    public:
+        static constexpr size_t kMaxQueuedMessages = 4096;
+
+    private:
+        std::string _code;
+        std::mutex _mutex;
+        std::condition_variable _inboxCondition;
+        std::deque<std::string> _inbox;
+        std::vector<WorkerMessage> _outbox;
+
+        // Checked by duktape's execution timeout hook so running worker code can be interrupted
+        std::atomic<bool> _terminating{};
+        std::thread _thread;
+
+    public:
+        explicit ScriptWorker(std::string code);
+        ScriptWorker(const ScriptWorker&) = delete;
+        ~ScriptWorker();
+
+        /**
+         * Queues a JSON encoded value for the worker's onMessage handler.
+         * @returns false if the worker has too many messages waiting.
+         */
+        bool Send(std::string json);
+
+        /**
+         * Takes all messages, errors and log lines the worker has produced since the last call.
+         */
+        std::vector<WorkerMessage> Receive();
+
+        /**
+         * Stops the worker, interrupting any code it is running, and waits for the thread to finish.
+         */
+        void Terminate();
+        bool IsTerminating() const;
+
+    private:
+        void Run();
+        void Post(WorkerMessageType type, std::string data);
+
+        static ScriptWorker& GetWorker(duk_context* ctx);
+        static duk_ret_t CallMessageHandler(duk_context* ctx, void* udata);
+        static duk_ret_t NativePostMessage(duk_context* ctx);
+        static duk_ret_t NativeOnMessage(duk_context* ctx);
+        static duk_ret_t NativeLog(duk_context* ctx);
+    };
+} // namespace OpenRCT2::Scripting
+
+#endif
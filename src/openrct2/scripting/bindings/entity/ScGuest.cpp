@@ -276,7 +276,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
-            peep->Happiness = value;
+            peep->SetHappiness(value);
         }
     }
 
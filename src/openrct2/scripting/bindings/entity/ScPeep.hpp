@@ -149,7 +149,7 @@ namespace OpenRCT2::Scripting
             auto peep = GetPeep();
             if (peep != nullptr)
             {
-                peep->Energy = value;
+                peep->SetEnergy(value);
             }
         }
 
@@ -13,6 +13,7 @@
 
 #    include "../../../entity/PatrolArea.h"
 #    include "../../../entity/Staff.h"
+#    include "../../../management/Finance.h"
 
 namespace OpenRCT2::Scripting
 {
@@ -84,6 +85,7 @@ namespace OpenRCT2::Scripting
                 peep->AssignedStaffType = StaffType::Entertainer;
                 peep->SpriteType = PeepSpriteType::EntertainerPanda;
             }
+            FinanceInvalidateStaffWages();
         }
     }
 
@@ -54,6 +54,27 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScConfiguration::has, "has");
         }
 
+        /**
+         * Sets or, if the value is undefined, removes a value without validating the key. Used to replay
+         * changes from the shared storage journal.
+         */
+        void SetValue(duk_context* ctx, std::string_view key, const DukValue& value) const
+        {
+            auto [ns, n] = GetNamespaceAndKey(key);
+            auto obj = GetOrCreateNamespaceObject(ctx, ns);
+            obj.push();
+            if (value.type() == DukValue::Type::UNDEFINED)
+            {
+                duk_del_prop_lstring(ctx, -1, n.data(), n.size());
+            }
+            else
+            {
+                value.push();
+                duk_put_prop_lstring(ctx, -2, n.data(), n.size());
+            }
+            duk_pop(ctx);
+        }
+
     private:
         std::pair<std::string_view, std::string_view> GetNextNamespace(std::string_view input) const
         {
@@ -271,20 +292,13 @@ namespace OpenRCT2::Scripting
                 }
                 else
                 {
-                    auto obj = GetOrCreateNamespaceObject(ctx, ns);
-                    obj.push();
-                    if (value.type() == DukValue::Type::UNDEFINED)
-                    {
-                        duk_del_prop_lstring(ctx, -1, n.data(), n.size());
-                    }
-                    else
+                    SetValue(ctx, key, value);
+
+                    // Park storage is saved with the park
+                    if (_kind == ScConfigurationKind::Shared)
                     {
-                        value.push();
-                        duk_put_prop_lstring(ctx, -2, n.data(), n.size());
+                        scriptEngine.MarkSharedStorageChanged(key, value);
                     }
-                    duk_pop(ctx);
-
-                    scriptEngine.SaveSharedStorage();
                 }
             }
         }
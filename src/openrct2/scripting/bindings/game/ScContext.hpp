@@ -23,6 +23,7 @@
 #    include "../../ScriptEngine.h"
 #    include "../game/ScConfiguration.hpp"
 #    include "../game/ScDisposable.hpp"
+#    include "../game/ScWorker.hpp"
 #    include "../object/ScObjectManager.h"
 #    include "../ride/ScTrackSegment.h"
 
@@ -261,14 +262,14 @@ namespace OpenRCT2::Scripting
         //      Only ensuring it was not in the same generated method fixed it.
         __declspec(noinline)
 #    endif
-            std::shared_ptr<ScDisposable> CreateSubscription(HOOK_TYPE hookType, const DukValue& callback)
+            std::shared_ptr<ScDisposable> CreateSubscription(HOOK_TYPE hookType, const DukValue& callback, bool batched)
         {
             auto owner = _execInfo.GetCurrentPlugin();
-            auto cookie = _hookEngine.Subscribe(hookType, owner, callback);
+            auto cookie = _hookEngine.Subscribe(hookType, owner, callback, batched);
             return std::make_shared<ScDisposable>([this, hookType, cookie]() { _hookEngine.Unsubscribe(hookType, cookie); });
         }
 
-        std::shared_ptr<ScDisposable> subscribe(const std::string& hook, const DukValue& callback)
+        std::shared_ptr<ScDisposable> subscribe(const std::string& hook, const DukValue& callback, const DukValue& options)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
             auto ctx = scriptEngine.GetContext();
@@ -295,7 +296,13 @@ namespace OpenRCT2::Scripting
                 duk_error(ctx, DUK_ERR_ERROR, "Hook type not available for this plugin type.");
             }
 
-            return CreateSubscription(hookType, callback);
+            const auto batched = options.type() == DukValue::Type::OBJECT && AsOrDefault(options["batched"], false);
+            if (batched && !IsBatchableHook(hookType))
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Hook type can not be batched.");
+            }
+
+            return CreateSubscription(hookType, callback, batched);
         }
 
         void queryAction(const std::string& action, const DukValue& args, const DukValue& callback)
@@ -420,6 +427,19 @@ namespace OpenRCT2::Scripting
             ClearIntervalOrTimeout(handle);
         }
 
+        std::shared_ptr<ScWorker> createWorker(const std::string& code)
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto plugin = scriptEngine.GetExecInfo().GetCurrentPlugin();
+            if (plugin == nullptr)
+            {
+                duk_error(scriptEngine.GetContext(), DUK_ERR_ERROR, "Workers can only be created by plugins.");
+            }
+            auto worker = std::make_shared<ScWorker>(plugin, code);
+            scriptEngine.AddWorker(worker);
+            return worker;
+        }
+
         int32_t getIcon(const std::string& iconName)
         {
             return GetIconByName(iconName);
@@ -449,6 +469,7 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScContext::clearInterval, "clearInterval");
             dukglue_register_method(ctx, &ScContext::clearTimeout, "clearTimeout");
             dukglue_register_method(ctx, &ScContext::getIcon, "getIcon");
+            dukglue_register_method(ctx, &ScContext::createWorker, "createWorker");
         }
     };
 
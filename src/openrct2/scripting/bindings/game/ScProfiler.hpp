@@ -11,8 +11,13 @@
 
 #ifdef ENABLE_SCRIPTING
 
+#    include "../../../Context.h"
+#    include "../../../profiling/FramePacing.h"
+#    include "../../../profiling/MemoryUsage.h"
 #    include "../../../profiling/Profiling.h"
+#    include "../../../profiling/Telemetry.h"
 #    include "../../Duktape.hpp"
+#    include "../../ScriptEngine.h"
 
 namespace OpenRCT2::Scripting
 {
@@ -69,6 +74,114 @@ namespace OpenRCT2::Scripting
             return DukValue::take_from_stack(_ctx);
         }
 
+        DukValue getTickStats(const DukValue& dukCount)
+        {
+            auto count = Telemetry::kMaxTickSamples;
+            if (dukCount.type() == DukValue::Type::NUMBER)
+            {
+                count = static_cast<size_t>(std::max(dukCount.as_int(), 0));
+            }
+
+            const auto samples = Telemetry::GetRecentTicks(count);
+            duk_push_array(_ctx);
+            duk_uarridx_t index = 0;
+            for (const auto& sample : samples)
+            {
+                uint32_t miscEntities = 0;
+                for (auto type = EnumValue(EntityType::SteamParticle); type < EnumValue(EntityType::Count); type++)
+                {
+                    miscEntities += sample.EntityCounts[type];
+                }
+
+                DukObject entities(_ctx);
+                entities.Set("vehicle", sample.EntityCounts[EnumValue(EntityType::Vehicle)]);
+                entities.Set("guest", sample.EntityCounts[EnumValue(EntityType::Guest)]);
+                entities.Set("staff", sample.EntityCounts[EnumValue(EntityType::Staff)]);
+                entities.Set("litter", sample.EntityCounts[EnumValue(EntityType::Litter)]);
+                entities.Set("misc", miscEntities);
+
+                DukObject obj(_ctx);
+                obj.Set("tick", sample.Tick);
+                obj.Set("tickTime", sample.TickTimeMs);
+                obj.Set("frameTime", sample.FrameTimeMs);
+                obj.Set("tileElements", sample.TileElements);
+                obj.Set("networkQueueDepth", sample.NetworkQueueDepth);
+                obj.Set("gameActions", sample.GameActions);
+                obj.Set("entities", entities.Take());
+                obj.Take().push();
+                duk_put_prop_index(_ctx, /* duk stack index */ -2, index);
+                index++;
+            }
+            return DukValue::take_from_stack(_ctx);
+        }
+
+        DukValue getMemoryUsage()
+        {
+            duk_push_array(_ctx);
+            duk_uarridx_t index = 0;
+            for (const auto& usage : MemoryUsage::Collect())
+            {
+                DukObject obj(_ctx);
+                obj.Set("name", MemoryUsage::GetSubsystemName(usage.Id));
+                obj.Set("bytes", static_cast<double>(usage.Bytes));
+                obj.Set("peakBytes", static_cast<double>(usage.PeakBytes));
+                obj.Take().push();
+                duk_put_prop_index(_ctx, /* duk stack index */ -2, index);
+                index++;
+            }
+            return DukValue::take_from_stack(_ctx);
+        }
+
+        DukValue getFrameStats()
+        {
+            const auto summary = FramePacing::GetSummary();
+
+            DukObject missedReasons(_ctx);
+            for (size_t i = 0; i < summary.MissedByPhase.size(); i++)
+            {
+                const auto name = std::string(FramePacing::GetPhaseName(static_cast<FramePacing::Phase>(i)));
+                missedReasons.Set(name.c_str(), summary.MissedByPhase[i]);
+            }
+
+            DukObject obj(_ctx);
+            obj.Set("frames", summary.Frames);
+            obj.Set("meanFrameTime", summary.MeanMs);
+            obj.Set("frameTimeStdDev", summary.StdDevMs);
+            obj.Set("p99FrameTime", summary.P99Ms);
+            obj.Set("maxFrameTime", summary.MaxMs);
+            obj.Set("missedFrames", summary.Missed);
+            obj.Set("missedReasons", missedReasons.Take());
+            obj.Set("inputSamples", summary.InputSamples);
+            obj.Set("meanInputLatency", summary.InputLatencyMeanMs);
+            obj.Set("p95InputLatency", summary.InputLatencyP95Ms);
+            obj.Set("maxInputLatency", summary.InputLatencyMaxMs);
+            return obj.Take();
+        }
+
+        DukValue getPluginStats()
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            duk_push_array(_ctx);
+            duk_uarridx_t index = 0;
+            for (const auto& plugin : scriptEngine.GetPlugins())
+            {
+                const auto& stats = plugin->GetTimeStats();
+                DukObject obj(_ctx);
+                obj.Set("name", plugin->GetMetadata().Name);
+                obj.Set("calls", stats.Calls);
+                obj.Set("skippedCalls", stats.SkippedCalls);
+                obj.Set("totalTime", stats.TotalMs);
+                obj.Set("lastTickTime", stats.LastTickMs);
+                obj.Set("peakTickTime", stats.PeakTickMs);
+                obj.Set("ticks", stats.Ticks);
+                obj.Set("overBudgetTicks", stats.OverBudgetTicks);
+                obj.Take().push();
+                duk_put_prop_index(_ctx, -2, index);
+                index++;
+            }
+            return DukValue::take_from_stack(_ctx);
+        }
+
         void start()
         {
             OpenRCT2::Profiling::Enable();
@@ -93,6 +206,10 @@ namespace OpenRCT2::Scripting
         static void Register(duk_context* ctx)
         {
             dukglue_register_method(ctx, &ScProfiler::getData, "getData");
+            dukglue_register_method(ctx, &ScProfiler::getTickStats, "getTickStats");
+            dukglue_register_method(ctx, &ScProfiler::getMemoryUsage, "getMemoryUsage");
+            dukglue_register_method(ctx, &ScProfiler::getFrameStats, "getFrameStats");
+            dukglue_register_method(ctx, &ScProfiler::getPluginStats, "getPluginStats");
             dukglue_register_method(ctx, &ScProfiler::start, "start");
             dukglue_register_method(ctx, &ScProfiler::stop, "stop");
             dukglue_register_method(ctx, &ScProfiler::reset, "reset");
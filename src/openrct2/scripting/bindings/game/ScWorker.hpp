@@ -0,0 +1,171 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "../../../Context.h"
+#    include "../../Duktape.hpp"
+#    include "../../ScriptEngine.h"
+#    include "../../ScriptWorker.h"
+
+#    include <algorithm>
+#    include <memory>
+#    include <vector>
+
+namespace OpenRCT2::Scripting
+{
+    class ScWorker
+    {
+    private:
+        std::shared_ptr<Plugin> _plugin;
+        std::unique_ptr<ScriptWorker> _worker;
+        std::vector<DukValue> _messageListeners;
+        std::vector<DukValue> _errorListeners;
+
+    public:
+        ScWorker(const std::shared_ptr<Plugin>& plugin, std::string code)
+            : _plugin(plugin)
+            , _worker(std::make_unique<ScriptWorker>(std::move(code)))
+        {
+        }
+
+        const std::shared_ptr<Plugin>& GetPlugin() const
+        {
+            return _plugin;
+        }
+
+        void Update()
+        {
+            if (_worker == nullptr)
+                return;
+
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto ctx = scriptEngine.GetContext();
+            for (const auto& message : _worker->Receive())
+            {
+                switch (message.Type)
+                {
+                    case WorkerMessageType::Message:
+                    {
+                        auto value = DuktapeTryParseJson(ctx, message.Data);
+                        if (value)
+                        {
+                            Raise(_messageListeners, { *value });
+                        }
+                        break;
+                    }
+                    case WorkerMessageType::Error:
+                        if (_errorListeners.empty())
+                        {
+                            scriptEngine.LogPluginInfo(_plugin, "Worker error: " + message.Data);
+                        }
+                        Raise(_errorListeners, { ToDuk(ctx, message.Data) });
+                        break;
+                    case WorkerMessageType::Log:
+                        scriptEngine.LogPluginInfo(_plugin, message.Data);
+                        break;
+                }
+
+                // A listener may have terminated the worker
+                if (_worker == nullptr)
+                    break;
+            }
+        }
+
+        void Dispose()
+        {
+            _worker = nullptr;
+            _messageListeners.clear();
+            _errorListeners.clear();
+        }
+
+        bool IsDisposed() const
+        {
+            return _worker == nullptr;
+        }
+
+    private:
+        void Raise(const std::vector<DukValue>& listeners, const std::vector<DukValue>& args)
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+
+            // Copy the listeners, they may be modified by the callbacks
+            auto callbacks = listeners;
+            for (const auto& callback : callbacks)
+            {
+                scriptEngine.ExecutePluginCall(_plugin, callback, args, false);
+            }
+        }
+
+        std::vector<DukValue>* GetListeners(const std::string& eventType)
+        {
+            if (eventType == "message")
+                return &_messageListeners;
+            if (eventType == "error")
+                return &_errorListeners;
+            return nullptr;
+        }
+
+        void postMessage(const DukValue& message)
+        {
+            if (_worker == nullptr)
+            {
+                duk_error(message.context(), DUK_ERR_ERROR, "Worker has been terminated.");
+            }
+
+            auto ctx = message.context();
+            message.push();
+            auto json = duk_json_encode(ctx, -1);
+            std::string data = json != nullptr ? json : "null";
+            duk_pop(ctx);
+            if (!_worker->Send(std::move(data)))
+            {
+                duk_error(ctx, DUK_ERR_RANGE_ERROR, "Too many messages waiting for the worker.");
+            }
+        }
+
+        ScWorker* on(const std::string& eventType, const DukValue& callback)
+        {
+            auto listeners = GetListeners(eventType);
+            if (listeners != nullptr)
+            {
+                listeners->push_back(callback);
+            }
+            return this;
+        }
+
+        ScWorker* off(const std::string& eventType, const DukValue& callback)
+        {
+            auto listeners = GetListeners(eventType);
+            if (listeners != nullptr)
+            {
+                listeners->erase(std::remove(listeners->begin(), listeners->end(), callback), listeners->end());
+            }
+            return this;
+        }
+
+        void terminate()
+        {
+            Dispose();
+        }
+
+    public:
+        static void Register(duk_context* ctx)
+        {
+            dukglue_register_method(ctx, &ScWorker::postMessage, "postMessage");
+            dukglue_register_method(ctx, &ScWorker::on, "on");
+            dukglue_register_method(ctx, &ScWorker::off, "off");
+            dukglue_register_method(ctx, &ScWorker::terminate, "terminate");
+        }
+    };
+} // namespace OpenRCT2::Scripting
+
+#endif
@@ -137,34 +137,43 @@ namespace OpenRCT2::Scripting
         return nullptr;
     }
 
-    DukValue ScNetwork::stats_get() const
+    static DukValue CountersToDuk(duk_context* ctx, const uint64_t* values, size_t count)
     {
-#    ifndef DISABLE_NETWORK
-        auto obj = OpenRCT2::Scripting::DukObject(_context);
-        auto networkStats = NetworkGetStats();
-        {
-            duk_push_array(_context);
-            duk_uarridx_t index = 0;
-            for (auto v : networkStats.bytesReceived)
-            {
-                duk_push_number(_context, v);
-                duk_put_prop_index(_context, -2, index);
-                index++;
-            }
-            obj.Set("bytesReceived", DukValue::take_from_stack(_context));
-        }
+        duk_push_array(ctx);
+        for (size_t i = 0; i < count; i++)
         {
-            duk_push_array(_context);
-            duk_uarridx_t index = 0;
-            for (auto v : networkStats.bytesSent)
-            {
-                duk_push_number(_context, v);
-                duk_put_prop_index(_context, -2, index);
-                index++;
-            }
-            obj.Set("bytesSent", DukValue::take_from_stack(_context));
+            duk_push_number(ctx, static_cast<duk_double_t>(values[i]));
+            duk_put_prop_index(ctx, -2, static_cast<duk_uarridx_t>(i));
         }
+        return DukValue::take_from_stack(ctx);
+    }
+
+    static DukValue HistogramToDuk(duk_context* ctx, const NetworkHistogram& histogram)
+    {
+        auto obj = OpenRCT2::Scripting::DukObject(ctx);
+        obj.Set("buckets", CountersToDuk(ctx, histogram.buckets.data(), histogram.buckets.size()));
+        obj.Set("count", histogram.count);
+        obj.Set("sum", histogram.sum);
+        obj.Set("max", histogram.max);
+        return obj.Take();
+    }
+
+    DukValue NetworkStatsToDuk(duk_context* ctx, const NetworkStats& stats)
+    {
+        auto obj = OpenRCT2::Scripting::DukObject(ctx);
+        obj.Set("bytesReceived", CountersToDuk(ctx, stats.bytesReceived, std::size(stats.bytesReceived)));
+        obj.Set("bytesSent", CountersToDuk(ctx, stats.bytesSent, std::size(stats.bytesSent)));
+        obj.Set("roundTripTime", HistogramToDuk(ctx, stats.roundTripTime));
+        obj.Set("queueDepth", HistogramToDuk(ctx, stats.queueDepth));
+        obj.Set("bytesPerFlush", HistogramToDuk(ctx, stats.bytesPerFlush));
+        obj.Set("actionLatency", HistogramToDuk(ctx, stats.actionLatency));
         return obj.Take();
+    }
+
+    DukValue ScNetwork::stats_get() const
+    {
+#    ifndef DISABLE_NETWORK
+        return NetworkStatsToDuk(_context, NetworkGetStats());
 #    else
         return ToDuk(_context, nullptr);
 #    endif
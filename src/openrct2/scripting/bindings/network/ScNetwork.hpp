@@ -18,8 +18,12 @@
 
 #    include <memory>
 
+struct NetworkStats;
+
 namespace OpenRCT2::Scripting
 {
+    DukValue NetworkStatsToDuk(duk_context* ctx, const NetworkStats& stats);
+
     class ScNetwork
     {
     private:
@@ -15,6 +15,8 @@
 #    include "../../../actions/PlayerSetGroupAction.h"
 #    include "../../../network/NetworkAction.h"
 #    include "../../../network/network.h"
+#    include "../../ScriptEngine.h"
+#    include "ScNetwork.hpp"
 
 namespace OpenRCT2::Scripting
 {
@@ -105,6 +107,12 @@ namespace OpenRCT2::Scripting
         return NetworkGetPlayerPublicKeyHash(_id);
     }
 
+    DukValue ScPlayer::stats_get() const
+    {
+        auto ctx = GetContext()->GetScriptEngine().GetContext();
+        return NetworkStatsToDuk(ctx, NetworkGetPlayerStats(_id));
+    }
+
     void ScPlayer::Register(duk_context* ctx)
     {
         dukglue_register_property(ctx, &ScPlayer::id_get, nullptr, "id");
@@ -115,6 +123,7 @@ namespace OpenRCT2::Scripting
         dukglue_register_property(ctx, &ScPlayer::moneySpent_get, nullptr, "moneySpent");
         dukglue_register_property(ctx, &ScPlayer::ipAddress_get, nullptr, "ipAddress");
         dukglue_register_property(ctx, &ScPlayer::publicKeyHash_get, nullptr, "publicKeyHash");
+        dukglue_register_property(ctx, &ScPlayer::stats_get, nullptr, "stats");
     }
 
 } // namespace OpenRCT2::Scripting
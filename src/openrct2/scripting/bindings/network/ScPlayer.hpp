@@ -42,6 +42,8 @@ namespace OpenRCT2::Scripting
 
         std::string publicKeyHash_get() const;
 
+        DukValue stats_get() const;
+
         static void Register(duk_context* ctx);
     };
 
@@ -37,6 +37,65 @@
 
 namespace OpenRCT2::Scripting
 {
+    template<typename T> using EntityQueryGetter = int32_t (*)(const T&);
+
+    // Fields of queryEntities, named the same as the properties of the entity objects.
+    template<typename T> static EntityQueryGetter<T> GetEntityQueryField(std::string_view name)
+    {
+        if (name == "id")
+            return [](const T& entity) -> int32_t { return entity.Id.ToUnderlying(); };
+        if (name == "x")
+            return [](const T& entity) -> int32_t { return entity.x; };
+        if (name == "y")
+            return [](const T& entity) -> int32_t { return entity.y; };
+        if (name == "z")
+            return [](const T& entity) -> int32_t { return entity.z; };
+
+        if constexpr (std::is_base_of_v<Peep, T>)
+        {
+            if (name == "energy")
+                return [](const T& peep) -> int32_t { return peep.Energy; };
+            if (name == "energyTarget")
+                return [](const T& peep) -> int32_t { return peep.EnergyTarget; };
+            if (name == "mass")
+                return [](const T& peep) -> int32_t { return peep.Mass; };
+        }
+        if constexpr (std::is_same_v<Guest, T>)
+        {
+            if (name == "happiness")
+                return [](const Guest& guest) -> int32_t { return guest.Happiness; };
+            if (name == "happinessTarget")
+                return [](const Guest& guest) -> int32_t { return guest.HappinessTarget; };
+            if (name == "nausea")
+                return [](const Guest& guest) -> int32_t { return guest.Nausea; };
+            if (name == "nauseaTarget")
+                return [](const Guest& guest) -> int32_t { return guest.NauseaTarget; };
+            if (name == "hunger")
+                return [](const Guest& guest) -> int32_t { return guest.Hunger; };
+            if (name == "thirst")
+                return [](const Guest& guest) -> int32_t { return guest.Thirst; };
+            if (name == "toilet")
+                return [](const Guest& guest) -> int32_t { return guest.Toilet; };
+            if (name == "cash")
+                return [](const Guest& guest) -> int32_t {
+                    return static_cast<int32_t>(std::clamp<money64>(guest.CashInPocket, INT32_MIN, INT32_MAX));
+                };
+        }
+        if constexpr (std::is_same_v<Staff, T>)
+        {
+            if (name == "staffType")
+                return [](const Staff& staff) -> int32_t { return EnumValue(staff.AssignedStaffType); };
+        }
+        if constexpr (std::is_same_v<Vehicle, T>)
+        {
+            if (name == "ride")
+                return [](const Vehicle& car) -> int32_t { return car.ride.IsNull() ? -1 : car.ride.ToUnderlying(); };
+            if (name == "velocity")
+                return [](const Vehicle& car) -> int32_t { return car.velocity; };
+        }
+        return nullptr;
+    }
+
     ScMap::ScMap(duk_context* ctx)
         : _context(ctx)
     {
@@ -85,6 +144,42 @@ namespace OpenRCT2::Scripting
         return std::make_shared<ScTile>(coords);
     }
 
+    void ScMap::forEachTile(const DukValue& range, const DukValue& callback) const
+    {
+        if (!callback.is_function())
+        {
+            duk_error(_context, DUK_ERR_TYPE_ERROR, "Callback must be a function.");
+        }
+
+        const auto mapSize = GetGameState().MapSize;
+        auto area = MapRange(0, 0, (mapSize.x - 1) * COORDS_XY_STEP, (mapSize.y - 1) * COORDS_XY_STEP);
+        if (range.type() == DukValue::Type::OBJECT)
+        {
+            const auto requested = FromDuk<MapRange>(range);
+            area = MapRange(
+                std::max(requested.GetLeft(), area.GetLeft()), std::max(requested.GetTop(), area.GetTop()),
+                std::min(requested.GetRight(), area.GetRight()), std::min(requested.GetBottom(), area.GetBottom()));
+        }
+
+        // The same tile object is passed for every tile, it is only valid during the callback.
+        auto cursor = std::make_shared<ScTile>(CoordsXY{});
+        auto dukCursor = GetObjectAsDukValue(_context, cursor);
+        for (int32_t y = area.GetTop(); y <= area.GetBottom(); y += COORDS_XY_STEP)
+        {
+            for (int32_t x = area.GetLeft(); x <= area.GetRight(); x += COORDS_XY_STEP)
+            {
+                cursor->SetCoords({ x, y });
+                callback.push();
+                dukCursor.push();
+                duk_call(_context, 1);
+                const bool stop = duk_is_boolean(_context, -1) && !duk_get_boolean(_context, -1);
+                duk_pop(_context);
+                if (stop)
+                    return;
+            }
+        }
+    }
+
     DukValue ScMap::getEntity(int32_t id) const
     {
         if (id >= 0 && id < MAX_ENTITIES)
@@ -169,6 +264,67 @@ namespace OpenRCT2::Scripting
         return result;
     }
 
+    template<typename T> DukValue ScMap::QueryEntities(const std::vector<std::string>& fields) const
+    {
+        std::vector<std::pair<std::string_view, EntityQueryGetter<T>>> getters;
+        getters.emplace_back("id", GetEntityQueryField<T>("id"));
+        for (const auto& field : fields)
+        {
+            if (field == "id")
+                continue;
+
+            auto getter = GetEntityQueryField<T>(field);
+            if (getter == nullptr)
+            {
+                duk_error(_context, DUK_ERR_ERROR, "Invalid entity field: %s", field.c_str());
+            }
+            getters.emplace_back(field, getter);
+        }
+
+        std::vector<const T*> entities;
+        entities.reserve(GetEntityListCount(T::cEntityType));
+        for (auto* entity : EntityList<T>())
+        {
+            entities.push_back(entity);
+        }
+
+        // Each field is written straight into its own typed array, no object is created per entity.
+        duk_push_object(_context);
+        duk_push_int(_context, static_cast<duk_int_t>(entities.size()));
+        duk_put_prop_string(_context, -2, "count");
+        for (const auto& [name, getter] : getters)
+        {
+            const auto dataLen = entities.size() * sizeof(int32_t);
+            auto* data = static_cast<int32_t*>(duk_push_fixed_buffer(_context, dataLen));
+            for (size_t i = 0; i < entities.size(); i++)
+            {
+                data[i] = getter(*entities[i]);
+            }
+            duk_push_buffer_object(_context, -1, 0, dataLen, DUK_BUFOBJ_INT32ARRAY);
+            duk_remove(_context, -2);
+            duk_put_prop_lstring(_context, -2, name.data(), name.size());
+        }
+        return DukValue::take_from_stack(_context);
+    }
+
+    DukValue ScMap::queryEntities(const std::string& type, const std::vector<std::string>& fields) const
+    {
+        if (type == "balloon")
+            return QueryEntities<Balloon>(fields);
+        if (type == "car")
+            return QueryEntities<Vehicle>(fields);
+        if (type == "litter")
+            return QueryEntities<Litter>(fields);
+        if (type == "duck")
+            return QueryEntities<Duck>(fields);
+        if (type == "guest")
+            return QueryEntities<Guest>(fields);
+        if (type == "staff")
+            return QueryEntities<Staff>(fields);
+
+        duk_error(_context, DUK_ERR_ERROR, "Invalid entity type: %s", type.c_str());
+    }
+
     std::vector<DukValue> OpenRCT2::Scripting::ScMap::getAllEntitiesOnTile(
         const std::string& type, const DukValue& tilePos) const
     {
@@ -328,9 +484,11 @@ namespace OpenRCT2::Scripting
         dukglue_register_property(ctx, &ScMap::rides_get, nullptr, "rides");
         dukglue_register_method(ctx, &ScMap::getRide, "getRide");
         dukglue_register_method(ctx, &ScMap::getTile, "getTile");
+        dukglue_register_method(ctx, &ScMap::forEachTile, "forEachTile");
         dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
         dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
         dukglue_register_method(ctx, &ScMap::getAllEntitiesOnTile, "getAllEntitiesOnTile");
+        dukglue_register_method(ctx, &ScMap::queryEntities, "queryEntities");
         dukglue_register_method(ctx, &ScMap::createEntity, "createEntity");
         dukglue_register_method(ctx, &ScMap::getTrackIterator, "getTrackIterator");
     }
@@ -39,12 +39,16 @@ namespace OpenRCT2::Scripting
 
         std::shared_ptr<ScTile> getTile(int32_t x, int32_t y) const;
 
+        void forEachTile(const DukValue& range, const DukValue& callback) const;
+
         DukValue getEntity(int32_t id) const;
 
         std::vector<DukValue> getAllEntities(const std::string& type) const;
 
         std::vector<DukValue> getAllEntitiesOnTile(const std::string& type, const DukValue& tilePos) const;
 
+        DukValue queryEntities(const std::string& type, const std::vector<std::string>& fields) const;
+
         DukValue createEntity(const std::string& type, const DukValue& initializer);
 
         DukValue getTrackIterator(const DukValue& position, int32_t elementIndex) const;
@@ -53,6 +57,8 @@ namespace OpenRCT2::Scripting
 
     private:
         DukValue GetEntityAsDukValue(const EntityBase* sprite) const;
+
+        template<typename T> DukValue QueryEntities(const std::vector<std::string>& fields) const;
     };
 
 } // namespace OpenRCT2::Scripting
@@ -34,6 +34,11 @@ namespace OpenRCT2::Scripting
     {
     }
 
+    void ScTile::SetCoords(const CoordsXY& coords)
+    {
+        _coords = coords;
+    }
+
     int32_t ScTile::x_get() const
     {
         return _coords.x / COORDS_XY_STEP;
@@ -60,7 +65,7 @@ namespace OpenRCT2::Scripting
             result.reserve(currentNumElements);
             for (size_t i = 0; i < currentNumElements; i++)
             {
-                result.push_back(std::make_shared<ScTileElement>(_coords, &first[i]));
+                result.push_back(std::make_shared<ScTileElement>(_coords, i));
             }
         }
         return result;
@@ -96,6 +101,12 @@ namespace OpenRCT2::Scripting
             }
             else
             {
+                // Tiles outside of the map share one surface element, writing to it would change all of them
+                if (!MapUnshareSurfaceAt(_coords))
+                {
+                    duk_error(ctx, DUK_ERR_ERROR, "Unable to allocate element.");
+                }
+
                 auto first = GetFirstElement();
                 auto currentNumElements = GetNumElements(first);
                 if (numElements > currentNumElements)
@@ -125,6 +136,7 @@ namespace OpenRCT2::Scripting
                     first[numElements - 1].SetLastForTile(true);
                 }
             }
+            MapRefreshTileElementTypes(TileCoordsXY(_coords));
             MapInvalidateTileFull(_coords);
         }
     }
@@ -134,7 +146,7 @@ namespace OpenRCT2::Scripting
         auto first = GetFirstElement();
         if (static_cast<size_t>(index) < GetNumElements(first))
         {
-            return std::make_shared<ScTileElement>(_coords, &first[index]);
+            return std::make_shared<ScTileElement>(_coords, index);
         }
         return {};
     }
@@ -178,7 +190,7 @@ namespace OpenRCT2::Scripting
                 }
                 first[origNumElements].SetLastForTile(true);
                 MapInvalidateTileFull(_coords);
-                result = std::make_shared<ScTileElement>(_coords, &first[index]);
+                result = std::make_shared<ScTileElement>(_coords, index);
             }
         }
         else
@@ -192,6 +204,12 @@ namespace OpenRCT2::Scripting
     void ScTile::removeElement(uint32_t index)
     {
         ThrowIfGameStateNotMutable();
+        if (!MapUnshareSurfaceAt(_coords))
+        {
+            auto ctx = GetDukContext();
+            duk_error(ctx, DUK_ERR_ERROR, "Unable to allocate element.");
+        }
+
         auto first = GetFirstElement();
         if (index < GetNumElements(first))
         {
@@ -200,6 +218,36 @@ namespace OpenRCT2::Scripting
         }
     }
 
+    void ScTile::forEachElement(const DukValue& callback) const
+    {
+        auto ctx = GetDukContext();
+        if (!callback.is_function())
+        {
+            duk_error(ctx, DUK_ERR_TYPE_ERROR, "Callback must be a function.");
+        }
+
+        // The same element object is passed for every element, it is only valid during the callback.
+        auto cursor = std::make_shared<ScTileElement>(_coords, 0);
+        auto dukCursor = GetObjectAsDukValue(ctx, cursor);
+        for (size_t i = 0;; i++)
+        {
+            // The callback can insert or remove elements, which moves the elements of the tile
+            auto first = GetFirstElement();
+            if (i >= GetNumElements(first))
+                break;
+
+            cursor->SetElement(_coords, i);
+            callback.push();
+            dukCursor.push();
+            duk_push_uint(ctx, static_cast<duk_uint_t>(i));
+            duk_call(ctx, 2);
+            const bool stop = duk_is_boolean(ctx, -1) && !duk_get_boolean(ctx, -1);
+            duk_pop(ctx);
+            if (stop)
+                break;
+        }
+    }
+
     TileElement* ScTile::GetFirstElement() const
     {
         return MapGetFirstElementAt(_coords);
@@ -236,6 +284,7 @@ namespace OpenRCT2::Scripting
         dukglue_register_method(ctx, &ScTile::getElement, "getElement");
         dukglue_register_method(ctx, &ScTile::insertElement, "insertElement");
         dukglue_register_method(ctx, &ScTile::removeElement, "removeElement");
+        dukglue_register_method(ctx, &ScTile::forEachElement, "forEachElement");
     }
 
 } // namespace OpenRCT2::Scripting
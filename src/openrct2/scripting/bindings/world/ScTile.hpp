@@ -31,6 +31,9 @@ namespace OpenRCT2::Scripting
     public:
         ScTile(const CoordsXY& coords);
 
+        // Points the object at another tile so one object can be reused while iterating.
+        void SetCoords(const CoordsXY& coords);
+
     private:
         int32_t x_get() const;
 
@@ -48,6 +51,8 @@ namespace OpenRCT2::Scripting
 
         void removeElement(uint32_t index);
 
+        void forEachElement(const DukValue& callback) const;
+
         TileElement* GetFirstElement() const;
 
         static size_t GetNumElements(const TileElement* first);
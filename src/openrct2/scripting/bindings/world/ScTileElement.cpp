@@ -30,15 +30,51 @@
 
 namespace OpenRCT2::Scripting
 {
-    ScTileElement::ScTileElement(const CoordsXY& coords, TileElement* element)
+    ScTileElement::ScTileElement(const CoordsXY& coords, size_t index)
         : _coords(coords)
-        , _element(element)
+        , _index(index)
     {
     }
 
+    void ScTileElement::SetElement(const CoordsXY& coords, size_t index)
+    {
+        _coords = coords;
+        _index = index;
+    }
+
+    TileElement* ScTileElement::GetElement() const
+    {
+        // Inserting on any tile of the same chunk moves the elements, so no pointer is kept between calls
+        auto* element = MapGetFirstElementAt(_coords);
+        for (size_t i = 0; element != nullptr && i < _index; i++)
+        {
+            element = element->IsLastForTile() ? nullptr : element + 1;
+        }
+        if (element == nullptr)
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto* ctx = scriptEngine.GetContext();
+            duk_error(ctx, DUK_ERR_ERROR, "Tile element no longer exists.");
+        }
+        return element;
+    }
+
+    void ScTileElement::PrepareElementForWrite()
+    {
+        ThrowIfGameStateNotMutable();
+
+        // Tiles outside of the map share one surface element, writing to it would change all of them
+        if (!MapUnshareSurfaceAt(_coords))
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto* ctx = scriptEngine.GetContext();
+            duk_error(ctx, DUK_ERR_ERROR, "Unable to allocate element.");
+        }
+    }
+
     std::string ScTileElement::type_get() const
     {
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::Surface:
                 return "surface";
@@ -63,22 +99,23 @@ namespace OpenRCT2::Scripting
 
     void ScTileElement::type_set(std::string value)
     {
+        PrepareElementForWrite();
         if (value == "surface")
-            _element->SetType(TileElementType::Surface);
+            GetElement()->SetType(TileElementType::Surface);
         else if (value == "footpath")
-            _element->SetType(TileElementType::Path);
+            GetElement()->SetType(TileElementType::Path);
         else if (value == "track")
-            _element->SetType(TileElementType::Track);
+            GetElement()->SetType(TileElementType::Track);
         else if (value == "small_scenery")
-            _element->SetType(TileElementType::SmallScenery);
+            GetElement()->SetType(TileElementType::SmallScenery);
         else if (value == "entrance")
-            _element->SetType(TileElementType::Entrance);
+            GetElement()->SetType(TileElementType::Entrance);
         else if (value == "wall")
-            _element->SetType(TileElementType::Wall);
+            GetElement()->SetType(TileElementType::Wall);
         else if (value == "large_scenery")
-            _element->SetType(TileElementType::LargeScenery);
+            GetElement()->SetType(TileElementType::LargeScenery);
         else if (value == "banner")
-            _element->SetType(TileElementType::Banner);
+            GetElement()->SetType(TileElementType::Banner);
         else
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
@@ -86,50 +123,51 @@ namespace OpenRCT2::Scripting
             return;
         }
 
+        MapRefreshTileElementTypes(TileCoordsXY{ _coords });
         Invalidate();
     }
 
     uint8_t ScTileElement::baseHeight_get() const
     {
-        return _element->BaseHeight;
+        return GetElement()->BaseHeight;
     }
     void ScTileElement::baseHeight_set(uint8_t newBaseHeight)
     {
-        ThrowIfGameStateNotMutable();
-        _element->BaseHeight = newBaseHeight;
+        PrepareElementForWrite();
+        GetElement()->BaseHeight = newBaseHeight;
         Invalidate();
     }
 
     uint16_t ScTileElement::baseZ_get() const
     {
-        return _element->GetBaseZ();
+        return GetElement()->GetBaseZ();
     }
     void ScTileElement::baseZ_set(uint16_t value)
     {
-        ThrowIfGameStateNotMutable();
-        _element->SetBaseZ(value);
+        PrepareElementForWrite();
+        GetElement()->SetBaseZ(value);
         Invalidate();
     }
 
     uint8_t ScTileElement::clearanceHeight_get() const
     {
-        return _element->ClearanceHeight;
+        return GetElement()->ClearanceHeight;
     }
     void ScTileElement::clearanceHeight_set(uint8_t newClearanceHeight)
     {
-        ThrowIfGameStateNotMutable();
-        _element->ClearanceHeight = newClearanceHeight;
+        PrepareElementForWrite();
+        GetElement()->ClearanceHeight = newClearanceHeight;
         Invalidate();
     }
 
     uint16_t ScTileElement::clearanceZ_get() const
     {
-        return _element->GetClearanceZ();
+        return GetElement()->GetClearanceZ();
     }
     void ScTileElement::clearanceZ_set(uint16_t value)
     {
-        ThrowIfGameStateNotMutable();
-        _element->SetClearanceZ(value);
+        PrepareElementForWrite();
+        GetElement()->SetClearanceZ(value);
         Invalidate();
     }
 
@@ -137,17 +175,17 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::Surface:
             {
-                auto* el = _element->AsSurface();
+                auto* el = GetElement()->AsSurface();
                 duk_push_int(ctx, el->GetSlope());
                 break;
             }
             case TileElementType::Wall:
             {
-                auto* el = _element->AsWall();
+                auto* el = GetElement()->AsWall();
                 duk_push_int(ctx, el->GetSlope());
                 break;
             }
@@ -163,18 +201,18 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::slope_set(uint8_t value)
     {
-        ThrowIfGameStateNotMutable();
-        const auto type = _element->GetType();
+        PrepareElementForWrite();
+        const auto type = GetElement()->GetType();
 
         if (type == TileElementType::Surface)
         {
-            auto* el = _element->AsSurface();
+            auto* el = GetElement()->AsSurface();
             el->SetSlope(value);
             Invalidate();
         }
         else if (type == TileElementType::Wall)
         {
-            auto* el = _element->AsWall();
+            auto* el = GetElement()->AsWall();
             el->SetSlope(value);
             Invalidate();
         }
@@ -189,7 +227,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsSurface();
+        auto* el = GetElement()->AsSurface();
         if (el != nullptr)
         {
             duk_push_int(ctx, el->GetWaterHeight());
@@ -203,8 +241,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::waterHeight_set(int32_t value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsSurface();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsSurface();
         if (el == nullptr)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
@@ -220,7 +258,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsSurface();
+        auto* el = GetElement()->AsSurface();
         if (el != nullptr)
         {
             duk_push_int(ctx, el->GetSurfaceObjectIndex());
@@ -234,8 +272,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::surfaceStyle_set(uint32_t value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsSurface();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsSurface();
         if (el == nullptr)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
@@ -251,7 +289,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsSurface();
+        auto* el = GetElement()->AsSurface();
         if (el != nullptr)
         {
             duk_push_int(ctx, el->GetEdgeObjectIndex());
@@ -265,8 +303,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::edgeStyle_set(uint32_t value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsSurface();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsSurface();
         if (el == nullptr)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
@@ -282,7 +320,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsSurface();
+        auto* el = GetElement()->AsSurface();
         if (el != nullptr)
         {
             duk_push_int(ctx, el->GetGrassLength());
@@ -296,8 +334,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::grassLength_set(uint8_t value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsSurface();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsSurface();
         if (el == nullptr)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
@@ -314,7 +352,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsSurface();
+        auto* el = GetElement()->AsSurface();
         if (el != nullptr)
         {
             duk_push_boolean(ctx, el->GetOwnership() & OWNERSHIP_OWNED);
@@ -331,7 +369,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsSurface();
+        auto* el = GetElement()->AsSurface();
         if (el != nullptr)
         {
             auto ownership = el->GetOwnership();
@@ -349,7 +387,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsSurface();
+        auto* el = GetElement()->AsSurface();
         if (el != nullptr)
         {
             duk_push_int(ctx, el->GetOwnership());
@@ -363,8 +401,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::ownership_set(uint8_t value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsSurface();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsSurface();
         if (el == nullptr)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
@@ -380,7 +418,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsSurface();
+        auto* el = GetElement()->AsSurface();
         if (el != nullptr)
         {
             duk_push_int(ctx, el->GetParkFences());
@@ -394,8 +432,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::parkFences_set(uint8_t value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsSurface();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsSurface();
         if (el == nullptr)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
@@ -411,7 +449,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsTrack();
+        auto* el = GetElement()->AsTrack();
         if (el != nullptr)
         {
             duk_push_int(ctx, el->GetTrackType());
@@ -425,8 +463,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::trackType_set(uint16_t value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsTrack();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsTrack();
         if (el == nullptr)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
@@ -442,7 +480,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsTrack();
+        auto* el = GetElement()->AsTrack();
         if (el != nullptr)
         {
             duk_push_int(ctx, el->GetRideType());
@@ -456,14 +494,14 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::rideType_set(uint16_t value)
     {
-        ThrowIfGameStateNotMutable();
+        PrepareElementForWrite();
 
         try
         {
             if (value >= RIDE_TYPE_COUNT)
                 throw DukException() << "'rideType' value is invalid.";
 
-            auto* el = _element->AsTrack();
+            auto* el = GetElement()->AsTrack();
             if (el == nullptr)
                 throw DukException() << "Cannot set 'rideType' property, tile element is not a TrackElement.";
 
@@ -483,17 +521,17 @@ namespace OpenRCT2::Scripting
         auto* ctx = scriptEngine.GetContext();
         try
         {
-            switch (_element->GetType())
+            switch (GetElement()->GetType())
             {
                 case TileElementType::LargeScenery:
                 {
-                    auto* el = _element->AsLargeScenery();
+                    auto* el = GetElement()->AsLargeScenery();
                     duk_push_int(ctx, el->GetSequenceIndex());
                     break;
                 }
                 case TileElementType::Track:
                 {
-                    auto* el = _element->AsTrack();
+                    auto* el = GetElement()->AsTrack();
                     auto* ride = GetRide(el->GetRideIndex());
 
                     if (ride != nullptr)
@@ -508,7 +546,7 @@ namespace OpenRCT2::Scripting
                 }
                 case TileElementType::Entrance:
                 {
-                    auto* el = _element->AsEntrance();
+                    auto* el = GetElement()->AsEntrance();
                     duk_push_int(ctx, el->GetSequenceIndex());
                     break;
                 }
@@ -526,25 +564,25 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::sequence_set(const DukValue& value)
     {
-        ThrowIfGameStateNotMutable();
+        PrepareElementForWrite();
 
         try
         {
             if (value.type() != DukValue::Type::NUMBER)
                 throw DukException() << "'sequence' must be a number.";
 
-            switch (_element->GetType())
+            switch (GetElement()->GetType())
             {
                 case TileElementType::LargeScenery:
                 {
-                    auto* el = _element->AsLargeScenery();
+                    auto* el = GetElement()->AsLargeScenery();
                     el->SetSequenceIndex(value.as_uint());
                     Invalidate();
                     break;
                 }
                 case TileElementType::Track:
                 {
-                    auto* el = _element->AsTrack();
+                    auto* el = GetElement()->AsTrack();
                     auto ride = GetRide(el->GetRideIndex());
 
                     if (ride != nullptr)
@@ -560,7 +598,7 @@ namespace OpenRCT2::Scripting
                 }
                 case TileElementType::Entrance:
                 {
-                    auto* el = _element->AsEntrance();
+                    auto* el = GetElement()->AsEntrance();
                     el->SetSequenceIndex(value.as_uint());
                     Invalidate();
                     break;
@@ -583,11 +621,11 @@ namespace OpenRCT2::Scripting
         auto* ctx = scriptEngine.GetContext();
         try
         {
-            switch (_element->GetType())
+            switch (GetElement()->GetType())
             {
                 case TileElementType::Path:
                 {
-                    auto* el = _element->AsPath();
+                    auto* el = GetElement()->AsPath();
                     if (!el->IsQueue())
                         throw DukException() << "Cannot read 'ride' property, path is not a queue.";
 
@@ -599,13 +637,13 @@ namespace OpenRCT2::Scripting
                 }
                 case TileElementType::Track:
                 {
-                    auto* el = _element->AsTrack();
+                    auto* el = GetElement()->AsTrack();
                     duk_push_int(ctx, el->GetRideIndex().ToUnderlying());
                     break;
                 }
                 case TileElementType::Entrance:
                 {
-                    auto* el = _element->AsEntrance();
+                    auto* el = GetElement()->AsEntrance();
                     duk_push_int(ctx, el->GetRideIndex().ToUnderlying());
                     break;
                 }
@@ -623,15 +661,15 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::ride_set(const DukValue& value)
     {
-        ThrowIfGameStateNotMutable();
+        PrepareElementForWrite();
 
         try
         {
-            switch (_element->GetType())
+            switch (GetElement()->GetType())
             {
                 case TileElementType::Path:
                 {
-                    auto* el = _element->AsPath();
+                    auto* el = GetElement()->AsPath();
                     if (!el->IsQueue())
                         throw DukException() << "Cannot set ride property, path is not a queue.";
 
@@ -649,7 +687,7 @@ namespace OpenRCT2::Scripting
                     if (value.type() != DukValue::Type::NUMBER)
                         throw DukException() << "'ride' must be a number.";
 
-                    auto* el = _element->AsTrack();
+                    auto* el = GetElement()->AsTrack();
                     el->SetRideIndex(RideId::FromUnderlying(value.as_uint()));
                     Invalidate();
                     break;
@@ -659,7 +697,7 @@ namespace OpenRCT2::Scripting
                     if (value.type() != DukValue::Type::NUMBER)
                         throw DukException() << "'ride' must be a number.";
 
-                    auto* el = _element->AsEntrance();
+                    auto* el = GetElement()->AsEntrance();
                     el->SetRideIndex(RideId::FromUnderlying(value.as_uint()));
                     Invalidate();
                     break;
@@ -682,11 +720,11 @@ namespace OpenRCT2::Scripting
         auto* ctx = scriptEngine.GetContext();
         try
         {
-            switch (_element->GetType())
+            switch (GetElement()->GetType())
             {
                 case TileElementType::Path:
                 {
-                    auto* el = _element->AsPath();
+                    auto* el = GetElement()->AsPath();
                     if (!el->IsQueue())
                         throw DukException() << "Cannot read 'station' property, path is not a queue.";
 
@@ -701,7 +739,7 @@ namespace OpenRCT2::Scripting
                 }
                 case TileElementType::Track:
                 {
-                    auto* el = _element->AsTrack();
+                    auto* el = GetElement()->AsTrack();
                     if (!el->IsStation())
                         throw DukException() << "Cannot read 'station' property, track is not a station.";
 
@@ -710,7 +748,7 @@ namespace OpenRCT2::Scripting
                 }
                 case TileElementType::Entrance:
                 {
-                    auto* el = _element->AsEntrance();
+                    auto* el = GetElement()->AsEntrance();
                     duk_push_int(ctx, el->GetStationIndex().ToUnderlying());
                     break;
                 }
@@ -728,15 +766,15 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::station_set(const DukValue& value)
     {
-        ThrowIfGameStateNotMutable();
+        PrepareElementForWrite();
 
         try
         {
-            switch (_element->GetType())
+            switch (GetElement()->GetType())
             {
                 case TileElementType::Path:
                 {
-                    auto* el = _element->AsPath();
+                    auto* el = GetElement()->AsPath();
                     if (value.type() == DukValue::Type::NUMBER)
                         el->SetStationIndex(StationIndex::FromUnderlying(value.as_uint()));
                     else if (value.type() == DukValue::Type::NULLREF)
@@ -751,7 +789,7 @@ namespace OpenRCT2::Scripting
                     if (value.type() != DukValue::Type::NUMBER)
                         throw DukException() << "'station' must be a number.";
 
-                    auto* el = _element->AsTrack();
+                    auto* el = GetElement()->AsTrack();
                     el->SetStationIndex(StationIndex::FromUnderlying(value.as_uint()));
                     Invalidate();
                     break;
@@ -761,7 +799,7 @@ namespace OpenRCT2::Scripting
                     if (value.type() != DukValue::Type::NUMBER)
                         throw DukException() << "'station' must be a number.";
 
-                    auto* el = _element->AsEntrance();
+                    auto* el = GetElement()->AsEntrance();
                     el->SetStationIndex(StationIndex::FromUnderlying(value.as_uint()));
                     Invalidate();
                     break;
@@ -781,7 +819,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsTrack();
+        auto* el = GetElement()->AsTrack();
         if (el != nullptr)
         {
             duk_push_boolean(ctx, el->HasChain());
@@ -795,8 +833,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::hasChainLift_set(bool value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsTrack();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsTrack();
         if (el == nullptr)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
@@ -814,7 +852,7 @@ namespace OpenRCT2::Scripting
         auto* ctx = scriptEngine.GetContext();
         try
         {
-            auto* el = _element->AsTrack();
+            auto* el = GetElement()->AsTrack();
             if (el == nullptr)
                 throw DukException() << "Cannot read 'mazeEntry' property, element is not a TrackElement.";
 
@@ -837,14 +875,14 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::mazeEntry_set(const DukValue& value)
     {
-        ThrowIfGameStateNotMutable();
+        PrepareElementForWrite();
 
         try
         {
             if (value.type() != DukValue::Type::NUMBER)
                 throw DukException() << "'mazeEntry' property must be a number.";
 
-            auto* el = _element->AsTrack();
+            auto* el = GetElement()->AsTrack();
             if (el == nullptr)
                 throw DukException() << "Cannot set 'mazeEntry' property, tile element is not a TrackElement.";
 
@@ -872,7 +910,7 @@ namespace OpenRCT2::Scripting
         auto* ctx = scriptEngine.GetContext();
         try
         {
-            auto* el = _element->AsTrack();
+            auto* el = GetElement()->AsTrack();
             if (el == nullptr)
                 throw DukException() << "Cannot read 'colourScheme' property, tile element is not a TrackElement.";
 
@@ -895,14 +933,14 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::colourScheme_set(const DukValue& value)
     {
-        ThrowIfGameStateNotMutable();
+        PrepareElementForWrite();
 
         try
         {
             if (value.type() != DukValue::Type::NUMBER)
                 throw DukException() << "'colourScheme' must be a number.";
 
-            auto* el = _element->AsTrack();
+            auto* el = GetElement()->AsTrack();
             if (el == nullptr)
                 throw DukException() << "Cannot set 'colourScheme' property, tile element is not a TrackElement.";
 
@@ -930,7 +968,7 @@ namespace OpenRCT2::Scripting
         auto* ctx = scriptEngine.GetContext();
         try
         {
-            auto* el = _element->AsTrack();
+            auto* el = GetElement()->AsTrack();
             if (el == nullptr)
                 throw DukException() << "Cannot read 'seatRotation' property, tile element is not a TrackElement.";
 
@@ -953,14 +991,14 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::seatRotation_set(const DukValue& value)
     {
-        ThrowIfGameStateNotMutable();
+        PrepareElementForWrite();
 
         try
         {
             if (value.type() != DukValue::Type::NUMBER)
                 throw DukException() << "'seatRotation' must be a number.";
 
-            auto* el = _element->AsTrack();
+            auto* el = GetElement()->AsTrack();
             if (el == nullptr)
                 throw DukException() << "Cannot set 'seatRotation' property, tile element is not a TrackElement.";
 
@@ -988,7 +1026,7 @@ namespace OpenRCT2::Scripting
         auto* ctx = scriptEngine.GetContext();
         try
         {
-            auto* el = _element->AsTrack();
+            auto* el = GetElement()->AsTrack();
             if (el == nullptr)
                 throw DukException() << "Cannot read 'brakeBoosterSpeed' property, tile element is not a TrackElement.";
 
@@ -1006,14 +1044,14 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::brakeBoosterSpeed_set(const DukValue& value)
     {
-        ThrowIfGameStateNotMutable();
+        PrepareElementForWrite();
 
         try
         {
             if (value.type() != DukValue::Type::NUMBER)
                 throw DukException() << "'brakeBoosterSpeed' must be a number.";
 
-            auto* el = _element->AsTrack();
+            auto* el = GetElement()->AsTrack();
             if (el == nullptr)
                 throw DukException() << "Cannot set 'brakeBoosterSpeed' property, tile element is not a TrackElement.";
 
@@ -1034,7 +1072,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsTrack();
+        auto* el = GetElement()->AsTrack();
         if (el != nullptr)
         {
             duk_push_boolean(ctx, el->IsInverted());
@@ -1048,8 +1086,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::isInverted_set(bool value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsTrack();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsTrack();
         if (el == nullptr)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
@@ -1065,7 +1103,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsTrack();
+        auto* el = GetElement()->AsTrack();
         if (el != nullptr)
         {
             duk_push_boolean(ctx, el->HasCableLift());
@@ -1079,8 +1117,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::hasCableLift_set(bool value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsTrack();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsTrack();
         if (el == nullptr)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
@@ -1095,7 +1133,7 @@ namespace OpenRCT2::Scripting
     DukValue ScTileElement::isHighlighted_get() const
     {
         auto ctx = GetContext()->GetScriptEngine().GetContext();
-        auto el = _element->AsTrack();
+        auto el = GetElement()->AsTrack();
         if (el != nullptr)
             duk_push_boolean(ctx, el->IsHighlighted());
         else
@@ -1104,8 +1142,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::isHighlighted_set(bool value)
     {
-        ThrowIfGameStateNotMutable();
-        auto el = _element->AsTrack();
+        PrepareElementForWrite();
+        auto el = GetElement()->AsTrack();
         if (el != nullptr)
         {
             el->SetHighlight(value);
@@ -1117,11 +1155,11 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::Path:
             {
-                auto* el = _element->AsPath();
+                auto* el = GetElement()->AsPath();
                 auto index = el->GetLegacyPathEntryIndex();
                 if (index != OBJECT_ENTRY_INDEX_NULL)
                     duk_push_int(ctx, index);
@@ -1131,31 +1169,31 @@ namespace OpenRCT2::Scripting
             }
             case TileElementType::SmallScenery:
             {
-                auto* el = _element->AsSmallScenery();
+                auto* el = GetElement()->AsSmallScenery();
                 duk_push_int(ctx, el->GetEntryIndex());
                 break;
             }
             case TileElementType::LargeScenery:
             {
-                auto* el = _element->AsLargeScenery();
+                auto* el = GetElement()->AsLargeScenery();
                 duk_push_int(ctx, el->GetEntryIndex());
                 break;
             }
             case TileElementType::Wall:
             {
-                auto* el = _element->AsWall();
+                auto* el = GetElement()->AsWall();
                 duk_push_int(ctx, el->GetEntryIndex());
                 break;
             }
             case TileElementType::Entrance:
             {
-                auto* el = _element->AsEntrance();
+                auto* el = GetElement()->AsEntrance();
                 duk_push_int(ctx, el->GetEntranceType());
                 break;
             }
             case TileElementType::Banner:
             {
-                auto* el = _element->AsBanner();
+                auto* el = GetElement()->AsBanner();
                 duk_push_int(ctx, el->GetBanner()->type);
                 break;
             }
@@ -1170,16 +1208,16 @@ namespace OpenRCT2::Scripting
 
     void ScTileElement::object_set(const DukValue& value)
     {
-        ThrowIfGameStateNotMutable();
+        PrepareElementForWrite();
 
         auto index = FromDuk<ObjectEntryIndex>(value);
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::Path:
             {
                 if (value.type() == DukValue::Type::NUMBER)
                 {
-                    auto* el = _element->AsPath();
+                    auto* el = GetElement()->AsPath();
                     el->SetLegacyPathEntryIndex(index);
                     Invalidate();
                 }
@@ -1187,35 +1225,35 @@ namespace OpenRCT2::Scripting
             }
             case TileElementType::SmallScenery:
             {
-                auto* el = _element->AsSmallScenery();
+                auto* el = GetElement()->AsSmallScenery();
                 el->SetEntryIndex(index);
                 Invalidate();
                 break;
             }
             case TileElementType::LargeScenery:
             {
-                auto* el = _element->AsLargeScenery();
+                auto* el = GetElement()->AsLargeScenery();
                 el->SetEntryIndex(index);
                 Invalidate();
                 break;
             }
             case TileElementType::Wall:
             {
-                auto* el = _element->AsWall();
+                auto* el = GetElement()->AsWall();
                 el->SetEntryIndex(index);
                 Invalidate();
                 break;
             }
             case TileElementType::Entrance:
             {
-                auto* el = _element->AsEntrance();
+                auto* el = GetElement()->AsEntrance();
                 el->SetEntranceType(index);
                 Invalidate();
                 break;
             }
             case TileElementType::Banner:
             {
-                auto* el = _element->AsBanner();
+                auto* el = GetElement()->AsBanner();
                 el->GetBanner()->type = index;
                 Invalidate();
                 break;
@@ -1227,13 +1265,13 @@ namespace OpenRCT2::Scripting
 
     bool ScTileElement::isHidden_get() const
     {
-        return _element->IsInvisible();
+        return GetElement()->IsInvisible();
     }
 
     void ScTileElement::isHidden_set(bool hide)
     {
-        ThrowIfGameStateNotMutable();
-        _element->SetInvisible(hide);
+        PrepareElementForWrite();
+        GetElement()->SetInvisible(hide);
         Invalidate();
     }
 
@@ -1241,7 +1279,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsSmallScenery();
+        auto* el = GetElement()->AsSmallScenery();
         if (el != nullptr)
             duk_push_int(ctx, el->GetAge());
         else
@@ -1250,8 +1288,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::age_set(uint8_t value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsSmallScenery();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsSmallScenery();
         if (el != nullptr)
         {
             el->SetAge(value);
@@ -1263,7 +1301,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsSmallScenery();
+        auto* el = GetElement()->AsSmallScenery();
         if (el != nullptr)
             duk_push_int(ctx, el->GetSceneryQuadrant());
         else
@@ -1272,8 +1310,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::quadrant_set(uint8_t value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsSmallScenery();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsSmallScenery();
         if (el != nullptr)
         {
             el->SetSceneryQuadrant(value);
@@ -1283,23 +1321,23 @@ namespace OpenRCT2::Scripting
 
     uint8_t ScTileElement::occupiedQuadrants_get() const
     {
-        return _element->GetOccupiedQuadrants();
+        return GetElement()->GetOccupiedQuadrants();
     }
     void ScTileElement::occupiedQuadrants_set(uint8_t value)
     {
-        ThrowIfGameStateNotMutable();
-        _element->SetOccupiedQuadrants(value);
+        PrepareElementForWrite();
+        GetElement()->SetOccupiedQuadrants(value);
         Invalidate();
     }
 
     bool ScTileElement::isGhost_get() const
     {
-        return _element->IsGhost();
+        return GetElement()->IsGhost();
     }
     void ScTileElement::isGhost_set(bool value)
     {
-        ThrowIfGameStateNotMutable();
-        _element->SetGhost(value);
+        PrepareElementForWrite();
+        GetElement()->SetGhost(value);
         Invalidate();
     }
 
@@ -1307,29 +1345,29 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::SmallScenery:
             {
-                auto* el = _element->AsSmallScenery();
+                auto* el = GetElement()->AsSmallScenery();
                 duk_push_int(ctx, el->GetPrimaryColour());
                 break;
             }
             case TileElementType::LargeScenery:
             {
-                auto* el = _element->AsLargeScenery();
+                auto* el = GetElement()->AsLargeScenery();
                 duk_push_int(ctx, el->GetPrimaryColour());
                 break;
             }
             case TileElementType::Wall:
             {
-                auto* el = _element->AsWall();
+                auto* el = GetElement()->AsWall();
                 duk_push_int(ctx, el->GetPrimaryColour());
                 break;
             }
             case TileElementType::Banner:
             {
-                auto* el = _element->AsBanner();
+                auto* el = GetElement()->AsBanner();
                 duk_push_int(ctx, el->GetBanner()->colour);
                 break;
             }
@@ -1343,33 +1381,33 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::primaryColour_set(uint8_t value)
     {
-        ThrowIfGameStateNotMutable();
-        switch (_element->GetType())
+        PrepareElementForWrite();
+        switch (GetElement()->GetType())
         {
             case TileElementType::SmallScenery:
             {
-                auto* el = _element->AsSmallScenery();
+                auto* el = GetElement()->AsSmallScenery();
                 el->SetPrimaryColour(value);
                 Invalidate();
                 break;
             }
             case TileElementType::LargeScenery:
             {
-                auto* el = _element->AsLargeScenery();
+                auto* el = GetElement()->AsLargeScenery();
                 el->SetPrimaryColour(value);
                 Invalidate();
                 break;
             }
             case TileElementType::Wall:
             {
-                auto* el = _element->AsWall();
+                auto* el = GetElement()->AsWall();
                 el->SetPrimaryColour(value);
                 Invalidate();
                 break;
             }
             case TileElementType::Banner:
             {
-                auto* el = _element->AsBanner();
+                auto* el = GetElement()->AsBanner();
                 el->GetBanner()->colour = value;
                 Invalidate();
                 break;
@@ -1383,29 +1421,29 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::SmallScenery:
             {
-                auto* el = _element->AsSmallScenery();
+                auto* el = GetElement()->AsSmallScenery();
                 duk_push_int(ctx, el->GetSecondaryColour());
                 break;
             }
             case TileElementType::LargeScenery:
             {
-                auto* el = _element->AsLargeScenery();
+                auto* el = GetElement()->AsLargeScenery();
                 duk_push_int(ctx, el->GetSecondaryColour());
                 break;
             }
             case TileElementType::Wall:
             {
-                auto* el = _element->AsWall();
+                auto* el = GetElement()->AsWall();
                 duk_push_int(ctx, el->GetSecondaryColour());
                 break;
             }
             case TileElementType::Banner:
             {
-                auto* el = _element->AsBanner();
+                auto* el = GetElement()->AsBanner();
                 duk_push_int(ctx, el->GetBanner()->text_colour);
                 break;
             }
@@ -1419,33 +1457,33 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::secondaryColour_set(uint8_t value)
     {
-        ThrowIfGameStateNotMutable();
-        switch (_element->GetType())
+        PrepareElementForWrite();
+        switch (GetElement()->GetType())
         {
             case TileElementType::SmallScenery:
             {
-                auto* el = _element->AsSmallScenery();
+                auto* el = GetElement()->AsSmallScenery();
                 el->SetSecondaryColour(value);
                 Invalidate();
                 break;
             }
             case TileElementType::LargeScenery:
             {
-                auto* el = _element->AsLargeScenery();
+                auto* el = GetElement()->AsLargeScenery();
                 el->SetSecondaryColour(value);
                 Invalidate();
                 break;
             }
             case TileElementType::Wall:
             {
-                auto* el = _element->AsWall();
+                auto* el = GetElement()->AsWall();
                 el->SetSecondaryColour(value);
                 Invalidate();
                 break;
             }
             case TileElementType::Banner:
             {
-                auto* el = _element->AsBanner();
+                auto* el = GetElement()->AsBanner();
                 el->GetBanner()->text_colour = value;
                 Invalidate();
                 break;
@@ -1459,23 +1497,23 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::SmallScenery:
             {
-                auto* el = _element->AsSmallScenery();
+                auto* el = GetElement()->AsSmallScenery();
                 duk_push_int(ctx, el->GetTertiaryColour());
                 break;
             }
             case TileElementType::LargeScenery:
             {
-                auto* el = _element->AsLargeScenery();
+                auto* el = GetElement()->AsLargeScenery();
                 duk_push_int(ctx, el->GetTertiaryColour());
                 break;
             }
             case TileElementType::Wall:
             {
-                auto* el = _element->AsWall();
+                auto* el = GetElement()->AsWall();
                 duk_push_int(ctx, el->GetTertiaryColour());
                 break;
             }
@@ -1489,26 +1527,26 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::tertiaryColour_set(uint8_t value)
     {
-        ThrowIfGameStateNotMutable();
-        switch (_element->GetType())
+        PrepareElementForWrite();
+        switch (GetElement()->GetType())
         {
             case TileElementType::SmallScenery:
             {
-                auto* el = _element->AsSmallScenery();
+                auto* el = GetElement()->AsSmallScenery();
                 el->SetTertiaryColour(value);
                 Invalidate();
                 break;
             }
             case TileElementType::LargeScenery:
             {
-                auto* el = _element->AsLargeScenery();
+                auto* el = GetElement()->AsLargeScenery();
                 el->SetTertiaryColour(value);
                 Invalidate();
                 break;
             }
             case TileElementType::Wall:
             {
-                auto* el = _element->AsWall();
+                auto* el = GetElement()->AsWall();
                 el->SetTertiaryColour(value);
                 Invalidate();
                 break;
@@ -1522,7 +1560,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        BannerIndex idx = _element->GetBannerIndex();
+        BannerIndex idx = GetElement()->GetBannerIndex();
         if (idx == BannerIndex::GetNull())
             duk_push_null(ctx);
         else
@@ -1531,12 +1569,12 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::bannerIndex_set(const DukValue& value)
     {
-        ThrowIfGameStateNotMutable();
-        switch (_element->GetType())
+        PrepareElementForWrite();
+        switch (GetElement()->GetType())
         {
             case TileElementType::LargeScenery:
             {
-                auto* el = _element->AsLargeScenery();
+                auto* el = GetElement()->AsLargeScenery();
                 if (value.type() == DukValue::Type::NUMBER)
                     el->SetBannerIndex(BannerIndex::FromUnderlying(value.as_uint()));
                 else
@@ -1546,7 +1584,7 @@ namespace OpenRCT2::Scripting
             }
             case TileElementType::Wall:
             {
-                auto* el = _element->AsWall();
+                auto* el = GetElement()->AsWall();
                 if (value.type() == DukValue::Type::NUMBER)
                     el->SetBannerIndex(BannerIndex::FromUnderlying(value.as_uint()));
                 else
@@ -1556,7 +1594,7 @@ namespace OpenRCT2::Scripting
             }
             case TileElementType::Banner:
             {
-                auto* el = _element->AsBanner();
+                auto* el = GetElement()->AsBanner();
                 if (value.type() == DukValue::Type::NUMBER)
                     el->SetIndex(BannerIndex::FromUnderlying(value.as_uint()));
                 else
@@ -1574,14 +1612,14 @@ namespace OpenRCT2::Scripting
     /** @deprecated */
     uint8_t ScTileElement::edgesAndCorners_get() const
     {
-        auto* el = _element->AsPath();
+        auto* el = GetElement()->AsPath();
         return el != nullptr ? el->GetEdgesAndCorners() : 0;
     }
     /** @deprecated */
     void ScTileElement::edgesAndCorners_set(uint8_t value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsPath();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr)
         {
             el->SetEdgesAndCorners(value);
@@ -1593,7 +1631,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsPath();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr)
             duk_push_int(ctx, el->GetEdges());
         else
@@ -1602,8 +1640,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::edges_set(uint8_t value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsPath();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr)
         {
             el->SetEdges(value);
@@ -1615,7 +1653,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsPath();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr)
             duk_push_int(ctx, el->GetCorners());
         else
@@ -1624,8 +1662,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::corners_set(uint8_t value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsPath();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr)
         {
             el->SetCorners(value);
@@ -1637,7 +1675,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsPath();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr && el->IsSloped())
             duk_push_int(ctx, el->GetSlopeDirection());
         else
@@ -1646,8 +1684,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::slopeDirection_set(const DukValue& value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsPath();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr)
         {
             if (value.type() == DukValue::Type::NUMBER)
@@ -1668,7 +1706,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsPath();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr)
             duk_push_boolean(ctx, el->IsQueue());
         else
@@ -1677,8 +1715,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::isQueue_set(bool value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsPath();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr)
         {
             el->SetIsQueue(value);
@@ -1690,7 +1728,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsPath();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr && el->HasQueueBanner())
             duk_push_int(ctx, el->GetQueueBannerDirection());
         else
@@ -1699,8 +1737,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::queueBannerDirection_set(const DukValue& value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsPath();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr)
         {
             if (value.type() == DukValue::Type::NUMBER)
@@ -1721,7 +1759,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsPath();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr)
             duk_push_boolean(ctx, el->IsBlockedByVehicle());
         else
@@ -1730,8 +1768,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::isBlockedByVehicle_set(bool value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsPath();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr)
         {
             el->SetIsBlockedByVehicle(value);
@@ -1743,7 +1781,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsPath();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr)
             duk_push_boolean(ctx, el->IsWide());
         else
@@ -1752,8 +1790,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::isWide_set(bool value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsPath();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr)
         {
             el->SetWide(value);
@@ -1765,9 +1803,9 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        if (_element->GetType() == TileElementType::Path)
+        if (GetElement()->GetType() == TileElementType::Path)
         {
-            auto* el = _element->AsPath();
+            auto* el = GetElement()->AsPath();
             auto index = el->GetSurfaceEntryIndex();
             if (index != OBJECT_ENTRY_INDEX_NULL)
             {
@@ -1789,10 +1827,10 @@ namespace OpenRCT2::Scripting
     {
         if (value.type() == DukValue::Type::NUMBER)
         {
-            ThrowIfGameStateNotMutable();
-            if (_element->GetType() == TileElementType::Path)
+            PrepareElementForWrite();
+            if (GetElement()->GetType() == TileElementType::Path)
             {
-                auto* el = _element->AsPath();
+                auto* el = GetElement()->AsPath();
                 el->SetSurfaceEntryIndex(FromDuk<ObjectEntryIndex>(value));
                 Invalidate();
             }
@@ -1803,9 +1841,9 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        if (_element->GetType() == TileElementType::Path)
+        if (GetElement()->GetType() == TileElementType::Path)
         {
-            auto* el = _element->AsPath();
+            auto* el = GetElement()->AsPath();
             auto index = el->GetRailingsEntryIndex();
             if (index != OBJECT_ENTRY_INDEX_NULL)
             {
@@ -1827,10 +1865,10 @@ namespace OpenRCT2::Scripting
     {
         if (value.type() == DukValue::Type::NUMBER)
         {
-            ThrowIfGameStateNotMutable();
-            if (_element->GetType() == TileElementType::Path)
+            PrepareElementForWrite();
+            if (GetElement()->GetType() == TileElementType::Path)
             {
-                auto* el = _element->AsPath();
+                auto* el = GetElement()->AsPath();
                 el->SetRailingsEntryIndex(FromDuk<ObjectEntryIndex>(value));
                 Invalidate();
             }
@@ -1841,7 +1879,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsPath();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr && el->HasAddition())
             duk_push_int(ctx, el->GetAdditionEntryIndex());
         else
@@ -1850,8 +1888,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::addition_set(const DukValue& value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsPath();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr)
         {
             if (value.type() == DukValue::Type::NUMBER)
@@ -1874,7 +1912,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsPath();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr && el->HasAddition() && !el->IsQueue())
             duk_push_int(ctx, el->GetAdditionStatus());
         else
@@ -1885,8 +1923,8 @@ namespace OpenRCT2::Scripting
     {
         if (value.type() == DukValue::Type::NUMBER)
         {
-            ThrowIfGameStateNotMutable();
-            auto* el = _element->AsPath();
+            PrepareElementForWrite();
+            auto* el = GetElement()->AsPath();
             if (el != nullptr)
                 if (el->HasAddition() && !el->IsQueue())
                 {
@@ -1900,7 +1938,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsPath();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr && el->HasAddition())
             duk_push_boolean(ctx, el->IsBroken());
         else
@@ -1911,8 +1949,8 @@ namespace OpenRCT2::Scripting
     {
         if (value.type() == DukValue::Type::BOOLEAN)
         {
-            ThrowIfGameStateNotMutable();
-            auto* el = _element->AsPath();
+            PrepareElementForWrite();
+            auto* el = GetElement()->AsPath();
             if (el != nullptr)
             {
                 el->SetIsBroken(value.as_bool());
@@ -1925,7 +1963,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsPath();
+        auto* el = GetElement()->AsPath();
         if (el != nullptr && el->HasAddition())
             duk_push_boolean(ctx, el->AdditionIsGhost());
         else
@@ -1936,8 +1974,8 @@ namespace OpenRCT2::Scripting
     {
         if (value.type() == DukValue::Type::BOOLEAN)
         {
-            ThrowIfGameStateNotMutable();
-            auto* el = _element->AsPath();
+            PrepareElementForWrite();
+            auto* el = GetElement()->AsPath();
             if (el != nullptr)
             {
                 el->SetAdditionIsGhost(value.as_bool());
@@ -1950,7 +1988,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsEntrance();
+        auto* el = GetElement()->AsEntrance();
         if (el != nullptr)
         {
             auto index = el->GetLegacyPathEntryIndex();
@@ -1973,8 +2011,8 @@ namespace OpenRCT2::Scripting
     {
         if (value.type() == DukValue::Type::NUMBER)
         {
-            ThrowIfGameStateNotMutable();
-            auto* el = _element->AsEntrance();
+            PrepareElementForWrite();
+            auto* el = GetElement()->AsEntrance();
             if (el != nullptr)
             {
                 el->SetLegacyPathEntryIndex(FromDuk<ObjectEntryIndex>(value));
@@ -1987,7 +2025,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsEntrance();
+        auto* el = GetElement()->AsEntrance();
         if (el != nullptr)
         {
             auto index = el->GetSurfaceEntryIndex();
@@ -2011,8 +2049,8 @@ namespace OpenRCT2::Scripting
     {
         if (value.type() == DukValue::Type::NUMBER)
         {
-            ThrowIfGameStateNotMutable();
-            auto* el = _element->AsEntrance();
+            PrepareElementForWrite();
+            auto* el = GetElement()->AsEntrance();
             if (el != nullptr)
             {
                 el->SetSurfaceEntryIndex(FromDuk<ObjectEntryIndex>(value));
@@ -2025,11 +2063,11 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        switch (_element->GetType())
+        switch (GetElement()->GetType())
         {
             case TileElementType::Banner:
             {
-                auto* el = _element->AsBanner();
+                auto* el = GetElement()->AsBanner();
                 duk_push_int(ctx, el->GetPosition());
                 break;
             }
@@ -2041,7 +2079,7 @@ namespace OpenRCT2::Scripting
             }
             default:
             {
-                duk_push_int(ctx, _element->GetDirection());
+                duk_push_int(ctx, GetElement()->GetDirection());
                 break;
             }
         }
@@ -2049,12 +2087,12 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::direction_set(uint8_t value)
     {
-        ThrowIfGameStateNotMutable();
-        switch (_element->GetType())
+        PrepareElementForWrite();
+        switch (GetElement()->GetType())
         {
             case TileElementType::Banner:
             {
-                auto* el = _element->AsBanner();
+                auto* el = GetElement()->AsBanner();
                 el->SetPosition(value);
                 Invalidate();
                 break;
@@ -2066,7 +2104,7 @@ namespace OpenRCT2::Scripting
             }
             default:
             {
-                _element->SetDirection(value);
+                GetElement()->SetDirection(value);
                 Invalidate();
             }
         }
@@ -2076,20 +2114,20 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        duk_push_uint(ctx, _element->GetOwner());
+        duk_push_uint(ctx, GetElement()->GetOwner());
         return DukValue::take_from_stack(ctx);
     }
     void ScTileElement::owner_set(uint8_t value)
     {
-        ThrowIfGameStateNotMutable();
-        _element->SetOwner(value);
+        PrepareElementForWrite();
+        GetElement()->SetOwner(value);
     }
 
     DukValue ScTileElement::bannerText_get() const
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        BannerIndex idx = _element->GetBannerIndex();
+        BannerIndex idx = GetElement()->GetBannerIndex();
         if (idx == BannerIndex::GetNull())
             duk_push_null(ctx);
         else
@@ -2098,13 +2136,13 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::bannerText_set(std::string value)
     {
-        ThrowIfGameStateNotMutable();
-        BannerIndex idx = _element->GetBannerIndex();
+        PrepareElementForWrite();
+        BannerIndex idx = GetElement()->GetBannerIndex();
         if (idx != BannerIndex::GetNull())
         {
             auto banner = GetBanner(idx);
             banner->text = value;
-            if (_element->GetType() != TileElementType::Banner)
+            if (GetElement()->GetType() != TileElementType::Banner)
             {
                 if (value.empty())
                     banner->ride_index = BannerGetClosestRideIndex({ banner->position.ToCoordsXY(), 16 });
@@ -2123,7 +2161,7 @@ namespace OpenRCT2::Scripting
     {
         auto& scriptEngine = GetContext()->GetScriptEngine();
         auto* ctx = scriptEngine.GetContext();
-        auto* el = _element->AsBanner();
+        auto* el = GetElement()->AsBanner();
         if (el != nullptr)
             duk_push_boolean(ctx, (el->GetBanner()->flags & BANNER_FLAG_NO_ENTRY) != 0);
         else
@@ -2132,8 +2170,8 @@ namespace OpenRCT2::Scripting
     }
     void ScTileElement::isNoEntry_set(bool value)
     {
-        ThrowIfGameStateNotMutable();
-        auto* el = _element->AsBanner();
+        PrepareElementForWrite();
+        auto* el = GetElement()->AsBanner();
         if (el != nullptr)
         {
             if (value)
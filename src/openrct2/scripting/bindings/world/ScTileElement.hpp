@@ -32,10 +32,17 @@ namespace OpenRCT2::Scripting
     {
     protected:
         CoordsXY _coords;
-        TileElement* _element;
+        size_t _index;
 
     public:
-        ScTileElement(const CoordsXY& coords, TileElement* element);
+        ScTileElement(const CoordsXY& coords, size_t index);
+
+        // Points the object at another element so one object can be reused while iterating.
+        void SetElement(const CoordsXY& coords, size_t index);
+
+    protected:
+        TileElement* GetElement() const;
+        void PrepareElementForWrite();
 
     private:
         std::string type_get() const;
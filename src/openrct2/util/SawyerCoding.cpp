@@ -15,6 +15,8 @@
 #include "Util.h"
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cstring>
 #include <stdexcept>
 
@@ -25,15 +27,91 @@ static size_t EncodeChunkRLE(const uint8_t* src_buffer, uint8_t* dst_buffer, siz
 static size_t EncodeChunkRepeat(const uint8_t* src_buffer, uint8_t* dst_buffer, size_t length);
 static void EncodeChunkRotate(uint8_t* buffer, size_t length);
 
+static constexpr uint64_t kEvenBytesMask = 0x00FF00FF00FF00FFULL;
+
 uint32_t SawyerCodingCalculateChecksum(const uint8_t* buffer, size_t length)
 {
     uint32_t checksum = 0;
-    for (size_t i = 0; i < length; i++)
+    size_t i = 0;
+
+    // Add eight bytes at a time into four 16 bit lanes. Each step adds at most 510 to a lane, so the lanes are emptied
+    // into the checksum every 128 steps before they can overflow.
+    while (length - i >= 8)
+    {
+        uint64_t lanes = 0;
+        const size_t blockEnd = i + std::min<size_t>((length - i) & ~size_t{ 7 }, 128 * 8);
+        for (; i < blockEnd; i += 8)
+        {
+            uint64_t value;
+            std::memcpy(&value, buffer + i, sizeof(value));
+            lanes += (value & kEvenBytesMask) + ((value >> 8) & kEvenBytesMask);
+        }
+        checksum += static_cast<uint32_t>(
+            (lanes & 0xFFFF) + ((lanes >> 16) & 0xFFFF) + ((lanes >> 32) & 0xFFFF) + (lanes >> 48));
+    }
+
+    for (; i < length; i++)
         checksum += buffer[i];
 
     return checksum;
 }
 
+// Masks for rotating every byte of a 64 bit word right by the amounts the rotate encoding uses, which repeat every four
+// bytes. For each of the four amounts, the bits of the selected bytes that stay in the low part and the ones that wrap.
+struct RotateMasks
+{
+    std::array<uint8_t, 4> Amounts;
+    std::array<uint64_t, 4> Low;
+    std::array<uint64_t, 4> High;
+};
+
+static constexpr RotateMasks CreateRotateMasks(std::array<uint8_t, 4> amounts)
+{
+    RotateMasks masks{ amounts, {}, {} };
+    for (size_t k = 0; k < 4; k++)
+    {
+        const uint64_t select = (0xFFULL << (8 * k)) | (0xFFULL << (8 * (k + 4)));
+        const uint64_t low = 0xFFU >> amounts[k];
+        const uint64_t high = (0xFFU << (8 - amounts[k])) & 0xFFU;
+        masks.Low[k] = select & (low * 0x0101010101010101ULL);
+        masks.High[k] = select & (high * 0x0101010101010101ULL);
+    }
+    return masks;
+}
+
+// Decoding rotates right by 1, 3, 5, 7, encoding rotates left by the same, which is right by 7, 5, 3, 1.
+static constexpr RotateMasks kRotateDecodeMasks = CreateRotateMasks({ 1, 3, 5, 7 });
+static constexpr RotateMasks kRotateEncodeMasks = CreateRotateMasks({ 7, 5, 3, 1 });
+
+static void RotateChunk(uint8_t* dst, const uint8_t* src, size_t length, const RotateMasks& masks)
+{
+    size_t i = 0;
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        // Eight bytes at a time, the amounts repeat every four bytes so each word starts with the first amount.
+        for (; i + 8 <= length; i += 8)
+        {
+            uint64_t value;
+            std::memcpy(&value, src + i, sizeof(value));
+            uint64_t result = 0;
+            for (size_t k = 0; k < 4; k++)
+            {
+                result |= ((value >> masks.Amounts[k]) & masks.Low[k]) | ((value << (8 - masks.Amounts[k])) & masks.High[k]);
+            }
+            std::memcpy(dst + i, &result, sizeof(result));
+        }
+    }
+    for (; i < length; i++)
+    {
+        dst[i] = Numerics::ror8(src[i], masks.Amounts[i % 4]);
+    }
+}
+
+void SawyerCodingDecodeRotate(uint8_t* dst, const uint8_t* src, size_t length)
+{
+    RotateChunk(dst, src, length, kRotateDecodeMasks);
+}
+
 /**
  *
  *  rct2: 0x006762E1
@@ -373,13 +451,7 @@ static size_t EncodeChunkRepeat(const uint8_t* src_buffer, uint8_t* dst_buffer,
 
 static void EncodeChunkRotate(uint8_t* buffer, size_t length)
 {
-    size_t i;
-    uint8_t code = 1;
-    for (i = 0; i < length; i++)
-    {
-        buffer[i] = Numerics::rol8(buffer[i], code);
-        code = (code + 2) % 8;
-    }
+    RotateChunk(buffer, buffer, length, kRotateEncodeMasks);
 }
 
 #pragma endregion
@@ -42,6 +42,7 @@ enum
 };
 
 uint32_t SawyerCodingCalculateChecksum(const uint8_t* buffer, size_t length);
+void SawyerCodingDecodeRotate(uint8_t* dst, const uint8_t* src, size_t length);
 size_t SawyerCodingWriteChunkBuffer(uint8_t* dst_file, const uint8_t* src_buffer, SawyerCodingChunkHeader chunkHeader);
 size_t SawyerCodingDecodeSV4(const uint8_t* src, uint8_t* dst, size_t length, size_t bufferLength);
 size_t SawyerCodingDecodeSC4(const uint8_t* src, uint8_t* dst, size_t length, size_t bufferLength);
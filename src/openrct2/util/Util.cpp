@@ -161,6 +161,16 @@ bool AVX2Available()
     return false;
 }
 
+bool NEONAvailable()
+{
+#ifdef __ARM_NEON
+    // NEON is part of the baseline of the targets that define __ARM_NEON, AArch64 always does.
+    return true;
+#else
+    return false;
+#endif
+}
+
 static bool BitCountPopcntAvailable()
 {
 #ifdef OPENRCT2_X86
@@ -406,7 +416,7 @@ bool UtilGzipCompress(FILE* source, FILE* dest)
     return true;
 }
 
-std::vector<uint8_t> Gzip(const void* data, const size_t dataLen)
+std::vector<uint8_t> Gzip(const void* data, const size_t dataLen, int32_t level)
 {
     assert(data != nullptr);
 
@@ -417,7 +427,7 @@ std::vector<uint8_t> Gzip(const void* data, const size_t dataLen)
     strm.opaque = Z_NULL;
 
     {
-        const auto ret = deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | 16, 8, Z_DEFAULT_STRATEGY);
+        const auto ret = deflateInit2(&strm, level, Z_DEFLATED, 15 | 16, 8, Z_DEFAULT_STRATEGY);
         if (ret != Z_OK)
         {
             throw std::runtime_error("deflateInit2 failed with error " + std::to_string(ret));
@@ -25,6 +25,7 @@ int32_t MphToDmps(int32_t mph);
 
 bool SSE41Available();
 bool AVX2Available();
+bool NEONAvailable();
 
 int32_t UtilBitScanForward(int32_t source);
 int32_t UtilBitScanForward(int64_t source);
@@ -37,7 +38,8 @@ uint32_t UtilRand();
 float UtilRandNormalDistributed();
 
 bool UtilGzipCompress(FILE* source, FILE* dest);
-std::vector<uint8_t> Gzip(const void* data, const size_t dataLen);
+// level is a zlib compression level from 1 (fastest) to 9 (smallest), -1 uses the zlib default.
+std::vector<uint8_t> Gzip(const void* data, const size_t dataLen, int32_t level = -1);
 std::vector<uint8_t> Ungzip(const void* data, const size_t dataLen);
 
 // TODO: Make these specialized template functions, or when possible Concepts in C++20
@@ -22,8 +22,229 @@
 #include "Scenery.h"
 #include "Surface.h"
 
+#include <algorithm>
+#include <array>
+#include <optional>
+
 using namespace OpenRCT2;
 
+// Results of MapCanConstructWithClearAt for recent footprints, so the Execute after a Query and the queries of ghost
+// previews don't walk the same tiles again. Only results that did not clear anything are kept, everything else may have
+// side effects in Execute. Entries are stale as soon as the map generation changes.
+struct ClearanceCacheEntry
+{
+    bool Valid{};
+    uint32_t Generation{};
+    uint64_t ParkFlags{};
+    CoordsXYRangedZ Pos;
+    CLEAR_FUNC ClearFunc{};
+    uint8_t QuarterTile{};
+    uint8_t Flags{};
+    uint8_t CrossingMode{};
+    bool IsTree{};
+    GameActions::Result Result;
+};
+
+static constexpr size_t kClearanceCacheSize = 64;
+static std::array<ClearanceCacheEntry, kClearanceCacheSize> _clearanceCache;
+
+// Summary of what occupies a tile, so most clearance checks can be answered without walking the element stack. Each
+// quadrant has a bitmap of the height bands any element (ghosts included) reaches into, plus the surface values the
+// checks look at. A clear band proves there is no overlap, anything else falls back to walking the elements.
+// Entries are dropped whenever their tile is changed or invalidated, removing elements only frees up bands so a summary
+// that still lists a removed element just sends the check down the slow path.
+struct TileOccupancy
+{
+    static constexpr uint32_t kNoTile = UINT32_MAX;
+
+    uint32_t TileIndex = kNoTile;
+    std::array<uint64_t, 4> Bands{};
+    int32_t SurfaceZ{};
+    int32_t WaterHeight{};
+    uint8_t Slope{};
+    bool HasSurface{};
+};
+
+static constexpr int32_t kOccupancyBandHeight = 4 * COORDS_Z_STEP;
+static constexpr int32_t kOccupancyMaxZ = 64 * kOccupancyBandHeight;
+static constexpr size_t kOccupancyCacheSize = 4096;
+static std::array<TileOccupancy, kOccupancyCacheSize> _occupancyCache;
+
+static uint32_t OccupancyTileIndex(const TileCoordsXY& tilePos)
+{
+    return static_cast<uint32_t>(tilePos.y * kMaximumMapSizeTechnical + tilePos.x);
+}
+
+static TileOccupancy& OccupancySlot(uint32_t tileIndex)
+{
+    return _occupancyCache[(tileIndex ^ (tileIndex >> 12)) % kOccupancyCacheSize];
+}
+
+// Bands [minZ / band, maxZ / band] as a mask, both inclusive
+static uint64_t OccupancyBandMask(int32_t minZ, int32_t maxZ)
+{
+    const auto first = minZ / kOccupancyBandHeight;
+    const auto last = maxZ / kOccupancyBandHeight;
+    const auto upTo = last >= 63 ? ~0ULL : ((1ULL << (last + 1)) - 1);
+    return upTo & ~((1ULL << first) - 1);
+}
+
+static const TileOccupancy* GetTileOccupancy(const CoordsXY& coords, const TileElement* firstElement)
+{
+    const auto tileIndex = OccupancyTileIndex(TileCoordsXY(coords));
+    auto& occupancy = OccupancySlot(tileIndex);
+    if (occupancy.TileIndex == tileIndex)
+        return &occupancy;
+
+    occupancy = {};
+    const auto* tileElement = firstElement;
+    do
+    {
+        if (tileElement->GetType() == TileElementType::Surface)
+        {
+            occupancy.SurfaceZ = tileElement->GetBaseZ();
+            occupancy.WaterHeight = tileElement->AsSurface()->GetWaterHeight();
+            occupancy.Slope = tileElement->AsSurface()->GetSlope();
+            occupancy.HasSurface = true;
+            continue;
+        }
+
+        const auto baseZ = tileElement->GetBaseZ();
+        const auto clearanceZ = tileElement->GetClearanceZ();
+        if (baseZ < 0 || clearanceZ > kOccupancyMaxZ)
+        {
+            // Cannot be summarised, leave the slot empty so the checks walk the tile
+            occupancy = {};
+            return nullptr;
+        }
+
+        // An element without height still overlaps anything that spans its base
+        const auto bands = OccupancyBandMask(baseZ, std::max(baseZ, clearanceZ - 1));
+        const auto quadrants = tileElement->GetOccupiedQuadrants();
+        for (size_t i = 0; i < occupancy.Bands.size(); i++)
+        {
+            if (quadrants & (1 << i))
+                occupancy.Bands[i] |= bands;
+        }
+    } while (!(tileElement++)->IsLastForTile());
+
+    occupancy.TileIndex = tileIndex;
+    return &occupancy;
+}
+
+void ClearanceInvalidateTile(const CoordsXY& coords)
+{
+    auto tilePos = TileCoordsXY(coords);
+    if (tilePos.x < 0 || tilePos.y < 0 || tilePos.x >= kMaximumMapSizeTechnical || tilePos.y >= kMaximumMapSizeTechnical)
+        return;
+
+    const auto tileIndex = OccupancyTileIndex(tilePos);
+    auto& occupancy = OccupancySlot(tileIndex);
+    if (occupancy.TileIndex == tileIndex)
+        occupancy.TileIndex = TileOccupancy::kNoTile;
+}
+
+void ClearanceInvalidateAll()
+{
+    for (auto& occupancy : _occupancyCache)
+        occupancy.TileIndex = TileOccupancy::kNoTile;
+}
+
+/**
+ * Returns true if the surface stays below the quarters of the tile that are being built on.
+ */
+static bool SurfaceIsBelowQuarters(int32_t surfaceZ, uint8_t slope, const CoordsXYRangedZ& pos, QuarterTile quarterTile)
+{
+    auto northZ = surfaceZ;
+    auto eastZ = northZ;
+    auto southZ = northZ;
+    auto westZ = northZ;
+    if (slope & TILE_ELEMENT_SLOPE_N_CORNER_UP)
+    {
+        northZ += LAND_HEIGHT_STEP;
+        if (slope == (TILE_ELEMENT_SLOPE_S_CORNER_DN | TILE_ELEMENT_SLOPE_DOUBLE_HEIGHT))
+            northZ += LAND_HEIGHT_STEP;
+    }
+    if (slope & TILE_ELEMENT_SLOPE_E_CORNER_UP)
+    {
+        eastZ += LAND_HEIGHT_STEP;
+        if (slope == (TILE_ELEMENT_SLOPE_W_CORNER_DN | TILE_ELEMENT_SLOPE_DOUBLE_HEIGHT))
+            eastZ += LAND_HEIGHT_STEP;
+    }
+    if (slope & TILE_ELEMENT_SLOPE_S_CORNER_UP)
+    {
+        southZ += LAND_HEIGHT_STEP;
+        if (slope == (TILE_ELEMENT_SLOPE_N_CORNER_DN | TILE_ELEMENT_SLOPE_DOUBLE_HEIGHT))
+            southZ += LAND_HEIGHT_STEP;
+    }
+    if (slope & TILE_ELEMENT_SLOPE_W_CORNER_UP)
+    {
+        westZ += LAND_HEIGHT_STEP;
+        if (slope == (TILE_ELEMENT_SLOPE_E_CORNER_DN | TILE_ELEMENT_SLOPE_DOUBLE_HEIGHT))
+            westZ += LAND_HEIGHT_STEP;
+    }
+    const auto baseHeight = pos.baseZ + (4 * COORDS_Z_STEP);
+    const auto baseQuarter = quarterTile.GetBaseQuarterOccupied();
+    const auto zQuarter = quarterTile.GetZQuarterOccupied();
+    return (!(baseQuarter & 0b0001) || ((zQuarter & 0b0001 || pos.baseZ >= northZ) && baseHeight >= northZ))
+        && (!(baseQuarter & 0b0010) || ((zQuarter & 0b0010 || pos.baseZ >= eastZ) && baseHeight >= eastZ))
+        && (!(baseQuarter & 0b0100) || ((zQuarter & 0b0100 || pos.baseZ >= southZ) && baseHeight >= southZ))
+        && (!(baseQuarter & 0b1000) || ((zQuarter & 0b1000 || pos.baseZ >= westZ) && baseHeight >= westZ));
+}
+
+/**
+ * Answers a clearance check from the tile occupancy when nothing on the tile is in the way and nothing would be cleared.
+ * Returns the ground flags in that case, or nothing if the elements have to be walked.
+ */
+static std::optional<uint8_t> MapCanConstructFromOccupancy(
+    const CoordsXYRangedZ& pos, const TileElement* firstElement, CLEAR_FUNC clearFunc, QuarterTile quarterTile, bool isTree)
+{
+    if (pos.baseZ < 0 || pos.clearanceZ <= pos.baseZ || pos.clearanceZ > kOccupancyMaxZ)
+        return std::nullopt;
+
+    const auto* occupancy = GetTileOccupancy(pos, firstElement);
+    if (occupancy == nullptr || !occupancy->HasSurface)
+        return std::nullopt;
+
+    const auto bands = OccupancyBandMask(pos.baseZ, pos.clearanceZ - 1);
+    const auto baseQuarter = quarterTile.GetBaseQuarterOccupied();
+    for (size_t i = 0; i < occupancy->Bands.size(); i++)
+    {
+        if ((baseQuarter & (1 << i)) && (occupancy->Bands[i] & bands))
+            return std::nullopt;
+    }
+
+    uint8_t groundFlags = ELEMENT_IS_ABOVE_GROUND;
+    const auto surfaceZ = occupancy->SurfaceZ;
+    const auto waterHeight = occupancy->WaterHeight;
+    if (waterHeight && waterHeight > pos.baseZ && surfaceZ < pos.clearanceZ)
+    {
+        groundFlags |= ELEMENT_IS_UNDERWATER;
+        if (waterHeight < pos.clearanceZ && clearFunc != nullptr)
+            return std::nullopt;
+    }
+
+    if (GetGameState().Park.Flags & PARK_FLAGS_FORBID_HIGH_CONSTRUCTION && !isTree
+        && pos.clearanceZ - surfaceZ > (18 * COORDS_Z_STEP))
+    {
+        return std::nullopt;
+    }
+
+    if (quarterTile.GetZQuarterOccupied() != 0b1111)
+    {
+        if (surfaceZ >= pos.clearanceZ)
+        {
+            groundFlags |= ELEMENT_IS_UNDERGROUND;
+            groundFlags &= ~ELEMENT_IS_ABOVE_GROUND;
+        }
+        else if (!SurfaceIsBelowQuarters(surfaceZ, occupancy->Slope, pos, quarterTile))
+        {
+            return std::nullopt;
+        }
+    }
+    return groundFlags;
+}
+
 static int32_t MapPlaceClearFunc(
     TileElement** tile_element, const CoordsXY& coords, uint8_t flags, money64* price, bool is_scenery)
 {
@@ -79,12 +300,13 @@ int32_t MapPlaceNonSceneryClearFunc(TileElement** tile_element, const CoordsXY&
 
 static bool MapLoc68BABCShouldContinue(
     TileElement** tileElementPtr, const CoordsXYRangedZ& pos, CLEAR_FUNC clearFunc, uint8_t flags, money64& price,
-    uint8_t crossingMode, bool canBuildCrossing)
+    uint8_t crossingMode, bool canBuildCrossing, bool& hasCleared)
 {
     if (clearFunc != nullptr)
     {
         if (!clearFunc(tileElementPtr, pos, flags, &price))
         {
+            hasCleared = true;
             return true;
         }
     }
@@ -121,8 +343,9 @@ static bool MapLoc68BABCShouldContinue(
  *  ebp = clearFunc
  *  bl = bl
  */
-GameActions::Result MapCanConstructWithClearAt(
-    const CoordsXYRangedZ& pos, CLEAR_FUNC clearFunc, QuarterTile quarterTile, uint8_t flags, uint8_t crossingMode, bool isTree)
+static GameActions::Result MapCanConstructWithClearAtUncached(
+    const CoordsXYRangedZ& pos, CLEAR_FUNC clearFunc, QuarterTile quarterTile, uint8_t flags, uint8_t crossingMode, bool isTree,
+    bool& hasCleared)
 {
     auto res = GameActions::Result();
 
@@ -151,6 +374,12 @@ GameActions::Result MapCanConstructWithClearAt(
         return res;
     }
 
+    if (auto occupancyGroundFlags = MapCanConstructFromOccupancy(pos, tileElement, clearFunc, quarterTile, isTree))
+    {
+        res.SetData(ConstructClearResult{ *occupancyGroundFlags });
+        return res;
+    }
+
     do
     {
         if (tileElement->GetType() != TileElementType::Surface)
@@ -161,7 +390,7 @@ GameActions::Result MapCanConstructWithClearAt(
                 if (tileElement->GetOccupiedQuadrants() & (quarterTile.GetBaseQuarterOccupied()))
                 {
                     if (MapLoc68BABCShouldContinue(
-                            &tileElement, pos, clearFunc, flags, res.Cost, crossingMode, canBuildCrossing))
+                            &tileElement, pos, clearFunc, flags, res.Cost, crossingMode, canBuildCrossing, hasCleared))
                     {
                         continue;
                     }
@@ -180,11 +409,15 @@ GameActions::Result MapCanConstructWithClearAt(
             groundFlags |= ELEMENT_IS_UNDERWATER;
             if (waterHeight < pos.clearanceZ)
             {
-                if (clearFunc != nullptr && clearFunc(&tileElement, pos, flags, &res.Cost))
+                if (clearFunc != nullptr)
                 {
-                    res.Error = GameActions::Status::NoClearance;
-                    res.ErrorMessage = STR_CANNOT_BUILD_PARTLY_ABOVE_AND_PARTLY_BELOW_WATER;
-                    return res;
+                    if (clearFunc(&tileElement, pos, flags, &res.Cost))
+                    {
+                        res.Error = GameActions::Status::NoClearance;
+                        res.ErrorMessage = STR_CANNOT_BUILD_PARTLY_ABOVE_AND_PARTLY_BELOW_WATER;
+                        return res;
+                    }
+                    hasCleared = true;
                 }
             }
         }
@@ -218,47 +451,13 @@ GameActions::Result MapCanConstructWithClearAt(
             }
             else
             {
-                auto northZ = tileElement->GetBaseZ();
-                auto eastZ = northZ;
-                auto southZ = northZ;
-                auto westZ = northZ;
-                const auto slope = tileElement->AsSurface()->GetSlope();
-                if (slope & TILE_ELEMENT_SLOPE_N_CORNER_UP)
-                {
-                    northZ += LAND_HEIGHT_STEP;
-                    if (slope == (TILE_ELEMENT_SLOPE_S_CORNER_DN | TILE_ELEMENT_SLOPE_DOUBLE_HEIGHT))
-                        northZ += LAND_HEIGHT_STEP;
-                }
-                if (slope & TILE_ELEMENT_SLOPE_E_CORNER_UP)
-                {
-                    eastZ += LAND_HEIGHT_STEP;
-                    if (slope == (TILE_ELEMENT_SLOPE_W_CORNER_DN | TILE_ELEMENT_SLOPE_DOUBLE_HEIGHT))
-                        eastZ += LAND_HEIGHT_STEP;
-                }
-                if (slope & TILE_ELEMENT_SLOPE_S_CORNER_UP)
-                {
-                    southZ += LAND_HEIGHT_STEP;
-                    if (slope == (TILE_ELEMENT_SLOPE_N_CORNER_DN | TILE_ELEMENT_SLOPE_DOUBLE_HEIGHT))
-                        southZ += LAND_HEIGHT_STEP;
-                }
-                if (slope & TILE_ELEMENT_SLOPE_W_CORNER_UP)
-                {
-                    westZ += LAND_HEIGHT_STEP;
-                    if (slope == (TILE_ELEMENT_SLOPE_E_CORNER_DN | TILE_ELEMENT_SLOPE_DOUBLE_HEIGHT))
-                        westZ += LAND_HEIGHT_STEP;
-                }
-                const auto baseHeight = pos.baseZ + (4 * COORDS_Z_STEP);
-                const auto baseQuarter = quarterTile.GetBaseQuarterOccupied();
-                const auto zQuarter = quarterTile.GetZQuarterOccupied();
-                if ((!(baseQuarter & 0b0001) || ((zQuarter & 0b0001 || pos.baseZ >= northZ) && baseHeight >= northZ))
-                    && (!(baseQuarter & 0b0010) || ((zQuarter & 0b0010 || pos.baseZ >= eastZ) && baseHeight >= eastZ))
-                    && (!(baseQuarter & 0b0100) || ((zQuarter & 0b0100 || pos.baseZ >= southZ) && baseHeight >= southZ))
-                    && (!(baseQuarter & 0b1000) || ((zQuarter & 0b1000 || pos.baseZ >= westZ) && baseHeight >= westZ)))
+                if (SurfaceIsBelowQuarters(tileElement->GetBaseZ(), tileElement->AsSurface()->GetSlope(), pos, quarterTile))
                 {
                     continue;
                 }
 
-                if (MapLoc68BABCShouldContinue(&tileElement, pos, clearFunc, flags, res.Cost, crossingMode, canBuildCrossing))
+                if (MapLoc68BABCShouldContinue(
+                        &tileElement, pos, clearFunc, flags, res.Cost, crossingMode, canBuildCrossing, hasCleared))
                 {
                     continue;
                 }
@@ -275,6 +474,39 @@ GameActions::Result MapCanConstructWithClearAt(
     return res;
 }
 
+GameActions::Result MapCanConstructWithClearAt(
+    const CoordsXYRangedZ& pos, CLEAR_FUNC clearFunc, QuarterTile quarterTile, uint8_t flags, uint8_t crossingMode, bool isTree)
+{
+    const auto& gameState = GetGameState();
+    const auto generation = MapGetGeneration();
+    const uint64_t parkFlags = gameState.Park.Flags | (gameState.Cheats.DisableClearanceChecks ? (1ULL << 63) : 0);
+    const uint8_t quarters = quarterTile.GetBaseQuarterOccupied() | (quarterTile.GetZQuarterOccupied() << 4);
+    // The apply flag only matters to what the clear function does, and results that used it are never cached
+    const uint8_t cacheFlags = flags & ~GAME_COMMAND_FLAG_APPLY;
+
+    auto tilePos = TileCoordsXY(pos);
+    auto& entry = _clearanceCache[((tilePos.x * 7) + (tilePos.y * 13) + (pos.baseZ / COORDS_Z_STEP)) % kClearanceCacheSize];
+    if (entry.Valid && entry.Generation == generation && entry.ParkFlags == parkFlags && entry.Pos.x == pos.x
+        && entry.Pos.y == pos.y && entry.Pos.baseZ == pos.baseZ && entry.Pos.clearanceZ == pos.clearanceZ
+        && entry.ClearFunc == clearFunc && entry.QuarterTile == quarters && entry.Flags == cacheFlags
+        && entry.CrossingMode == crossingMode && entry.IsTree == isTree)
+    {
+        return entry.Result;
+    }
+
+    bool hasCleared = false;
+    auto res = MapCanConstructWithClearAtUncached(pos, clearFunc, quarterTile, flags, crossingMode, isTree, hasCleared);
+    if (hasCleared)
+    {
+        entry.Valid = false;
+    }
+    else
+    {
+        entry = { true, generation, parkFlags, pos, clearFunc, quarters, cacheFlags, crossingMode, isTree, res };
+    }
+    return res;
+}
+
 GameActions::Result MapCanConstructAt(const CoordsXYRangedZ& pos, QuarterTile bl)
 {
     return MapCanConstructWithClearAt(pos, nullptr, bl, 0);
@@ -37,3 +37,9 @@ struct ConstructClearResult
 [[nodiscard]] GameActions::Result MapCanConstructAt(const CoordsXYRangedZ& pos, QuarterTile bl);
 
 void MapGetObstructionErrorText(TileElement* tileElement, GameActions::Result& res);
+
+/**
+ * Drops the occupancy summary the clearance checks keep for the tile, called whenever a tile changes.
+ */
+void ClearanceInvalidateTile(const CoordsXY& coords);
+void ClearanceInvalidateAll();
@@ -122,6 +122,9 @@ static bool entrance_has_direction(const EntranceElement& entranceElement, int32
 
 PathElement* MapGetFootpathElement(const CoordsXYZ& coords)
 {
+    if (!MapTileMayHaveElementType(TileCoordsXY{ coords }, TileElementType::Path))
+        return nullptr;
+
     TileElement* tileElement = MapGetFirstElementAt(coords);
     do
     {
@@ -578,22 +581,12 @@ struct FootpathNeighbourList
     size_t count;
 };
 
-static int32_t FootpathNeighbourCompare(const void* a, const void* b)
+// Highest order first, then lowest direction first
+static bool FootpathNeighbourGoesBefore(const FootpathNeighbour& a, const FootpathNeighbour& b)
 {
-    uint8_t va = (static_cast<const FootpathNeighbour*>(a))->order;
-    uint8_t vb = (static_cast<const FootpathNeighbour*>(b))->order;
-    if (va < vb)
-        return 1;
-    if (va > vb)
-        return -1;
-
-    uint8_t da = (static_cast<const FootpathNeighbour*>(a))->direction;
-    uint8_t db = (static_cast<const FootpathNeighbour*>(b))->direction;
-    if (da < db)
-        return -1;
-    if (da > db)
-        return 1;
-    return 0;
+    if (a.order != b.order)
+        return a.order > b.order;
+    return a.direction < b.direction;
 }
 
 static void FootpathNeighbourListInit(FootpathNeighbourList* neighbourList)
@@ -601,14 +594,27 @@ static void FootpathNeighbourListInit(FootpathNeighbourList* neighbourList)
     neighbourList->count = 0;
 }
 
+/**
+ * Inserts the neighbour at its sorted position, the list holds at most eight entries so this is cheaper than sorting
+ * the whole list once it is complete.
+ */
 static void FootpathNeighbourListPush(
     FootpathNeighbourList* neighbourList, int32_t order, int32_t direction, RideId rideIndex, ::StationIndex entrance_index)
 {
     Guard::Assert(neighbourList->count < std::size(neighbourList->items));
-    neighbourList->items[neighbourList->count].order = order;
-    neighbourList->items[neighbourList->count].direction = direction;
-    neighbourList->items[neighbourList->count].ride_index = rideIndex;
-    neighbourList->items[neighbourList->count].entrance_index = entrance_index;
+    FootpathNeighbour neighbour;
+    neighbour.order = order;
+    neighbour.direction = direction;
+    neighbour.ride_index = rideIndex;
+    neighbour.entrance_index = entrance_index;
+
+    size_t index = neighbourList->count;
+    while (index > 0 && FootpathNeighbourGoesBefore(neighbour, neighbourList->items[index - 1]))
+    {
+        neighbourList->items[index] = neighbourList->items[index - 1];
+        index--;
+    }
+    neighbourList->items[index] = neighbour;
     neighbourList->count++;
 }
 
@@ -635,11 +641,6 @@ static void FootpathNeighbourListRemove(FootpathNeighbourList* neighbourList, si
     neighbourList->count--;
 }
 
-static void FoopathNeighbourListSort(FootpathNeighbourList* neighbourList)
-{
-    qsort(neighbourList->items, neighbourList->count, sizeof(FootpathNeighbour), FootpathNeighbourCompare);
-}
-
 static TileElement* FootpathGetElement(const CoordsXYRangedZ& footpathPos, int32_t direction)
 {
     TileElement* tileElement = MapGetFirstElementAt(footpathPos);
@@ -1000,16 +1001,13 @@ static void Loc6A6C85(
 }
 
 /**
- *
- *  rct2: 0x006A6C66
+ * Connects the edges of a single tile element to its neighbours, without updating the queue chains or the corners.
  */
-void FootpathConnectEdges(const CoordsXY& footpathPos, TileElement* tileElement, int32_t flags)
+static void FootpathConnectTileEdges(const CoordsXY& footpathPos, TileElement* tileElement, int32_t flags)
 {
     FootpathNeighbourList neighbourList;
     FootpathNeighbour neighbour;
 
-    FootpathUpdateQueueChains();
-
     FootpathNeighbourListInit(&neighbourList);
 
     FootpathUpdateQueueEntranceBanner(footpathPos, tileElement);
@@ -1018,7 +1016,6 @@ void FootpathConnectEdges(const CoordsXY& footpathPos, TileElement* tileElement,
         Loc6A6C85({ footpathPos, tileElement }, direction, flags, true, &neighbourList);
     }
 
-    FoopathNeighbourListSort(&neighbourList);
 
     if (tileElement->GetType() == TileElementType::Path && tileElement->AsPath()->IsQueue())
     {
@@ -1053,6 +1050,18 @@ void FootpathConnectEdges(const CoordsXY& footpathPos, TileElement* tileElement,
     {
         Loc6A6C85({ footpathPos, tileElement }, neighbour.direction, flags, false, nullptr);
     }
+}
+
+/**
+ *
+ *  rct2: 0x006A6C66
+ */
+void FootpathConnectEdges(const CoordsXY& footpathPos, TileElement* tileElement, int32_t flags)
+{
+    MapInvalidatePathWideFlags(footpathPos);
+    FootpathUpdateQueueChains();
+
+    FootpathConnectTileEdges(footpathPos, tileElement, flags);
 
     if (tileElement->GetType() == TileElementType::Path)
     {
@@ -1060,6 +1069,38 @@ void FootpathConnectEdges(const CoordsXY& footpathPos, TileElement* tileElement,
     }
 }
 
+/**
+ * Connects a set of newly placed paths in one pass. The edges of all paths are connected first and the corners after,
+ * so the corner search, which looks at the surrounding 2x2 blocks, sees the final edges once instead of being repeated
+ * as each path joins its neighbours. The queue chains are updated once at the end.
+ * The paths are looked up by position as placing other elements may have moved them in the tile element storage.
+ */
+void FootpathConnectEdgesBatch(const std::vector<CoordsXYZ>& footpathPositions, int32_t flags)
+{
+    FootpathUpdateQueueChains();
+
+    for (const auto& footpathPos : footpathPositions)
+    {
+        auto* pathElement = MapGetPathElementAt(TileCoordsXYZ{ footpathPos });
+        if (pathElement == nullptr)
+            continue;
+
+        MapInvalidatePathWideFlags(footpathPos);
+        FootpathConnectTileEdges(footpathPos, pathElement->as<TileElement>(), flags);
+    }
+
+    for (const auto& footpathPos : footpathPositions)
+    {
+        auto* pathElement = MapGetPathElementAt(TileCoordsXYZ{ footpathPos });
+        if (pathElement != nullptr)
+        {
+            FootpathConnectCorners(footpathPos, pathElement);
+        }
+    }
+
+    FootpathUpdateQueueChains();
+}
+
 /**
  *
  *  rct2: 0x006A742F
@@ -1198,6 +1239,11 @@ void FootpathQueueChainPush(RideId rideIndex)
 {
     if (!rideIndex.IsNull())
     {
+        // The chain of a ride only has to be updated once, placing many queue tiles in a row would otherwise fill the
+        // list with the same ride
+        if (std::find(_footpathQueueChain, _footpathQueueChainNext, rideIndex) != _footpathQueueChainNext)
+            return;
+
         auto* lastSlot = _footpathQueueChain + std::size(_footpathQueueChain) - 1;
         if (_footpathQueueChainNext <= lastSlot)
         {
@@ -1824,6 +1870,8 @@ static TileElement* FootpathCanBeWide(const CoordsXYZ& footpathPos)
     {
         if (tileElement->GetType() != TileElementType::Path)
             continue;
+        if (tileElement->IsGhost())
+            continue;
         if (footpathPos.z != tileElement->GetBaseZ())
             continue;
         if (tileElement->AsPath()->IsQueue())
@@ -1872,6 +1920,10 @@ void FootpathUpdatePathWideFlags(const CoordsXY& footpathPos)
         if (tileElement->GetType() != TileElementType::Path)
             continue;
 
+        // Provisional paths are usually removed during the update, but may be kept when the pathfinding ignores them.
+        if (tileElement->IsGhost())
+            continue;
+
         if (tileElement->AsPath()->IsQueue())
             continue;
 
@@ -2293,6 +2345,7 @@ static void FootpathFixCornersAround(const TileCoordsXY& footpathPos, TileElemen
  */
 void FootpathRemoveEdgesAt(const CoordsXY& footpathPos, TileElement* tileElement)
 {
+    MapInvalidatePathWideFlags(footpathPos);
     if (tileElement->GetType() == TileElementType::Track)
     {
         auto rideIndex = tileElement->AsTrack()->GetRideIndex();
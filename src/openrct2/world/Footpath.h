@@ -14,6 +14,8 @@
 #include "../interface/Viewport.h"
 #include "../object/Object.h"
 
+#include <vector>
+
 class FootpathObject;
 class FootpathSurfaceObject;
 class FootpathRailingsObject;
@@ -196,6 +198,7 @@ CoordsXY FootpathGetCoordinatesFromPos(const ScreenCoordsXY& screenCoords, int32
 CoordsXY FootpathBridgeGetInfoFromPos(const ScreenCoordsXY& screenCoords, int32_t* direction, TileElement** tileElement);
 void FootpathRemoveLitter(const CoordsXYZ& footpathPos);
 void FootpathConnectEdges(const CoordsXY& footpathPos, TileElement* tileElement, int32_t flags);
+void FootpathConnectEdgesBatch(const std::vector<CoordsXYZ>& footpathPositions, int32_t flags);
 void FootpathUpdateQueueChains();
 bool WallInTheWay(const CoordsXYRangedZ& fencePos, int32_t direction);
 void FootpathChainRideQueue(
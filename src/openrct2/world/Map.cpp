@@ -22,16 +22,21 @@
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../core/JobPool.h"
 #include "../interface/Cursors.h"
+#include "../interface/Viewport.h"
 #include "../interface/Window.h"
 #include "../localisation/Date.h"
 #include "../localisation/Localisation.h"
 #include "../management/Finance.h"
+#include "../network/ActionPrediction.h"
 #include "../network/network.h"
+#include "../paint/Paint.TileCache.h"
 #include "../object/LargeSceneryEntry.h"
 #include "../object/ObjectManager.h"
 #include "../object/SmallSceneryEntry.h"
 #include "../object/TerrainSurfaceObject.h"
+#include "../peep/GuestPathfinding.h"
 #include "../profiling/Profiling.h"
 #include "../ride/RideConstruction.h"
 #include "../ride/RideData.h"
@@ -44,6 +49,7 @@
 #include "../world/TilePointerIndex.hpp"
 #include "Banner.h"
 #include "Climate.h"
+#include "ConstructionClearance.h"
 #include "Footpath.h"
 #include "MapAnimation.h"
 #include "Park.h"
@@ -54,8 +60,12 @@
 #include "Wall.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <mutex>
 
 using namespace OpenRCT2;
 
@@ -101,20 +111,68 @@ uint32_t gLandRemainingConstructionSales;
 
 bool gMapLandRightsUpdateSuccess;
 
+// Tiles that grow after the map is loaded are moved out of TileElements into a page owned by their chunk of
+// kTileChunkSize x kTileChunkSize tiles. A full page only repacks the tiles of that chunk, so building never has to
+// reorganise the elements of the whole map.
+static constexpr int32_t kTileChunkShift = 5;
+static constexpr int32_t kTileChunkSize = 1 << kTileChunkShift;
+static constexpr int32_t kTileChunksPerRow = (kMaximumMapSizeTechnical + kTileChunkSize - 1) / kTileChunkSize;
+static constexpr size_t kMinTileChunkPageCapacity = 64;
+static constexpr int32_t kTileChunksCompactedPerTick = 4;
+
+using TileChunkPages = std::vector<std::vector<TileElement>>;
+
 static TilePointerIndex<TileElement> _tileIndex;
 static TilePointerIndex<TileElement> _tileIndexStash;
 static std::vector<TileElement> _tileElementsStash;
+static TileChunkPages _tileChunkPages;
+static TileChunkPages _tileChunkPagesStash;
+static size_t _tileChunkCompactCursor;
 static size_t _tileElementsInUse;
 static size_t _tileElementsInUseStash;
 static TileCoordsXY _mapSizeStash;
 
+// A bit per TileElementType for each tile, set for every type that may be on the tile. Bits are only cleared when
+// the tile is rescanned, so a set bit does not guarantee the type is present, but a clear bit rules it out.
+static std::vector<uint8_t> _tileElementTypes;
+static std::vector<uint8_t> _tileElementTypesStash;
+
+// Tiles whose path wide flags need recalculating, only tracked when the wide flags are maintained on edit rather than
+// by sweeping the map.
+static std::vector<uint32_t> _pathWideDirtyTiles;
+
+// Tiles that may have growable grass, ageing scenery or jumping fountains, only tracked when MapUpdateTiles skips the
+// tiles that have nothing to update. Rebuilt from the whole map after it is replaced.
+static std::vector<bool> _activeTiles;
+static bool _activeTilesInvalid = true;
+
+// Tiles whose contents changed since a listener (the map window) last took them, only tracked while someone listens.
+// Fed by the tile invalidation functions, which is how every visible change to a tile already reaches the viewports.
+static constexpr size_t kMaxChangedTiles = 16384;
+static std::mutex _changedTilesMutex;
+static std::atomic<bool> _changedTilesTracking;
+static bool _changedTilesAll;
+static std::vector<bool> _changedTilesMask;
+static std::vector<TileCoordsXY> _changedTiles;
+
+// Bumped by the same invalidation functions and whenever an element is removed, see MapGetGeneration
+static std::atomic<uint32_t> _mapGeneration;
+
+// Default surface that all untouched tiles outside of the map size point to, see MapShareOutOfMapSurfaces
+static TileElement _sharedSurfaceElement;
+static bool _hasSharedSurfaces;
+static bool _hasSharedSurfacesStash;
+
 void StashMap()
 {
     auto& gameState = GetGameState();
     _tileIndexStash = std::move(_tileIndex);
     _tileElementsStash = std::move(gameState.TileElements);
+    _tileChunkPagesStash = std::move(_tileChunkPages);
+    _tileElementTypesStash = std::move(_tileElementTypes);
     _mapSizeStash = GetGameState().MapSize;
     _tileElementsInUseStash = _tileElementsInUse;
+    _hasSharedSurfacesStash = _hasSharedSurfaces;
 }
 
 void UnstashMap()
@@ -122,8 +180,12 @@ void UnstashMap()
     auto& gameState = GetGameState();
     _tileIndex = std::move(_tileIndexStash);
     gameState.TileElements = std::move(_tileElementsStash);
+    _tileChunkPages = std::move(_tileChunkPagesStash);
+    _tileElementTypes = std::move(_tileElementTypesStash);
     GetGameState().MapSize = _mapSizeStash;
     _tileElementsInUse = _tileElementsInUseStash;
+    _hasSharedSurfaces = _hasSharedSurfacesStash;
+    MapMarkAllTilesChanged();
 }
 
 CoordsXY GetMapSizeUnits()
@@ -147,13 +209,102 @@ const std::vector<TileElement>& GetTileElements()
     return GetGameState().TileElements;
 }
 
+size_t MapGetNumTileElementsInUse()
+{
+    return _tileElementsInUse;
+}
+
+static size_t GetTileChunkPagesMemoryUsage(const TileChunkPages& pages)
+{
+    size_t bytes = pages.capacity() * sizeof(std::vector<TileElement>);
+    for (const auto& page : pages)
+    {
+        bytes += page.capacity() * sizeof(TileElement);
+    }
+    return bytes;
+}
+
+size_t MapGetMemoryUsage()
+{
+    const auto& tileElements = GetGameState().TileElements;
+    return tileElements.capacity() * sizeof(TileElement) + _tileElementsStash.capacity() * sizeof(TileElement)
+        + GetTileChunkPagesMemoryUsage(_tileChunkPages) + GetTileChunkPagesMemoryUsage(_tileChunkPagesStash)
+        + _tileIndex.GetMemoryUsage() + _tileIndexStash.GetMemoryUsage() + _tileElementTypes.capacity()
+        + _tileElementTypesStash.capacity() + _pathWideDirtyTiles.capacity() * sizeof(uint32_t)
+        + _activeTiles.capacity() / 8;
+}
+
+static size_t GetTileElementTypesIndex(const TileCoordsXY& tilePos)
+{
+    return static_cast<size_t>(tilePos.y) * kMaximumMapSizeTechnical + tilePos.x;
+}
+
+static void MarkTileElementType(const TileCoordsXY& tilePos, TileElementType type)
+{
+    _tileElementTypes[GetTileElementTypesIndex(tilePos)] |= 1 << EnumValue(type);
+}
+
+static void RebuildTileElementTypes()
+{
+    _tileElementTypes.assign(kMaximumMapSizeTechnical * kMaximumMapSizeTechnical, 0);
+    for (int32_t y = 0; y < kMaximumMapSizeTechnical; y++)
+    {
+        for (int32_t x = 0; x < kMaximumMapSizeTechnical; x++)
+        {
+            MapRefreshTileElementTypes(TileCoordsXY{ x, y });
+        }
+    }
+}
+
+void MapRefreshTileElementTypes(const TileCoordsXY& tilePos)
+{
+    if (tilePos.x < 0 || tilePos.y < 0 || tilePos.x >= kMaximumMapSizeTechnical || tilePos.y >= kMaximumMapSizeTechnical)
+        return;
+
+    uint8_t types = 0;
+    auto* tileElement = _tileIndex.GetFirstElementAt(tilePos);
+    if (tileElement != nullptr)
+    {
+        do
+        {
+            types |= 1 << EnumValue(tileElement->GetType());
+        } while (!(tileElement++)->IsLastForTile());
+    }
+    _tileElementTypes[GetTileElementTypesIndex(tilePos)] = types;
+}
+
+bool MapTileMayHaveElementType(const TileCoordsXY& tilePos, TileElementType type)
+{
+    if (tilePos.x < 0 || tilePos.y < 0 || tilePos.x >= kMaximumMapSizeTechnical || tilePos.y >= kMaximumMapSizeTechnical)
+        return false;
+
+    return (_tileElementTypes[GetTileElementTypesIndex(tilePos)] & (1 << EnumValue(type))) != 0;
+}
+
+static void ResetTileElementCaches()
+{
+    _tileElementsInUse = GetGameState().TileElements.size();
+    _hasSharedSurfaces = false;
+    _tileChunkPages.clear();
+    _tileChunkPages.resize(kTileChunksPerRow * kTileChunksPerRow);
+    _pathWideDirtyTiles.clear();
+    _activeTilesInvalid = true;
+    RebuildTileElementTypes();
+    PathFinding::FlowFieldInvalidateAll();
+    PathFinding::QueueLanesInvalidateAll();
+    PathFinding::PathRegionsInvalidate();
+    PaintTileCacheInvalidate();
+    ViewportFarZoomCacheInvalidate();
+    MapMarkAllTilesChanged();
+}
+
 void SetTileElements(std::vector<TileElement>&& tileElements)
 {
     auto& gameState = GetGameState();
     gameState.TileElements = std::move(tileElements);
     _tileIndex = TilePointerIndex<TileElement>(
         kMaximumMapSizeTechnical, gameState.TileElements.data(), gameState.TileElements.size());
-    _tileElementsInUse = gameState.TileElements.size();
+    ResetTileElementCaches();
 }
 
 static TileElement GetDefaultSurfaceElement()
@@ -241,40 +392,220 @@ static void ReorganiseTileElements(size_t capacity)
 
 void ReorganiseTileElements()
 {
-    ReorganiseTileElements(GetGameState().TileElements.size());
+    ReorganiseTileElements(_tileElementsInUse);
 }
 
-static bool MapCheckFreeElementsAndReorganise(size_t numElementsOnTile, size_t numNewElements)
+static bool IsShareableSurface(const TileElement* element)
 {
-    // Check hard cap on num in use tiles (this would be the size of _tileElements immediately after a reorg)
-    if (_tileElementsInUse + numNewElements > MAX_TILE_ELEMENTS)
+    return element == &_sharedSurfaceElement
+        || (element->IsLastForTile() && std::memcmp(element, &_sharedSurfaceElement, sizeof(TileElement)) == 0);
+}
+
+/**
+ * Points every tile outside of the map size that only holds a default surface at one shared element, so a small
+ * map does not keep a million copies of the same surface around. The count of elements in use stays the same.
+ */
+void MapShareOutOfMapSurfaces()
+{
+    if (!gConfigGeneral.CompactOutOfMapSurfaces)
+        return;
+
+    _sharedSurfaceElement = GetDefaultSurfaceElement();
+
+    const auto& mapSize = GetGameState().MapSize;
+    constexpr auto kSharedTile = std::numeric_limits<size_t>::max();
+    std::vector<size_t> tileOffsets(kMaximumMapSizeTechnical * kMaximumMapSizeTechnical);
+    std::vector<TileElement> newElements;
+    newElements.reserve(std::max(MIN_TILE_ELEMENTS, _tileElementsInUse));
+    size_t numSharedTiles = 0;
+    for (int32_t y = 0; y < kMaximumMapSizeTechnical; y++)
     {
-        return false;
+        for (int32_t x = 0; x < kMaximumMapSizeTechnical; x++)
+        {
+            const auto* element = _tileIndex.GetFirstElementAt({ x, y });
+            auto& offset = tileOffsets[GetTileElementTypesIndex({ x, y })];
+            if ((x >= mapSize.x || y >= mapSize.y) && IsShareableSurface(element))
+            {
+                offset = kSharedTile;
+                numSharedTiles++;
+                continue;
+            }
+
+            offset = newElements.size();
+            do
+            {
+                newElements.push_back(*element);
+            } while (!(element++)->IsLastForTile());
+        }
     }
+    if (numSharedTiles == 0)
+        return;
 
     auto& gameState = GetGameState();
-    auto totalElementsRequired = numElementsOnTile + numNewElements;
-    auto freeElements = gameState.TileElements.capacity() - gameState.TileElements.size();
-    if (freeElements >= totalElementsRequired)
+    gameState.TileElements = std::move(newElements);
+    _tileIndex = TilePointerIndex<TileElement>(kMaximumMapSizeTechnical);
+    for (int32_t y = 0; y < kMaximumMapSizeTechnical; y++)
     {
-        return true;
+        for (int32_t x = 0; x < kMaximumMapSizeTechnical; x++)
+        {
+            auto offset = tileOffsets[GetTileElementTypesIndex({ x, y })];
+            _tileIndex.SetTile({ x, y }, offset == kSharedTile ? &_sharedSurfaceElement : &gameState.TileElements[offset]);
+        }
     }
+    ResetTileElementCaches();
+    _tileElementsInUse += numSharedTiles;
+    _hasSharedSurfaces = true;
+}
 
-    // if space issue is due to fragmentation then Reorg Tiles without increasing capacity
-    if (gameState.TileElements.size() > totalElementsRequired + _tileElementsInUse)
+/**
+ * Gives every tile its own surface element again. Must be called before the map size grows, as the tiles that
+ * become part of the map are written to directly.
+ */
+void MapUnshareOutOfMapSurfaces()
+{
+    if (_hasSharedSurfaces)
     {
         ReorganiseTileElements();
-        // This check is not expected to fail
-        freeElements = gameState.TileElements.capacity() - gameState.TileElements.size();
-        if (freeElements >= totalElementsRequired)
+    }
+}
+
+static std::vector<TileElement>& GetTileChunkPage(const TileCoordsXY& tilePos)
+{
+    const auto chunkIndex = (tilePos.x >> kTileChunkShift) + (tilePos.y >> kTileChunkShift) * kTileChunksPerRow;
+    return _tileChunkPages[chunkIndex];
+}
+
+struct TileChunkBounds
+{
+    TileCoordsXY Start;
+    TileCoordsXY End;
+};
+
+static TileChunkBounds GetTileChunkBounds(const TileCoordsXY& tilePos)
+{
+    const auto start = TileCoordsXY{ (tilePos.x >> kTileChunkShift) << kTileChunkShift,
+                                     (tilePos.y >> kTileChunkShift) << kTileChunkShift };
+    const auto end = TileCoordsXY{ std::min<int32_t>(start.x + kTileChunkSize, kMaximumMapSizeTechnical),
+                                   std::min<int32_t>(start.y + kTileChunkSize, kMaximumMapSizeTechnical) };
+    return { start, end };
+}
+
+static bool IsInTilePage(const std::vector<TileElement>& page, const TileElement* element)
+{
+    return !page.empty() && element >= page.data() && element < page.data() + page.size();
+}
+
+/**
+ * Counts the elements of the tiles that currently live in the page of the chunk containing the given tile.
+ */
+static size_t CountTileChunkPageElements(const TileCoordsXY& tilePos)
+{
+    const auto bounds = GetTileChunkBounds(tilePos);
+    const auto& page = GetTileChunkPage(tilePos);
+    size_t count = 0;
+    for (int32_t y = bounds.Start.y; y < bounds.End.y; y++)
+    {
+        for (int32_t x = bounds.Start.x; x < bounds.End.x; x++)
         {
-            return true;
+            const auto* element = _tileIndex.GetFirstElementAt({ x, y });
+            if (element != nullptr && IsInTilePage(page, element))
+            {
+                do
+                {
+                    count++;
+                } while (!(element++)->IsLastForTile());
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * Moves every tile of the chunk containing the given tile into a new page with room for at least the required
+ * number of extra elements. Elements of tiles that were moved elsewhere before are dropped.
+ */
+static void RepackTileChunk(const TileCoordsXY& tilePos, size_t numRequiredElements)
+{
+    const auto bounds = GetTileChunkBounds(tilePos);
+    auto& page = GetTileChunkPage(tilePos);
+
+    // Only tiles already in the page have to move, the others stay in TileElements until they grow
+    const auto numPageElements = CountTileChunkPageElements(tilePos);
+    if (numPageElements + numRequiredElements == 0)
+    {
+        page = {};
+        return;
+    }
+
+    std::vector<TileElement> newPage;
+    newPage.reserve(std::max(kMinTileChunkPageCapacity, (numPageElements + numRequiredElements) * 2));
+    for (int32_t y = bounds.Start.y; y < bounds.End.y; y++)
+    {
+        for (int32_t x = bounds.Start.x; x < bounds.End.x; x++)
+        {
+            const auto* element = _tileIndex.GetFirstElementAt({ x, y });
+            if (element == nullptr || !IsInTilePage(page, element))
+                continue;
+
+            _tileIndex.SetTile({ x, y }, newPage.data() + newPage.size());
+            do
+            {
+                newPage.push_back(*element);
+            } while (!(element++)->IsLastForTile());
+        }
+    }
+    page = std::move(newPage);
+}
+
+/**
+ * Repacks a few chunk pages within the map size each tick when most of their elements belong to tiles that have
+ * grown again since, so their memory is given back gradually rather than by reorganising the whole map.
+ */
+void MapCompactTileElements()
+{
+    if (_tileChunkPages.empty())
+        return;
+
+    const auto& mapSize = GetGameState().MapSize;
+    const auto numChunksX = std::min((mapSize.x + kTileChunkSize - 1) / kTileChunkSize, kTileChunksPerRow);
+    const auto numChunksY = std::min((mapSize.y + kTileChunkSize - 1) / kTileChunkSize, kTileChunksPerRow);
+    const auto numChunks = static_cast<size_t>(numChunksX * numChunksY);
+    if (numChunks == 0)
+        return;
+
+    for (int32_t i = 0; i < kTileChunksCompactedPerTick; i++)
+    {
+        _tileChunkCompactCursor = (_tileChunkCompactCursor + 1) % numChunks;
+        const auto chunkX = static_cast<int32_t>(_tileChunkCompactCursor % numChunksX);
+        const auto chunkY = static_cast<int32_t>(_tileChunkCompactCursor / numChunksX);
+        const auto tilePos = TileCoordsXY{ chunkX << kTileChunkShift, chunkY << kTileChunkShift };
+
+        const auto& page = GetTileChunkPage(tilePos);
+        if (page.empty())
+            continue;
+
+        const auto numPageElements = CountTileChunkPageElements(tilePos);
+        if (page.size() - numPageElements > std::max(kMinTileChunkPageCapacity, numPageElements))
+        {
+            RepackTileChunk(tilePos, 0);
         }
     }
+}
+
+static bool MapCheckFreeElementsAndReorganise(const TileCoordsXY& tilePos, size_t numElementsOnTile, size_t numNewElements)
+{
+    // Check hard cap on num in use tiles (this would be the size of _tileElements immediately after a reorg)
+    if (_tileElementsInUse + numNewElements > MAX_TILE_ELEMENTS)
+    {
+        return false;
+    }
 
-    // Capacity must increase to handle the space (Note capacity can go above MAX_TILE_ELEMENTS)
-    auto newCapacity = gameState.TileElements.capacity() * 2;
-    ReorganiseTileElements(newCapacity);
+    const auto totalElementsRequired = numElementsOnTile + numNewElements;
+    const auto& page = GetTileChunkPage(tilePos);
+    if (page.capacity() - page.size() < totalElementsRequired)
+    {
+        RepackTileChunk(tilePos, totalElementsRequired);
+    }
     return true;
 }
 
@@ -283,7 +614,7 @@ static size_t CountElementsOnTile(const CoordsXY& loc);
 bool MapCheckCapacityAndReorganise(const CoordsXY& loc, size_t numElements)
 {
     auto numElementsOnTile = CountElementsOnTile(loc);
-    return MapCheckFreeElementsAndReorganise(numElementsOnTile, numElements);
+    return MapCheckFreeElementsAndReorganise(TileCoordsXY(loc), numElementsOnTile, numElements);
 }
 
 static void ClearElementsAt(const CoordsXY& loc);
@@ -385,6 +716,9 @@ TileElement* MapGetNthElementAt(const CoordsXY& coords, int32_t n)
 
 TileElement* MapGetFirstTileElementWithBaseHeightBetween(const TileCoordsXYRangedZ& loc, TileElementType type)
 {
+    if (!MapTileMayHaveElementType(loc, type))
+        return nullptr;
+
     TileElement* tileElement = MapGetFirstElementAt(loc);
     if (tileElement == nullptr)
         return nullptr;
@@ -407,6 +741,7 @@ void MapSetTileElement(const TileCoordsXY& tilePos, TileElement* elements)
         return;
     }
     _tileIndex.SetTile(tilePos, elements);
+    MapRefreshTileElementTypes(tilePos);
 }
 
 SurfaceElement* MapGetSurfaceElementAt(const TileCoordsXY& coords)
@@ -423,6 +758,9 @@ SurfaceElement* MapGetSurfaceElementAt(const CoordsXY& coords)
 
 PathElement* MapGetPathElementAt(const TileCoordsXYZ& loc)
 {
+    if (!MapTileMayHaveElementType(loc, TileElementType::Path))
+        return nullptr;
+
     for (auto* element : TileElementsView<PathElement>(loc.ToCoordsXY()))
     {
         if (element->IsGhost())
@@ -437,6 +775,9 @@ PathElement* MapGetPathElementAt(const TileCoordsXYZ& loc)
 BannerElement* MapGetBannerElementAt(const CoordsXYZ& bannerPos, uint8_t position)
 {
     const auto bannerTilePos = TileCoordsXYZ{ bannerPos };
+    if (!MapTileMayHaveElementType(bannerTilePos, TileElementType::Banner))
+        return nullptr;
+
     for (auto* element : TileElementsView<BannerElement>(bannerPos))
     {
         if (element->BaseHeight != bannerTilePos.z)
@@ -463,12 +804,31 @@ void MapInit(const TileCoordsXY& size)
     gameState.WidePathTileLoopPosition = {};
     gameState.MapSize = size;
     MapRemoveOutOfRangeElements();
+    MapShareOutOfMapSurfaces();
     MapAnimationAutoCreate();
 
     auto intent = Intent(INTENT_ACTION_MAP);
     ContextBroadcastIntent(&intent);
 }
 
+// Adds delta to the remaining sales counter that a tile with the given ownership flags counts towards
+static void CountRemainingLandRights(uint8_t flags, int32_t delta)
+{
+    // Do not combine this condition with (flags & OWNERSHIP_AVAILABLE)
+    // As some RCT1 parks have owned tiles with the 'construction rights available' flag also set
+    if (!(flags & OWNERSHIP_OWNED))
+    {
+        if (flags & OWNERSHIP_AVAILABLE)
+        {
+            gLandRemainingOwnershipSales += delta;
+        }
+        else if ((flags & OWNERSHIP_CONSTRUCTION_RIGHTS_AVAILABLE) && (flags & OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED) == 0)
+        {
+            gLandRemainingConstructionSales += delta;
+        }
+    }
+}
+
 /**
  * Counts the number of surface tiles that offer land ownership rights for sale,
  * but haven't been bought yet. It updates gLandRemainingOwnershipSales and
@@ -491,26 +851,24 @@ void MapCountRemainingLandRights()
                 continue;
             }
 
-            uint8_t flags = surfaceElement->GetOwnership();
-
-            // Do not combine this condition with (flags & OWNERSHIP_AVAILABLE)
-            // As some RCT1 parks have owned tiles with the 'construction rights available' flag also set
-            if (!(flags & OWNERSHIP_OWNED))
-            {
-                if (flags & OWNERSHIP_AVAILABLE)
-                {
-                    gLandRemainingOwnershipSales++;
-                }
-                else if (
-                    (flags & OWNERSHIP_CONSTRUCTION_RIGHTS_AVAILABLE) && (flags & OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED) == 0)
-                {
-                    gLandRemainingConstructionSales++;
-                }
-            }
+            CountRemainingLandRights(surfaceElement->GetOwnership(), 1);
         }
     }
 }
 
+/**
+ * Updates the remaining land and construction rights counts for a single tile whose ownership changed, so that land
+ * rights actions do not have to recount the whole map.
+ */
+void MapUpdateRemainingLandRights(uint8_t oldOwnership, uint8_t newOwnership)
+{
+    if (oldOwnership == newOwnership)
+        return;
+
+    CountRemainingLandRights(oldOwnership, -1);
+    CountRemainingLandRights(newOwnership, 1);
+}
+
 /**
  * This is meant to strip TILE_ELEMENT_FLAG_GHOST flag from all elements when
  * importing a park.
@@ -527,6 +885,13 @@ void MapStripGhostFlagFromElements()
     {
         element.SetGhost(false);
     }
+    for (auto& page : _tileChunkPages)
+    {
+        for (auto& element : page)
+        {
+            element.SetGhost(false);
+        }
+    }
 }
 
 /**
@@ -742,6 +1107,31 @@ bool MapCoordIsConnected(const TileCoordsXYZ& loc, uint8_t faceDirection)
     return false;
 }
 
+static bool IsEventDrivenWidePathsEnabled()
+{
+    // The sweep order decides which of two adjacent paths becomes wide, so only single player may skip it.
+    return gConfigGeneral.EventDrivenWidePaths && NetworkGetMode() == NETWORK_MODE_NONE;
+}
+
+void MapInvalidatePathWideFlags(const CoordsXY& loc)
+{
+    if (!IsEventDrivenWidePathsEnabled())
+        return;
+
+    // The wide flags of a path depend on the paths of all eight surrounding tiles.
+    auto centre = TileCoordsXY(loc);
+    for (int32_t y = centre.y - 1; y <= centre.y + 1; y++)
+    {
+        for (int32_t x = centre.x - 1; x <= centre.x + 1; x++)
+        {
+            if (x >= 0 && y >= 0 && x < kMaximumMapSizeTechnical && y < kMaximumMapSizeTechnical)
+            {
+                _pathWideDirtyTiles.push_back(static_cast<uint32_t>(y * kMaximumMapSizeTechnical + x));
+            }
+        }
+    }
+}
+
 /**
  *
  *  rct2: 0x006A876D
@@ -755,6 +1145,20 @@ void MapUpdatePathWideFlags()
         return;
     }
 
+    if (IsEventDrivenWidePathsEnabled())
+    {
+        // Update in row order so neighbouring paths are resolved in the same order as the sweep would.
+        std::sort(_pathWideDirtyTiles.begin(), _pathWideDirtyTiles.end());
+        auto last = std::unique(_pathWideDirtyTiles.begin(), _pathWideDirtyTiles.end());
+        for (auto it = _pathWideDirtyTiles.begin(); it != last; it++)
+        {
+            auto tilePos = TileCoordsXY(*it % kMaximumMapSizeTechnical, *it / kMaximumMapSizeTechnical);
+            FootpathUpdatePathWideFlags(tilePos.ToCoordsXY());
+        }
+        _pathWideDirtyTiles.clear();
+        return;
+    }
+
     // Presumably update_path_wide_flags is too computationally expensive to call for every
     // tile every update, so gWidePathTileLoopX and gWidePathTileLoopY store the x and y
     // progress. A maximum of 128 calls is done per update.
@@ -1029,6 +1433,7 @@ void TileElementRemove(TileElement* tileElement)
     (tileElement - 1)->SetLastForTile(true);
     tileElement->BaseHeight = MAX_ELEMENT_HEIGHT;
     _tileElementsInUse--;
+    _mapGeneration++;
     auto& gameState = GetGameState();
     if (tileElement == &gameState.TileElements.back())
     {
@@ -1149,19 +1554,20 @@ static size_t CountElementsOnTile(const CoordsXY& loc)
     return count;
 }
 
-static TileElement* AllocateTileElements(size_t numElementsOnTile, size_t numNewElements)
+static TileElement* AllocateTileElements(const TileCoordsXY& tilePos, size_t numElementsOnTile, size_t numNewElements)
 {
-    if (!MapCheckFreeElementsAndReorganise(numElementsOnTile, numNewElements))
+    if (!MapCheckFreeElementsAndReorganise(tilePos, numElementsOnTile, numNewElements))
     {
         LOG_ERROR("Cannot insert new element");
         return nullptr;
     }
 
-    auto& gameState = GetGameState();
-    auto oldSize = gameState.TileElements.size();
-    gameState.TileElements.resize(gameState.TileElements.size() + numElementsOnTile + numNewElements);
+    // The page was given enough capacity above, so this never reallocates
+    auto& page = GetTileChunkPage(tilePos);
+    auto oldSize = page.size();
+    page.resize(page.size() + numElementsOnTile + numNewElements);
     _tileElementsInUse += numNewElements;
-    return &gameState.TileElements[oldSize];
+    return &page[oldSize];
 }
 
 /**
@@ -1173,7 +1579,7 @@ TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants,
     const auto& tileLoc = TileCoordsXYZ(loc);
 
     auto numElementsOnTileOld = CountElementsOnTile(loc);
-    auto* newTileElement = AllocateTileElements(numElementsOnTileOld, 1);
+    auto* newTileElement = AllocateTileElements(tileLoc, numElementsOnTileOld, 1);
     auto* originalTileElement = _tileIndex.GetFirstElementAt(tileLoc);
     if (newTileElement == nullptr)
     {
@@ -1182,8 +1588,11 @@ TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants,
 
     // Set tile index pointer to point to new element block
     _tileIndex.SetTile(tileLoc, newTileElement);
+    MapMarkTileChanged(loc);
 
     bool isLastForTile = false;
+    // The shared surface stays in place for the other tiles pointing at it
+    const bool isSharedTile = originalTileElement == &_sharedSurfaceElement;
     if (originalTileElement == nullptr)
     {
         isLastForTile = true;
@@ -1195,7 +1604,8 @@ TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants,
         {
             // Copy over map element
             *newTileElement = *originalTileElement;
-            originalTileElement->BaseHeight = MAX_ELEMENT_HEIGHT;
+            if (!isSharedTile)
+                originalTileElement->BaseHeight = MAX_ELEMENT_HEIGHT;
             originalTileElement++;
             newTileElement++;
 
@@ -1213,12 +1623,21 @@ TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants,
     auto* insertedElement = newTileElement;
     newTileElement->Type = 0;
     newTileElement->SetType(type);
+    MarkTileElementType(tileLoc, type);
     newTileElement->SetBaseZ(loc.z);
     newTileElement->Flags = 0;
     newTileElement->SetLastForTile(isLastForTile);
     newTileElement->SetOccupiedQuadrants(occupiedQuadrants);
     newTileElement->SetClearanceZ(loc.z);
     newTileElement->Owner = 0;
+    if (type == TileElementType::Path)
+    {
+        MapInvalidatePathWideFlags(loc);
+    }
+    if (type == TileElementType::Surface || type == TileElementType::Path || type == TileElementType::SmallScenery)
+    {
+        MapInvalidateTileUpdates(loc);
+    }
     std::memset(&newTileElement->Pad05, 0, sizeof(newTileElement->Pad05));
     std::memset(&newTileElement->Pad08, 0, sizeof(newTileElement->Pad08));
     newTileElement++;
@@ -1230,7 +1649,8 @@ TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants,
         {
             // Copy over map element
             *newTileElement = *originalTileElement;
-            originalTileElement->BaseHeight = MAX_ELEMENT_HEIGHT;
+            if (!isSharedTile)
+                originalTileElement->BaseHeight = MAX_ELEMENT_HEIGHT;
             originalTileElement++;
             newTileElement++;
         } while (!((newTileElement - 1)->IsLastForTile()));
@@ -1239,6 +1659,95 @@ TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants,
     return insertedElement;
 }
 
+/**
+ * Gives a tile outside of the map its own copy of the shared surface element, so it can be written to without
+ * changing every other tile that shares it. Returns false if there was no room for the copy.
+ */
+bool MapUnshareSurfaceAt(const CoordsXY& loc)
+{
+    const auto tilePos = TileCoordsXY(loc);
+    if (_tileIndex.GetFirstElementAt(tilePos) != &_sharedSurfaceElement)
+    {
+        return true;
+    }
+
+    // The shared tile is already counted as an element in use
+    auto* newTileElement = AllocateTileElements(tilePos, 1, 0);
+    if (newTileElement == nullptr)
+    {
+        return false;
+    }
+
+    *newTileElement = _sharedSurfaceElement;
+    _tileIndex.SetTile(tilePos, newTileElement);
+    MapMarkTileChanged(loc);
+    return true;
+}
+
+static bool IsActiveTileUpdatesEnabled()
+{
+    return gConfigGeneral.ActiveTileUpdates && NetworkGetMode() == NETWORK_MODE_NONE;
+}
+
+static size_t GetActiveTileIndex(const TileCoordsXY& tilePos)
+{
+    return static_cast<size_t>(tilePos.y) * kMaximumMapSizeTechnical + tilePos.x;
+}
+
+/**
+ * Whether MapUpdateTiles would change anything on the tile, i.e. whether it has grass that can grow, small scenery
+ * that ages or a path addition that may start a jumping fountain.
+ */
+static bool TileHasPeriodicUpdates(const CoordsXY& loc)
+{
+    for (auto* tileElement : TileElementsView(loc))
+    {
+        switch (tileElement->GetType())
+        {
+            case TileElementType::Surface:
+                if (tileElement->AsSurface()->CanGrassGrow())
+                    return true;
+                break;
+            case TileElementType::SmallScenery:
+                return true;
+            case TileElementType::Path:
+                if (tileElement->AsPath()->HasAddition())
+                    return true;
+                break;
+            default:
+                break;
+        }
+    }
+    return false;
+}
+
+static void RebuildActiveTiles()
+{
+    _activeTiles.assign(kMaximumMapSizeTechnical * kMaximumMapSizeTechnical, false);
+    const auto& mapSize = GetGameState().MapSize;
+    for (int32_t y = 0; y < mapSize.y; y++)
+    {
+        for (int32_t x = 0; x < mapSize.x; x++)
+        {
+            auto tilePos = TileCoordsXY{ x, y };
+            _activeTiles[GetActiveTileIndex(tilePos)] = TileHasPeriodicUpdates(tilePos.ToCoordsXY());
+        }
+    }
+    _activeTilesInvalid = false;
+}
+
+void MapInvalidateTileUpdates(const CoordsXY& loc)
+{
+    if (!IsActiveTileUpdatesEnabled() || _activeTilesInvalid)
+        return;
+
+    auto tilePos = TileCoordsXY(loc);
+    if (tilePos.x >= 0 && tilePos.y >= 0 && tilePos.x < kMaximumMapSizeTechnical && tilePos.y < kMaximumMapSizeTechnical)
+    {
+        _activeTiles[GetActiveTileIndex(tilePos)] = true;
+    }
+}
+
 /**
  * Updates grass length, scenery age and jumping fountains.
  *
@@ -1254,6 +1763,14 @@ void MapUpdateTiles()
 
     auto& gameState = GetGameState();
 
+    // Tiles without anything to update are skipped, the remaining tiles are still visited in the interleaved order as
+    // grass growth draws from the scenario random number generator.
+    bool skipInactiveTiles = IsActiveTileUpdatesEnabled();
+    if (skipInactiveTiles && _activeTilesInvalid)
+    {
+        RebuildActiveTiles();
+    }
+
     // Update 43 more tiles (for each 256x256 block)
     for (int32_t j = 0; j < 43; j++)
     {
@@ -1274,10 +1791,24 @@ void MapUpdateTiles()
         {
             for (int32_t blockX = 0; blockX < gameState.MapSize.x; blockX += 256)
             {
-                auto mapPos = TileCoordsXY{ blockX + x, blockY + y }.ToCoordsXY();
+                auto tilePos = TileCoordsXY{ blockX + x, blockY + y };
+                auto mapPos = tilePos.ToCoordsXY();
                 if (MapIsEdge(mapPos))
                     continue;
 
+                if (skipInactiveTiles)
+                {
+                    auto index = GetActiveTileIndex(tilePos);
+                    if (!_activeTiles[index])
+                        continue;
+
+                    if (!TileHasPeriodicUpdates(mapPos))
+                    {
+                        _activeTiles[index] = false;
+                        continue;
+                    }
+                }
+
                 auto* surfaceElement = MapGetSurfaceElementAt(mapPos);
                 if (surfaceElement != nullptr)
                 {
@@ -1291,6 +1822,12 @@ void MapUpdateTiles()
     }
 }
 
+bool MapKeepsProvisionalElements()
+{
+    // Ghosts only exist on the client that placed them, so guests may only walk past them in single player.
+    return gConfigGeneral.GhostAwarePathfinding && NetworkGetMode() == NETWORK_MODE_NONE;
+}
+
 void MapRemoveProvisionalElements()
 {
     PROFILED_FUNCTION();
@@ -1305,6 +1842,7 @@ void MapRemoveProvisionalElements()
         RideRemoveProvisionalTrackPiece();
         RideEntranceExitRemoveGhost();
     }
+    NetworkRemovePredictions();
     // This is in non performant so only make network games suffer for it
     // non networked games do not need this as its to prevent desyncs.
     if ((NetworkGetMode() != NETWORK_MODE_NONE) && WindowFindByClass(WindowClass::TrackDesignPlace) != nullptr)
@@ -1330,6 +1868,7 @@ void MapRestoreProvisionalElements()
         RideRestoreProvisionalTrackPiece();
         RideEntranceExitPlaceProvisionalGhost();
     }
+    NetworkRestorePredictions();
     // This is in non performant so only make network games suffer for it
     // non networked games do not need this as its to prevent desyncs.
     if ((NetworkGetMode() != NETWORK_MODE_NONE) && WindowFindByClass(WindowClass::TrackDesignPlace) != nullptr)
@@ -1361,6 +1900,18 @@ void MapRemoveOutOfRangeElements()
         {
             if (x == 0 || y == 0 || x >= mapSizeMax.x || y >= mapSizeMax.y)
             {
+                // Most of these tiles were outside the map before as well and only hold a bare surface. Its terrain
+                // is never looked at outside the map and is overwritten when the map grows again, so there is nothing
+                // to clear. This also leaves shared surfaces alone.
+                const auto* firstElement = MapGetFirstElementAt(CoordsXY{ x, y });
+                if (firstElement != nullptr && firstElement->IsLastForTile()
+                    && firstElement->GetType() == TileElementType::Surface
+                    && firstElement->AsSurface()->GetOwnership() == OWNERSHIP_UNOWNED
+                    && firstElement->AsSurface()->GetParkFences() == 0)
+                {
+                    continue;
+                }
+
                 // Note this purposely does not use LandSetRightsAction as X Y coordinates are outside of normal range.
                 auto surfaceElement = MapGetSurfaceElementAt(CoordsXY{ x, y });
                 if (surfaceElement != nullptr)
@@ -1373,6 +1924,17 @@ void MapRemoveOutOfRangeElements()
         }
     }
 
+    // The tiles skipped above can still hold a peep spawn, it is not a tile element
+    auto& gameState = GetGameState();
+    gameState.PeepSpawns.erase(
+        std::remove_if(
+            gameState.PeepSpawns.begin(), gameState.PeepSpawns.end(),
+            [mapSizeMax](const CoordsXY& spawn) {
+                const auto tile = spawn.ToTileStart();
+                return tile.x <= 0 || tile.y <= 0 || tile.x >= mapSizeMax.x || tile.y >= mapSizeMax.y;
+            }),
+        gameState.PeepSpawns.end());
+
     // Reset cheat state
     GetGameState().Cheats.BuildInPauseMode = buildState;
 }
@@ -1414,41 +1976,89 @@ static void MapExtendBoundarySurfaceExtendTile(const SurfaceElement& sourceTile,
     destTile.ClearanceHeight = z;
 }
 
-/**
- * Copies the terrain and slope from the Y edge of the map to the new tiles. Used when increasing the size of the map.
- */
-void MapExtendBoundarySurfaceY()
+static void MapExtendBoundarySurfaceTile(const TileCoordsXY& source, const TileCoordsXY& dest)
 {
-    auto y = GetGameState().MapSize.y - 2;
-    for (auto x = 0; x < kMaximumMapSizeTechnical; x++)
+    auto existingTileElement = MapGetSurfaceElementAt(source);
+    auto newTileElement = MapGetSurfaceElementAt(dest);
+    if (existingTileElement != nullptr && newTileElement != nullptr)
     {
-        auto existingTileElement = MapGetSurfaceElementAt(TileCoordsXY{ x, y - 1 });
-        auto newTileElement = MapGetSurfaceElementAt(TileCoordsXY{ x, y });
+        MapExtendBoundarySurfaceExtendTile(*existingTileElement, *newTileElement);
+    }
+}
 
-        if (existingTileElement != nullptr && newTileElement != nullptr)
+// Lines of tiles that only read and write themselves are spread over the job pool in slices of this size.
+static constexpr size_t kMapResizeLinesPerJob = 32;
+static std::unique_ptr<JobPool> _mapResizeJobs;
+
+template<typename TFn> static void MapResizeForEachLine(TFn&& fn)
+{
+    if (!gConfigGeneral.MultiThreading)
+    {
+        for (int32_t line = 0; line < kMaximumMapSizeTechnical; line++)
         {
-            MapExtendBoundarySurfaceExtendTile(*existingTileElement, *newTileElement);
+            fn(line);
         }
+        return;
+    }
 
-        Park::UpdateFences({ x << 5, y << 5 });
+    if (_mapResizeJobs == nullptr)
+    {
+        _mapResizeJobs = std::make_unique<JobPool>();
     }
+    _mapResizeJobs->ParallelFor(0, kMaximumMapSizeTechnical, kMapResizeLinesPerJob, [&fn](size_t begin, size_t end) {
+        for (size_t line = begin; line < end; line++)
+        {
+            fn(static_cast<int32_t>(line));
+        }
+    });
 }
 
 /**
- * Copies the terrain and slope from the X edge of the map to the new tiles. Used when increasing the size of the map.
+ * Grows the map to the given size, copying the terrain and slope from the edge of the map to the new tiles. The
+ * surfaces of the tiles outside of the map must not be shared, see MapUnshareOutOfMapSurfaces.
+ * Every new column is derived from the one before it, which only ever involves tiles of the same row, so all the
+ * columns are added row by row in parallel, then all the new rows column by column. The fences depend on the
+ * ownership of the neighbouring tiles, which extending does not change, so they are updated once at the end.
  */
-void MapExtendBoundarySurfaceX()
+void MapExtendBoundarySurfaces(const TileCoordsXY& newSize)
 {
-    auto x = GetGameState().MapSize.x - 2;
-    for (auto y = 0; y < kMaximumMapSizeTechnical; y++)
+    auto& mapSize = GetGameState().MapSize;
+    const auto oldSize = mapSize;
+
+    if (newSize.x > oldSize.x)
+    {
+        MapResizeForEachLine([&](int32_t y) {
+            for (auto x = oldSize.x - 1; x <= newSize.x - 2; x++)
+            {
+                MapExtendBoundarySurfaceTile({ x - 1, y }, { x, y });
+            }
+        });
+        mapSize.x = newSize.x;
+    }
+    if (newSize.y > oldSize.y)
+    {
+        MapResizeForEachLine([&](int32_t x) {
+            for (auto y = oldSize.y - 1; y <= newSize.y - 2; y++)
+            {
+                MapExtendBoundarySurfaceTile({ x, y - 1 }, { x, y });
+            }
+        });
+        mapSize.y = newSize.y;
+    }
+
+    for (auto x = oldSize.x - 1; x <= newSize.x - 2; x++)
+    {
+        for (auto y = 0; y < kMaximumMapSizeTechnical; y++)
+        {
+            Park::UpdateFences(TileCoordsXY{ x, y }.ToCoordsXY());
+        }
+    }
+    for (auto y = oldSize.y - 1; y <= newSize.y - 2; y++)
     {
-        auto existingTileElement = MapGetSurfaceElementAt(TileCoordsXY{ x - 1, y });
-        auto newTileElement = MapGetSurfaceElementAt(TileCoordsXY{ x, y });
-        if (existingTileElement != nullptr && newTileElement != nullptr)
+        for (auto x = 0; x < kMaximumMapSizeTechnical; x++)
         {
-            MapExtendBoundarySurfaceExtendTile(*existingTileElement, *newTileElement);
+            Park::UpdateFences(TileCoordsXY{ x, y }.ToCoordsXY());
         }
-        Park::UpdateFences({ x << 5, y << 5 });
     }
 }
 
@@ -1783,10 +2393,97 @@ ScreenCoordsXY Translate3DTo2DWithZ(int32_t rotation, const CoordsXYZ& pos)
     return ScreenCoordsXY{ rotated.y - rotated.x, ((rotated.x + rotated.y) >> 1) - pos.z };
 }
 
+void MapSetChangedTilesTracking(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(_changedTilesMutex);
+    _changedTilesTracking = enabled;
+    _changedTilesAll = true;
+    _changedTiles.clear();
+    _changedTiles.shrink_to_fit();
+    _changedTilesMask.clear();
+    _changedTilesMask.shrink_to_fit();
+}
+
+void MapMarkTileChanged(const CoordsXY& loc)
+{
+    _mapGeneration++;
+    ClearanceInvalidateTile(loc);
+    if (!_changedTilesTracking)
+        return;
+
+    auto tilePos = TileCoordsXY(loc);
+    if (tilePos.x < 0 || tilePos.y < 0 || tilePos.x >= kMaximumMapSizeTechnical || tilePos.y >= kMaximumMapSizeTechnical)
+        return;
+
+    std::lock_guard<std::mutex> lock(_changedTilesMutex);
+    if (!_changedTilesTracking || _changedTilesAll)
+        return;
+
+    if (_changedTilesMask.empty())
+    {
+        _changedTilesMask.resize(kMaximumMapSizeTechnical * kMaximumMapSizeTechnical);
+    }
+    auto index = (tilePos.y * kMaximumMapSizeTechnical) + tilePos.x;
+    if (_changedTilesMask[index])
+        return;
+
+    if (_changedTiles.size() >= kMaxChangedTiles)
+    {
+        // Too many to be worth tracking one by one
+        _changedTilesAll = true;
+        _changedTiles.clear();
+        std::fill(_changedTilesMask.begin(), _changedTilesMask.end(), false);
+        return;
+    }
+    _changedTilesMask[index] = true;
+    _changedTiles.push_back(tilePos);
+}
+
+void MapMarkAllTilesChanged()
+{
+    _mapGeneration++;
+    ClearanceInvalidateAll();
+    std::lock_guard<std::mutex> lock(_changedTilesMutex);
+    if (!_changedTilesTracking)
+        return;
+
+    _changedTilesAll = true;
+    _changedTiles.clear();
+    std::fill(_changedTilesMask.begin(), _changedTilesMask.end(), false);
+}
+
+uint32_t MapGetGeneration()
+{
+    return _mapGeneration;
+}
+
+bool MapTakeChangedTiles(std::vector<TileCoordsXY>& tiles)
+{
+    std::lock_guard<std::mutex> lock(_changedTilesMutex);
+    tiles.clear();
+    if (_changedTilesAll)
+    {
+        _changedTilesAll = false;
+        return false;
+    }
+
+    tiles.swap(_changedTiles);
+    for (const auto& tilePos : tiles)
+    {
+        _changedTilesMask[(tilePos.y * kMaximumMapSizeTechnical) + tilePos.x] = false;
+    }
+    return true;
+}
+
 static void MapInvalidateTileUnderZoom(int32_t x, int32_t y, int32_t z0, int32_t z1, ZoomLevel maxZoom)
 {
-    if (gOpenRCT2Headless)
+    MapMarkTileChanged({ x, y });
+    if (!OpenRCT2HasPresentation())
+    {
+        // Fast forwarded and caught up ticks redraw the screen afterwards, but that only repaints chunks on screen
+        ViewportFarZoomCacheInvalidateTile(x, y, z0, z1);
         return;
+    }
 
     ViewportsInvalidate(x, y, z0, z1, maxZoom);
 }
@@ -1834,6 +2531,15 @@ void MapInvalidateElement(const CoordsXY& elementPos, TileElement* tileElement)
 
 void MapInvalidateRegion(const CoordsXY& mins, const CoordsXY& maxs)
 {
+    // Also drops the clearance occupancy of the tiles, so this runs even when nobody tracks the changed tiles
+    for (int32_t y = mins.y; y <= maxs.y; y += COORDS_XY_STEP)
+    {
+        for (int32_t x = mins.x; x <= maxs.x; x += COORDS_XY_STEP)
+        {
+            MapMarkTileChanged({ x, y });
+        }
+    }
+
     int32_t x0, y0, x1, y1, left, right, top, bottom;
 
     x0 = mins.x + 16;
@@ -1936,6 +2642,9 @@ void MapClearAllElements()
  */
 TrackElement* MapGetTrackElementAt(const CoordsXYZ& trackPos)
 {
+    if (!MapTileMayHaveElementType(TileCoordsXY{ trackPos }, TileElementType::Track))
+        return nullptr;
+
     TileElement* tileElement = MapGetFirstElementAt(trackPos);
     if (tileElement == nullptr)
         return nullptr;
@@ -2144,6 +2853,9 @@ TileElement* MapGetTrackElementAtWithDirectionFromRide(const CoordsXYZD& trackPo
 
 WallElement* MapGetWallElementAt(const CoordsXYRangedZ& coords)
 {
+    if (!MapTileMayHaveElementType(TileCoordsXY{ coords }, TileElementType::Wall))
+        return nullptr;
+
     auto tileElement = MapGetFirstElementAt(coords);
 
     if (tileElement != nullptr)
@@ -2163,6 +2875,9 @@ WallElement* MapGetWallElementAt(const CoordsXYRangedZ& coords)
 
 WallElement* MapGetWallElementAt(const CoordsXYZD& wallCoords)
 {
+    if (!MapTileMayHaveElementType(TileCoordsXY{ wallCoords }, TileElementType::Wall))
+        return nullptr;
+
     auto tileWallCoords = TileCoordsXYZ(wallCoords);
     TileElement* tileElement = MapGetFirstElementAt(wallCoords);
     if (tileElement == nullptr)
@@ -132,7 +132,14 @@ extern uint32_t gLandRemainingConstructionSales;
 extern bool gMapLandRightsUpdateSuccess;
 
 void ReorganiseTileElements();
+void MapShareOutOfMapSurfaces();
+void MapUnshareOutOfMapSurfaces();
+bool MapUnshareSurfaceAt(const CoordsXY& loc);
+void MapCompactTileElements();
 const std::vector<TileElement>& GetTileElements();
+size_t MapGetNumTileElementsInUse();
+// Bytes allocated for the tile elements and the indexes over them, including a stashed map.
+size_t MapGetMemoryUsage();
 void SetTileElements(std::vector<TileElement>&& tileElements);
 void StashMap();
 void UnstashMap();
@@ -141,12 +148,15 @@ std::vector<TileElement> GetReorganisedTileElementsWithoutGhosts();
 void MapInit(const TileCoordsXY& size);
 
 void MapCountRemainingLandRights();
+void MapUpdateRemainingLandRights(uint8_t oldOwnership, uint8_t newOwnership);
 void MapStripGhostFlagFromElements();
 TileElement* MapGetFirstElementAt(const CoordsXY& tilePos);
 TileElement* MapGetFirstElementAt(const TileCoordsXY& tilePos);
 TileElement* MapGetNthElementAt(const CoordsXY& coords, int32_t n);
 TileElement* MapGetFirstTileElementWithBaseHeightBetween(const TileCoordsXYRangedZ& loc, TileElementType type);
 void MapSetTileElement(const TileCoordsXY& tilePos, TileElement* elements);
+void MapRefreshTileElementTypes(const TileCoordsXY& tilePos);
+bool MapTileMayHaveElementType(const TileCoordsXY& tilePos, TileElementType type);
 int32_t MapHeightFromSlope(const CoordsXY& coords, int32_t slopeDirection, bool isSloped);
 BannerElement* MapGetBannerElementAt(const CoordsXYZ& bannerPos, uint8_t direction);
 SurfaceElement* MapGetSurfaceElementAt(const TileCoordsXY& coords);
@@ -161,8 +171,11 @@ EntranceElement* MapGetRideExitElementAt(const CoordsXYZ& exitCoords, bool ghost
 uint8_t MapGetHighestLandHeight(const MapRange& range);
 uint8_t MapGetLowestLandHeight(const MapRange& range);
 bool MapCoordIsConnected(const TileCoordsXYZ& loc, uint8_t faceDirection);
+bool MapKeepsProvisionalElements();
 void MapRemoveProvisionalElements();
 void MapRestoreProvisionalElements();
+void MapInvalidatePathWideFlags(const CoordsXY& loc);
+void MapInvalidateTileUpdates(const CoordsXY& loc);
 void MapUpdatePathWideFlags();
 bool MapIsLocationValid(const CoordsXY& coords);
 bool MapIsEdge(const CoordsXY& coords);
@@ -179,6 +192,8 @@ int16_t TileElementHeight(const CoordsXY& loc);
 int16_t TileElementHeight(const CoordsXYZ& loc, uint8_t slope);
 int16_t TileElementWaterHeight(const CoordsXY& loc);
 void TileElementRemove(TileElement* tileElement);
+// Moves the elements of the tile, and may repack every tile of its chunk, so any TileElement* obtained before the
+// call is invalid afterwards. Look elements up again by location after inserting.
 TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants, TileElementType type);
 
 template<typename T = TileElement> T* MapGetFirstTileElementWithBaseHeightBetween(const TileCoordsXYRangedZ& loc)
@@ -213,8 +228,7 @@ int32_t MapGetHighestZ(const CoordsXY& loc);
 bool TileElementWantsPathConnectionTowards(const TileCoordsXYZD& coords, const TileElement* const elementToBeRemoved);
 
 void MapRemoveOutOfRangeElements();
-void MapExtendBoundarySurfaceX();
-void MapExtendBoundarySurfaceY();
+void MapExtendBoundarySurfaces(const TileCoordsXY& newSize);
 
 bool MapLargeScenerySignSetColour(const CoordsXYZD& signPos, int32_t sequence, uint8_t mainColour, uint8_t textColour);
 void WallRemoveAt(const CoordsXYRangedZ& wallPos);
@@ -228,6 +242,20 @@ void MapInvalidateTileFull(const CoordsXY& tilePos);
 void MapInvalidateElement(const CoordsXY& elementPos, TileElement* tileElement);
 void MapInvalidateRegion(const CoordsXY& mins, const CoordsXY& maxs);
 
+void MapSetChangedTilesTracking(bool enabled);
+void MapMarkTileChanged(const CoordsXY& loc);
+void MapMarkAllTilesChanged();
+/**
+ * Moves the tiles that changed since the last call into the given list. Returns false if too much changed to be listed,
+ * in which case everything should be treated as changed.
+ */
+bool MapTakeChangedTiles(std::vector<TileCoordsXY>& tiles);
+/**
+ * Returns a counter that changes whenever any tile is changed or invalidated. Results computed from the tile elements can
+ * be reused for as long as it stays the same.
+ */
+uint32_t MapGetGeneration();
+
 int32_t MapGetTileSide(const CoordsXY& mapPos);
 int32_t MapGetTileQuadrant(const CoordsXY& mapPos);
 int32_t MapGetCornerHeight(int32_t z, int32_t slope, int32_t direction);
@@ -12,9 +12,12 @@
 #include "../Context.h"
 #include "../Game.h"
 #include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../config/Config.h"
 #include "../entity/EntityList.h"
 #include "../entity/Peep.h"
 #include "../interface/Viewport.h"
+#include "../network/network.h"
 #include "../object/LargeSceneryEntry.h"
 #include "../object/SmallSceneryEntry.h"
 #include "../object/StationObject.h"
@@ -28,20 +31,41 @@
 #include "Footpath.h"
 #include "Map.h"
 #include "Scenery.h"
+#include <algorithm>
+#include <array>
 
 using namespace OpenRCT2;
 
 using map_animation_invalidate_event_handler = bool (*)(const CoordsXYZ& loc);
 
-static std::vector<MapAnimation> _mapAnimations;
+// Animations are bucketed by chunks of kMapAnimationChunkSize x kMapAnimationChunkSize tiles so that chunks which
+// are out of view can be skipped and finding an existing animation only searches its own chunk.
+static constexpr int32_t kMapAnimationChunkShift = 5;
+static constexpr int32_t kMapAnimationChunkSize = 1 << kMapAnimationChunkShift;
+static constexpr int32_t kMapAnimationChunksPerRow = (kMaximumMapSizeTechnical + kMapAnimationChunkSize - 1)
+    / kMapAnimationChunkSize;
+
+// Animations of chunks that are out of view still have their state updated on the ticks clocks check for peeps.
+static constexpr uint32_t kMapAnimationOffscreenUpdateMask = 0x3FF;
+
+static std::array<std::vector<MapAnimation>, kMapAnimationChunksPerRow * kMapAnimationChunksPerRow> _mapAnimations;
+static size_t _numMapAnimations;
 
 constexpr size_t MAX_ANIMATED_OBJECTS = 2000;
 
 static bool InvalidateMapAnimation(const MapAnimation& obj);
+static void InvalidateMapAnimations(bool offscreenChunksOnly);
+
+static std::vector<MapAnimation>& GetMapAnimationChunk(const CoordsXY& location)
+{
+    auto x = std::clamp(location.x / COORDS_XY_STEP, 0, kMaximumMapSizeTechnical - 1) >> kMapAnimationChunkShift;
+    auto y = std::clamp(location.y / COORDS_XY_STEP, 0, kMaximumMapSizeTechnical - 1) >> kMapAnimationChunkShift;
+    return _mapAnimations[y * kMapAnimationChunksPerRow + x];
+}
 
 static bool DoesAnimationExist(int32_t type, const CoordsXYZ& location)
 {
-    for (const auto& a : _mapAnimations)
+    for (const auto& a : GetMapAnimationChunk(location))
     {
         if (a.type == type && a.location == location)
         {
@@ -56,10 +80,16 @@ void MapAnimationCreate(int32_t type, const CoordsXYZ& loc)
 {
     if (!DoesAnimationExist(type, loc))
     {
-        if (_mapAnimations.size() < MAX_ANIMATED_OBJECTS)
+        if (_numMapAnimations >= MAX_ANIMATED_OBJECTS)
+        {
+            // Chunks out of view may still hold animations that have finished
+            InvalidateMapAnimations(true);
+        }
+        if (_numMapAnimations < MAX_ANIMATED_OBJECTS)
         {
             // Create new animation
-            _mapAnimations.push_back({ static_cast<uint8_t>(type), loc });
+            GetMapAnimationChunk(loc).push_back({ static_cast<uint8_t>(type), loc });
+            _numMapAnimations++;
         }
         else
         {
@@ -76,19 +106,7 @@ void MapAnimationInvalidateAll()
 {
     PROFILED_FUNCTION();
 
-    auto it = _mapAnimations.begin();
-    while (it != _mapAnimations.end())
-    {
-        if (InvalidateMapAnimation(*it))
-        {
-            // Map animation has finished, remove it
-            it = _mapAnimations.erase(it);
-        }
-        else
-        {
-            it++;
-        }
-    }
+    InvalidateMapAnimations(false);
 }
 
 /**
@@ -595,14 +613,99 @@ static bool InvalidateMapAnimation(const MapAnimation& a)
     return true;
 }
 
-const std::vector<MapAnimation>& GetMapAnimations()
+/**
+ * Whether the animation changes the game state rather than only invalidating the tile, in which case it has to be
+ * updated even when it is out of view.
+ */
+static bool DoesMapAnimationUpdateGameState(const MapAnimation& a)
 {
-    return _mapAnimations;
+    switch (a.type)
+    {
+        case MAP_ANIMATION_TYPE_TRACK_ONRIDEPHOTO:
+        case MAP_ANIMATION_TYPE_WALL_DOOR:
+            return true;
+        case MAP_ANIMATION_TYPE_SMALL_SCENERY:
+            // Clocks make peeps check the time
+            return (GetGameState().CurrentTicks & kMapAnimationOffscreenUpdateMask) == 0;
+        default:
+            return false;
+    }
+}
+
+static bool AreOffscreenMapAnimationsSkipped()
+{
+    // Which chunks are in view differs between clients, so only single player can skip the invalidation.
+    return gConfigGeneral.LazyMapAnimations && NetworkGetMode() == NETWORK_MODE_NONE;
+}
+
+static bool IsMapAnimationChunkVisible(int32_t chunkX, int32_t chunkY)
+{
+    if (!OpenRCT2HasPresentation())
+        return false;
+
+    auto left = chunkX * kMapAnimationChunkSize * COORDS_XY_STEP;
+    auto top = chunkY * kMapAnimationChunkSize * COORDS_XY_STEP;
+    auto range = MapRange(
+        left, top, left + kMapAnimationChunkSize * COORDS_XY_STEP, top + kMapAnimationChunkSize * COORDS_XY_STEP);
+
+    // All animations invalidate with MapInvalidateTileZoom1, which ignores viewports that are zoomed out further.
+    return ViewportsIntersectMapRange(range, MAX_ELEMENT_HEIGHT * COORDS_Z_STEP, ZoomLevel{ 1 });
+}
+
+static void InvalidateMapAnimations(bool offscreenChunksOnly)
+{
+    auto skipOffscreen = AreOffscreenMapAnimationsSkipped();
+    for (int32_t chunkY = 0; chunkY < kMapAnimationChunksPerRow; chunkY++)
+    {
+        for (int32_t chunkX = 0; chunkX < kMapAnimationChunksPerRow; chunkX++)
+        {
+            auto& animations = _mapAnimations[chunkY * kMapAnimationChunksPerRow + chunkX];
+            if (animations.empty())
+                continue;
+
+            auto visible = !skipOffscreen || IsMapAnimationChunkVisible(chunkX, chunkY);
+            if (offscreenChunksOnly && visible)
+                continue;
+
+            auto it = animations.begin();
+            while (it != animations.end())
+            {
+                // Pruning must not update the game state a second time in the same tick.
+                auto updatesGameState = DoesMapAnimationUpdateGameState(*it);
+                auto update = offscreenChunksOnly ? !updatesGameState : visible || updatesGameState;
+                if (update && InvalidateMapAnimation(*it))
+                {
+                    // Map animation has finished, remove it
+                    it = animations.erase(it);
+                    _numMapAnimations--;
+                }
+                else
+                {
+                    it++;
+                }
+            }
+        }
+    }
+}
+
+std::vector<MapAnimation> GetMapAnimations()
+{
+    std::vector<MapAnimation> animations;
+    animations.reserve(_numMapAnimations);
+    for (const auto& chunk : _mapAnimations)
+    {
+        animations.insert(animations.end(), chunk.begin(), chunk.end());
+    }
+    return animations;
 }
 
 static void ClearMapAnimations()
 {
-    _mapAnimations.clear();
+    for (auto& chunk : _mapAnimations)
+    {
+        chunk.clear();
+    }
+    _numMapAnimations = 0;
 }
 
 void MapAnimationAutoCreate()
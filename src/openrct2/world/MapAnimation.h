@@ -43,6 +43,6 @@ enum
 
 void MapAnimationCreate(int32_t type, const CoordsXYZ& loc);
 void MapAnimationInvalidateAll();
-const std::vector<MapAnimation>& GetMapAnimations();
+std::vector<MapAnimation> GetMapAnimations();
 void MapAnimationAutoCreate();
 void MapAnimationAutoCreateAtTileElement(TileCoordsXY coords, TileElement* el);
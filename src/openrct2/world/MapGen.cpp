@@ -13,8 +13,10 @@
 #include "../Game.h"
 #include "../GameState.h"
 #include "../common.h"
+#include "../config/Config.h"
 #include "../core/Guard.hpp"
 #include "../core/Imaging.h"
+#include "../core/JobPool.h"
 #include "../core/String.hpp"
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
@@ -35,6 +37,7 @@
 #include <cmath>
 #include <cstring>
 #include <iterator>
+#include <memory>
 #include <vector>
 
 #pragma region Height map struct
@@ -98,11 +101,40 @@ static void MapGenSmoothHeight(int32_t iterations);
 static void MapGenSetHeight(MapGenSettings* settings);
 
 static float FractalNoise(int32_t x, int32_t y, float frequency, int32_t octaves, float lacunarity, float persistence);
+static void FractalNoiseRow(
+    int32_t y, int32_t width, float frequency, int32_t octaves, float lacunarity, float persistence, float* output);
 static void MapGenSimplex(MapGenSettings* settings);
 
 static TileCoordsXY _heightSize;
 static uint8_t* _height;
 
+// Rows of the height map are independent in every pass, so they are spread over the job pool in slices of this size.
+static constexpr size_t kMapGenRowsPerJob = 16;
+static std::unique_ptr<JobPool> _mapGenJobs;
+
+template<typename TFn> static void MapGenForEachRow(int32_t begin, int32_t end, TFn&& fn)
+{
+    if (!gConfigGeneral.MultiThreading || end - begin <= static_cast<int32_t>(kMapGenRowsPerJob))
+    {
+        for (int32_t y = begin; y < end; y++)
+        {
+            fn(y);
+        }
+        return;
+    }
+
+    if (_mapGenJobs == nullptr)
+    {
+        _mapGenJobs = std::make_unique<JobPool>();
+    }
+    _mapGenJobs->ParallelFor(begin, end, kMapGenRowsPerJob, [&fn](size_t rowBegin, size_t rowEnd) {
+        for (size_t y = rowBegin; y < rowEnd; y++)
+        {
+            fn(static_cast<int32_t>(y));
+        }
+    });
+}
+
 static int32_t GetHeight(int32_t x, int32_t y)
 {
     if (x >= 0 && y >= 0 && x < _heightSize.x && y < _heightSize.y)
@@ -434,21 +466,19 @@ static void MapGenSetWaterLevel(int32_t waterLevel)
  */
 static void MapGenSmoothHeight(int32_t iterations)
 {
-    int32_t i, x, y, xx, yy, avg;
     int32_t arraySize = _heightSize.y * _heightSize.x * sizeof(uint8_t);
-    uint8_t* copyHeight = new uint8_t[arraySize];
+    std::vector<uint8_t> copyHeight(arraySize);
 
-    for (i = 0; i < iterations; i++)
+    for (int32_t i = 0; i < iterations; i++)
     {
-        std::memcpy(copyHeight, _height, arraySize);
-        for (y = 1; y < _heightSize.y - 1; y++)
-        {
-            for (x = 1; x < _heightSize.x - 1; x++)
+        std::memcpy(copyHeight.data(), _height, arraySize);
+        MapGenForEachRow(1, _heightSize.y - 1, [&copyHeight](int32_t y) {
+            for (int32_t x = 1; x < _heightSize.x - 1; x++)
             {
-                avg = 0;
-                for (yy = -1; yy <= 1; yy++)
+                int32_t avg = 0;
+                for (int32_t yy = -1; yy <= 1; yy++)
                 {
-                    for (xx = -1; xx <= 1; xx++)
+                    for (int32_t xx = -1; xx <= 1; xx++)
                     {
                         avg += copyHeight[(y + yy) * _heightSize.x + (x + xx)];
                     }
@@ -456,10 +486,8 @@ static void MapGenSmoothHeight(int32_t iterations)
                 avg /= 9;
                 SetHeight(x, y, avg);
             }
-        }
+        });
     }
-
-    delete[] copyHeight;
 }
 
 /**
@@ -546,6 +574,27 @@ static float FractalNoise(int32_t x, int32_t y, float frequency, int32_t octaves
     return total;
 }
 
+/**
+ * Evaluates the fractal noise for a whole row of the height map at once, one octave at a time, so the inner loop
+ * runs over consecutive tiles.
+ */
+static void FractalNoiseRow(
+    int32_t y, int32_t width, float frequency, int32_t octaves, float lacunarity, float persistence, float* output)
+{
+    std::fill_n(output, width, 0.0f);
+    float amplitude = persistence;
+    for (int32_t i = 0; i < octaves; i++)
+    {
+        const float sampleY = y * frequency;
+        for (int32_t x = 0; x < width; x++)
+        {
+            output[x] += Generate(x * frequency, sampleY) * amplitude;
+        }
+        frequency *= lacunarity;
+        amplitude *= persistence;
+    }
+}
+
 static float Generate(float x, float y)
 {
     const float F2 = 0.366025403f; // F2 = 0.5*(sqrt(3.0)-1.0)
@@ -647,8 +696,6 @@ static float Grad(int32_t hash, float x, float y)
 
 static void MapGenSimplex(MapGenSettings* settings)
 {
-    int32_t x, y;
-
     float freq = settings->simplex_base_freq * (1.0f / _heightSize.x);
     int32_t octaves = settings->simplex_octaves;
 
@@ -656,16 +703,17 @@ static void MapGenSimplex(MapGenSettings* settings)
     int32_t high = settings->simplex_high;
 
     NoiseRand();
-    for (y = 0; y < _heightSize.y; y++)
-    {
-        for (x = 0; x < _heightSize.x; x++)
+    MapGenForEachRow(0, _heightSize.y, [=](int32_t y) {
+        std::vector<float> noiseValues(_heightSize.x);
+        FractalNoiseRow(y, _heightSize.x, freq, octaves, 2.0f, 0.65f, noiseValues.data());
+        for (int32_t x = 0; x < _heightSize.x; x++)
         {
-            float noiseValue = std::clamp(FractalNoise(x, y, freq, octaves, 2.0f, 0.65f), -1.0f, 1.0f);
+            float noiseValue = std::clamp(noiseValues[x], -1.0f, 1.0f);
             float normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
 
             SetHeight(x, y, low + static_cast<int32_t>(normalisedNoiseValue * high));
         }
-    }
+    });
 }
 
 #pragma endregion
@@ -760,8 +808,7 @@ static void MapGenSmoothHeightmap(std::vector<uint8_t>& src, int32_t strength)
     for (int32_t i = 0; i < strength; i++)
     {
         // Calculate box blur value to all pixels of the surface
-        for (uint32_t y = 0; y < _heightMapData.height; y++)
-        {
+        MapGenForEachRow(0, static_cast<int32_t>(_heightMapData.height), [&src, &dest](int32_t y) {
             for (uint32_t x = 0; x < _heightMapData.width; x++)
             {
                 uint32_t heightSum = 0;
@@ -782,16 +829,10 @@ static void MapGenSmoothHeightmap(std::vector<uint8_t>& src, int32_t strength)
                 // Take average
                 dest[x + y * _heightMapData.width] = heightSum / 9;
             }
-        }
+        });
 
         // Now apply the blur to the source pixels
-        for (uint32_t y = 0; y < _heightMapData.height; y++)
-        {
-            for (uint32_t x = 0; x < _heightMapData.width; x++)
-            {
-                src[x + y * _heightMapData.width] = dest[x + y * _heightMapData.width];
-            }
-        }
+        std::copy(dest.begin(), dest.end(), src.begin());
     }
 }
 
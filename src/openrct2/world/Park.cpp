@@ -353,21 +353,23 @@ namespace OpenRCT2::Park
 
     uint32_t CalculateParkSize()
     {
+        // Every tile has exactly one surface element, so only that one has to be looked up rather than iterating over
+        // every element on the map. The outer edge can not be owned.
+        auto& gameState = GetGameState();
         uint32_t tiles = 0;
-        TileElementIterator it;
-        TileElementIteratorBegin(&it);
-        do
+        for (int32_t x = 1; x < gameState.MapSize.x - 1; x++)
         {
-            if (it.element->GetType() == TileElementType::Surface)
+            for (int32_t y = 1; y < gameState.MapSize.y - 1; y++)
             {
-                if (it.element->AsSurface()->GetOwnership() & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED))
+                const auto* surfaceElement = MapGetSurfaceElementAt(TileCoordsXY{ x, y });
+                if (surfaceElement != nullptr
+                    && (surfaceElement->GetOwnership() & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED)))
                 {
                     tiles++;
                 }
             }
-        } while (TileElementIteratorNext(&it));
+        }
 
-        auto& gameState = GetGameState();
         if (tiles != gameState.Park.Size)
         {
             gameState.Park.Size = tiles;
@@ -481,12 +483,17 @@ namespace OpenRCT2::Park
 
         // Litter
         {
-            // Counts the amount of litter whose age is min. 7680 ticks (5~ min) old.
-            const auto litterList = EntityList<Litter>();
-            const auto litterCount = std::count_if(
-                litterList.begin(), litterList.end(), [](auto* litter) { return litter->GetAge() >= 7680; });
+            // Counts the amount of litter whose age is min. 7680 ticks (5~ min) old. Anything above 150 pieces does not
+            // change the rating any further, so counting stops there.
+            constexpr int32_t kMaxLitterCounted = 150;
+            int32_t litterCount = 0;
+            for (auto* litter : EntityList<Litter>())
+            {
+                if (litter->GetAge() >= 7680 && ++litterCount == kMaxLitterCounted)
+                    break;
+            }
 
-            result -= 600 - (4 * (150 - std::min<int32_t>(150, litterCount)));
+            result -= 600 - (4 * (kMaxLitterCounted - litterCount));
         }
 
         result -= gameState.Park.RatingCasualtyPenalty;
@@ -706,6 +713,8 @@ namespace OpenRCT2::Park
 
     void UpdateFencesAroundTile(const CoordsXY& coords)
     {
+        // Called after the ownership of the tile changed, which shows on the map window even if no fences change
+        MapMarkTileChanged(coords);
         UpdateFences(coords);
         UpdateFences({ coords.x + COORDS_XY_STEP, coords.y });
         UpdateFences({ coords.x - COORDS_XY_STEP, coords.y });
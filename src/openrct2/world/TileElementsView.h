@@ -13,12 +13,25 @@
 #include "Map.h"
 #include "TileElement.h"
 
+#include <algorithm>
 #include <iterator>
 
 namespace OpenRCT2
 {
     namespace Detail
     {
+        // The type and last flag are compared on the raw fields, the element type being known at compile time turns the
+        // filter into a single masked compare per element without calling into GetType.
+        template<typename T> constexpr bool IsElementOfType(const TileElementBase* element)
+        {
+            return (element->Type & kTileElementTypeMask) == (EnumValue(T::ElementType) << 2);
+        }
+
+        constexpr bool IsLastElementForTile(const TileElementBase* element)
+        {
+            return (element->Flags & TILE_ELEMENT_FLAG_LAST_TILE) != 0;
+        }
+
         template<typename T, typename T2> T* NextMatchingTile(T2* element)
         {
             if (element == nullptr)
@@ -26,11 +39,10 @@ namespace OpenRCT2
 
             for (;;)
             {
-                auto* res = element->template as<T>();
-                if (res != nullptr)
-                    return res;
+                if (IsElementOfType<T>(element))
+                    return reinterpret_cast<T*>(element);
 
-                if (element->IsLastForTile())
+                if (IsLastElementForTile(element))
                 {
                     break;
                 }
@@ -39,6 +51,22 @@ namespace OpenRCT2
 
             return nullptr;
         }
+
+        // Returns the first element of type T on the tile, skipping tiles that can not hold the type at all.
+        template<typename T> T* FirstMatchingTile(const TileCoordsXY& loc)
+        {
+            if constexpr (std::is_same_v<T, TileElement>)
+            {
+                return MapGetFirstElementAt(loc);
+            }
+            else
+            {
+                if (!MapTileMayHaveElementType(loc, T::ElementType))
+                    return nullptr;
+
+                return NextMatchingTile<T>(MapGetFirstElementAt(loc));
+            }
+        }
     } // namespace Detail
 
     template<typename T = TileElement> class TileElementsView
@@ -55,7 +83,7 @@ namespace OpenRCT2
                 if (element == nullptr)
                     return *this;
 
-                if (element->IsLastForTile())
+                if (Detail::IsLastElementForTile(element))
                 {
                     element = nullptr;
                 }
@@ -118,19 +146,127 @@ namespace OpenRCT2
 
         Iterator begin() noexcept
         {
-            T* element = reinterpret_cast<T*>(MapGetFirstElementAt(_loc));
+            return Iterator{ Detail::FirstMatchingTile<T>(_loc) };
+        }
+
+        Iterator end() noexcept
+        {
+            return Iterator{ nullptr };
+        }
+    };
 
-            if constexpr (!std::is_same_v<T, TileElement>)
+    /**
+     * Iterates the elements of type T on all tiles of a range, row by row. Tiles that can not hold the type are skipped
+     * without touching their elements. The range is inclusive and clipped to the valid tile locations.
+     */
+    template<typename T = TileElement> class TileElementsRangeView
+    {
+        TileCoordsXY _leftTop;
+        TileCoordsXY _rightBottom;
+
+    public:
+        struct Entry
+        {
+            TileCoordsXY Location;
+            T* Element;
+        };
+
+        struct Iterator
+        {
+            TileCoordsXY loc;
+            int32_t left{};
+            TileCoordsXY rightBottom;
+            T* element = nullptr;
+
+            Iterator& operator++()
             {
-                element = Detail::NextMatchingTile<T>(element);
+                if (element == nullptr)
+                    return *this;
+
+                if (!Detail::IsLastElementForTile(element))
+                {
+                    element++;
+                    if constexpr (!std::is_same_v<T, TileElement>)
+                    {
+                        element = Detail::NextMatchingTile<T>(element);
+                    }
+                    if (element != nullptr)
+                        return *this;
+                }
+
+                element = nullptr;
+                NextTile();
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator res = *this;
+                ++(*this);
+                return res;
+            }
+
+            bool operator==(const Iterator& other) const
+            {
+                return element == other.element;
+            }
+
+            bool operator!=(const Iterator& other) const
+            {
+                return !(*this == other);
+            }
+
+            Entry operator*() const
+            {
+                return Entry{ loc, element };
+            }
+
+            // Moves on to the next tile of the range holding a matching element, leaves element null at the end.
+            void NextTile()
+            {
+                while (element == nullptr)
+                {
+                    if (++loc.x > rightBottom.x)
+                    {
+                        loc.x = left;
+                        if (++loc.y > rightBottom.y)
+                            return;
+                    }
+                    element = Detail::FirstMatchingTile<T>(loc);
+                }
             }
 
-            return Iterator{ element };
+            // iterator traits
+            using difference_type = std::ptrdiff_t;
+            using value_type = Entry;
+            using pointer = const Entry*;
+            using reference = Entry;
+            using iterator_category = std::forward_iterator_tag;
+        };
+
+        TileElementsRangeView(const MapRange& range)
+        {
+            // Negative coordinates map to -1 rather than tile 0, so a range entirely left or above the map stays empty
+            const auto toTile = [](int32_t coord) { return coord >= 0 ? coord / COORDS_XY_STEP : -1; };
+            const auto normalised = range.Normalise();
+            _leftTop = { std::max(toTile(normalised.GetLeft()), 0), std::max(toTile(normalised.GetTop()), 0) };
+            _rightBottom = { std::min<int32_t>(toTile(normalised.GetRight()), kMaximumMapSizeTechnical - 1),
+                             std::min<int32_t>(toTile(normalised.GetBottom()), kMaximumMapSizeTechnical - 1) };
+        }
+
+        Iterator begin() noexcept
+        {
+            if (_leftTop.x > _rightBottom.x || _leftTop.y > _rightBottom.y)
+                return end();
+
+            Iterator it{ _leftTop, _leftTop.x, _rightBottom, Detail::FirstMatchingTile<T>(_leftTop) };
+            it.NextTile();
+            return it;
         }
 
         Iterator end() noexcept
         {
-            return Iterator{ nullptr };
+            return Iterator{};
         }
     };
 
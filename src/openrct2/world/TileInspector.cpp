@@ -347,6 +347,7 @@ namespace OpenRCT2::TileInspector
             bool lastForTile = pastedElement->IsLastForTile();
             *pastedElement = element;
             pastedElement->SetLastForTile(lastForTile);
+            MapRefreshTileElementTypes(tileLoc);
 
             MapAnimationAutoCreateAtTileElement(tileLoc, pastedElement);
 
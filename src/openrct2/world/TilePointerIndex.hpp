@@ -43,6 +43,12 @@ public:
         }
     }
 
+    explicit TilePointerIndex(const uint16_t mapSize)
+        : TilePointers(mapSize * mapSize, nullptr)
+        , MapSize(mapSize)
+    {
+    }
+
     T* GetFirstElementAt(TileCoordsXY coords)
     {
         return TilePointers[coords.x + (coords.y * MapSize)];
@@ -52,4 +58,9 @@ public:
     {
         TilePointers[coords.x + (coords.y * MapSize)] = tileElement;
     }
+
+    size_t GetMemoryUsage() const
+    {
+        return TilePointers.capacity() * sizeof(T*);
+    }
 };
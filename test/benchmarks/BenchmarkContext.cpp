@@ -0,0 +1,46 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "BenchmarkContext.h"
+
+#include "../tests/TestData.h"
+
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/OpenRCT2.h>
+#include <stdexcept>
+
+using namespace OpenRCT2;
+
+namespace BenchmarkContext
+{
+    static std::unique_ptr<IContext> _context;
+
+    IContext* Get()
+    {
+        if (_context == nullptr)
+        {
+            // Graphics stay enabled so the sprite benchmarks have G1 to draw from
+            gOpenRCT2Headless = true;
+            auto context = CreateContext();
+            if (!context->Initialise())
+            {
+                throw std::runtime_error("Context initialisation failed.");
+            }
+            if (!context->LoadParkFromFile(TestData::GetParkPath("bpb.sv6")))
+            {
+                throw std::runtime_error("Unable to load the benchmark park.");
+            }
+            GameLoadInit();
+            _context = std::move(context);
+        }
+        return _context.get();
+    }
+} // namespace BenchmarkContext
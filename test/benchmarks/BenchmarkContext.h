@@ -0,0 +1,24 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+namespace OpenRCT2
+{
+    struct IContext;
+}
+
+namespace BenchmarkContext
+{
+    /**
+     * Returns a headless context with the benchmark park loaded, creating it on first use. The context is shared by all
+     * benchmarks of the process so the park is only loaded once.
+     */
+    OpenRCT2::IContext* Get();
+} // namespace BenchmarkContext
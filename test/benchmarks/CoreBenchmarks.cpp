@@ -0,0 +1,125 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <openrct2/core/DataSerialiser.h>
+#include <openrct2/core/MemoryStream.h>
+#include <openrct2/rct12/SawyerChunkReader.h>
+#include <openrct2/util/SawyerCoding.h>
+#include <openrct2/util/Util.h>
+#include <random>
+#include <vector>
+
+// Half random bytes, half runs of repeated bytes, roughly what a saved park chunk compresses like.
+static std::vector<uint8_t> CreateChunkData(size_t length)
+{
+    std::mt19937 rng(0);
+    std::vector<uint8_t> data(length);
+    for (size_t i = 0; i < length; i++)
+    {
+        data[i] = (i / 64) % 2 == 0 ? static_cast<uint8_t>(rng()) : static_cast<uint8_t>(i / 64);
+    }
+    return data;
+}
+
+static std::vector<uint8_t> EncodeChunk(const std::vector<uint8_t>& data, uint8_t encoding)
+{
+    SawyerCodingChunkHeader header;
+    header.encoding = encoding;
+    header.length = static_cast<uint32_t>(data.size());
+
+    // Worst case RLE output is slightly larger than the input
+    std::vector<uint8_t> encoded(sizeof(SawyerCodingChunkHeader) + data.size() * 2);
+    encoded.resize(SawyerCodingWriteChunkBuffer(encoded.data(), data.data(), header));
+    return encoded;
+}
+
+static void BM_SawyerCodingEncode(benchmark::State& state)
+{
+    const auto encoding = static_cast<uint8_t>(state.range(0));
+    const auto data = CreateChunkData(1024 * 1024);
+    std::vector<uint8_t> encoded(sizeof(SawyerCodingChunkHeader) + data.size() * 2);
+    for (auto _ : state)
+    {
+        SawyerCodingChunkHeader header;
+        header.encoding = encoding;
+        header.length = static_cast<uint32_t>(data.size());
+        benchmark::DoNotOptimize(SawyerCodingWriteChunkBuffer(encoded.data(), data.data(), header));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * data.size()));
+}
+BENCHMARK(BM_SawyerCodingEncode)->Arg(CHUNK_ENCODING_RLE)->Arg(CHUNK_ENCODING_RLECOMPRESSED)->Arg(CHUNK_ENCODING_ROTATE);
+
+static void BM_SawyerCodingDecode(benchmark::State& state)
+{
+    const auto data = CreateChunkData(1024 * 1024);
+    const auto encoded = EncodeChunk(data, static_cast<uint8_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        OpenRCT2::MemoryStream ms(encoded.data(), encoded.size());
+        SawyerChunkReader reader(&ms);
+        auto chunk = reader.ReadChunk();
+        benchmark::DoNotOptimize(chunk->GetData());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * data.size()));
+}
+BENCHMARK(BM_SawyerCodingDecode)->Arg(CHUNK_ENCODING_RLE)->Arg(CHUNK_ENCODING_RLECOMPRESSED)->Arg(CHUNK_ENCODING_ROTATE);
+
+static void BM_Gzip(benchmark::State& state)
+{
+    const auto data = CreateChunkData(1024 * 1024);
+    for (auto _ : state)
+    {
+        auto compressed = Gzip(data.data(), data.size());
+        benchmark::DoNotOptimize(compressed.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * data.size()));
+}
+BENCHMARK(BM_Gzip);
+
+static void BM_Ungzip(benchmark::State& state)
+{
+    const auto data = CreateChunkData(1024 * 1024);
+    const auto compressed = Gzip(data.data(), data.size());
+    for (auto _ : state)
+    {
+        auto decompressed = Ungzip(compressed.data(), compressed.size());
+        benchmark::DoNotOptimize(decompressed.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * data.size()));
+}
+BENCHMARK(BM_Ungzip);
+
+// Serialises a batch of coordinates and strings, the bulk of what game actions and network packets carry.
+static void BM_DataSerialiserRoundTrip(benchmark::State& state)
+{
+    std::vector<CoordsXYZD> coords(static_cast<size_t>(state.range(0)));
+    for (size_t i = 0; i < coords.size(); i++)
+    {
+        const auto value = static_cast<int32_t>(i);
+        coords[i] = { value * COORDS_XY_STEP, value * COORDS_XY_STEP, value * COORDS_Z_STEP, static_cast<Direction>(i & 3) };
+    }
+    const std::string name = "Benchmark Park";
+
+    for (auto _ : state)
+    {
+        DataSerialiser saver(true);
+        saver << coords << name;
+
+        auto& stream = saver.GetStream();
+        stream.SetPosition(0);
+        DataSerialiser loader(false, stream);
+        std::vector<CoordsXYZD> loadedCoords;
+        std::string loadedName;
+        loader << loadedCoords << loadedName;
+        benchmark::DoNotOptimize(loadedCoords.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * coords.size()));
+}
+BENCHMARK(BM_DataSerialiserRoundTrip)->Arg(64)->Arg(4096);
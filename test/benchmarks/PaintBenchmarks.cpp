@@ -0,0 +1,99 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "BenchmarkContext.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <openrct2/Context.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/drawing/X8DrawingEngine.h>
+#include <openrct2/paint/Paint.h>
+#include <openrct2/sprites.h>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+// Same crowded scene as the PaintArrangeTest correctness tests.
+static std::vector<PaintStruct> CreatePaintStructs(size_t count)
+{
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int32_t> position(0, 8 * COORDS_XY_STEP);
+    std::uniform_int_distribution<int32_t> size(1, COORDS_XY_STEP);
+    std::uniform_int_distribution<int32_t> height(0, 255);
+
+    std::vector<PaintStruct> paintStructs(count);
+    for (auto& ps : paintStructs)
+    {
+        ps = {};
+        ps.Bounds.x = position(rng);
+        ps.Bounds.y = position(rng);
+        ps.Bounds.z = height(rng);
+        ps.Bounds.x_end = ps.Bounds.x + size(rng);
+        ps.Bounds.y_end = ps.Bounds.y + size(rng);
+        ps.Bounds.z_end = ps.Bounds.z + size(rng);
+    }
+    return paintStructs;
+}
+
+static void BM_PaintSessionArrange(benchmark::State& state)
+{
+    auto paintStructs = CreatePaintStructs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        // Arranging consumes the quadrant lists, rebuilding them is a small linear pass next to the sort
+        PaintSessionCore session{};
+        session.QuadrantBackIndex = UINT32_MAX;
+        session.QuadrantFrontIndex = 0;
+        for (auto& ps : paintStructs)
+        {
+            const uint32_t quadrantIndex = (ps.Bounds.x + ps.Bounds.y) / COORDS_XY_STEP;
+            ps.QuadrantIndex = quadrantIndex;
+            ps.NextQuadrantEntry = session.Quadrants[quadrantIndex];
+            session.Quadrants[quadrantIndex] = &ps;
+            session.QuadrantBackIndex = std::min(session.QuadrantBackIndex, quadrantIndex);
+            session.QuadrantFrontIndex = std::max(session.QuadrantFrontIndex, quadrantIndex);
+        }
+        PaintSessionArrange(session);
+        benchmark::DoNotOptimize(session.PaintHead);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * paintStructs.size()));
+}
+BENCHMARK(BM_PaintSessionArrange)->Arg(500)->Arg(4000);
+
+static void BM_GfxDrawSprite(benchmark::State& state)
+{
+    auto* context = BenchmarkContext::Get();
+    X8DrawingEngine drawingEngine(context->GetUiContext());
+
+    constexpr int32_t kWidth = 640;
+    constexpr int32_t kHeight = 480;
+    std::vector<uint8_t> pixels(kWidth * kHeight);
+    DrawPixelInfo dpi{};
+    dpi.bits = pixels.data();
+    dpi.width = kWidth;
+    dpi.height = kHeight;
+    dpi.DrawingEngine = &drawingEngine;
+
+    // A sample of sprites from across G1, so the mix of sizes and RLE runs is representative
+    constexpr int32_t kNumSprites = 1024;
+    for (auto _ : state)
+    {
+        for (int32_t i = 0; i < kNumSprites; i++)
+        {
+            const auto imageIndex = i * (SPR_G1_END / kNumSprites);
+            GfxDrawSprite(dpi, ImageId(imageIndex), { (i * 37) % kWidth, (i * 53) % kHeight });
+        }
+        benchmark::DoNotOptimize(pixels.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kNumSprites));
+}
+BENCHMARK(BM_GfxDrawSprite);
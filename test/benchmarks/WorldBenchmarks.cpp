@@ -0,0 +1,79 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "BenchmarkContext.h"
+
+#include <benchmark/benchmark.h>
+#include <openrct2/GameState.h>
+#include <openrct2/entity/EntityList.h>
+#include <openrct2/entity/Guest.h>
+#include <openrct2/localisation/Formatter.h>
+#include <openrct2/localisation/Formatting.h>
+#include <openrct2/localisation/StringIds.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/TileElementsView.h>
+
+using namespace OpenRCT2;
+
+static void BM_TileElementsViewIteration(benchmark::State& state)
+{
+    BenchmarkContext::Get();
+    const auto mapSize = GetGameState().MapSize;
+    for (auto _ : state)
+    {
+        size_t numElements = 0;
+        for (int32_t y = 0; y < mapSize.y; y++)
+        {
+            for (int32_t x = 0; x < mapSize.x; x++)
+            {
+                for (auto* element : TileElementsView(TileCoordsXY{ x, y }.ToCoordsXY()))
+                {
+                    benchmark::DoNotOptimize(element);
+                    numElements++;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(numElements);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * mapSize.x * mapSize.y));
+}
+BENCHMARK(BM_TileElementsViewIteration);
+
+static void BM_EntityListIteration(benchmark::State& state)
+{
+    BenchmarkContext::Get();
+    int64_t numGuests = 0;
+    for (auto _ : state)
+    {
+        int32_t happiness = 0;
+        for (auto* guest : EntityList<Guest>())
+        {
+            happiness += guest->Happiness;
+            numGuests++;
+        }
+        benchmark::DoNotOptimize(happiness);
+    }
+    state.SetItemsProcessed(numGuests);
+}
+BENCHMARK(BM_EntityListIteration);
+
+static void BM_FormatStringLegacy(benchmark::State& state)
+{
+    BenchmarkContext::Get();
+    char buffer[256];
+    uint32_t value = 0;
+    for (auto _ : state)
+    {
+        auto ft = Formatter();
+        ft.Add<uint32_t>(value++);
+        benchmark::DoNotOptimize(FormatStringLegacy(buffer, sizeof(buffer), STR_GUESTS_IN_PARK_LABEL, ft.Data()));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_FormatStringLegacy);
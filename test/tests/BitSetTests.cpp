@@ -9,6 +9,7 @@
 
 #include <gtest/gtest.h>
 #include <openrct2/core/BitSet.hpp>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -224,3 +225,41 @@ TEST(BitTest, test_iterator_const)
     test(bits1);
     ASSERT_EQ(totalBits, 10);
 }
+
+TEST(BitTest, test_andnot)
+{
+    BitSet<15u> bits1({ 0u, 2u, 4u, 14u });
+    BitSet<15u> bits2({ 0u, 1u, 3u, 14u });
+
+    bits1.andnot(bits2);
+    ASSERT_EQ(bits1.to_string(), "000000000010100");
+}
+
+TEST(BitTest, test_any_none_intersects)
+{
+    BitSet<256u> bits1;
+    BitSet<256u> bits2({ 3u, 200u });
+    ASSERT_TRUE(bits1.none());
+    ASSERT_FALSE(bits1.intersects(bits2));
+
+    bits1[200] = true;
+    ASSERT_TRUE(bits1.any());
+    ASSERT_TRUE(bits1.intersects(bits2));
+}
+
+TEST(BitTest, test_set_bits)
+{
+    BitSet<1000u> bits({ 0u, 63u, 64u, 65u, 500u, 999u });
+
+    std::vector<size_t> indices;
+    for (auto index : bits.set_bits())
+    {
+        indices.push_back(index);
+    }
+    ASSERT_EQ(indices, (std::vector<size_t>{ 0u, 63u, 64u, 65u, 500u, 999u }));
+    ASSERT_EQ(bits.find_next(999u), bits.size());
+
+    BitSet<1000u> empty;
+    ASSERT_EQ(empty.find_first(), empty.size());
+    ASSERT_TRUE(empty.set_bits().begin() == empty.set_bits().end());
+}
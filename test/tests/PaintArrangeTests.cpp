@@ -0,0 +1,87 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <openrct2/paint/Paint.h>
+#include <random>
+#include <vector>
+
+// Crowded scene with lots of overlapping bounding boxes spread over a handful of quadrants.
+static std::vector<PaintStruct> CreatePaintStructs(uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int32_t> position(0, 8 * COORDS_XY_STEP);
+    std::uniform_int_distribution<int32_t> size(1, COORDS_XY_STEP);
+    std::uniform_int_distribution<int32_t> height(0, 255);
+
+    std::vector<PaintStruct> paintStructs(2000);
+    for (auto& ps : paintStructs)
+    {
+        ps = {};
+        ps.Bounds.x = position(rng);
+        ps.Bounds.y = position(rng);
+        ps.Bounds.z = height(rng);
+        ps.Bounds.x_end = ps.Bounds.x + size(rng);
+        ps.Bounds.y_end = ps.Bounds.y + size(rng);
+        ps.Bounds.z_end = ps.Bounds.z + size(rng);
+    }
+    return paintStructs;
+}
+
+static std::vector<size_t> Arrange(std::vector<PaintStruct>& paintStructs, uint8_t rotation, bool linked)
+{
+    PaintSessionCore session{};
+    session.CurrentRotation = rotation;
+    session.QuadrantBackIndex = UINT32_MAX;
+    session.QuadrantFrontIndex = 0;
+    for (auto& ps : paintStructs)
+    {
+        const uint32_t quadrantIndex = (ps.Bounds.x + ps.Bounds.y) / COORDS_XY_STEP;
+        ps.QuadrantIndex = quadrantIndex;
+        ps.NextQuadrantEntry = session.Quadrants[quadrantIndex];
+        session.Quadrants[quadrantIndex] = &ps;
+        session.QuadrantBackIndex = std::min(session.QuadrantBackIndex, quadrantIndex);
+        session.QuadrantFrontIndex = std::max(session.QuadrantFrontIndex, quadrantIndex);
+    }
+
+    if (linked)
+        PaintSessionArrangeLinked(session);
+    else
+        PaintSessionArrange(session);
+
+    std::vector<size_t> order;
+    for (auto* ps = session.PaintHead; ps != nullptr; ps = ps->NextQuadrantEntry)
+    {
+        order.push_back(ps - paintStructs.data());
+    }
+    return order;
+}
+
+TEST(PaintArrangeTest, ContiguousMatchesLinked)
+{
+    for (uint8_t rotation = 0; rotation < 4; rotation++)
+    {
+        auto linkedStructs = CreatePaintStructs(rotation);
+        auto contiguousStructs = linkedStructs;
+
+        auto linkedOrder = Arrange(linkedStructs, rotation, true);
+        auto contiguousOrder = Arrange(contiguousStructs, rotation, false);
+        ASSERT_EQ(linkedOrder.size(), linkedStructs.size());
+        ASSERT_EQ(linkedOrder, contiguousOrder) << "rotation " << static_cast<int>(rotation);
+    }
+}
+
+TEST(PaintArrangeTest, EmptySession)
+{
+    PaintSessionCore session{};
+    session.QuadrantBackIndex = UINT32_MAX;
+    PaintSessionArrange(session);
+    ASSERT_EQ(session.PaintHead, nullptr);
+}
@@ -18,6 +18,7 @@
 #include <openrct2/world/Footpath.h>
 #include <openrct2/world/Map.h>
 #include <openrct2/world/TileElementsView.h>
+#include <optional>
 
 using namespace OpenRCT2;
 
@@ -179,3 +180,173 @@ TEST_F(TileElementsViewTests, QueryTypeBannerElements)
 {
     CheckMapTiles<BannerElement>();
 }
+
+template<typename T> std::vector<std::pair<TileCoordsXY, T*>> BuildRangeManual(const MapRange& range)
+{
+    std::vector<std::pair<TileCoordsXY, T*>> res;
+
+    // A tile is part of the range when any of its coordinates are
+    const auto normalised = range.Normalise();
+    for (int y = 0; y < kMaximumMapSizeTechnical; ++y)
+    {
+        if (y * COORDS_XY_STEP + COORDS_XY_STEP - 1 < normalised.GetTop() || y * COORDS_XY_STEP > normalised.GetBottom())
+            continue;
+
+        for (int x = 0; x < kMaximumMapSizeTechnical; ++x)
+        {
+            if (x * COORDS_XY_STEP + COORDS_XY_STEP - 1 < normalised.GetLeft() || x * COORDS_XY_STEP > normalised.GetRight())
+                continue;
+
+            const auto loc = TileCoordsXY(x, y);
+            for (auto* element : BuildListManual<T>(loc.ToCoordsXY()))
+            {
+                res.emplace_back(loc, element);
+            }
+        }
+    }
+
+    return res;
+}
+
+template<typename T> std::vector<std::pair<TileCoordsXY, T*>> BuildRangeByView(const MapRange& range)
+{
+    std::vector<std::pair<TileCoordsXY, T*>> res;
+
+    for (const auto& entry : TileElementsRangeView<T>(range))
+    {
+        res.emplace_back(entry.Location, entry.Element);
+    }
+
+    return res;
+}
+
+template<typename T> void CompareRange(const MapRange& range)
+{
+    auto listManual = BuildRangeManual<T>(range);
+    auto listView = BuildRangeByView<T>(range);
+
+    ASSERT_EQ(listManual.size(), listView.size());
+    for (size_t i = 0; i < listManual.size(); ++i)
+    {
+        EXPECT_EQ(listManual[i].first, listView[i].first) << "[i] = " << i;
+        EXPECT_EQ(listManual[i].second, listView[i].second) << "[i] = " << i;
+    }
+}
+
+// Returns a tile holding at least count elements of type T, if the park has one.
+template<typename T> std::optional<TileCoordsXY> FindTileWithElementCount(size_t count)
+{
+    for (int y = 0; y < kMaximumMapSizeTechnical; ++y)
+    {
+        for (int x = 0; x < kMaximumMapSizeTechnical; ++x)
+        {
+            const auto loc = TileCoordsXY(x, y);
+            if (BuildListManual<T>(loc.ToCoordsXY()).size() >= count)
+                return loc;
+        }
+    }
+    return std::nullopt;
+}
+
+static MapRange TileRange(const TileCoordsXY& leftTop, const TileCoordsXY& rightBottom)
+{
+    return { leftTop.ToCoordsXY(), rightBottom.ToCoordsXY() + CoordsXY{ COORDS_XY_STEP - 1, COORDS_XY_STEP - 1 } };
+}
+
+TEST_F(TileElementsViewTests, RangeInsideMap)
+{
+    const auto range = TileRange({ 5, 10 }, { 60, 40 });
+    CompareRange<TileElement>(range);
+    CompareRange<PathElement>(range);
+    CompareRange<SurfaceElement>(range);
+    CompareRange<TrackElement>(range);
+    CompareRange<SmallSceneryElement>(range);
+}
+
+TEST_F(TileElementsViewTests, RangeWholeMap)
+{
+    const auto range = TileRange({ 0, 0 }, { kMaximumMapSizeTechnical - 1, kMaximumMapSizeTechnical - 1 });
+    CompareRange<TileElement>(range);
+    CompareRange<PathElement>(range);
+    CompareRange<WallElement>(range);
+}
+
+TEST_F(TileElementsViewTests, RangeReversed)
+{
+    const auto range = MapRange{ TileCoordsXY(40, 30).ToCoordsXY(), TileCoordsXY(3, 7).ToCoordsXY() };
+    CompareRange<TileElement>(range);
+    CompareRange<PathElement>(range);
+    EXPECT_FALSE(BuildRangeByView<TileElement>(range).empty());
+}
+
+TEST_F(TileElementsViewTests, RangePartlyNegative)
+{
+    const auto range = MapRange{ { -200, -100 }, { 320, 640 } };
+    CompareRange<TileElement>(range);
+    CompareRange<PathElement>(range);
+
+    // The range is clipped to the first row and column of the map
+    auto listView = BuildRangeByView<TileElement>(range);
+    ASSERT_FALSE(listView.empty());
+    EXPECT_EQ(listView.front().first, TileCoordsXY(0, 0));
+}
+
+TEST_F(TileElementsViewTests, RangeEntirelyNegative)
+{
+    EXPECT_TRUE(BuildRangeByView<TileElement>(MapRange{ { -500, -500 }, { -1, -1 } }).empty());
+    EXPECT_TRUE(BuildRangeByView<TileElement>(MapRange{ { -500, 64 }, { -1, 640 } }).empty());
+    EXPECT_TRUE(BuildRangeByView<TileElement>(MapRange{ { 64, -500 }, { 640, -1 } }).empty());
+}
+
+TEST_F(TileElementsViewTests, RangePartlyPastTechnicalEdge)
+{
+    const auto range = TileRange(
+        { kMaximumMapSizeTechnical - 4, kMaximumMapSizeTechnical - 6 },
+        { kMaximumMapSizeTechnical + 10, kMaximumMapSizeTechnical + 20 });
+    CompareRange<TileElement>(range);
+
+    auto listView = BuildRangeByView<TileElement>(range);
+    ASSERT_FALSE(listView.empty());
+    EXPECT_EQ(listView.back().first.x, kMaximumMapSizeTechnical - 1);
+    EXPECT_EQ(listView.back().first.y, kMaximumMapSizeTechnical - 1);
+}
+
+TEST_F(TileElementsViewTests, RangeEntirelyPastTechnicalEdge)
+{
+    const auto range = TileRange(
+        { kMaximumMapSizeTechnical, kMaximumMapSizeTechnical },
+        { kMaximumMapSizeTechnical + 10, kMaximumMapSizeTechnical + 10 });
+    EXPECT_TRUE(BuildRangeByView<TileElement>(range).empty());
+
+    const auto rangeRight = TileRange({ kMaximumMapSizeTechnical, 0 }, { kMaximumMapSizeTechnical + 10, 10 });
+    EXPECT_TRUE(BuildRangeByView<TileElement>(rangeRight).empty());
+}
+
+TEST_F(TileElementsViewTests, RangeTileWithSeveralElements)
+{
+    auto loc = FindTileWithElementCount<TileElement>(2);
+    ASSERT_TRUE(loc.has_value());
+    CompareRange<TileElement>(TileRange(*loc, *loc));
+    EXPECT_GE(BuildRangeByView<TileElement>(TileRange(*loc, *loc)).size(), 2u);
+
+    auto sceneryLoc = FindTileWithElementCount<SmallSceneryElement>(2);
+    if (sceneryLoc.has_value())
+    {
+        CompareRange<SmallSceneryElement>(TileRange(*sceneryLoc, *sceneryLoc));
+        EXPECT_GE(BuildRangeByView<SmallSceneryElement>(TileRange(*sceneryLoc, *sceneryLoc)).size(), 2u);
+    }
+}
+
+TEST_F(TileElementsViewTests, RangeTileWithoutElements)
+{
+    // The corner of the technical map lies outside the park and only holds a surface
+    const auto loc = TileCoordsXY(kMaximumMapSizeTechnical - 1, kMaximumMapSizeTechnical - 1);
+    ASSERT_TRUE(BuildListManual<TrackElement>(loc.ToCoordsXY()).empty());
+    EXPECT_TRUE(BuildRangeByView<TrackElement>(TileRange(loc, loc)).empty());
+    EXPECT_TRUE(BuildRangeByView<PathElement>(TileRange(loc, loc)).empty());
+
+    // A range of tiles without matches on either side of one with a match
+    auto pathLoc = FindTileWithElementCount<PathElement>(1);
+    ASSERT_TRUE(pathLoc.has_value());
+    CompareRange<PathElement>(TileRange({ 0, pathLoc->y }, { kMaximumMapSizeTechnical - 1, pathLoc->y }));
+}